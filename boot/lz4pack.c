@@ -0,0 +1,346 @@
+/*
+ * Pack the loadable segments of the kernel ELF image with LZ4.
+ *
+ *	lz4pack [-l] [-z] kernel kernel.lz4
+ *
+ * Each PT_LOAD segment's file contents are replaced by one LZ4 block
+ * (see lib/lz4.c) and the segment is marked with ELF_PROG_FLAG_LZ4, with
+ * p_filesz becoming the size of the block.  The boot loader inflates the
+ * block straight to p_pa and zero-fills the rest of p_memsz as before.
+ * Segments that would not shrink are stored as they are.
+ *
+ * With -l, the segments at address 0, which hold the debug sections (see
+ * kern/kernel.ld), are stored as they are too: with CONFIG_DWARF_LAZY the
+ * kernel reads them off the disk itself.  -z (which implies -l) stores
+ * them as zlib-compressed ELF sections instead (ELF_SHF_COMPRESSED, with
+ * a Chdr in front of the zlib stream), which the kernel inflates as it
+ * reads them.  The linker's --compress-debug-sections cannot do this:
+ * it leaves allocated sections alone.  The segments of these sections
+ * get a p_filesz of 0, as their file contents are no longer a memory
+ * image.  -z needs lz4pack built with zlib (-DHAVE_ZLIB, which
+ * CONFIG_DWARF_ZLIB=y does).
+ *
+ * The contents of the sections outside the loadable segments are copied
+ * unchanged and their sh_offset fields updated.  Allocated sections
+ * inside a packed segment are left pointing at the start of the
+ * segment's block.
+ *
+ * Prints how much smaller the segments got and how many fewer sectors
+ * the boot loader has to read.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+#ifdef HAVE_ZLIB
+#include <zlib.h>
+#endif
+
+#include <inc/elf.h>
+
+#define SECTSIZE	512
+
+#define HASH_LOG	16
+#define MINMATCH	4
+#define MFLIMIT		12	// a match must start this far from the end
+#define LASTLITERALS	5	// and stop this far from it
+#define MAXOFFSET	65535
+
+#define ROUNDUP(n, a)	(((n) + (a) - 1) / (a) * (a))
+
+static uint32_t htab[1 << HASH_LOG];
+
+static void
+panic(const char *msg)
+{
+	fprintf(stderr, "lz4pack: %s\n", msg);
+	exit(1);
+}
+
+static uint32_t
+read32(const uint8_t *p)
+{
+	uint32_t v;
+
+	memcpy(&v, p, 4);
+	return v;
+}
+
+static uint32_t
+hash(uint32_t v)
+{
+	return (v * 2654435761U) >> (32 - HASH_LOG);
+}
+
+static uint8_t *
+put_length(uint8_t *op, size_t len)
+{
+	for (; len >= 255; len -= 255)
+		*op++ = 255;
+	*op++ = len;
+	return op;
+}
+
+static uint8_t *
+put_sequence(uint8_t *op, const uint8_t *lit, size_t nlit,
+	     size_t off, size_t mlen)
+{
+	uint8_t *token = op++;
+
+	*token = (nlit < 15 ? nlit : 15) << 4;
+	if (nlit >= 15)
+		op = put_length(op, nlit - 15);
+	memcpy(op, lit, nlit);
+	op += nlit;
+
+	if (mlen == 0)		// last sequence
+		return op;
+
+	*op++ = off;
+	*op++ = off >> 8;
+	mlen -= MINMATCH;
+	*token |= mlen < 15 ? mlen : 15;
+	if (mlen >= 15)
+		op = put_length(op, mlen - 15);
+	return op;
+}
+
+// Greedy single-probe compressor, the same scheme as LZ4's fast mode.
+// 'dst' must have room for lz4_bound(n) bytes.  Returns the block size.
+static size_t
+lz4_compress(const uint8_t *src, size_t n, uint8_t *dst)
+{
+	size_t ip = 0, anchor = 0, ref, mlen;
+	uint8_t *op = dst;
+	uint32_t h;
+
+	// htab maps the hash of 4 bytes to where they were last seen,
+	// plus one so that 0 means never.
+	memset(htab, 0, sizeof(htab));
+	while (n >= MFLIMIT && ip <= n - MFLIMIT) {
+		h = hash(read32(src + ip));
+		ref = htab[h];
+		htab[h] = ip + 1;
+		if (ref == 0 || ip - --ref > MAXOFFSET
+		    || read32(src + ref) != read32(src + ip)) {
+			ip++;
+			continue;
+		}
+		for (mlen = MINMATCH; ip + mlen < n - LASTLITERALS
+			     && src[ip + mlen] == src[ref + mlen]; mlen++)
+			/* do nothing */;
+		op = put_sequence(op, src + anchor, ip - anchor, ip - ref, mlen);
+		ip += mlen;
+		anchor = ip;
+	}
+	op = put_sequence(op, src + anchor, n - anchor, 0, 0);
+	return op - dst;
+}
+
+static size_t
+lz4_bound(size_t n)
+{
+	return n + n / 255 + 16;
+}
+
+#ifdef HAVE_ZLIB
+// Store 'n' bytes at 'src' to 'dst' as the data of a compressed ELF
+// section: a Chdr, then a zlib stream.  Returns the size of the data.
+static size_t
+zlib_section(const uint8_t *src, size_t n, uint8_t *dst)
+{
+	struct Chdr ch = { ELF_COMPRESS_ZLIB, n, 1 };
+	uLongf zlen = compressBound(n);
+
+	memcpy(dst, &ch, sizeof(ch));
+	if (compress2(dst + sizeof(ch), &zlen, src, n, Z_BEST_COMPRESSION) != Z_OK)
+		panic("zlib compress2 failed");
+	return sizeof(ch) + zlen;
+}
+#else
+static size_t
+zlib_section(const uint8_t *src, size_t n, uint8_t *dst)
+{
+	panic("built without zlib; -z needs CONFIG_DWARF_ZLIB=y");
+	return 0;
+}
+#endif
+
+// Number of sectors the boot loader reads for 'len' bytes at 'offset'.
+static uint32_t
+nsect(uint32_t offset, uint32_t len)
+{
+	if (len == 0)
+		return 0;
+	return (offset % SECTSIZE + len + SECTSIZE - 1) / SECTSIZE;
+}
+
+int
+main(int argc, char **argv)
+{
+	FILE *f;
+	uint8_t *in, *out, *blk;
+	long insize;
+	size_t outsize, len;
+	struct Elf *elf, *oelf;
+	struct Proghdr *ph, *oph;
+	struct Secthdr *sh, *osh;
+	uint32_t *newoff, rawbytes = 0, packbytes = 0, rawsect = 0, packsect = 0;
+	uint32_t *zsize, zraw = 0, zpacked = 0;
+	int i, j;
+	clock_t t;
+	int lazy = 0, zlib = 0;
+
+	for (; argc > 1 && argv[1][0] == '-'; argc--, argv++) {
+		if (strcmp(argv[1], "-l") == 0)
+			lazy = 1;
+		else if (strcmp(argv[1], "-z") == 0)
+			lazy = zlib = 1;
+		else
+			break;
+	}
+	if (argc != 3) {
+		fprintf(stderr, "usage: lz4pack [-l] [-z] kernel output\n");
+		exit(2);
+	}
+
+	if ((f = fopen(argv[1], "rb")) == NULL)
+		panic("cannot open input");
+	fseek(f, 0, SEEK_END);
+	insize = ftell(f);
+	rewind(f);
+	in = malloc(insize);
+	if (fread(in, 1, insize, f) != (size_t) insize)
+		panic("short read");
+	fclose(f);
+
+	elf = (struct Elf *) in;
+	if (insize < (long) sizeof(*elf) || elf->e_magic != ELF_MAGIC
+	    || elf->e_elf[0] != 1 /* ELFCLASS32 */)
+		panic("not a 32-bit ELF file");
+	ph = (struct Proghdr *) (in + elf->e_phoff);
+	sh = (struct Secthdr *) (in + elf->e_shoff);
+
+	// Everything we write is at most its input size plus LZ4's worst
+	// case expansion plus padding for each segment and section.
+	outsize = lz4_bound(insize) + (elf->e_phnum + elf->e_shnum) * 2 * SECTSIZE;
+	out = calloc(1, outsize);
+	blk = malloc(lz4_bound(insize));
+	newoff = calloc(elf->e_phnum, sizeof(*newoff));
+	zsize = calloc(elf->e_phnum, sizeof(*zsize));
+
+	// The headers stay where they are; the boot loader reads them
+	// from the first page.
+	len = elf->e_phoff + elf->e_phnum * sizeof(*ph);
+	memcpy(out, in, len);
+	oelf = (struct Elf *) out;
+	oph = (struct Proghdr *) (out + elf->e_phoff);
+
+	t = clock();
+	for (i = 0; i < elf->e_phnum; i++) {
+		if (ph[i].p_type != ELF_PROG_LOAD || ph[i].p_filesz == 0)
+			continue;
+		size_t n = ph[i].p_filesz;
+		len = ROUNDUP(len, SECTSIZE);
+		if (zlib && ph[i].p_va == 0) {
+			n = zlib_section(in + ph[i].p_offset, ph[i].p_filesz,
+					 out + len);
+			oph[i].p_offset = newoff[i] = len;
+			oph[i].p_filesz = 0;
+			zsize[i] = n;
+			len += n;
+			zraw += ph[i].p_filesz;
+			zpacked += n;
+			continue;
+		}
+		if (!(lazy && ph[i].p_va == 0))
+			n = lz4_compress(in + ph[i].p_offset, ph[i].p_filesz, blk);
+		if (n < ph[i].p_filesz) {
+			memcpy(out + len, blk, n);
+			oph[i].p_filesz = n;
+			oph[i].p_flags |= ELF_PROG_FLAG_LZ4;
+		} else {
+			// readseg() wants the offset and the load address
+			// at the same place within a sector; so does the
+			// kernel when it reads the debug sections.
+			len += ph[i].p_pa % SECTSIZE;
+			memcpy(out + len, in + ph[i].p_offset, ph[i].p_filesz);
+		}
+		oph[i].p_offset = newoff[i] = len;
+		len += oph[i].p_filesz;
+
+		if (lazy && ph[i].p_va == 0)
+			continue;
+		rawbytes += ph[i].p_filesz;
+		packbytes += oph[i].p_filesz;
+		rawsect += nsect(ph[i].p_offset, ph[i].p_filesz);
+		packsect += nsect(oph[i].p_offset, oph[i].p_filesz);
+	}
+	t = clock() - t;
+
+	// Copy the contents of sections outside the loadable segments.
+	osh = malloc(elf->e_shnum * sizeof(*sh));
+	memcpy(osh, sh, elf->e_shnum * sizeof(*sh));
+	for (i = 0; i < elf->e_shnum; i++) {
+		if (sh[i].sh_type == ELF_SHT_NULL)
+			continue;
+		if (sh[i].sh_flags & ELF_SHF_ALLOC) {
+			// Find the segment by file offset: the debug
+			// segments all have address 0.  Only BSS-like
+			// sections have to go by address.
+			for (j = 0; j < elf->e_phnum; j++) {
+				if (!newoff[j])
+					continue;
+				if (sh[i].sh_type == ELF_SHT_NOBITS
+				    ? sh[i].sh_addr >= ph[j].p_va
+				      && sh[i].sh_addr < ph[j].p_va + ph[j].p_memsz
+				    : sh[i].sh_offset >= ph[j].p_offset
+				      && sh[i].sh_offset < ph[j].p_offset + ph[j].p_filesz)
+					break;
+			}
+			if (j == elf->e_phnum)
+				panic("allocated section outside any segment");
+			osh[i].sh_offset = newoff[j];
+			if (zsize[j]) {
+				// A compressed section is not a memory image.
+				osh[i].sh_flags &= ~ELF_SHF_ALLOC;
+				osh[i].sh_flags |= ELF_SHF_COMPRESSED;
+				osh[i].sh_size = zsize[j];
+				((struct Chdr *) (out + newoff[j]))->ch_addralign =
+					sh[i].sh_addralign;
+			} else if (!(oph[j].p_flags & ELF_PROG_FLAG_LZ4)
+				   && sh[i].sh_type != ELF_SHT_NOBITS)
+				osh[i].sh_offset += sh[i].sh_offset - ph[j].p_offset;
+			continue;
+		}
+		if (sh[i].sh_type == ELF_SHT_NOBITS)
+			continue;
+		if (sh[i].sh_addralign > 1)
+			len = ROUNDUP(len, sh[i].sh_addralign);
+		memcpy(out + len, in + sh[i].sh_offset, sh[i].sh_size);
+		osh[i].sh_offset = len;
+		len += sh[i].sh_size;
+	}
+
+	len = ROUNDUP(len, 4);
+	oelf->e_shoff = len;
+	memcpy(out + len, osh, elf->e_shnum * sizeof(*sh));
+	len += elf->e_shnum * sizeof(*sh);
+
+	if ((f = fopen(argv[2], "wb")) == NULL)
+		panic("cannot create output");
+	if (fwrite(out, 1, len, f) != len || fclose(f) != 0)
+		panic("write error");
+
+	fprintf(stderr, "kernel segments packed %u -> %u bytes (%u%%) in %.1f ms, "
+		"boot loader reads %u -> %u sectors\n",
+		rawbytes, packbytes, rawbytes ? packbytes * 100 / rawbytes : 100,
+		t * 1000.0 / CLOCKS_PER_SEC, rawsect, packsect);
+	if (zlib)
+		fprintf(stderr, "debug sections deflated %u -> %u bytes (%u%%)\n",
+			zraw, zpacked, zraw ? zpacked * 100 / zraw : 100);
+	fprintf(stderr, "kernel image %ld -> %zu bytes\n", insize, len);
+	return 0;
+}
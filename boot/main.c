@@ -1,17 +1,24 @@
 #include <inc/x86.h>
 #include <inc/elf.h>
+#include <inc/bootinfo.h>
+#include <inc/ide.h>
+#include <inc/lz4.h>
 
 /**********************************************************************
  * This a dirt simple boot loader, whose sole job is to boot
  * an ELF kernel image from the first IDE hard disk.
  *
  * DISK LAYOUT
- *  * This program(boot.S and main.c) is the bootloader.  It should
- *    be stored in the first sector of the disk.
+ *  * The first stage of the bootloader (boot.S) should be stored in the
+ *    first sector of the disk.
  *
- *  * The 2nd sector onward holds the kernel image.
+ *  * The second stage (boot2.S and this file) is stored in the next
+ *    BOOT2_NSECT sectors.
  *
- *  * The kernel image must be in ELF format.
+ *  * The sectors after that hold the kernel image.
+ *
+ *  * The kernel image must be in ELF format.  Its segments may be packed
+ *    with LZ4 (ELF_PROG_FLAG_LZ4, see boot/lz4pack.c).
  *
  * BOOT UP STEPS
  *  * when the CPU boots it loads the BIOS into memory and executes it
@@ -23,22 +30,37 @@
  *  * Assuming this boot loader is stored in the first sector of the
  *    hard-drive, this code takes over...
  *
- *  * control starts in boot.S -- which sets up protected mode,
- *    and a stack so C code then run, then calls bootmain()
+ *  * control starts in boot.S -- which sets up protected mode
+ *    and a stack, reads in the second stage and jumps to it
+ *
+ *  * boot2.S clears the second stage's BSS, then calls bootmain()
  *
  *  * bootmain() in this file takes over, reads in the kernel and jumps to it.
+ *    The TSC values at the start and the end of loading, and the start
+ *    of the boot timeline, are left in the boot info block (see
+ *    inc/bootinfo.h) for the kernel to report.
  **********************************************************************/
 
-#define SECTSIZE	512
+#define KERNSECT	(1 + BOOT2_NSECT)	// first sector of the kernel
 #define ELFHDR		((struct Elf *) 0x10000) // scratch space
+#define LZ4BUF		0x800000	// where packed segments are read to
 
-void readsect(void*, uint32_t);
-void readseg(uint32_t, uint32_t, uint32_t);
+static void readseg(uint32_t, uint32_t, uint32_t);
 
 void
 bootmain(void)
 {
-	struct Proghdr *ph, *eph;
+	struct Proghdr *bph, *ph, *eph;
+	uint32_t src;
+	uint64_t tsc;
+	int n;
+
+	BOOTINFO->bi_load_start = read_tsc();
+	BOOTINFO->bi_kernsect = KERNSECT;
+	BOOTINFO->bi_inflate = 0;
+	BOOTINFO->bi_flags = 0;
+	BOOTINFO->bi_nevents = 0;
+	boot_event(BOOTEV_LOADER, 0, BOOTINFO->bi_load_start);
 
 	// read 1st page off disk
 	readseg((uint32_t) ELFHDR, SECTSIZE*8, 0);
@@ -47,13 +69,52 @@ bootmain(void)
 	if (ELFHDR->e_magic != ELF_MAGIC)
 		goto bad;
 
-	// load each program segment (ignores ph flags)
-	ph = (struct Proghdr *) ((uint8_t *) ELFHDR + ELFHDR->e_phoff);
+	// load each program segment
+	bph = ph = (struct Proghdr *) ((uint8_t *) ELFHDR + ELFHDR->e_phoff);
 	eph = ph + ELFHDR->e_phnum;
-	for (; ph < eph; ph++)
+	for (; ph < eph; ph++) {
+		if (ph->p_type != ELF_PROG_LOAD)
+			continue;
+#ifdef CONFIG_DWARF_LAZY
+		// The segments kern/kernel.ld gives address 0 hold the
+		// debug sections; the kernel reads those when it needs them.
+		if (ph->p_va == 0) {
+			BOOTINFO->bi_flags |= BOOTINFO_DEBUG_ONDISK;
+			continue;
+		}
+#endif
 		// p_pa is the load address of this segment (as well
-		// as the physical address)
-		readseg(ph->p_pa, ph->p_memsz, ph->p_offset);
+		// as the physical address).
+		if (ph->p_flags & ELF_PROG_FLAG_LZ4) {
+			// Read the packed block out of the way, at the same
+			// place within a sector as on the disk, and inflate
+			// it to where the segment goes.
+			src = LZ4BUF + ph->p_offset % SECTSIZE;
+			readseg(src, ph->p_filesz, ph->p_offset);
+			tsc = read_tsc();
+			n = lz4_decompress((void *) src, ph->p_filesz,
+					   (void *) ph->p_pa, ph->p_memsz);
+			BOOTINFO->bi_inflate += read_tsc() - tsc;
+			if (n < 0)
+				goto bad;
+		} else {
+			readseg(ph->p_pa, ph->p_filesz, ph->p_offset);
+			n = ph->p_filesz;
+		}
+		// Only the first n bytes of the segment are in the file;
+		// the rest is BSS, so zero it in place rather than reading
+		// it off the disk.
+		stosb((uint8_t *) ph->p_pa + n, 0, ph->p_memsz - n);
+		// A debug section's segment is named by where it goes.
+		if (ph->p_va == 0)
+			boot_event(BOOTEV_DEBUGSECT, ph->p_pa, read_tsc());
+		else
+			boot_event(BOOTEV_PROGHDR, ph - bph, read_tsc());
+	}
+
+	BOOTINFO->bi_load_end = read_tsc();
+	BOOTINFO->bi_flags |= BOOTINFO_BSS_ZEROED;
+	BOOTINFO->bi_magic = BOOTINFO_MAGIC;
 
 	// call the entry point from the ELF header
 	// note: does not return!
@@ -68,7 +129,7 @@ bad:
 
 // Read 'count' bytes at 'offset' from kernel into physical address 'pa'.
 // Might copy more than asked
-void
+static void
 readseg(uint32_t pa, uint32_t count, uint32_t offset)
 {
 	uint32_t end_pa;
@@ -78,48 +139,17 @@ readseg(uint32_t pa, uint32_t count, uint32_t offset)
 	// round down to sector boundary
 	pa &= ~(SECTSIZE - 1);
 
-	// translate from bytes to sectors, and kernel starts at sector 1
-	offset = (offset / SECTSIZE) + 1;
+	// translate from bytes to sectors; kernel starts at sector KERNSECT
+	offset = (offset / SECTSIZE) + KERNSECT;
 
-	// If this is too slow, we could read lots of sectors at a time.
+	// Read all sectors covering [pa, end_pa) at once; ide_read() splits
+	// them into as few disk commands as it can and uses DMA if possible.
 	// We'd write more to memory than asked, but it doesn't matter --
 	// we load in increasing order.
-	while (pa < end_pa) {
-		// Since we haven't enabled paging yet and we're using
-		// an identity segment mapping (see boot.S), we can
-		// use physical addresses directly.  This won't be the
-		// case once JOS enables the MMU.
-		readsect((uint8_t*) pa, offset);
-		pa += SECTSIZE;
-		offset++;
-	}
+	// Since we haven't enabled paging yet and we're using
+	// an identity segment mapping (see boot.S), we can
+	// use physical addresses directly.  This won't be the
+	// case once JOS enables the MMU.
+	if (pa < end_pa)
+		ide_read(offset, (void *) pa, (end_pa - pa + SECTSIZE - 1) / SECTSIZE);
 }
-
-void
-waitdisk(void)
-{
-	// wait for disk ready
-	while ((inb(0x1F7) & 0xC0) != 0x40)
-		/* do nothing */;
-}
-
-void
-readsect(void *dst, uint32_t offset)
-{
-	// wait for disk to be ready
-	waitdisk();
-
-	outb(0x1F2, 1);		// count = 1
-	outb(0x1F3, offset);
-	outb(0x1F4, offset >> 8);
-	outb(0x1F5, offset >> 16);
-	outb(0x1F6, (offset >> 24) | 0xE0);
-	outb(0x1F7, 0x20);	// cmd 0x20 - read sectors
-
-	// wait for disk to be ready
-	waitdisk();
-
-	// read a sector
-	insl(0x1F0, dst, SECTSIZE/4);
-}
-
@@ -0,0 +1,31 @@
+#!/usr/bin/perl
+
+open(BB, $ARGV[0]) || die "open $ARGV[0]: $!";
+my $nsect = $ARGV[1];
+my $max = 512 * $nsect;
+
+binmode BB;
+my $buf;
+read(BB, $buf, $max + 1);
+$n = length($buf);
+
+if($n > $max){
+	print STDERR "boot stage 2 too large: $n bytes (max $max)\n";
+	exit 1;
+}
+
+# Its BSS, which is not on the disk, has to fit in the memory too.
+my $memsz = $ARGV[2];
+if($memsz > $max){
+	print STDERR "boot stage 2 too large in memory: $memsz bytes (max $max)\n";
+	exit 1;
+}
+
+print STDERR "boot stage 2 is $n bytes, $memsz in memory (max $max)\n";
+
+$buf .= "\0" x ($max-$n);
+
+open(BB, ">$ARGV[0]") || die "open >$ARGV[0]: $!";
+binmode BB;
+print BB $buf;
+close BB;
@@ -6,7 +6,9 @@
 #include <inc/stdio.h>
 
 void _warn(const char*, int, const char*, ...) __attribute__((format(printf, 3, 4)));
-void _panic(const char*, int, const char*, ...) __attribute__((noreturn)) __attribute__((format(printf, 3, 4)));
+// The paths to a panic are cold, so -freorder-blocks-and-partition moves
+// them out of the functions they are in.
+void _panic(const char*, int, const char*, ...) __attribute__((noreturn)) __attribute__((cold)) __attribute__((format(printf, 3, 4)));
 
 #define warn(...) _warn(__FILE__, __LINE__, __VA_ARGS__)
 #define panic(...) _panic(__FILE__, __LINE__, __VA_ARGS__)
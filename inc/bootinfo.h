@@ -0,0 +1,74 @@
+#ifndef JOS_INC_BOOTINFO_H
+#define JOS_INC_BOOTINFO_H
+
+/*
+ * Information handed from the boot loader to the kernel.
+ *
+ * The boot loader fills this block in at a fixed physical address in
+ * the free conventional memory below its stack.  The kernel may also be
+ * started by a multiboot loader that knows nothing about it, so the
+ * contents are only to be trusted if bi_magic is BOOTINFO_MAGIC.
+ */
+
+#define BOOTINFO_ADDR	0x1000
+#define BOOTINFO_MAGIC	0x4A4F5342	/* "BSOJ" in little endian */
+
+// Values for Bootinfo::bi_flags
+#define BOOTINFO_BSS_ZEROED	0x1	// loader zero-filled p_memsz - p_filesz
+#define BOOTINFO_DEBUG_ONDISK	0x2	// loader left the debug sections on
+					// the disk (CONFIG_DWARF_LAZY)
+
+// Boot timeline events, Bootevent::be_what
+#define BOOTEV_LOADER	0	// boot loader starts loading the kernel
+#define BOOTEV_PROGHDR	1	// loaded program header number be_arg
+#define BOOTEV_ENTRY	2	// kernel entry point
+#define BOOTEV_INIT	3	// i386_init
+#define BOOTEV_CONS	4	// console initialized
+#define BOOTEV_DEBUGSECT 5	// loaded debug section, be_arg is where
+#define BOOTEV_MONITOR	6	// first kernel monitor prompt
+
+#define BOOTINFO_NEVENTS	32
+
+#ifndef __ASSEMBLER__
+
+#include <inc/types.h>
+#include <inc/x86.h>
+
+// One entry in the boot timeline: something happened at TSC be_tsc.
+// The boot loader starts the timeline and the kernel appends to it.
+struct Bootevent {
+	uint32_t be_what;	// BOOTEV_*
+	uint32_t be_arg;	// event-specific
+	uint64_t be_tsc;
+};
+
+struct Bootinfo {
+	uint32_t bi_magic;	// must equal BOOTINFO_MAGIC
+	uint32_t bi_flags;
+	uint32_t bi_kernsect;	// first disk sector of the kernel ELF image
+	uint64_t bi_load_start;	// TSC when the boot loader started loading
+	uint64_t bi_load_end;	// TSC right before jumping to the kernel
+	uint64_t bi_inflate;	// cycles of the above spent inflating
+	uint32_t bi_nevents;	// boot timeline, oldest first
+	struct Bootevent bi_events[BOOTINFO_NEVENTS];
+};
+
+#define BOOTINFO	((struct Bootinfo *) BOOTINFO_ADDR)
+
+// Append an event to the boot timeline, dropping it if the table is full.
+static __inline void
+boot_event(uint32_t what, uint32_t arg, uint64_t tsc)
+{
+	struct Bootevent *ev;
+
+	if (BOOTINFO->bi_nevents >= BOOTINFO_NEVENTS)
+		return;
+	ev = &BOOTINFO->bi_events[BOOTINFO->bi_nevents++];
+	ev->be_what = what;
+	ev->be_arg = arg;
+	ev->be_tsc = tsc;
+}
+
+#endif /* !__ASSEMBLER__ */
+
+#endif /* !JOS_INC_BOOTINFO_H */
@@ -0,0 +1,64 @@
+#ifndef JOS_INC_DBGTAB_H
+#define JOS_INC_DBGTAB_H
+
+/*
+ * The debug table: what debuginfo_eip() needs from the kernel's DWARF,
+ * precomputed by kern/mkdbgtab.c at build time and linked into the
+ * kernel's .dbgtab section by a second link pass.
+ *
+ * After the header come, each 4-byte aligned:
+ *
+ *	dt_nunits struct Dbgtab_range		compilation units, by address
+ *	dt_nfuncs struct Dbgtab_range		functions, by address
+ *	dt_ninlines struct Dbgtab_inline	pieces of inlined functions
+ *	struct Dbgtab_anchor			every DBGTAB_STRIDE'th line row
+ *	dt_rows_size bytes			the rows between the anchors
+ *	dt_strings_size bytes			names, each once, NUL-terminated
+ *						after its 2-byte length
+ *
+ * The line rows of all units are sorted by address into one table, as
+ * kern/dwarf_lines.c decodes them for one unit: each row between two
+ * anchors is a ULEB128 address and an SLEB128 line delta from the row
+ * before it, and a row with line 0 ends a sequence.
+ *
+ * The pieces of inlined functions are sorted by address, and a piece
+ * before the pieces inside it, as kern/dwarf_index.c indexes them for a
+ * unit; each links to the piece it is inside.
+ */
+
+#define DBGTAB_MAGIC	0x54474244	/* "DBGT" in little endian */
+#define DBGTAB_STRIDE	16
+
+struct Dbgtab {
+	uint32_t dt_magic;	// must equal DBGTAB_MAGIC
+	uint32_t dt_nunits;
+	uint32_t dt_nfuncs;
+	uint32_t dt_ninlines;
+	uint32_t dt_nrows;	// line rows, anchors included
+	uint32_t dt_rows_size;
+	uint32_t dt_strings_size;
+};
+
+struct Dbgtab_range {
+	uint32_t dr_start;
+	uint32_t dr_end;	// inclusive, as the DWARF lookups have it
+	uint32_t dr_name;	// offset in the strings
+};
+
+struct Dbgtab_inline {
+	uint32_t di_start;
+	uint32_t di_end;	// exclusive, as DW_AT_high_pc has it
+	uint32_t di_name;	// offsets in the strings
+	uint32_t di_decl_file;	// where the function is
+	uint32_t di_call_file;	// where it was inlined
+	uint32_t di_call_line;
+	int32_t di_parent;	// index of the piece it is inside, or -1
+};
+
+struct Dbgtab_anchor {
+	uint32_t da_addr;
+	int32_t da_line;
+	uint32_t da_rows;	// offset in the rows of the deltas that follow
+};
+
+#endif	// !JOS_INC_DBGTAB_H
@@ -299,6 +299,21 @@
 #define DW_EXT_HI	0xffffffff
 #define DW_EXT_DWARF64	DW_EXT_HI
 
+/* Unit header unit_type, DWARF5 */
+#define DW_UT_compile                   0x01
+#define DW_UT_type                      0x02
+#define DW_UT_partial                   0x03
+#define DW_UT_skeleton                  0x04
+#define DW_UT_split_compile             0x05
+#define DW_UT_split_type                0x06
+
+/* Name index attributes in .debug_names, DWARF5 */
+#define DW_IDX_compile_unit             0x01
+#define DW_IDX_type_unit                0x02
+#define DW_IDX_die_offset               0x03
+#define DW_IDX_parent                   0x04
+#define DW_IDX_type_hash                0x05
+
 /* Line number standard opcode name. */
 #define DW_LNS_copy                     0x01
 #define DW_LNS_advance_pc               0x02
@@ -321,6 +336,23 @@
 #define DW_LNE_lo_user                  0x80 /* DWARF3 */
 #define DW_LNE_hi_user                  0xff /* DWARF3 */
 
+/* Line number header entry format, DWARF5 */
+#define DW_LNCT_path                    0x1
+#define DW_LNCT_directory_index         0x2
+#define DW_LNCT_timestamp               0x3
+#define DW_LNCT_size                    0x4
+#define DW_LNCT_MD5                     0x5
+
+/* Range list entry kinds in .debug_rnglists, DWARF5 */
+#define DW_RLE_end_of_list              0x00
+#define DW_RLE_base_addressx            0x01
+#define DW_RLE_startx_endx              0x02
+#define DW_RLE_startx_length            0x03
+#define DW_RLE_offset_pair              0x04
+#define DW_RLE_base_address             0x05
+#define DW_RLE_start_end                0x06
+#define DW_RLE_start_length             0x07
+
 typedef unsigned long long Dwarf_Unsigned;
 typedef signed   long long Dwarf_Signed;
 typedef unsigned long long Dwarf_Off;
@@ -344,6 +376,18 @@ struct Dwarf_Addrs {
 	const unsigned char *pubnames_end;
 	const unsigned char *pubtypes_begin;
 	const unsigned char *pubtypes_end;
+	const unsigned char *line_str_begin;
+	const unsigned char *line_str_end;
+	const unsigned char *str_offsets_begin;
+	const unsigned char *str_offsets_end;
+	const unsigned char *addr_begin;
+	const unsigned char *addr_end;
+	const unsigned char *names_begin;
+	const unsigned char *names_end;
+	const unsigned char *ranges_begin;
+	const unsigned char *ranges_end;
+	const unsigned char *rnglists_begin;
+	const unsigned char *rnglists_end;
 };
 
 // Unaligned read from address `addr`
@@ -387,37 +431,347 @@ struct Dwarf_Addrs {
 int info_by_address(const struct Dwarf_Addrs *addrs, uintptr_t p, Dwarf_Off *store);
 int file_name_by_info(const struct Dwarf_Addrs *addrs, Dwarf_Off offset, char *buf, int len, Dwarf_Off *line_off);
 int line_for_address(const struct Dwarf_Addrs *addrs, uintptr_t p, Dwarf_Off line_offset, int *store);
+int lines_for_addresses(const struct Dwarf_Addrs *addrs, Dwarf_Off line_offset, const uintptr_t *ps, int n, int *store);
 int function_by_info(const struct Dwarf_Addrs *addrs, uintptr_t p, Dwarf_Off cu_offset, char *buf, int buflen, uint32_t *offset);
 int address_by_fname(const struct Dwarf_Addrs *addrs, const char *fname, uint32_t *offset);
+int dwarf_read_abbrev_entry(const void *entry, unsigned form, void *buf, int bufsize, unsigned address_size);
 int naive_address_by_fname(const struct Dwarf_Addrs *addrs, const char *fname, uint32_t *offset);
 
+// Where the debug sections are in memory; defined by kern/kernel.ld.
+
 // .debug_abbrev section
-extern const unsigned char *__DEBUG_ABBREV_BEGIN__;
-extern const unsigned char *__DEBUG_ABBREV_END__;
+extern const unsigned char __DEBUG_ABBREV_BEGIN__[];
+extern const unsigned char __DEBUG_ABBREV_END__[];
 
 // .debug_aranges section
-extern const unsigned char *__DEBUG_ARANGES_BEGIN__;
-extern const unsigned char *__DEBUG_ARANGES_END__;
+extern const unsigned char __DEBUG_ARANGES_BEGIN__[];
+extern const unsigned char __DEBUG_ARANGES_END__[];
 
 // .debug_info section
-extern const unsigned char *__DEBUG_INFO_BEGIN__;
-extern const unsigned char *__DEBUG_INFO_END__;
+extern const unsigned char __DEBUG_INFO_BEGIN__[];
+extern const unsigned char __DEBUG_INFO_END__[];
 
 // .debug_str section
-extern const unsigned char *__DEBUG_STR_BEGIN__;
-extern const unsigned char *__DEBUG_STR_END__;
+extern const unsigned char __DEBUG_STR_BEGIN__[];
+extern const unsigned char __DEBUG_STR_END__[];
 
 // .debug_line section
-extern const unsigned char *__DEBUG_LINE_BEGIN__;
-extern const unsigned char *__DEBUG_LINE_END__;
+extern const unsigned char __DEBUG_LINE_BEGIN__[];
+extern const unsigned char __DEBUG_LINE_END__[];
 
 // .debug_pubnames section
-extern const unsigned char *__DEBUG_PUBNAMES_BEGIN__;
-extern const unsigned char *__DEBUG_PUBNAMES_END__;
+extern const unsigned char __DEBUG_PUBNAMES_BEGIN__[];
+extern const unsigned char __DEBUG_PUBNAMES_END__[];
 
 // .debug_pubtypes section
-extern const unsigned char *__DEBUG_PUBTYPES_BEGIN__;
-extern const unsigned char *__DEBUG_PUBTYPES_END__;
+extern const unsigned char __DEBUG_PUBTYPES_BEGIN__[];
+extern const unsigned char __DEBUG_PUBTYPES_END__[];
+
+// .debug_line_str section (DWARF 5)
+extern const unsigned char __DEBUG_LINE_STR_BEGIN__[];
+extern const unsigned char __DEBUG_LINE_STR_END__[];
+
+// .debug_str_offsets section (DWARF 5)
+extern const unsigned char __DEBUG_STR_OFFSETS_BEGIN__[];
+extern const unsigned char __DEBUG_STR_OFFSETS_END__[];
+
+// .debug_addr section (DWARF 5)
+extern const unsigned char __DEBUG_ADDR_BEGIN__[];
+extern const unsigned char __DEBUG_ADDR_END__[];
+
+// .debug_names section (DWARF 5)
+extern const unsigned char __DEBUG_NAMES_BEGIN__[];
+extern const unsigned char __DEBUG_NAMES_END__[];
+
+// .debug_ranges section (DWARF 3 and 4)
+extern const unsigned char __DEBUG_RANGES_BEGIN__[];
+extern const unsigned char __DEBUG_RANGES_END__[];
+
+// .debug_rnglists section (DWARF 5)
+extern const unsigned char __DEBUG_RNGLISTS_BEGIN__[];
+extern const unsigned char __DEBUG_RNGLISTS_END__[];
+
+// The first free page after the debug sections
+extern const unsigned char __DEBUG_END__[];
+
+// Debug sections, as bits for dwarf_need()
+#define DWARF_ARANGES	0x01
+#define DWARF_ABBREV	0x02
+#define DWARF_INFO	0x04
+#define DWARF_LINE	0x08
+#define DWARF_STR	0x10
+#define DWARF_PUBNAMES	0x20
+#define DWARF_PUBTYPES	0x40
+#define DWARF_LINE_STR	0x80
+#define DWARF_STR_OFFSETS 0x100
+#define DWARF_ADDR	0x200
+#define DWARF_NAMES	0x400
+#define DWARF_RANGES	0x800
+#define DWARF_RNGLISTS	0x1000
+
+// What reading the attributes of a DIE may take: in DWARF 5, strings
+// and addresses can be indexes into sections of their own, and the
+// address ranges of any DIE can be a list in a section of its own.
+#define DWARF_DIES	(DWARF_INFO | DWARF_ABBREV | DWARF_STR | DWARF_LINE_STR \
+			 | DWARF_STR_OFFSETS | DWARF_ADDR | DWARF_RANGES \
+			 | DWARF_RNGLISTS)
+
+#ifdef CONFIG_DWARF_LAZY
+// kern/dwarf_lazy.c
+void dwarf_lazy_init(void);
+int dwarf_need(int sects);
+void dwarf_lazy_stats(uint32_t *nread, uint32_t *ninflated);
+#else
+// The boot loader has loaded all the debug sections.
+static inline void dwarf_lazy_init(void) { }
+static inline int dwarf_need(int sects) { return 0; }
+#endif
+
+// kern/dwarf_index.c
+struct Dwarf_Stats {
+	uint32_t dws_arena_used;	// bytes of index memory
+	uint32_t dws_naranges;		// address ranges in the CU index
+	uint64_t dws_aranges_build;	// cycles spent building it
+	uint32_t dws_arange_lookups;	// CU lookups
+	uint64_t dws_arange_cycles;	// cycles spent in them
+	uint32_t dws_nabbrevtabs;	// abbreviation tables decoded
+	uint64_t dws_abbrev_build;	// cycles spent decoding them
+	uint32_t dws_nfuncs;		// functions in the function indexes
+	uint64_t dws_funcs_build;	// cycles spent building them
+	uint32_t dws_func_lookups;	// function lookups
+	uint64_t dws_func_cycles;	// cycles spent in them
+	uint32_t dws_nlinetabs;		// line number tables decoded
+	uint32_t dws_linetabs_size;	// bytes they take
+	uint64_t dws_lines_build;	// cycles spent decoding them
+	uint32_t dws_line_lookups;	// line lookups in decoded tables
+	uint64_t dws_line_cycles;	// cycles spent in them
+	uint32_t dws_ninlines;		// pieces in the inline indexes
+	uint64_t dws_inlines_build;	// cycles spent building them
+	uint32_t dws_inline_lookups;	// inline lookups
+	uint64_t dws_inline_cycles;	// cycles spent in them
+	uint32_t dws_eip_hits;		// debuginfo_eip() cache hits
+	uint32_t dws_eip_misses;	// and misses
+	uint32_t dws_nnames;		// names in the name table
+	uint64_t dws_names_build;	// cycles spent building it
+	uint32_t dws_name_lookups;	// name lookups
+	uint64_t dws_name_cycles;	// cycles spent in them
+	uint32_t dws_cu_hits;		// CU cache hits
+	uint32_t dws_cu_misses;		// and misses
+	uint32_t dws_cu_evictions;	// units evicted to make room
+	uint32_t dws_cu_used;		// bytes of the CU cache in use
+};
+extern struct Dwarf_Stats dwarf_stats;
+extern uint32_t dwarf_generation;
+
+// An attribute of an abbreviation: its name and form.  The list ends
+// with a pair of zeros.
+struct Dwarf_Attrspec {
+	uint16_t as_name;
+	uint16_t as_form;
+	int32_t as_const;	// the value, for DW_FORM_implicit_const
+};
+
+// A step of skipping the attributes of a DIE: skip ss_fixed bytes of
+// fixed-size attributes, then one of variable-size form ss_form.
+struct Dwarf_Skipstep {
+	uint16_t ss_fixed;
+	uint16_t ss_form;
+};
+
+struct Dwarf_Abbrev {
+	uint16_t ab_tag;
+	uint8_t ab_children;
+	uint8_t ab_sibling_step;
+	const struct Dwarf_Attrspec *ab_attrs;	// NULL for unused codes
+	// The plan for skipping the attributes without decoding each: the
+	// steps, then ab_fixed bytes.  Most abbreviations have no steps.
+	const struct Dwarf_Skipstep *ab_steps;
+	uint16_t ab_nsteps;
+	uint16_t ab_fixed;
+	// DW_AT_sibling is ab_sibling_off bytes after the first
+	// ab_sibling_step steps.
+	uint16_t ab_sibling_off;	// DWARF_NOSIBLING if there is none
+	uint16_t ab_sibling_form;
+};
+#define DWARF_NOSIBLING	0xffff
+
+// A decoded abbreviation table, indexed by abbreviation code
+struct Dwarf_Abbrevtab {
+	Dwarf_Off at_offset;	// in .debug_abbrev
+	unsigned at_ncodes;
+	struct Dwarf_Abbrev *at_abbrevs;
+	struct Dwarf_Abbrevtab *at_next;
+};
+
+// Codes are numbered from 1 in the order the compiler emits them, so
+// anything larger means a corrupt table.
+#define DWARF_MAXABBREV	4096
+
+// A unit header in .debug_info.
+struct Dwarf_CU {
+	const char *cu_hdr;		// DIE references are relative to it
+	const char *cu_dies;		// first DIE
+	const char *cu_end;
+	Dwarf_Off cu_abbrev_offset;
+	unsigned cu_version;
+	unsigned cu_address_size;
+	// DWARF 5: where the unit's entries in .debug_str_offsets,
+	// .debug_addr and .debug_rnglists start, from the attributes of its
+	// first DIE
+	uint32_t cu_str_offsets_base;
+	uint32_t cu_addr_base;
+	uint32_t cu_rnglists_base;
+	// The DW_AT_low_pc of its first DIE, which the entries of its range
+	// lists are relative to
+	uintptr_t cu_base;
+};
+
+// A range list being read: the address ranges of a DIE with DW_AT_ranges,
+// which it has instead of DW_AT_low_pc and DW_AT_high_pc when its code is
+// in pieces, say when the compiler has moved its cold paths away.
+struct Dwarf_Ranges {
+	const struct Dwarf_Addrs *rg_addrs;
+	const struct Dwarf_CU *rg_cu;
+	const unsigned char *rg_next;	// next entry; NULL after the last
+	const unsigned char *rg_end;	// of the section
+	uintptr_t rg_base;		// what offsets in the entries add to
+};
+
+// kern/dwarf.c
+int dwarf_read_cu_header(const struct Dwarf_Addrs *addrs, const void *hdr, struct Dwarf_CU *cu);
+const char *dwarf_read_string(const struct Dwarf_Addrs *addrs, const struct Dwarf_CU *cu, unsigned form, const void *entry);
+uintptr_t dwarf_read_address(const struct Dwarf_Addrs *addrs, const struct Dwarf_CU *cu, unsigned form, const void *entry);
+uintptr_t dwarf_read_high_pc(const struct Dwarf_Addrs *addrs, const struct Dwarf_CU *cu, const struct Dwarf_Attrspec *as, const void *entry, uintptr_t low_pc);
+const void *dwarf_read_ref(const struct Dwarf_Addrs *addrs, const struct Dwarf_CU *cu, unsigned form, const void *entry);
+const char *dwarf_die_name(const struct Dwarf_Addrs *addrs, const struct Dwarf_CU *cu, const struct Dwarf_Abbrevtab *abbrevs, const void *die);
+void dwarf_read_ranges(const struct Dwarf_Addrs *addrs, const struct Dwarf_CU *cu, unsigned form, const void *entry, struct Dwarf_Ranges *rg);
+bool dwarf_ranges_next(struct Dwarf_Ranges *rg, uintptr_t *low, uintptr_t *high);
+bool dwarf_ranges_find(struct Dwarf_Ranges *rg, uintptr_t p, uintptr_t *low);
+
+// A piece of the code of a function inlined into another, from a
+// DW_TAG_inlined_subroutine DIE.  A function inlined in pieces has one for
+// each.  The files are indexes into the unit's line program's file names.
+struct Dwarf_Inline {
+	uintptr_t in_low;
+	uintptr_t in_high;		// the address after it
+	const char *in_name;		// of the function; NULL if none
+	uint16_t in_depth;		// the inlined functions it is in
+	uint16_t in_decl_file;		// where the function is
+	uint16_t in_call_file;		// and where it was inlined
+	uint16_t in_namelen;
+	uint32_t in_call_line;
+	int32_t in_parent;		// in an index: the piece it is in, or -1
+};
+
+// The most inlined functions dwarf_inlines_walk() finds one inside
+#define DWARF_MAXINLINE	16
+
+int dwarf_inlines_walk(const struct Dwarf_Addrs *addrs, const struct Dwarf_CU *cu, const struct Dwarf_Abbrevtab *abbrevs, void (*fn)(const struct Dwarf_Inline *));
+
+const void *dwarf_skip_die(const struct Dwarf_Addrs *addrs, const struct Dwarf_CU *cu, const struct Dwarf_Abbrevtab *abbrevs, const struct Dwarf_Abbrev *ab, const void *entry, bool subtree);
+const void *dwarf_skip_subtree(const struct Dwarf_Addrs *addrs, const struct Dwarf_CU *cu, const struct Dwarf_Abbrevtab *abbrevs, const struct Dwarf_Abbrev *ab, const void *entry, const void *sibling);
+
+// kern/dwarf_lines.c
+int dwarf_line_files(const struct Dwarf_Addrs *addrs, const struct Dwarf_CU *cu, Dwarf_Off line_offset, void (*fn)(unsigned index, const char *dir, const char *name));
+
+// The DIE walkers jump over subtrees they have no use for.  Clearing
+// this makes them descend into everything, to measure what it saves.
+extern bool dwarf_skip_subtrees;
+
+// Whether the children of a DIE with 'tag' may include functions or
+// labels.  In C, types can't have any.
+static inline bool
+dwarf_tag_has_code(unsigned tag)
+{
+	return tag == DW_TAG_compile_unit || tag == DW_TAG_partial_unit
+		|| tag == DW_TAG_subprogram || tag == DW_TAG_lexical_block
+		|| tag == DW_TAG_inlined_subroutine || tag == DW_TAG_namespace
+		|| tag == DW_TAG_module;
+}
+
+void *dwarf_alloc(size_t n);
+const struct Dwarf_Abbrevtab *dwarf_abbrevs(const struct Dwarf_Addrs *addrs, Dwarf_Off offset);
+int dwarf_name_lookup(const struct Dwarf_Addrs *addrs, const char *name, uintptr_t *addr);
+int dwarf_func_lookup(const struct Dwarf_Addrs *addrs, Dwarf_Off cu_offset, uintptr_t p, const char **name, int *namelen, uintptr_t *addr);
+int dwarf_inline_lookup(const struct Dwarf_Addrs *addrs, Dwarf_Off cu_offset, uintptr_t p, struct Dwarf_Inline *chain, int n);
+int dwarf_inline_file(const struct Dwarf_Addrs *addrs, Dwarf_Off cu_offset, unsigned index, char *buf, size_t len);
+
+// The abbreviation with 'code' in 'at', or NULL if there is none.
+static inline const struct Dwarf_Abbrev *
+dwarf_abbrev(const struct Dwarf_Abbrevtab *at, unsigned code)
+{
+	if (code >= at->at_ncodes || !at->at_abbrevs[code].ab_attrs)
+		return NULL;
+	return &at->at_abbrevs[code];
+}
+
+int dwarf_aranges_lookup(const struct Dwarf_Addrs *addrs, uintptr_t p, Dwarf_Off *store);
+
+// kern/dwarf_cu.c
+struct Dwarf_Func;
+struct Line_Table;
+
+// A compilation unit in the CU cache: its header, the attributes of its
+// DIE, and the indexes over it that lookups build the first time they
+// need them.
+struct Dwarf_Cuinfo {
+	Dwarf_Off ci_offset;		// of the unit in .debug_info
+	struct Dwarf_CU ci_cu;
+	const struct Dwarf_Abbrevtab *ci_abbrevs;
+	const struct Dwarf_Abbrev *ci_abbrev;	// of its DIE; NULL if empty
+	const char *ci_name;		// NULL if it has none
+	Dwarf_Off ci_stmt_list;		// DWARF_NOLINES if it has none
+	uintptr_t ci_low_pc;
+	uintptr_t ci_high_pc;		// inclusive, as info_by_address has it
+	// DW_AT_ranges of its DIE, if it has that instead of the above
+	unsigned ci_ranges_form;	// 0 if it hasn't
+	const void *ci_ranges;
+	// The indexes, in the CU cache's memory.  A unit's are only tried
+	// once, so a unit whose index doesn't fit is walked instead.
+	struct Line_Table *ci_lines;	// see kern/dwarf_lines.c
+	struct Dwarf_Func *ci_funcs;	// see kern/dwarf_index.c
+	int ci_nfuncs;
+	struct Dwarf_Inline *ci_inlines;	// and its file names after it
+	int ci_ninlines;
+	const char **ci_files;		// by index; NULL for none
+	int ci_nfiles;
+	bool ci_lines_tried;
+	bool ci_funcs_tried;
+	bool ci_inlines_tried;
+	struct Dwarf_Cuinfo *ci_hash_next;
+	struct Dwarf_Cuinfo *ci_lru_prev;
+	struct Dwarf_Cuinfo *ci_lru_next;
+};
+#define DWARF_NOLINES	(~(Dwarf_Off) 0)
+
+int dwarf_cu_get(const struct Dwarf_Addrs *addrs, Dwarf_Off offset, struct Dwarf_Cuinfo **store);
+struct Dwarf_Cuinfo *dwarf_cu_by_lines(Dwarf_Off line_offset);
+void *dwarf_cu_alloc(struct Dwarf_Cuinfo *ci, size_t n);
+
+// Take the first 'nsteps' steps of the skip plan of 'ab' from 'entry'.
+static inline const void *
+dwarf_skip_steps(const struct Dwarf_Abbrev *ab, const void *entry,
+		 unsigned nsteps, unsigned address_size)
+{
+	const struct Dwarf_Skipstep *st;
+
+	for (st = ab->ab_steps; st < ab->ab_steps + nsteps; st++) {
+		entry += st->ss_fixed;
+		entry += dwarf_read_abbrev_entry(entry, st->ss_form, NULL, 0,
+						 address_size);
+	}
+	return entry;
+}
+
+// Skip the attributes of a DIE with abbreviation 'ab' at 'entry'.  With
+// only fixed-size attributes, that is one add.
+static inline const void *
+dwarf_skip_attrs(const struct Dwarf_Abbrev *ab, const void *entry,
+		 unsigned address_size)
+{
+	return dwarf_skip_steps(ab, entry, ab->ab_nsteps, address_size)
+		+ ab->ab_fixed;
+}
 
 /**
  *	dwarf_entry_len - return the length of an FDE or CIE
@@ -45,6 +45,16 @@ struct Secthdr {
 	uint32_t sh_entsize;
 };
 
+// An entry of an ELF_SHT_SYMTAB section.
+struct Sym {
+	uint32_t st_name;	// offset in the section's sh_link STRTAB
+	uint32_t st_value;
+	uint32_t st_size;
+	uint8_t st_info;	// binding << 4 | type
+	uint8_t st_other;
+	uint16_t st_shndx;	// section the symbol is defined in
+};
+
 // Values for Proghdr::p_type
 #define ELF_PROG_LOAD		1
 
@@ -52,14 +62,39 @@ struct Secthdr {
 #define ELF_PROG_FLAG_EXEC	1
 #define ELF_PROG_FLAG_WRITE	2
 #define ELF_PROG_FLAG_READ	4
+// JOS-specific: the segment's file contents are one LZ4 block (see
+// lib/lz4.c) that inflates to the first bytes of the segment's memory
+// image; p_filesz is the size of the block.
+#define ELF_PROG_FLAG_LZ4	0x00100000
 
 // Values for Secthdr::sh_type
 #define ELF_SHT_NULL		0
 #define ELF_SHT_PROGBITS	1
 #define ELF_SHT_SYMTAB		2
 #define ELF_SHT_STRTAB		3
+#define ELF_SHT_NOBITS		8
+
+// Flag bits for Secthdr::sh_flags
+#define ELF_SHF_ALLOC		0x2
+#define ELF_SHF_EXECINSTR	0x4
+#define ELF_SHF_COMPRESSED	0x800
+
+// The data of an ELF_SHF_COMPRESSED section starts with this header.
+struct Chdr {
+	uint32_t ch_type;
+	uint32_t ch_size;	// size when inflated
+	uint32_t ch_addralign;
+};
+
+// Values for Chdr::ch_type
+#define ELF_COMPRESS_ZLIB	1
 
 // Values for Secthdr::sh_name
 #define ELF_SHN_UNDEF		0
 
+// Values for the type in Sym::st_info
+#define ELF_STT_NOTYPE		0
+#define ELF_STT_FUNC		2
+#define ELF_ST_TYPE(info)	((info) & 0xf)
+
 #endif /* !JOS_INC_ELF_H */
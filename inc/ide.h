@@ -0,0 +1,12 @@
+#ifndef JOS_INC_IDE_H
+#define JOS_INC_IDE_H
+
+#include <inc/types.h>
+
+#define SECTSIZE	512	// bytes per disk sector
+
+// lib/ide.c
+void	ide_read(uint32_t secno, void *dst, size_t nsecs);
+bool	ide_dma_enabled(void);
+
+#endif /* !JOS_INC_IDE_H */
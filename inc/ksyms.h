@@ -0,0 +1,34 @@
+#ifndef JOS_INC_KSYMS_H
+#define JOS_INC_KSYMS_H
+
+/*
+ * The kernel symbol table: the code symbols of the kernel's ELF symbol
+ * table, sorted by address, made by kern/mkksyms.c at build time and
+ * linked into the kernel's .ksyms section by the second link pass (see
+ * kern/Makefrag).  Unlike the debug sections, it is always loaded.
+ *
+ * After the header come:
+ *
+ *	ks_nsyms uint32_t		the symbols' addresses, ascending
+ *	ks_nmarkers uint32_t		the offset in the names of every
+ *					KSYMS_STRIDE'th symbol's name
+ *	ks_names_size bytes		the names
+ *
+ * Each name is front-coded against the name of the symbol before it: a
+ * byte with the length of the prefix it shares with that name, a byte
+ * with the length of the rest, then the rest.  The name of a symbol at
+ * a marker shares nothing, so decoding can start there.
+ */
+
+#define KSYMS_MAGIC	0x4D59534B	/* "KSYM" in little endian */
+#define KSYMS_STRIDE	16
+#define KSYM_NAME_LEN	128		// longest name, NUL included
+
+struct Ksyms {
+	uint32_t ks_magic;	// must equal KSYMS_MAGIC
+	uint32_t ks_nsyms;
+	uint32_t ks_nmarkers;
+	uint32_t ks_names_size;
+};
+
+#endif	// !JOS_INC_KSYMS_H
@@ -0,0 +1,9 @@
+#ifndef JOS_INC_LZ4_H
+#define JOS_INC_LZ4_H
+
+#include <inc/types.h>
+
+// lib/lz4.c
+int	lz4_decompress(const void *src, size_t srclen, void *dst, size_t dstlen);
+
+#endif /* !JOS_INC_LZ4_H */
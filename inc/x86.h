@@ -16,6 +16,7 @@ static __inline void outw(int port, uint16_t data) __attribute__((always_inline)
 static __inline void outsw(int port, const void *addr, int cnt) __attribute__((always_inline));
 static __inline void outsl(int port, const void *addr, int cnt) __attribute__((always_inline));
 static __inline void outl(int port, uint32_t data) __attribute__((always_inline));
+static __inline void stosb(void *addr, int data, int cnt) __attribute__((always_inline));
 static __inline void invlpg(void *addr) __attribute__((always_inline));
 static __inline void lidt(void *p) __attribute__((always_inline));
 static __inline void lldt(uint16_t sel) __attribute__((always_inline));
@@ -137,6 +138,15 @@ outl(int port, uint32_t data)
 	__asm __volatile("outl %0,%w1" : : "a" (data), "d" (port));
 }
 
+static __inline void
+stosb(void *addr, int data, int cnt)
+{
+	__asm __volatile("cld\n\trepne\n\tstosb"			:
+			 "=D" (addr), "=c" (cnt)		:
+			 "0" (addr), "1" (cnt), "a" (data)	:
+			 "memory", "cc");
+}
+
 static __inline void
 invlpg(void *addr)
 {
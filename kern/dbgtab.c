@@ -0,0 +1,243 @@
+// Looking up instruction addresses in the debug table that kern/mkdbgtab.c
+// builds from the kernel's DWARF (see inc/dbgtab.h).  With the table,
+// debuginfo_eip() needs none of the debug sections: it is a few binary
+// searches over arrays linked into the kernel.
+
+#include <inc/assert.h>
+#include <inc/string.h>
+#include <inc/error.h>
+#include <inc/dwarf.h>
+#include <inc/dbgtab.h>
+
+#include <kern/kdebug.h>
+
+// Set by kern/kernel.ld; equal if the kernel was linked without a table.
+extern const char __DBGTAB_BEGIN__[], __DBGTAB_END__[];
+
+static const struct Dbgtab *dbgtab;
+static const struct Dbgtab_range *units, *funcs;
+static const struct Dbgtab_inline *inlines;
+static const struct Dbgtab_anchor *anchors;
+static const char *rows, *strings;
+static bool dbgtab_checked;
+
+// Whether the kernel has a debug table.
+bool
+dbgtab_present(void)
+{
+	const struct Dbgtab *dt = (const struct Dbgtab *) __DBGTAB_BEGIN__;
+	uint32_t nanchors;
+
+	if (dbgtab_checked)
+		return dbgtab != NULL;
+	dbgtab_checked = 1;
+	if (__DBGTAB_END__ - __DBGTAB_BEGIN__ < sizeof(*dt)
+	    || dt->dt_magic != DBGTAB_MAGIC)
+		return 0;
+
+	nanchors = ROUNDUP(dt->dt_nrows, DBGTAB_STRIDE) / DBGTAB_STRIDE;
+	units = (const struct Dbgtab_range *) (dt + 1);
+	funcs = units + dt->dt_nunits;
+	inlines = (const struct Dbgtab_inline *) (funcs + dt->dt_nfuncs);
+	anchors = (const struct Dbgtab_anchor *) (inlines + dt->dt_ninlines);
+	rows = (const char *) (anchors + nanchors);
+	strings = rows + dt->dt_rows_size;
+	if (strings + dt->dt_strings_size > __DBGTAB_END__)
+		return 0;
+	dbgtab = dt;
+	return 1;
+}
+
+// A string of the table and its length, which is in the two bytes
+// before it.
+static const char *
+table_string(uint32_t offset, int *len)
+{
+	*len = get_unaligned(strings + offset - 2, uint16_t);
+	return strings + offset;
+}
+
+// The index of the last of the ranges r[lo..n) that starts at or below
+// 'p', or lo - 1 if none does.
+static int
+range_index(const struct Dbgtab_range *r, int lo, int n, uintptr_t p)
+{
+	int hi = n, mid;
+
+	while (lo < hi) {
+		mid = (lo + hi) / 2;
+		if (r[mid].dr_start <= p)
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
+	return lo - 1;
+}
+
+// The index of the last of the anchors from 'lo' on at or below 'p', or
+// lo - 1 if there is none.
+static int
+anchor_index(int lo, uintptr_t p)
+{
+	int hi, mid;
+
+	hi = ROUNDUP(dbgtab->dt_nrows, DBGTAB_STRIDE) / DBGTAB_STRIDE;
+	while (lo < hi) {
+		mid = (lo + hi) / 2;
+		if (anchors[mid].da_addr <= p)
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
+	return lo - 1;
+}
+
+// The line of the last row at or below 'p', which follows anchor 'a'.
+// Stores the row's address to *row_addr.
+static int
+line_decode(int a, uintptr_t p, uintptr_t *row_addr)
+{
+	const struct Dbgtab_anchor *da = &anchors[a];
+	const char *deltas = rows + da->da_rows;
+	unsigned address_incr;
+	int line_incr, line = da->da_line, row, end;
+	uintptr_t address = da->da_addr;
+
+	row = a * DBGTAB_STRIDE + 1;
+	end = MIN(row - 1 + DBGTAB_STRIDE, (int) dbgtab->dt_nrows);
+	for (; row < end; row++) {
+		deltas += dwarf_read_uleb128(deltas, &address_incr);
+		deltas += dwarf_read_leb128(deltas, &line_incr);
+		if (address + address_incr > p)
+			break;
+		address += address_incr;
+		line += line_incr;
+	}
+	*row_addr = address;
+	return line;
+}
+
+// Where a lookup left off: the unit, function and anchor it found, and
+// the unit of its line row.  A lookup of a higher address only needs to
+// search from there on.
+struct Dbgtab_pos {
+	int dp_unit, dp_func, dp_anchor, dp_row_unit;
+};
+
+static int
+debuginfo_from(uintptr_t addr, struct Eipdebuginfo *info,
+	       struct Dbgtab_pos *pos)
+{
+	uintptr_t row_addr;
+	int i;
+
+	i = range_index(units, pos->dp_unit, dbgtab->dt_nunits, addr);
+	pos->dp_unit = MAX(i, 0);
+	if (i < 0 || addr > units[i].dr_end)
+		return -E_BAD_DWARF;
+	info->eip_file = strings + units[i].dr_name;
+
+	// The line of the `call` instruction, which is 5 bytes long.  The
+	// DWARF lookup only has the rows of the unit of 'addr'.
+	i = anchor_index(pos->dp_anchor, addr - 5);
+	pos->dp_anchor = MAX(i, 0);
+	if (i >= 0) {
+		info->eip_line = line_decode(i, addr - 5, &row_addr);
+		i = range_index(units, pos->dp_row_unit, dbgtab->dt_nunits,
+				row_addr);
+		pos->dp_row_unit = MAX(i, 0);
+		if (i < 0 || row_addr > units[i].dr_end
+		    || units[i].dr_name != units[pos->dp_unit].dr_name)
+			info->eip_line = 0;
+	}
+
+	// Like function_by_info, finding no function is no error.
+	i = range_index(funcs, pos->dp_func, dbgtab->dt_nfuncs, addr);
+	pos->dp_func = MAX(i, 0);
+	if (i < 0 || addr > funcs[i].dr_end)
+		return 0;
+	info->eip_fn_name = table_string(funcs[i].dr_name,
+					 &info->eip_fn_namelen);
+	info->eip_fn_addr = funcs[i].dr_start;
+	return 0;
+}
+
+// Fill in 'info' for 'addr' from the debug table, as debuginfo_eip()
+// would from the DWARF sections; 'info' must have been initialized.
+// Returns -E_BAD_DWARF if the table has no unit at 'addr'.  Only call
+// this if dbgtab_present().
+int
+dbgtab_debuginfo(uintptr_t addr, struct Eipdebuginfo *info)
+{
+	struct Dbgtab_pos pos = { 0, 0, 0, 0 };
+
+	return debuginfo_from(addr, info, &pos);
+}
+
+// Like dbgtab_debuginfo() for eips[order[0]], eips[order[1]], ...,
+// eips[order[n - 1]], which must be in increasing order: the results go
+// to out[order[i]], and the return values to codes[i].  Each search
+// starts where the one before left off, so the batch is one pass forward
+// over the table.
+void
+dbgtab_debuginfo_batch(const uintptr_t *eips, const int *order, int n,
+		       struct Eipdebuginfo *out, int *codes)
+{
+	struct Dbgtab_pos pos = { 0, 0, 0, 0 };
+	int i;
+
+	for (i = 0; i < n; i++)
+		codes[i] = debuginfo_from(eips[order[i]],
+						 &out[order[i]], &pos);
+}
+
+// Expand the function in 'info' into the frames of the functions inlined
+// at 'addr' from the debug table, as debuginfo_eip_inline() does from the
+// DWARF sections.  Only call this if dbgtab_present().
+int
+dbgtab_debuginfo_inline(uintptr_t addr, const struct Eipdebuginfo *info,
+			struct Eipinline *frames, int nframes)
+{
+	const struct Dbgtab_inline *in, *prev = NULL;
+	uintptr_t p = addr - 5;
+	int lo = 0, hi = dbgtab->dt_ninlines, mid, i, n = 0;
+
+	if (nframes <= 0)
+		return 0;
+	// Find the last piece that starts at or below p; the innermost piece
+	// containing p is on its chain.
+	while (lo < hi) {
+		mid = (lo + hi) / 2;
+		if (inlines[mid].di_start <= p)
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
+	for (i = lo - 1; i >= 0 && p >= inlines[i].di_end;
+	     i = inlines[i].di_parent)
+		/* do nothing */;
+
+	for (; i >= 0 && n < nframes - 1; i = in->di_parent, n++) {
+		in = &inlines[i];
+		frames[n].ei_fn_name = table_string(in->di_name,
+						    &frames[n].ei_fn_namelen);
+		if (!prev) {
+			frames[n].ei_file = strings + in->di_decl_file;
+			frames[n].ei_line = info->eip_line;
+		} else {
+			frames[n].ei_file = strings + prev->di_call_file;
+			frames[n].ei_line = prev->di_call_line;
+		}
+		prev = in;
+	}
+	frames[n].ei_fn_name = info->eip_fn_name;
+	frames[n].ei_fn_namelen = info->eip_fn_namelen;
+	if (prev) {
+		frames[n].ei_file = strings + prev->di_call_file;
+		frames[n].ei_line = prev->di_call_line;
+	} else {
+		frames[n].ei_file = info->eip_file;
+		frames[n].ei_line = info->eip_line;
+	}
+	return n + 1;
+}
@@ -10,58 +10,9 @@ struct Slice {
         int len;
 };
 
-static int info_by_address_debug_aranges(const struct Dwarf_Addrs *addrs,
-                                         uintptr_t p, Dwarf_Off *store) {
-        const void *set = addrs->aranges_begin;
-        while ((unsigned char *)set < addrs->aranges_end) {
-                int count = 0;
-                unsigned long len;
-                const void *header = set;
-                count = dwarf_entry_len(set, &len);
-                if (count == 0) {
-                        return -E_BAD_DWARF;
-                } else {
-                        set += count;
-                }
-                const void *set_end = set + len;
-
-                // Parse compilation unit header.
-                Dwarf_Half version = get_unaligned(set, Dwarf_Half);
-                set += sizeof(Dwarf_Half);
-                assert(version == 2);
-                Dwarf_Off offset = get_unaligned(set, uint32_t);
-                set += count;
-                Dwarf_Small address_size = get_unaligned(set++, Dwarf_Small);
-                assert(address_size == 4);
-                Dwarf_Small segment_size = get_unaligned(set++, Dwarf_Small);
-                assert(segment_size == 0);
-
-                void *addr = NULL;
-                uint32_t entry_size = 2 * address_size + segment_size;
-                uint32_t remainder = (set - header) % entry_size;
-                if (remainder) {
-                        set += 2 * address_size - remainder;
-                }
-                Dwarf_Off size = 0;
-                do {
-                        addr = (void *)get_unaligned(set, uint32_t);
-                        set += address_size;
-                        size = get_unaligned(set, uint32_t);
-                        set += address_size;
-                        if ((uintptr_t)addr <= p &&
-                            p <= (uintptr_t)addr + size) {
-                                *store = offset;
-                                return 0;
-                        }
-                } while (set < set_end);
-                assert(set == set_end);
-        }
-        return -E_BAD_DWARF;
-}
-
 // Read value from .debug_abbrev table in buf. Returns number of bytes read.
-static int dwarf_read_abbrev_entry(const void *entry, unsigned form, void *buf,
-                                   int bufsize, unsigned address_size) {
+int dwarf_read_abbrev_entry(const void *entry, unsigned form, void *buf,
+                            int bufsize, unsigned address_size) {
         int bytes = 0;
         switch (form) {
         case DW_FORM_addr:
@@ -170,7 +121,9 @@ static int dwarf_read_abbrev_entry(const void *entry, unsigned form, void *buf,
                 }
                 bytes = count;
         } break;
-        case DW_FORM_strp: {
+        case DW_FORM_strp:
+        case DW_FORM_line_strp:
+        case DW_FORM_strp_sup: {
                 unsigned long length = 0;
                 int count = dwarf_entry_len(entry, &length);
                 entry += count;
@@ -179,7 +132,11 @@ static int dwarf_read_abbrev_entry(const void *entry, unsigned form, void *buf,
                 }
                 bytes = count;
         } break;
-        case DW_FORM_udata: {
+        case DW_FORM_udata:
+        case DW_FORM_strx:
+        case DW_FORM_addrx:
+        case DW_FORM_loclistx:
+        case DW_FORM_rnglistx: {
                 unsigned int data = 0;
                 int count = dwarf_read_uleb128(entry, &data);
                 entry += count;
@@ -213,7 +170,8 @@ static int dwarf_read_abbrev_entry(const void *entry, unsigned form, void *buf,
                 }
                 bytes = sizeof(Dwarf_Half);
         } break;
-        case DW_FORM_ref4: {
+        case DW_FORM_ref4:
+        case DW_FORM_ref_sup4: {
                 uint32_t data = get_unaligned(entry, uint32_t);
                 entry += sizeof(uint32_t);
                 if (buf && bufsize >= sizeof(uint32_t)) {
@@ -221,7 +179,8 @@ static int dwarf_read_abbrev_entry(const void *entry, unsigned form, void *buf,
                 }
                 bytes = sizeof(uint32_t);
         } break;
-        case DW_FORM_ref8: {
+        case DW_FORM_ref8:
+        case DW_FORM_ref_sup8: {
                 uint64_t data = get_unaligned(entry, uint64_t);
                 entry += sizeof(uint64_t);
                 if (buf && bufsize >= sizeof(uint64_t)) {
@@ -279,92 +238,710 @@ static int dwarf_read_abbrev_entry(const void *entry, unsigned form, void *buf,
                 }
                 bytes = sizeof(uint64_t);
         } break;
+        case DW_FORM_data16:
+                if (buf) {
+                        memcpy(buf, entry, MIN(16, bufsize));
+                }
+                bytes = 16;
+                break;
+        case DW_FORM_implicit_const:
+                // The value is in the abbreviation, see dwarf_read_high_pc.
+                bytes = 0;
+                break;
+        case DW_FORM_strx1:
+        case DW_FORM_strx2:
+        case DW_FORM_strx3:
+        case DW_FORM_strx4:
+        case DW_FORM_addrx1:
+        case DW_FORM_addrx2:
+        case DW_FORM_addrx3:
+        case DW_FORM_addrx4: {
+                // Indexes of 1 to 4 bytes
+                bytes = (form - DW_FORM_strx1) % 4 + 1;
+                uint32_t data = 0;
+                memcpy(&data, entry, bytes);
+                if (buf && bufsize >= sizeof(uint32_t)) {
+                        put_unaligned(data, (uint32_t *)buf);
+                }
+        } break;
         }
         return bytes;
 }
 
-// Find a compilation unit, which contains given address from .debug_info
-// section.
-static int info_by_address_debug_info(const struct Dwarf_Addrs *addrs,
-                                      uintptr_t p, Dwarf_Off *store) {
-        const void *entry = addrs->info_begin;
-        while ((unsigned char *)entry < addrs->info_end) {
-                int count = 0;
-                unsigned long len;
-                const void *header = entry;
-                count = dwarf_entry_len(entry, &len);
-                if (count == 0) {
+// Parse the unit header at `hdr` in .debug_info to `cu`. Returns
+// -E_BAD_DWARF for a header we don't understand.
+int dwarf_read_cu_header(const struct Dwarf_Addrs *addrs, const void *hdr,
+                         struct Dwarf_CU *cu) {
+        const void *entry = hdr;
+        cu->cu_hdr = hdr;
+        unsigned long len = 0;
+        int count = dwarf_entry_len(entry, &len);
+        if (count == 0) {
+                return -E_BAD_DWARF;
+        }
+        entry += count;
+        cu->cu_end = entry + len;
+        if ((const unsigned char *)cu->cu_end > addrs->info_end) {
+                return -E_BAD_DWARF;
+        }
+        cu->cu_version = get_unaligned(entry, Dwarf_Half);
+        entry += sizeof(Dwarf_Half);
+        cu->cu_str_offsets_base = 0;
+        cu->cu_addr_base = 0;
+        cu->cu_rnglists_base = 0;
+        cu->cu_base = 0;
+
+        if (cu->cu_version == 2 || cu->cu_version == 4) {
+                cu->cu_abbrev_offset = get_unaligned(entry, uint32_t);
+                entry += count;
+                cu->cu_address_size = get_unaligned(entry++, Dwarf_Small);
+        } else if (cu->cu_version == 5) {
+                // DWARF 5 moved the address size ahead of the abbreviation
+                // offset, after the new unit type.
+                Dwarf_Small unit_type = get_unaligned(entry++, Dwarf_Small);
+                cu->cu_address_size = get_unaligned(entry++, Dwarf_Small);
+                cu->cu_abbrev_offset = get_unaligned(entry, uint32_t);
+                entry += count;
+                switch (unit_type) {
+                case DW_UT_compile:
+                case DW_UT_partial:
+                        break;
+                case DW_UT_skeleton:
+                case DW_UT_split_compile:
+                        // dwo_id
+                        entry += sizeof(uint64_t);
+                        break;
+                case DW_UT_type:
+                case DW_UT_split_type:
+                        // type_signature and type_offset
+                        entry += sizeof(uint64_t) + count;
+                        break;
+                default:
                         return -E_BAD_DWARF;
+                }
+        } else {
+                return -E_BAD_DWARF;
+        }
+        if (cu->cu_address_size != sizeof(uint32_t)) {
+                return -E_BAD_DWARF;
+        }
+        cu->cu_dies = entry;
+
+        // The unit's first DIE says where its string offsets, addresses and
+        // range lists start, and the base address of its range lists.
+        unsigned abbrev_code = 0;
+        entry += dwarf_read_uleb128(entry, &abbrev_code);
+        if (abbrev_code == 0) {
+                return 0;
+        }
+        const struct Dwarf_Abbrevtab *abbrevs =
+            dwarf_abbrevs(addrs, cu->cu_abbrev_offset);
+        const struct Dwarf_Abbrev *abbrev =
+            abbrevs ? dwarf_abbrev(abbrevs, abbrev_code) : NULL;
+        if (!abbrev) {
+                return -E_BAD_DWARF;
+        }
+        const struct Dwarf_Attrspec *attr;
+        const void *low_pc_entry = NULL;
+        unsigned low_pc_form = 0;
+        for (attr = abbrev->ab_attrs; attr->as_name || attr->as_form; attr++) {
+                if (attr->as_name == DW_AT_str_offsets_base) {
+                        dwarf_read_abbrev_entry(
+                            entry, attr->as_form, &cu->cu_str_offsets_base,
+                            sizeof(uint32_t), cu->cu_address_size);
+                } else if (attr->as_name == DW_AT_addr_base) {
+                        dwarf_read_abbrev_entry(entry, attr->as_form,
+                                                &cu->cu_addr_base,
+                                                sizeof(uint32_t),
+                                                cu->cu_address_size);
+                } else if (attr->as_name == DW_AT_rnglists_base) {
+                        dwarf_read_abbrev_entry(entry, attr->as_form,
+                                                &cu->cu_rnglists_base,
+                                                sizeof(uint32_t),
+                                                cu->cu_address_size);
+                } else if (attr->as_name == DW_AT_low_pc) {
+                        low_pc_entry = entry;
+                        low_pc_form = attr->as_form;
+                }
+                entry += dwarf_read_abbrev_entry(entry, attr->as_form, NULL, 0,
+                                                 cu->cu_address_size);
+        }
+        // The address may be an index into .debug_addr, and DW_AT_addr_base
+        // may come after it.
+        if (low_pc_entry) {
+                cu->cu_base = dwarf_read_address(addrs, cu, low_pc_form,
+                                                 low_pc_entry);
+        }
+        return 0;
+}
+
+// Read a string attribute of form `form` at `entry`. Returns NULL if the
+// form is not a string, or the string is not there.
+const char *dwarf_read_string(const struct Dwarf_Addrs *addrs,
+                              const struct Dwarf_CU *cu, unsigned form,
+                              const void *entry) {
+        uint32_t offset = 0;
+        switch (form) {
+        case DW_FORM_string:
+                return entry;
+        case DW_FORM_strp:
+                offset = get_unaligned(entry, uint32_t);
+                break;
+        case DW_FORM_line_strp:
+                offset = get_unaligned(entry, uint32_t);
+                if (offset >= addrs->line_str_end - addrs->line_str_begin) {
+                        return NULL;
+                }
+                return (const char *)addrs->line_str_begin + offset;
+        case DW_FORM_strx:
+        case DW_FORM_strx1:
+        case DW_FORM_strx2:
+        case DW_FORM_strx3:
+        case DW_FORM_strx4: {
+                // An index into the unit's entries in .debug_str_offsets
+                uint32_t index = 0;
+                dwarf_read_abbrev_entry(entry, form, &index, sizeof(index),
+                                        cu->cu_address_size);
+                const unsigned char *p = addrs->str_offsets_begin +
+                                         cu->cu_str_offsets_base +
+                                         index * sizeof(uint32_t);
+                if (p + sizeof(uint32_t) > addrs->str_offsets_end) {
+                        return NULL;
+                }
+                offset = get_unaligned(p, uint32_t);
+        } break;
+        default:
+                return NULL;
+        }
+        if (offset >= addrs->str_end - addrs->str_begin) {
+                return NULL;
+        }
+        return (const char *)addrs->str_begin + offset;
+}
+
+// Read an address attribute of form `form` at `entry`: either the address
+// itself, or an index into the unit's entries in .debug_addr.
+uintptr_t dwarf_read_address(const struct Dwarf_Addrs *addrs,
+                             const struct Dwarf_CU *cu, unsigned form,
+                             const void *entry) {
+        uint32_t value = 0;
+        dwarf_read_abbrev_entry(entry, form, &value, sizeof(value),
+                                cu->cu_address_size);
+        if (form == DW_FORM_addr) {
+                return value;
+        }
+        const unsigned char *p =
+            addrs->addr_begin + cu->cu_addr_base + value * cu->cu_address_size;
+        if (p + sizeof(uint32_t) > addrs->addr_end) {
+                return 0;
+        }
+        return get_unaligned(p, uint32_t);
+}
+
+// Read DW_AT_high_pc, which is an address, or since DWARF 4 an offset from
+// `low_pc`.
+uintptr_t dwarf_read_high_pc(const struct Dwarf_Addrs *addrs,
+                             const struct Dwarf_CU *cu,
+                             const struct Dwarf_Attrspec *as,
+                             const void *entry, uintptr_t low_pc) {
+        uint32_t value = 0;
+        switch (as->as_form) {
+        case DW_FORM_addr:
+        case DW_FORM_addrx:
+        case DW_FORM_addrx1:
+        case DW_FORM_addrx2:
+        case DW_FORM_addrx3:
+        case DW_FORM_addrx4:
+                return dwarf_read_address(addrs, cu, as->as_form, entry);
+        case DW_FORM_implicit_const:
+                return low_pc + as->as_const;
+        default:
+                dwarf_read_abbrev_entry(entry, as->as_form, &value,
+                                        sizeof(value), cu->cu_address_size);
+                return low_pc + value;
+        }
+}
+
+// Read a reference to another DIE of form `form` at `entry`. Returns NULL
+// if it points outside the unit, for the forms relative to it.
+const void *dwarf_read_ref(const struct Dwarf_Addrs *addrs,
+                           const struct Dwarf_CU *cu, unsigned form,
+                           const void *entry) {
+        uint32_t offset = 0;
+        dwarf_read_abbrev_entry(entry, form, &offset, sizeof(offset),
+                                cu->cu_address_size);
+        if (form == DW_FORM_ref_addr) {
+                if (offset >= addrs->info_end - addrs->info_begin) {
+                        return NULL;
+                }
+                return addrs->info_begin + offset;
+        }
+        if (offset >= cu->cu_end - cu->cu_hdr) {
+                return NULL;
+        }
+        return cu->cu_hdr + offset;
+}
+
+// Start reading the range list that the DW_AT_ranges attribute of form
+// `form` at `entry` refers to, into `rg`. Before DWARF 5 the attribute is
+// an offset in .debug_ranges; since, an offset in .debug_rnglists or an
+// index into the unit's offsets there.
+void dwarf_read_ranges(const struct Dwarf_Addrs *addrs,
+                       const struct Dwarf_CU *cu, unsigned form,
+                       const void *entry, struct Dwarf_Ranges *rg) {
+        uint32_t value = 0;
+        dwarf_read_abbrev_entry(entry, form, &value, sizeof(value),
+                                cu->cu_address_size);
+        const unsigned char *begin = addrs->ranges_begin;
+        const unsigned char *end = addrs->ranges_end;
+        if (cu->cu_version >= 5) {
+                begin = addrs->rnglists_begin;
+                end = addrs->rnglists_end;
+        }
+        rg->rg_addrs = addrs;
+        rg->rg_cu = cu;
+        rg->rg_end = end;
+        rg->rg_base = cu->cu_base;
+        rg->rg_next = NULL;
+        if (form == DW_FORM_rnglistx) {
+                // The offsets are relative to the unit's DW_AT_rnglists_base.
+                const unsigned char *p =
+                    begin + cu->cu_rnglists_base + value * sizeof(uint32_t);
+                if (p + sizeof(uint32_t) > end) {
+                        return;
+                }
+                value = cu->cu_rnglists_base + get_unaligned(p, uint32_t);
+        }
+        if (value < end - begin) {
+                rg->rg_next = begin + value;
+        }
+}
+
+// The address at `index` in the unit's entries in .debug_addr
+static uintptr_t ranges_addrx(const struct Dwarf_Ranges *rg, uint32_t index) {
+        const unsigned char *p = rg->rg_addrs->addr_begin +
+                                 rg->rg_cu->cu_addr_base +
+                                 index * rg->rg_cu->cu_address_size;
+        if (p + sizeof(uint32_t) > rg->rg_addrs->addr_end) {
+                return 0;
+        }
+        return get_unaligned(p, uint32_t);
+}
+
+// Read the next range of `rg` to `*low` and `*high`, which is the first
+// address after it. Returns 0 after the last one. Empty ranges, which
+// cover no code, are left out.
+bool dwarf_ranges_next(struct Dwarf_Ranges *rg, uintptr_t *low,
+                       uintptr_t *high) {
+        const unsigned char *p = rg->rg_next;
+        uintptr_t start = 0, finish = 0;
+        uint32_t a = 0, b = 0;
+        while (p) {
+                if (rg->rg_cu->cu_version < 5) {
+                        // Pairs of offsets from the base address; a pair
+                        // starting with the largest address sets the base,
+                        // and a pair of zeros ends the list.
+                        if (p + 2 * sizeof(uint32_t) > rg->rg_end) {
+                                break;
+                        }
+                        a = get_unaligned(p, uint32_t);
+                        b = get_unaligned(p + sizeof(uint32_t), uint32_t);
+                        p += 2 * sizeof(uint32_t);
+                        if (a == 0 && b == 0) {
+                                break;
+                        }
+                        if (a == ~(uint32_t)0) {
+                                rg->rg_base = b;
+                                continue;
+                        }
+                        start = rg->rg_base + a;
+                        finish = rg->rg_base + b;
                 } else {
-                        entry += count;
+                        if (p >= rg->rg_end) {
+                                break;
+                        }
+                        Dwarf_Small kind = *p++;
+                        if (kind == DW_RLE_base_addressx) {
+                                p += dwarf_read_uleb128((const char *)p, &a);
+                                rg->rg_base = ranges_addrx(rg, a);
+                                continue;
+                        } else if (kind == DW_RLE_base_address) {
+                                rg->rg_base = get_unaligned(p, uint32_t);
+                                p += sizeof(uint32_t);
+                                continue;
+                        } else if (kind == DW_RLE_startx_endx ||
+                                   kind == DW_RLE_startx_length ||
+                                   kind == DW_RLE_offset_pair) {
+                                p += dwarf_read_uleb128((const char *)p, &a);
+                                p += dwarf_read_uleb128((const char *)p, &b);
+                                if (kind == DW_RLE_offset_pair) {
+                                        start = rg->rg_base + a;
+                                        finish = rg->rg_base + b;
+                                } else {
+                                        start = ranges_addrx(rg, a);
+                                        finish = kind == DW_RLE_startx_endx
+                                                     ? ranges_addrx(rg, b)
+                                                     : start + b;
+                                }
+                        } else if (kind == DW_RLE_start_end ||
+                                   kind == DW_RLE_start_length) {
+                                start = get_unaligned(p, uint32_t);
+                                p += sizeof(uint32_t);
+                                if (kind == DW_RLE_start_end) {
+                                        finish = get_unaligned(p, uint32_t);
+                                        p += sizeof(uint32_t);
+                                } else {
+                                        p += dwarf_read_uleb128(
+                                            (const char *)p, &b);
+                                        finish = start + b;
+                                }
+                        } else {
+                                // DW_RLE_end_of_list, or a kind we don't
+                                // know the size of
+                                break;
+                        }
                 }
-                const void *entry_end = entry + len;
+                if (start < finish) {
+                        rg->rg_next = p;
+                        *low = start;
+                        *high = finish;
+                        return 1;
+                }
+        }
+        rg->rg_next = NULL;
+        return 0;
+}
 
-                // Parse compilation unit header.
-                Dwarf_Half version = get_unaligned(entry, Dwarf_Half);
-                entry += sizeof(Dwarf_Half);
-                assert(version == 4 || version == 2);
-                Dwarf_Off abbrev_offset = get_unaligned(entry, uint32_t);
-                entry += count;
-                Dwarf_Small address_size = get_unaligned(entry++, Dwarf_Small);
-                assert(address_size == 4);
+// Whether `p` is in a range of `rg`, counting the address after it, as the
+// lookups by DW_AT_low_pc and DW_AT_high_pc do. Stores the start of the
+// range to `*low`.
+bool dwarf_ranges_find(struct Dwarf_Ranges *rg, uintptr_t p, uintptr_t *low) {
+        uintptr_t start = 0, finish = 0;
+        while (dwarf_ranges_next(rg, &start, &finish)) {
+                if (p >= start && p <= finish) {
+                        *low = start;
+                        return 1;
+                }
+        }
+        return 0;
+}
 
-                // Read abbreviation code
-                unsigned abbrev_code = 0;
-                count = dwarf_read_uleb128(entry, &abbrev_code);
-                assert(abbrev_code != 0);
-                entry += count;
+// Read the name and DW_AT_decl_file of the DIE at `die` in `cu`, whose
+// abbreviation table is `abbrevs`, to `*name` and `*file`, if it has them.
+// What a DIE doesn't have, such as the out-of-line copy or the inlined
+// copy of an inline function, comes from the DIE its DW_AT_abstract_origin
+// or DW_AT_specification refers to in the unit.
+static void die_origin(const struct Dwarf_Addrs *addrs,
+                       const struct Dwarf_CU *cu,
+                       const struct Dwarf_Abbrevtab *abbrevs, const void *die,
+                       const char **name, unsigned *file) {
+        int depth;
+        for (depth = 0; depth < 4 && !(*name && *file); depth++) {
+                // Another unit's DIE would take its abbreviations.
+                if (die < (const void *)cu->cu_dies ||
+                    die >= (const void *)cu->cu_end) {
+                        return;
+                }
+                unsigned code = 0;
+                die += dwarf_read_uleb128(die, &code);
+                const struct Dwarf_Abbrev *ab = dwarf_abbrev(abbrevs, code);
+                if (!ab) {
+                        return;
+                }
+                const struct Dwarf_Attrspec *attr;
+                const void *origin = NULL;
+                for (attr = ab->ab_attrs; attr->as_name || attr->as_form;
+                     attr++) {
+                        if (attr->as_name == DW_AT_name && !*name) {
+                                *name = dwarf_read_string(addrs, cu,
+                                                          attr->as_form, die);
+                        } else if (attr->as_name == DW_AT_decl_file &&
+                                   !*file) {
+                                dwarf_read_abbrev_entry(die, attr->as_form,
+                                                        file, sizeof(*file),
+                                                        cu->cu_address_size);
+                                if (attr->as_form == DW_FORM_implicit_const) {
+                                        *file = attr->as_const;
+                                }
+                        } else if ((attr->as_name == DW_AT_abstract_origin ||
+                                    attr->as_name == DW_AT_specification) &&
+                                   attr->as_form != DW_FORM_ref_sig8) {
+                                origin = dwarf_read_ref(addrs, cu,
+                                                        attr->as_form, die);
+                        }
+                        die += dwarf_read_abbrev_entry(die, attr->as_form,
+                                                       NULL, 0,
+                                                       cu->cu_address_size);
+                }
+                if (!origin) {
+                        return;
+                }
+                die = origin;
+        }
+}
 
-                // Read abbreviations table
-                const void *abbrev_entry = addrs->abbrev_begin + abbrev_offset;
-                unsigned table_abbrev_code = 0;
-                count = dwarf_read_uleb128(abbrev_entry, &table_abbrev_code);
-                abbrev_entry += count;
-                assert(table_abbrev_code == abbrev_code);
-                unsigned tag = 0;
-                count = dwarf_read_uleb128(abbrev_entry, &tag);
-                abbrev_entry += count;
-                assert(tag == DW_TAG_compile_unit);
-                abbrev_entry++;
-                unsigned name = 0, form = 0;
-                uint32_t low_pc = 0, high_pc = 0;
-                do {
-                        count = dwarf_read_uleb128(abbrev_entry, &name);
-                        abbrev_entry += count;
-                        count = dwarf_read_uleb128(abbrev_entry, &form);
-                        abbrev_entry += count;
-                        if (name == DW_AT_low_pc) {
-                                count = dwarf_read_abbrev_entry(
-                                    entry, form, &low_pc, sizeof(low_pc),
-                                    address_size);
+// The name of the DIE at `die` in `cu`, whose abbreviation table is
+// `abbrevs`, or if it has none of its own, that of its abstract origin or
+// specification. Returns NULL if neither has a name.
+const char *dwarf_die_name(const struct Dwarf_Addrs *addrs,
+                           const struct Dwarf_CU *cu,
+                           const struct Dwarf_Abbrevtab *abbrevs,
+                           const void *die) {
+        const char *name = NULL;
+        unsigned file = 0;
+        die_origin(addrs, cu, abbrevs, die, &name, &file);
+        return name;
+}
+
+// Call `fn` for each piece of each function inlined into the code of the
+// unit `cu`, whose abbreviation table is `abbrevs`, with the number of
+// inlined functions the piece is in, the function's name and file from
+// its abstract origin, and where it was inlined from DW_AT_call_file and
+// DW_AT_call_line. Functions inlined deeper than DWARF_MAXINLINE are left
+// out.
+int dwarf_inlines_walk(const struct Dwarf_Addrs *addrs,
+                       const struct Dwarf_CU *cu,
+                       const struct Dwarf_Abbrevtab *abbrevs,
+                       void (*fn)(const struct Dwarf_Inline *)) {
+        // The tree levels the inlined functions the walk is in start at
+        int open[DWARF_MAXINLINE];
+        int level = 0, nopen = 0;
+        const void *entry = cu->cu_dies;
+        while (entry < (const void *)cu->cu_end) {
+                unsigned code = 0;
+                entry += dwarf_read_uleb128(entry, &code);
+                if (code == 0) {
+                        // The end of the children of the DIE at `level`
+                        if (--level < 0) {
+                                break;
+                        }
+                        while (nopen > 0 && open[nopen - 1] >= level) {
+                                nopen--;
+                        }
+                        continue;
+                }
+                const struct Dwarf_Abbrev *ab = dwarf_abbrev(abbrevs, code);
+                if (!ab) {
+                        return -E_BAD_DWARF;
+                }
+                if (ab->ab_tag != DW_TAG_inlined_subroutine) {
+                        // Types have no code inside.
+                        bool subtree = !dwarf_tag_has_code(ab->ab_tag);
+                        entry = dwarf_skip_die(addrs, cu, abbrevs, ab, entry,
+                                               subtree);
+                        if (ab->ab_children &&
+                            !(subtree && dwarf_skip_subtrees)) {
+                                level++;
+                        }
+                        continue;
+                }
+
+                struct Dwarf_Inline in = {0};
+                struct Dwarf_Ranges rg;
+                const void *origin = NULL, *high_entry = NULL;
+                bool has_low = 0;
+                unsigned file = 0;
+                rg.rg_next = NULL;
+                const struct Dwarf_Attrspec *attr, *high = NULL;
+                for (attr = ab->ab_attrs; attr->as_name || attr->as_form;
+                     attr++) {
+                        unsigned name = attr->as_name, form = attr->as_form;
+                        uint32_t value = 0;
+                        if (name == DW_AT_abstract_origin) {
+                                origin = dwarf_read_ref(addrs, cu, form, entry);
+                        } else if (name == DW_AT_low_pc) {
+                                in.in_low = dwarf_read_address(addrs, cu, form,
+                                                               entry);
+                                has_low = 1;
                         } else if (name == DW_AT_high_pc) {
-                                count = dwarf_read_abbrev_entry(
-                                    entry, form, &high_pc, sizeof(high_pc),
-                                    address_size);
-                                if (form != DW_FORM_addr) {
-                                        high_pc += low_pc;
+                                high = attr;
+                                high_entry = entry;
+                        } else if (name == DW_AT_ranges) {
+                                dwarf_read_ranges(addrs, cu, form, entry, &rg);
+                        } else if (name == DW_AT_call_file ||
+                                   name == DW_AT_call_line) {
+                                dwarf_read_abbrev_entry(entry, form, &value,
+                                                        sizeof(value),
+                                                        cu->cu_address_size);
+                                if (form == DW_FORM_implicit_const) {
+                                        value = attr->as_const;
+                                }
+                                if (name == DW_AT_call_file) {
+                                        in.in_call_file = value;
+                                } else {
+                                        in.in_call_line = value;
                                 }
-                        } else {
-                                count = dwarf_read_abbrev_entry(
-                                    entry, form, NULL, 0, address_size);
                         }
-                        entry += count;
-                } while (name != 0 || form != 0);
+                        entry += dwarf_read_abbrev_entry(entry, form, NULL, 0,
+                                                         cu->cu_address_size);
+                }
+                // DW_AT_high_pc may be an offset from a DW_AT_low_pc
+                // after it.
+                if (high) {
+                        in.in_high = dwarf_read_high_pc(addrs, cu, high,
+                                                        high_entry, in.in_low);
+                }
+                if (origin) {
+                        die_origin(addrs, cu, abbrevs, origin, &in.in_name,
+                                   &file);
+                        in.in_decl_file = file;
+                }
+                in.in_namelen = in.in_name ? strlen(in.in_name) : 0;
+                in.in_depth = nopen;
+                in.in_parent = -1;
+                if (nopen < DWARF_MAXINLINE) {
+                        if (has_low && in.in_low < in.in_high) {
+                                fn(&in);
+                        }
+                        while (rg.rg_next && dwarf_ranges_next(&rg, &in.in_low,
+                                                               &in.in_high)) {
+                                fn(&in);
+                        }
+                }
+                if (ab->ab_children) {
+                        if (nopen < DWARF_MAXINLINE) {
+                                open[nopen++] = level;
+                        }
+                        level++;
+                }
+        }
+        return 0;
+}
+
+bool dwarf_skip_subtrees = 1;
+
+// Find the DW_AT_sibling of a DIE with abbreviation `ab` whose attributes
+// start at `entry`, by the skip plan. Returns NULL if it has none.
+static const void *die_sibling(const struct Dwarf_Addrs *addrs,
+                               const struct Dwarf_CU *cu,
+                               const struct Dwarf_Abbrev *ab,
+                               const void *entry) {
+        if (ab->ab_sibling_off == DWARF_NOSIBLING) {
+                return NULL;
+        }
+        entry = dwarf_skip_steps(ab, entry, ab->ab_sibling_step,
+                                 cu->cu_address_size);
+        const void *sibling = dwarf_read_ref(addrs, cu, ab->ab_sibling_form,
+                                             entry + ab->ab_sibling_off);
+        // A sibling always comes after the DIE's attributes.
+        return sibling > entry ? sibling : NULL;
+}
+
+// Skip the children of a DIE, from `entry` just past its attributes to past
+// the null entry that ends them.
+static const void *skip_children(const struct Dwarf_Addrs *addrs,
+                                 const struct Dwarf_CU *cu,
+                                 const struct Dwarf_Abbrevtab *abbrevs,
+                                 const void *entry) {
+        int depth = 1;
+        while (depth > 0 && entry < (const void *)cu->cu_end) {
+                unsigned abbrev_code = 0;
+                entry += dwarf_read_uleb128(entry, &abbrev_code);
+                if (abbrev_code == 0) {
+                        depth--;
+                        continue;
+                }
+                const struct Dwarf_Abbrev *abbrev =
+                    dwarf_abbrev(abbrevs, abbrev_code);
+                if (!abbrev) {
+                        return cu->cu_end;
+                }
+                const void *sibling = abbrev->ab_children
+                                          ? die_sibling(addrs, cu, abbrev, entry)
+                                          : NULL;
+                if (sibling) {
+                        entry = sibling;
+                } else {
+                        entry = dwarf_skip_attrs(abbrev, entry,
+                                                 cu->cu_address_size);
+                        depth += abbrev->ab_children;
+                }
+        }
+        return entry;
+}
 
-                if (p >= low_pc && p <= high_pc) {
-                        *store =
-                            (const unsigned char *)header - addrs->info_begin;
-                        return 0;
+// Skip the DIE with abbreviation `ab` whose attributes start at `entry`, and
+// its children too if `subtree`. Returns where the next DIE starts.
+const void *dwarf_skip_die(const struct Dwarf_Addrs *addrs,
+                           const struct Dwarf_CU *cu,
+                           const struct Dwarf_Abbrevtab *abbrevs,
+                           const struct Dwarf_Abbrev *ab, const void *entry,
+                           bool subtree) {
+        if (subtree && ab->ab_children && dwarf_skip_subtrees) {
+                const void *sibling = die_sibling(addrs, cu, ab, entry);
+                if (sibling) {
+                        return sibling;
                 }
+                entry = dwarf_skip_attrs(ab, entry, cu->cu_address_size);
+                return skip_children(addrs, cu, abbrevs, entry);
+        }
+        return dwarf_skip_attrs(ab, entry, cu->cu_address_size);
+}
 
-                entry = entry_end;
+// Return where the next sibling of a DIE with abbreviation `ab` starts,
+// given `entry` just past its attributes and its DW_AT_sibling, if it has
+// one. Without DW_AT_sibling, this still skips its children quickly where
+// they have one.
+const void *dwarf_skip_subtree(const struct Dwarf_Addrs *addrs,
+                               const struct Dwarf_CU *cu,
+                               const struct Dwarf_Abbrevtab *abbrevs,
+                               const struct Dwarf_Abbrev *ab,
+                               const void *entry, const void *sibling) {
+        if (!ab->ab_children || !dwarf_skip_subtrees) {
+                return entry;
+        }
+        // A sibling always comes after the DIE's attributes.
+        if (sibling > entry) {
+                return sibling;
+        }
+        return skip_children(addrs, cu, abbrevs, entry);
+}
+
+// Find a compilation unit, which contains given address from .debug_info
+// section.
+static int info_by_address_debug_info(const struct Dwarf_Addrs *addrs,
+                                      uintptr_t p, Dwarf_Off *store) {
+        Dwarf_Off offset = 0;
+        while (offset < addrs->info_end - addrs->info_begin) {
+                // The CU cache has the unit's range.
+                struct Dwarf_Cuinfo *ci;
+                int code = dwarf_cu_get(addrs, offset, &ci);
+                if (code < 0) {
+                        return code;
+                }
+                const struct Dwarf_Abbrev *abbrev = ci->ci_abbrev;
+                // Skip an empty unit, like the one kernel.ld pads with.
+                if (abbrev) {
+                        assert(abbrev->ab_tag == DW_TAG_compile_unit ||
+                               abbrev->ab_tag == DW_TAG_partial_unit ||
+                               abbrev->ab_tag == DW_TAG_type_unit);
+                        bool found = p >= ci->ci_low_pc && p <= ci->ci_high_pc;
+                        if (ci->ci_ranges_form) {
+                                struct Dwarf_Ranges rg;
+                                uintptr_t low = 0;
+                                dwarf_read_ranges(addrs, &ci->ci_cu,
+                                                  ci->ci_ranges_form,
+                                                  ci->ci_ranges, &rg);
+                                found = dwarf_ranges_find(&rg, p, &low);
+                        }
+                        if (found) {
+                                *store = offset;
+                                return 0;
+                        }
+                }
+                offset = (const unsigned char *)ci->ci_cu.cu_end -
+                         addrs->info_begin;
         }
         return 0;
 }
 
 int info_by_address(const struct Dwarf_Addrs *addrs, uintptr_t p,
                     Dwarf_Off *store) {
-        int code = info_by_address_debug_aranges(addrs, p, store);
+        int code = dwarf_need(DWARF_ARANGES | DWARF_DIES);
+        if (code < 0) {
+                return code;
+        }
+        code = dwarf_aranges_lookup(addrs, p, store);
         if (code < 0) {
                 code = info_by_address_debug_info(addrs, p, store);
         }
@@ -373,80 +950,30 @@ int info_by_address(const struct Dwarf_Addrs *addrs, uintptr_t p,
 
 int file_name_by_info(const struct Dwarf_Addrs *addrs, Dwarf_Off offset,
                       char *buf, int buflen, Dwarf_Off *line_off) {
+        if (dwarf_need(DWARF_DIES) < 0) {
+                return -E_BAD_DWARF;
+        }
         if (offset > addrs->info_end - addrs->info_begin) {
                 return -E_INVAL;
         }
-        const void *entry = addrs->info_begin + offset;
-        int count = 0;
-        unsigned long len = 0;
-        count = dwarf_entry_len(entry, &len);
-        if (count == 0) {
-                return -E_BAD_DWARF;
-        } else {
-                entry += count;
-        }
-
-        // Parse compilation unit header.
-        Dwarf_Half version = get_unaligned(entry, Dwarf_Half);
-        entry += sizeof(Dwarf_Half);
-        assert(version == 4 || version == 2);
-        Dwarf_Off abbrev_offset = get_unaligned(entry, uint32_t);
-        entry += count;
-        Dwarf_Small address_size = get_unaligned(entry++, Dwarf_Small);
-        assert(address_size == 4);
 
-        // Read abbreviation code
-        unsigned abbrev_code = 0;
-        count = dwarf_read_uleb128(entry, &abbrev_code);
-        assert(abbrev_code != 0);
-        entry += count;
-
-        // Read abbreviations table
-        const void *abbrev_entry = addrs->abbrev_begin + abbrev_offset;
-        unsigned table_abbrev_code = 0;
-        count = dwarf_read_uleb128(abbrev_entry, &table_abbrev_code);
-        abbrev_entry += count;
-        assert(table_abbrev_code == abbrev_code);
-        unsigned tag = 0;
-        count = dwarf_read_uleb128(abbrev_entry, &tag);
-        abbrev_entry += count;
-        assert(tag == DW_TAG_compile_unit);
-        abbrev_entry++;
-        unsigned name = 0, form = 0;
-        do {
-                count = dwarf_read_uleb128(abbrev_entry, &name);
-                abbrev_entry += count;
-                count = dwarf_read_uleb128(abbrev_entry, &form);
-                abbrev_entry += count;
-                if (name == DW_AT_name) {
-                        if (form == DW_FORM_strp) {
-                                unsigned long offset = 0;
-                                count = dwarf_read_abbrev_entry(
-                                    entry, form, &offset, sizeof(unsigned long),
-                                    address_size);
-                                if (buf && buflen >= sizeof(const char **)) {
+        // The CU cache has read the unit's DIE.
+        struct Dwarf_Cuinfo *ci;
+        int code = dwarf_cu_get(addrs, offset, &ci);
+        if (code < 0) {
+                return code;
+        }
+        assert(ci->ci_abbrev != NULL);
+        assert(ci->ci_abbrev->ab_tag == DW_TAG_compile_unit);
+        if (ci->ci_name && buf && buflen >= sizeof(const char **)) {
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wpointer-to-int-cast"
-                                        put_unaligned(
-                                            (const char *)addrs->str_begin +
-                                                offset,
-                                            (char **)buf);
+                put_unaligned(ci->ci_name, (char **)buf);
 #pragma GCC diagnostic pop
-                                }
-                        } else {
-                                count = dwarf_read_abbrev_entry(
-                                    entry, form, buf, buflen, address_size);
-                        }
-                } else if (name == DW_AT_stmt_list) {
-                        count = dwarf_read_abbrev_entry(entry, form, line_off,
-                                                        sizeof(Dwarf_Off),
-                                                        address_size);
-                } else {
-                        count = dwarf_read_abbrev_entry(entry, form, NULL, 0,
-                                                        address_size);
-                }
-                entry += count;
-        } while (name != 0 || form != 0);
+        }
+        if (ci->ci_stmt_list != DWARF_NOLINES && line_off) {
+                *line_off = ci->ci_stmt_list;
+        }
 
         return 0;
 }
@@ -454,145 +981,127 @@ int file_name_by_info(const struct Dwarf_Addrs *addrs, Dwarf_Off offset,
 int function_by_info(const struct Dwarf_Addrs *addrs, uintptr_t p,
                      Dwarf_Off cu_offset, char *buf, int buflen,
                      uint32_t *offset) {
-        const void *entry = addrs->info_begin + cu_offset;
         int count = 0;
-        unsigned long len = 0;
-        count = dwarf_entry_len(entry, &len);
-        if (count == 0) {
-                return -E_BAD_DWARF;
+        struct Dwarf_Cuinfo *ci;
+        int code = dwarf_cu_get(addrs, cu_offset, &ci);
+        if (code < 0) {
+                return code;
         }
-        entry += count;
-        const void *entry_end = entry + len;
-        // Parse compilation unit header.
-        Dwarf_Half version = get_unaligned(entry, Dwarf_Half);
-        entry += sizeof(Dwarf_Half);
-        assert(version == 4 || version == 2);
-        Dwarf_Off abbrev_offset = get_unaligned(entry, uint32_t);
-        entry += count;
-        Dwarf_Small address_size = get_unaligned(entry++, Dwarf_Small);
-        assert(address_size == 4);
-
-        // Parse abbrev and info sections
+        const struct Dwarf_CU cu = ci->ci_cu;
+        const void *entry = cu.cu_dies;
+        const void *entry_end = cu.cu_end;
+        Dwarf_Small address_size = cu.cu_address_size;
+        const struct Dwarf_Abbrevtab *abbrevs = ci->ci_abbrevs;
         unsigned abbrev_code = 0;
-        unsigned table_abbrev_code = 0;
-        const void *abbrev_entry = addrs->abbrev_begin + abbrev_offset;
-        const void *curr_abbrev_entry = abbrev_entry;
         while (entry < entry_end) {
+                const void *die = entry;
                 // Read info abbreviation code
                 count = dwarf_read_uleb128(entry, &abbrev_code);
                 entry += count;
                 if (abbrev_code == 0) {
                         continue;
                 }
-                // Find abbreviation in abbrev section
-                curr_abbrev_entry = abbrev_entry;
-                unsigned name = 0, form = 0, tag = 0;
-                while ((const unsigned char *)curr_abbrev_entry <
-                       addrs->abbrev_end) { // unsafe needs to be replaced
-                        count = dwarf_read_uleb128(curr_abbrev_entry,
-                                                   &table_abbrev_code);
-                        curr_abbrev_entry += count;
-                        count = dwarf_read_uleb128(curr_abbrev_entry, &tag);
-                        curr_abbrev_entry += count;
-                        curr_abbrev_entry++;
-                        if (table_abbrev_code == abbrev_code) {
-                                break;
-                        }
-                        // skip attributes
-                        do {
-                                count = dwarf_read_uleb128(curr_abbrev_entry,
-                                                           &name);
-                                curr_abbrev_entry += count;
-                                count = dwarf_read_uleb128(curr_abbrev_entry,
-                                                           &form);
-                                curr_abbrev_entry += count;
-                        } while (name != 0 || form != 0);
+                const struct Dwarf_Abbrev *abbrev =
+                    dwarf_abbrev(abbrevs, abbrev_code);
+                if (!abbrev) {
+                        return -E_BAD_DWARF;
                 }
+                const struct Dwarf_Attrspec *attr;
                 // parse subprogram DIE
-                if (tag == DW_TAG_subprogram) {
-                        uint32_t low_pc = 0, high_pc = 0;
-                        const void *fn_name_entry = 0;
-                        unsigned name_form = 0;
-                        do {
-                                count = dwarf_read_uleb128(curr_abbrev_entry,
-                                                           &name);
-                                curr_abbrev_entry += count;
-                                count = dwarf_read_uleb128(curr_abbrev_entry,
-                                                           &form);
-                                curr_abbrev_entry += count;
-                                if (name == DW_AT_low_pc) {
-                                        count = dwarf_read_abbrev_entry(
-                                            entry, form, &low_pc,
-                                            sizeof(low_pc), address_size);
+                if (abbrev->ab_tag == DW_TAG_subprogram) {
+                        uintptr_t low_pc = 0, high_pc = 0;
+                        const void *fn_name_entry = 0, *sibling = NULL;
+                        const void *ranges_entry = NULL, *high_entry = NULL;
+                        const struct Dwarf_Attrspec *high = NULL;
+                        unsigned name_form = 0, ranges_form = 0;
+                        for (attr = abbrev->ab_attrs;
+                             attr->as_name || attr->as_form; attr++) {
+                                unsigned name = attr->as_name;
+                                unsigned form = attr->as_form;
+                                if (name == DW_AT_sibling) {
+                                        sibling = dwarf_read_ref(addrs, &cu,
+                                                                 form, entry);
+                                } else if (name == DW_AT_low_pc) {
+                                        low_pc = dwarf_read_address(
+                                            addrs, &cu, form, entry);
                                 } else if (name == DW_AT_high_pc) {
-                                        count = dwarf_read_abbrev_entry(
-                                            entry, form, &high_pc,
-                                            sizeof(high_pc), address_size);
-                                        if (form != DW_FORM_addr) {
-                                                high_pc += low_pc;
-                                        }
-                                } else {
-                                        if (name == DW_AT_name) {
-                                                fn_name_entry = entry;
-                                                name_form = form;
-                                        }
-                                        count = dwarf_read_abbrev_entry(
-                                            entry, form, NULL, 0, address_size);
+                                        high = attr;
+                                        high_entry = entry;
+                                } else if (name == DW_AT_ranges) {
+                                        ranges_entry = entry;
+                                        ranges_form = form;
+                                } else if (name == DW_AT_name) {
+                                        fn_name_entry = entry;
+                                        name_form = form;
                                 }
+                                count = dwarf_read_abbrev_entry(
+                                    entry, form, NULL, 0, address_size);
                                 entry += count;
-                        } while (name != 0 || form != 0);
+                        }
+                        // DW_AT_high_pc may be an offset from a DW_AT_low_pc
+                        // after it.
+                        if (high) {
+                                high_pc = dwarf_read_high_pc(
+                                    addrs, &cu, high, high_entry, low_pc);
+                        }
+                        // A function in pieces has a range list instead;
+                        // the piece with `p` in it counts as the function.
+                        bool found = p >= low_pc && p <= high_pc;
+                        if (ranges_entry) {
+                                struct Dwarf_Ranges rg;
+                                dwarf_read_ranges(addrs, &cu, ranges_form,
+                                                  ranges_entry, &rg);
+                                found = dwarf_ranges_find(&rg, p, &low_pc);
+                        }
                         // load info and finish if addr in function
-                        if (p >= low_pc && p <= high_pc) {
+                        if (found) {
                                 *offset = low_pc;
-                                if (name_form == DW_FORM_strp) {
-                                        unsigned long str_offset = 0;
-                                        count = dwarf_read_abbrev_entry(
-                                            fn_name_entry, name_form,
-                                            &str_offset, sizeof(unsigned long),
-                                            address_size);
-                                        if (buf &&
-                                            buflen >= sizeof(const char **)) {
+                                const char *fn_name =
+                                    fn_name_entry
+                                        ? dwarf_read_string(addrs, &cu,
+                                                            name_form,
+                                                            fn_name_entry)
+                                        : dwarf_die_name(addrs, &cu, abbrevs,
+                                                         die);
+                                if (fn_name && buf &&
+                                    buflen >= sizeof(const char **)) {
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wpointer-to-int-cast"
-                                                put_unaligned(
-                                                    (const char *)
-                                                            addrs->str_begin +
-                                                        str_offset,
-                                                    (char **)buf);
+                                        put_unaligned(fn_name, (char **)buf);
 #pragma GCC diagnostic pop
-                                        }
-                                } else {
-                                        count = dwarf_read_abbrev_entry(
-                                            fn_name_entry, name_form, buf,
-                                            buflen, address_size);
                                 }
                                 return 0;
                         }
+                        // Short of GNU C's nested functions, nothing in the
+                        // function's body can contain `p`.
+                        entry = dwarf_skip_subtree(addrs, &cu, abbrevs, abbrev,
+                                                   entry, sibling);
                 } else {
-                        // skip if not a subprogram
-                        do {
-                                count = dwarf_read_uleb128(curr_abbrev_entry,
-                                                           &name);
-                                curr_abbrev_entry += count;
-                                count = dwarf_read_uleb128(curr_abbrev_entry,
-                                                           &form);
-                                curr_abbrev_entry += count;
-                                count = dwarf_read_abbrev_entry(
-                                    entry, form, NULL, 0, address_size);
-                                entry += count;
-                        } while (name != 0 || form != 0);
+                        // skip if not a subprogram, along with its children
+                        // if they can't be code
+                        entry = dwarf_skip_die(
+                            addrs, &cu, abbrevs, abbrev, entry,
+                            !dwarf_tag_has_code(abbrev->ab_tag));
                 }
         }
         return 0;
 }
 
+// Store the address of the function 'fname' to *offset. Returns
+// -E_NO_ENT, leaving *offset alone, if there is no such function.
 int
 address_by_fname(const struct Dwarf_Addrs *addrs, const char *fname,
                  uintptr_t *offset)
 {
 	const int flen = strlen(fname);
 	if (flen == 0)
-		return 0;
+		return -E_NO_ENT;
+	// The name table has every name we would find below.
+	int r = dwarf_name_lookup(addrs, fname, offset);
+	if (r != -E_BAD_DWARF)
+		return r;
+	if (dwarf_need(DWARF_PUBNAMES | DWARF_DIES) < 0)
+		return -E_BAD_DWARF;
 	const void *pubnames_entry = addrs->pubnames_begin;
 	int count = 0;
 	unsigned long len = 0;
@@ -620,109 +1129,78 @@ address_by_fname(const struct Dwarf_Addrs *addrs, const char *fname,
 				break;
 			}
 			if (!strcmp(fname, pubnames_entry)) {
-				// parse compilation unit header
-				const void *entry
-				    = addrs->info_begin + cu_offset;
-				const void *func_entry = entry + func_offset;
-				count = dwarf_entry_len(entry, &len);
-				if (count == 0) {
-					return -E_BAD_DWARF;
+				// get the compilation unit from the CU cache
+				struct Dwarf_Cuinfo *ci;
+				int code = dwarf_cu_get(addrs, cu_offset, &ci);
+				if (code < 0) {
+					return code;
 				}
-				entry += count;
-				Dwarf_Half version
-				    = get_unaligned(entry, Dwarf_Half);
-				entry += sizeof(Dwarf_Half);
-				assert(version == 4 || version == 2);
-				Dwarf_Off abbrev_offset
-				    = get_unaligned(entry, uint32_t);
-				entry += sizeof(uint32_t);
-				const void *abbrev_entry
-				    = addrs->abbrev_begin + abbrev_offset;
-				Dwarf_Small address_size
-				    = get_unaligned(entry++, Dwarf_Small);
-				assert(address_size == 4);
-				entry = func_entry;
+				const struct Dwarf_CU *cu = &ci->ci_cu;
+				Dwarf_Small address_size = cu->cu_address_size;
+				const void *entry = cu->cu_hdr + func_offset;
 				unsigned abbrev_code = 0;
-				unsigned table_abbrev_code = 0;
 				count
 				    = dwarf_read_uleb128(entry, &abbrev_code);
 				entry += count;
-				unsigned name = 0, form = 0, tag = 0;
-				// find abbreviation in abbrev section
-				while ((const unsigned char *)abbrev_entry
-				       < addrs->abbrev_end) { // unsafe needs
-					                      // to be replaced
-					count = dwarf_read_uleb128(
-					    abbrev_entry, &table_abbrev_code);
-					abbrev_entry += count;
-					count = dwarf_read_uleb128(
-					    abbrev_entry, &tag);
-					abbrev_entry += count;
-					abbrev_entry++;
-					if (table_abbrev_code == abbrev_code) {
-						break;
-					}
-					// skip attributes
-					do {
-						count = dwarf_read_uleb128(
-						    abbrev_entry, &name);
-						abbrev_entry += count;
-						count = dwarf_read_uleb128(
-						    abbrev_entry, &form);
-						abbrev_entry += count;
-					} while (name != 0 || form != 0);
+				// look up the abbreviation
+				const struct Dwarf_Abbrev *abbrev
+				    = dwarf_abbrev(ci->ci_abbrevs, abbrev_code);
+				if (!abbrev) {
+					return -E_BAD_DWARF;
 				}
 				// find low_pc
-				if (tag == DW_TAG_subprogram) {
-					// At this point entry points to the beginning of function's DIE attributes
-					// and abbrev_entry points to abbreviation table entry corresponding to this DIE.
-					// Abbreviation table entry consists of pairs of unsigned LEB128 numbers, the first
-					// encodes name of attribute and the second encodes its form. Attribute entry ends
-					// with a pair where both name and form equal zero.
-					// Address of a function is encoded in attribute with name DW_AT_low_pc.
-					// To find it, we need to scan both abbreviation table and attribute values.
-					// You can read unsigned LEB128 number using dwarf_read_uleb128 function.
-					// Attribute value can be obtained using dwarf_read_abbrev_entry function.
-					// Your code here:
+				if (abbrev->ab_tag == DW_TAG_subprogram) {
+					const struct Dwarf_Attrspec *attr;
+					for (attr = abbrev->ab_attrs;
+					     attr->as_name || attr->as_form;
+					     attr++) {
+						if (attr->as_name == DW_AT_low_pc) {
+							*offset = dwarf_read_address(
+							    addrs, cu, attr->as_form,
+							    entry);
+							return 0;
+						}
+						entry += dwarf_read_abbrev_entry(
+						    entry, attr->as_form, NULL, 0,
+						    address_size);
+					}
 				}
-				return 0;
 			}
 			pubnames_entry += strlen(pubnames_entry) + 1;
 		}
 	}
-	return 0;
+	return -E_NO_ENT;
 }
 
 int
 naive_address_by_fname(const struct Dwarf_Addrs *addrs, const char *fname,
                        uintptr_t *offset)
 {
+	if (dwarf_need(DWARF_DIES) < 0)
+		return -E_BAD_DWARF;
 	const int flen = strlen(fname);
 	if (flen == 0)
-		return 0;
+		return -E_NO_ENT;
 	const void *entry = addrs->info_begin;
 	int count = 0;
 	while ((const unsigned char *)entry < addrs->info_end) {
-		unsigned long len = 0;
-		count = dwarf_entry_len(entry, &len);
-		if (count == 0) {
-			return -E_BAD_DWARF;
-		}
-		entry += count;
-		const void *entry_end = entry + len;
 		// Parse compilation unit header.
-		Dwarf_Half version = get_unaligned(entry, Dwarf_Half);
-		entry += sizeof(Dwarf_Half);
-		assert(version == 4 || version == 2);
-		Dwarf_Off abbrev_offset = get_unaligned(entry, uint32_t);
-		entry += count;
-		Dwarf_Small address_size = get_unaligned(entry++, Dwarf_Small);
-		assert(address_size == 4);
+		struct Dwarf_CU cu;
+		int code = dwarf_read_cu_header(addrs, entry, &cu);
+		if (code < 0) {
+			return code;
+		}
+		const void *entry_end = cu.cu_end;
+		Dwarf_Off abbrev_offset = cu.cu_abbrev_offset;
+		Dwarf_Small address_size = cu.cu_address_size;
+		entry = cu.cu_dies;
 		// Parse related DIE's
+		const struct Dwarf_Abbrevtab *abbrevs
+		    = dwarf_abbrevs(addrs, abbrev_offset);
+		if (!abbrevs) {
+			return -E_BAD_DWARF;
+		}
 		unsigned abbrev_code = 0;
-		unsigned table_abbrev_code = 0;
-		const void *abbrev_entry = addrs->abbrev_begin + abbrev_offset;
-		const void *curr_abbrev_entry = abbrev_entry;
 		while (entry < entry_end) {
 			// Read info abbreviation code
 			count = dwarf_read_uleb128(entry, &abbrev_code);
@@ -730,108 +1208,54 @@ naive_address_by_fname(const struct Dwarf_Addrs *addrs, const char *fname,
 			if (abbrev_code == 0) {
 				continue;
 			}
-			// Find abbreviation in abbrev section
-			curr_abbrev_entry = abbrev_entry;
-			unsigned name = 0, form = 0, tag = 0;
-			while ((const unsigned char *)curr_abbrev_entry
-			       < addrs->abbrev_end) { // unsafe needs to be
-				                      // replaced
-				count = dwarf_read_uleb128(curr_abbrev_entry,
-				                           &table_abbrev_code);
-				curr_abbrev_entry += count;
-				count = dwarf_read_uleb128(curr_abbrev_entry,
-				                           &tag);
-				curr_abbrev_entry += count;
-				curr_abbrev_entry++;
-				if (table_abbrev_code == abbrev_code) {
-					break;
-				}
-				// skip attributes
-				do {
-					count = dwarf_read_uleb128(
-					    curr_abbrev_entry, &name);
-					curr_abbrev_entry += count;
-					count = dwarf_read_uleb128(
-					    curr_abbrev_entry, &form);
-					curr_abbrev_entry += count;
-				} while (name != 0 || form != 0);
+			const struct Dwarf_Abbrev *abbrev
+			    = dwarf_abbrev(abbrevs, abbrev_code);
+			if (!abbrev) {
+				return -E_BAD_DWARF;
 			}
+			const struct Dwarf_Attrspec *attr;
 			// parse subprogram or label DIE
-			if (tag == DW_TAG_subprogram || tag == DW_TAG_label) {
+			if (abbrev->ab_tag == DW_TAG_subprogram
+			    || abbrev->ab_tag == DW_TAG_label) {
 				uint32_t low_pc = 0;
-				int found = 0;
-				do {
-					count = dwarf_read_uleb128(
-					    curr_abbrev_entry, &name);
-					curr_abbrev_entry += count;
-					count = dwarf_read_uleb128(
-					    curr_abbrev_entry, &form);
-					curr_abbrev_entry += count;
+				int found = 0, has_low = 0;
+				for (attr = abbrev->ab_attrs;
+				     attr->as_name || attr->as_form; attr++) {
+					unsigned name = attr->as_name;
+					unsigned form = attr->as_form;
 					if (name == DW_AT_low_pc) {
-						count
-						    = dwarf_read_abbrev_entry(
-						        entry, form, &low_pc,
-						        sizeof(low_pc),
-						        address_size);
+						low_pc = dwarf_read_address(
+						    addrs, &cu, form, entry);
+						has_low = 1;
 					} else if (name == DW_AT_name) {
-						if (form == DW_FORM_strp) {
-							unsigned long
-							    str_offset
-							    = 0;
-							count = dwarf_read_abbrev_entry(
-							    entry, form,
-							    &str_offset,
-							    sizeof(
-							        unsigned long),
-							    address_size);
-							if (!strcmp(
-							        fname,
-							        (const char
-							             *)addrs
-							                ->str_begin
-							            + str_offset)) {
-								found = 1;
-							}
-						} else {
-							if (!strcmp(fname, entry)) {
-								found = 1;
-							}
-							count
-							    = dwarf_read_abbrev_entry(
-							        entry, form,
-							        NULL, 0,
-							        address_size);
+						const char *name_str
+						    = dwarf_read_string(
+						        addrs, &cu, form, entry);
+						if (name_str
+						    && !strcmp(fname, name_str)) {
+							found = 1;
 						}
-					} else {
-						count
-						    = dwarf_read_abbrev_entry(
-						        entry, form, NULL, 0,
-						        address_size);
 					}
+					count = dwarf_read_abbrev_entry(
+					    entry, form, NULL, 0, address_size);
 					entry += count;
-				} while (name != 0 || form != 0);
-				if (found) {
+				}
+				// declarations and abstract instances have no
+				// address: keep looking for the definition
+				if (found && has_low) {
 					// finish if fname found
 					*offset = low_pc;
 					return 0;
 				}
 			} else {
-				// skip if not a subprogram or label
-				do {
-					count = dwarf_read_uleb128(
-					    curr_abbrev_entry, &name);
-					curr_abbrev_entry += count;
-					count = dwarf_read_uleb128(
-					    curr_abbrev_entry, &form);
-					curr_abbrev_entry += count;
-					count = dwarf_read_abbrev_entry(
-					    entry, form, NULL, 0,
-					    address_size);
-					entry += count;
-				} while (name != 0 || form != 0);
+				// skip if not a subprogram or label, along with
+				// its children if they can't be code
+				entry = dwarf_skip_die(
+				    addrs, &cu, abbrevs, abbrev, entry,
+				    !dwarf_tag_has_code(abbrev->ab_tag));
 			}
 		}
 	}
 
-	return 0;
+	return -E_NO_ENT;
 }
@@ -0,0 +1,296 @@
+// The CU cache: compilation units as lookups use them, so a lookup in a
+// unit parses its header and reads its DIE only the first time.
+//
+// A unit's descriptor holds its decoded header, abbreviation table, name,
+// line program offset and address range or range list.  The indexes over
+// the unit that lookups build, its decoded line table, function index and
+// inline index, hang off it.
+// Descriptors and indexes all come out of one pool of DWARF_CU_BUDGET
+// bytes; when it is full, the least recently used units are evicted, so
+// a kernel with lots of debug information never indexes more of it than
+// the lookups keep using.
+
+#include <inc/assert.h>
+#include <inc/error.h>
+#include <inc/string.h>
+#include <inc/dwarf.h>
+
+// Memory for the CU cache; set with CONFIG_DWARF_CU_BUDGET=bytes.
+#ifndef DWARF_CU_BUDGET
+#define DWARF_CU_BUDGET	(64 * 1024)
+#endif
+
+#define DWARF_CU_NBUCKETS	64
+
+// A block of the pool: free, on the free list in address order, or
+// allocated, with the memory handed out right after the header.
+struct Cu_Block {
+	uint32_t cb_size;		// header included
+	struct Cu_Block *cb_next;	// next free block
+};
+
+static struct Cu_Block *pool_free_list;
+static bool pool_made;
+
+static struct Dwarf_Cuinfo *cu_buckets[DWARF_CU_NBUCKETS];
+static struct Dwarf_Cuinfo *cu_lru_head, *cu_lru_tail;	// most recent first
+
+// For a unit whose descriptor doesn't fit.  It is good until the next
+// dwarf_cu_get(), and never gets indexes.
+static struct Dwarf_Cuinfo cu_scratch;
+
+static bool
+pool_make(void)
+{
+	pool_made = 1;
+	if (!(pool_free_list = dwarf_alloc(DWARF_CU_BUDGET)))
+		return 0;
+	pool_free_list->cb_size = ROUNDDOWN(DWARF_CU_BUDGET, sizeof(struct Cu_Block));
+	pool_free_list->cb_next = NULL;
+	return 1;
+}
+
+// First fit, splitting the block if what is left of it is any use.
+static void *
+pool_alloc(size_t n)
+{
+	struct Cu_Block **bp, *b, *rest;
+	uint32_t size = ROUNDUP(n, sizeof(struct Cu_Block))
+		+ sizeof(struct Cu_Block);
+
+	if (n > DWARF_CU_BUDGET)
+		return NULL;
+	for (bp = &pool_free_list; (b = *bp) != NULL; bp = &b->cb_next) {
+		if (b->cb_size < size)
+			continue;
+		if (b->cb_size - size >= 2 * sizeof(struct Cu_Block)) {
+			rest = (struct Cu_Block *) ((char *) b + size);
+			rest->cb_size = b->cb_size - size;
+			rest->cb_next = b->cb_next;
+			b->cb_size = size;
+			*bp = rest;
+		} else
+			*bp = b->cb_next;
+		dwarf_stats.dws_cu_used += b->cb_size;
+		return b + 1;
+	}
+	return NULL;
+}
+
+// Put the block back on the free list, merging it with its neighbors.
+static void
+pool_free(void *p)
+{
+	struct Cu_Block *b = (struct Cu_Block *) p - 1, *prev = NULL, *next;
+
+	if (!p)
+		return;
+	dwarf_stats.dws_cu_used -= b->cb_size;
+	for (next = pool_free_list; next && next < b; next = next->cb_next)
+		prev = next;
+	if (next && (char *) b + b->cb_size == (char *) next) {
+		b->cb_size += next->cb_size;
+		next = next->cb_next;
+	}
+	b->cb_next = next;
+	if (prev && (char *) prev + prev->cb_size == (char *) b) {
+		prev->cb_size += b->cb_size;
+		prev->cb_next = b->cb_next;
+	} else if (prev)
+		prev->cb_next = b;
+	else
+		pool_free_list = b;
+}
+
+static struct Dwarf_Cuinfo **
+cu_bucket(Dwarf_Off offset)
+{
+	return &cu_buckets[(uint32_t) offset * 2654435761U >> 26];
+}
+
+static void
+lru_unlink(struct Dwarf_Cuinfo *ci)
+{
+	if (ci->ci_lru_prev)
+		ci->ci_lru_prev->ci_lru_next = ci->ci_lru_next;
+	else
+		cu_lru_head = ci->ci_lru_next;
+	if (ci->ci_lru_next)
+		ci->ci_lru_next->ci_lru_prev = ci->ci_lru_prev;
+	else
+		cu_lru_tail = ci->ci_lru_prev;
+}
+
+static void
+lru_push(struct Dwarf_Cuinfo *ci)
+{
+	ci->ci_lru_prev = NULL;
+	ci->ci_lru_next = cu_lru_head;
+	if (cu_lru_head)
+		cu_lru_head->ci_lru_prev = ci;
+	else
+		cu_lru_tail = ci;
+	cu_lru_head = ci;
+}
+
+// Mark 'ci' as used most recently.
+static void
+lru_touch(struct Dwarf_Cuinfo *ci)
+{
+	if (ci != cu_lru_head && ci != &cu_scratch) {
+		lru_unlink(ci);
+		lru_push(ci);
+	}
+}
+
+static void
+cu_evict(struct Dwarf_Cuinfo *ci)
+{
+	struct Dwarf_Cuinfo **cp;
+
+	for (cp = cu_bucket(ci->ci_offset); *cp != ci; cp = &(*cp)->ci_hash_next)
+		/* do nothing */;
+	*cp = ci->ci_hash_next;
+	lru_unlink(ci);
+	pool_free(ci->ci_lines);
+	pool_free(ci->ci_funcs);
+	pool_free(ci->ci_inlines);
+	pool_free(ci);
+	dwarf_stats.dws_cu_evictions++;
+}
+
+// Allocate 'n' bytes of the CU cache for an index of the unit 'ci',
+// evicting the least recently used other units until they fit.  Returns
+// NULL if they don't fit even then.  'ci' may be NULL, for a descriptor.
+void *
+dwarf_cu_alloc(struct Dwarf_Cuinfo *ci, size_t n)
+{
+	void *p;
+
+	if (ci == &cu_scratch || (!pool_made && !pool_make()))
+		return NULL;
+	while (!(p = pool_alloc(n))) {
+		if (!cu_lru_tail || cu_lru_tail == ci)
+			return NULL;
+		cu_evict(cu_lru_tail);
+	}
+	return p;
+}
+
+// Fill in the descriptor 'ci' of the unit at 'offset' in .debug_info.
+static int
+cu_read(const struct Dwarf_Addrs *addrs, Dwarf_Off offset,
+	struct Dwarf_Cuinfo *ci)
+{
+	const struct Dwarf_Attrspec *as, *high = NULL;
+	const char *entry, *high_entry = NULL;
+	uint32_t stmt_list;
+	unsigned code;
+	int r;
+
+	memset(ci, 0, sizeof(*ci));
+	ci->ci_offset = offset;
+	ci->ci_stmt_list = DWARF_NOLINES;
+	if ((r = dwarf_read_cu_header(addrs, addrs->info_begin + offset,
+				      &ci->ci_cu)) < 0)
+		return r;
+	if (!(ci->ci_abbrevs = dwarf_abbrevs(addrs, ci->ci_cu.cu_abbrev_offset)))
+		return -E_BAD_DWARF;
+
+	entry = ci->ci_cu.cu_dies;
+	entry += dwarf_read_uleb128(entry, &code);
+	// An empty unit, like the one kernel.ld pads with
+	if (code == 0)
+		return 0;
+	if (!(ci->ci_abbrev = dwarf_abbrev(ci->ci_abbrevs, code)))
+		return -E_BAD_DWARF;
+	for (as = ci->ci_abbrev->ab_attrs; as->as_name || as->as_form; as++) {
+		if (as->as_name == DW_AT_name)
+			ci->ci_name = dwarf_read_string(addrs, &ci->ci_cu,
+							as->as_form, entry);
+		else if (as->as_name == DW_AT_stmt_list) {
+			stmt_list = 0;
+			dwarf_read_abbrev_entry(entry, as->as_form, &stmt_list,
+						sizeof(stmt_list),
+						ci->ci_cu.cu_address_size);
+			ci->ci_stmt_list = stmt_list;
+		}
+		else if (as->as_name == DW_AT_low_pc)
+			ci->ci_low_pc = dwarf_read_address(addrs, &ci->ci_cu,
+							   as->as_form, entry);
+		else if (as->as_name == DW_AT_high_pc) {
+			high = as;
+			high_entry = entry;
+		} else if (as->as_name == DW_AT_ranges) {
+			ci->ci_ranges_form = as->as_form;
+			ci->ci_ranges = entry;
+		}
+		entry += dwarf_read_abbrev_entry(entry, as->as_form, NULL, 0,
+						 ci->ci_cu.cu_address_size);
+	}
+	// DW_AT_high_pc may be an offset from a DW_AT_low_pc after it.
+	if (high)
+		ci->ci_high_pc = dwarf_read_high_pc(addrs, &ci->ci_cu, high,
+						    high_entry, ci->ci_low_pc);
+	return 0;
+}
+
+// Find the unit at 'offset' in .debug_info in the CU cache, reading it
+// into the cache if it is not there, and store its descriptor to
+// *store.  The descriptor is good until the next call, which may evict
+// it.  Returns -E_BAD_DWARF if the unit is malformed.
+int
+dwarf_cu_get(const struct Dwarf_Addrs *addrs, Dwarf_Off offset,
+	     struct Dwarf_Cuinfo **store)
+{
+	struct Dwarf_Cuinfo *ci, **bucket = cu_bucket(offset);
+	int r;
+
+	if ((r = dwarf_need(DWARF_DIES)) < 0)
+		return r;
+	for (ci = *bucket; ci; ci = ci->ci_hash_next)
+		if (ci->ci_offset == offset) {
+			lru_touch(ci);
+			dwarf_stats.dws_cu_hits++;
+			*store = ci;
+			return 0;
+		}
+	dwarf_stats.dws_cu_misses++;
+
+	if (offset >= addrs->info_end - addrs->info_begin)
+		return -E_BAD_DWARF;
+	if (!(ci = dwarf_cu_alloc(NULL, sizeof(*ci)))) {
+		// Lookups in the unit will have to walk it.
+		if ((r = cu_read(addrs, offset, &cu_scratch)) < 0)
+			return r;
+		cu_scratch.ci_lines_tried = cu_scratch.ci_funcs_tried = 1;
+		cu_scratch.ci_inlines_tried = 1;
+		*store = &cu_scratch;
+		return 0;
+	}
+	if ((r = cu_read(addrs, offset, ci)) < 0) {
+		pool_free(ci);
+		return r;
+	}
+	ci->ci_hash_next = *bucket;
+	*bucket = ci;
+	lru_push(ci);
+	*store = ci;
+	return 0;
+}
+
+// The cached unit whose line program is at 'line_offset' in .debug_line,
+// or NULL if none is.  The unit has just been looked up, most likely, so
+// it is near the front.
+struct Dwarf_Cuinfo *
+dwarf_cu_by_lines(Dwarf_Off line_offset)
+{
+	struct Dwarf_Cuinfo *ci;
+
+	for (ci = cu_lru_head; ci; ci = ci->ci_lru_next)
+		if (ci->ci_stmt_list == line_offset) {
+			lru_touch(ci);
+			return ci;
+		}
+	return NULL;
+}
@@ -0,0 +1,1186 @@
+// Indexes over the DWARF sections, built the first time a lookup needs
+// them, so that lookups don't have to walk the sections.
+//
+// Abbreviation tables are decoded once into arrays indexed by the code,
+// so walking the DIEs doesn't rescan .debug_abbrev for every one.
+//
+// The indexes live in an arena that starts on the page after the last
+// debug section (see kern/kernel.ld) and is never freed.  Those over a
+// single unit live in the CU cache (kern/dwarf_cu.c) instead, which
+// evicts them when it runs out of room.
+
+#include <inc/assert.h>
+#include <inc/error.h>
+#include <inc/x86.h>
+#include <inc/string.h>
+#include <inc/dwarf.h>
+
+// The arena ends well below the boot loader's LZ4 buffer at 0x800000.
+#define DWARF_ARENA_END	0x400000
+
+struct Dwarf_Stats dwarf_stats;
+
+// Anything that keeps results derived from the debug sections must drop
+// them when this changes, as it does whenever a section is (re)loaded.
+// Zero is never a valid generation.
+uint32_t dwarf_generation = 1;
+
+static uintptr_t arena_next = (uintptr_t) __DEBUG_END__;
+
+// Allocate 'n' bytes from the arena, or return NULL if it is full.
+void *
+dwarf_alloc(size_t n)
+{
+	void *p;
+
+	arena_next = ROUNDUP(arena_next, sizeof(uint32_t));
+	if (n > DWARF_ARENA_END - arena_next)
+		return NULL;
+	p = (void *) arena_next;
+	arena_next += n;
+	dwarf_stats.dws_arena_used = arena_next - (uintptr_t) __DEBUG_END__;
+	return p;
+}
+
+// An address range of a compilation unit, from .debug_aranges.
+struct Dwarf_Arange {
+	uintptr_t ar_start;
+	uintptr_t ar_end;	// inclusive, as info_by_address always had it
+	uint32_t ar_cu;		// offset of the CU in .debug_info
+};
+
+static struct Dwarf_Arange *aranges;
+static int naranges;
+static bool aranges_built;
+
+// Call 'fn' for each non-empty range in .debug_aranges.  Returns
+// -E_BAD_DWARF if the section is malformed.
+static int
+aranges_walk(const struct Dwarf_Addrs *addrs,
+	     void (*fn)(uintptr_t start, uint32_t size, uint32_t cu))
+{
+	const void *set = addrs->aranges_begin;
+
+	while ((const unsigned char *) set < addrs->aranges_end) {
+		const void *header = set, *set_end;
+		unsigned long len;
+		uint32_t offset, addr, size, entry_size, remainder;
+		int count;
+
+		if ((count = dwarf_entry_len(set, &len)) == 0)
+			return -E_BAD_DWARF;
+		set += count;
+		set_end = set + len;
+
+		if (get_unaligned(set, Dwarf_Half) != 2)
+			return -E_BAD_DWARF;
+		set += sizeof(Dwarf_Half);
+		offset = get_unaligned(set, uint32_t);
+		set += count;
+		if (get_unaligned(set, Dwarf_Small) != 4
+		    || get_unaligned(set + 1, Dwarf_Small) != 0)
+			return -E_BAD_DWARF;
+		set += 2;
+
+		// The tuples are aligned to their size.
+		entry_size = 2 * sizeof(uint32_t);
+		if ((remainder = (set - header) % entry_size))
+			set += entry_size - remainder;
+		for (; set < set_end; set += entry_size) {
+			addr = get_unaligned(set, uint32_t);
+			size = get_unaligned(set + sizeof(uint32_t), uint32_t);
+			if (size)
+				fn(addr, size, offset);
+		}
+	}
+	return 0;
+}
+
+static void
+aranges_count(uintptr_t start, uint32_t size, uint32_t cu)
+{
+	naranges++;
+}
+
+static void
+aranges_add(uintptr_t start, uint32_t size, uint32_t cu)
+{
+	struct Dwarf_Arange *ar;
+
+	// Insertion sort: the compiler emits the ranges mostly in order.
+	for (ar = aranges + naranges; ar > aranges && ar[-1].ar_start > start; ar--)
+		ar[0] = ar[-1];
+	ar->ar_start = start;
+	ar->ar_end = start + size;
+	ar->ar_cu = cu;
+	naranges++;
+}
+
+static void
+aranges_build(const struct Dwarf_Addrs *addrs)
+{
+	uint64_t tsc = read_tsc();
+
+	aranges_built = 1;
+	naranges = 0;
+	if (aranges_walk(addrs, aranges_count) < 0
+	    || !(aranges = dwarf_alloc(naranges * sizeof(*aranges)))) {
+		naranges = 0;
+		return;
+	}
+	naranges = 0;
+	aranges_walk(addrs, aranges_add);
+	dwarf_stats.dws_naranges = naranges;
+	dwarf_stats.dws_aranges_build = read_tsc() - tsc;
+}
+
+// Find the compilation unit that covers address 'p' by binary search in
+// the sorted ranges from .debug_aranges.  Stores the CU's offset in
+// .debug_info to *store.  Returns -E_BAD_DWARF if no range covers 'p'.
+int
+dwarf_aranges_lookup(const struct Dwarf_Addrs *addrs, uintptr_t p,
+		     Dwarf_Off *store)
+{
+	uint64_t tsc = read_tsc();
+	int lo = 0, hi, mid, r = -E_BAD_DWARF;
+
+	if (!aranges_built)
+		aranges_build(addrs);
+
+	// Find the last range that starts at or below p.
+	hi = naranges;
+	while (lo < hi) {
+		mid = (lo + hi) / 2;
+		if (aranges[mid].ar_start <= p)
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
+	if (lo > 0 && p <= aranges[lo - 1].ar_end) {
+		*store = aranges[lo - 1].ar_cu;
+		r = 0;
+	}
+
+	dwarf_stats.dws_arange_lookups++;
+	dwarf_stats.dws_arange_cycles += read_tsc() - tsc;
+	return r;
+}
+
+// The size of attributes of 'form', or -1 if it varies.  Units with
+// addresses of other than 4 bytes are rejected before we get here.
+static int
+form_size(unsigned form)
+{
+	switch (form) {
+	case DW_FORM_flag_present:
+	case DW_FORM_implicit_const:
+		return 0;
+	case DW_FORM_data1:
+	case DW_FORM_ref1:
+	case DW_FORM_flag:
+	case DW_FORM_strx1:
+	case DW_FORM_addrx1:
+		return 1;
+	case DW_FORM_data2:
+	case DW_FORM_ref2:
+	case DW_FORM_strx2:
+	case DW_FORM_addrx2:
+		return 2;
+	case DW_FORM_strx3:
+	case DW_FORM_addrx3:
+		return 3;
+	case DW_FORM_addr:
+	case DW_FORM_data4:
+	case DW_FORM_ref4:
+	case DW_FORM_ref_addr:
+	case DW_FORM_strp:
+	case DW_FORM_line_strp:
+	case DW_FORM_strp_sup:
+	case DW_FORM_ref_sup4:
+	case DW_FORM_sec_offset:
+	case DW_FORM_strx4:
+	case DW_FORM_addrx4:
+		return 4;
+	case DW_FORM_data8:
+	case DW_FORM_ref8:
+	case DW_FORM_ref_sig8:
+	case DW_FORM_ref_sup8:
+		return 8;
+	case DW_FORM_data16:
+		return 16;
+	default:
+		return -1;
+	}
+}
+
+// The decoded abbreviation tables, by their offset in .debug_abbrev.
+// Compilation units often share one.
+static struct Dwarf_Abbrevtab *abbrevtabs;
+
+// Decode the abbreviation table at 'offset' in .debug_abbrev, or return
+// NULL if it is malformed or the arena is full.
+static struct Dwarf_Abbrevtab *
+abbrevs_build(const struct Dwarf_Addrs *addrs, Dwarf_Off offset)
+{
+	struct Dwarf_Abbrevtab *at;
+	struct Dwarf_Abbrev *ab;
+	struct Dwarf_Attrspec *as;
+	struct Dwarf_Skipstep *st;
+	const char *p, *start = (const char *) addrs->abbrev_begin + offset;
+	const char *end = (const char *) addrs->abbrev_end;
+	unsigned code = 1, tag, name, form, maxcode = 0, nattrs = 0, nsteps = 0;
+	int value, size;
+	uint64_t tsc = read_tsc();
+
+	// First find out how much room the table needs.
+	for (p = start; p < end; ) {
+		p += dwarf_read_uleb128(p, &code);
+		if (code == 0)
+			break;
+		p += dwarf_read_uleb128(p, &tag);
+		p++;
+		maxcode = MAX(maxcode, code);
+		do {
+			p += dwarf_read_uleb128(p, &name);
+			p += dwarf_read_uleb128(p, &form);
+			// DWARF 5 puts constants shared by all DIEs here.
+			if (form == DW_FORM_implicit_const)
+				p += dwarf_read_leb128(p, &value);
+			if (form_size(form) < 0)
+				nsteps++;
+			nattrs++;
+		} while (name != 0 || form != 0);
+	}
+	if (code != 0 || maxcode > DWARF_MAXABBREV)
+		return NULL;
+
+	if (!(at = dwarf_alloc(sizeof(*at)))
+	    || !(at->at_abbrevs = dwarf_alloc((maxcode + 1) * sizeof(*ab)))
+	    || !(as = dwarf_alloc(nattrs * sizeof(*as)))
+	    || !(st = dwarf_alloc(nsteps * sizeof(*st))))
+		return NULL;
+	memset(at->at_abbrevs, 0, (maxcode + 1) * sizeof(*ab));
+	at->at_offset = offset;
+	at->at_ncodes = maxcode + 1;
+
+	for (p = start; ; ) {
+		p += dwarf_read_uleb128(p, &code);
+		if (code == 0)
+			break;
+		ab = &at->at_abbrevs[code];
+		p += dwarf_read_uleb128(p, &tag);
+		ab->ab_tag = tag;
+		ab->ab_children = *p++;
+		ab->ab_attrs = as;
+		ab->ab_steps = st;
+		ab->ab_nsteps = 0;
+		ab->ab_fixed = 0;
+		ab->ab_sibling_off = DWARF_NOSIBLING;
+		for (;;) {
+			p += dwarf_read_uleb128(p, &name);
+			p += dwarf_read_uleb128(p, &form);
+			as->as_name = name;
+			as->as_form = form;
+			as->as_const = 0;
+			if (form == DW_FORM_implicit_const) {
+				p += dwarf_read_leb128(p, &value);
+				as->as_const = value;
+			}
+			as++;
+			if (name == 0 && form == 0)
+				break;
+
+			// Plan how to skip this attribute.
+			if (name == DW_AT_sibling) {
+				ab->ab_sibling_step = ab->ab_nsteps;
+				ab->ab_sibling_off = ab->ab_fixed;
+				ab->ab_sibling_form = form;
+			}
+			if ((size = form_size(form)) >= 0)
+				ab->ab_fixed += size;
+			else {
+				st->ss_fixed = ab->ab_fixed;
+				st->ss_form = form;
+				st++;
+				ab->ab_nsteps++;
+				ab->ab_fixed = 0;
+			}
+		}
+	}
+
+	at->at_next = abbrevtabs;
+	abbrevtabs = at;
+	dwarf_stats.dws_nabbrevtabs++;
+	dwarf_stats.dws_abbrev_build += read_tsc() - tsc;
+	return at;
+}
+
+// Return the decoded abbreviation table at 'offset' in .debug_abbrev,
+// decoding it the first time.  Returns NULL if it is malformed.
+const struct Dwarf_Abbrevtab *
+dwarf_abbrevs(const struct Dwarf_Addrs *addrs, Dwarf_Off offset)
+{
+	struct Dwarf_Abbrevtab *at;
+
+	for (at = abbrevtabs; at; at = at->at_next)
+		if (at->at_offset == offset)
+			return at;
+	if (offset >= addrs->abbrev_end - addrs->abbrev_begin)
+		return NULL;
+	return abbrevs_build(addrs, offset);
+}
+
+// A function, from a DW_TAG_subprogram DIE with an address.  Each unit in
+// the CU cache gets an index of its functions, sorted by address.
+struct Dwarf_Func {
+	uintptr_t fn_low;
+	uintptr_t fn_high;	// inclusive, as function_by_info has it
+	const char *fn_name;
+	uint16_t fn_namelen;
+	uint32_t fn_cu;		// offset of the CU in .debug_info
+};
+
+// The function index being built
+static struct Dwarf_Func *funcs;
+static int nfuncs;
+
+// Read the address and name attributes of the DIE at 'entry', just past
+// its abbreviation code, into 'f'.  Returns whether it has an address,
+// and stores where the next DIE starts to *next.  The range of a DIE in
+// pieces is its first piece, which is where the function starts; if 'rg'
+// isn't NULL, the rest of its pieces can be read from it.  A DIE with an
+// address but no name gets the name of its abstract origin.
+static bool
+die_read(const struct Dwarf_Addrs *addrs, const struct Dwarf_CU *cu,
+	 const struct Dwarf_Abbrevtab *abbrevs, const struct Dwarf_Abbrev *ab,
+	 const char *entry, struct Dwarf_Func *f, struct Dwarf_Ranges *rg,
+	 const char **next)
+{
+	const struct Dwarf_Attrspec *as, *high = NULL;
+	struct Dwarf_Ranges ranges;
+	const void *origin = NULL, *high_entry = NULL;
+	bool has_low = 0;
+
+	if (!rg)
+		rg = &ranges;
+	rg->rg_next = NULL;
+	f->fn_low = f->fn_high = 0;
+	f->fn_name = NULL;
+	for (as = ab->ab_attrs; as->as_name || as->as_form; as++) {
+		if (as->as_name == DW_AT_low_pc) {
+			f->fn_low = dwarf_read_address(addrs, cu, as->as_form,
+						       entry);
+			has_low = 1;
+		} else if (as->as_name == DW_AT_high_pc) {
+			high = as;
+			high_entry = entry;
+		} else if (as->as_name == DW_AT_ranges) {
+			dwarf_read_ranges(addrs, cu, as->as_form, entry, rg);
+			has_low = dwarf_ranges_next(rg, &f->fn_low, &f->fn_high);
+		} else if (as->as_name == DW_AT_name)
+			f->fn_name = dwarf_read_string(addrs, cu, as->as_form,
+						       entry);
+		else if ((as->as_name == DW_AT_abstract_origin
+			  || as->as_name == DW_AT_specification)
+			 && as->as_form != DW_FORM_ref_sig8)
+			origin = dwarf_read_ref(addrs, cu, as->as_form, entry);
+		entry += dwarf_read_abbrev_entry(entry, as->as_form, NULL, 0,
+						 cu->cu_address_size);
+	}
+	// DW_AT_high_pc may be an offset from a DW_AT_low_pc after it.
+	if (high)
+		f->fn_high = dwarf_read_high_pc(addrs, cu, high, high_entry,
+						f->fn_low);
+	if (has_low && !f->fn_name && origin)
+		f->fn_name = dwarf_die_name(addrs, cu, abbrevs, origin);
+	*next = entry;
+	return has_low;
+}
+
+// Find the address of the out-of-line copy of the function whose abstract
+// instance is the DIE at 'die' in the unit 'cu': the subprogram DIE whose
+// DW_AT_abstract_origin refers to it.  The name tables point at the
+// abstract instance, which has no address, for a function that was also
+// inlined.  Returns whether there is one.
+static bool
+die_concrete(const struct Dwarf_Addrs *addrs, const struct Dwarf_CU *cu,
+	     const struct Dwarf_Abbrevtab *abbrevs, const char *die,
+	     uintptr_t *addr)
+{
+	const struct Dwarf_Attrspec *as;
+	const struct Dwarf_Abbrev *ab;
+	const void *origin;
+	struct Dwarf_Func f;
+	const char *entry, *attrs;
+	unsigned code;
+
+	for (entry = cu->cu_dies; entry < cu->cu_end; ) {
+		entry += dwarf_read_uleb128(entry, &code);
+		if (code == 0)
+			continue;
+		if (!(ab = dwarf_abbrev(abbrevs, code)))
+			return 0;
+		if (ab->ab_tag != DW_TAG_subprogram) {
+			entry = dwarf_skip_die(addrs, cu, abbrevs, ab, entry,
+					       !dwarf_tag_has_code(ab->ab_tag));
+			continue;
+		}
+		attrs = entry;
+		origin = NULL;
+		for (as = ab->ab_attrs; as->as_name || as->as_form; as++) {
+			if (as->as_name == DW_AT_abstract_origin
+			    && as->as_form != DW_FORM_ref_sig8)
+				origin = dwarf_read_ref(addrs, cu, as->as_form,
+							entry);
+			entry += dwarf_read_abbrev_entry(entry, as->as_form,
+							 NULL, 0,
+							 cu->cu_address_size);
+		}
+		if (origin == die
+		    && die_read(addrs, cu, abbrevs, ab, attrs, &f, NULL, &attrs)) {
+			*addr = f.fn_low;
+			return 1;
+		}
+	}
+	return 0;
+}
+
+// Call 'fn' for each subprogram or label DIE with an address in the unit
+// 'cu', whose abbreviation table is 'abbrevs': for a function in pieces,
+// once for each, starting with the first.
+static int
+funcs_walk_unit(const struct Dwarf_Addrs *addrs, const struct Dwarf_CU *cu,
+		const struct Dwarf_Abbrevtab *abbrevs,
+		void (*fn)(unsigned tag, const struct Dwarf_Func *))
+{
+	const struct Dwarf_Abbrev *ab;
+	struct Dwarf_Ranges rg;
+	struct Dwarf_Func f;
+	const char *entry;
+	unsigned code;
+
+	for (entry = cu->cu_dies; entry < cu->cu_end; ) {
+		entry += dwarf_read_uleb128(entry, &code);
+		if (code == 0)
+			continue;
+		if (!(ab = dwarf_abbrev(abbrevs, code)))
+			return -E_BAD_DWARF;
+
+		if (ab->ab_tag != DW_TAG_subprogram
+		    && ab->ab_tag != DW_TAG_label) {
+			// Types have no functions inside.
+			entry = dwarf_skip_die(addrs, cu, abbrevs, ab, entry,
+					       !dwarf_tag_has_code(ab->ab_tag));
+			continue;
+		}
+
+		// Declarations and abstract instances have no address.
+		if (die_read(addrs, cu, abbrevs, ab, entry, &f, &rg, &entry)) {
+			f.fn_cu = cu->cu_hdr - (const char *) addrs->info_begin;
+			do
+				fn(ab->ab_tag, &f);
+			while (rg.rg_next
+			       && dwarf_ranges_next(&rg, &f.fn_low, &f.fn_high));
+		}
+	}
+	return 0;
+}
+
+// Call 'fn' for each subprogram or label DIE with an address in
+// .debug_info.  This reads every unit once, so it doesn't go through
+// the CU cache, which would only lose the units it has.
+static int
+funcs_walk(const struct Dwarf_Addrs *addrs,
+	   void (*fn)(unsigned tag, const struct Dwarf_Func *))
+{
+	const char *hdr = (const char *) addrs->info_begin;
+	const struct Dwarf_Abbrevtab *abbrevs;
+	struct Dwarf_CU cu;
+	int r;
+
+	for (; (const unsigned char *) hdr < addrs->info_end; hdr = cu.cu_end) {
+		if ((r = dwarf_read_cu_header(addrs, hdr, &cu)) < 0)
+			return r;
+		if (!(abbrevs = dwarf_abbrevs(addrs, cu.cu_abbrev_offset)))
+			return -E_BAD_DWARF;
+		if ((r = funcs_walk_unit(addrs, &cu, abbrevs, fn)) < 0)
+			return r;
+	}
+	return 0;
+}
+
+static void
+funcs_count(unsigned tag, const struct Dwarf_Func *f)
+{
+	if (tag == DW_TAG_subprogram)
+		nfuncs++;
+}
+
+static void
+funcs_add(unsigned tag, const struct Dwarf_Func *f)
+{
+	struct Dwarf_Func *fp;
+
+	if (tag != DW_TAG_subprogram)
+		return;
+
+	// Insertion sort: functions mostly come in address order.
+	for (fp = funcs + nfuncs; fp > funcs && fp[-1].fn_low > f->fn_low; fp--)
+		fp[0] = fp[-1];
+	*fp = *f;
+	if (!fp->fn_name)
+		fp->fn_name = "<unknown>";
+	fp->fn_namelen = strlen(fp->fn_name);
+	nfuncs++;
+}
+
+// Build the function index of the unit 'ci' in the CU cache.
+static void
+funcs_build(const struct Dwarf_Addrs *addrs, struct Dwarf_Cuinfo *ci)
+{
+	uint64_t tsc = read_tsc();
+
+	ci->ci_funcs_tried = 1;
+	nfuncs = 0;
+	if (funcs_walk_unit(addrs, &ci->ci_cu, ci->ci_abbrevs, funcs_count) < 0
+	    || !(funcs = dwarf_cu_alloc(ci, nfuncs * sizeof(*funcs))))
+		return;
+	nfuncs = 0;
+	funcs_walk_unit(addrs, &ci->ci_cu, ci->ci_abbrevs, funcs_add);
+	ci->ci_funcs = funcs;
+	ci->ci_nfuncs = nfuncs;
+	dwarf_stats.dws_nfuncs += nfuncs;
+	dwarf_stats.dws_funcs_build += read_tsc() - tsc;
+}
+
+// Find the function containing address 'p' by binary search in the
+// function index of the unit at 'cu_offset' in .debug_info, building it
+// the first time.  Stores its name, the name's length and its start
+// address.  Returns -E_BAD_DWARF if no function covers 'p', or if the
+// index doesn't fit in the CU cache.
+int
+dwarf_func_lookup(const struct Dwarf_Addrs *addrs, Dwarf_Off cu_offset,
+		  uintptr_t p, const char **name, int *namelen, uintptr_t *addr)
+{
+	uint64_t tsc = read_tsc();
+	struct Dwarf_Cuinfo *ci;
+	const struct Dwarf_Func *fp;
+	int lo = 0, hi, mid, r;
+
+	if ((r = dwarf_cu_get(addrs, cu_offset, &ci)) < 0)
+		return r;
+	if (!ci->ci_funcs_tried)
+		funcs_build(addrs, ci);
+
+	// Find the last function that starts at or below p.
+	fp = ci->ci_funcs;
+	hi = fp ? ci->ci_nfuncs : 0;
+	while (lo < hi) {
+		mid = (lo + hi) / 2;
+		if (fp[mid].fn_low <= p)
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
+	r = -E_BAD_DWARF;
+	if (lo > 0 && p <= fp[lo - 1].fn_high) {
+		*name = fp[lo - 1].fn_name;
+		*namelen = fp[lo - 1].fn_namelen;
+		*addr = fp[lo - 1].fn_low;
+		r = 0;
+	}
+
+	dwarf_stats.dws_func_lookups++;
+	dwarf_stats.dws_func_cycles += read_tsc() - tsc;
+	return r;
+}
+
+// The inline index: the pieces of the functions inlined into a unit's
+// code (see struct Dwarf_Inline), sorted by address, each piece ahead of
+// the pieces inside it and linked to the piece it is inside.  Each unit in
+// the CU cache gets one, with the unit's file names after it.
+
+// The inline index being built
+static struct Dwarf_Inline *inlines;
+static int ninlines;
+static const char **fnames;
+static int nfnames;
+static char *fnames_next;	// where the next file name goes
+static size_t fnames_size;
+
+static void
+inlines_count(const struct Dwarf_Inline *in)
+{
+	ninlines++;
+}
+
+static void
+inlines_add(const struct Dwarf_Inline *in)
+{
+	struct Dwarf_Inline *ip;
+
+	// Insertion sort: pieces mostly come in address order, and a piece
+	// before the pieces inside it.
+	for (ip = inlines + ninlines; ip > inlines
+	     && (ip[-1].in_low > in->in_low || (ip[-1].in_low == in->in_low
+		 && ip[-1].in_depth > in->in_depth)); ip--)
+		ip[0] = ip[-1];
+	*ip = *in;
+	ninlines++;
+}
+
+static void
+fnames_count(unsigned index, const char *dir, const char *name)
+{
+	if (index >= nfnames)
+		nfnames = index + 1;
+	fnames_size += (dir ? strlen(dir) + 1 : 0) + strlen(name) + 1;
+}
+
+static void
+fnames_add(unsigned index, const char *dir, const char *name)
+{
+	fnames[index] = fnames_next;
+	if (dir) {
+		strcpy(fnames_next, dir);
+		fnames_next += strlen(dir);
+		*fnames_next++ = '/';
+	}
+	strcpy(fnames_next, name);
+	fnames_next += strlen(name) + 1;
+}
+
+// Build the inline index of the unit 'ci' in the CU cache.  A unit with
+// no inlined functions needs none.
+static void
+inlines_build(const struct Dwarf_Addrs *addrs, struct Dwarf_Cuinfo *ci)
+{
+	uint64_t tsc = read_tsc();
+	size_t size;
+	int i, j;
+
+	ci->ci_inlines_tried = 1;
+	ninlines = nfnames = 0;
+	fnames_size = 0;
+	if (dwarf_inlines_walk(addrs, &ci->ci_cu, ci->ci_abbrevs,
+			       inlines_count) < 0 || ninlines == 0)
+		return;
+	if (ci->ci_stmt_list == DWARF_NOLINES
+	    || dwarf_line_files(addrs, &ci->ci_cu, ci->ci_stmt_list,
+				fnames_count) < 0)
+		nfnames = fnames_size = 0;
+	size = ninlines * sizeof(*inlines) + nfnames * sizeof(*fnames)
+		+ fnames_size;
+	if (!(inlines = dwarf_cu_alloc(ci, size)))
+		return;
+	fnames = (const char **) (inlines + ninlines);
+	fnames_next = (char *) (fnames + nfnames);
+	memset(fnames, 0, nfnames * sizeof(*fnames));
+	if (nfnames)
+		dwarf_line_files(addrs, &ci->ci_cu, ci->ci_stmt_list,
+				 fnames_add);
+	ninlines = 0;
+	dwarf_inlines_walk(addrs, &ci->ci_cu, ci->ci_abbrevs, inlines_add);
+
+	// The piece a piece is inside is the nearest one before it that is
+	// less deep and hasn't ended, so it is on the chain of the piece
+	// just before it.
+	for (i = 0; i < ninlines; i++) {
+		for (j = i - 1; j >= 0
+		     && (inlines[j].in_high <= inlines[i].in_low
+			 || inlines[j].in_depth >= inlines[i].in_depth);
+		     j = inlines[j].in_parent)
+			/* do nothing */;
+		inlines[i].in_parent = j;
+	}
+
+	ci->ci_inlines = inlines;
+	ci->ci_ninlines = ninlines;
+	ci->ci_files = fnames;
+	ci->ci_nfiles = nfnames;
+	dwarf_stats.dws_ninlines += ninlines;
+	dwarf_stats.dws_inlines_build += read_tsc() - tsc;
+}
+
+// Find the functions inlined at address 'p' by binary search in the
+// inline index of the unit at 'cu_offset' in .debug_info, building it the
+// first time.  Copies their pieces containing 'p' to 'chain', innermost
+// first, up to 'n' of them, and returns how many it copied; the index
+// itself may be evicted by the next lookup in the CU cache.  A unit whose
+// index doesn't fit in the CU cache has no inlined functions, as far as
+// this goes.
+int
+dwarf_inline_lookup(const struct Dwarf_Addrs *addrs, Dwarf_Off cu_offset,
+		    uintptr_t p, struct Dwarf_Inline *chain, int n)
+{
+	uint64_t tsc = read_tsc();
+	struct Dwarf_Cuinfo *ci;
+	const struct Dwarf_Inline *ip;
+	int lo = 0, hi, mid, i, r;
+
+	if ((r = dwarf_cu_get(addrs, cu_offset, &ci)) < 0)
+		return r;
+	if (!ci->ci_inlines_tried)
+		inlines_build(addrs, ci);
+
+	// Find the last piece that starts at or below p; the innermost
+	// piece containing p is on its chain.
+	ip = ci->ci_inlines;
+	hi = ip ? ci->ci_ninlines : 0;
+	while (lo < hi) {
+		mid = (lo + hi) / 2;
+		if (ip[mid].in_low <= p)
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
+	for (i = lo - 1; i >= 0 && p >= ip[i].in_high; i = ip[i].in_parent)
+		/* do nothing */;
+	for (r = 0; i >= 0 && r < n; i = ip[i].in_parent)
+		chain[r++] = ip[i];
+
+	dwarf_stats.dws_inline_lookups++;
+	dwarf_stats.dws_inline_cycles += read_tsc() - tsc;
+	return r;
+}
+
+// Copy the name of the file 'index' of the unit at 'cu_offset', which the
+// pieces from dwarf_inline_lookup() number their files by, to 'buf' of
+// 'len' bytes.  Returns -E_NO_ENT if the unit's inline index has no such
+// file.
+int
+dwarf_inline_file(const struct Dwarf_Addrs *addrs, Dwarf_Off cu_offset,
+		  unsigned index, char *buf, size_t len)
+{
+	struct Dwarf_Cuinfo *ci;
+	int r;
+
+	if ((r = dwarf_cu_get(addrs, cu_offset, &ci)) < 0)
+		return r;
+	if (!ci->ci_inlines_tried)
+		inlines_build(addrs, ci);
+	if (index >= ci->ci_nfiles || !ci->ci_files[index])
+		return -E_NO_ENT;
+	strlcpy(buf, ci->ci_files[index], len);
+	return 0;
+}
+
+// The name table: function and label names hashed into an open-addressed
+// table, for looking up a name's address.
+struct Dwarf_Name {
+	uint32_t nm_hash;
+	uintptr_t nm_addr;
+	const char *nm_name;	// NULL in an empty slot
+};
+
+static struct Dwarf_Name *names;
+static uint32_t names_mask;
+static int nnames;
+static bool names_built;
+
+// FNV-1a
+static uint32_t
+name_hash(const char *s)
+{
+	uint32_t h = 2166136261U;
+
+	while (*s) {
+		h ^= (uint8_t) *s++;
+		h *= 16777619;
+	}
+	return h;
+}
+
+static void
+names_count(const char *name, uintptr_t addr)
+{
+	nnames++;
+}
+
+static void
+names_insert(const char *name, uintptr_t addr)
+{
+	uint32_t h = name_hash(name), i;
+
+	for (i = h & names_mask; names[i].nm_name; i = (i + 1) & names_mask)
+		// Static functions can share a name; the first one wins.
+		if (names[i].nm_hash == h && strcmp(names[i].nm_name, name) == 0)
+			return;
+	names[i].nm_hash = h;
+	names[i].nm_addr = addr;
+	names[i].nm_name = name;
+	nnames++;
+}
+
+// Call 'fn' for each function in .debug_pubnames.
+static int
+pubnames_walk(const struct Dwarf_Addrs *addrs,
+	      void (*fn)(const char *name, uintptr_t addr))
+{
+	const char *set = (const char *) addrs->pubnames_begin, *set_end;
+	const char *hdr, *die, *entry;
+	const struct Dwarf_Abbrevtab *abbrevs;
+	const struct Dwarf_Abbrev *ab;
+	struct Dwarf_CU cu;
+	struct Dwarf_Func f;
+	uint32_t cu_offset, die_offset;
+	unsigned long len;
+	unsigned code;
+	int count, r;
+
+	while ((const unsigned char *) set < addrs->pubnames_end) {
+		if ((count = dwarf_entry_len(set, &len)) == 0)
+			return -E_BAD_DWARF;
+		set += count;
+		set_end = set + len;
+		if (get_unaligned(set, Dwarf_Half) != 2)
+			return -E_BAD_DWARF;
+		set += sizeof(Dwarf_Half);
+		cu_offset = get_unaligned(set, uint32_t);
+		set += 2 * sizeof(uint32_t);	// and the CU's length
+
+		hdr = (const char *) addrs->info_begin + cu_offset;
+		if ((r = dwarf_read_cu_header(addrs, hdr, &cu)) < 0)
+			return r;
+		if (!(abbrevs = dwarf_abbrevs(addrs, cu.cu_abbrev_offset)))
+			return -E_BAD_DWARF;
+
+		while (set < set_end
+		       && (die_offset = get_unaligned(set, uint32_t)) != 0) {
+			set += sizeof(uint32_t);
+			die = hdr + die_offset;
+			entry = die + dwarf_read_uleb128(die, &code);
+			if (!(ab = dwarf_abbrev(abbrevs, code)))
+				return -E_BAD_DWARF;
+			// Variables are in here, too.
+			if ((ab->ab_tag == DW_TAG_subprogram
+			     || ab->ab_tag == DW_TAG_label)
+			    && (die_read(addrs, &cu, abbrevs, ab, entry, &f, NULL,
+					 &entry)
+				|| die_concrete(addrs, &cu, abbrevs, die,
+						&f.fn_low)))
+				fn(set, f.fn_low);
+			set += strlen(set) + 1;
+		}
+		set = set_end;
+	}
+	return 0;
+}
+
+static void
+names_count_die(unsigned tag, const struct Dwarf_Func *f)
+{
+	if (f->fn_name)
+		names_count(f->fn_name, f->fn_low);
+}
+
+static void
+names_insert_die(unsigned tag, const struct Dwarf_Func *f)
+{
+	if (f->fn_name)
+		names_insert(f->fn_name, f->fn_low);
+}
+
+static void
+names_build(const struct Dwarf_Addrs *addrs)
+{
+	uint64_t tsc = read_tsc();
+	bool pubnames = addrs->pubnames_begin < addrs->pubnames_end;
+	uint32_t size;
+	int r;
+
+	nnames = 0;
+	// Without .debug_pubnames, find the names in .debug_info.
+	if (pubnames)
+		r = pubnames_walk(addrs, names_count);
+	else
+		r = funcs_walk(addrs, names_count_die);
+	if (r < 0)
+		return;
+
+	// Keep the table at most half full.
+	for (size = 16; size < 2 * nnames; size *= 2)
+		/* do nothing */;
+	if (!(names = dwarf_alloc(size * sizeof(*names))))
+		return;
+	memset(names, 0, size * sizeof(*names));
+	names_mask = size - 1;
+
+	nnames = 0;
+	if (pubnames)
+		pubnames_walk(addrs, names_insert);
+	else
+		funcs_walk(addrs, names_insert_die);
+	dwarf_stats.dws_nnames = nnames;
+	dwarf_stats.dws_names_build = read_tsc() - tsc;
+}
+
+// A name index from .debug_names (DWARF 5): a hash table of names the
+// compiler built, which we look names up in where it lies.  The linker
+// concatenates the indexes of the units it links, unless it merges them.
+struct Dwarf_Nameidx {
+	const char *ni_cus;		// offsets of the CUs in .debug_info
+	uint32_t ni_ncus;
+	const char *ni_buckets;
+	uint32_t ni_nbuckets;		// 0 if there is no hash table
+	const char *ni_hashes;
+	const char *ni_strs;		// offsets of the names in .debug_str
+	const char *ni_entries;		// offsets of their entries in the pool
+	uint32_t ni_nnames;
+	const char *ni_abbrevs;
+	const char *ni_pool;
+	const char *ni_end;
+};
+
+static struct Dwarf_Nameidx *nameidxs;
+static int nnameidxs;
+
+// Parse the headers of the name indexes in .debug_names into 'ni', if it
+// is not NULL.  Returns how many there are, or -E_BAD_DWARF.
+static int
+nameidx_walk(const struct Dwarf_Addrs *addrs, struct Dwarf_Nameidx *ni)
+{
+	const char *set = (const char *) addrs->names_begin, *p, *end;
+	uint32_t ncus, nltus, nftus, nbuckets, nnames, abbrev_size, aug_size;
+	unsigned long len;
+	int count, n = 0;
+
+	for (; (const unsigned char *) set < addrs->names_end; set = end) {
+		if ((count = dwarf_entry_len(set, &len)) != sizeof(uint32_t))
+			return -E_BAD_DWARF;
+		p = set + count;
+		end = p + len;
+		if (get_unaligned(p, Dwarf_Half) != 5)
+			return -E_BAD_DWARF;
+		p += 2 * sizeof(Dwarf_Half);	// and padding
+		ncus = get_unaligned(p, uint32_t);
+		nltus = get_unaligned(p + 4, uint32_t);
+		nftus = get_unaligned(p + 8, uint32_t);
+		nbuckets = get_unaligned(p + 12, uint32_t);
+		nnames = get_unaligned(p + 16, uint32_t);
+		abbrev_size = get_unaligned(p + 20, uint32_t);
+		aug_size = get_unaligned(p + 24, uint32_t);
+		p += 28 + ROUNDUP(aug_size, 4);
+		if (ni) {
+			ni->ni_cus = p;
+			ni->ni_ncus = ncus;
+		}
+		p += 4 * (ncus + nltus) + 8 * nftus;
+		if (ni) {
+			ni->ni_buckets = p;
+			ni->ni_nbuckets = nbuckets;
+			ni->ni_hashes = p + 4 * nbuckets;
+		}
+		// Without buckets, there are no hashes either.
+		if (nbuckets)
+			p += 4 * (nbuckets + nnames);
+		if (ni) {
+			ni->ni_strs = p;
+			ni->ni_entries = p + 4 * nnames;
+			ni->ni_nnames = nnames;
+			ni->ni_abbrevs = p + 8 * nnames;
+			ni->ni_pool = p + 8 * nnames + abbrev_size;
+			ni->ni_end = end;
+			ni++;
+		}
+		p += 8 * nnames + abbrev_size;
+		if (p > end)
+			return -E_BAD_DWARF;
+		dwarf_stats.dws_nnames += nnames;
+		n++;
+	}
+	return n;
+}
+
+// The DJB hash .debug_names uses, of the name with ASCII case folded
+static uint32_t
+nameidx_hash(const char *s)
+{
+	uint32_t h = 5381;
+	unsigned char c;
+
+	for (; *s; s++) {
+		c = *s;
+		if (c >= 'A' && c <= 'Z')
+			c += 'a' - 'A';
+		h = h * 33 + c;
+	}
+	return h;
+}
+
+// Find the address of the first subprogram or label among the entries
+// of name number 'i' in 'ni'.  Returns -E_NO_ENT if none has one.
+static int
+nameidx_entries(const struct Dwarf_Addrs *addrs,
+		const struct Dwarf_Nameidx *ni, uint32_t i, uintptr_t *addr)
+{
+	const char *e = ni->ni_pool + get_unaligned(ni->ni_entries + 4 * i, uint32_t);
+	const char *a, *die, *entry;
+	const struct Dwarf_Abbrev *ab;
+	struct Dwarf_Cuinfo *ci;
+	struct Dwarf_Func f;
+	unsigned code, acode, tag, idx, form;
+	uint32_t val, cu_index, die_offset;
+	int value;
+
+	while (e < ni->ni_end) {
+		e += dwarf_read_uleb128(e, &code);
+		if (code == 0)
+			break;
+
+		// The abbreviation table is small: search it.
+		for (a = ni->ni_abbrevs; ; ) {
+			a += dwarf_read_uleb128(a, &acode);
+			if (acode == 0 || a >= ni->ni_pool)
+				return -E_BAD_DWARF;
+			a += dwarf_read_uleb128(a, &tag);
+			if (acode == code)
+				break;
+			do {
+				a += dwarf_read_uleb128(a, &idx);
+				a += dwarf_read_uleb128(a, &form);
+				if (form == DW_FORM_implicit_const)
+					a += dwarf_read_leb128(a, &value);
+			} while (idx != 0 || form != 0);
+		}
+
+		// A lone CU needs no index.  Offset 0 is a unit header, so
+		// never that of a DIE.
+		cu_index = die_offset = 0;
+		for (;;) {
+			a += dwarf_read_uleb128(a, &idx);
+			a += dwarf_read_uleb128(a, &form);
+			if (idx == 0 && form == 0)
+				break;
+			val = 0;
+			if (form == DW_FORM_implicit_const) {
+				a += dwarf_read_leb128(a, &value);
+				val = value;
+			} else
+				e += dwarf_read_abbrev_entry(e, form, &val, sizeof(val),
+							     sizeof(uint32_t));
+			if (idx == DW_IDX_compile_unit)
+				cu_index = val;
+			else if (idx == DW_IDX_die_offset)
+				die_offset = val;
+			else if (idx == DW_IDX_type_unit)
+				// Not in .debug_info's CUs
+				cu_index = ni->ni_ncus;
+		}
+
+		if ((tag != DW_TAG_subprogram && tag != DW_TAG_label)
+		    || die_offset == 0 || cu_index >= ni->ni_ncus)
+			continue;
+		if (dwarf_cu_get(addrs, get_unaligned(ni->ni_cus + 4 * cu_index,
+						      uint32_t), &ci) < 0)
+			return -E_BAD_DWARF;
+		die = ci->ci_cu.cu_hdr + die_offset;
+		entry = die + dwarf_read_uleb128(die, &code);
+		if (!(ab = dwarf_abbrev(ci->ci_abbrevs, code)))
+			return -E_BAD_DWARF;
+		// Declarations have no address; the definition has its own entry.
+		// An abstract instance has none either, but its out-of-line
+		// copy need not have an entry.
+		if (die_read(addrs, &ci->ci_cu, ci->ci_abbrevs, ab, entry, &f,
+			     NULL, &entry)) {
+			*addr = f.fn_low;
+			return 0;
+		}
+		if (tag == DW_TAG_subprogram
+		    && die_concrete(addrs, &ci->ci_cu, ci->ci_abbrevs, die, addr))
+			return 0;
+	}
+	return -E_NO_ENT;
+}
+
+// Look 'name' up in the hash table of 'ni'.
+static int
+nameidx_lookup(const struct Dwarf_Addrs *addrs,
+	       const struct Dwarf_Nameidx *ni, const char *name, uintptr_t *addr)
+{
+	uint32_t h, i, bucket, hi;
+	int r;
+
+	if (ni->ni_nbuckets == 0) {
+		for (i = 0; i < ni->ni_nnames; i++)
+			if (strcmp((const char *) addrs->str_begin
+				   + get_unaligned(ni->ni_strs + 4 * i, uint32_t),
+				   name) == 0
+			    && (r = nameidx_entries(addrs, ni, i, addr)) != -E_NO_ENT)
+				return r;
+		return -E_NO_ENT;
+	}
+
+	h = nameidx_hash(name);
+	bucket = h % ni->ni_nbuckets;
+	// Buckets hold the 1-based index of their first name; the names of a
+	// bucket are consecutive.
+	i = get_unaligned(ni->ni_buckets + 4 * bucket, uint32_t);
+	for (; i != 0 && i <= ni->ni_nnames; i++) {
+		hi = get_unaligned(ni->ni_hashes + 4 * (i - 1), uint32_t);
+		if (hi % ni->ni_nbuckets != bucket)
+			break;
+		if (hi == h
+		    && strcmp((const char *) addrs->str_begin
+			      + get_unaligned(ni->ni_strs + 4 * (i - 1), uint32_t),
+			      name) == 0
+		    && (r = nameidx_entries(addrs, ni, i - 1, addr)) != -E_NO_ENT)
+			return r;
+	}
+	return -E_NO_ENT;
+}
+
+static void
+nameidx_build(const struct Dwarf_Addrs *addrs)
+{
+	uint64_t tsc = read_tsc();
+	int n;
+
+	if ((n = nameidx_walk(addrs, NULL)) <= 0
+	    || !(nameidxs = dwarf_alloc(n * sizeof(*nameidxs))))
+		return;
+	dwarf_stats.dws_nnames = 0;
+	nameidx_walk(addrs, nameidxs);
+	nnameidxs = n;
+	dwarf_stats.dws_names_build = read_tsc() - tsc;
+}
+
+// Look up the address of the function or label 'name' in the name
+// table.  Returns -E_NO_ENT if there is no such name, and -E_BAD_DWARF if
+// the table could not be built.
+int
+dwarf_name_lookup(const struct Dwarf_Addrs *addrs, const char *name,
+		  uintptr_t *addr)
+{
+	uint64_t tsc = read_tsc();
+	uint32_t h = name_hash(name), i;
+	int r = -E_NO_ENT, j;
+
+	if (!names_built) {
+		names_built = 1;
+		// The compiler's own hash table needs no building.
+		if (addrs->names_begin < addrs->names_end
+		    && dwarf_need(DWARF_NAMES | DWARF_DIES) == 0)
+			nameidx_build(addrs);
+		if (!nameidxs && dwarf_need(DWARF_PUBNAMES | DWARF_DIES) == 0)
+			names_build(addrs);
+	}
+
+	if (nameidxs) {
+		for (j = 0; j < nnameidxs && r == -E_NO_ENT; j++)
+			r = nameidx_lookup(addrs, &nameidxs[j], name, addr);
+	} else if (!names)
+		return -E_BAD_DWARF;
+	else
+		for (i = h & names_mask; names[i].nm_name; i = (i + 1) & names_mask)
+			if (names[i].nm_hash == h
+			    && strcmp(names[i].nm_name, name) == 0) {
+				*addr = names[i].nm_addr;
+				r = 0;
+				break;
+			}
+
+	dwarf_stats.dws_name_lookups++;
+	dwarf_stats.dws_name_cycles += read_tsc() - tsc;
+	return r;
+}
@@ -0,0 +1,227 @@
+// Loading the debug sections on demand (CONFIG_DWARF_LAZY).
+//
+// The boot loader leaves the segments that hold the DWARF sections on
+// the disk.  At boot we only note where in the kernel image each section
+// is; the first lookup that needs a section reads it to the memory that
+// kern/kernel.ld set aside for it after 'end'.
+//
+// With CONFIG_DWARF_ZLIB, boot/lz4pack stores the sections as compressed
+// ELF sections: a Chdr followed by a zlib stream.  Their segments then
+// have no file contents (p_filesz is 0), and we inflate the stream into
+// place as we read it.
+
+#include <inc/assert.h>
+#include <inc/error.h>
+#include <inc/x86.h>
+#include <inc/elf.h>
+#include <inc/bootinfo.h>
+#include <inc/ide.h>
+#include <inc/dwarf.h>
+#include <inc/stdio.h>
+#include <inc/string.h>
+
+#ifdef CONFIG_DWARF_ZLIB
+#include <kern/inflate.h>
+#endif
+
+#define ELFHDR		((struct Elf *) 0x10000) // left by the boot loader
+
+struct Dwarfsect {
+	const char *ds_name;
+	const unsigned char *ds_begin;
+	uint32_t ds_offset;	// offset in the kernel image
+	uint32_t ds_size;	// bytes to read
+	uint32_t ds_memsz;	// room for it in memory
+	bool ds_ondisk;		// not read yet
+	bool ds_zlib;		// stored as a compressed section
+	bool ds_bad;		// could not be read
+};
+
+// Indexed by the bit number of the DWARF_* section flags.
+static struct Dwarfsect dwarf_sects[] = {
+	{ ".debug_aranges", __DEBUG_ARANGES_BEGIN__ },
+	{ ".debug_abbrev", __DEBUG_ABBREV_BEGIN__ },
+	{ ".debug_info", __DEBUG_INFO_BEGIN__ },
+	{ ".debug_line", __DEBUG_LINE_BEGIN__ },
+	{ ".debug_str", __DEBUG_STR_BEGIN__ },
+	{ ".debug_pubnames", __DEBUG_PUBNAMES_BEGIN__ },
+	{ ".debug_pubtypes", __DEBUG_PUBTYPES_BEGIN__ },
+	{ ".debug_line_str", __DEBUG_LINE_STR_BEGIN__ },
+	{ ".debug_str_offsets", __DEBUG_STR_OFFSETS_BEGIN__ },
+	{ ".debug_addr", __DEBUG_ADDR_BEGIN__ },
+	{ ".debug_names", __DEBUG_NAMES_BEGIN__ },
+	{ ".debug_ranges", __DEBUG_RANGES_BEGIN__ },
+	{ ".debug_rnglists", __DEBUG_RNGLISTS_BEGIN__ },
+};
+#define NDWARFSECT (sizeof(dwarf_sects)/sizeof(dwarf_sects[0]))
+
+// Bytes read off the disk, and bytes inflated from them.
+static uint32_t dwarf_nread, dwarf_ninflated;
+
+// Find the debug sections' segments in the program headers the boot
+// loader left behind.  Must run before anything overwrites them.
+void
+dwarf_lazy_init(void)
+{
+	struct Proghdr *ph, *eph;
+	struct Dwarfsect *ds;
+
+	// Any other boot loader has loaded all the segments.
+	if (BOOTINFO->bi_magic != BOOTINFO_MAGIC
+	    || !(BOOTINFO->bi_flags & BOOTINFO_DEBUG_ONDISK))
+		return;
+
+	assert(ELFHDR->e_magic == ELF_MAGIC);
+	ph = (struct Proghdr *) ((uint8_t *) ELFHDR + ELFHDR->e_phoff);
+	eph = ph + ELFHDR->e_phnum;
+	for (; ph < eph; ph++) {
+		if (ph->p_type != ELF_PROG_LOAD || ph->p_va != 0)
+			continue;
+		for (ds = dwarf_sects; ds < dwarf_sects + NDWARFSECT; ds++)
+			if (ph->p_pa == (uint32_t) ds->ds_begin)
+				break;
+		if (ds == dwarf_sects + NDWARFSECT)
+			continue;
+		assert(!(ph->p_flags & ELF_PROG_FLAG_LZ4));
+		ds->ds_offset = ph->p_offset;
+		ds->ds_size = ph->p_filesz;
+		ds->ds_memsz = ph->p_memsz;
+		ds->ds_zlib = ph->p_filesz == 0 && ph->p_memsz != 0;
+		// Otherwise we read straight to the section's place in memory.
+		assert(ds->ds_zlib || ph->p_offset % SECTSIZE == ph->p_pa % SECTSIZE);
+		ds->ds_ondisk = 1;
+	}
+}
+
+#ifdef CONFIG_DWARF_ZLIB
+// Compressed input goes through this buffer.
+#define ZBUFSECT	8
+static uint8_t zbuf[ZBUFSECT * SECTSIZE];
+
+struct Zread {
+	uint32_t zr_secno;	// next sector to read
+	uint32_t zr_nsect;	// sectors left that the stream may span
+	const uint8_t *zr_pending; // input already in zbuf
+	int zr_npending;
+};
+
+static int
+zread_fill(void *arg, const uint8_t **buf)
+{
+	struct Zread *zr = arg;
+	uint32_t n;
+
+	if (zr->zr_npending) {
+		*buf = zr->zr_pending;
+		n = zr->zr_npending;
+		zr->zr_npending = 0;
+		return n;
+	}
+	if ((n = MIN(zr->zr_nsect, ZBUFSECT)) == 0)
+		return 0;
+	ide_read(zr->zr_secno, zbuf, n);
+	zr->zr_secno += n;
+	zr->zr_nsect -= n;
+	dwarf_nread += n * SECTSIZE;
+	*buf = zbuf;
+	return n * SECTSIZE;
+}
+
+// Inflate a compressed section into place.  Returns -E_BAD_DWARF if the
+// header or the stream is bad.
+static int
+zread_section(struct Dwarfsect *ds)
+{
+	struct Zread zr;
+	struct Chdr ch;
+	const uint8_t *buf;
+	uint32_t skip = ds->ds_offset % SECTSIZE;
+	int n;
+
+	// Deflate grows data that won't compress by a few bytes per block,
+	// which bounds how far the stream can run.
+	zr.zr_secno = BOOTINFO->bi_kernsect + ds->ds_offset / SECTSIZE;
+	zr.zr_nsect = ROUNDUP(skip + sizeof(ch) + 64 + ds->ds_memsz
+			      + ds->ds_memsz / 1024, SECTSIZE) / SECTSIZE;
+	zr.zr_npending = 0;
+
+	// lz4pack starts the section on a sector, so the Chdr is in the
+	// first buffer.
+	n = zread_fill(&zr, &buf);
+	memcpy(&ch, buf + skip, sizeof(ch));
+	if (ch.ch_type != ELF_COMPRESS_ZLIB || ch.ch_size > ds->ds_memsz) {
+		warn("%s: bad compression header", ds->ds_name);
+		return -E_BAD_DWARF;
+	}
+	zr.zr_pending = buf + skip + sizeof(ch);
+	zr.zr_npending = n - skip - sizeof(ch);
+
+	n = inflate_zlib((void *) ds->ds_begin, ch.ch_size, zread_fill, &zr);
+	if (n != ch.ch_size) {
+		warn("%s: corrupt compressed section", ds->ds_name);
+		return -E_BAD_DWARF;
+	}
+	dwarf_ninflated += n;
+	return 0;
+}
+#else
+// lz4pack only stores sections compressed with CONFIG_DWARF_ZLIB.
+static int
+zread_section(struct Dwarfsect *ds)
+{
+	warn("%s: compressed, but the kernel can't inflate", ds->ds_name);
+	return -E_BAD_DWARF;
+}
+#endif
+
+// Report how many bytes of debug sections were read off the disk, and how
+// many bytes they inflated to.
+void
+dwarf_lazy_stats(uint32_t *nread, uint32_t *ninflated)
+{
+	*nread = dwarf_nread;
+	*ninflated = dwarf_ninflated;
+}
+
+// Make sure the sections in 'sects', a set of DWARF_* flags, are in
+// memory.  Returns -E_BAD_DWARF if one of them could not be read, in
+// which case what is in its place in memory is not DWARF.
+int
+dwarf_need(int sects)
+{
+	struct Dwarfsect *ds;
+	uint32_t pa, nsect;
+	int i, r = 0;
+
+	for (i = 0; i < NDWARFSECT; i++) {
+		ds = &dwarf_sects[i];
+		if (!(sects & (1 << i)))
+			continue;
+		if (ds->ds_bad)
+			r = -E_BAD_DWARF;
+		if (!ds->ds_ondisk)
+			continue;
+		ds->ds_ondisk = 0;
+		if (ds->ds_zlib) {
+			if (zread_section(ds) < 0) {
+				ds->ds_size = 0;
+				ds->ds_bad = 1;
+				r = -E_BAD_DWARF;
+				continue;
+			}
+		} else {
+			// kernel.ld starts each section on a new page, so
+			// reading whole sectors doesn't clobber the section
+			// before it, nor the one after it.
+			pa = ROUNDDOWN((uint32_t) ds->ds_begin, SECTSIZE);
+			nsect = ROUNDUP((uint32_t) ds->ds_begin + ds->ds_size - pa,
+					SECTSIZE) / SECTSIZE;
+			ide_read(BOOTINFO->bi_kernsect + ds->ds_offset / SECTSIZE,
+				 (void *) pa, nsect);
+			dwarf_nread += nsect * SECTSIZE;
+		}
+		dwarf_generation++;
+		boot_event(BOOTEV_DEBUGSECT, (uint32_t) ds->ds_begin, read_tsc());
+	}
+	return r;
+}
@@ -2,6 +2,7 @@
 #include <inc/dwarf.h>
 #include <inc/error.h>
 #include <inc/types.h>
+#include <inc/x86.h>
 
 // Line Number machine state. Some registers, considered in standard, are
 // omitted:
@@ -28,18 +29,30 @@ struct Line_Number_Info {
         Dwarf_Small line_range;
         Dwarf_Small opcode_base;
         Dwarf_Small *standard_opcode_lengths;
+        Dwarf_Half version;
+        const void *file_tables; // include directories and file names
 };
 
-// Execute the Line Number Program, starting at `program_addr` and ending at
-// `end_addr`. Stop when next row of line number table corresponds to address
-// which is greater than `destination_addr`. Last raw, which corresponds to
-// address less or equal `destination_addr`, will be the raw we look for.
-inline static void run_line_number_program(const void *program_addr,
+// Called for each row the Line Number Program emits.  Returns nonzero to
+// stop the program.
+typedef int (*line_row_fn)(void *arg, const struct Line_Number_State *row);
+
+// Execute one sequence of the Line Number Program, starting at
+// `program_addr` and ending at `end_addr` at the latest, and call `row_fn`
+// for each row of the line number table. Returns the address after the
+// last opcode run: after the DW_LNE_end_sequence, or after the row for
+// which `row_fn` returned nonzero.
+static const void *run_line_number_program(const void *program_addr,
                                            const void *end_addr,
                                            const struct Line_Number_Info *info,
-                                           struct Line_Number_State *state,
-                                           uintptr_t destination_addr) {
-        struct Line_Number_State last_state;
+                                           line_row_fn row_fn, void *arg) {
+        struct Line_Number_State state = {
+            .address = 0,
+            .line = 1,
+            .column = 0,
+            .end_sequence = false,
+            .discriminator = 0,
+        };
         while (program_addr < end_addr) {
                 Dwarf_Small opcode = get_unaligned(program_addr, Dwarf_Small);
                 program_addr += sizeof(Dwarf_Small);
@@ -55,23 +68,14 @@ inline static void run_line_number_program(const void *program_addr,
 
                         switch (opcode) {
                         case DW_LNE_end_sequence:
-                                state->end_sequence = true;
-                                if (last_state.address <= destination_addr &&
-                                    destination_addr < state->address) {
-                                        *state = last_state;
-                                        return;
-                                }
-                                last_state = *state;
-                                state->address = 0;
-                                state->line = 1;
-                                state->column = 0;
-                                state->end_sequence = false;
-                                state->discriminator = 0;
-                                break;
+                                state.end_sequence = true;
+                                row_fn(arg, &state);
+                                assert(program_addr == opcode_end);
+                                return program_addr;
                         case DW_LNE_set_address: {
                                 uint32_t addr =
                                     get_unaligned(program_addr, uint32_t);
-                                state->address = addr;
+                                state.address = addr;
                                 program_addr += sizeof(uint32_t);
                         } break;
                         case DW_LNE_define_file: {
@@ -99,7 +103,7 @@ inline static void run_line_number_program(const void *program_addr,
                                 unsigned discriminator;
                                 unsigned long count = dwarf_read_uleb128(
                                     program_addr, &discriminator);
-                                state->discriminator = discriminator;
+                                state.discriminator = discriminator;
                                 program_addr += count;
                         } break;
                         default:
@@ -111,19 +115,16 @@ inline static void run_line_number_program(const void *program_addr,
                         // We have a standard opcode.
                         switch (opcode) {
                         case DW_LNS_copy:
-                                if (last_state.address <= destination_addr &&
-                                    destination_addr < state->address) {
-                                        *state = last_state;
-                                        return;
+                                if (row_fn(arg, &state)) {
+                                        return program_addr;
                                 }
-                                last_state = *state;
-                                state->discriminator = 0;
+                                state.discriminator = 0;
                                 break;
                         case DW_LNS_advance_pc: {
                                 unsigned op_advance;
                                 unsigned long count = dwarf_read_uleb128(
                                     program_addr, &op_advance);
-                                state->address +=
+                                state.address +=
                                     info->minimum_instruction_length *
                                     (op_advance /
                                      info->maximum_operations_per_instruction);
@@ -133,7 +134,7 @@ inline static void run_line_number_program(const void *program_addr,
                                 int line_incr;
                                 unsigned long count =
                                     dwarf_read_leb128(program_addr, &line_incr);
-                                state->line += line_incr;
+                                state.line += line_incr;
                                 program_addr += count;
                         } break;
                         case DW_LNS_set_file: {
@@ -146,7 +147,7 @@ inline static void run_line_number_program(const void *program_addr,
                                 unsigned column;
                                 unsigned long count =
                                     dwarf_read_uleb128(program_addr, &column);
-                                state->column = column;
+                                state.column = column;
                                 program_addr += count;
                         } break;
                         case DW_LNS_negate_stmt:
@@ -163,7 +164,7 @@ inline static void run_line_number_program(const void *program_addr,
                                     opcode - info->opcode_base;
                                 int op_advance =
                                     adjusted_opcode / info->line_range;
-                                state->address +=
+                                state.address +=
                                     info->minimum_instruction_length *
                                     (op_advance /
                                      info->maximum_operations_per_instruction);
@@ -171,7 +172,7 @@ inline static void run_line_number_program(const void *program_addr,
                         case DW_LNS_fixed_advance_pc: {
                                 Dwarf_Half pc_inc =
                                     get_unaligned(program_addr, Dwarf_Half);
-                                state->address += pc_inc;
+                                state.address += pc_inc;
                                 program_addr += sizeof(Dwarf_Half);
                         } break;
                         case DW_LNS_set_prologue_end:
@@ -197,46 +198,34 @@ inline static void run_line_number_program(const void *program_addr,
                         Dwarf_Small adjusted_opcode =
                             opcode - info->opcode_base;
                         int op_advance = adjusted_opcode / info->line_range;
-                        state->line += (info->line_base +
-                                        (adjusted_opcode % info->line_range));
-                        state->address +=
+                        state.line += (info->line_base +
+                                       (adjusted_opcode % info->line_range));
+                        state.address +=
                             info->minimum_instruction_length *
                             (op_advance /
                              info->maximum_operations_per_instruction);
-                        state->discriminator = 0;
-                        if (last_state.address <= destination_addr &&
-                            destination_addr < state->address) {
-                                *state = last_state;
-                                return;
+                        if (row_fn(arg, &state)) {
+                                return program_addr;
                         }
-                        last_state = *state;
+                        state.discriminator = 0;
                 }
         }
+        return program_addr;
 }
 
-// Get line number, corresponding to address `p` and store it to `lineno_store`.
-// `addrs` should contain addresses of .debug_* sections and line_offset should
-// contain an offset in .debug_line of entry associated with compilation unit,
-// in which we search address `p`. This offset can be obtained from .debug_info
-// section, using the `file_name_by_info` function.
-int line_for_address(const struct Dwarf_Addrs *addrs, uintptr_t p,
-                     Dwarf_Off line_offset, int *lineno_store) {
-        if (line_offset > addrs->line_begin - addrs->line_end) {
-                return -E_INVAL;
-        }
-        if (lineno_store == NULL) {
+// Parse the Line Number Program Header at `line_offset` in .debug_line.
+// Stores the parameters of the program to `info`, and where the program
+// starts and ends.
+static int line_program_header(const struct Dwarf_Addrs *addrs,
+                               Dwarf_Off line_offset,
+                               struct Line_Number_Info *info,
+                               const void **program_store,
+                               const void **end_store) {
+        if (line_offset >= addrs->line_end - addrs->line_begin) {
                 return -E_INVAL;
         }
         const void *curr_addr = addrs->line_begin + line_offset;
-        struct Line_Number_State current_state = {
-            .address = 0,
-            .line = 1,
-            .column = 0,
-            .end_sequence = false,
-            .discriminator = 0,
-        };
 
-        // Parse Line Number Program Header.
         unsigned long unit_length;
         int count = dwarf_entry_len(curr_addr, &unit_length);
         if (count == 0) {
@@ -244,10 +233,16 @@ int line_for_address(const struct Dwarf_Addrs *addrs, uintptr_t p,
         } else {
                 curr_addr += count;
         }
-        const void *unit_end = curr_addr + unit_length;
+        *end_store = curr_addr + unit_length;
         Dwarf_Half version = get_unaligned(curr_addr, Dwarf_Half);
         curr_addr += sizeof(Dwarf_Half);
-        assert(version == 4 || version == 3 || version == 2);
+        assert(version >= 2 && version <= 5);
+        if (version == 5) {
+                // Skip address_size and segment_selector_size. The
+                // directory and file name tables after the fields below
+                // have a new format, too.
+                curr_addr += 2 * sizeof(Dwarf_Small);
+        }
         unsigned long header_length;
         count = dwarf_entry_len(curr_addr, &header_length);
         if (count == 0) {
@@ -255,13 +250,13 @@ int line_for_address(const struct Dwarf_Addrs *addrs, uintptr_t p,
         } else {
                 curr_addr += count;
         }
-        const void *program_addr = curr_addr + header_length;
+        *program_store = curr_addr + header_length;
         Dwarf_Small minimum_instruction_length =
             get_unaligned(curr_addr, Dwarf_Small);
         assert(minimum_instruction_length == 1);
         curr_addr += sizeof(Dwarf_Small);
         Dwarf_Small maximum_operations_per_instruction;
-        if (version == 4) {
+        if (version >= 4) {
                 maximum_operations_per_instruction =
                     get_unaligned(curr_addr, Dwarf_Small);
                 curr_addr += sizeof(Dwarf_Small);
@@ -279,22 +274,547 @@ int line_for_address(const struct Dwarf_Addrs *addrs, uintptr_t p,
         curr_addr += sizeof(Dwarf_Small);
         Dwarf_Small *standard_opcode_lengths =
             (Dwarf_Small *)get_unaligned(curr_addr, Dwarf_Small *);
-        // Skip rest of the header, as we don't need include directories and
-        // file_names and run line number program.
-        struct Line_Number_Info info = {
-            .minimum_instruction_length = minimum_instruction_length,
-            .maximum_operations_per_instruction =
-                maximum_operations_per_instruction,
-            .line_base = line_base,
-            .line_range = line_range,
-            .opcode_base = opcode_base,
-            .standard_opcode_lengths = standard_opcode_lengths,
+        // The program doesn't need the include directories and file names;
+        // dwarf_line_files reads them.
+        info->version = version;
+        info->file_tables = curr_addr + (opcode_base - 1);
+        info->minimum_instruction_length = minimum_instruction_length;
+        info->maximum_operations_per_instruction =
+            maximum_operations_per_instruction;
+        info->line_base = line_base;
+        info->line_range = line_range;
+        info->opcode_base = opcode_base;
+        info->standard_opcode_lengths = standard_opcode_lengths;
+        return 0;
+}
+
+// Searching the rows as the program emits them: the row we look for is
+// the last one at or below `destination_addr`, which we know once the
+// next row is past it.
+struct Line_Search {
+        uintptr_t destination_addr;
+        struct Line_Number_State last_state;
+        bool found;
+};
+
+static int line_search_row(void *arg, const struct Line_Number_State *row) {
+        struct Line_Search *search = arg;
+        if (search->last_state.address <= search->destination_addr &&
+            search->destination_addr < row->address) {
+                search->found = true;
+                return 1;
+        }
+        search->last_state = *row;
+        return 0;
+}
+
+// The decoded line number table of one compilation unit: its rows,
+// sorted by address. Every DWARF_LINE_STRIDE'th row is kept whole in
+// `anchors`, which a lookup binary-searches; the rows between anchors are
+// stored as ULEB128 address and SLEB128 line deltas from the row before.
+// A row with line 0 ends a sequence, and covers the addresses up to the
+// next sequence.
+#define DWARF_LINE_STRIDE 16
+
+struct Line_Anchor {
+        uint32_t address;
+        int32_t line;
+        uint32_t deltas; // offset in `rows` of the deltas that follow
+};
+
+// A unit's decoded table, kept by the CU cache: the header, then the
+// anchors, then the rows.
+struct Line_Table {
+        int nrows;
+        struct Line_Anchor *anchors;
+        unsigned char *rows;
+};
+
+// A sequence of the program, to be decoded in address order.
+struct Line_Sequence {
+        uint32_t address; // of its first row
+        const void *program_addr;
+};
+
+// The most sequences in a unit we decode: gcc emits one per text section.
+#define DWARF_LINE_MAXSEQ 32
+
+static int line_skip_row(void *arg, const struct Line_Number_State *row) {
+        return 0;
+}
+
+static int line_sequence_start(void *arg,
+                               const struct Line_Number_State *row) {
+        *(uint32_t *)arg = row->address;
+        return 1;
+}
+
+// Encoding rows, or just measuring how much room they take when `rows`
+// is NULL.
+struct Line_Encoder {
+        struct Line_Anchor *anchors;
+        unsigned char *rows;
+        uint32_t size;
+        int nrows;
+        uint32_t address;
+        int line;
+};
+
+static int put_uleb128(unsigned char *p, uint32_t val) {
+        int count = 0;
+        do {
+                unsigned char byte = val & 0x7f;
+                val >>= 7;
+                if (val) {
+                        byte |= 0x80;
+                }
+                if (p) {
+                        p[count] = byte;
+                }
+                count++;
+        } while (val);
+        return count;
+}
+
+static int put_sleb128(unsigned char *p, int32_t val) {
+        int count = 0;
+        bool more;
+        do {
+                unsigned char byte = val & 0x7f;
+                val >>= 7;
+                more = !((val == 0 && !(byte & 0x40)) ||
+                         (val == -1 && (byte & 0x40)));
+                if (more) {
+                        byte |= 0x80;
+                }
+                if (p) {
+                        p[count] = byte;
+                }
+                count++;
+        } while (more);
+        return count;
+}
+
+static int line_encode_row(void *arg, const struct Line_Number_State *row) {
+        struct Line_Encoder *enc = arg;
+        int line = row->end_sequence ? 0 : row->line;
+        if (enc->nrows % DWARF_LINE_STRIDE == 0) {
+                if (enc->rows) {
+                        struct Line_Anchor *anchor =
+                            &enc->anchors[enc->nrows / DWARF_LINE_STRIDE];
+                        anchor->address = row->address;
+                        anchor->line = line;
+                        anchor->deltas = enc->size;
+                }
+        } else {
+                unsigned char *p = enc->rows ? enc->rows + enc->size : NULL;
+                enc->size +=
+                    put_uleb128(p, row->address - enc->address);
+                p = enc->rows ? enc->rows + enc->size : NULL;
+                enc->size += put_sleb128(p, line - enc->line);
+        }
+        enc->address = row->address;
+        enc->line = line;
+        enc->nrows++;
+        return 0;
+}
+
+// Decode the line number table of the program at `line_offset`, that of
+// the unit `ci`, or return NULL if it has too many sequences or doesn't
+// fit in the CU cache.
+static struct Line_Table *line_table_build(const struct Dwarf_Addrs *addrs,
+                                           Dwarf_Off line_offset,
+                                           struct Dwarf_Cuinfo *ci) {
+        uint64_t tsc = read_tsc();
+        struct Line_Number_Info info;
+        const void *program_addr, *end_addr;
+        struct Line_Sequence seqs[DWARF_LINE_MAXSEQ], seq;
+        int nseqs = 0, i, j;
+
+        if (line_program_header(addrs, line_offset, &info, &program_addr,
+                                &end_addr) < 0) {
+                return NULL;
+        }
+
+        // Find the sequences and sort them by address.
+        while (program_addr < end_addr) {
+                if (nseqs == DWARF_LINE_MAXSEQ) {
+                        return NULL;
+                }
+                seq.program_addr = program_addr;
+                seq.address = 0;
+                run_line_number_program(program_addr, end_addr, &info,
+                                        line_sequence_start, &seq.address);
+                for (j = nseqs; j > 0 && seqs[j - 1].address > seq.address;
+                     j--) {
+                        seqs[j] = seqs[j - 1];
+                }
+                seqs[j] = seq;
+                nseqs++;
+                // Run the whole sequence to find the next one.
+                program_addr = run_line_number_program(
+                    program_addr, end_addr, &info, line_skip_row, NULL);
+        }
+
+        // Measure the table, then fill it in.
+        struct Line_Encoder enc = {0};
+        for (i = 0; i < nseqs; i++) {
+                run_line_number_program(seqs[i].program_addr, end_addr, &info,
+                                        line_encode_row, &enc);
+        }
+        uint32_t nanchors =
+            (enc.nrows + DWARF_LINE_STRIDE - 1) / DWARF_LINE_STRIDE;
+        uint32_t size = sizeof(struct Line_Table) +
+                        nanchors * sizeof(struct Line_Anchor) + enc.size;
+        struct Line_Table *table = dwarf_cu_alloc(ci, size + 1);
+        if (!table) {
+                return NULL;
+        }
+        enc.anchors = (struct Line_Anchor *)(table + 1);
+        enc.rows = (unsigned char *)(enc.anchors + nanchors);
+        table->nrows = enc.nrows;
+        table->anchors = enc.anchors;
+        table->rows = enc.rows;
+        enc.size = enc.nrows = 0;
+        for (i = 0; i < nseqs; i++) {
+                run_line_number_program(seqs[i].program_addr, end_addr, &info,
+                                        line_encode_row, &enc);
+        }
+
+        dwarf_stats.dws_nlinetabs++;
+        dwarf_stats.dws_linetabs_size += size;
+        dwarf_stats.dws_lines_build += read_tsc() - tsc;
+        return table;
+}
+
+// Find the line of address `p` in `table`. Returns -E_BAD_DWARF if no row
+// covers it.
+static int line_table_lookup(const struct Line_Table *table, uintptr_t p,
+                             int *lineno_store) {
+        int lo = 0, hi = (table->nrows + DWARF_LINE_STRIDE - 1) /
+                         DWARF_LINE_STRIDE;
+        // Find the last anchor at or below `p`.
+        while (lo < hi) {
+                int mid = (lo + hi) / 2;
+                if (table->anchors[mid].address <= p) {
+                        lo = mid + 1;
+                } else {
+                        hi = mid;
+                }
+        }
+        if (lo == 0) {
+                return -E_BAD_DWARF;
+        }
+        const struct Line_Anchor *anchor = &table->anchors[lo - 1];
+        uint32_t address = anchor->address;
+        int line = anchor->line;
+        // Then the last row of its group at or below `p`.
+        const char *deltas = (const char *)table->rows + anchor->deltas;
+        int row = (lo - 1) * DWARF_LINE_STRIDE + 1;
+        int end = MIN(row - 1 + DWARF_LINE_STRIDE, table->nrows);
+        for (; row < end; row++) {
+                unsigned address_incr;
+                int line_incr;
+                deltas += dwarf_read_uleb128(deltas, &address_incr);
+                deltas += dwarf_read_leb128(deltas, &line_incr);
+                if (address + address_incr > p) {
+                        break;
+                }
+                address += address_incr;
+                line += line_incr;
+        }
+        if (line == 0) {
+                return -E_BAD_DWARF;
+        }
+        *lineno_store = line;
+        return 0;
+}
+
+// The decoded table of the program at `line_offset`, decoding it if this
+// is the first lookup in the unit. NULL if it doesn't fit, or the unit
+// is not in the CU cache.
+static struct Line_Table *line_table_get(const struct Dwarf_Addrs *addrs,
+                                         Dwarf_Off line_offset) {
+        struct Dwarf_Cuinfo *ci = dwarf_cu_by_lines(line_offset);
+        if (!ci) {
+                return NULL;
+        }
+        if (!ci->ci_lines_tried) {
+                ci->ci_lines_tried = true;
+                ci->ci_lines = line_table_build(addrs, line_offset, ci);
+        }
+        return ci->ci_lines;
+}
+
+// Get line number, corresponding to address `p` and store it to `lineno_store`.
+// `addrs` should contain addresses of .debug_* sections and line_offset should
+// contain an offset in .debug_line of entry associated with compilation unit,
+// in which we search address `p`. This offset can be obtained from .debug_info
+// section, using the `file_name_by_info` function.
+//
+// The first lookup in a unit decodes its whole line number table into the
+// CU cache, so the lookups after it are a binary search. If the table
+// doesn't fit, we run the unit's program up to `p` instead.
+int line_for_address(const struct Dwarf_Addrs *addrs, uintptr_t p,
+                     Dwarf_Off line_offset, int *lineno_store) {
+        int code = dwarf_need(DWARF_LINE);
+        if (code < 0) {
+                return code;
+        }
+        if (lineno_store == NULL) {
+                return -E_INVAL;
+        }
+        uint64_t tsc = read_tsc();
+
+        struct Line_Table *table = line_table_get(addrs, line_offset);
+        if (table) {
+                code = line_table_lookup(table, p, lineno_store);
+                dwarf_stats.dws_line_lookups++;
+                dwarf_stats.dws_line_cycles += read_tsc() - tsc;
+                return code;
+        }
+
+        struct Line_Number_Info info;
+        const void *program_addr, *end_addr;
+        code = line_program_header(addrs, line_offset, &info, &program_addr,
+                                   &end_addr);
+        if (code < 0) {
+                return code;
+        }
+        struct Line_Search search = {
+            .destination_addr = p,
         };
+        while (program_addr < end_addr && !search.found) {
+                program_addr = run_line_number_program(
+                    program_addr, end_addr, &info, line_search_row, &search);
+        }
 
-        run_line_number_program(program_addr, unit_end, &info, &current_state,
-                                p);
+        *lineno_store = search.last_state.line;
 
-        *lineno_store = current_state.line;
+        return 0;
+}
 
+// Get the line numbers of the `n` addresses in `ps`, which must be sorted,
+// and store them to `linenos`; an address no row covers gets line 0.
+// Unlike `n` calls to line_for_address, this walks the unit's table once,
+// front to back, jumping over the groups of rows no address falls in.
+int lines_for_addresses(const struct Dwarf_Addrs *addrs,
+                        Dwarf_Off line_offset, const uintptr_t *ps, int n,
+                        int *linenos) {
+        if (linenos == NULL) {
+                return -E_INVAL;
+        }
+        if (dwarf_need(DWARF_LINE) < 0) {
+                int i;
+                for (i = 0; i < n; i++) {
+                        linenos[i] = 0;
+                }
+                return -E_BAD_DWARF;
+        }
+        uint64_t tsc = read_tsc();
+        int i;
+
+        struct Line_Table *table = line_table_get(addrs, line_offset);
+        if (!table) {
+                for (i = 0; i < n; i++) {
+                        linenos[i] = 0;
+                        line_for_address(addrs, ps[i], line_offset,
+                                         &linenos[i]);
+                }
+                return 0;
+        }
+
+        // The row at or below the current address, -1 before the first.
+        int row = -1, line = 0;
+        uint32_t address = 0;
+        const char *deltas = NULL;
+        int nanchors = (table->nrows + DWARF_LINE_STRIDE - 1) /
+                       DWARF_LINE_STRIDE;
+        for (i = 0; i < n; i++) {
+                // Jump ahead to the last anchor at or below the address,
+                // if it is past the current row.
+                int lo = row < 0 ? 0 : row / DWARF_LINE_STRIDE + 1;
+                int hi = nanchors;
+                while (lo < hi) {
+                        int mid = (lo + hi) / 2;
+                        if (table->anchors[mid].address <= ps[i]) {
+                                lo = mid + 1;
+                        } else {
+                                hi = mid;
+                        }
+                }
+                if (lo > 0 && (lo - 1) * DWARF_LINE_STRIDE > row) {
+                        const struct Line_Anchor *anchor =
+                            &table->anchors[lo - 1];
+                        row = (lo - 1) * DWARF_LINE_STRIDE;
+                        address = anchor->address;
+                        line = anchor->line;
+                        deltas = (const char *)table->rows + anchor->deltas;
+                }
+                while (row + 1 < table->nrows) {
+                        uint32_t next_address;
+                        int next_line;
+                        const char *next_deltas = deltas;
+                        if ((row + 1) % DWARF_LINE_STRIDE == 0) {
+                                const struct Line_Anchor *anchor =
+                                    &table->anchors[(row + 1) /
+                                                    DWARF_LINE_STRIDE];
+                                next_address = anchor->address;
+                                next_line = anchor->line;
+                                next_deltas = (const char *)table->rows +
+                                              anchor->deltas;
+                        } else {
+                                unsigned address_incr;
+                                int line_incr;
+                                next_deltas += dwarf_read_uleb128(
+                                    next_deltas, &address_incr);
+                                next_deltas +=
+                                    dwarf_read_leb128(next_deltas, &line_incr);
+                                next_address = address + address_incr;
+                                next_line = line + line_incr;
+                        }
+                        if (next_address > ps[i]) {
+                                break;
+                        }
+                        row++;
+                        address = next_address;
+                        line = next_line;
+                        deltas = next_deltas;
+                }
+                linenos[i] = row < 0 ? 0 : line;
+        }
+        dwarf_stats.dws_line_lookups += n;
+        dwarf_stats.dws_line_cycles += read_tsc() - tsc;
         return 0;
 }
+
+// Read the entry at `p` of a DWARF 5 directory or file name table whose
+// entries have the `nformat` (content type, form) pairs at `format`, and
+// store its path and directory index.  Returns the size of the entry.
+static int line_file_entry(const struct Dwarf_Addrs *addrs,
+                           const struct Dwarf_CU *cu, const char *p,
+                           const char *format, int nformat,
+                           const char **path, unsigned *dir) {
+        const char *start = p;
+        int i;
+        for (i = 0; i < nformat; i++) {
+                unsigned type = 0, form = 0;
+                format += dwarf_read_uleb128(format, &type);
+                format += dwarf_read_uleb128(format, &form);
+                if (type == DW_LNCT_path) {
+                        *path = dwarf_read_string(addrs, cu, form, p);
+                } else if (type == DW_LNCT_directory_index) {
+                        *dir = 0;
+                        dwarf_read_abbrev_entry(p, form, dir, sizeof(*dir),
+                                                cu->cu_address_size);
+                }
+                p += dwarf_read_abbrev_entry(p, form, NULL, 0,
+                                             cu->cu_address_size);
+        }
+        return p - start;
+}
+
+// The directory `dir` as a prefix for the file name `name`: NULL if it is
+// the compilation directory, which names are relative to anyway, or if
+// the name is absolute.
+static const char *line_file_dir(const char *dir, const char *name) {
+        if (name[0] == '/') {
+                return NULL;
+        }
+        while (dir && dir[0] == '.' && dir[1] == '/') {
+                dir += 2;
+        }
+        if (!dir || !dir[0] || !strcmp(dir, ".")) {
+                return NULL;
+        }
+        return dir;
+}
+
+// Call `fn` with the number, directory and name of each file in the file
+// name table of the line program at `line_offset`, the one of the unit
+// `cu`.  The directory is NULL for a file in the compilation directory.
+// Files count from 1 before DWARF 5, from 0 since.  Returns one more than
+// the highest number, or an error.
+int dwarf_line_files(const struct Dwarf_Addrs *addrs,
+                     const struct Dwarf_CU *cu, Dwarf_Off line_offset,
+                     void (*fn)(unsigned index, const char *dir,
+                                const char *name)) {
+        struct Line_Number_Info info;
+        const void *program_addr, *end_addr;
+        int code = line_program_header(addrs, line_offset, &info,
+                                       &program_addr, &end_addr);
+        if (code < 0) {
+                return code;
+        }
+        const char *p = info.file_tables;
+        const char *end = program_addr;
+        unsigned index = 0;
+
+        if (info.version < 5) {
+                // Strings up to an empty one, in both tables; each file
+                // name is followed by its directory's number, its time
+                // and its size.
+                const char *dirs = p;
+                while (p < end && *p) {
+                        p += strlen(p) + 1;
+                }
+                for (p++; p < end && *p;) {
+                        const char *name = p, *dir = NULL;
+                        unsigned dir_index = 0, skip;
+                        p += strlen(p) + 1;
+                        p += dwarf_read_uleb128(p, &dir_index);
+                        p += dwarf_read_uleb128(p, &skip);
+                        p += dwarf_read_uleb128(p, &skip);
+                        if (dir_index > 0) {
+                                dir = dirs;
+                                while (--dir_index > 0 && *dir) {
+                                        dir += strlen(dir) + 1;
+                                }
+                        }
+                        fn(++index, line_file_dir(dir, name), name);
+                }
+                return index + 1;
+        }
+
+        // Each table has the format of its entries first, then their
+        // number, then the entries.
+        int ndir_format = *p++;
+        const char *dir_format = p;
+        unsigned skip, ndirs = 0, nfiles = 0;
+        int i;
+        for (i = 0; i < 2 * ndir_format; i++) {
+                p += dwarf_read_uleb128(p, &skip);
+        }
+        p += dwarf_read_uleb128(p, &ndirs);
+        const char *dirs = p;
+        for (i = 0; i < ndirs && p < end; i++) {
+                const char *path = NULL;
+                p += line_file_entry(addrs, cu, p, dir_format, ndir_format,
+                                     &path, &skip);
+        }
+        int nfile_format = *p++;
+        const char *file_format = p;
+        for (i = 0; i < 2 * nfile_format; i++) {
+                p += dwarf_read_uleb128(p, &skip);
+        }
+        p += dwarf_read_uleb128(p, &nfiles);
+        for (index = 0; index < nfiles && p < end; index++) {
+                const char *name = NULL, *dir = NULL;
+                unsigned dir_index = 0;
+                p += line_file_entry(addrs, cu, p, file_format, nfile_format,
+                                     &name, &dir_index);
+                // Directory 0 is the compilation directory.
+                if (dir_index > 0 && dir_index < ndirs) {
+                        const char *q = dirs;
+                        for (i = 0; i <= dir_index; i++) {
+                                q += line_file_entry(addrs, cu, q,
+                                                     dir_format, ndir_format,
+                                                     &dir, &skip);
+                        }
+                }
+                if (name) {
+                        fn(index, line_file_dir(dir, name), name);
+                }
+        }
+        return index;
+}
@@ -0,0 +1,353 @@
+// Decompressor for zlib streams (RFC 1950) holding deflate data (RFC 1951).
+//
+// The input is pulled in chunks through a fill function, so the caller
+// can stream it off the disk through a small fixed buffer.  The output
+// goes to one flat buffer that holds the whole result, which therefore
+// doubles as the 32KB history window that back references point into.
+//
+// Huffman codes are decoded a bit at a time in the manner of zlib's
+// puff.c: slower than table lookups, but small and easy to check.
+
+#include <inc/error.h>
+#include <kern/inflate.h>
+
+#define MAXBITS		15	// longest code
+#define MAXLCODES	286	// literal/length codes
+#define MAXDCODES	30	// distance codes
+#define MAXCODES	(MAXLCODES + MAXDCODES)
+#define FIXLCODES	288	// literal/length codes in the fixed code
+
+struct Inflate {
+	const uint8_t *in, *inend;	// current input chunk
+	inflate_fill_t fill;
+	void *arg;
+	bool eof;			// ran out of input
+
+	uint32_t bitbuf;		// bits not used yet
+	int bitcnt;
+
+	uint8_t *out;
+	size_t outlen, outpos;
+};
+
+// A canonical Huffman code: how many codes there are of each length,
+// and the symbols ordered by code.
+struct Huffman {
+	int16_t *count;
+	int16_t *symbol;
+};
+
+// Once the input runs out this returns zeros and sets s->eof, which
+// the callers check at the end of each block; none of the loops in
+// between can run forever on zeros.
+static int
+getbyte(struct Inflate *s)
+{
+	int n;
+
+	if (s->in == s->inend) {
+		if (s->eof || (n = s->fill(s->arg, &s->in)) <= 0) {
+			s->eof = 1;
+			return 0;
+		}
+		s->inend = s->in + n;
+	}
+	return *s->in++;
+}
+
+static int
+bits(struct Inflate *s, int need)
+{
+	uint32_t val = s->bitbuf;
+
+	while (s->bitcnt < need) {
+		val |= (uint32_t) getbyte(s) << s->bitcnt;
+		s->bitcnt += 8;
+	}
+	s->bitbuf = val >> need;
+	s->bitcnt -= need;
+	return val & ((1U << need) - 1);
+}
+
+static int
+stored(struct Inflate *s)
+{
+	unsigned len, nlen;
+
+	// skip to a byte boundary
+	s->bitbuf = 0;
+	s->bitcnt = 0;
+
+	len = getbyte(s);
+	len |= getbyte(s) << 8;
+	nlen = getbyte(s);
+	nlen |= getbyte(s) << 8;
+	if (len != (~nlen & 0xFFFF) || len > s->outlen - s->outpos)
+		return -1;
+	while (len-- > 0)
+		s->out[s->outpos++] = getbyte(s);
+	return 0;
+}
+
+static int
+decode(struct Inflate *s, const struct Huffman *h)
+{
+	int len, code = 0, first = 0, index = 0, count;
+
+	for (len = 1; len <= MAXBITS; len++) {
+		code |= bits(s, 1);
+		count = h->count[len];
+		if (code - count < first)
+			return h->symbol[index + (code - first)];
+		index += count;
+		first += count;
+		first <<= 1;
+		code <<= 1;
+	}
+	return -1;		// ran out of codes
+}
+
+// Build h from the code lengths of n symbols.  Returns 0 for a complete
+// code, > 0 for an incomplete one and < 0 for an over-subscribed one.
+static int
+construct(struct Huffman *h, const int16_t *length, int n)
+{
+	int16_t offs[MAXBITS + 1];
+	int symbol, len, left;
+
+	for (len = 0; len <= MAXBITS; len++)
+		h->count[len] = 0;
+	for (symbol = 0; symbol < n; symbol++)
+		h->count[length[symbol]]++;
+	if (h->count[0] == n)
+		return 0;
+
+	left = 1;
+	for (len = 1; len <= MAXBITS; len++) {
+		left <<= 1;
+		left -= h->count[len];
+		if (left < 0)
+			return left;
+	}
+
+	offs[1] = 0;
+	for (len = 1; len < MAXBITS; len++)
+		offs[len + 1] = offs[len] + h->count[len];
+	for (symbol = 0; symbol < n; symbol++)
+		if (length[symbol] != 0)
+			h->symbol[offs[length[symbol]]++] = symbol;
+	return left;
+}
+
+static const int16_t lbase[29] = {
+	3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31,
+	35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258 };
+static const int16_t lext[29] = {
+	0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2,
+	3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0 };
+static const int16_t dbase[30] = {
+	1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193,
+	257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145,
+	8193, 12289, 16385, 24577 };
+static const int16_t dext[30] = {
+	0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6,
+	7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13 };
+
+// Decode literals and length/distance pairs up to the end of the block.
+static int
+codes(struct Inflate *s, const struct Huffman *lencode,
+      const struct Huffman *distcode)
+{
+	int symbol, len;
+	size_t dist;
+
+	do {
+		symbol = decode(s, lencode);
+		if (symbol < 0 || s->eof)
+			return -1;
+		if (symbol < 256) {
+			if (s->outpos == s->outlen)
+				return -1;
+			s->out[s->outpos++] = symbol;
+		} else if (symbol > 256) {
+			symbol -= 257;
+			if (symbol >= 29)
+				return -1;
+			len = lbase[symbol] + bits(s, lext[symbol]);
+
+			symbol = decode(s, distcode);
+			if (symbol < 0 || symbol >= 30)
+				return -1;
+			dist = dbase[symbol] + bits(s, dext[symbol]);
+			if (dist > s->outpos || len > s->outlen - s->outpos)
+				return -1;
+
+			for (; len > 0; len--, s->outpos++)
+				s->out[s->outpos] = s->out[s->outpos - dist];
+		}
+	} while (symbol != 256);
+	return 0;
+}
+
+static int
+fixed(struct Inflate *s)
+{
+	static bool built;
+	static int16_t lencnt[MAXBITS + 1], lensym[FIXLCODES];
+	static int16_t distcnt[MAXBITS + 1], distsym[MAXDCODES];
+	static struct Huffman lencode = { lencnt, lensym };
+	static struct Huffman distcode = { distcnt, distsym };
+	int16_t lengths[FIXLCODES];
+	int symbol;
+
+	if (!built) {
+		for (symbol = 0; symbol < 144; symbol++)
+			lengths[symbol] = 8;
+		for (; symbol < 256; symbol++)
+			lengths[symbol] = 9;
+		for (; symbol < 280; symbol++)
+			lengths[symbol] = 7;
+		for (; symbol < FIXLCODES; symbol++)
+			lengths[symbol] = 8;
+		construct(&lencode, lengths, FIXLCODES);
+
+		for (symbol = 0; symbol < MAXDCODES; symbol++)
+			lengths[symbol] = 5;
+		construct(&distcode, lengths, MAXDCODES);
+		built = 1;
+	}
+	return codes(s, &lencode, &distcode);
+}
+
+static int
+dynamic(struct Inflate *s)
+{
+	static const int16_t order[19] = {
+		16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15 };
+	int16_t lengths[MAXCODES];
+	int16_t lencnt[MAXBITS + 1], lensym[MAXLCODES];
+	int16_t distcnt[MAXBITS + 1], distsym[MAXDCODES];
+	struct Huffman lencode = { lencnt, lensym };
+	struct Huffman distcode = { distcnt, distsym };
+	int nlen, ndist, ncode, index, symbol, len, err;
+
+	nlen = bits(s, 5) + 257;
+	ndist = bits(s, 5) + 1;
+	ncode = bits(s, 4) + 4;
+	if (nlen > MAXLCODES || ndist > MAXDCODES)
+		return -1;
+
+	// the code lengths code, which must be complete
+	for (index = 0; index < ncode; index++)
+		lengths[order[index]] = bits(s, 3);
+	for (; index < 19; index++)
+		lengths[order[index]] = 0;
+	if (construct(&lencode, lengths, 19) != 0)
+		return -1;
+
+	// the literal/length and distance code lengths
+	for (index = 0; index < nlen + ndist; ) {
+		symbol = decode(s, &lencode);
+		if (symbol < 0 || s->eof)
+			return -1;
+		if (symbol < 16) {
+			lengths[index++] = symbol;
+			continue;
+		}
+		len = 0;
+		if (symbol == 16) {
+			if (index == 0)
+				return -1;
+			len = lengths[index - 1];
+			symbol = 3 + bits(s, 2);
+		} else if (symbol == 17)
+			symbol = 3 + bits(s, 3);
+		else
+			symbol = 11 + bits(s, 7);
+		if (index + symbol > nlen + ndist)
+			return -1;
+		while (symbol-- > 0)
+			lengths[index++] = len;
+	}
+	if (lengths[256] == 0)
+		return -1;
+
+	// Incomplete codes are only allowed if they have a single code.
+	err = construct(&lencode, lengths, nlen);
+	if (err && (err < 0 || nlen != lencode.count[0] + lencode.count[1]))
+		return -1;
+	err = construct(&distcode, lengths + nlen, ndist);
+	if (err && (err < 0 || ndist != distcode.count[0] + distcode.count[1]))
+		return -1;
+
+	return codes(s, &lencode, &distcode);
+}
+
+static uint32_t
+adler32(const uint8_t *p, size_t n)
+{
+	uint32_t a = 1, b = 0;
+	size_t chunk;
+
+	while (n > 0) {
+		// 5552 is the most bytes before b can overflow
+		chunk = n < 5552 ? n : 5552;
+		n -= chunk;
+		while (chunk-- > 0) {
+			a += *p++;
+			b += a;
+		}
+		a %= 65521;
+		b %= 65521;
+	}
+	return (b << 16) | a;
+}
+
+// Inflate the zlib stream supplied by 'fill' into 'dst', which holds
+// 'dstlen' bytes.  Returns the number of bytes inflated, or -E_INVAL if
+// the stream is corrupt, truncated or does not fit.
+int
+inflate_zlib(void *dst, size_t dstlen, inflate_fill_t fill, void *arg)
+{
+	struct Inflate s = {
+		.fill = fill,
+		.arg = arg,
+		.out = dst,
+		.outlen = dstlen,
+	};
+	int cmf, flg, last, type, err;
+	uint32_t adler;
+
+	// deflate with at most a 32KB window, no preset dictionary
+	cmf = getbyte(&s);
+	flg = getbyte(&s);
+	if ((cmf & 0x0F) != 8 || (cmf >> 4) > 7 || ((cmf << 8) | flg) % 31
+	    || (flg & 0x20))
+		return -E_INVAL;
+
+	do {
+		last = bits(&s, 1);
+		type = bits(&s, 2);
+		if (type == 0)
+			err = stored(&s);
+		else if (type == 1)
+			err = fixed(&s);
+		else if (type == 2)
+			err = dynamic(&s);
+		else
+			err = -1;
+		if (err < 0 || s.eof)
+			return -E_INVAL;
+	} while (!last);
+
+	// The checksum follows in the next whole bytes, big-endian.
+	s.bitbuf = 0;
+	s.bitcnt = 0;
+	adler = getbyte(&s) << 24;
+	adler |= getbyte(&s) << 16;
+	adler |= getbyte(&s) << 8;
+	adler |= getbyte(&s);
+	if (s.eof || adler != adler32(dst, s.outpos))
+		return -E_INVAL;
+	return s.outpos;
+}
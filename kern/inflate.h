@@ -0,0 +1,15 @@
+#ifndef JOS_KERN_INFLATE_H
+#define JOS_KERN_INFLATE_H
+#ifndef JOS_KERNEL
+# error "This is a JOS kernel header; user programs should not #include it"
+#endif
+
+#include <inc/types.h>
+
+// Supplies the next chunk of compressed input: sets *buf and returns its
+// length, or returns 0 at the end of the input.
+typedef int (*inflate_fill_t)(void *arg, const uint8_t **buf);
+
+int inflate_zlib(void *dst, size_t dstlen, inflate_fill_t fill, void *arg);
+
+#endif	// !JOS_KERN_INFLATE_H
@@ -6,6 +6,60 @@
 
 #include <kern/kdebug.h>
 
+// Backtraces look up the same return addresses over and over, so keep
+// the last results in a small set-associative cache.
+#define EIPCACHE_SETS	64
+#define EIPCACHE_WAYS	4
+
+struct Eipcache_entry {
+	uintptr_t ec_eip;
+	uint32_t ec_generation;		// of dwarf_generation; 0 if unused
+	int ec_code;
+	struct Eipdebuginfo ec_info;
+};
+
+static struct Eipcache_entry eipcache[EIPCACHE_SETS][EIPCACHE_WAYS];
+static uint8_t eipcache_victim[EIPCACHE_SETS];	// round-robin replacement
+
+static int debuginfo_eip_lookup(uintptr_t addr, struct Eipdebuginfo *info);
+
+static unsigned
+eipcache_set(uintptr_t addr)
+{
+	// Return addresses are at least a few bytes apart.
+	return ((addr >> 2) ^ (addr >> 8)) % EIPCACHE_SETS;
+}
+
+// The cached entry for 'addr', or NULL if there is none.
+static struct Eipcache_entry *
+eipcache_find(uintptr_t addr)
+{
+	unsigned s = eipcache_set(addr);
+	struct Eipcache_entry *ec;
+
+	for (ec = eipcache[s]; ec < eipcache[s] + EIPCACHE_WAYS; ec++)
+		if (ec->ec_eip == addr && ec->ec_generation == dwarf_generation) {
+			dwarf_stats.dws_eip_hits++;
+			return ec;
+		}
+	dwarf_stats.dws_eip_misses++;
+	return NULL;
+}
+
+static void
+eipcache_insert(uintptr_t addr, int code, const struct Eipdebuginfo *info)
+{
+	unsigned s = eipcache_set(addr);
+	struct Eipcache_entry *ec;
+
+	ec = &eipcache[s][eipcache_victim[s]++ % EIPCACHE_WAYS];
+	// The lookup may have loaded sections, so take the generation after.
+	ec->ec_eip = addr;
+	ec->ec_generation = dwarf_generation;
+	ec->ec_code = code;
+	ec->ec_info = *info;
+}
+
 // debuginfo_eip(addr, info)
 //
 //	Fill in the 'info' structure with information about the specified
@@ -16,7 +70,84 @@
 int
 debuginfo_eip(uintptr_t addr, struct Eipdebuginfo *info)
 {
-	// Initialize *info
+	struct Eipcache_entry *ec;
+	int code;
+
+	if ((ec = eipcache_find(addr)) != NULL) {
+		*info = ec->ec_info;
+		return ec->ec_code;
+	}
+	code = debuginfo_eip_lookup(addr, info);
+	eipcache_insert(addr, code, info);
+	return code;
+}
+
+// Where the kernel's own debug sections are.
+void
+load_kernel_dwarf_info(struct Dwarf_Addrs *addrs)
+{
+	addrs->abbrev_begin = __DEBUG_ABBREV_BEGIN__;
+	addrs->abbrev_end = __DEBUG_ABBREV_END__;
+	addrs->aranges_begin = __DEBUG_ARANGES_BEGIN__;
+	addrs->aranges_end = __DEBUG_ARANGES_END__;
+	addrs->info_begin = __DEBUG_INFO_BEGIN__;
+	addrs->info_end = __DEBUG_INFO_END__;
+	addrs->line_begin = __DEBUG_LINE_BEGIN__;
+	addrs->line_end = __DEBUG_LINE_END__;
+	addrs->str_begin = __DEBUG_STR_BEGIN__;
+	addrs->str_end = __DEBUG_STR_END__;
+	addrs->pubnames_begin = __DEBUG_PUBNAMES_BEGIN__;
+	addrs->pubnames_end = __DEBUG_PUBNAMES_END__;
+	addrs->pubtypes_begin = __DEBUG_PUBTYPES_BEGIN__;
+	addrs->pubtypes_end = __DEBUG_PUBTYPES_END__;
+	addrs->line_str_begin = __DEBUG_LINE_STR_BEGIN__;
+	addrs->line_str_end = __DEBUG_LINE_STR_END__;
+	addrs->str_offsets_begin = __DEBUG_STR_OFFSETS_BEGIN__;
+	addrs->str_offsets_end = __DEBUG_STR_OFFSETS_END__;
+	addrs->addr_begin = __DEBUG_ADDR_BEGIN__;
+	addrs->addr_end = __DEBUG_ADDR_END__;
+	addrs->names_begin = __DEBUG_NAMES_BEGIN__;
+	addrs->names_end = __DEBUG_NAMES_END__;
+	addrs->ranges_begin = __DEBUG_RANGES_BEGIN__;
+	addrs->ranges_end = __DEBUG_RANGES_END__;
+	addrs->rnglists_begin = __DEBUG_RNGLISTS_BEGIN__;
+	addrs->rnglists_end = __DEBUG_RNGLISTS_END__;
+}
+
+// The name of the debug section that starts at 'begin', for the boot
+// timeline.
+const char *
+debug_section_name(uintptr_t begin)
+{
+	static const struct {
+		const char *name;
+		const unsigned char *begin;
+	} sects[] = {
+		{ ".debug_aranges", __DEBUG_ARANGES_BEGIN__ },
+		{ ".debug_abbrev", __DEBUG_ABBREV_BEGIN__ },
+		{ ".debug_info", __DEBUG_INFO_BEGIN__ },
+		{ ".debug_line", __DEBUG_LINE_BEGIN__ },
+		{ ".debug_str", __DEBUG_STR_BEGIN__ },
+		{ ".debug_pubnames", __DEBUG_PUBNAMES_BEGIN__ },
+		{ ".debug_pubtypes", __DEBUG_PUBTYPES_BEGIN__ },
+		{ ".debug_line_str", __DEBUG_LINE_STR_BEGIN__ },
+		{ ".debug_str_offsets", __DEBUG_STR_OFFSETS_BEGIN__ },
+		{ ".debug_addr", __DEBUG_ADDR_BEGIN__ },
+		{ ".debug_names", __DEBUG_NAMES_BEGIN__ },
+		{ ".debug_ranges", __DEBUG_RANGES_BEGIN__ },
+		{ ".debug_rnglists", __DEBUG_RNGLISTS_BEGIN__ },
+	};
+	int i;
+
+	for (i = 0; i < sizeof(sects) / sizeof(sects[0]); i++)
+		if ((uintptr_t) sects[i].begin == begin)
+			return sects[i].name;
+	return "debug section";
+}
+
+static void
+debuginfo_eip_init(uintptr_t addr, struct Eipdebuginfo *info)
+{
 	info->eip_file = "<unknown>";
 	info->eip_line = 0;
 	info->eip_fn_name = "<unknown>";
@@ -24,28 +155,41 @@ debuginfo_eip(uintptr_t addr, struct Eipdebuginfo *info)
 	info->eip_fn_addr = addr;
 	info->eip_fn_narg = 0;
 
-	struct Dwarf_Addrs addrs;
-	if (addr >= ULIM) {
+	if (addr >= ULIM)
 		panic("Can't search for user-level addresses yet!");
-	} else {
-		addrs.abbrev_begin = __DEBUG_ABBREV_BEGIN__;
-		addrs.abbrev_end = __DEBUG_ABBREV_END__;
-		addrs.aranges_begin = __DEBUG_ARANGES_BEGIN__;
-		addrs.aranges_end = __DEBUG_ARANGES_END__;
-		addrs.info_begin = __DEBUG_INFO_BEGIN__;
-		addrs.info_end = __DEBUG_INFO_END__;
-		addrs.line_begin = __DEBUG_LINE_BEGIN__;
-		addrs.line_end = __DEBUG_LINE_END__;
-		addrs.str_begin = __DEBUG_STR_BEGIN__;
-		addrs.str_end = __DEBUG_STR_END__;
-		addrs.pubnames_begin = __DEBUG_PUBNAMES_BEGIN__;
-		addrs.pubnames_end = __DEBUG_PUBNAMES_END__;
-		addrs.pubtypes_begin = __DEBUG_PUBTYPES_BEGIN__;
-		addrs.pubtypes_end = __DEBUG_PUBTYPES_END__;
+}
+
+// Fill in the function of 'addr', in the unit at 'offset' in .debug_info.
+static int
+debuginfo_eip_function(const struct Dwarf_Addrs *addrs, uintptr_t addr,
+		       Dwarf_Off offset, struct Eipdebuginfo *info)
+{
+	// The unit's function index knows the name's length, too.
+	int code = dwarf_func_lookup(addrs, offset, addr, &info->eip_fn_name,
+				     &info->eip_fn_namelen, &info->eip_fn_addr);
+	if (code == 0)
+		return 0;
+	void *buf = &info->eip_fn_name;
+	code = function_by_info(addrs, addr, offset, buf, sizeof(char *), &info->eip_fn_addr);
+	info->eip_fn_namelen = strlen(info->eip_fn_name);
+	if (code < 0) {
+		return code;
 	}
-	enum {
-	      BUFSIZE = 20,
-	};
+	return 0;
+}
+
+static int
+debuginfo_eip_lookup(uintptr_t addr, struct Eipdebuginfo *info)
+{
+	// Initialize *info
+	debuginfo_eip_init(addr, info);
+
+	// The debug table has it all, without reading the debug sections.
+	if (dbgtab_present())
+		return dbgtab_debuginfo(addr, info);
+
+	struct Dwarf_Addrs addrs;
+	load_kernel_dwarf_info(&addrs);
 	Dwarf_Off offset = 0, line_offset = 0;
 	int code = info_by_address(&addrs, addr, &offset);
 	if (code < 0) {
@@ -60,14 +204,192 @@ debuginfo_eip(uintptr_t addr, struct Eipdebuginfo *info)
 	// Find line number corresponding to given address.
 	// Hint: note that we need the address of `call` instruction, but eip holds
 	// address of the next instruction, so we should substract 5 from it.
-	// Hint: use line_for_address from kern/dwarf_lines.c
-	// Your code here:
+	// Without a line, the function is still worth looking up.
+	line_for_address(&addrs, addr - 5, line_offset, &info->eip_line);
 
-	buf = &info->eip_fn_name;
-	code = function_by_info(&addrs, addr, offset, buf, sizeof(char *), &info->eip_fn_addr);
-	info->eip_fn_namelen = strlen(info->eip_fn_name);
-	if (code < 0) {
-		return code;
+	return debuginfo_eip_function(&addrs, addr, offset, info);
+}
+
+// How many addresses debuginfo_eip_batch sorts at a time.
+#define EIPBATCH	32
+
+// Look up eips[order[0]], ..., eips[order[n - 1]], which are in
+// increasing order, in the DWARF sections: into out[order[i]], with the
+// return value in codes[i].
+static void
+debuginfo_eip_sorted(const uintptr_t *eips, const int *order, int n,
+		     struct Eipdebuginfo *out, int *codes)
+{
+	struct Dwarf_Addrs addrs;
+	Dwarf_Off offsets[EIPBATCH], line_offset = 0;
+	uintptr_t ps[EIPBATCH];
+	int lines[EIPBATCH];
+	int i, j, k;
+
+	load_kernel_dwarf_info(&addrs);
+	for (k = 0; k < n; k++) {
+		offsets[k] = 0;
+		codes[k] = info_by_address(&addrs, eips[order[k]], &offsets[k]);
 	}
-	return 0;
+
+	// Then go through them a unit at a time.
+	for (k = 0; k < n; k = j) {
+		for (j = k + 1; j < n && codes[j] == codes[k]
+		     && (codes[k] < 0 || offsets[j] == offsets[k]); j++)
+			/* do nothing */;
+		if (codes[k] == 0) {
+			const char *file;
+
+			codes[k] = file_name_by_info(&addrs, offsets[k],
+						     (void *) &file,
+						     sizeof(char *),
+						     &line_offset);
+			for (i = k; i < j; i++) {
+				ps[i] = eips[order[i]] - 5;
+				codes[i] = codes[k];
+				if (codes[k] == 0)
+					out[order[i]].eip_file = file;
+			}
+		}
+		if (codes[k] < 0)
+			continue;
+		lines_for_addresses(&addrs, line_offset, ps + k, j - k,
+				    lines + k);
+		for (i = k; i < j; i++) {
+			out[order[i]].eip_line = lines[i];
+			codes[i] = debuginfo_eip_function(&addrs, eips[order[i]],
+							  offsets[i],
+							  &out[order[i]]);
+		}
+	}
+}
+
+// debuginfo_eip_batch(eips, n, out)
+//
+//	Fill in out[i] for each of the 'n' instruction addresses in eips[],
+//	as debuginfo_eip(eips[i], &out[i]) would.  The addresses it hasn't
+//	cached are sorted, so that with a debug table, one pass over it
+//	finds them all, and without, each unit's name is read and its line
+//	table walked once for all the addresses in it.  Returns the number
+//	of addresses information was found for.
+//
+int
+debuginfo_eip_batch(const uintptr_t *eips, int n, struct Eipdebuginfo *out)
+{
+	struct Eipcache_entry *ec;
+	int order[EIPBATCH], codes[EIPBATCH];
+	int base, i, j, k, m, nfound = 0;
+
+	for (base = 0; base < n; base += EIPBATCH) {
+		// Sort the misses by address.
+		for (i = base, m = 0; i < n && i < base + EIPBATCH; i++) {
+			if ((ec = eipcache_find(eips[i])) != NULL) {
+				out[i] = ec->ec_info;
+				nfound += ec->ec_code == 0;
+				continue;
+			}
+			debuginfo_eip_init(eips[i], &out[i]);
+			for (j = m; j > 0 && eips[order[j - 1]] > eips[i]; j--)
+				order[j] = order[j - 1];
+			order[j] = i;
+			m++;
+		}
+
+		if (dbgtab_present())
+			dbgtab_debuginfo_batch(eips, order, m, out, codes);
+		else
+			debuginfo_eip_sorted(eips, order, m, out, codes);
+
+		for (k = 0; k < m; k++) {
+			// A recursion has the same return address many times.
+			if (k > 0 && eips[order[k]] == eips[order[k - 1]]) {
+				nfound += codes[k] == 0;
+				continue;
+			}
+			eipcache_insert(eips[order[k]], codes[k],
+					&out[order[k]]);
+			nfound += codes[k] == 0;
+		}
+	}
+	return nfound;
+}
+
+// Where debuginfo_eip_inline() copies its frames' file names to, out of
+// the CU cache.
+#define INLINE_FILE_LEN	64
+static char inline_files[DWARF_MAXINLINE + 1][INLINE_FILE_LEN];
+
+// The file 'index' of the unit at 'offset', for frame 'i'.
+static const char *
+inline_file(const struct Dwarf_Addrs *addrs, Dwarf_Off offset,
+	    unsigned index, int i)
+{
+	if (dwarf_inline_file(addrs, offset, index, inline_files[i],
+			      INLINE_FILE_LEN) < 0)
+		return "<unknown>";
+	return inline_files[i];
+}
+
+// debuginfo_eip_inline(addr, info, frames, nframes)
+//
+//	Expand the function in 'info', which debuginfo_eip(addr, info)
+//	filled in, into the frames of the functions inlined at 'addr',
+//	innermost first, followed by the frame of the function itself.
+//	The innermost function is at info's line; each of the others is
+//	where it inlined the one before it.  Stores up to 'nframes'
+//	frames and returns how many, which is at least 1 if 'nframes'
+//	is.  The file names are good until the next call.
+//
+int
+debuginfo_eip_inline(uintptr_t addr, const struct Eipdebuginfo *info,
+		     struct Eipinline *frames, int nframes)
+{
+	struct Dwarf_Inline chain[DWARF_MAXINLINE];
+	struct Dwarf_Addrs addrs;
+	Dwarf_Off offset = 0;
+	int i, n = 0;
+
+	if (nframes <= 0)
+		return 0;
+	// The debug table has the inlined functions, too.
+	if (dbgtab_present())
+		return dbgtab_debuginfo_inline(addr, info, frames, nframes);
+	load_kernel_dwarf_info(&addrs);
+	// The call instruction, as for the line, which a noreturn call at
+	// the end of a unit has in a different unit from 'addr'
+	if (info_by_address(&addrs, addr - 5, &offset) == 0)
+		n = dwarf_inline_lookup(&addrs, offset, addr - 5, chain,
+					MIN(nframes - 1, DWARF_MAXINLINE));
+	if (n < 0)
+		n = 0;
+
+	for (i = 0; i < n; i++) {
+		frames[i].ei_fn_name = chain[i].in_name;
+		frames[i].ei_fn_namelen = chain[i].in_namelen;
+		if (!chain[i].in_name) {
+			frames[i].ei_fn_name = "<unknown>";
+			frames[i].ei_fn_namelen = 9;
+		}
+		if (i == 0) {
+			frames[i].ei_file = inline_file(&addrs, offset,
+							chain[i].in_decl_file, i);
+			frames[i].ei_line = info->eip_line;
+		} else {
+			frames[i].ei_file = inline_file(&addrs, offset,
+							chain[i - 1].in_call_file,
+							i);
+			frames[i].ei_line = chain[i - 1].in_call_line;
+		}
+	}
+	frames[n].ei_fn_name = info->eip_fn_name;
+	frames[n].ei_fn_namelen = info->eip_fn_namelen;
+	if (n > 0) {
+		frames[n].ei_file = inline_file(&addrs, offset,
+						chain[n - 1].in_call_file, n);
+		frames[n].ei_line = chain[n - 1].in_call_line;
+	} else {
+		frames[n].ei_file = info->eip_file;
+		frames[n].ei_line = info->eip_line;
+	}
+	return n + 1;
 }
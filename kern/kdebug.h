@@ -15,6 +15,28 @@ struct Eipdebuginfo {
 	int eip_fn_narg;		// Number of function arguments
 };
 
+// A logical frame at an instruction address: a function inlined there, or
+// the function the address is in
+struct Eipinline {
+	const char *ei_file;		// Where in the source it is
+	int ei_line;
+	const char *ei_fn_name;		// Its name, not null terminated
+	int ei_fn_namelen;
+};
+
 int debuginfo_eip(uintptr_t eip, struct Eipdebuginfo *info);
+int debuginfo_eip_batch(const uintptr_t *eips, int n, struct Eipdebuginfo *out);
+int debuginfo_eip_inline(uintptr_t eip, const struct Eipdebuginfo *info, struct Eipinline *frames, int nframes);
+
+struct Dwarf_Addrs;
+void load_kernel_dwarf_info(struct Dwarf_Addrs *addrs);
+const char *debug_section_name(uintptr_t begin);
+
+bool dbgtab_present(void);
+int dbgtab_debuginfo(uintptr_t eip, struct Eipdebuginfo *info);
+int dbgtab_debuginfo_inline(uintptr_t eip, const struct Eipdebuginfo *info, struct Eipinline *frames, int nframes);
+void dbgtab_debuginfo_batch(const uintptr_t *eips, const int *order, int n, struct Eipdebuginfo *out, int *codes);
+
+const char *ksym_lookup(uintptr_t addr, char *namebuf, uintptr_t *offset);
 
 #endif
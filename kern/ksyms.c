@@ -0,0 +1,59 @@
+// Looking up code addresses in the kernel symbol table that kern/mkksyms.c
+// builds from the kernel's ELF symbols (see inc/ksyms.h).  It only gives
+// a function and an offset, but it is always loaded and cheap to search,
+// so panics can use it whatever state the debug information is in.
+
+#include <inc/string.h>
+#include <inc/ksyms.h>
+
+#include <kern/kdebug.h>
+
+// Set by kern/kernel.ld; equal if the kernel was linked without a table.
+extern const char __KSYMS_BEGIN__[], __KSYMS_END__[];
+extern const char etext[];
+
+// ksym_lookup(addr, namebuf, offset)
+//
+//	Find the symbol at or below the code address 'addr'.  Decodes its
+//	name into 'namebuf', which must have room for KSYM_NAME_LEN bytes,
+//	stores the offset of 'addr' from the symbol to *offset, and returns
+//	'namebuf'.  Returns NULL if 'addr' isn't in the kernel's code, or
+//	the kernel has no symbol table.
+//
+const char *
+ksym_lookup(uintptr_t addr, char *namebuf, uintptr_t *offset)
+{
+	const struct Ksyms *ks = (const struct Ksyms *) __KSYMS_BEGIN__;
+	const uint32_t *addrs, *markers;
+	const uint8_t *p;
+	int lo = 0, hi, mid, i;
+
+	if (__KSYMS_END__ - __KSYMS_BEGIN__ < sizeof(*ks)
+	    || ks->ks_magic != KSYMS_MAGIC || addr >= (uintptr_t) etext)
+		return NULL;
+	addrs = (const uint32_t *) (ks + 1);
+	markers = addrs + ks->ks_nsyms;
+
+	// Find the last symbol at or below addr.
+	hi = ks->ks_nsyms;
+	while (lo < hi) {
+		mid = (lo + hi) / 2;
+		if (addrs[mid] <= addr)
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
+	if (lo == 0)
+		return NULL;
+
+	// Decode the names from its marker up to it.
+	p = (const uint8_t *) (markers + ks->ks_nmarkers)
+		+ markers[(lo - 1) / KSYMS_STRIDE];
+	for (i = (lo - 1) / KSYMS_STRIDE * KSYMS_STRIDE; i < lo; i++) {
+		memcpy(namebuf + p[0], p + 2, p[1]);
+		namebuf[p[0] + p[1]] = '\0';
+		p += 2 + p[1];
+	}
+	*offset = addr - addrs[lo - 1];
+	return namebuf;
+}
@@ -0,0 +1,1381 @@
+/*
+ * Build the debug table (see inc/dbgtab.h) from the kernel's DWARF.
+ *
+ *	mkdbgtab kernel dbgtab
+ *
+ * The table holds what debuginfo_eip() looks up in the debug sections:
+ * the address ranges of the compilation units from .debug_aranges, with
+ * their names; the address ranges and names of the functions, from the
+ * subprogram DIEs in .debug_info; the address ranges of the functions
+ * inlined into them, from the inlined_subroutine DIEs, with where they
+ * were inlined; and the rows of every line number program in
+ * .debug_line.  kern/Makefrag runs this on a first link of
+ * the kernel and links the table into the second.  The table only
+ * describes .text, which comes first in the kernel (see kern/kernel.ld),
+ * so the second link doesn't move anything it describes.
+ *
+ * A unit or function whose code is in pieces, as with
+ * -freorder-blocks-and-partition, has a range for each piece, from its
+ * DW_AT_ranges list in .debug_ranges or, in DWARF 5, .debug_rnglists.
+ *
+ * A function without a name of its own, such as the out-of-line copy of
+ * an inline function, gets the name of the DIE its DW_AT_abstract_origin
+ * or DW_AT_specification refers to.
+ *
+ * Prints the number of units, functions and rows, and the table's size.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <inc/elf.h>
+#include <inc/dbgtab.h>
+
+// From inc/dwarf.h, which only builds in the kernel.
+#define DW_TAG_inlined_subroutine 0x1d
+#define DW_TAG_compile_unit	0x11
+#define DW_TAG_subprogram	0x2e
+#define DW_TAG_partial_unit	0x3c
+
+#define DW_UT_compile		0x01
+#define DW_UT_partial		0x03
+
+#define DW_AT_name		0x03
+#define DW_AT_stmt_list		0x10
+#define DW_AT_low_pc		0x11
+#define DW_AT_high_pc		0x12
+#define DW_AT_ranges		0x55
+#define DW_AT_abstract_origin	0x31
+#define DW_AT_decl_file		0x3a
+#define DW_AT_specification	0x47
+#define DW_AT_call_file		0x58
+#define DW_AT_call_line		0x59
+#define DW_AT_str_offsets_base	0x72
+#define DW_AT_addr_base		0x73
+#define DW_AT_rnglists_base	0x74
+
+#define DW_FORM_addr		0x01
+#define DW_FORM_block2		0x03
+#define DW_FORM_block4		0x04
+#define DW_FORM_data2		0x05
+#define DW_FORM_data4		0x06
+#define DW_FORM_data8		0x07
+#define DW_FORM_string		0x08
+#define DW_FORM_block		0x09
+#define DW_FORM_block1		0x0a
+#define DW_FORM_data1		0x0b
+#define DW_FORM_flag		0x0c
+#define DW_FORM_sdata		0x0d
+#define DW_FORM_strp		0x0e
+#define DW_FORM_udata		0x0f
+#define DW_FORM_ref_addr	0x10
+#define DW_FORM_ref1		0x11
+#define DW_FORM_ref2		0x12
+#define DW_FORM_ref4		0x13
+#define DW_FORM_ref8		0x14
+#define DW_FORM_ref_udata	0x15
+#define DW_FORM_indirect	0x16
+#define DW_FORM_sec_offset	0x17
+#define DW_FORM_exprloc		0x18
+#define DW_FORM_flag_present	0x19
+#define DW_FORM_strx		0x1a
+#define DW_FORM_addrx		0x1b
+#define DW_FORM_ref_sup4	0x1c
+#define DW_FORM_strp_sup	0x1d
+#define DW_FORM_data16		0x1e
+#define DW_FORM_line_strp	0x1f
+#define DW_FORM_ref_sig8	0x20
+#define DW_FORM_implicit_const	0x21
+#define DW_FORM_loclistx	0x22
+#define DW_FORM_rnglistx	0x23
+#define DW_FORM_ref_sup8	0x24
+#define DW_FORM_strx1		0x25
+#define DW_FORM_strx4		0x28
+#define DW_FORM_addrx1		0x29
+#define DW_FORM_addrx4		0x2c
+
+#define DW_RLE_end_of_list	0x00
+#define DW_RLE_base_addressx	0x01
+#define DW_RLE_startx_endx	0x02
+#define DW_RLE_startx_length	0x03
+#define DW_RLE_offset_pair	0x04
+#define DW_RLE_base_address	0x05
+#define DW_RLE_start_end	0x06
+#define DW_RLE_start_length	0x07
+
+#define DW_LNS_copy		0x01
+#define DW_LNS_advance_pc	0x02
+#define DW_LNS_advance_line	0x03
+#define DW_LNS_const_add_pc	0x08
+#define DW_LNS_fixed_advance_pc	0x09
+#define DW_LNE_end_sequence	0x01
+#define DW_LNE_set_address	0x02
+#define DW_LNCT_path		0x1
+#define DW_LNCT_directory_index	0x2
+
+// Functions inlined deeper than this are left out, as DWARF_MAXINLINE
+// has it.
+#define MAXINLINE	16
+
+#define ROUNDUP(n, a)	(((n) + (a) - 1) / (a) * (a))
+
+struct Section {
+	const char *name;
+	const uint8_t *begin, *end;
+};
+
+static struct Section info = { ".debug_info" };
+static struct Section abbrev = { ".debug_abbrev" };
+static struct Section line = { ".debug_line" };
+static struct Section aranges = { ".debug_aranges" };
+static struct Section str = { ".debug_str" };
+static struct Section line_str = { ".debug_line_str" };
+static struct Section str_offsets = { ".debug_str_offsets" };
+static struct Section addr = { ".debug_addr" };
+static struct Section ranges = { ".debug_ranges" };
+static struct Section rnglists = { ".debug_rnglists" };
+
+static struct Section *sections[] = {
+	&info, &abbrev, &line, &aranges, &str, &line_str, &str_offsets, &addr,
+	&ranges, &rnglists,
+};
+#define NSECTIONS (sizeof(sections) / sizeof(sections[0]))
+
+struct Attrspec {
+	unsigned name, form;
+	int64_t implicit_const;
+};
+
+struct Abbrev {
+	unsigned tag;
+	int children;
+	struct Attrspec *attrs;	// ends with a 0, 0 entry
+};
+
+// An attribute value: numbers, addresses and offsets as they are in
+// the DIE, and the string of a DW_FORM_string.
+struct Value {
+	unsigned form;
+	uint64_t v;
+	const char *s;
+};
+
+// A unit of .debug_info, as far as we need it.
+struct Unit {
+	const uint8_t *hdr, *dies, *end;
+	unsigned version, address_size;
+	uint32_t str_offsets_base, addr_base, rnglists_base;
+	struct Abbrev *abbrevs;	// by code
+	unsigned nabbrevs;
+	const char *name;
+	uint32_t stmt_list;
+	int has_stmt_list;
+	uint32_t low_pc, high_pc;	// high_pc is 0 without a range
+	struct Value ranges;		// form 0 without a range list
+	int in_aranges;
+};
+
+struct Range {
+	uint32_t start, end;
+	uint32_t name;		// offset in the strings
+	uint32_t seq;		// tells ranges that start together apart
+};
+
+// A piece of an inlined function, as kern/dwarf_index.c indexes them.
+struct Inline {
+	uint32_t start, end;	// end is exclusive
+	uint32_t name, decl_file, call_file;	// offsets in the strings
+	uint32_t call_line;
+	int depth;		// inlined functions the piece is in
+	int32_t parent;
+	uint32_t seq;
+};
+
+struct Sequence {
+	uint32_t start;
+	uint32_t nrows;
+	uint32_t *addrs;
+	int32_t *lines;
+	uint32_t seq;
+};
+
+static struct Unit *units;
+static int nunits;
+static struct Range *unitranges, *funcs;
+static int nunitranges, nfuncs;
+static struct Inline *inlines;
+static int ninlines;
+static struct Sequence *seqs;
+static int nseqs;
+
+#define STRHASH_SIZE	65536
+
+static char *strings;
+static uint32_t strings_size, strings_cap, nstrings;
+static uint32_t strhash[STRHASH_SIZE];	// offset + 1 in the strings, or 0
+
+static void
+panic(const char *msg)
+{
+	fprintf(stderr, "mkdbgtab: %s\n", msg);
+	exit(1);
+}
+
+static void *
+xrealloc(void *p, size_t n)
+{
+	if ((p = realloc(p, n ? n : 1)) == NULL)
+		panic("out of memory");
+	return p;
+}
+
+static uint32_t
+get(const uint8_t **pp, int n)
+{
+	uint32_t v = 0;
+	int i;
+
+	for (i = 0; i < n; i++)
+		if (i < 4)
+			v |= (uint32_t) (*pp)[i] << (8 * i);
+	*pp += n;
+	return v;
+}
+
+static uint64_t
+get_uleb(const uint8_t **pp)
+{
+	uint64_t v = 0;
+	int shift = 0;
+	uint8_t b;
+
+	do {
+		b = *(*pp)++;
+		if (shift < 64)
+			v |= (uint64_t) (b & 0x7f) << shift;
+		shift += 7;
+	} while (b & 0x80);
+	return v;
+}
+
+static int64_t
+get_sleb(const uint8_t **pp)
+{
+	int64_t v = 0;
+	int shift = 0;
+	uint8_t b;
+
+	do {
+		b = *(*pp)++;
+		if (shift < 64)
+			v |= (int64_t) (b & 0x7f) << shift;
+		shift += 7;
+	} while (b & 0x80);
+	if (shift < 64 && (b & 0x40))
+		v |= -((int64_t) 1 << shift);
+	return v;
+}
+
+// Intern string 's', returning its offset in the strings.  Its length
+// goes in the two bytes before it.
+static uint32_t
+intern(const char *s)
+{
+	uint32_t h = 5381, i, len = strlen(s);
+	const char *p;
+
+	for (p = s; *p; p++)
+		h = h * 33 + (unsigned char) *p;
+	for (i = h % STRHASH_SIZE; strhash[i]; i = (i + 1) % STRHASH_SIZE)
+		if (strcmp(strings + strhash[i] - 1, s) == 0)
+			return strhash[i] - 1;
+	if (++nstrings > STRHASH_SIZE / 2)
+		panic("too many strings");
+	if (len > 0xFFFF)
+		panic("string too long");
+
+	if (strings_size + len + 3 > strings_cap) {
+		strings_cap = (strings_size + len + 3) * 2;
+		strings = xrealloc(strings, strings_cap);
+	}
+	strings[strings_size++] = len & 0xFF;
+	strings[strings_size++] = len >> 8;
+	memcpy(strings + strings_size, s, len + 1);
+	strhash[i] = strings_size + 1;
+	strings_size += len + 1;
+	return strings_size - len - 1;
+}
+
+// Read an attribute of 'form' at *pp and advance past it.
+static struct Value
+read_value(const struct Unit *u, unsigned form, int64_t implicit_const,
+	   const uint8_t **pp)
+{
+	struct Value val = { form, 0, NULL };
+	uint64_t len;
+
+	switch (form) {
+	case DW_FORM_addr:
+		val.v = get(pp, u->address_size);
+		break;
+	case DW_FORM_data1:
+	case DW_FORM_ref1:
+	case DW_FORM_flag:
+		val.v = get(pp, 1);
+		break;
+	case DW_FORM_data2:
+	case DW_FORM_ref2:
+		val.v = get(pp, 2);
+		break;
+	case DW_FORM_data4:
+	case DW_FORM_ref4:
+	case DW_FORM_strp:
+	case DW_FORM_line_strp:
+	case DW_FORM_sec_offset:
+	case DW_FORM_strp_sup:
+	case DW_FORM_ref_sup4:
+		val.v = get(pp, 4);
+		break;
+	case DW_FORM_data8:
+	case DW_FORM_ref8:
+	case DW_FORM_ref_sig8:
+	case DW_FORM_ref_sup8:
+		val.v = get(pp, 8);
+		break;
+	case DW_FORM_data16:
+		*pp += 16;
+		break;
+	case DW_FORM_ref_addr:
+		val.v = get(pp, u->version <= 2 ? u->address_size : 4);
+		break;
+	case DW_FORM_sdata:
+		val.v = get_sleb(pp);
+		break;
+	case DW_FORM_udata:
+	case DW_FORM_ref_udata:
+	case DW_FORM_strx:
+	case DW_FORM_addrx:
+	case DW_FORM_loclistx:
+	case DW_FORM_rnglistx:
+		val.v = get_uleb(pp);
+		break;
+	case DW_FORM_string:
+		val.s = (const char *) *pp;
+		*pp += strlen(val.s) + 1;
+		break;
+	case DW_FORM_block1:
+		len = get(pp, 1);
+		*pp += len;
+		break;
+	case DW_FORM_block2:
+		len = get(pp, 2);
+		*pp += len;
+		break;
+	case DW_FORM_block4:
+		len = get(pp, 4);
+		*pp += len;
+		break;
+	case DW_FORM_block:
+	case DW_FORM_exprloc:
+		len = get_uleb(pp);
+		*pp += len;
+		break;
+	case DW_FORM_flag_present:
+		val.v = 1;
+		break;
+	case DW_FORM_implicit_const:
+		val.v = implicit_const;
+		break;
+	case DW_FORM_indirect:
+		form = get_uleb(pp);
+		return read_value(u, form, implicit_const, pp);
+	default:
+		if (form >= DW_FORM_strx1 && form <= DW_FORM_addrx4) {
+			val.v = get(pp, (form - DW_FORM_strx1) % 4 + 1);
+			break;
+		}
+		panic("unknown attribute form");
+	}
+	return val;
+}
+
+static const char *
+value_string(const struct Unit *u, const struct Value *val)
+{
+	const uint8_t *p;
+	uint64_t off;
+
+	if (val->form == DW_FORM_string)
+		return val->s;
+	if (val->form == DW_FORM_line_strp) {
+		if (val->v >= line_str.end - line_str.begin)
+			return NULL;
+		return (const char *) line_str.begin + val->v;
+	}
+	if (val->form == DW_FORM_strp)
+		off = val->v;
+	else if (val->form == DW_FORM_strx
+		 || (val->form >= DW_FORM_strx1 && val->form <= DW_FORM_strx4)) {
+		off = u->str_offsets_base + val->v * 4;
+		if (off + 4 > str_offsets.end - str_offsets.begin)
+			return NULL;
+		p = str_offsets.begin + off;
+		off = get(&p, 4);
+	} else
+		return NULL;
+	if (off >= str.end - str.begin)
+		return NULL;
+	return (const char *) str.begin + off;
+}
+
+static uint32_t
+value_address(const struct Unit *u, const struct Value *val)
+{
+	const uint8_t *p;
+	uint64_t off;
+
+	if (val->form == DW_FORM_addr)
+		return val->v;
+	off = u->addr_base + val->v * u->address_size;
+	if (off + u->address_size > addr.end - addr.begin)
+		return 0;
+	p = addr.begin + off;
+	return get(&p, u->address_size);
+}
+
+// The address at 'index' in the unit's entries in .debug_addr
+static uint32_t
+addrx(const struct Unit *u, uint64_t index)
+{
+	struct Value val = { DW_FORM_addrx, index, NULL };
+
+	return value_address(u, &val);
+}
+
+// The end of a range starting at 'low' with DW_AT_high_pc 'high'.
+static uint32_t
+high_pc(const struct Unit *u, uint32_t low, const struct Value *high)
+{
+	if (high->form == DW_FORM_addr || high->form == DW_FORM_addrx
+	    || (high->form >= DW_FORM_addrx1 && high->form <= DW_FORM_addrx4))
+		return value_address(u, high);
+	return low + high->v;
+}
+
+static void
+read_abbrevs(struct Unit *u, uint64_t offset)
+{
+	const uint8_t *p = abbrev.begin + offset;
+	struct Attrspec *attrs;
+	unsigned code, n;
+
+	if (offset >= abbrev.end - abbrev.begin)
+		panic("bad abbreviation offset");
+	while (p < abbrev.end && (code = get_uleb(&p)) != 0) {
+		if (code >= u->nabbrevs) {
+			u->abbrevs = xrealloc(u->abbrevs,
+					      (code + 1) * sizeof(*u->abbrevs));
+			memset(u->abbrevs + u->nabbrevs, 0,
+			       (code + 1 - u->nabbrevs) * sizeof(*u->abbrevs));
+			u->nabbrevs = code + 1;
+		}
+		u->abbrevs[code].tag = get_uleb(&p);
+		u->abbrevs[code].children = get(&p, 1);
+		attrs = NULL;
+		n = 0;
+		do {
+			attrs = xrealloc(attrs, (n + 1) * sizeof(*attrs));
+			attrs[n].name = get_uleb(&p);
+			attrs[n].form = get_uleb(&p);
+			attrs[n].implicit_const = 0;
+			if (attrs[n].form == DW_FORM_implicit_const)
+				attrs[n].implicit_const = get_sleb(&p);
+		} while (attrs[n++].name || attrs[n - 1].form);
+		u->abbrevs[code].attrs = attrs;
+	}
+}
+
+// The abbreviation of the DIE at *pp, advancing past its code.  NULL
+// for a null entry.
+static const struct Abbrev *
+die_abbrev(const struct Unit *u, const uint8_t **pp)
+{
+	unsigned code = get_uleb(pp);
+
+	if (code == 0)
+		return NULL;
+	if (code >= u->nabbrevs || !u->abbrevs[code].attrs)
+		panic("bad abbreviation code");
+	return &u->abbrevs[code];
+}
+
+// The name of the DIE at 'die', following DW_AT_abstract_origin and
+// DW_AT_specification within its unit if it has none of its own.
+static const char *
+die_name(const struct Unit *u, const uint8_t *die, int depth)
+{
+	const struct Abbrev *ab = die_abbrev(u, &die);
+	const struct Attrspec *as;
+	const uint8_t *ref = NULL;
+	struct Value val;
+
+	if (!ab)
+		return NULL;
+	for (as = ab->attrs; as->name || as->form; as++) {
+		val = read_value(u, as->form, as->implicit_const, &die);
+		if (as->name == DW_AT_name)
+			return value_string(u, &val);
+		if ((as->name == DW_AT_abstract_origin
+		     || as->name == DW_AT_specification)
+		    && as->form != DW_FORM_ref_sig8)
+			ref = (as->form == DW_FORM_ref_addr ? info.begin : u->hdr)
+				+ val.v;
+	}
+	if (ref && ref >= u->dies && ref < u->end && depth < 4)
+		return die_name(u, ref, depth + 1);
+	return NULL;
+}
+
+// The name and DW_AT_decl_file of the DIE at 'die', to *name and *file.
+// What the DIE doesn't have comes from the DIE its DW_AT_abstract_origin
+// or DW_AT_specification refers to within its unit, as die_origin in
+// kern/dwarf.c has it.  *file is 0 if none has one.
+static void
+die_origin(const struct Unit *u, const uint8_t *die, const char **name,
+	   uint32_t *file)
+{
+	const struct Abbrev *ab;
+	const struct Attrspec *as;
+	const uint8_t *ref;
+	struct Value val;
+	int depth;
+
+	*name = NULL;
+	*file = 0;
+	for (depth = 0; depth < 4 && !(*name && *file); depth++) {
+		if (die < u->dies || die >= u->end || !(ab = die_abbrev(u, &die)))
+			return;
+		ref = NULL;
+		for (as = ab->attrs; as->name || as->form; as++) {
+			val = read_value(u, as->form, as->implicit_const, &die);
+			if (as->name == DW_AT_name && !*name)
+				*name = value_string(u, &val);
+			else if (as->name == DW_AT_decl_file && !*file)
+				*file = val.v;
+			else if ((as->name == DW_AT_abstract_origin
+				  || as->name == DW_AT_specification)
+				 && as->form != DW_FORM_ref_sig8)
+				ref = (as->form == DW_FORM_ref_addr ? info.begin
+				       : u->hdr) + val.v;
+		}
+		if (!ref)
+			return;
+		die = ref;
+	}
+}
+
+// Read the unit header at 'hdr' and the attributes of its unit DIE.
+// Returns 0 for a unit without code, such as a type unit.
+static int
+read_unit(const uint8_t *hdr, struct Unit *u)
+{
+	const uint8_t *p = hdr, *die;
+	const struct Abbrev *ab;
+	const struct Attrspec *as;
+	struct Value val, name = { 0 }, high = { 0 };
+	uint32_t length;
+	uint64_t abbrev_offset;
+	unsigned unit_type = DW_UT_compile;
+	int pass;
+
+	memset(u, 0, sizeof(*u));
+	u->hdr = hdr;
+	length = get(&p, 4);
+	if (length >= 0xfffffff0)
+		panic("64-bit DWARF is not supported");
+	u->end = p + length;
+	if (u->end > info.end)
+		panic("unit runs past .debug_info");
+	u->version = get(&p, 2);
+	if (u->version < 2 || u->version > 5)
+		panic("unknown DWARF version");
+	if (u->version >= 5) {
+		unit_type = get(&p, 1);
+		u->address_size = get(&p, 1);
+		abbrev_offset = get(&p, 4);
+		if (unit_type != DW_UT_compile && unit_type != DW_UT_partial)
+			return 0;
+	} else {
+		abbrev_offset = get(&p, 4);
+		u->address_size = get(&p, 1);
+	}
+	if (u->address_size != 4)
+		panic("addresses are not 4 bytes");
+	u->dies = p;
+	read_abbrevs(u, abbrev_offset);
+
+	// The bases come first, as they may follow the attributes that
+	// need them.
+	for (pass = 0; pass < 2; pass++) {
+		die = u->dies;
+		if (!(ab = die_abbrev(u, &die)))
+			return 0;
+		if (ab->tag != DW_TAG_compile_unit
+		    && ab->tag != DW_TAG_partial_unit)
+			return 0;
+		for (as = ab->attrs; as->name || as->form; as++) {
+			val = read_value(u, as->form, as->implicit_const, &die);
+			if (pass == 0 && as->name == DW_AT_str_offsets_base)
+				u->str_offsets_base = val.v;
+			else if (pass == 0 && as->name == DW_AT_addr_base)
+				u->addr_base = val.v;
+			else if (pass == 0 && as->name == DW_AT_rnglists_base)
+				u->rnglists_base = val.v;
+			else if (pass == 1 && as->name == DW_AT_name)
+				name = val;
+			else if (pass == 1 && as->name == DW_AT_stmt_list) {
+				u->stmt_list = val.v;
+				u->has_stmt_list = 1;
+			} else if (pass == 1 && as->name == DW_AT_low_pc)
+				u->low_pc = value_address(u, &val);
+			else if (pass == 1 && as->name == DW_AT_high_pc)
+				high = val;
+			else if (pass == 1 && as->name == DW_AT_ranges)
+				u->ranges = val;
+		}
+	}
+	if (name.form)
+		u->name = value_string(u, &name);
+	if (high.form)
+		u->high_pc = high_pc(u, u->low_pc, &high);
+	return 1;
+}
+
+static void
+add_range(struct Range **rp, int *np, uint32_t start, uint32_t end,
+	  const char *name)
+{
+	struct Range *r;
+
+	*rp = xrealloc(*rp, (*np + 1) * sizeof(**rp));
+	r = &(*rp)[*np];
+	r->start = start;
+	r->end = end;
+	r->name = intern(name ? name : "<unknown>");
+	r->seq = (*np)++;
+}
+
+// Add a range for each piece of the range list that DW_AT_ranges value
+// 'val' of unit 'u' refers to.  Empty pieces have no code to add.
+static void
+add_rangelist(struct Range **rp, int *np, const struct Unit *u,
+	      const struct Value *val, const char *name)
+{
+	const struct Section *sect = u->version >= 5 ? &rnglists : &ranges;
+	const uint8_t *p;
+	uint64_t off = val->v;
+	uint32_t base = u->low_pc, start, end, a, b;
+	unsigned kind;
+
+	if (val->form == DW_FORM_rnglistx) {
+		// The offsets are relative to the unit's DW_AT_rnglists_base.
+		off = u->rnglists_base + off * 4;
+		if (off + 4 > sect->end - sect->begin)
+			panic("bad range list index");
+		p = sect->begin + off;
+		off = u->rnglists_base + get(&p, 4);
+	}
+	if (off >= sect->end - sect->begin)
+		panic("bad range list offset");
+	p = sect->begin + off;
+
+	for (;;) {
+		if (u->version < 5) {
+			if (p + 8 > sect->end)
+				panic("range list runs past .debug_ranges");
+			a = get(&p, 4);
+			b = get(&p, 4);
+			if (a == 0 && b == 0)
+				return;
+			if (a == 0xffffffff) {
+				base = b;
+				continue;
+			}
+			start = base + a;
+			end = base + b;
+		} else {
+			if (p >= sect->end)
+				panic("range list runs past .debug_rnglists");
+			kind = get(&p, 1);
+			switch (kind) {
+			case DW_RLE_end_of_list:
+				return;
+			case DW_RLE_base_addressx:
+				base = addrx(u, get_uleb(&p));
+				continue;
+			case DW_RLE_base_address:
+				base = get(&p, 4);
+				continue;
+			case DW_RLE_startx_endx:
+				start = addrx(u, get_uleb(&p));
+				end = addrx(u, get_uleb(&p));
+				break;
+			case DW_RLE_startx_length:
+				start = addrx(u, get_uleb(&p));
+				end = start + get_uleb(&p);
+				break;
+			case DW_RLE_offset_pair:
+				start = base + get_uleb(&p);
+				end = base + get_uleb(&p);
+				break;
+			case DW_RLE_start_end:
+				start = get(&p, 4);
+				end = get(&p, 4);
+				break;
+			case DW_RLE_start_length:
+				start = get(&p, 4);
+				end = start + get_uleb(&p);
+				break;
+			default:
+				panic("unknown range list entry");
+			}
+		}
+		if (start < end)
+			add_range(rp, np, start, end, name);
+	}
+}
+
+// Add the functions of unit 'u': its subprogram DIEs with an address.
+static void
+add_funcs(const struct Unit *u)
+{
+	const uint8_t *p = u->dies, *die;
+	const struct Abbrev *ab;
+	const struct Attrspec *as;
+	struct Value val, high = { 0 }, rl = { 0 };
+	uint32_t low;
+	const char *name;
+	int has_low;
+
+	while (p < u->end) {
+		die = p;
+		if (!(ab = die_abbrev(u, &p)))
+			continue;
+		has_low = 0;
+		low = 0;
+		high.form = 0;
+		rl.form = 0;
+		for (as = ab->attrs; as->name || as->form; as++) {
+			val = read_value(u, as->form, as->implicit_const, &p);
+			if (as->name == DW_AT_low_pc) {
+				low = value_address(u, &val);
+				has_low = 1;
+			} else if (as->name == DW_AT_high_pc)
+				high = val;
+			else if (as->name == DW_AT_ranges)
+				rl = val;
+		}
+		// Declarations and abstract instances have no address.
+		if (ab->tag != DW_TAG_subprogram || (!has_low && !rl.form))
+			continue;
+		name = die_name(u, die, 0);
+		if (rl.form)
+			add_rangelist(&funcs, &nfuncs, u, &rl, name);
+		else
+			add_range(&funcs, &nfuncs, low,
+				  high.form ? high_pc(u, low, &high) : low, name);
+	}
+}
+
+// Read an entry of a DWARF 5 directory or file name table at *pp, whose
+// format is the 'n' pairs at 'format', and advance past it.
+static void
+line_entry(const struct Unit *u, const uint8_t **pp, const uint8_t *format,
+	   int n, const char **path, uint32_t *dir)
+{
+	unsigned type, form;
+	struct Value val;
+
+	while (n-- > 0) {
+		type = get_uleb(&format);
+		form = get_uleb(&format);
+		val = read_value(u, form, 0, pp);
+		if (type == DW_LNCT_path)
+			*path = value_string(u, &val);
+		else if (type == DW_LNCT_directory_index)
+			*dir = val.v;
+	}
+}
+
+// Set file 'index' of 'files' to the file 'name' in directory 'dir', as
+// inlines_build() in kern/dwarf_index.c joins them, growing 'files' to
+// hold it.  'dir' is NULL or "" for the compilation directory.
+static void
+set_file(uint32_t **files, int *nfiles, uint32_t index, const char *dir,
+	 const char *name)
+{
+	char *path;
+
+	while (index >= *nfiles) {
+		*files = xrealloc(*files, (*nfiles + 1) * sizeof(**files));
+		(*files)[(*nfiles)++] = intern("<unknown>");
+	}
+	while (dir && dir[0] == '.' && dir[1] == '/')
+		dir += 2;
+	if (name[0] == '/' || !dir || !dir[0] || strcmp(dir, ".") == 0) {
+		(*files)[index] = intern(name);
+		return;
+	}
+	path = xrealloc(NULL, strlen(dir) + strlen(name) + 2);
+	sprintf(path, "%s/%s", dir, name);
+	(*files)[index] = intern(path);
+	free(path);
+}
+
+// The files of the line program of unit 'u', by the numbers DW_AT_decl_file
+// and DW_AT_call_file have for them: offsets in the strings.  Stores how
+// many there are to *np.
+static uint32_t *
+line_files(const struct Unit *u, int *np)
+{
+	const uint8_t *p = line.begin + u->stmt_list, *end, *dirs;
+	const uint8_t *dir_format, *file_format;
+	const char *name, *dir, **dirnames = NULL;
+	unsigned version, opcode_base, ndir_format, nfile_format, i;
+	uint32_t length, ndirs, nfiles, dir_index, *files = NULL;
+
+	*np = 0;
+	if (u->stmt_list >= line.end - line.begin)
+		panic("bad line program offset");
+	length = get(&p, 4);
+	end = p + length;
+	version = get(&p, 2);
+	if (version >= 5)
+		p += 2;		// address_size, segment_selector_size
+	p += 4;			// header_length
+	p += 4;			// minimum_instruction_length to line_range
+	if (version >= 4)
+		p++;		// maximum_operations_per_instruction
+	opcode_base = get(&p, 1);
+	p += opcode_base - 1;	// standard_opcode_lengths
+
+	if (version < 5) {
+		// Strings up to an empty one, in both tables; each file name
+		// is followed by its directory's number, time and size.
+		dirs = p;
+		while (p < end && *p)
+			p += strlen((const char *) p) + 1;
+		for (p++, i = 1; p < end && *p; i++) {
+			name = (const char *) p;
+			p += strlen(name) + 1;
+			dir_index = get_uleb(&p);
+			get_uleb(&p);
+			get_uleb(&p);
+			dir = NULL;
+			if (dir_index > 0)
+				for (dir = (const char *) dirs; --dir_index > 0
+				     && *dir; dir += strlen(dir) + 1)
+					/* do nothing */;
+			set_file(&files, np, i, dir, name);
+		}
+		return files;
+	}
+
+	ndir_format = get(&p, 1);
+	dir_format = p;
+	for (i = 0; i < 2 * ndir_format; i++)
+		get_uleb(&p);
+	ndirs = get_uleb(&p);
+	dirnames = xrealloc(NULL, (ndirs + 1) * sizeof(*dirnames));
+	for (i = 0; i < ndirs && p < end; i++) {
+		dirnames[i] = NULL;
+		line_entry(u, &p, dir_format, ndir_format, &dirnames[i],
+			   &dir_index);
+	}
+	ndirs = i;
+	nfile_format = get(&p, 1);
+	file_format = p;
+	for (i = 0; i < 2 * nfile_format; i++)
+		get_uleb(&p);
+	nfiles = get_uleb(&p);
+	for (i = 0; i < nfiles && p < end; i++) {
+		name = NULL;
+		dir_index = 0;
+		line_entry(u, &p, file_format, nfile_format, &name, &dir_index);
+		// Directory 0 is the compilation directory.
+		dir = dir_index > 0 && dir_index < ndirs ? dirnames[dir_index]
+			: NULL;
+		if (name)
+			set_file(&files, np, i, dir, name);
+	}
+	free(dirnames);
+	return files;
+}
+
+static void
+add_inline(const struct Inline *in)
+{
+	inlines = xrealloc(inlines, (ninlines + 1) * sizeof(*inlines));
+	inlines[ninlines] = *in;
+	inlines[ninlines].seq = ninlines;
+	ninlines++;
+}
+
+// Add the pieces of the functions inlined into the code of unit 'u', as
+// dwarf_inlines_walk() in kern/dwarf.c finds them.
+static void
+add_inlines(const struct Unit *u)
+{
+	const uint8_t *p = u->dies, *origin;
+	const struct Abbrev *ab;
+	const struct Attrspec *as;
+	struct Value val, high = { 0 }, rl = { 0 };
+	struct Range *pieces = NULL;
+	struct Inline in;
+	uint32_t *files = NULL, low, decl_file, call_file;
+	const char *name;
+	int open[MAXINLINE], level = 0, nopen = 0, nfiles = 0, npieces;
+	int has_low, i;
+
+	if (u->has_stmt_list)
+		files = line_files(u, &nfiles);
+	while (p < u->end) {
+		if (!(ab = die_abbrev(u, &p))) {
+			// The end of the children of the DIE at 'level'
+			if (--level < 0)
+				break;
+			while (nopen > 0 && open[nopen - 1] >= level)
+				nopen--;
+			continue;
+		}
+		memset(&in, 0, sizeof(in));
+		has_low = 0;
+		low = 0;
+		high.form = 0;
+		rl.form = 0;
+		origin = NULL;
+		call_file = 0;
+		for (as = ab->attrs; as->name || as->form; as++) {
+			val = read_value(u, as->form, as->implicit_const, &p);
+			if (as->name == DW_AT_low_pc) {
+				low = value_address(u, &val);
+				has_low = 1;
+			} else if (as->name == DW_AT_high_pc)
+				high = val;
+			else if (as->name == DW_AT_ranges)
+				rl = val;
+			else if (as->name == DW_AT_abstract_origin
+				 && as->form != DW_FORM_ref_sig8)
+				origin = (as->form == DW_FORM_ref_addr
+					  ? info.begin : u->hdr) + val.v;
+			else if (as->name == DW_AT_call_file)
+				call_file = val.v;
+			else if (as->name == DW_AT_call_line)
+				in.call_line = val.v;
+		}
+		if (ab->tag == DW_TAG_inlined_subroutine && nopen < MAXINLINE) {
+			npieces = 0;
+			if (has_low && high.form && low < high_pc(u, low, &high))
+				add_range(&pieces, &npieces, low,
+					  high_pc(u, low, &high), NULL);
+			if (rl.form)
+				add_rangelist(&pieces, &npieces, u, &rl, NULL);
+			name = NULL;
+			decl_file = 0;
+			if (origin)
+				die_origin(u, origin, &name, &decl_file);
+			in.name = intern(name ? name : "<unknown>");
+			in.decl_file = decl_file < nfiles ? files[decl_file]
+				: intern("<unknown>");
+			in.call_file = call_file < nfiles ? files[call_file]
+				: intern("<unknown>");
+			in.depth = nopen;
+			for (i = 0; i < npieces; i++) {
+				in.start = pieces[i].start;
+				in.end = pieces[i].end;
+				add_inline(&in);
+			}
+			if (ab->children)
+				open[nopen++] = level;
+		}
+		if (ab->children)
+			level++;
+	}
+	free(pieces);
+	free(files);
+}
+
+static struct Unit *
+unit_at(uint64_t offset)
+{
+	int i;
+
+	for (i = 0; i < nunits; i++)
+		if (units[i].hdr == info.begin + offset)
+			return &units[i];
+	return NULL;
+}
+
+// Add the units' address ranges from .debug_aranges, or from their unit
+// DIEs for the units it doesn't have, as info_by_address finds them.
+static void
+add_unitranges(void)
+{
+	const uint8_t *p = aranges.begin, *set, *end;
+	struct Unit *u;
+	int i;
+	uint32_t length, start, size;
+	unsigned address_size, tuple;
+
+	while (p + 12 <= aranges.end) {
+		set = p;
+		length = get(&p, 4);
+		if (length == 0)
+			break;
+		end = p + length;
+		p += 2;		// version
+		if ((u = unit_at(get(&p, 4))) != NULL)
+			u->in_aranges = 1;
+		address_size = get(&p, 1);
+		p++;		// segment selector size
+		if (address_size != 4)
+			panic("addresses are not 4 bytes");
+		tuple = 2 * address_size;
+		p = set + ROUNDUP(p - set, tuple);
+		while (p + tuple <= end) {
+			start = get(&p, 4);
+			size = get(&p, 4);
+			if (start == 0 && size == 0)
+				break;
+			if (size && u)
+				add_range(&unitranges, &nunitranges,
+					  start, start + size, u->name);
+		}
+		p = end;
+	}
+
+	for (i = 0; i < nunits; i++) {
+		u = &units[i];
+		if (u->in_aranges)
+			continue;
+		if (u->ranges.form)
+			add_rangelist(&unitranges, &nunitranges, u, &u->ranges,
+				      u->name);
+		else if (u->high_pc > u->low_pc)
+			add_range(&unitranges, &nunitranges, u->low_pc,
+				  u->high_pc, u->name);
+	}
+}
+
+static void
+add_row(struct Sequence *s, uint32_t address, int32_t line)
+{
+	if ((s->nrows & (s->nrows - 1)) == 0) {
+		s->addrs = xrealloc(s->addrs, 2 * (s->nrows + 1) * sizeof(uint32_t));
+		s->lines = xrealloc(s->lines, 2 * (s->nrows + 1) * sizeof(int32_t));
+	}
+	s->addrs[s->nrows] = address;
+	s->lines[s->nrows] = line;
+	s->nrows++;
+}
+
+// Run the line number program at 'offset' in .debug_line, adding its
+// sequences.  The rows are the ones kern/dwarf_lines.c gets.
+static void
+add_lines(uint64_t offset)
+{
+	const uint8_t *p = line.begin + offset, *end, *program, *op_end;
+	const uint8_t *std_lengths;
+	unsigned version, min_inst, line_range, opcode_base, op, i;
+	int line_base;
+	uint32_t length, address = 0;
+	int32_t lineno = 1;
+	struct Sequence *s = NULL;
+
+	if (offset >= line.end - line.begin)
+		panic("bad line program offset");
+	length = get(&p, 4);
+	if (length >= 0xfffffff0)
+		panic("64-bit DWARF is not supported");
+	end = p + length;
+	version = get(&p, 2);
+	if (version < 2 || version > 5)
+		panic("unknown line program version");
+	if (version >= 5)
+		p += 2;		// address_size, segment_selector_size
+	length = get(&p, 4);
+	program = p + length;
+	min_inst = get(&p, 1);
+	if (version >= 4)
+		p++;		// maximum_operations_per_instruction
+	p++;			// default_is_stmt
+	line_base = (int8_t) get(&p, 1);
+	line_range = get(&p, 1);
+	opcode_base = get(&p, 1);
+	std_lengths = p;
+
+	for (p = program; p < end; ) {
+		if (!s) {
+			seqs = xrealloc(seqs, (nseqs + 1) * sizeof(*seqs));
+			s = &seqs[nseqs];
+			memset(s, 0, sizeof(*s));
+			s->seq = nseqs++;
+			address = 0;
+			lineno = 1;
+		}
+		op = get(&p, 1);
+		if (op >= opcode_base) {
+			op -= opcode_base;
+			address += min_inst * (op / line_range);
+			lineno += line_base + op % line_range;
+			add_row(s, address, lineno);
+		} else if (op == 0) {
+			length = get_uleb(&p);
+			op_end = p + length;
+			op = get(&p, 1);
+			if (op == DW_LNE_end_sequence) {
+				add_row(s, address, 0);
+				s->start = s->addrs[0];
+				s = NULL;
+			} else if (op == DW_LNE_set_address)
+				address = get(&p, 4);
+			p = op_end;
+		} else if (op == DW_LNS_copy)
+			add_row(s, address, lineno);
+		else if (op == DW_LNS_advance_pc)
+			address += min_inst * get_uleb(&p);
+		else if (op == DW_LNS_advance_line)
+			lineno += get_sleb(&p);
+		else if (op == DW_LNS_const_add_pc)
+			address += min_inst * ((255 - opcode_base) / line_range);
+		else if (op == DW_LNS_fixed_advance_pc)
+			address += get(&p, 2);
+		else
+			for (i = 0; i < std_lengths[op - 1]; i++)
+				get_uleb(&p);
+	}
+	// A program that doesn't end its last sequence gets no rows from it.
+	if (s)
+		nseqs--;
+}
+
+static int
+range_cmp(const void *a, const void *b)
+{
+	const struct Range *ra = a, *rb = b;
+
+	if (ra->start != rb->start)
+		return ra->start < rb->start ? -1 : 1;
+	return ra->seq < rb->seq ? -1 : ra->seq > rb->seq;
+}
+
+static int
+inline_cmp(const void *a, const void *b)
+{
+	const struct Inline *ia = a, *ib = b;
+
+	if (ia->start != ib->start)
+		return ia->start < ib->start ? -1 : 1;
+	if (ia->depth != ib->depth)
+		return ia->depth < ib->depth ? -1 : 1;
+	return ia->seq < ib->seq ? -1 : ia->seq > ib->seq;
+}
+
+static int
+seq_cmp(const void *a, const void *b)
+{
+	const struct Sequence *sa = a, *sb = b;
+
+	if (sa->start != sb->start)
+		return sa->start < sb->start ? -1 : 1;
+	return sa->seq < sb->seq ? -1 : sa->seq > sb->seq;
+}
+
+static int
+put_uleb(uint8_t *p, uint32_t v)
+{
+	int n = 0;
+
+	do {
+		p[n] = v & 0x7f;
+		v >>= 7;
+		if (v)
+			p[n] |= 0x80;
+		n++;
+	} while (v);
+	return n;
+}
+
+static int
+put_sleb(uint8_t *p, int32_t v)
+{
+	int n = 0, more;
+
+	do {
+		p[n] = v & 0x7f;
+		v >>= 7;
+		more = !((v == 0 && !(p[n] & 0x40))
+			 || (v == -1 && (p[n] & 0x40)));
+		if (more)
+			p[n] |= 0x80;
+		n++;
+	} while (more);
+	return n;
+}
+
+static void
+write_ranges(FILE *f, const struct Range *r, int n)
+{
+	struct Dbgtab_range dr;
+	int i;
+
+	for (i = 0; i < n; i++) {
+		dr.dr_start = r[i].start;
+		dr.dr_end = r[i].end;
+		dr.dr_name = r[i].name;
+		fwrite(&dr, sizeof(dr), 1, f);
+	}
+}
+
+static void
+write_inlines(FILE *f)
+{
+	struct Dbgtab_inline di;
+	int i;
+
+	for (i = 0; i < ninlines; i++) {
+		di.di_start = inlines[i].start;
+		di.di_end = inlines[i].end;
+		di.di_name = inlines[i].name;
+		di.di_decl_file = inlines[i].decl_file;
+		di.di_call_file = inlines[i].call_file;
+		di.di_call_line = inlines[i].call_line;
+		di.di_parent = inlines[i].parent;
+		fwrite(&di, sizeof(di), 1, f);
+	}
+}
+
+int
+main(int argc, char **argv)
+{
+	FILE *f;
+	uint8_t *in, *rows;
+	long insize;
+	struct Elf *elf;
+	struct Secthdr *sh;
+	const char *shstr;
+	struct Dbgtab dt;
+	struct Dbgtab_anchor *anchors, *da;
+	const uint8_t *hdr;
+	struct Unit u;
+	uint32_t nrows = 0, rows_size = 0, prev_addr = 0, size;
+	int32_t prev_line = 0;
+	int i, j;
+
+	if (argc != 3) {
+		fprintf(stderr, "usage: mkdbgtab kernel output\n");
+		exit(2);
+	}
+
+	if ((f = fopen(argv[1], "rb")) == NULL)
+		panic("cannot open input");
+	fseek(f, 0, SEEK_END);
+	insize = ftell(f);
+	fseek(f, 0, SEEK_SET);
+	in = xrealloc(NULL, insize);
+	if (fread(in, 1, insize, f) != insize)
+		panic("short read");
+	fclose(f);
+
+	elf = (struct Elf *) in;
+	if (elf->e_magic != ELF_MAGIC)
+		panic("not an ELF file");
+	sh = (struct Secthdr *) (in + elf->e_shoff);
+	shstr = (const char *) in + sh[elf->e_shstrndx].sh_offset;
+	for (i = 0; i < elf->e_shnum; i++)
+		for (j = 0; j < NSECTIONS; j++)
+			if (strcmp(shstr + sh[i].sh_name, sections[j]->name) == 0) {
+				sections[j]->begin = in + sh[i].sh_offset;
+				sections[j]->end = sections[j]->begin + sh[i].sh_size;
+			}
+	if (!info.begin || !abbrev.begin || !line.begin)
+		panic("no debug information");
+
+	for (hdr = info.begin; hdr + 11 <= info.end; hdr = u.end) {
+		if (read_unit(hdr, &u) == 0)
+			continue;
+		add_funcs(&u);
+		add_inlines(&u);
+		if (u.has_stmt_list)
+			add_lines(u.stmt_list);
+		units = xrealloc(units, (nunits + 1) * sizeof(*units));
+		units[nunits++] = u;
+	}
+	add_unitranges();
+
+	qsort(unitranges, nunitranges, sizeof(*unitranges), range_cmp);
+	qsort(funcs, nfuncs, sizeof(*funcs), range_cmp);
+	qsort(seqs, nseqs, sizeof(*seqs), seq_cmp);
+	qsort(inlines, ninlines, sizeof(*inlines), inline_cmp);
+
+	// The piece a piece is inside is the nearest one before it that is
+	// less deep and hasn't ended, so it is on the chain of the piece just
+	// before it.
+	for (i = 0; i < ninlines; i++) {
+		for (j = i - 1; j >= 0 && (inlines[j].end <= inlines[i].start
+					   || inlines[j].depth >= inlines[i].depth);
+		     j = inlines[j].parent)
+			/* do nothing */;
+		inlines[i].parent = j;
+	}
+
+	// Encode the rows.
+	for (i = 0; i < nseqs; i++)
+		nrows += seqs[i].nrows;
+	anchors = xrealloc(NULL, ROUNDUP(nrows, DBGTAB_STRIDE) / DBGTAB_STRIDE
+			   * sizeof(*anchors));
+	rows = xrealloc(NULL, nrows * 10);
+	for (i = 0, nrows = 0; i < nseqs; i++)
+		for (j = 0; j < seqs[i].nrows; j++, nrows++) {
+			if (nrows % DBGTAB_STRIDE == 0) {
+				da = &anchors[nrows / DBGTAB_STRIDE];
+				da->da_addr = seqs[i].addrs[j];
+				da->da_line = seqs[i].lines[j];
+				da->da_rows = rows_size;
+			} else {
+				rows_size += put_uleb(rows + rows_size,
+						      seqs[i].addrs[j] - prev_addr);
+				rows_size += put_sleb(rows + rows_size,
+						      seqs[i].lines[j] - prev_line);
+			}
+			prev_addr = seqs[i].addrs[j];
+			prev_line = seqs[i].lines[j];
+		}
+
+	dt.dt_magic = DBGTAB_MAGIC;
+	dt.dt_nunits = nunitranges;
+	dt.dt_nfuncs = nfuncs;
+	dt.dt_ninlines = ninlines;
+	dt.dt_nrows = nrows;
+	dt.dt_rows_size = rows_size;
+	dt.dt_strings_size = strings_size;
+	if ((f = fopen(argv[2], "wb")) == NULL)
+		panic("cannot open output");
+	fwrite(&dt, sizeof(dt), 1, f);
+	write_ranges(f, unitranges, nunitranges);
+	write_ranges(f, funcs, nfuncs);
+	write_inlines(f);
+	fwrite(anchors, sizeof(*anchors),
+	       ROUNDUP(nrows, DBGTAB_STRIDE) / DBGTAB_STRIDE, f);
+	fwrite(rows, 1, rows_size, f);
+	fwrite(strings, 1, strings_size, f);
+	size = ftell(f);
+	if (fclose(f) != 0)
+		panic("cannot write output");
+
+	printf("%s: %d units, %d functions, %d inlined, %u line rows in %u bytes\n",
+	       argv[2], nunitranges, nfuncs, ninlines, nrows, size);
+	return 0;
+}
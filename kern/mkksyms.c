@@ -0,0 +1,152 @@
+/*
+ * Build the kernel symbol table (see inc/ksyms.h) from the kernel's ELF
+ * symbol table.
+ *
+ *	mkksyms kernel ksyms
+ *
+ * Takes the function and untyped symbols defined in the kernel's code
+ * sections, which covers the assembly labels too, much as the 'T' and
+ * 't' lines of 'nm -n'.  Symbols at the same address are kept in name
+ * order; a lookup finds the last of them.  Like kern/mkdbgtab.c, this
+ * runs on the first link of the kernel, whose code the second link
+ * leaves where it is.
+ *
+ * Prints the number of symbols and the table's size.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <inc/elf.h>
+#include <inc/ksyms.h>
+
+struct Ksym {
+	uint32_t addr;
+	const char *name;
+};
+
+static void
+panic(const char *msg)
+{
+	fprintf(stderr, "mkksyms: %s\n", msg);
+	exit(1);
+}
+
+static int
+ksym_cmp(const void *a, const void *b)
+{
+	const struct Ksym *ka = a, *kb = b;
+
+	if (ka->addr != kb->addr)
+		return ka->addr < kb->addr ? -1 : 1;
+	return strcmp(ka->name, kb->name);
+}
+
+int
+main(int argc, char **argv)
+{
+	FILE *f;
+	uint8_t *in, *names;
+	long insize;
+	struct Elf *elf;
+	struct Secthdr *sh, *symtab = NULL, *code;
+	struct Sym *sym;
+	struct Ksym *syms;
+	struct Ksyms ks;
+	uint32_t *addrs, *markers, names_size = 0;
+	const char *strtab, *prev = "";
+	int i, n = 0, nsym, len, prefix;
+
+	if (argc != 3) {
+		fprintf(stderr, "usage: mkksyms kernel output\n");
+		exit(2);
+	}
+
+	if ((f = fopen(argv[1], "rb")) == NULL)
+		panic("cannot open input");
+	fseek(f, 0, SEEK_END);
+	insize = ftell(f);
+	fseek(f, 0, SEEK_SET);
+	if ((in = malloc(insize)) == NULL)
+		panic("out of memory");
+	if (fread(in, 1, insize, f) != insize)
+		panic("short read");
+	fclose(f);
+
+	elf = (struct Elf *) in;
+	if (elf->e_magic != ELF_MAGIC)
+		panic("not an ELF file");
+	sh = (struct Secthdr *) (in + elf->e_shoff);
+	for (i = 0; i < elf->e_shnum; i++)
+		if (sh[i].sh_type == ELF_SHT_SYMTAB)
+			symtab = &sh[i];
+	if (!symtab)
+		panic("no symbol table");
+	sym = (struct Sym *) (in + symtab->sh_offset);
+	nsym = symtab->sh_size / sizeof(*sym);
+	strtab = (const char *) in + sh[symtab->sh_link].sh_offset;
+
+	if ((syms = malloc(nsym * sizeof(*syms))) == NULL)
+		panic("out of memory");
+	for (i = 0; i < nsym; i++) {
+		if (ELF_ST_TYPE(sym[i].st_info) != ELF_STT_FUNC
+		    && ELF_ST_TYPE(sym[i].st_info) != ELF_STT_NOTYPE)
+			continue;
+		if (sym[i].st_shndx == ELF_SHN_UNDEF
+		    || sym[i].st_shndx >= elf->e_shnum)
+			continue;
+		code = &sh[sym[i].st_shndx];
+		// Symbols at the end of the code, such as etext, name none of it.
+		if (!(code->sh_flags & ELF_SHF_EXECINSTR)
+		    || sym[i].st_value >= code->sh_addr + code->sh_size)
+			continue;
+		syms[n].addr = sym[i].st_value;
+		syms[n].name = strtab + sym[i].st_name;
+		if (syms[n].name[0] == '\0' || syms[n].name[0] == '.')
+			continue;
+		if (strlen(syms[n].name) >= KSYM_NAME_LEN)
+			panic("symbol name too long");
+		n++;
+	}
+	qsort(syms, n, sizeof(*syms), ksym_cmp);
+
+	addrs = malloc(n * sizeof(*addrs));
+	markers = malloc((n / KSYMS_STRIDE + 1) * sizeof(*markers));
+	names = malloc(n * (KSYM_NAME_LEN + 2));
+	if (!addrs || !markers || !names)
+		panic("out of memory");
+	for (i = 0; i < n; i++) {
+		addrs[i] = syms[i].addr;
+		prefix = 0;
+		if (i % KSYMS_STRIDE == 0)
+			markers[i / KSYMS_STRIDE] = names_size;
+		else
+			while (prev[prefix] && prev[prefix] == syms[i].name[prefix])
+				prefix++;
+		len = strlen(syms[i].name) - prefix;
+		names[names_size++] = prefix;
+		names[names_size++] = len;
+		memcpy(names + names_size, syms[i].name + prefix, len);
+		names_size += len;
+		prev = syms[i].name;
+	}
+
+	ks.ks_magic = KSYMS_MAGIC;
+	ks.ks_nsyms = n;
+	ks.ks_nmarkers = (n + KSYMS_STRIDE - 1) / KSYMS_STRIDE;
+	ks.ks_names_size = names_size;
+	if ((f = fopen(argv[2], "wb")) == NULL)
+		panic("cannot open output");
+	fwrite(&ks, sizeof(ks), 1, f);
+	fwrite(addrs, sizeof(*addrs), n, f);
+	fwrite(markers, sizeof(*markers), ks.ks_nmarkers, f);
+	fwrite(names, 1, names_size, f);
+	if (fclose(f) != 0)
+		panic("cannot write output");
+
+	printf("%s: %d symbols in %u bytes\n", argv[2], n,
+	       (unsigned) (sizeof(ks) + (n + ks.ks_nmarkers) * 4 + names_size));
+	return 0;
+}
@@ -6,12 +6,17 @@
 #include <inc/memlayout.h>
 #include <inc/assert.h>
 #include <inc/x86.h>
+#include <inc/bootinfo.h>
+#include <inc/dwarf.h>
+#include <inc/ksyms.h>
 
 #include <kern/console.h>
 #include <kern/monitor.h>
 #include <kern/kdebug.h>
 
 #define CMDBUF_SIZE	80	// enough for one VGA text line
+#define BACKTRACE_DEPTH	64	// frames mon_backtrace shows
+#define BACKTRACE_INLINES	8	// inlined functions it shows in each
 
 
 struct Command {
@@ -24,6 +29,11 @@ struct Command {
 static struct Command commands[] = {
 	{ "help", "Display this list of commands", mon_help },
 	{ "kerninfo", "Display information about the kernel", mon_kerninfo },
+	{ "backtrace", "Display a backtrace of the stack", mon_backtrace },
+	{ "fnaddr", "Display the address of a function", mon_fnaddr },
+	{ "boottime", "Display where the time to boot went", mon_boottime },
+	{ "dwarfstats", "Display the cost and cache hits of debug info lookups", mon_dwarfstats },
+	{ "dwarfbench", "Time walks over all of .debug_info, with and without skipping subtrees", mon_dwarfbench },
 };
 #define NCOMMANDS (sizeof(commands)/sizeof(commands[0]))
 
@@ -43,6 +53,9 @@ int
 mon_kerninfo(int argc, char **argv, struct Trapframe *tf)
 {
 	extern char _start[], entry[], etext[], edata[], end[];
+#ifdef CONFIG_DWARF_LAZY
+	uint32_t nread, ninflated;
+#endif
 
 	cprintf("Special kernel symbols:\n");
 	cprintf("  _start                  %08x (phys)\n", (uint32_t)_start);
@@ -56,13 +69,242 @@ mon_kerninfo(int argc, char **argv, struct Trapframe *tf)
             (uint32_t)end, (uint32_t)end - KERNTOP);
 	cprintf("Kernel executable memory footprint: %dKB\n",
             (uint32_t)ROUNDUP(end - entry, 1024) / 1024);
+#ifdef CONFIG_DWARF_LAZY
+	dwarf_lazy_stats(&nread, &ninflated);
+	cprintf("Debug sections read on demand: %u bytes from disk,"
+		" %u bytes inflated\n", nread, ninflated);
+#endif
 	return 0;
 }
 
 int
 mon_backtrace(int argc, char **argv, struct Trapframe *tf)
 {
-	// Your code here.
+	uint32_t *ebps[BACKTRACE_DEPTH];
+	uintptr_t eips[BACKTRACE_DEPTH];
+	struct Eipdebuginfo info[BACKTRACE_DEPTH];
+	uint32_t *ebp = (uint32_t *) read_ebp();
+	struct Eipinline frames[BACKTRACE_INLINES + 1], *fr;
+	char name[KSYM_NAME_LEN];
+	uintptr_t offset;
+	int i, j, n, nframes;
+
+	// Walk the frames first, then look them all up at once.
+	for (n = 0; ebp && n < BACKTRACE_DEPTH; n++) {
+		ebps[n] = ebp;
+		eips[n] = ebp[1];
+		ebp = (uint32_t *) ebp[0];
+	}
+	debuginfo_eip_batch(eips, n, info);
+
+	cprintf("Stack backtrace:\n");
+	for (i = 0; i < n; i++) {
+		cprintf("  ebp %08x  eip %08x  args %08x %08x %08x %08x %08x\n",
+			(uint32_t) ebps[i], eips[i], ebps[i][2], ebps[i][3], ebps[i][4],
+			ebps[i][5], ebps[i][6]);
+		// The functions inlined at eip come before the one it is in.
+		nframes = debuginfo_eip_inline(eips[i], &info[i], frames,
+					       BACKTRACE_INLINES + 1);
+		for (j = 0; j < nframes - 1; j++)
+			cprintf("         %s:%d: %.*s (inlined)\n",
+				frames[j].ei_file, frames[j].ei_line,
+				frames[j].ei_fn_namelen, frames[j].ei_fn_name);
+		fr = &frames[nframes - 1];
+		// Without the debug information, the symbols still name it.
+		if (info[i].eip_fn_addr == eips[i]
+		    && ksym_lookup(eips[i], name, &offset)) {
+			cprintf("         %s:%d: %s+%u\n", fr->ei_file,
+				fr->ei_line, name, offset);
+			continue;
+		}
+		cprintf("         %s:%d: %.*s+%u\n", fr->ei_file, fr->ei_line,
+			info[i].eip_fn_namelen, info[i].eip_fn_name,
+			eips[i] - info[i].eip_fn_addr);
+	}
+	if (ebp)
+		cprintf("  ...\n");
+	return 0;
+}
+
+// The 8254 PIT, whose channel 2 is used to time the TSC.
+#define PIT_HZ		1193182
+#define PIT_CH2		0x42
+#define PIT_MODE	0x43
+#define PIT_GATE	0x61	// bit 0: ch. 2 gate, bit 1: speaker,
+				// bit 5: ch. 2 output
+#define TSC_CAL_MS	10
+
+// Estimate the TSC frequency by counting cycles while PIT channel 2
+// counts down TSC_CAL_MS milliseconds.  Only done the first time.
+static uint64_t
+tsc_hz(void)
+{
+	static uint64_t hz;
+	uint16_t count = PIT_HZ * TSC_CAL_MS / 1000;
+	uint64_t tsc;
+
+	if (hz)
+		return hz;
+
+	// Gate the channel on with the speaker off, then load it in
+	// mode 0, which raises the output when the count runs out.
+	outb(PIT_GATE, (inb(PIT_GATE) & ~0x02) | 0x01);
+	outb(PIT_MODE, 0xB0);	// channel 2, low byte then high, mode 0
+	outb(PIT_CH2, count & 0xFF);
+	outb(PIT_CH2, count >> 8);
+	tsc = read_tsc();
+	while (!(inb(PIT_GATE) & 0x20))
+		/* do nothing */;
+	hz = (read_tsc() - tsc) * 1000 / TSC_CAL_MS;
+	return hz;
+}
+
+static const char *bootev_names[] = {
+	[BOOTEV_LOADER] = "boot loader start",
+	[BOOTEV_PROGHDR] = "loaded program header",
+	[BOOTEV_ENTRY] = "kernel entry",
+	[BOOTEV_INIT] = "i386_init",
+	[BOOTEV_CONS] = "cons_init done",
+	[BOOTEV_DEBUGSECT] = "loaded",
+	[BOOTEV_MONITOR] = "first monitor prompt",
+};
+#define NBOOTEV_NAMES (sizeof(bootev_names)/sizeof(bootev_names[0]))
+
+int
+mon_fnaddr(int argc, char **argv, struct Trapframe *tf)
+{
+	struct Dwarf_Addrs addrs;
+	uintptr_t addr;
+	int r;
+
+	if (argc != 2) {
+		cprintf("usage: fnaddr NAME\n");
+		return 0;
+	}
+	load_kernel_dwarf_info(&addrs);
+	if ((r = address_by_fname(&addrs, argv[1], &addr)) < 0)
+		cprintf("%s: %i\n", argv[1], r);
+	else
+		cprintf("%s at %08x\n", argv[1], addr);
+	return 0;
+}
+
+int
+mon_boottime(int argc, char **argv, struct Trapframe *tf)
+{
+	struct Bootevent *ev = BOOTINFO->bi_events;
+	uint32_t i, n = MIN(BOOTINFO->bi_nevents, BOOTINFO_NEVENTS);
+	uint64_t hz = tsc_hz(), cycles, us;
+
+	if (n == 0) {
+		cprintf("No boot timeline recorded\n");
+		return 0;
+	}
+
+	cprintf("Boot timeline, TSC at about %llu MHz:\n", hz / 1000000);
+	cprintf("      cycles     time    elapsed  event\n");
+	for (i = 0; i < n; i++) {
+		cycles = i > 0 ? ev[i].be_tsc - ev[i-1].be_tsc : 0;
+		us = (ev[i].be_tsc - ev[0].be_tsc) * 1000000 / hz;
+		cprintf("%12llu %5llu us %6llu.%03llu ms  ", cycles,
+			cycles * 1000000 / hz, us / 1000, us % 1000);
+		if (ev[i].be_what >= NBOOTEV_NAMES)
+			cprintf("event %u", ev[i].be_what);
+		else
+			cprintf("%s", bootev_names[ev[i].be_what]);
+		if (ev[i].be_what == BOOTEV_PROGHDR)
+			cprintf(" %u", ev[i].be_arg);
+		else if (ev[i].be_what == BOOTEV_DEBUGSECT)
+			cprintf(" %s", debug_section_name(ev[i].be_arg));
+		cprintf("\n");
+	}
+	return 0;
+}
+
+int
+mon_dwarfstats(int argc, char **argv, struct Trapframe *tf)
+{
+	struct Dwarf_Stats *st = &dwarf_stats;
+
+	cprintf("Index memory: %u bytes\n", st->dws_arena_used);
+	cprintf("CU index: %u ranges, built in %llu cycles\n",
+		st->dws_naranges, st->dws_aranges_build);
+	cprintf("CU lookups: %u, %llu cycles each\n", st->dws_arange_lookups,
+		st->dws_arange_lookups
+		? st->dws_arange_cycles / st->dws_arange_lookups : 0);
+	cprintf("Abbreviation tables: %u decoded in %llu cycles\n",
+		st->dws_nabbrevtabs, st->dws_abbrev_build);
+	cprintf("CU cache: %u bytes used, %u hits, %u misses, %u evictions\n",
+		st->dws_cu_used, st->dws_cu_hits, st->dws_cu_misses,
+		st->dws_cu_evictions);
+	cprintf("Function indexes: %u functions, built in %llu cycles\n",
+		st->dws_nfuncs, st->dws_funcs_build);
+	cprintf("Function lookups: %u, %llu cycles each\n", st->dws_func_lookups,
+		st->dws_func_lookups
+		? st->dws_func_cycles / st->dws_func_lookups : 0);
+	cprintf("Line tables: %u decoded into %u bytes in %llu cycles\n",
+		st->dws_nlinetabs, st->dws_linetabs_size, st->dws_lines_build);
+	cprintf("Line lookups: %u, %llu cycles each\n", st->dws_line_lookups,
+		st->dws_line_lookups
+		? st->dws_line_cycles / st->dws_line_lookups : 0);
+	cprintf("Inline indexes: %u pieces, built in %llu cycles\n",
+		st->dws_ninlines, st->dws_inlines_build);
+	cprintf("Inline lookups: %u, %llu cycles each\n",
+		st->dws_inline_lookups, st->dws_inline_lookups
+		? st->dws_inline_cycles / st->dws_inline_lookups : 0);
+	cprintf("debuginfo_eip cache: %u hits, %u misses\n",
+		st->dws_eip_hits, st->dws_eip_misses);
+	cprintf("Name table: %u names, built in %llu cycles\n",
+		st->dws_nnames, st->dws_names_build);
+	cprintf("Name lookups: %u, %llu cycles each\n", st->dws_name_lookups,
+		st->dws_name_lookups
+		? st->dws_name_cycles / st->dws_name_lookups : 0);
+	return 0;
+}
+
+// A name no function has, so that looking it up walks every DIE.
+#define NO_SUCH_NAME	"-"
+
+int
+mon_dwarfbench(int argc, char **argv, struct Trapframe *tf)
+{
+	struct Dwarf_Addrs addrs;
+	struct Dwarf_CU cu;
+	const char *hdr;
+	bool skip = dwarf_skip_subtrees;
+	uint64_t tsc, names[2], funcs[2];
+	uintptr_t addr;
+	uint32_t fn_addr;
+	const char *fn_name;
+	int i;
+
+	load_kernel_dwarf_info(&addrs);
+	// Load the sections and decode the abbreviation tables first.
+	naive_address_by_fname(&addrs, NO_SUCH_NAME, &addr);
+
+	for (i = 0; i < 2; i++) {
+		dwarf_skip_subtrees = i;
+
+		tsc = read_tsc();
+		naive_address_by_fname(&addrs, NO_SUCH_NAME, &addr);
+		names[i] = read_tsc() - tsc;
+
+		// No function is at address 0, so this walks every CU.
+		tsc = read_tsc();
+		for (hdr = (const char *) addrs.info_begin;
+		     (const unsigned char *) hdr < addrs.info_end
+		     && dwarf_read_cu_header(&addrs, hdr, &cu) == 0;
+		     hdr = cu.cu_end)
+			function_by_info(&addrs, 0, hdr - (const char *) addrs.info_begin,
+					 (char *) &fn_name, sizeof(fn_name), &fn_addr);
+		funcs[i] = read_tsc() - tsc;
+	}
+	dwarf_skip_subtrees = skip;
+
+	cprintf("naive_address_by_fname: %llu cycles, %llu skipping subtrees\n",
+		names[0], names[1]);
+	cprintf("function_by_info, all CUs: %llu cycles, %llu skipping subtrees\n",
+		funcs[0], funcs[1]);
 	return 0;
 }
 
@@ -115,11 +357,16 @@ runcmd(char *buf, struct Trapframe *tf)
 void
 monitor(struct Trapframe *tf)
 {
+	static bool prompted;
 	char *buf;
 
 	cprintf("Welcome to the JOS kernel monitor!\n");
 	cprintf("Type 'help' for a list of commands.\n");
 
+	if (!prompted) {
+		prompted = 1;
+		boot_event(BOOTEV_MONITOR, 0, read_tsc());
+	}
 
 	while (1) {
 		buf = readline("K> ");
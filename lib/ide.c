@@ -0,0 +1,222 @@
+/*
+ * Minimal driver for the master disk on the primary IDE channel.
+ *
+ * It is shared by the second stage of the boot loader and the kernel,
+ * both of which run with paging off (or with an identity mapping), so
+ * buffer addresses are physical addresses.
+ *
+ * If a PCI IDE controller with bus-master support is present (the PIIX
+ * that QEMU emulates by default is one), sectors are transferred with
+ * the READ DMA command straight into the destination buffer.  Otherwise,
+ * or if a DMA transfer fails, we fall back to programmed I/O.
+ */
+
+#include <inc/x86.h>
+#include <inc/ide.h>
+
+#define MAXSECTS	255	// most sectors a single read command can take
+
+// Primary channel command block registers
+#define IDE_DATA	0x1F0
+#define IDE_NSECT	0x1F2
+#define IDE_LBA0	0x1F3
+#define IDE_LBA1	0x1F4
+#define IDE_LBA2	0x1F5
+#define IDE_DEVICE	0x1F6
+#define IDE_STATUS	0x1F7	// on read
+#define IDE_CMD		0x1F7	// on write
+
+#define IDE_BSY		0x80
+#define IDE_DRDY	0x40
+#define IDE_DF		0x20
+#define IDE_ERR		0x01
+
+#define ATA_READ_SECTORS	0x20
+#define ATA_READ_DMA		0xC8
+
+// PCI configuration space access
+#define PCI_CONF_ADDR	0xCF8
+#define PCI_CONF_DATA	0xCFC
+
+#define PCI_ID_REG	0x00
+#define PCI_CMD_REG	0x04
+#define PCI_CLASS_REG	0x08
+#define PCI_BAR4_REG	0x20
+
+#define PCI_CMD_IO	0x0001
+#define PCI_CMD_MASTER	0x0004
+
+#define PCI_CLASS_IDE	0x0101	// mass storage, IDE
+
+// Bus master IDE registers of the primary channel, relative to BAR4
+#define BM_CMD		0
+#define BM_STATUS	2
+#define BM_PRDT		4
+
+#define BM_CMD_START	0x01
+#define BM_CMD_READ	0x08	// device to memory
+
+#define BM_ST_ACTIVE	0x01
+#define BM_ST_ERR	0x02
+#define BM_ST_INTR	0x04
+
+// Physical region descriptor.  A region may not cross a 64KB boundary;
+// a byte count of 0 means 64KB.
+struct Prd {
+	uint32_t prd_addr;
+	uint16_t prd_count;
+	uint16_t prd_flags;
+};
+
+#define PRD_EOT		0x8000	// last descriptor in the table
+
+// MAXSECTS sectors span less than 128KB, so at most three descriptors.
+// The table must not cross a 64KB boundary either, hence the alignment.
+#define NPRD		4
+static struct Prd prdt[NPRD] __attribute__((aligned(sizeof(struct Prd) * NPRD)));
+
+static bool ide_probed;
+static uint16_t ide_bmbase;	// bus master I/O base, 0 if no DMA
+
+static int
+ide_wait_ready(void)
+{
+	int r;
+
+	while (((r = inb(IDE_STATUS)) & (IDE_BSY|IDE_DRDY)) != IDE_DRDY)
+		/* do nothing */;
+	return (r & (IDE_DF|IDE_ERR)) ? -1 : 0;
+}
+
+static void
+ide_command(uint32_t secno, size_t nsecs, uint8_t cmd)
+{
+	ide_wait_ready();
+
+	outb(IDE_NSECT, nsecs);
+	outb(IDE_LBA0, secno);
+	outb(IDE_LBA1, secno >> 8);
+	outb(IDE_LBA2, secno >> 16);
+	outb(IDE_DEVICE, (secno >> 24) | 0xE0);
+	outb(IDE_CMD, cmd);
+}
+
+static uint32_t
+pci_conf_read(int dev, int func, int reg)
+{
+	outl(PCI_CONF_ADDR, 0x80000000 | (dev << 11) | (func << 8) | reg);
+	return inl(PCI_CONF_DATA);
+}
+
+static void
+pci_conf_write(int dev, int func, int reg, uint32_t v)
+{
+	outl(PCI_CONF_ADDR, 0x80000000 | (dev << 11) | (func << 8) | reg);
+	outl(PCI_CONF_DATA, v);
+}
+
+// Look for a bus-master capable IDE controller on PCI bus 0 that still
+// decodes the legacy primary channel ports, and enable bus mastering.
+static void
+ide_probe(void)
+{
+	int dev, func;
+	uint32_t class, bar;
+
+	ide_probed = 1;
+
+	for (dev = 0; dev < 32; dev++)
+		for (func = 0; func < 8; func++) {
+			if ((pci_conf_read(dev, func, PCI_ID_REG) & 0xFFFF) == 0xFFFF)
+				continue;
+			class = pci_conf_read(dev, func, PCI_CLASS_REG);
+			// prog-if bit 0: primary channel in native mode,
+			// bit 7: bus master capable
+			if ((class >> 16) != PCI_CLASS_IDE
+			    || (class & 0x0100) || !(class & 0x8000))
+				continue;
+			bar = pci_conf_read(dev, func, PCI_BAR4_REG);
+			if (!(bar & 1) || !(bar & ~3))
+				continue;
+			pci_conf_write(dev, func, PCI_CMD_REG,
+				       pci_conf_read(dev, func, PCI_CMD_REG)
+				       | PCI_CMD_IO | PCI_CMD_MASTER);
+			ide_bmbase = bar & 0xFFFC;
+			return;
+		}
+}
+
+static int
+ide_read_dma(uint32_t secno, void *dst, size_t nsecs)
+{
+	uint32_t pa = (uint32_t) dst, len = nsecs * SECTSIZE, n;
+	int i, r;
+
+	for (i = 0; len > 0; i++, pa += n, len -= n) {
+		n = MIN(len, 0x10000 - (pa & 0xFFFF));
+		prdt[i].prd_addr = pa;
+		prdt[i].prd_count = n;
+		prdt[i].prd_flags = 0;
+	}
+	prdt[i - 1].prd_flags = PRD_EOT;
+
+	outl(ide_bmbase + BM_PRDT, (uint32_t) prdt);
+	outb(ide_bmbase + BM_CMD, BM_CMD_READ);
+	outb(ide_bmbase + BM_STATUS, BM_ST_ERR | BM_ST_INTR);	// write 1 to clear
+
+	ide_command(secno, nsecs, ATA_READ_DMA);
+	outb(ide_bmbase + BM_CMD, BM_CMD_READ | BM_CMD_START);
+
+	// Wait for the controller to run out of descriptors or for the
+	// drive to signal completion.  We run with interrupts disabled, so
+	// the IRQ itself never gets delivered; only its status bit is seen.
+	while (((r = inb(ide_bmbase + BM_STATUS)) & BM_ST_ACTIVE)
+	       && !(r & (BM_ST_INTR|BM_ST_ERR)))
+		/* do nothing */;
+
+	outb(ide_bmbase + BM_CMD, 0);
+	outb(ide_bmbase + BM_STATUS, BM_ST_ERR | BM_ST_INTR);
+	if (ide_wait_ready() < 0 || (r & BM_ST_ERR))
+		return -1;
+	return 0;
+}
+
+static void
+ide_read_pio(uint32_t secno, void *dst, size_t nsecs)
+{
+	ide_command(secno, nsecs, ATA_READ_SECTORS);
+
+	// the drive has the next sector ready each time it drops BSY
+	for (; nsecs > 0; nsecs--, dst += SECTSIZE) {
+		ide_wait_ready();
+		insl(IDE_DATA, dst, SECTSIZE/4);
+	}
+}
+
+// Read 'nsecs' sectors starting at sector 'secno' to physical address 'dst'.
+void
+ide_read(uint32_t secno, void *dst, size_t nsecs)
+{
+	size_t n;
+
+	if (!ide_probed)
+		ide_probe();
+
+	for (; nsecs > 0; nsecs -= n, secno += n, dst += n * SECTSIZE) {
+		n = MIN(nsecs, MAXSECTS);
+		if (ide_bmbase && ide_read_dma(secno, dst, n) == 0)
+			continue;
+		// Don't try DMA again after it failed once.
+		ide_bmbase = 0;
+		ide_read_pio(secno, dst, n);
+	}
+}
+
+// Whether transfers go through bus-master DMA.
+bool
+ide_dma_enabled(void)
+{
+	if (!ide_probed)
+		ide_probe();
+	return ide_bmbase != 0;
+}
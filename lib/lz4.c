@@ -0,0 +1,80 @@
+/*
+ * Decompressor for the LZ4 block format.
+ *
+ * A block is a sequence of (literals, match) pairs.  Each starts with a
+ * token byte whose high nibble is the number of literal bytes and whose
+ * low nibble is the match length minus 4; a nibble of 15 means more
+ * length bytes follow, each added in until one is not 255.  The literals
+ * come next, then the match offset as 2 little-endian bytes.  The last
+ * sequence of a block has literals only.
+ *
+ * Used by the boot loader to inflate the kernel's segments, which the
+ * build packs with boot/lz4pack.
+ */
+
+#include <inc/string.h>
+#include <inc/lz4.h>
+
+// Read an extended length.  Returns -1 if the input runs out.
+static int
+lz4_length(const uint8_t **ip, const uint8_t *iend, size_t *len)
+{
+	uint8_t b;
+
+	do {
+		if (*ip >= iend)
+			return -1;
+		b = *(*ip)++;
+		*len += b;
+	} while (b == 255);
+	return 0;
+}
+
+// Inflate the 'srclen' byte block at 'src' into 'dst', writing at most
+// 'dstlen' bytes.  Returns the number of bytes written, or -1 if the
+// block is malformed or does not fit.
+int
+lz4_decompress(const void *src, size_t srclen, void *dst, size_t dstlen)
+{
+	const uint8_t *ip = src, *iend = ip + srclen, *m;
+	uint8_t *op = dst, *oend = op + dstlen;
+	size_t len, off;
+	uint8_t token;
+
+	while (ip < iend) {
+		token = *ip++;
+
+		len = token >> 4;
+		if (len == 15 && lz4_length(&ip, iend, &len) < 0)
+			return -1;
+		if (len > (size_t) (iend - ip) || len > (size_t) (oend - op))
+			return -1;
+		memcpy(op, ip, len);
+		ip += len;
+		op += len;
+
+		// the last sequence ends right after its literals
+		if (ip == iend)
+			break;
+
+		if (iend - ip < 2)
+			return -1;
+		off = ip[0] | (ip[1] << 8);
+		ip += 2;
+		if (off == 0 || off > (size_t) (op - (uint8_t *) dst))
+			return -1;
+
+		len = token & 15;
+		if (len == 15 && lz4_length(&ip, iend, &len) < 0)
+			return -1;
+		len += 4;
+		if (len > (size_t) (oend - op))
+			return -1;
+
+		// The match may overlap the bytes it produces (a run), so
+		// copy forward one byte at a time.
+		for (m = op - off; len > 0; len--)
+			*op++ = *m++;
+	}
+	return op - (uint8_t *) dst;
+}
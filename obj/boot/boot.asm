@@ -0,0 +1,205 @@
+
+obj/boot/boot.out:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00007c00 <start>:
+.set SECTSIZE,       512
+
+.globl start
+start:
+  .code16                     # Assemble for 16-bit mode
+  cli                         # Disable interrupts
+    7c00:	fa                   	cli
+  cld                         # String operations increment
+    7c01:	fc                   	cld
+
+  # Set up the important data segment registers (DS, ES, SS).
+  xorw    %ax,%ax             # Segment number zero
+    7c02:	31 c0                	xor    %eax,%eax
+  movw    %ax,%ds             # -> Data Segment
+    7c04:	8e d8                	mov    %eax,%ds
+  movw    %ax,%es             # -> Extra Segment
+    7c06:	8e c0                	mov    %eax,%es
+  movw    %ax,%ss             # -> Stack Segment
+    7c08:	8e d0                	mov    %eax,%ss
+
+00007c0a <seta20.1>:
+  # Enable A20:
+  #   For backwards compatibility with the earliest PCs, physical
+  #   address line 20 is tied low, so that addresses higher than
+  #   1MB wrap around to zero by default.  This code undoes this.
+seta20.1:
+  inb     $0x64,%al               # Wait for not busy
+    7c0a:	e4 64                	in     $0x64,%al
+  testb   $0x2,%al
+    7c0c:	a8 02                	test   $0x2,%al
+  jnz     seta20.1
+    7c0e:	75 fa                	jne    7c0a <seta20.1>
+
+  movb    $0xd1,%al               # 0xd1 -> port 0x64
+    7c10:	b0 d1                	mov    $0xd1,%al
+  outb    %al,$0x64
+    7c12:	e6 64                	out    %al,$0x64
+
+00007c14 <seta20.2>:
+
+seta20.2:
+  inb     $0x64,%al               # Wait for not busy
+    7c14:	e4 64                	in     $0x64,%al
+  testb   $0x2,%al
+    7c16:	a8 02                	test   $0x2,%al
+  jnz     seta20.2
+    7c18:	75 fa                	jne    7c14 <seta20.2>
+
+  movb    $0xdf,%al               # 0xdf -> port 0x60
+    7c1a:	b0 df                	mov    $0xdf,%al
+  outb    %al,$0x60
+    7c1c:	e6 60                	out    %al,$0x60
+
+  # Switch from real to protected mode, using a bootstrap GDT
+  # and segment translation that makes virtual addresses 
+  # identical to their physical addresses, so that the 
+  # effective memory map does not change during the switch.
+  lgdt    gdtdesc
+    7c1e:	0f 01 16             	lgdtl  (%esi)
+    7c21:	b0 7c                	mov    $0x7c,%al
+  movl    %cr0, %eax
+    7c23:	0f 20 c0             	mov    %cr0,%eax
+  orl     $CR0_PE_ON, %eax
+    7c26:	66 83 c8 01          	or     $0x1,%ax
+  movl    %eax, %cr0
+    7c2a:	0f 22 c0             	mov    %eax,%cr0
+  
+  # Jump to next instruction, but in 32-bit code segment.
+  # Switches processor into 32-bit mode.
+  ljmp    $PROT_MODE_CSEG, $protcseg
+    7c2d:	ea                   	.byte 0xea
+    7c2e:	32 7c 08 00          	xor    0x0(%eax,%ecx,1),%bh
+
+00007c32 <protcseg>:
+
+  .code32                     # Assemble for 32-bit mode
+protcseg:
+  # Set up the protected-mode data segment registers
+  movw    $PROT_MODE_DSEG, %ax    # Our data segment selector
+    7c32:	66 b8 10 00          	mov    $0x10,%ax
+  movw    %ax, %ds                # -> DS: Data Segment
+    7c36:	8e d8                	mov    %eax,%ds
+  movw    %ax, %es                # -> ES: Extra Segment
+    7c38:	8e c0                	mov    %eax,%es
+  movw    %ax, %fs                # -> FS
+    7c3a:	8e e0                	mov    %eax,%fs
+  movw    %ax, %gs                # -> GS
+    7c3c:	8e e8                	mov    %eax,%gs
+  movw    %ax, %ss                # -> SS: Stack Segment
+    7c3e:	8e d0                	mov    %eax,%ss
+  
+  # Set up the stack pointer; stage 2 keeps using it.
+  movl    $start, %esp
+    7c40:	bc 00 7c 00 00       	mov    $0x7c00,%esp
+
+  # Read stage 2 (sectors 1..BOOT2_NSECT) to BOOT2_START with a single
+  # READ SECTORS command, then drain it one sector at a time.
+  call    waitdisk
+    7c45:	e8 41 00 00 00       	call   7c8b <waitdisk>
+  movw    $0x1F2, %dx
+    7c4a:	66 ba f2 01          	mov    $0x1f2,%dx
+  movb    $BOOT2_NSECT, %al
+    7c4e:	b0 10                	mov    $0x10,%al
+  outb    %al, %dx                # count = BOOT2_NSECT
+    7c50:	ee                   	out    %al,(%dx)
+  incw    %dx
+    7c51:	66 42                	inc    %dx
+  movb    $1, %al
+    7c53:	b0 01                	mov    $0x1,%al
+  outb    %al, %dx                # LBA 0..7 = 1
+    7c55:	ee                   	out    %al,(%dx)
+  incw    %dx
+    7c56:	66 42                	inc    %dx
+  xorb    %al, %al
+    7c58:	30 c0                	xor    %al,%al
+  outb    %al, %dx                # LBA 8..15 = 0
+    7c5a:	ee                   	out    %al,(%dx)
+  incw    %dx
+    7c5b:	66 42                	inc    %dx
+  outb    %al, %dx                # LBA 16..23 = 0
+    7c5d:	ee                   	out    %al,(%dx)
+  incw    %dx
+    7c5e:	66 42                	inc    %dx
+  movb    $0xE0, %al
+    7c60:	b0 e0                	mov    $0xe0,%al
+  outb    %al, %dx                # LBA mode, drive 0, LBA 24..27 = 0
+    7c62:	ee                   	out    %al,(%dx)
+  incw    %dx
+    7c63:	66 42                	inc    %dx
+  movb    $0x20, %al
+    7c65:	b0 20                	mov    $0x20,%al
+  outb    %al, %dx                # cmd 0x20 - read sectors
+    7c67:	ee                   	out    %al,(%dx)
+
+  movl    $BOOT2_START, %edi
+    7c68:	bf 00 7e 00 00       	mov    $0x7e00,%edi
+  movl    $BOOT2_NSECT, %ebx
+    7c6d:	bb 10 00 00 00       	mov    $0x10,%ebx
+
+00007c72 <readsect>:
+readsect:
+  call    waitdisk
+    7c72:	e8 14 00 00 00       	call   7c8b <waitdisk>
+  movw    $0x1F0, %dx
+    7c77:	66 ba f0 01          	mov    $0x1f0,%dx
+  movl    $(SECTSIZE/4), %ecx
+    7c7b:	b9 80 00 00 00       	mov    $0x80,%ecx
+  cld
+    7c80:	fc                   	cld
+  rep insl
+    7c81:	f3 6d                	rep insl (%dx),%es:(%edi)
+  decl    %ebx
+    7c83:	4b                   	dec    %ebx
+  jnz     readsect
+    7c84:	75 ec                	jne    7c72 <readsect>
+
+  # Jump into stage 2.
+  jmp     BOOT2_START
+    7c86:	e9 75 01 00 00       	jmp    7e00 <_end+0x148>
+
+00007c8b <waitdisk>:
+
+# Wait for the disk to be ready (BSY clear, DRDY set).
+waitdisk:
+  movw    $0x1F7, %dx
+    7c8b:	66 ba f7 01          	mov    $0x1f7,%dx
+
+00007c8f <waitdisk.1>:
+waitdisk.1:
+  inb     %dx, %al
+    7c8f:	ec                   	in     (%dx),%al
+  andb    $0xC0, %al
+    7c90:	24 c0                	and    $0xc0,%al
+  cmpb    $0x40, %al
+    7c92:	3c 40                	cmp    $0x40,%al
+  jne     waitdisk.1
+    7c94:	75 f9                	jne    7c8f <waitdisk.1>
+  ret
+    7c96:	c3                   	ret
+    7c97:	90                   	nop
+
+00007c98 <gdt>:
+	...
+    7ca0:	ff                   	(bad)
+    7ca1:	ff 00                	incl   (%eax)
+    7ca3:	00 00                	add    %al,(%eax)
+    7ca5:	9a cf 00 ff ff 00 00 	lcall  $0x0,$0xffff00cf
+    7cac:	00                   	.byte 0x0
+    7cad:	92                   	xchg   %eax,%edx
+    7cae:	cf                   	iret
+	...
+
+00007cb0 <gdtdesc>:
+    7cb0:	17                   	pop    %ss
+    7cb1:	00                   	.byte 0x0
+    7cb2:	98                   	cwtl
+    7cb3:	7c 00                	jl     7cb5 <gdtdesc+0x5>
+	...
@@ -0,0 +1,1713 @@
+
+obj/boot/boot2.out:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00007e00 <start2>:
+# sector, so all that is left to do here is to clear our BSS (it is not
+# part of the image on disk) and call into C.
+
+.globl start2
+start2:
+  movl    $edata, %edi
+    7e00:	bf 10 8d 00 00       	mov    $0x8d10,%edi
+  movl    $end, %ecx
+    7e05:	b9 60 8d 00 00       	mov    $0x8d60,%ecx
+  subl    %edi, %ecx
+    7e0a:	29 f9                	sub    %edi,%ecx
+  xorl    %eax, %eax
+    7e0c:	31 c0                	xor    %eax,%eax
+  cld
+    7e0e:	fc                   	cld
+  rep stosb
+    7e0f:	f3 aa                	rep stos %al,%es:(%edi)
+
+  call    bootmain
+    7e11:	e8 0a 00 00 00       	call   7e20 <bootmain>
+
+00007e16 <spin>:
+
+  # If bootmain returns (it shouldn't), loop.
+spin:
+  jmp     spin
+    7e16:	eb fe                	jmp    7e16 <spin>
+    7e18:	66 90                	xchg   %ax,%ax
+    7e1a:	66 90                	xchg   %ax,%ax
+    7e1c:	66 90                	xchg   %ax,%ax
+    7e1e:	66 90                	xchg   %ax,%ax
+
+00007e20 <bootmain>:
+
+static void readseg(uint32_t, uint32_t, uint32_t);
+
+void
+bootmain(void)
+{
+    7e20:	55                   	push   %ebp
+    7e21:	89 e5                	mov    %esp,%ebp
+    7e23:	57                   	push   %edi
+    7e24:	56                   	push   %esi
+    7e25:	53                   	push   %ebx
+    7e26:	83 ec 20             	sub    $0x20,%esp
+
+static __inline uint64_t
+read_tsc(void)
+{
+	uint64_t tsc;
+	__asm __volatile("rdtsc" : "=A" (tsc));
+    7e29:	0f 31                	rdtsc
+	uint32_t src;
+	uint64_t tsc;
+	int n;
+
+	BOOTINFO->bi_load_start = read_tsc();
+	BOOTINFO->bi_kernsect = KERNSECT;
+    7e2b:	c7 05 08 10 00 00 11 	movl   $0x11,0x1008
+    7e32:	00 00 00 
+	BOOTINFO->bi_load_start = read_tsc();
+    7e35:	a3 0c 10 00 00       	mov    %eax,0x100c
+    7e3a:	89 15 10 10 00 00    	mov    %edx,0x1010
+	BOOTINFO->bi_inflate = 0;
+    7e40:	c7 05 1c 10 00 00 00 	movl   $0x0,0x101c
+    7e47:	00 00 00 
+    7e4a:	c7 05 20 10 00 00 00 	movl   $0x0,0x1020
+    7e51:	00 00 00 
+	BOOTINFO->bi_flags = 0;
+    7e54:	c7 05 04 10 00 00 00 	movl   $0x0,0x1004
+    7e5b:	00 00 00 
+{
+	struct Bootevent *ev;
+
+	if (BOOTINFO->bi_nevents >= BOOTINFO_NEVENTS)
+		return;
+	ev = &BOOTINFO->bi_events[BOOTINFO->bi_nevents++];
+    7e5e:	c7 05 24 10 00 00 01 	movl   $0x1,0x1024
+    7e65:	00 00 00 
+	ev->be_what = what;
+    7e68:	c7 05 28 10 00 00 00 	movl   $0x0,0x1028
+    7e6f:	00 00 00 
+	ev->be_arg = arg;
+    7e72:	c7 05 2c 10 00 00 00 	movl   $0x0,0x102c
+    7e79:	00 00 00 
+	ev->be_tsc = tsc;
+    7e7c:	a3 30 10 00 00       	mov    %eax,0x1030
+    7e81:	89 15 34 10 00 00    	mov    %edx,0x1034
+	// Since we haven't enabled paging yet and we're using
+	// an identity segment mapping (see boot.S), we can
+	// use physical addresses directly.  This won't be the
+	// case once JOS enables the MMU.
+	if (pa < end_pa)
+		ide_read(offset, (void *) pa, (end_pa - pa + SECTSIZE - 1) / SECTSIZE);
+    7e87:	6a 08                	push   $0x8
+    7e89:	68 00 00 01 00       	push   $0x10000
+    7e8e:	6a 11                	push   $0x11
+    7e90:	e8 db 02 00 00       	call   8170 <ide_read>
+	if (ELFHDR->e_magic != ELF_MAGIC)
+    7e95:	83 c4 10             	add    $0x10,%esp
+    7e98:	81 3d 00 00 01 00 7f 	cmpl   $0x464c457f,0x10000
+    7e9f:	45 4c 46 
+    7ea2:	0f 85 a8 01 00 00    	jne    8050 <bootmain+0x230>
+	bph = ph = (struct Proghdr *) ((uint8_t *) ELFHDR + ELFHDR->e_phoff);
+    7ea8:	a1 1c 00 01 00       	mov    0x1001c,%eax
+    7ead:	8d b0 00 00 01 00    	lea    0x10000(%eax),%esi
+	eph = ph + ELFHDR->e_phnum;
+    7eb3:	0f b7 05 2c 00 01 00 	movzwl 0x1002c,%eax
+	bph = ph = (struct Proghdr *) ((uint8_t *) ELFHDR + ELFHDR->e_phoff);
+    7eba:	89 75 e0             	mov    %esi,-0x20(%ebp)
+	eph = ph + ELFHDR->e_phnum;
+    7ebd:	c1 e0 05             	shl    $0x5,%eax
+    7ec0:	01 f0                	add    %esi,%eax
+    7ec2:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	for (; ph < eph; ph++) {
+    7ec5:	e9 b9 00 00 00       	jmp    7f83 <bootmain+0x163>
+    7eca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+			src = LZ4BUF + ph->p_offset % SECTSIZE;
+    7ed0:	81 e7 ff 01 00 00    	and    $0x1ff,%edi
+    7ed6:	81 c7 00 00 80 00    	add    $0x800000,%edi
+	end_pa = pa + count;
+    7edc:	8d 14 1f             	lea    (%edi,%ebx,1),%edx
+	if (pa < end_pa)
+    7edf:	81 fa 00 00 80 00    	cmp    $0x800000,%edx
+    7ee5:	0f 87 7a 01 00 00    	ja     8065 <bootmain+0x245>
+    7eeb:	0f 31                	rdtsc
+    7eed:	89 45 d8             	mov    %eax,-0x28(%ebp)
+    7ef0:	89 55 dc             	mov    %edx,-0x24(%ebp)
+			n = lz4_decompress((void *) src, ph->p_filesz,
+    7ef3:	ff 76 14             	push   0x14(%esi)
+    7ef6:	ff 76 0c             	push   0xc(%esi)
+    7ef9:	53                   	push   %ebx
+    7efa:	57                   	push   %edi
+    7efb:	e8 00 05 00 00       	call   8400 <lz4_decompress>
+    7f00:	89 c3                	mov    %eax,%ebx
+    7f02:	0f 31                	rdtsc
+			BOOTINFO->bi_inflate += read_tsc() - tsc;
+    7f04:	2b 45 d8             	sub    -0x28(%ebp),%eax
+    7f07:	1b 55 dc             	sbb    -0x24(%ebp),%edx
+    7f0a:	01 05 1c 10 00 00    	add    %eax,0x101c
+    7f10:	11 15 20 10 00 00    	adc    %edx,0x1020
+			if (n < 0)
+    7f16:	83 c4 10             	add    $0x10,%esp
+    7f19:	85 db                	test   %ebx,%ebx
+    7f1b:	0f 88 2f 01 00 00    	js     8050 <bootmain+0x230>
+		stosb((uint8_t *) ph->p_pa + n, 0, ph->p_memsz - n);
+    7f21:	8b 7e 0c             	mov    0xc(%esi),%edi
+    7f24:	01 df                	add    %ebx,%edi
+    7f26:	8b 4e 14             	mov    0x14(%esi),%ecx
+	__asm __volatile("cld\n\trepne\n\tstosb"			:
+    7f29:	31 c0                	xor    %eax,%eax
+    7f2b:	29 d9                	sub    %ebx,%ecx
+    7f2d:	fc                   	cld
+    7f2e:	f2 aa                	repnz stos %al,%es:(%edi)
+		if (ph->p_va == 0)
+    7f30:	8b 46 08             	mov    0x8(%esi),%eax
+    7f33:	85 c0                	test   %eax,%eax
+    7f35:	0f 85 ad 00 00 00    	jne    7fe8 <bootmain+0x1c8>
+	__asm __volatile("rdtsc" : "=A" (tsc));
+    7f3b:	0f 31                	rdtsc
+    7f3d:	89 c1                	mov    %eax,%ecx
+	if (BOOTINFO->bi_nevents >= BOOTINFO_NEVENTS)
+    7f3f:	a1 24 10 00 00       	mov    0x1024,%eax
+			boot_event(BOOTEV_DEBUGSECT, ph->p_pa, read_tsc());
+    7f44:	8b 7e 0c             	mov    0xc(%esi),%edi
+    7f47:	89 d3                	mov    %edx,%ebx
+    7f49:	83 f8 1f             	cmp    $0x1f,%eax
+    7f4c:	77 32                	ja     7f80 <bootmain+0x160>
+	ev = &BOOTINFO->bi_events[BOOTINFO->bi_nevents++];
+    7f4e:	8d 50 01             	lea    0x1(%eax),%edx
+    7f51:	c1 e0 04             	shl    $0x4,%eax
+    7f54:	89 15 24 10 00 00    	mov    %edx,0x1024
+	ev->be_what = what;
+    7f5a:	c7 80 28 10 00 00 05 	movl   $0x5,0x1028(%eax)
+    7f61:	00 00 00 
+	ev->be_arg = arg;
+    7f64:	89 b8 2c 10 00 00    	mov    %edi,0x102c(%eax)
+	ev->be_tsc = tsc;
+    7f6a:	89 88 30 10 00 00    	mov    %ecx,0x1030(%eax)
+    7f70:	89 98 34 10 00 00    	mov    %ebx,0x1034(%eax)
+    7f76:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    7f7d:	8d 76 00             	lea    0x0(%esi),%esi
+	for (; ph < eph; ph++) {
+    7f80:	83 c6 20             	add    $0x20,%esi
+    7f83:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    7f86:	39 c6                	cmp    %eax,%esi
+    7f88:	0f 83 9e 00 00 00    	jae    802c <bootmain+0x20c>
+		if (ph->p_type != ELF_PROG_LOAD)
+    7f8e:	83 3e 01             	cmpl   $0x1,(%esi)
+    7f91:	75 ed                	jne    7f80 <bootmain+0x160>
+			src = LZ4BUF + ph->p_offset % SECTSIZE;
+    7f93:	8b 7e 04             	mov    0x4(%esi),%edi
+			readseg(src, ph->p_filesz, ph->p_offset);
+    7f96:	8b 5e 10             	mov    0x10(%esi),%ebx
+	offset = (offset / SECTSIZE) + KERNSECT;
+    7f99:	89 f8                	mov    %edi,%eax
+    7f9b:	c1 e8 09             	shr    $0x9,%eax
+    7f9e:	83 c0 11             	add    $0x11,%eax
+		if (ph->p_flags & ELF_PROG_FLAG_LZ4) {
+    7fa1:	f6 46 1a 10          	testb  $0x10,0x1a(%esi)
+    7fa5:	0f 85 25 ff ff ff    	jne    7ed0 <bootmain+0xb0>
+			readseg(ph->p_pa, ph->p_filesz, ph->p_offset);
+    7fab:	8b 56 0c             	mov    0xc(%esi),%edx
+	end_pa = pa + count;
+    7fae:	8d 3c 1a             	lea    (%edx,%ebx,1),%edi
+	pa &= ~(SECTSIZE - 1);
+    7fb1:	81 e2 00 fe ff ff    	and    $0xfffffe00,%edx
+	if (pa < end_pa)
+    7fb7:	39 fa                	cmp    %edi,%edx
+    7fb9:	0f 83 67 ff ff ff    	jae    7f26 <bootmain+0x106>
+		ide_read(offset, (void *) pa, (end_pa - pa + SECTSIZE - 1) / SECTSIZE);
+    7fbf:	51                   	push   %ecx
+    7fc0:	8d 8f ff 01 00 00    	lea    0x1ff(%edi),%ecx
+    7fc6:	29 d1                	sub    %edx,%ecx
+    7fc8:	c1 e9 09             	shr    $0x9,%ecx
+    7fcb:	51                   	push   %ecx
+    7fcc:	52                   	push   %edx
+    7fcd:	50                   	push   %eax
+    7fce:	e8 9d 01 00 00       	call   8170 <ide_read>
+			n = ph->p_filesz;
+    7fd3:	8b 5e 10             	mov    0x10(%esi),%ebx
+		stosb((uint8_t *) ph->p_pa + n, 0, ph->p_memsz - n);
+    7fd6:	8b 7e 0c             	mov    0xc(%esi),%edi
+    7fd9:	83 c4 10             	add    $0x10,%esp
+    7fdc:	01 df                	add    %ebx,%edi
+    7fde:	e9 43 ff ff ff       	jmp    7f26 <bootmain+0x106>
+    7fe3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    7fe7:	90                   	nop
+    7fe8:	0f 31                	rdtsc
+    7fea:	89 d3                	mov    %edx,%ebx
+	if (BOOTINFO->bi_nevents >= BOOTINFO_NEVENTS)
+    7fec:	8b 15 24 10 00 00    	mov    0x1024,%edx
+    7ff2:	89 c1                	mov    %eax,%ecx
+    7ff4:	83 fa 1f             	cmp    $0x1f,%edx
+    7ff7:	77 87                	ja     7f80 <bootmain+0x160>
+	ev = &BOOTINFO->bi_events[BOOTINFO->bi_nevents++];
+    7ff9:	8d 42 01             	lea    0x1(%edx),%eax
+			boot_event(BOOTEV_PROGHDR, ph - bph, read_tsc());
+    7ffc:	8b 7d e0             	mov    -0x20(%ebp),%edi
+    7fff:	c1 e2 04             	shl    $0x4,%edx
+    8002:	a3 24 10 00 00       	mov    %eax,0x1024
+    8007:	8d 82 28 10 00 00    	lea    0x1028(%edx),%eax
+	ev->be_what = what;
+    800d:	c7 82 28 10 00 00 01 	movl   $0x1,0x1028(%edx)
+    8014:	00 00 00 
+    8017:	89 f2                	mov    %esi,%edx
+    8019:	29 fa                	sub    %edi,%edx
+	ev->be_tsc = tsc;
+    801b:	89 48 08             	mov    %ecx,0x8(%eax)
+    801e:	c1 fa 05             	sar    $0x5,%edx
+    8021:	89 58 0c             	mov    %ebx,0xc(%eax)
+	ev->be_arg = arg;
+    8024:	89 50 04             	mov    %edx,0x4(%eax)
+	ev->be_tsc = tsc;
+    8027:	e9 54 ff ff ff       	jmp    7f80 <bootmain+0x160>
+    802c:	0f 31                	rdtsc
+	BOOTINFO->bi_flags |= BOOTINFO_BSS_ZEROED;
+    802e:	83 0d 04 10 00 00 01 	orl    $0x1,0x1004
+	BOOTINFO->bi_load_end = read_tsc();
+    8035:	a3 14 10 00 00       	mov    %eax,0x1014
+    803a:	89 15 18 10 00 00    	mov    %edx,0x1018
+	BOOTINFO->bi_magic = BOOTINFO_MAGIC;
+    8040:	c7 05 00 10 00 00 42 	movl   $0x4a4f5342,0x1000
+    8047:	53 4f 4a 
+	((void (*)(void)) (ELFHDR->e_entry))();
+    804a:	ff 15 18 00 01 00    	call   *0x10018
+	__asm __volatile("outw %0,%w1" : : "a" (data), "d" (port));
+    8050:	ba 00 8a 00 00       	mov    $0x8a00,%edx
+    8055:	b8 00 8a ff ff       	mov    $0xffff8a00,%eax
+    805a:	66 ef                	out    %ax,(%dx)
+    805c:	b8 00 8e ff ff       	mov    $0xffff8e00,%eax
+    8061:	66 ef                	out    %ax,(%dx)
+	while (1)
+    8063:	eb fe                	jmp    8063 <bootmain+0x243>
+		ide_read(offset, (void *) pa, (end_pa - pa + SECTSIZE - 1) / SECTSIZE);
+    8065:	81 ea 01 fe 7f 00    	sub    $0x7ffe01,%edx
+    806b:	53                   	push   %ebx
+    806c:	c1 ea 09             	shr    $0x9,%edx
+    806f:	52                   	push   %edx
+    8070:	68 00 00 80 00       	push   $0x800000
+    8075:	50                   	push   %eax
+    8076:	e8 f5 00 00 00       	call   8170 <ide_read>
+			n = lz4_decompress((void *) src, ph->p_filesz,
+    807b:	8b 5e 10             	mov    0x10(%esi),%ebx
+    807e:	83 c4 10             	add    $0x10,%esp
+    8081:	e9 65 fe ff ff       	jmp    7eeb <bootmain+0xcb>
+    8086:	66 90                	xchg   %ax,%ax
+    8088:	66 90                	xchg   %ax,%ax
+    808a:	66 90                	xchg   %ax,%ax
+    808c:	66 90                	xchg   %ax,%ax
+    808e:	66 90                	xchg   %ax,%ax
+
+00008090 <ide_probe>:
+
+// Look for a bus-master capable IDE controller on PCI bus 0 that still
+// decodes the legacy primary channel ports, and enable bus mastering.
+static void
+ide_probe(void)
+{
+    8090:	55                   	push   %ebp
+	int dev, func;
+	uint32_t class, bar;
+
+	ide_probed = 1;
+    8091:	c6 05 22 8d 00 00 01 	movb   $0x1,0x8d22
+{
+    8098:	89 e5                	mov    %esp,%ebp
+    809a:	57                   	push   %edi
+	__asm __volatile("outl %0,%w1" : : "a" (data), "d" (port));
+    809b:	bf f8 0c 00 00       	mov    $0xcf8,%edi
+    80a0:	56                   	push   %esi
+	ide_probed = 1;
+    80a1:	31 f6                	xor    %esi,%esi
+{
+    80a3:	53                   	push   %ebx
+    80a4:	31 c9                	xor    %ecx,%ecx
+	outl(PCI_CONF_ADDR, 0x80000000 | (dev << 11) | (func << 8) | reg);
+    80a6:	89 f3                	mov    %esi,%ebx
+    80a8:	89 fa                	mov    %edi,%edx
+    80aa:	09 cb                	or     %ecx,%ebx
+    80ac:	89 d8                	mov    %ebx,%eax
+    80ae:	0d 00 00 00 80       	or     $0x80000000,%eax
+    80b3:	ef                   	out    %eax,(%dx)
+	__asm __volatile("inl %w1,%0" : "=a" (data) : "d" (port));
+    80b4:	ba fc 0c 00 00       	mov    $0xcfc,%edx
+    80b9:	ed                   	in     (%dx),%eax
+
+	for (dev = 0; dev < 32; dev++)
+		for (func = 0; func < 8; func++) {
+			if ((pci_conf_read(dev, func, PCI_ID_REG) & 0xFFFF) == 0xFFFF)
+    80ba:	0f b7 c0             	movzwl %ax,%eax
+    80bd:	3d ff ff 00 00       	cmp    $0xffff,%eax
+    80c2:	74 7c                	je     8140 <ide_probe+0xb0>
+	__asm __volatile("outl %0,%w1" : : "a" (data), "d" (port));
+    80c4:	89 d8                	mov    %ebx,%eax
+    80c6:	89 fa                	mov    %edi,%edx
+    80c8:	0d 08 00 00 80       	or     $0x80000008,%eax
+    80cd:	ef                   	out    %eax,(%dx)
+	__asm __volatile("inl %w1,%0" : "=a" (data) : "d" (port));
+    80ce:	ba fc 0c 00 00       	mov    $0xcfc,%edx
+    80d3:	ed                   	in     (%dx),%eax
+				continue;
+			class = pci_conf_read(dev, func, PCI_CLASS_REG);
+			// prog-if bit 0: primary channel in native mode,
+			// bit 7: bus master capable
+			if ((class >> 16) != PCI_CLASS_IDE
+    80d4:	89 c2                	mov    %eax,%edx
+    80d6:	c1 ea 10             	shr    $0x10,%edx
+    80d9:	81 fa 01 01 00 00    	cmp    $0x101,%edx
+    80df:	75 5f                	jne    8140 <ide_probe+0xb0>
+			    || (class & 0x0100) || !(class & 0x8000))
+    80e1:	25 00 81 00 00       	and    $0x8100,%eax
+    80e6:	3d 00 80 00 00       	cmp    $0x8000,%eax
+    80eb:	75 53                	jne    8140 <ide_probe+0xb0>
+	__asm __volatile("outl %0,%w1" : : "a" (data), "d" (port));
+    80ed:	89 d8                	mov    %ebx,%eax
+    80ef:	89 fa                	mov    %edi,%edx
+    80f1:	0d 20 00 00 80       	or     $0x80000020,%eax
+    80f6:	ef                   	out    %eax,(%dx)
+	__asm __volatile("inl %w1,%0" : "=a" (data) : "d" (port));
+    80f7:	ba fc 0c 00 00       	mov    $0xcfc,%edx
+    80fc:	ed                   	in     (%dx),%eax
+				continue;
+			bar = pci_conf_read(dev, func, PCI_BAR4_REG);
+			if (!(bar & 1) || !(bar & ~3))
+    80fd:	83 f8 03             	cmp    $0x3,%eax
+    8100:	76 3e                	jbe    8140 <ide_probe+0xb0>
+    8102:	a8 01                	test   $0x1,%al
+    8104:	74 3a                	je     8140 <ide_probe+0xb0>
+	outl(PCI_CONF_ADDR, 0x80000000 | (dev << 11) | (func << 8) | reg);
+    8106:	81 cb 04 00 00 80    	or     $0x80000004,%ebx
+	__asm __volatile("outl %0,%w1" : : "a" (data), "d" (port));
+    810c:	89 c6                	mov    %eax,%esi
+    810e:	89 fa                	mov    %edi,%edx
+    8110:	89 d8                	mov    %ebx,%eax
+    8112:	ef                   	out    %eax,(%dx)
+	__asm __volatile("inl %w1,%0" : "=a" (data) : "d" (port));
+    8113:	ba fc 0c 00 00       	mov    $0xcfc,%edx
+    8118:	ed                   	in     (%dx),%eax
+    8119:	89 c1                	mov    %eax,%ecx
+	__asm __volatile("outl %0,%w1" : : "a" (data), "d" (port));
+    811b:	89 fa                	mov    %edi,%edx
+    811d:	89 d8                	mov    %ebx,%eax
+    811f:	ef                   	out    %eax,(%dx)
+				continue;
+			pci_conf_write(dev, func, PCI_CMD_REG,
+    8120:	83 c9 05             	or     $0x5,%ecx
+    8123:	ba fc 0c 00 00       	mov    $0xcfc,%edx
+    8128:	89 c8                	mov    %ecx,%eax
+    812a:	ef                   	out    %eax,(%dx)
+				       pci_conf_read(dev, func, PCI_CMD_REG)
+				       | PCI_CMD_IO | PCI_CMD_MASTER);
+			ide_bmbase = bar & 0xFFFC;
+    812b:	89 f0                	mov    %esi,%eax
+    812d:	83 e0 fc             	and    $0xfffffffc,%eax
+    8130:	66 a3 20 8d 00 00    	mov    %ax,0x8d20
+			return;
+		}
+}
+    8136:	5b                   	pop    %ebx
+    8137:	5e                   	pop    %esi
+    8138:	5f                   	pop    %edi
+    8139:	5d                   	pop    %ebp
+    813a:	c3                   	ret
+    813b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    813f:	90                   	nop
+		for (func = 0; func < 8; func++) {
+    8140:	81 c1 00 01 00 00    	add    $0x100,%ecx
+    8146:	81 f9 00 08 00 00    	cmp    $0x800,%ecx
+    814c:	0f 85 54 ff ff ff    	jne    80a6 <ide_probe+0x16>
+	for (dev = 0; dev < 32; dev++)
+    8152:	81 c6 00 08 00 00    	add    $0x800,%esi
+    8158:	81 fe 00 00 01 00    	cmp    $0x10000,%esi
+    815e:	0f 85 40 ff ff ff    	jne    80a4 <ide_probe+0x14>
+    8164:	eb d0                	jmp    8136 <ide_probe+0xa6>
+    8166:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    816d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00008170 <ide_read>:
+}
+
+// Read 'nsecs' sectors starting at sector 'secno' to physical address 'dst'.
+void
+ide_read(uint32_t secno, void *dst, size_t nsecs)
+{
+    8170:	55                   	push   %ebp
+    8171:	89 e5                	mov    %esp,%ebp
+    8173:	57                   	push   %edi
+    8174:	56                   	push   %esi
+    8175:	53                   	push   %ebx
+    8176:	83 ec 2c             	sub    $0x2c,%esp
+	size_t n;
+
+	if (!ide_probed)
+    8179:	80 3d 22 8d 00 00 00 	cmpb   $0x0,0x8d22
+    8180:	0f 84 37 02 00 00    	je     83bd <ide_read+0x24d>
+		ide_probe();
+
+	for (; nsecs > 0; nsecs -= n, secno += n, dst += n * SECTSIZE) {
+    8186:	8b 45 10             	mov    0x10(%ebp),%eax
+	__asm __volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+    8189:	be f7 01 00 00       	mov    $0x1f7,%esi
+    818e:	85 c0                	test   %eax,%eax
+    8190:	0f 84 81 01 00 00    	je     8317 <ide_read+0x1a7>
+    8196:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    819d:	8d 76 00             	lea    0x0(%esi),%esi
+		n = MIN(nsecs, MAXSECTS);
+    81a0:	b8 ff 00 00 00       	mov    $0xff,%eax
+    81a5:	39 45 10             	cmp    %eax,0x10(%ebp)
+    81a8:	0f 46 45 10          	cmovbe 0x10(%ebp),%eax
+    81ac:	89 c7                	mov    %eax,%edi
+    81ae:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		if (ide_bmbase && ide_read_dma(secno, dst, n) == 0)
+    81b1:	0f b7 05 20 8d 00 00 	movzwl 0x8d20,%eax
+	uint32_t pa = (uint32_t) dst, len = nsecs * SECTSIZE, n;
+    81b8:	89 f9                	mov    %edi,%ecx
+    81ba:	c1 e1 09             	shl    $0x9,%ecx
+    81bd:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+	outb(IDE_NSECT, nsecs);
+    81c0:	89 f9                	mov    %edi,%ecx
+    81c2:	88 4d df             	mov    %cl,-0x21(%ebp)
+	outb(IDE_LBA0, secno);
+    81c5:	0f b6 4d 08          	movzbl 0x8(%ebp),%ecx
+    81c9:	88 4d de             	mov    %cl,-0x22(%ebp)
+	outb(IDE_LBA1, secno >> 8);
+    81cc:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	outb(IDE_LBA2, secno >> 16);
+    81cf:	89 ca                	mov    %ecx,%edx
+	outb(IDE_LBA1, secno >> 8);
+    81d1:	0f b6 fd             	movzbl %ch,%edi
+	outb(IDE_LBA2, secno >> 16);
+    81d4:	c1 ea 10             	shr    $0x10,%edx
+	outb(IDE_LBA1, secno >> 8);
+    81d7:	89 7d d8             	mov    %edi,-0x28(%ebp)
+	outb(IDE_LBA2, secno >> 16);
+    81da:	88 55 dd             	mov    %dl,-0x23(%ebp)
+	outb(IDE_DEVICE, (secno >> 24) | 0xE0);
+    81dd:	89 ca                	mov    %ecx,%edx
+    81df:	c1 ea 18             	shr    $0x18,%edx
+    81e2:	89 d1                	mov    %edx,%ecx
+    81e4:	83 c9 e0             	or     $0xffffffe0,%ecx
+    81e7:	88 4d dc             	mov    %cl,-0x24(%ebp)
+		if (ide_bmbase && ide_read_dma(secno, dst, n) == 0)
+    81ea:	66 85 c0             	test   %ax,%ax
+    81ed:	0f 84 2c 01 00 00    	je     831f <ide_read+0x1af>
+	uint32_t pa = (uint32_t) dst, len = nsecs * SECTSIZE, n;
+    81f3:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+    81f6:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+		n = MIN(len, 0x10000 - (pa & 0xFFFF));
+    81f9:	66 89 45 d6          	mov    %ax,-0x2a(%ebp)
+	for (i = 0; len > 0; i++, pa += n, len -= n) {
+    81fd:	31 d2                	xor    %edx,%edx
+		n = MIN(len, 0x10000 - (pa & 0xFFFF));
+    81ff:	0f b7 fb             	movzwl %bx,%edi
+    8202:	b8 00 00 01 00       	mov    $0x10000,%eax
+		prdt[i].prd_addr = pa;
+    8207:	89 1c d5 40 8d 00 00 	mov    %ebx,0x8d40(,%edx,8)
+		prdt[i].prd_flags = 0;
+    820e:	66 c7 04 d5 46 8d 00 	movw   $0x0,0x8d46(,%edx,8)
+    8215:	00 00 00 
+		n = MIN(len, 0x10000 - (pa & 0xFFFF));
+    8218:	29 f8                	sub    %edi,%eax
+    821a:	89 d7                	mov    %edx,%edi
+    821c:	39 c8                	cmp    %ecx,%eax
+    821e:	0f 47 c1             	cmova  %ecx,%eax
+		prdt[i].prd_count = n;
+    8221:	66 89 04 d5 44 8d 00 	mov    %ax,0x8d44(,%edx,8)
+    8228:	00 
+	for (i = 0; len > 0; i++, pa += n, len -= n) {
+    8229:	01 c3                	add    %eax,%ebx
+    822b:	83 c2 01             	add    $0x1,%edx
+    822e:	29 c1                	sub    %eax,%ecx
+    8230:	75 cd                	jne    81ff <ide_read+0x8f>
+	prdt[i - 1].prd_flags = PRD_EOT;
+    8232:	0f b7 45 d6          	movzwl -0x2a(%ebp),%eax
+    8236:	ba 00 80 ff ff       	mov    $0xffff8000,%edx
+    823b:	66 89 14 fd 46 8d 00 	mov    %dx,0x8d46(,%edi,8)
+    8242:	00 
+	outl(ide_bmbase + BM_PRDT, (uint32_t) prdt);
+    8243:	0f b7 f8             	movzwl %ax,%edi
+	__asm __volatile("outl %0,%w1" : : "a" (data), "d" (port));
+    8246:	b8 40 8d 00 00       	mov    $0x8d40,%eax
+    824b:	8d 57 04             	lea    0x4(%edi),%edx
+    824e:	ef                   	out    %eax,(%dx)
+	__asm __volatile("outb %0,%w1" : : "a" (data), "d" (port));
+    824f:	b8 08 00 00 00       	mov    $0x8,%eax
+    8254:	89 fa                	mov    %edi,%edx
+    8256:	ee                   	out    %al,(%dx)
+	outb(ide_bmbase + BM_STATUS, BM_ST_ERR | BM_ST_INTR);	// write 1 to clear
+    8257:	8d 5f 02             	lea    0x2(%edi),%ebx
+    825a:	b8 06 00 00 00       	mov    $0x6,%eax
+    825f:	89 da                	mov    %ebx,%edx
+    8261:	ee                   	out    %al,(%dx)
+	while (((r = inb(IDE_STATUS)) & (IDE_BSY|IDE_DRDY)) != IDE_DRDY)
+    8262:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+	__asm __volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+    8268:	89 f2                	mov    %esi,%edx
+    826a:	ec                   	in     (%dx),%al
+    826b:	83 e0 c0             	and    $0xffffffc0,%eax
+    826e:	3c 40                	cmp    $0x40,%al
+    8270:	75 f6                	jne    8268 <ide_read+0xf8>
+	__asm __volatile("outb %0,%w1" : : "a" (data), "d" (port));
+    8272:	0f b6 45 df          	movzbl -0x21(%ebp),%eax
+    8276:	ba f2 01 00 00       	mov    $0x1f2,%edx
+    827b:	ee                   	out    %al,(%dx)
+    827c:	ba f3 01 00 00       	mov    $0x1f3,%edx
+    8281:	0f b6 45 de          	movzbl -0x22(%ebp),%eax
+    8285:	ee                   	out    %al,(%dx)
+    8286:	ba f4 01 00 00       	mov    $0x1f4,%edx
+    828b:	0f b6 45 d8          	movzbl -0x28(%ebp),%eax
+    828f:	ee                   	out    %al,(%dx)
+    8290:	ba f5 01 00 00       	mov    $0x1f5,%edx
+    8295:	0f b6 45 dd          	movzbl -0x23(%ebp),%eax
+    8299:	ee                   	out    %al,(%dx)
+    829a:	ba f6 01 00 00       	mov    $0x1f6,%edx
+    829f:	0f b6 45 dc          	movzbl -0x24(%ebp),%eax
+    82a3:	ee                   	out    %al,(%dx)
+    82a4:	b8 c8 ff ff ff       	mov    $0xffffffc8,%eax
+    82a9:	89 f2                	mov    %esi,%edx
+    82ab:	ee                   	out    %al,(%dx)
+    82ac:	b8 09 00 00 00       	mov    $0x9,%eax
+    82b1:	89 fa                	mov    %edi,%edx
+    82b3:	ee                   	out    %al,(%dx)
+    82b4:	89 da                	mov    %ebx,%edx
+}
+    82b6:	eb 0c                	jmp    82c4 <ide_read+0x154>
+    82b8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    82bf:	90                   	nop
+	       && !(r & (BM_ST_INTR|BM_ST_ERR)))
+    82c0:	a8 06                	test   $0x6,%al
+    82c2:	75 05                	jne    82c9 <ide_read+0x159>
+	__asm __volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+    82c4:	ec                   	in     (%dx),%al
+    82c5:	a8 01                	test   $0x1,%al
+    82c7:	75 f7                	jne    82c0 <ide_read+0x150>
+	__asm __volatile("outb %0,%w1" : : "a" (data), "d" (port));
+    82c9:	89 d3                	mov    %edx,%ebx
+    82cb:	89 c1                	mov    %eax,%ecx
+    82cd:	89 fa                	mov    %edi,%edx
+    82cf:	31 c0                	xor    %eax,%eax
+    82d1:	ee                   	out    %al,(%dx)
+    82d2:	b8 06 00 00 00       	mov    $0x6,%eax
+    82d7:	89 da                	mov    %ebx,%edx
+    82d9:	ee                   	out    %al,(%dx)
+    82da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+	__asm __volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+    82e0:	89 f2                	mov    %esi,%edx
+    82e2:	ec                   	in     (%dx),%al
+	while (((r = inb(IDE_STATUS)) & (IDE_BSY|IDE_DRDY)) != IDE_DRDY)
+    82e3:	89 c2                	mov    %eax,%edx
+    82e5:	83 e2 c0             	and    $0xffffffc0,%edx
+    82e8:	80 fa 40             	cmp    $0x40,%dl
+    82eb:	75 f3                	jne    82e0 <ide_read+0x170>
+	if (ide_wait_ready() < 0 || (r & BM_ST_ERR))
+    82ed:	83 e0 21             	and    $0x21,%eax
+    82f0:	83 e1 02             	and    $0x2,%ecx
+    82f3:	08 c8                	or     %cl,%al
+    82f5:	75 28                	jne    831f <ide_read+0x1af>
+    82f7:	8b 45 0c             	mov    0xc(%ebp),%eax
+    82fa:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+    82fd:	8d 14 38             	lea    (%eax,%edi,1),%edx
+	for (; nsecs > 0; nsecs -= n, secno += n, dst += n * SECTSIZE) {
+    8300:	8b 45 e0             	mov    -0x20(%ebp),%eax
+    8303:	29 45 10             	sub    %eax,0x10(%ebp)
+    8306:	01 45 08             	add    %eax,0x8(%ebp)
+    8309:	8b 45 10             	mov    0x10(%ebp),%eax
+    830c:	89 55 0c             	mov    %edx,0xc(%ebp)
+    830f:	85 c0                	test   %eax,%eax
+    8311:	0f 85 89 fe ff ff    	jne    81a0 <ide_read+0x30>
+			continue;
+		// Don't try DMA again after it failed once.
+		ide_bmbase = 0;
+		ide_read_pio(secno, dst, n);
+	}
+}
+    8317:	83 c4 2c             	add    $0x2c,%esp
+    831a:	5b                   	pop    %ebx
+    831b:	5e                   	pop    %esi
+    831c:	5f                   	pop    %edi
+    831d:	5d                   	pop    %ebp
+    831e:	c3                   	ret
+		ide_bmbase = 0;
+    831f:	31 c0                	xor    %eax,%eax
+    8321:	66 a3 20 8d 00 00    	mov    %ax,0x8d20
+ide_command(uint32_t secno, size_t nsecs, uint8_t cmd)
+    8327:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    832e:	66 90                	xchg   %ax,%ax
+    8330:	89 f2                	mov    %esi,%edx
+    8332:	ec                   	in     (%dx),%al
+	while (((r = inb(IDE_STATUS)) & (IDE_BSY|IDE_DRDY)) != IDE_DRDY)
+    8333:	83 e0 c0             	and    $0xffffffc0,%eax
+    8336:	3c 40                	cmp    $0x40,%al
+    8338:	75 f6                	jne    8330 <ide_read+0x1c0>
+	__asm __volatile("outb %0,%w1" : : "a" (data), "d" (port));
+    833a:	0f b6 45 df          	movzbl -0x21(%ebp),%eax
+    833e:	ba f2 01 00 00       	mov    $0x1f2,%edx
+    8343:	ee                   	out    %al,(%dx)
+    8344:	ba f3 01 00 00       	mov    $0x1f3,%edx
+    8349:	0f b6 45 de          	movzbl -0x22(%ebp),%eax
+    834d:	ee                   	out    %al,(%dx)
+    834e:	ba f4 01 00 00       	mov    $0x1f4,%edx
+    8353:	0f b6 45 d8          	movzbl -0x28(%ebp),%eax
+    8357:	ee                   	out    %al,(%dx)
+    8358:	ba f5 01 00 00       	mov    $0x1f5,%edx
+    835d:	0f b6 45 dd          	movzbl -0x23(%ebp),%eax
+    8361:	ee                   	out    %al,(%dx)
+    8362:	ba f6 01 00 00       	mov    $0x1f6,%edx
+    8367:	0f b6 45 dc          	movzbl -0x24(%ebp),%eax
+    836b:	ee                   	out    %al,(%dx)
+    836c:	b8 20 00 00 00       	mov    $0x20,%eax
+    8371:	89 f2                	mov    %esi,%edx
+    8373:	ee                   	out    %al,(%dx)
+    8374:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+    8377:	03 55 0c             	add    0xc(%ebp),%edx
+    837a:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+}
+    837d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	for (; nsecs > 0; nsecs--, dst += SECTSIZE) {
+    8380:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    8383:	39 c3                	cmp    %eax,%ebx
+    8385:	74 2f                	je     83b6 <ide_read+0x246>
+    8387:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    838e:	66 90                	xchg   %ax,%ax
+	__asm __volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+    8390:	89 f2                	mov    %esi,%edx
+    8392:	ec                   	in     (%dx),%al
+	while (((r = inb(IDE_STATUS)) & (IDE_BSY|IDE_DRDY)) != IDE_DRDY)
+    8393:	83 e0 c0             	and    $0xffffffc0,%eax
+    8396:	3c 40                	cmp    $0x40,%al
+    8398:	75 f6                	jne    8390 <ide_read+0x220>
+	__asm __volatile("cld\n\trepne\n\tinsl"			:
+    839a:	89 df                	mov    %ebx,%edi
+    839c:	b9 80 00 00 00       	mov    $0x80,%ecx
+    83a1:	ba f0 01 00 00       	mov    $0x1f0,%edx
+    83a6:	fc                   	cld
+    83a7:	f2 6d                	repnz insl (%dx),%es:(%edi)
+	for (; nsecs > 0; nsecs--, dst += SECTSIZE) {
+    83a9:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    83ac:	81 c3 00 02 00 00    	add    $0x200,%ebx
+    83b2:	39 c3                	cmp    %eax,%ebx
+    83b4:	75 da                	jne    8390 <ide_read+0x220>
+    83b6:	89 c2                	mov    %eax,%edx
+    83b8:	e9 43 ff ff ff       	jmp    8300 <ide_read+0x190>
+		ide_probe();
+    83bd:	e8 ce fc ff ff       	call   8090 <ide_probe>
+    83c2:	e9 bf fd ff ff       	jmp    8186 <ide_read+0x16>
+    83c7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    83ce:	66 90                	xchg   %ax,%ax
+
+000083d0 <ide_dma_enabled>:
+
+// Whether transfers go through bus-master DMA.
+bool
+ide_dma_enabled(void)
+{
+	if (!ide_probed)
+    83d0:	80 3d 22 8d 00 00 00 	cmpb   $0x0,0x8d22
+    83d7:	74 0f                	je     83e8 <ide_dma_enabled+0x18>
+		ide_probe();
+	return ide_bmbase != 0;
+    83d9:	66 83 3d 20 8d 00 00 	cmpw   $0x0,0x8d20
+    83e0:	00 
+    83e1:	0f 95 c0             	setne  %al
+}
+    83e4:	c3                   	ret
+    83e5:	8d 76 00             	lea    0x0(%esi),%esi
+{
+    83e8:	55                   	push   %ebp
+    83e9:	89 e5                	mov    %esp,%ebp
+    83eb:	83 ec 08             	sub    $0x8,%esp
+		ide_probe();
+    83ee:	e8 9d fc ff ff       	call   8090 <ide_probe>
+	return ide_bmbase != 0;
+    83f3:	66 83 3d 20 8d 00 00 	cmpw   $0x0,0x8d20
+    83fa:	00 
+}
+    83fb:	c9                   	leave
+	return ide_bmbase != 0;
+    83fc:	0f 95 c0             	setne  %al
+}
+    83ff:	c3                   	ret
+
+00008400 <lz4_decompress>:
+// Inflate the 'srclen' byte block at 'src' into 'dst', writing at most
+// 'dstlen' bytes.  Returns the number of bytes written, or -1 if the
+// block is malformed or does not fit.
+int
+lz4_decompress(const void *src, size_t srclen, void *dst, size_t dstlen)
+{
+    8400:	55                   	push   %ebp
+    8401:	89 e5                	mov    %esp,%ebp
+    8403:	57                   	push   %edi
+    8404:	56                   	push   %esi
+    8405:	53                   	push   %ebx
+    8406:	83 ec 1c             	sub    $0x1c,%esp
+    8409:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	const uint8_t *ip = src, *iend = ip + srclen, *m;
+    840c:	8b 45 0c             	mov    0xc(%ebp),%eax
+	uint8_t *op = dst, *oend = op + dstlen;
+    840f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	const uint8_t *ip = src, *iend = ip + srclen, *m;
+    8412:	01 c8                	add    %ecx,%eax
+    8414:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	uint8_t *op = dst, *oend = op + dstlen;
+    8417:	8b 45 10             	mov    0x10(%ebp),%eax
+    841a:	03 45 14             	add    0x14(%ebp),%eax
+    841d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	size_t len, off;
+	uint8_t token;
+
+	while (ip < iend) {
+    8420:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    8423:	39 c1                	cmp    %eax,%ecx
+    8425:	0f 83 0c 01 00 00    	jae    8537 <lz4_decompress+0x137>
+		token = *ip++;
+    842b:	0f b6 01             	movzbl (%ecx),%eax
+    842e:	8d 71 01             	lea    0x1(%ecx),%esi
+    8431:	88 45 dc             	mov    %al,-0x24(%ebp)
+
+		len = token >> 4;
+    8434:	c0 e8 04             	shr    $0x4,%al
+    8437:	0f b6 f8             	movzbl %al,%edi
+		if (len == 15 && lz4_length(&ip, iend, &len) < 0)
+    843a:	3c 0f                	cmp    $0xf,%al
+    843c:	0f 84 8e 00 00 00    	je     84d0 <lz4_decompress+0xd0>
+			return -1;
+		if (len > (size_t) (iend - ip) || len > (size_t) (oend - op))
+    8442:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    8445:	29 f0                	sub    %esi,%eax
+    8447:	39 f8                	cmp    %edi,%eax
+    8449:	0f 82 a6 00 00 00    	jb     84f5 <lz4_decompress+0xf5>
+    844f:	8b 55 e0             	mov    -0x20(%ebp),%edx
+    8452:	29 da                	sub    %ebx,%edx
+    8454:	39 fa                	cmp    %edi,%edx
+    8456:	0f 82 99 00 00 00    	jb     84f5 <lz4_decompress+0xf5>
+			return -1;
+		memcpy(op, ip, len);
+    845c:	83 ec 04             	sub    $0x4,%esp
+    845f:	57                   	push   %edi
+    8460:	56                   	push   %esi
+		ip += len;
+    8461:	01 fe                	add    %edi,%esi
+		op += len;
+    8463:	01 df                	add    %ebx,%edi
+		memcpy(op, ip, len);
+    8465:	53                   	push   %ebx
+    8466:	e8 95 03 00 00       	call   8800 <memcpy>
+
+		// the last sequence ends right after its literals
+		if (ip == iend)
+    846b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    846e:	83 c4 10             	add    $0x10,%esp
+    8471:	39 c6                	cmp    %eax,%esi
+    8473:	0f 84 bc 00 00 00    	je     8535 <lz4_decompress+0x135>
+			break;
+
+		if (iend - ip < 2)
+    8479:	29 f0                	sub    %esi,%eax
+    847b:	83 f8 01             	cmp    $0x1,%eax
+    847e:	7e 75                	jle    84f5 <lz4_decompress+0xf5>
+			return -1;
+		off = ip[0] | (ip[1] << 8);
+    8480:	0f b7 1e             	movzwl (%esi),%ebx
+		ip += 2;
+    8483:	8d 4e 02             	lea    0x2(%esi),%ecx
+		if (off == 0 || off > (size_t) (op - (uint8_t *) dst))
+    8486:	66 85 db             	test   %bx,%bx
+    8489:	74 6a                	je     84f5 <lz4_decompress+0xf5>
+    848b:	89 f8                	mov    %edi,%eax
+    848d:	2b 45 10             	sub    0x10(%ebp),%eax
+    8490:	39 d8                	cmp    %ebx,%eax
+    8492:	72 61                	jb     84f5 <lz4_decompress+0xf5>
+			return -1;
+
+		len = token & 15;
+    8494:	0f b6 45 dc          	movzbl -0x24(%ebp),%eax
+    8498:	89 c2                	mov    %eax,%edx
+    849a:	83 e0 0f             	and    $0xf,%eax
+    849d:	83 e2 0f             	and    $0xf,%edx
+		if (len == 15 && lz4_length(&ip, iend, &len) < 0)
+    84a0:	80 fa 0f             	cmp    $0xf,%dl
+    84a3:	74 63                	je     8508 <lz4_decompress+0x108>
+			return -1;
+		len += 4;
+		if (len > (size_t) (oend - op))
+    84a5:	8b 55 e0             	mov    -0x20(%ebp),%edx
+		len += 4;
+    84a8:	83 c0 04             	add    $0x4,%eax
+		if (len > (size_t) (oend - op))
+    84ab:	29 fa                	sub    %edi,%edx
+    84ad:	39 c2                	cmp    %eax,%edx
+    84af:	72 44                	jb     84f5 <lz4_decompress+0xf5>
+			return -1;
+
+		// The match may overlap the bytes it produces (a run), so
+		// copy forward one byte at a time.
+		for (m = op - off; len > 0; len--)
+    84b1:	89 fe                	mov    %edi,%esi
+    84b3:	29 de                	sub    %ebx,%esi
+    84b5:	8d 1c 07             	lea    (%edi,%eax,1),%ebx
+    84b8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    84bf:	90                   	nop
+    84c0:	39 df                	cmp    %ebx,%edi
+    84c2:	0f 84 58 ff ff ff    	je     8420 <lz4_decompress+0x20>
+			*op++ = *m++;
+    84c8:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+		for (m = op - off; len > 0; len--)
+    84c9:	eb f5                	jmp    84c0 <lz4_decompress+0xc0>
+    84cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    84cf:	90                   	nop
+		len = token >> 4;
+    84d0:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+    84d3:	bf 0f 00 00 00       	mov    $0xf,%edi
+    84d8:	eb 17                	jmp    84f1 <lz4_decompress+0xf1>
+    84da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+		b = *(*ip)++;
+    84e0:	0f b6 16             	movzbl (%esi),%edx
+    84e3:	83 c6 01             	add    $0x1,%esi
+		*len += b;
+    84e6:	01 d7                	add    %edx,%edi
+	} while (b == 255);
+    84e8:	80 fa ff             	cmp    $0xff,%dl
+    84eb:	0f 85 51 ff ff ff    	jne    8442 <lz4_decompress+0x42>
+		if (*ip >= iend)
+    84f1:	39 f1                	cmp    %esi,%ecx
+    84f3:	75 eb                	jne    84e0 <lz4_decompress+0xe0>
+	}
+	return op - (uint8_t *) dst;
+}
+    84f5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+			return -1;
+    84f8:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    84fd:	5b                   	pop    %ebx
+    84fe:	5e                   	pop    %esi
+    84ff:	5f                   	pop    %edi
+    8500:	5d                   	pop    %ebp
+    8501:	c3                   	ret
+    8502:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    8508:	89 7d dc             	mov    %edi,-0x24(%ebp)
+    850b:	b8 0f 00 00 00       	mov    $0xf,%eax
+    8510:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+    8513:	eb 12                	jmp    8527 <lz4_decompress+0x127>
+    8515:	8d 76 00             	lea    0x0(%esi),%esi
+		b = *(*ip)++;
+    8518:	0f b6 31             	movzbl (%ecx),%esi
+    851b:	83 c1 01             	add    $0x1,%ecx
+    851e:	89 f2                	mov    %esi,%edx
+		*len += b;
+    8520:	01 f0                	add    %esi,%eax
+	} while (b == 255);
+    8522:	80 fa ff             	cmp    $0xff,%dl
+    8525:	75 06                	jne    852d <lz4_decompress+0x12d>
+		if (*ip >= iend)
+    8527:	39 f9                	cmp    %edi,%ecx
+    8529:	72 ed                	jb     8518 <lz4_decompress+0x118>
+    852b:	eb c8                	jmp    84f5 <lz4_decompress+0xf5>
+    852d:	8b 7d dc             	mov    -0x24(%ebp),%edi
+    8530:	e9 70 ff ff ff       	jmp    84a5 <lz4_decompress+0xa5>
+		op += len;
+    8535:	89 fb                	mov    %edi,%ebx
+	return op - (uint8_t *) dst;
+    8537:	89 d8                	mov    %ebx,%eax
+    8539:	2b 45 10             	sub    0x10(%ebp),%eax
+}
+    853c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    853f:	5b                   	pop    %ebx
+    8540:	5e                   	pop    %esi
+    8541:	5f                   	pop    %edi
+    8542:	5d                   	pop    %ebp
+    8543:	c3                   	ret
+    8544:	66 90                	xchg   %ax,%ax
+    8546:	66 90                	xchg   %ax,%ax
+    8548:	66 90                	xchg   %ax,%ax
+    854a:	66 90                	xchg   %ax,%ax
+    854c:	66 90                	xchg   %ax,%ax
+    854e:	66 90                	xchg   %ax,%ax
+
+00008550 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+    8550:	55                   	push   %ebp
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+    8551:	31 c0                	xor    %eax,%eax
+{
+    8553:	89 e5                	mov    %esp,%ebp
+    8555:	8b 55 08             	mov    0x8(%ebp),%edx
+	for (n = 0; *s != '\0'; s++)
+    8558:	eb 09                	jmp    8563 <strlen+0x13>
+    855a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+		n++;
+    8560:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+    8563:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+    8567:	75 f7                	jne    8560 <strlen+0x10>
+	return n;
+}
+    8569:	5d                   	pop    %ebp
+    856a:	c3                   	ret
+    856b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    856f:	90                   	nop
+
+00008570 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+    8570:	55                   	push   %ebp
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+    8571:	31 c0                	xor    %eax,%eax
+{
+    8573:	89 e5                	mov    %esp,%ebp
+    8575:	8b 4d 08             	mov    0x8(%ebp),%ecx
+    8578:	8b 55 0c             	mov    0xc(%ebp),%edx
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+    857b:	eb 0c                	jmp    8589 <strnlen+0x19>
+    857d:	8d 76 00             	lea    0x0(%esi),%esi
+    8580:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+    8584:	74 07                	je     858d <strnlen+0x1d>
+		n++;
+    8586:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+    8589:	39 d0                	cmp    %edx,%eax
+    858b:	75 f3                	jne    8580 <strnlen+0x10>
+	return n;
+}
+    858d:	5d                   	pop    %ebp
+    858e:	c3                   	ret
+    858f:	90                   	nop
+
+00008590 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+    8590:	55                   	push   %ebp
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+    8591:	31 c0                	xor    %eax,%eax
+{
+    8593:	89 e5                	mov    %esp,%ebp
+    8595:	53                   	push   %ebx
+    8596:	8b 4d 08             	mov    0x8(%ebp),%ecx
+    8599:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+    859c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+	while ((*dst++ = *src++) != '\0')
+    85a0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+    85a4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+    85a7:	83 c0 01             	add    $0x1,%eax
+    85aa:	84 d2                	test   %dl,%dl
+    85ac:	75 f2                	jne    85a0 <strcpy+0x10>
+		/* do nothing */;
+	return ret;
+}
+    85ae:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    85b1:	89 c8                	mov    %ecx,%eax
+    85b3:	c9                   	leave
+    85b4:	c3                   	ret
+    85b5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    85bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000085c0 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+    85c0:	55                   	push   %ebp
+	for (n = 0; *s != '\0'; s++)
+    85c1:	31 c0                	xor    %eax,%eax
+{
+    85c3:	89 e5                	mov    %esp,%ebp
+    85c5:	56                   	push   %esi
+    85c6:	53                   	push   %ebx
+    85c7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    85ca:	8b 75 0c             	mov    0xc(%ebp),%esi
+	for (n = 0; *s != '\0'; s++)
+    85cd:	eb 04                	jmp    85d3 <strcat+0x13>
+    85cf:	90                   	nop
+		n++;
+    85d0:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+    85d3:	80 3c 03 00          	cmpb   $0x0,(%ebx,%eax,1)
+    85d7:	75 f7                	jne    85d0 <strcat+0x10>
+	int len = strlen(dst);
+	strcpy(dst + len, src);
+    85d9:	8d 14 03             	lea    (%ebx,%eax,1),%edx
+    85dc:	31 c0                	xor    %eax,%eax
+    85de:	66 90                	xchg   %ax,%ax
+	while ((*dst++ = *src++) != '\0')
+    85e0:	0f b6 0c 06          	movzbl (%esi,%eax,1),%ecx
+    85e4:	88 0c 02             	mov    %cl,(%edx,%eax,1)
+    85e7:	83 c0 01             	add    $0x1,%eax
+    85ea:	84 c9                	test   %cl,%cl
+    85ec:	75 f2                	jne    85e0 <strcat+0x20>
+	return dst;
+}
+    85ee:	89 d8                	mov    %ebx,%eax
+    85f0:	5b                   	pop    %ebx
+    85f1:	5e                   	pop    %esi
+    85f2:	5d                   	pop    %ebp
+    85f3:	c3                   	ret
+    85f4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    85fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    85ff:	90                   	nop
+
+00008600 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+    8600:	55                   	push   %ebp
+    8601:	89 e5                	mov    %esp,%ebp
+    8603:	56                   	push   %esi
+    8604:	53                   	push   %ebx
+    8605:	8b 75 08             	mov    0x8(%ebp),%esi
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+    8608:	8b 5d 10             	mov    0x10(%ebp),%ebx
+strncpy(char *dst, const char *src, size_t size) {
+    860b:	8b 55 0c             	mov    0xc(%ebp),%edx
+	for (i = 0; i < size; i++) {
+    860e:	89 f0                	mov    %esi,%eax
+    8610:	01 f3                	add    %esi,%ebx
+    8612:	eb 13                	jmp    8627 <strncpy+0x27>
+    8614:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+		*dst++ = *src;
+    8618:	0f b6 0a             	movzbl (%edx),%ecx
+    861b:	83 c0 01             	add    $0x1,%eax
+    861e:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+    8621:	80 f9 01             	cmp    $0x1,%cl
+    8624:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+    8627:	39 d8                	cmp    %ebx,%eax
+    8629:	75 ed                	jne    8618 <strncpy+0x18>
+	}
+	return ret;
+}
+    862b:	89 f0                	mov    %esi,%eax
+    862d:	5b                   	pop    %ebx
+    862e:	5e                   	pop    %esi
+    862f:	5d                   	pop    %ebp
+    8630:	c3                   	ret
+    8631:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    8638:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    863f:	90                   	nop
+
+00008640 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+    8640:	55                   	push   %ebp
+    8641:	89 e5                	mov    %esp,%ebp
+    8643:	56                   	push   %esi
+    8644:	53                   	push   %ebx
+    8645:	8b 45 10             	mov    0x10(%ebp),%eax
+    8648:	8b 75 08             	mov    0x8(%ebp),%esi
+    864b:	8b 55 0c             	mov    0xc(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+    864e:	85 c0                	test   %eax,%eax
+    8650:	74 26                	je     8678 <strlcpy+0x38>
+    8652:	8d 5c 06 ff          	lea    -0x1(%esi,%eax,1),%ebx
+    8656:	89 f0                	mov    %esi,%eax
+    8658:	eb 15                	jmp    866f <strlcpy+0x2f>
+    865a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+		while (--size > 0 && *src != '\0')
+    8660:	0f b6 0a             	movzbl (%edx),%ecx
+    8663:	84 c9                	test   %cl,%cl
+    8665:	74 0c                	je     8673 <strlcpy+0x33>
+			*dst++ = *src++;
+    8667:	88 08                	mov    %cl,(%eax)
+    8669:	83 c0 01             	add    $0x1,%eax
+    866c:	83 c2 01             	add    $0x1,%edx
+		while (--size > 0 && *src != '\0')
+    866f:	39 c3                	cmp    %eax,%ebx
+    8671:	75 ed                	jne    8660 <strlcpy+0x20>
+		*dst = '\0';
+    8673:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+    8676:	29 f0                	sub    %esi,%eax
+}
+    8678:	5b                   	pop    %ebx
+    8679:	5e                   	pop    %esi
+    867a:	5d                   	pop    %ebp
+    867b:	c3                   	ret
+    867c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00008680 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+    8680:	55                   	push   %ebp
+	while (*p && *p == *q)
+    8681:	31 c0                	xor    %eax,%eax
+{
+    8683:	89 e5                	mov    %esp,%ebp
+    8685:	56                   	push   %esi
+    8686:	53                   	push   %ebx
+    8687:	8b 75 08             	mov    0x8(%ebp),%esi
+    868a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	while (*p && *p == *q)
+    868d:	eb 08                	jmp    8697 <strcmp+0x17>
+    868f:	90                   	nop
+    8690:	83 c0 01             	add    $0x1,%eax
+    8693:	38 ca                	cmp    %cl,%dl
+    8695:	75 19                	jne    86b0 <strcmp+0x30>
+    8697:	0f b6 14 06          	movzbl (%esi,%eax,1),%edx
+    869b:	0f b6 0c 03          	movzbl (%ebx,%eax,1),%ecx
+    869f:	84 d2                	test   %dl,%dl
+    86a1:	75 ed                	jne    8690 <strcmp+0x10>
+    86a3:	31 c0                	xor    %eax,%eax
+		p++, q++;
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+}
+    86a5:	5b                   	pop    %ebx
+    86a6:	5e                   	pop    %esi
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+    86a7:	29 c8                	sub    %ecx,%eax
+}
+    86a9:	5d                   	pop    %ebp
+    86aa:	c3                   	ret
+    86ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    86af:	90                   	nop
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+    86b0:	0f b6 c2             	movzbl %dl,%eax
+}
+    86b3:	5b                   	pop    %ebx
+    86b4:	5e                   	pop    %esi
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+    86b5:	29 c8                	sub    %ecx,%eax
+}
+    86b7:	5d                   	pop    %ebp
+    86b8:	c3                   	ret
+    86b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000086c0 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+    86c0:	55                   	push   %ebp
+    86c1:	89 e5                	mov    %esp,%ebp
+    86c3:	53                   	push   %ebx
+    86c4:	8b 45 08             	mov    0x8(%ebp),%eax
+    86c7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+    86ca:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+    86cd:	eb 15                	jmp    86e4 <strncmp+0x24>
+    86cf:	90                   	nop
+    86d0:	0f b6 18             	movzbl (%eax),%ebx
+    86d3:	84 db                	test   %bl,%bl
+    86d5:	74 19                	je     86f0 <strncmp+0x30>
+    86d7:	3a 19                	cmp    (%ecx),%bl
+    86d9:	75 15                	jne    86f0 <strncmp+0x30>
+		n--, p++, q++;
+    86db:	83 ea 01             	sub    $0x1,%edx
+    86de:	83 c0 01             	add    $0x1,%eax
+    86e1:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+    86e4:	85 d2                	test   %edx,%edx
+    86e6:	75 e8                	jne    86d0 <strncmp+0x10>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+}
+    86e8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+		return 0;
+    86eb:	31 c0                	xor    %eax,%eax
+}
+    86ed:	c9                   	leave
+    86ee:	c3                   	ret
+    86ef:	90                   	nop
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+    86f0:	0f b6 00             	movzbl (%eax),%eax
+    86f3:	0f b6 11             	movzbl (%ecx),%edx
+}
+    86f6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    86f9:	c9                   	leave
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+    86fa:	29 d0                	sub    %edx,%eax
+}
+    86fc:	c3                   	ret
+    86fd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00008700 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+    8700:	55                   	push   %ebp
+    8701:	89 e5                	mov    %esp,%ebp
+    8703:	8b 45 08             	mov    0x8(%ebp),%eax
+    8706:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+    870a:	eb 0b                	jmp    8717 <strchr+0x17>
+    870c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+		if (*s == c)
+    8710:	38 ca                	cmp    %cl,%dl
+    8712:	74 0c                	je     8720 <strchr+0x20>
+	for (; *s; s++)
+    8714:	83 c0 01             	add    $0x1,%eax
+    8717:	0f b6 10             	movzbl (%eax),%edx
+    871a:	84 d2                	test   %dl,%dl
+    871c:	75 f2                	jne    8710 <strchr+0x10>
+			return (char *) s;
+	return 0;
+    871e:	31 c0                	xor    %eax,%eax
+}
+    8720:	5d                   	pop    %ebp
+    8721:	c3                   	ret
+    8722:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    8729:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00008730 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+    8730:	55                   	push   %ebp
+    8731:	89 e5                	mov    %esp,%ebp
+    8733:	8b 45 08             	mov    0x8(%ebp),%eax
+    8736:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+    873a:	eb 0b                	jmp    8747 <strfind+0x17>
+    873c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+		if (*s == c)
+    8740:	84 d2                	test   %dl,%dl
+    8742:	74 0a                	je     874e <strfind+0x1e>
+	for (; *s; s++)
+    8744:	83 c0 01             	add    $0x1,%eax
+    8747:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+    874a:	38 ca                	cmp    %cl,%dl
+    874c:	75 f2                	jne    8740 <strfind+0x10>
+			break;
+	return (char *) s;
+}
+    874e:	5d                   	pop    %ebp
+    874f:	c3                   	ret
+
+00008750 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+    8750:	55                   	push   %ebp
+    8751:	89 e5                	mov    %esp,%ebp
+    8753:	57                   	push   %edi
+    8754:	8b 4d 10             	mov    0x10(%ebp),%ecx
+    8757:	8b 7d 08             	mov    0x8(%ebp),%edi
+	if (n == 0)
+    875a:	85 c9                	test   %ecx,%ecx
+    875c:	74 18                	je     8776 <memset+0x26>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+    875e:	89 f8                	mov    %edi,%eax
+    8760:	09 c8                	or     %ecx,%eax
+    8762:	a8 03                	test   $0x3,%al
+    8764:	75 1a                	jne    8780 <memset+0x30>
+		c &= 0xFF;
+    8766:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+    876a:	c1 e9 02             	shr    $0x2,%ecx
+    876d:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		asm volatile("cld; rep stosl\n"
+    8773:	fc                   	cld
+    8774:	f3 ab                	rep stos %eax,%es:(%edi)
+	} else
+		asm volatile("cld; rep stosb\n"
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+    8776:	89 f8                	mov    %edi,%eax
+    8778:	8b 7d fc             	mov    -0x4(%ebp),%edi
+    877b:	c9                   	leave
+    877c:	c3                   	ret
+    877d:	8d 76 00             	lea    0x0(%esi),%esi
+		asm volatile("cld; rep stosb\n"
+    8780:	8b 45 0c             	mov    0xc(%ebp),%eax
+    8783:	fc                   	cld
+    8784:	f3 aa                	rep stos %al,%es:(%edi)
+}
+    8786:	89 f8                	mov    %edi,%eax
+    8788:	8b 7d fc             	mov    -0x4(%ebp),%edi
+    878b:	c9                   	leave
+    878c:	c3                   	ret
+    878d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00008790 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+    8790:	55                   	push   %ebp
+    8791:	89 e5                	mov    %esp,%ebp
+    8793:	57                   	push   %edi
+    8794:	56                   	push   %esi
+    8795:	8b 45 08             	mov    0x8(%ebp),%eax
+    8798:	8b 75 0c             	mov    0xc(%ebp),%esi
+    879b:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+    879e:	39 c6                	cmp    %eax,%esi
+    87a0:	73 26                	jae    87c8 <memmove+0x38>
+    87a2:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+    87a5:	39 d0                	cmp    %edx,%eax
+    87a7:	73 1f                	jae    87c8 <memmove+0x38>
+		s += n;
+		d += n;
+    87a9:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+    87ac:	89 d6                	mov    %edx,%esi
+    87ae:	09 fe                	or     %edi,%esi
+    87b0:	09 ce                	or     %ecx,%esi
+    87b2:	83 e6 03             	and    $0x3,%esi
+    87b5:	74 39                	je     87f0 <memmove+0x60>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+    87b7:	83 ef 01             	sub    $0x1,%edi
+    87ba:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+    87bd:	fd                   	std
+    87be:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+    87c0:	fc                   	cld
+		else
+			asm volatile("cld; rep movsb\n"
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+    87c1:	5e                   	pop    %esi
+    87c2:	5f                   	pop    %edi
+    87c3:	5d                   	pop    %ebp
+    87c4:	c3                   	ret
+    87c5:	8d 76 00             	lea    0x0(%esi),%esi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+    87c8:	89 f2                	mov    %esi,%edx
+    87ca:	09 c2                	or     %eax,%edx
+    87cc:	09 ca                	or     %ecx,%edx
+    87ce:	83 e2 03             	and    $0x3,%edx
+    87d1:	74 0d                	je     87e0 <memmove+0x50>
+			asm volatile("cld; rep movsb\n"
+    87d3:	89 c7                	mov    %eax,%edi
+    87d5:	fc                   	cld
+    87d6:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+}
+    87d8:	5e                   	pop    %esi
+    87d9:	5f                   	pop    %edi
+    87da:	5d                   	pop    %ebp
+    87db:	c3                   	ret
+    87dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+    87e0:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+    87e3:	89 c7                	mov    %eax,%edi
+    87e5:	fc                   	cld
+    87e6:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+    87e8:	eb ee                	jmp    87d8 <memmove+0x48>
+    87ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+    87f0:	83 ef 04             	sub    $0x4,%edi
+    87f3:	8d 72 fc             	lea    -0x4(%edx),%esi
+    87f6:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+    87f9:	fd                   	std
+    87fa:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+    87fc:	eb c2                	jmp    87c0 <memmove+0x30>
+    87fe:	66 90                	xchg   %ax,%ax
+
+00008800 <memcpy>:
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+	return memmove(dst, src, n);
+    8800:	eb 8e                	jmp    8790 <memmove>
+    8802:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    8809:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00008810 <memcmp>:
+}
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+    8810:	55                   	push   %ebp
+    8811:	89 e5                	mov    %esp,%ebp
+    8813:	56                   	push   %esi
+    8814:	53                   	push   %ebx
+    8815:	8b 45 08             	mov    0x8(%ebp),%eax
+    8818:	8b 75 10             	mov    0x10(%ebp),%esi
+    881b:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+    881e:	01 c6                	add    %eax,%esi
+    8820:	eb 16                	jmp    8838 <memcmp+0x28>
+    8822:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+		if (*s1 != *s2)
+    8828:	0f b6 08             	movzbl (%eax),%ecx
+    882b:	0f b6 1a             	movzbl (%edx),%ebx
+    882e:	38 d9                	cmp    %bl,%cl
+    8830:	75 16                	jne    8848 <memcmp+0x38>
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+    8832:	83 c0 01             	add    $0x1,%eax
+    8835:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+    8838:	39 f0                	cmp    %esi,%eax
+    883a:	75 ec                	jne    8828 <memcmp+0x18>
+	}
+
+	return 0;
+}
+    883c:	5b                   	pop    %ebx
+	return 0;
+    883d:	31 c0                	xor    %eax,%eax
+}
+    883f:	5e                   	pop    %esi
+    8840:	5d                   	pop    %ebp
+    8841:	c3                   	ret
+    8842:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+			return (int) *s1 - (int) *s2;
+    8848:	0f b6 c1             	movzbl %cl,%eax
+    884b:	29 d8                	sub    %ebx,%eax
+}
+    884d:	5b                   	pop    %ebx
+    884e:	5e                   	pop    %esi
+    884f:	5d                   	pop    %ebp
+    8850:	c3                   	ret
+    8851:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    8858:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    885f:	90                   	nop
+
+00008860 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+    8860:	55                   	push   %ebp
+    8861:	89 e5                	mov    %esp,%ebp
+    8863:	8b 45 08             	mov    0x8(%ebp),%eax
+	const void *ends = (const char *) s + n;
+    8866:	8b 55 10             	mov    0x10(%ebp),%edx
+{
+    8869:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+    886c:	01 c2                	add    %eax,%edx
+	for (; s < ends; s++)
+    886e:	eb 07                	jmp    8877 <memfind+0x17>
+		if (*(const unsigned char *) s == (unsigned char) c)
+    8870:	38 08                	cmp    %cl,(%eax)
+    8872:	74 07                	je     887b <memfind+0x1b>
+	for (; s < ends; s++)
+    8874:	83 c0 01             	add    $0x1,%eax
+    8877:	39 d0                	cmp    %edx,%eax
+    8879:	72 f5                	jb     8870 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+    887b:	5d                   	pop    %ebp
+    887c:	c3                   	ret
+    887d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00008880 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+    8880:	55                   	push   %ebp
+    8881:	89 e5                	mov    %esp,%ebp
+    8883:	57                   	push   %edi
+    8884:	56                   	push   %esi
+    8885:	53                   	push   %ebx
+    8886:	83 ec 04             	sub    $0x4,%esp
+    8889:	8b 55 08             	mov    0x8(%ebp),%edx
+    888c:	8b 45 0c             	mov    0xc(%ebp),%eax
+    888f:	8b 75 10             	mov    0x10(%ebp),%esi
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+    8892:	eb 07                	jmp    889b <strtol+0x1b>
+    8894:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+		s++;
+    8898:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+    889b:	0f b6 0a             	movzbl (%edx),%ecx
+    889e:	80 f9 20             	cmp    $0x20,%cl
+    88a1:	74 f5                	je     8898 <strtol+0x18>
+    88a3:	80 f9 09             	cmp    $0x9,%cl
+    88a6:	74 f0                	je     8898 <strtol+0x18>
+
+	// plus/minus sign
+	if (*s == '+')
+    88a8:	80 f9 2b             	cmp    $0x2b,%cl
+    88ab:	0f 84 a7 00 00 00    	je     8958 <strtol+0xd8>
+	int neg = 0;
+    88b1:	31 ff                	xor    %edi,%edi
+		s++;
+	else if (*s == '-')
+    88b3:	80 f9 2d             	cmp    $0x2d,%cl
+    88b6:	0f 84 84 00 00 00    	je     8940 <strtol+0xc0>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+    88bc:	f7 c6 ef ff ff ff    	test   $0xffffffef,%esi
+    88c2:	75 14                	jne    88d8 <strtol+0x58>
+    88c4:	80 f9 30             	cmp    $0x30,%cl
+    88c7:	0f 84 a3 00 00 00    	je     8970 <strtol+0xf0>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+    88cd:	83 fe 01             	cmp    $0x1,%esi
+    88d0:	19 f6                	sbb    %esi,%esi
+    88d2:	83 e6 fa             	and    $0xfffffffa,%esi
+    88d5:	83 c6 10             	add    $0x10,%esi
+	else if (base == 0 && s[0] == '0')
+    88d8:	89 7d f0             	mov    %edi,-0x10(%ebp)
+    88db:	31 c9                	xor    %ecx,%ecx
+    88dd:	89 c7                	mov    %eax,%edi
+    88df:	eb 16                	jmp    88f7 <strtol+0x77>
+    88e1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+    88e8:	0f be d8             	movsbl %al,%ebx
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+    88eb:	39 f3                	cmp    %esi,%ebx
+    88ed:	7d 23                	jge    8912 <strtol+0x92>
+			break;
+		s++, val = (val * base) + dig;
+    88ef:	0f af ce             	imul   %esi,%ecx
+    88f2:	83 c2 01             	add    $0x1,%edx
+    88f5:	01 d9                	add    %ebx,%ecx
+		if (*s >= '0' && *s <= '9')
+    88f7:	0f b6 1a             	movzbl (%edx),%ebx
+    88fa:	8d 43 d0             	lea    -0x30(%ebx),%eax
+    88fd:	3c 09                	cmp    $0x9,%al
+    88ff:	76 e7                	jbe    88e8 <strtol+0x68>
+		else if (*s >= 'a' && *s <= 'z')
+    8901:	8d 43 9f             	lea    -0x61(%ebx),%eax
+    8904:	3c 19                	cmp    $0x19,%al
+    8906:	77 28                	ja     8930 <strtol+0xb0>
+			dig = *s - 'a' + 10;
+    8908:	83 eb 57             	sub    $0x57,%ebx
+    890b:	0f be db             	movsbl %bl,%ebx
+		if (dig >= base)
+    890e:	39 f3                	cmp    %esi,%ebx
+    8910:	7c dd                	jl     88ef <strtol+0x6f>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+    8912:	89 f8                	mov    %edi,%eax
+    8914:	8b 7d f0             	mov    -0x10(%ebp),%edi
+    8917:	85 c0                	test   %eax,%eax
+    8919:	74 02                	je     891d <strtol+0x9d>
+		*endptr = (char *) s;
+    891b:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+    891d:	89 c8                	mov    %ecx,%eax
+    891f:	f7 d8                	neg    %eax
+    8921:	85 ff                	test   %edi,%edi
+    8923:	0f 45 c8             	cmovne %eax,%ecx
+}
+    8926:	83 c4 04             	add    $0x4,%esp
+    8929:	5b                   	pop    %ebx
+    892a:	5e                   	pop    %esi
+    892b:	89 c8                	mov    %ecx,%eax
+    892d:	5f                   	pop    %edi
+    892e:	5d                   	pop    %ebp
+    892f:	c3                   	ret
+		else if (*s >= 'A' && *s <= 'Z')
+    8930:	8d 43 bf             	lea    -0x41(%ebx),%eax
+    8933:	3c 19                	cmp    $0x19,%al
+    8935:	77 db                	ja     8912 <strtol+0x92>
+			dig = *s - 'A' + 10;
+    8937:	83 eb 37             	sub    $0x37,%ebx
+    893a:	0f be db             	movsbl %bl,%ebx
+    893d:	eb ac                	jmp    88eb <strtol+0x6b>
+    893f:	90                   	nop
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+    8940:	0f b6 4a 01          	movzbl 0x1(%edx),%ecx
+		s++, neg = 1;
+    8944:	bf 01 00 00 00       	mov    $0x1,%edi
+    8949:	83 c2 01             	add    $0x1,%edx
+    894c:	e9 6b ff ff ff       	jmp    88bc <strtol+0x3c>
+    8951:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+    8958:	0f b6 4a 01          	movzbl 0x1(%edx),%ecx
+	int neg = 0;
+    895c:	31 ff                	xor    %edi,%edi
+		s++;
+    895e:	83 c2 01             	add    $0x1,%edx
+    8961:	e9 56 ff ff ff       	jmp    88bc <strtol+0x3c>
+    8966:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    896d:	8d 76 00             	lea    0x0(%esi),%esi
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+    8970:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+    8974:	74 1b                	je     8991 <strtol+0x111>
+	else if (base == 0 && s[0] == '0')
+    8976:	85 f6                	test   %esi,%esi
+    8978:	74 0a                	je     8984 <strtol+0x104>
+    897a:	be 10 00 00 00       	mov    $0x10,%esi
+    897f:	e9 54 ff ff ff       	jmp    88d8 <strtol+0x58>
+		s++, base = 8;
+    8984:	83 c2 01             	add    $0x1,%edx
+    8987:	be 08 00 00 00       	mov    $0x8,%esi
+    898c:	e9 47 ff ff ff       	jmp    88d8 <strtol+0x58>
+		s += 2, base = 16;
+    8991:	83 c2 02             	add    $0x2,%edx
+    8994:	be 10 00 00 00       	mov    $0x10,%esi
+    8999:	e9 3a ff ff ff       	jmp    88d8 <strtol+0x58>
@@ -0,0 +1,17025 @@
+
+obj/kern/kernel:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00100000 <_start-0xc>:
+  100000:	02 b0 ad 1b 00 00    	add    0x1bad(%eax),%dh
+  100006:	00 00                	add    %al,(%eax)
+  100008:	fe 4f 52             	decb   0x52(%edi)
+  10000b:	e4                   	.byte 0xe4
+
+0010000c <_start>:
+.globl		_start
+_start = RELOC(entry)
+
+.globl entry
+entry:
+	movw	$0x1234,0x472			# warm boot
+  10000c:	66 c7 05 72 04 00 00 	movw   $0x1234,0x472
+  100013:	34 12 
+
+	# Note the time for the boot timeline; i386_init records it.
+	rdtsc
+  100015:	0f 31                	rdtsc
+	movl	%eax, RELOC(entry_tsc)
+  100017:	a3 00 50 11 00       	mov    %eax,0x115000
+	movl	%edx, RELOC(entry_tsc) + 4
+  10001c:	89 15 04 50 11 00    	mov    %edx,0x115004
+	# in lab 6.
+
+	# Clear the frame pointer register (EBP)
+	# so that once we get into debugging C code,
+	# stack backtraces will be terminated properly.
+	movl	$0x0,%ebp			# nuke frame pointer
+  100022:	bd 00 00 00 00       	mov    $0x0,%ebp
+
+	# Set the stack pointer
+	movl	$(bootstacktop),%esp
+  100027:	bc 00 e0 11 00       	mov    $0x11e000,%esp
+
+	# now to C code
+	call	i386_init
+  10002c:	e8 01 01 00 00       	call   100132 <i386_init>
+
+00100031 <spin>:
+
+	# Should never get here, but in case we do, just spin.
+spin:	jmp	spin
+  100031:	eb fe                	jmp    100031 <spin>
+
+00100033 <test_backtrace>:
+#include <kern/kdebug.h>
+
+// Test the stack backtrace function (lab 1 only)
+void
+test_backtrace(int x)
+{
+  100033:	55                   	push   %ebp
+  100034:	89 e5                	mov    %esp,%ebp
+  100036:	53                   	push   %ebx
+  100037:	83 ec 0c             	sub    $0xc,%esp
+  10003a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	cprintf("entering test_backtrace %d\n", x);
+  10003d:	53                   	push   %ebx
+  10003e:	68 80 94 10 00       	push   $0x109480
+  100043:	e8 ec 77 00 00       	call   107834 <cprintf>
+	if (x > 0)
+  100048:	83 c4 10             	add    $0x10,%esp
+  10004b:	85 db                	test   %ebx,%ebx
+  10004d:	7e 25                	jle    100074 <test_backtrace+0x41>
+		test_backtrace(x-1);
+  10004f:	83 ec 0c             	sub    $0xc,%esp
+  100052:	8d 43 ff             	lea    -0x1(%ebx),%eax
+  100055:	50                   	push   %eax
+  100056:	e8 d8 ff ff ff       	call   100033 <test_backtrace>
+  10005b:	83 c4 10             	add    $0x10,%esp
+	else
+		mon_backtrace(0, 0, 0);
+	cprintf("leaving test_backtrace %d\n", x);
+  10005e:	83 ec 08             	sub    $0x8,%esp
+  100061:	53                   	push   %ebx
+  100062:	68 9c 94 10 00       	push   $0x10949c
+  100067:	e8 c8 77 00 00       	call   107834 <cprintf>
+}
+  10006c:	83 c4 10             	add    $0x10,%esp
+  10006f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  100072:	c9                   	leave
+  100073:	c3                   	ret
+		mon_backtrace(0, 0, 0);
+  100074:	83 ec 04             	sub    $0x4,%esp
+  100077:	6a 00                	push   $0x0
+  100079:	6a 00                	push   $0x0
+  10007b:	6a 00                	push   $0x0
+  10007d:	e8 2d 6f 00 00       	call   106faf <mon_backtrace>
+  100082:	83 c4 10             	add    $0x10,%esp
+  100085:	eb d7                	jmp    10005e <test_backtrace+0x2b>
+
+00100087 <_panic>:
+ * Panic is called on unresolvable fatal errors.
+ * It prints "panic: mesg", and then enters the kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt,...)
+{
+  100087:	55                   	push   %ebp
+  100088:	89 e5                	mov    %esp,%ebp
+  10008a:	56                   	push   %esi
+  10008b:	53                   	push   %ebx
+  10008c:	81 ec 90 00 00 00    	sub    $0x90,%esp
+  100092:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	va_list ap;
+	char name[KSYM_NAME_LEN];
+	uintptr_t offset;
+
+	if (panicstr)
+  100095:	83 3d 00 e0 11 00 00 	cmpl   $0x0,0x11e000
+  10009c:	0f 85 81 00 00 00    	jne    100123 <_panic+0x9c>
+		goto dead;
+	panicstr = fmt;
+  1000a2:	89 1d 00 e0 11 00    	mov    %ebx,0x11e000
+
+	// Be extra sure that the machine is in as reasonable state
+	__asm __volatile("cli; cld");
+  1000a8:	fa                   	cli
+  1000a9:	fc                   	cld
+
+	va_start(ap, fmt);
+  1000aa:	8d 75 14             	lea    0x14(%ebp),%esi
+	cprintf("kernel panic at %s:%d", file, line);
+  1000ad:	83 ec 04             	sub    $0x4,%esp
+  1000b0:	ff 75 0c             	push   0xc(%ebp)
+  1000b3:	ff 75 08             	push   0x8(%ebp)
+  1000b6:	68 b7 94 10 00       	push   $0x1094b7
+  1000bb:	e8 74 77 00 00       	call   107834 <cprintf>
+	if (ksym_lookup((uintptr_t) __builtin_return_address(0), name, &offset))
+  1000c0:	83 c4 0c             	add    $0xc,%esp
+  1000c3:	8d 85 74 ff ff ff    	lea    -0x8c(%ebp),%eax
+  1000c9:	50                   	push   %eax
+  1000ca:	8d 85 78 ff ff ff    	lea    -0x88(%ebp),%eax
+  1000d0:	50                   	push   %eax
+  1000d1:	ff 75 04             	push   0x4(%ebp)
+  1000d4:	e8 a1 87 00 00       	call   10887a <ksym_lookup>
+  1000d9:	83 c4 10             	add    $0x10,%esp
+  1000dc:	85 c0                	test   %eax,%eax
+  1000de:	74 1d                	je     1000fd <_panic+0x76>
+		cprintf(" (%s+%u)", name, offset);
+  1000e0:	83 ec 04             	sub    $0x4,%esp
+  1000e3:	ff b5 74 ff ff ff    	push   -0x8c(%ebp)
+  1000e9:	8d 85 78 ff ff ff    	lea    -0x88(%ebp),%eax
+  1000ef:	50                   	push   %eax
+  1000f0:	68 cd 94 10 00       	push   $0x1094cd
+  1000f5:	e8 3a 77 00 00       	call   107834 <cprintf>
+  1000fa:	83 c4 10             	add    $0x10,%esp
+	cprintf(": ");
+  1000fd:	83 ec 0c             	sub    $0xc,%esp
+  100100:	68 53 95 10 00       	push   $0x109553
+  100105:	e8 2a 77 00 00       	call   107834 <cprintf>
+	vcprintf(fmt, ap);
+  10010a:	83 c4 08             	add    $0x8,%esp
+  10010d:	56                   	push   %esi
+  10010e:	53                   	push   %ebx
+  10010f:	e8 fa 76 00 00       	call   10780e <vcprintf>
+	cprintf("\n");
+  100114:	c7 04 24 3a 95 10 00 	movl   $0x10953a,(%esp)
+  10011b:	e8 14 77 00 00       	call   107834 <cprintf>
+  100120:	83 c4 10             	add    $0x10,%esp
+	va_end(ap);
+
+dead:
+	/* break into the kernel monitor */
+	while (1)
+		monitor(NULL);
+  100123:	83 ec 0c             	sub    $0xc,%esp
+  100126:	6a 00                	push   $0x0
+  100128:	e8 41 75 00 00       	call   10766e <monitor>
+  10012d:	83 c4 10             	add    $0x10,%esp
+  100130:	eb f1                	jmp    100123 <_panic+0x9c>
+
+00100132 <i386_init>:
+{
+  100132:	55                   	push   %ebp
+  100133:	89 e5                	mov    %esp,%ebp
+  100135:	57                   	push   %edi
+  100136:	56                   	push   %esi
+  100137:	53                   	push   %ebx
+  100138:	83 ec 7c             	sub    $0x7c,%esp
+
+static __inline uint64_t
+read_tsc(void)
+{
+	uint64_t tsc;
+	__asm __volatile("rdtsc" : "=A" (tsc));
+  10013b:	0f 31                	rdtsc
+  10013d:	89 c1                	mov    %eax,%ecx
+  10013f:	89 d3                	mov    %edx,%ebx
+	if (BOOTINFO->bi_magic != BOOTINFO_MAGIC)
+  100141:	81 3d 00 10 00 00 42 	cmpl   $0x4a4f5342,0x1000
+  100148:	53 4f 4a 
+  10014b:	0f 84 69 01 00 00    	je     1002ba <i386_init+0x188>
+	boot_event(BOOTEV_ENTRY, 0, entry_tsc);
+  100151:	a1 00 50 11 00       	mov    0x115000,%eax
+  100156:	8b 15 04 50 11 00    	mov    0x115004,%edx
+static __inline void
+boot_event(uint32_t what, uint32_t arg, uint64_t tsc)
+{
+	struct Bootevent *ev;
+
+	if (BOOTINFO->bi_nevents >= BOOTINFO_NEVENTS)
+  10015c:	be 00 00 00 00       	mov    $0x0,%esi
+		return;
+	ev = &BOOTINFO->bi_events[BOOTINFO->bi_nevents++];
+  100161:	8d 7e 01             	lea    0x1(%esi),%edi
+  100164:	89 3d 24 10 00 00    	mov    %edi,0x1024
+  10016a:	c1 e6 04             	shl    $0x4,%esi
+	ev->be_what = what;
+  10016d:	c7 86 28 10 00 00 02 	movl   $0x2,0x1028(%esi)
+  100174:	00 00 00 
+	ev->be_arg = arg;
+  100177:	c7 86 2c 10 00 00 00 	movl   $0x0,0x102c(%esi)
+  10017e:	00 00 00 
+	ev->be_tsc = tsc;
+  100181:	89 86 30 10 00 00    	mov    %eax,0x1030(%esi)
+  100187:	89 96 34 10 00 00    	mov    %edx,0x1034(%esi)
+	if (BOOTINFO->bi_nevents >= BOOTINFO_NEVENTS)
+  10018d:	8b 15 24 10 00 00    	mov    0x1024,%edx
+  100193:	83 fa 1f             	cmp    $0x1f,%edx
+  100196:	77 2b                	ja     1001c3 <i386_init+0x91>
+	ev = &BOOTINFO->bi_events[BOOTINFO->bi_nevents++];
+  100198:	8d 42 01             	lea    0x1(%edx),%eax
+  10019b:	a3 24 10 00 00       	mov    %eax,0x1024
+  1001a0:	c1 e2 04             	shl    $0x4,%edx
+	ev->be_what = what;
+  1001a3:	c7 82 28 10 00 00 03 	movl   $0x3,0x1028(%edx)
+  1001aa:	00 00 00 
+	ev->be_arg = arg;
+  1001ad:	c7 82 2c 10 00 00 00 	movl   $0x0,0x102c(%edx)
+  1001b4:	00 00 00 
+	ev->be_tsc = tsc;
+  1001b7:	89 8a 30 10 00 00    	mov    %ecx,0x1030(%edx)
+  1001bd:	89 9a 34 10 00 00    	mov    %ebx,0x1034(%edx)
+	if (BOOTINFO->bi_magic != BOOTINFO_MAGIC ||
+  1001c3:	81 3d 00 10 00 00 42 	cmpl   $0x4a4f5342,0x1000
+  1001ca:	53 4f 4a 
+  1001cd:	0f 84 f2 00 00 00    	je     1002c5 <i386_init+0x193>
+		memset(edata, 0, end - edata);
+  1001d3:	83 ec 04             	sub    $0x4,%esp
+  1001d6:	b8 c0 11 12 00       	mov    $0x1211c0,%eax
+  1001db:	2d 00 e0 11 00       	sub    $0x11e000,%eax
+  1001e0:	50                   	push   %eax
+  1001e1:	6a 00                	push   $0x0
+  1001e3:	68 00 e0 11 00       	push   $0x11e000
+  1001e8:	e8 74 8f 00 00       	call   109161 <memset>
+  1001ed:	83 c4 10             	add    $0x10,%esp
+	cons_init();
+  1001f0:	e8 5a 05 00 00       	call   10074f <cons_init>
+  1001f5:	0f 31                	rdtsc
+  1001f7:	89 c1                	mov    %eax,%ecx
+  1001f9:	89 d3                	mov    %edx,%ebx
+	if (BOOTINFO->bi_nevents >= BOOTINFO_NEVENTS)
+  1001fb:	8b 15 24 10 00 00    	mov    0x1024,%edx
+  100201:	83 fa 1f             	cmp    $0x1f,%edx
+  100204:	77 2b                	ja     100231 <i386_init+0xff>
+	ev = &BOOTINFO->bi_events[BOOTINFO->bi_nevents++];
+  100206:	8d 42 01             	lea    0x1(%edx),%eax
+  100209:	a3 24 10 00 00       	mov    %eax,0x1024
+  10020e:	c1 e2 04             	shl    $0x4,%edx
+	ev->be_what = what;
+  100211:	c7 82 28 10 00 00 04 	movl   $0x4,0x1028(%edx)
+  100218:	00 00 00 
+	ev->be_arg = arg;
+  10021b:	c7 82 2c 10 00 00 00 	movl   $0x0,0x102c(%edx)
+  100222:	00 00 00 
+	ev->be_tsc = tsc;
+  100225:	89 8a 30 10 00 00    	mov    %ecx,0x1030(%edx)
+  10022b:	89 9a 34 10 00 00    	mov    %ebx,0x1034(%edx)
+	cprintf("6828 decimal is %o octal!\n", 6828);
+  100231:	83 ec 08             	sub    $0x8,%esp
+  100234:	68 ac 1a 00 00       	push   $0x1aac
+  100239:	68 d6 94 10 00       	push   $0x1094d6
+  10023e:	e8 f1 75 00 00       	call   107834 <cprintf>
+	if (BOOTINFO->bi_magic == BOOTINFO_MAGIC)
+  100243:	83 c4 10             	add    $0x10,%esp
+  100246:	81 3d 00 10 00 00 42 	cmpl   $0x4a4f5342,0x1000
+  10024d:	53 4f 4a 
+  100250:	0f 84 91 00 00 00    	je     1002e7 <i386_init+0x1b5>
+	test_backtrace(5);
+  100256:	83 ec 0c             	sub    $0xc,%esp
+  100259:	6a 05                	push   $0x5
+  10025b:	e8 d3 fd ff ff       	call   100033 <test_backtrace>
+	load_kernel_dwarf_info(&addrs);
+  100260:	8d 5d 80             	lea    -0x80(%ebp),%ebx
+  100263:	89 1c 24             	mov    %ebx,(%esp)
+  100266:	e8 61 77 00 00       	call   1079cc <load_kernel_dwarf_info>
+	assert(address_by_fname(&addrs, "test_backtrace", &addr) == 0);
+  10026b:	83 c4 0c             	add    $0xc,%esp
+  10026e:	8d 85 7c ff ff ff    	lea    -0x84(%ebp),%eax
+  100274:	50                   	push   %eax
+  100275:	68 f1 94 10 00       	push   $0x1094f1
+  10027a:	53                   	push   %ebx
+  10027b:	e8 db 26 00 00       	call   10295b <address_by_fname>
+  100280:	83 c4 10             	add    $0x10,%esp
+  100283:	85 c0                	test   %eax,%eax
+  100285:	0f 85 96 00 00 00    	jne    100321 <i386_init+0x1ef>
+	assert(addr == (uintptr_t) test_backtrace);
+  10028b:	81 bd 7c ff ff ff 33 	cmpl   $0x100033,-0x84(%ebp)
+  100292:	00 10 00 
+  100295:	0f 85 9c 00 00 00    	jne    100337 <i386_init+0x205>
+	cprintf("check_fnaddr() succeeded!\n");
+  10029b:	83 ec 0c             	sub    $0xc,%esp
+  10029e:	68 21 95 10 00       	push   $0x109521
+  1002a3:	e8 8c 75 00 00       	call   107834 <cprintf>
+}
+  1002a8:	83 c4 10             	add    $0x10,%esp
+		monitor(NULL);
+  1002ab:	83 ec 0c             	sub    $0xc,%esp
+  1002ae:	6a 00                	push   $0x0
+  1002b0:	e8 b9 73 00 00       	call   10766e <monitor>
+  1002b5:	83 c4 10             	add    $0x10,%esp
+  1002b8:	eb f1                	jmp    1002ab <i386_init+0x179>
+	if (BOOTINFO->bi_nevents >= BOOTINFO_NEVENTS)
+  1002ba:	8b 35 24 10 00 00    	mov    0x1024,%esi
+  1002c0:	83 fe 1f             	cmp    $0x1f,%esi
+  1002c3:	76 12                	jbe    1002d7 <i386_init+0x1a5>
+	if (BOOTINFO->bi_magic != BOOTINFO_MAGIC ||
+  1002c5:	f6 05 04 10 00 00 01 	testb  $0x1,0x1004
+  1002cc:	0f 85 1e ff ff ff    	jne    1001f0 <i386_init+0xbe>
+  1002d2:	e9 fc fe ff ff       	jmp    1001d3 <i386_init+0xa1>
+	boot_event(BOOTEV_ENTRY, 0, entry_tsc);
+  1002d7:	a1 00 50 11 00       	mov    0x115000,%eax
+  1002dc:	8b 15 04 50 11 00    	mov    0x115004,%edx
+  1002e2:	e9 7a fe ff ff       	jmp    100161 <i386_init+0x2f>
+		cprintf("Boot loader read the kernel in %llu cycles "
+  1002e7:	83 ec 0c             	sub    $0xc,%esp
+  1002ea:	ff 35 20 10 00 00    	push   0x1020
+  1002f0:	ff 35 1c 10 00 00    	push   0x101c
+  1002f6:	a1 14 10 00 00       	mov    0x1014,%eax
+  1002fb:	8b 15 18 10 00 00    	mov    0x1018,%edx
+  100301:	2b 05 0c 10 00 00    	sub    0x100c,%eax
+  100307:	1b 15 10 10 00 00    	sbb    0x1010,%edx
+  10030d:	52                   	push   %edx
+  10030e:	50                   	push   %eax
+  10030f:	68 58 95 10 00       	push   $0x109558
+  100314:	e8 1b 75 00 00       	call   107834 <cprintf>
+  100319:	83 c4 20             	add    $0x20,%esp
+  10031c:	e9 35 ff ff ff       	jmp    100256 <i386_init+0x124>
+	assert(address_by_fname(&addrs, "test_backtrace", &addr) == 0);
+  100321:	68 98 95 10 00       	push   $0x109598
+  100326:	68 00 95 10 00       	push   $0x109500
+  10032b:	6a 25                	push   $0x25
+  10032d:	68 15 95 10 00       	push   $0x109515
+  100332:	e8 50 fd ff ff       	call   100087 <_panic>
+	assert(addr == (uintptr_t) test_backtrace);
+  100337:	68 d0 95 10 00       	push   $0x1095d0
+  10033c:	68 00 95 10 00       	push   $0x109500
+  100341:	6a 26                	push   $0x26
+  100343:	68 15 95 10 00       	push   $0x109515
+  100348:	e8 3a fd ff ff       	call   100087 <_panic>
+
+0010034d <_warn>:
+}
+
+/* like panic, but don't */
+void
+_warn(const char *file, int line, const char *fmt,...)
+{
+  10034d:	55                   	push   %ebp
+  10034e:	89 e5                	mov    %esp,%ebp
+  100350:	53                   	push   %ebx
+  100351:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+
+	va_start(ap, fmt);
+  100354:	8d 5d 14             	lea    0x14(%ebp),%ebx
+	cprintf("kernel warning at %s:%d: ", file, line);
+  100357:	ff 75 0c             	push   0xc(%ebp)
+  10035a:	ff 75 08             	push   0x8(%ebp)
+  10035d:	68 3c 95 10 00       	push   $0x10953c
+  100362:	e8 cd 74 00 00       	call   107834 <cprintf>
+	vcprintf(fmt, ap);
+  100367:	83 c4 08             	add    $0x8,%esp
+  10036a:	53                   	push   %ebx
+  10036b:	ff 75 10             	push   0x10(%ebp)
+  10036e:	e8 9b 74 00 00       	call   10780e <vcprintf>
+	cprintf("\n");
+  100373:	c7 04 24 3a 95 10 00 	movl   $0x10953a,(%esp)
+  10037a:	e8 b5 74 00 00       	call   107834 <cprintf>
+	va_end(ap);
+}
+  10037f:	83 c4 10             	add    $0x10,%esp
+  100382:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  100385:	c9                   	leave
+  100386:	c3                   	ret
+
+00100387 <serial_proc_data>:
+	__asm __volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+  100387:	ba fd 03 00 00       	mov    $0x3fd,%edx
+  10038c:	ec                   	in     (%dx),%al
+static bool serial_exists;
+
+static int
+serial_proc_data(void)
+{
+	if (!(inb(COM1+COM_LSR) & COM_LSR_DATA))
+  10038d:	a8 01                	test   $0x1,%al
+  10038f:	74 0a                	je     10039b <serial_proc_data+0x14>
+  100391:	ba f8 03 00 00       	mov    $0x3f8,%edx
+  100396:	ec                   	in     (%dx),%al
+		return -1;
+	return inb(COM1+COM_RX);
+  100397:	0f b6 c0             	movzbl %al,%eax
+  10039a:	c3                   	ret
+		return -1;
+  10039b:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+  1003a0:	c3                   	ret
+
+001003a1 <cons_intr>:
+
+// called by device interrupt routines to feed input characters
+// into the circular console input buffer.
+static void
+cons_intr(int (*proc)(void))
+{
+  1003a1:	55                   	push   %ebp
+  1003a2:	89 e5                	mov    %esp,%ebp
+  1003a4:	53                   	push   %ebx
+  1003a5:	83 ec 04             	sub    $0x4,%esp
+  1003a8:	89 c3                	mov    %eax,%ebx
+	int c;
+
+	while ((c = (*proc)()) != -1) {
+  1003aa:	eb 23                	jmp    1003cf <cons_intr+0x2e>
+		if (c == 0)
+			continue;
+		cons.buf[cons.wpos++] = c;
+  1003ac:	8b 0d 44 e2 11 00    	mov    0x11e244,%ecx
+  1003b2:	8d 51 01             	lea    0x1(%ecx),%edx
+  1003b5:	88 81 40 e0 11 00    	mov    %al,0x11e040(%ecx)
+		if (cons.wpos == CONSBUFSIZE)
+  1003bb:	81 fa 00 02 00 00    	cmp    $0x200,%edx
+			cons.wpos = 0;
+  1003c1:	b8 00 00 00 00       	mov    $0x0,%eax
+  1003c6:	0f 44 d0             	cmove  %eax,%edx
+  1003c9:	89 15 44 e2 11 00    	mov    %edx,0x11e244
+	while ((c = (*proc)()) != -1) {
+  1003cf:	ff d3                	call   *%ebx
+  1003d1:	83 f8 ff             	cmp    $0xffffffff,%eax
+  1003d4:	74 06                	je     1003dc <cons_intr+0x3b>
+		if (c == 0)
+  1003d6:	85 c0                	test   %eax,%eax
+  1003d8:	75 d2                	jne    1003ac <cons_intr+0xb>
+  1003da:	eb f3                	jmp    1003cf <cons_intr+0x2e>
+	}
+}
+  1003dc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  1003df:	c9                   	leave
+  1003e0:	c3                   	ret
+
+001003e1 <kbd_proc_data>:
+{
+  1003e1:	55                   	push   %ebp
+  1003e2:	89 e5                	mov    %esp,%ebp
+  1003e4:	53                   	push   %ebx
+  1003e5:	83 ec 04             	sub    $0x4,%esp
+  1003e8:	ba 64 00 00 00       	mov    $0x64,%edx
+  1003ed:	ec                   	in     (%dx),%al
+	if ((inb(KBSTATP) & KBS_DIB) == 0)
+  1003ee:	a8 01                	test   $0x1,%al
+  1003f0:	0f 84 e6 00 00 00    	je     1004dc <kbd_proc_data+0xfb>
+  1003f6:	ba 60 00 00 00       	mov    $0x60,%edx
+  1003fb:	ec                   	in     (%dx),%al
+  1003fc:	89 c2                	mov    %eax,%edx
+	if (data == 0xE0) {
+  1003fe:	3c e0                	cmp    $0xe0,%al
+  100400:	74 61                	je     100463 <kbd_proc_data+0x82>
+	} else if (data & 0x80) {
+  100402:	84 c0                	test   %al,%al
+  100404:	78 70                	js     100476 <kbd_proc_data+0x95>
+	} else if (shift & E0ESC) {
+  100406:	8b 0d 20 e0 11 00    	mov    0x11e020,%ecx
+  10040c:	f6 c1 40             	test   $0x40,%cl
+  10040f:	74 0e                	je     10041f <kbd_proc_data+0x3e>
+		data |= 0x80;
+  100411:	83 c8 80             	or     $0xffffff80,%eax
+  100414:	89 c2                	mov    %eax,%edx
+		shift &= ~E0ESC;
+  100416:	83 e1 bf             	and    $0xffffffbf,%ecx
+  100419:	89 0d 20 e0 11 00    	mov    %ecx,0x11e020
+	shift |= shiftcode[data];
+  10041f:	0f b6 d2             	movzbl %dl,%edx
+  100422:	0f b6 82 40 97 10 00 	movzbl 0x109740(%edx),%eax
+  100429:	0b 05 20 e0 11 00    	or     0x11e020,%eax
+	shift ^= togglecode[data];
+  10042f:	0f b6 8a 40 96 10 00 	movzbl 0x109640(%edx),%ecx
+  100436:	31 c8                	xor    %ecx,%eax
+  100438:	a3 20 e0 11 00       	mov    %eax,0x11e020
+	c = charcode[shift & (CTL | SHIFT)][data];
+  10043d:	89 c1                	mov    %eax,%ecx
+  10043f:	83 e1 03             	and    $0x3,%ecx
+  100442:	8b 0c 8d 20 96 10 00 	mov    0x109620(,%ecx,4),%ecx
+  100449:	0f b6 14 11          	movzbl (%ecx,%edx,1),%edx
+  10044d:	0f b6 da             	movzbl %dl,%ebx
+	if (shift & CAPSLOCK) {
+  100450:	a8 08                	test   $0x8,%al
+  100452:	74 5d                	je     1004b1 <kbd_proc_data+0xd0>
+		if ('a' <= c && c <= 'z')
+  100454:	89 da                	mov    %ebx,%edx
+  100456:	8d 4b 9f             	lea    -0x61(%ebx),%ecx
+  100459:	83 f9 19             	cmp    $0x19,%ecx
+  10045c:	77 47                	ja     1004a5 <kbd_proc_data+0xc4>
+			c += 'A' - 'a';
+  10045e:	83 eb 20             	sub    $0x20,%ebx
+	if (!(~shift & (CTL | ALT)) && c == KEY_DEL) {
+  100461:	eb 0c                	jmp    10046f <kbd_proc_data+0x8e>
+		shift |= E0ESC;
+  100463:	83 0d 20 e0 11 00 40 	orl    $0x40,0x11e020
+		return 0;
+  10046a:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  10046f:	89 d8                	mov    %ebx,%eax
+  100471:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  100474:	c9                   	leave
+  100475:	c3                   	ret
+		data = (shift & E0ESC ? data : data & 0x7F);
+  100476:	8b 0d 20 e0 11 00    	mov    0x11e020,%ecx
+  10047c:	83 e0 7f             	and    $0x7f,%eax
+  10047f:	f6 c1 40             	test   $0x40,%cl
+  100482:	0f 44 d0             	cmove  %eax,%edx
+		shift &= ~(shiftcode[data] | E0ESC);
+  100485:	0f b6 d2             	movzbl %dl,%edx
+  100488:	0f b6 82 40 97 10 00 	movzbl 0x109740(%edx),%eax
+  10048f:	83 c8 40             	or     $0x40,%eax
+  100492:	0f b6 c0             	movzbl %al,%eax
+  100495:	f7 d0                	not    %eax
+  100497:	21 c8                	and    %ecx,%eax
+  100499:	a3 20 e0 11 00       	mov    %eax,0x11e020
+		return 0;
+  10049e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  1004a3:	eb ca                	jmp    10046f <kbd_proc_data+0x8e>
+		else if ('A' <= c && c <= 'Z')
+  1004a5:	83 ea 41             	sub    $0x41,%edx
+			c += 'a' - 'A';
+  1004a8:	8d 4b 20             	lea    0x20(%ebx),%ecx
+  1004ab:	83 fa 1a             	cmp    $0x1a,%edx
+  1004ae:	0f 42 d9             	cmovb  %ecx,%ebx
+	if (!(~shift & (CTL | ALT)) && c == KEY_DEL) {
+  1004b1:	f7 d0                	not    %eax
+  1004b3:	a8 06                	test   $0x6,%al
+  1004b5:	75 b8                	jne    10046f <kbd_proc_data+0x8e>
+  1004b7:	81 fb e9 00 00 00    	cmp    $0xe9,%ebx
+  1004bd:	75 b0                	jne    10046f <kbd_proc_data+0x8e>
+		cprintf("Rebooting!\n");
+  1004bf:	83 ec 0c             	sub    $0xc,%esp
+  1004c2:	68 f3 95 10 00       	push   $0x1095f3
+  1004c7:	e8 68 73 00 00       	call   107834 <cprintf>
+	__asm __volatile("outb %0,%w1" : : "a" (data), "d" (port));
+  1004cc:	b8 03 00 00 00       	mov    $0x3,%eax
+  1004d1:	ba 92 00 00 00       	mov    $0x92,%edx
+  1004d6:	ee                   	out    %al,(%dx)
+}
+  1004d7:	83 c4 10             	add    $0x10,%esp
+  1004da:	eb 93                	jmp    10046f <kbd_proc_data+0x8e>
+		return -1;
+  1004dc:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+  1004e1:	eb 8c                	jmp    10046f <kbd_proc_data+0x8e>
+
+001004e3 <cons_putc>:
+}
+
+// output a character to the console
+static void
+cons_putc(int c)
+{
+  1004e3:	55                   	push   %ebp
+  1004e4:	89 e5                	mov    %esp,%ebp
+  1004e6:	57                   	push   %edi
+  1004e7:	56                   	push   %esi
+  1004e8:	53                   	push   %ebx
+  1004e9:	83 ec 1c             	sub    $0x1c,%esp
+  1004ec:	89 c7                	mov    %eax,%edi
+	for (i = 0;
+  1004ee:	bb 00 00 00 00       	mov    $0x0,%ebx
+	__asm __volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+  1004f3:	be fd 03 00 00       	mov    $0x3fd,%esi
+  1004f8:	b9 84 00 00 00       	mov    $0x84,%ecx
+  1004fd:	89 f2                	mov    %esi,%edx
+  1004ff:	ec                   	in     (%dx),%al
+	     !(inb(COM1 + COM_LSR) & COM_LSR_TXRDY) && i < 12800;
+  100500:	a8 20                	test   $0x20,%al
+  100502:	75 13                	jne    100517 <cons_putc+0x34>
+  100504:	81 fb ff 31 00 00    	cmp    $0x31ff,%ebx
+  10050a:	7f 0b                	jg     100517 <cons_putc+0x34>
+  10050c:	89 ca                	mov    %ecx,%edx
+  10050e:	ec                   	in     (%dx),%al
+  10050f:	ec                   	in     (%dx),%al
+  100510:	ec                   	in     (%dx),%al
+  100511:	ec                   	in     (%dx),%al
+	     i++)
+  100512:	83 c3 01             	add    $0x1,%ebx
+  100515:	eb e6                	jmp    1004fd <cons_putc+0x1a>
+	outb(COM1 + COM_TX, c);
+  100517:	89 f8                	mov    %edi,%eax
+  100519:	88 45 e7             	mov    %al,-0x19(%ebp)
+	__asm __volatile("outb %0,%w1" : : "a" (data), "d" (port));
+  10051c:	ba f8 03 00 00       	mov    $0x3f8,%edx
+  100521:	ee                   	out    %al,(%dx)
+	for (i = 0; !(inb(0x378+1) & 0x80) && i < 12800; i++)
+  100522:	bb 00 00 00 00       	mov    $0x0,%ebx
+	__asm __volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+  100527:	be 79 03 00 00       	mov    $0x379,%esi
+  10052c:	b9 84 00 00 00       	mov    $0x84,%ecx
+  100531:	89 f2                	mov    %esi,%edx
+  100533:	ec                   	in     (%dx),%al
+  100534:	81 fb ff 31 00 00    	cmp    $0x31ff,%ebx
+  10053a:	7f 0f                	jg     10054b <cons_putc+0x68>
+  10053c:	84 c0                	test   %al,%al
+  10053e:	78 0b                	js     10054b <cons_putc+0x68>
+  100540:	89 ca                	mov    %ecx,%edx
+  100542:	ec                   	in     (%dx),%al
+  100543:	ec                   	in     (%dx),%al
+  100544:	ec                   	in     (%dx),%al
+  100545:	ec                   	in     (%dx),%al
+  100546:	83 c3 01             	add    $0x1,%ebx
+  100549:	eb e6                	jmp    100531 <cons_putc+0x4e>
+	__asm __volatile("outb %0,%w1" : : "a" (data), "d" (port));
+  10054b:	ba 78 03 00 00       	mov    $0x378,%edx
+  100550:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+  100554:	ee                   	out    %al,(%dx)
+  100555:	ba 7a 03 00 00       	mov    $0x37a,%edx
+  10055a:	b8 0d 00 00 00       	mov    $0xd,%eax
+  10055f:	ee                   	out    %al,(%dx)
+  100560:	b8 08 00 00 00       	mov    $0x8,%eax
+  100565:	ee                   	out    %al,(%dx)
+		c |= 0x0700;
+  100566:	89 f8                	mov    %edi,%eax
+  100568:	80 cc 07             	or     $0x7,%ah
+  10056b:	81 ff 00 01 00 00    	cmp    $0x100,%edi
+  100571:	0f 42 f8             	cmovb  %eax,%edi
+	switch (c & 0xff) {
+  100574:	89 f8                	mov    %edi,%eax
+  100576:	0f b6 c0             	movzbl %al,%eax
+  100579:	89 fb                	mov    %edi,%ebx
+  10057b:	80 fb 0a             	cmp    $0xa,%bl
+  10057e:	0f 84 e1 00 00 00    	je     100665 <cons_putc+0x182>
+  100584:	83 f8 0a             	cmp    $0xa,%eax
+  100587:	7f 46                	jg     1005cf <cons_putc+0xec>
+  100589:	83 f8 08             	cmp    $0x8,%eax
+  10058c:	0f 84 a7 00 00 00    	je     100639 <cons_putc+0x156>
+  100592:	83 f8 09             	cmp    $0x9,%eax
+  100595:	0f 85 d7 00 00 00    	jne    100672 <cons_putc+0x18f>
+		cons_putc(' ');
+  10059b:	b8 20 00 00 00       	mov    $0x20,%eax
+  1005a0:	e8 3e ff ff ff       	call   1004e3 <cons_putc>
+		cons_putc(' ');
+  1005a5:	b8 20 00 00 00       	mov    $0x20,%eax
+  1005aa:	e8 34 ff ff ff       	call   1004e3 <cons_putc>
+		cons_putc(' ');
+  1005af:	b8 20 00 00 00       	mov    $0x20,%eax
+  1005b4:	e8 2a ff ff ff       	call   1004e3 <cons_putc>
+		cons_putc(' ');
+  1005b9:	b8 20 00 00 00       	mov    $0x20,%eax
+  1005be:	e8 20 ff ff ff       	call   1004e3 <cons_putc>
+		cons_putc(' ');
+  1005c3:	b8 20 00 00 00       	mov    $0x20,%eax
+  1005c8:	e8 16 ff ff ff       	call   1004e3 <cons_putc>
+		break;
+  1005cd:	eb 25                	jmp    1005f4 <cons_putc+0x111>
+	switch (c & 0xff) {
+  1005cf:	83 f8 0d             	cmp    $0xd,%eax
+  1005d2:	0f 85 9a 00 00 00    	jne    100672 <cons_putc+0x18f>
+		crt_pos -= (crt_pos % CRT_COLS);
+  1005d8:	0f b7 05 48 e2 11 00 	movzwl 0x11e248,%eax
+  1005df:	69 c0 cd cc 00 00    	imul   $0xcccd,%eax,%eax
+  1005e5:	c1 e8 16             	shr    $0x16,%eax
+  1005e8:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  1005eb:	c1 e0 04             	shl    $0x4,%eax
+  1005ee:	66 a3 48 e2 11 00    	mov    %ax,0x11e248
+	if (crt_pos >= CRT_SIZE) {
+  1005f4:	66 81 3d 48 e2 11 00 	cmpw   $0x7cf,0x11e248
+  1005fb:	cf 07 
+  1005fd:	0f 87 92 00 00 00    	ja     100695 <cons_putc+0x1b2>
+	outb(addr_6845, 14);
+  100603:	8b 0d 50 e2 11 00    	mov    0x11e250,%ecx
+  100609:	b8 0e 00 00 00       	mov    $0xe,%eax
+  10060e:	89 ca                	mov    %ecx,%edx
+  100610:	ee                   	out    %al,(%dx)
+	outb(addr_6845 + 1, crt_pos >> 8);
+  100611:	0f b7 1d 48 e2 11 00 	movzwl 0x11e248,%ebx
+  100618:	8d 71 01             	lea    0x1(%ecx),%esi
+  10061b:	89 d8                	mov    %ebx,%eax
+  10061d:	66 c1 e8 08          	shr    $0x8,%ax
+  100621:	89 f2                	mov    %esi,%edx
+  100623:	ee                   	out    %al,(%dx)
+  100624:	b8 0f 00 00 00       	mov    $0xf,%eax
+  100629:	89 ca                	mov    %ecx,%edx
+  10062b:	ee                   	out    %al,(%dx)
+  10062c:	89 d8                	mov    %ebx,%eax
+  10062e:	89 f2                	mov    %esi,%edx
+  100630:	ee                   	out    %al,(%dx)
+	serial_putc(c);
+	lpt_putc(c);
+	cga_putc(c);
+}
+  100631:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  100634:	5b                   	pop    %ebx
+  100635:	5e                   	pop    %esi
+  100636:	5f                   	pop    %edi
+  100637:	5d                   	pop    %ebp
+  100638:	c3                   	ret
+		if (crt_pos > 0) {
+  100639:	0f b7 05 48 e2 11 00 	movzwl 0x11e248,%eax
+  100640:	66 85 c0             	test   %ax,%ax
+  100643:	74 be                	je     100603 <cons_putc+0x120>
+			crt_pos--;
+  100645:	83 e8 01             	sub    $0x1,%eax
+  100648:	66 a3 48 e2 11 00    	mov    %ax,0x11e248
+			crt_buf[crt_pos] = (c & ~0xff) | ' ';
+  10064e:	0f b7 c0             	movzwl %ax,%eax
+  100651:	66 81 e7 00 ff       	and    $0xff00,%di
+  100656:	83 cf 20             	or     $0x20,%edi
+  100659:	8b 15 4c e2 11 00    	mov    0x11e24c,%edx
+  10065f:	66 89 3c 42          	mov    %di,(%edx,%eax,2)
+  100663:	eb 8f                	jmp    1005f4 <cons_putc+0x111>
+		crt_pos += CRT_COLS;
+  100665:	66 83 05 48 e2 11 00 	addw   $0x50,0x11e248
+  10066c:	50 
+  10066d:	e9 66 ff ff ff       	jmp    1005d8 <cons_putc+0xf5>
+		crt_buf[crt_pos++] = c;		/* write the character */
+  100672:	0f b7 05 48 e2 11 00 	movzwl 0x11e248,%eax
+  100679:	8d 50 01             	lea    0x1(%eax),%edx
+  10067c:	66 89 15 48 e2 11 00 	mov    %dx,0x11e248
+  100683:	0f b7 c0             	movzwl %ax,%eax
+  100686:	8b 15 4c e2 11 00    	mov    0x11e24c,%edx
+  10068c:	66 89 3c 42          	mov    %di,(%edx,%eax,2)
+		break;
+  100690:	e9 5f ff ff ff       	jmp    1005f4 <cons_putc+0x111>
+		memmove(crt_buf, crt_buf + CRT_COLS, (CRT_SIZE - CRT_COLS) * sizeof(uint16_t));
+  100695:	a1 4c e2 11 00       	mov    0x11e24c,%eax
+  10069a:	83 ec 04             	sub    $0x4,%esp
+  10069d:	68 00 0f 00 00       	push   $0xf00
+  1006a2:	8d 90 a0 00 00 00    	lea    0xa0(%eax),%edx
+  1006a8:	52                   	push   %edx
+  1006a9:	50                   	push   %eax
+  1006aa:	e8 e7 8a 00 00       	call   109196 <memmove>
+			crt_buf[i] = 0x0700 | ' ';
+  1006af:	8b 15 4c e2 11 00    	mov    0x11e24c,%edx
+  1006b5:	8d 82 00 0f 00 00    	lea    0xf00(%edx),%eax
+  1006bb:	81 c2 a0 0f 00 00    	add    $0xfa0,%edx
+		for (i = CRT_SIZE - CRT_COLS; i < CRT_SIZE; i++)
+  1006c1:	83 c4 10             	add    $0x10,%esp
+  1006c4:	eb 08                	jmp    1006ce <cons_putc+0x1eb>
+			crt_buf[i] = 0x0700 | ' ';
+  1006c6:	66 c7 00 20 07       	movw   $0x720,(%eax)
+		for (i = CRT_SIZE - CRT_COLS; i < CRT_SIZE; i++)
+  1006cb:	83 c0 02             	add    $0x2,%eax
+  1006ce:	39 d0                	cmp    %edx,%eax
+  1006d0:	75 f4                	jne    1006c6 <cons_putc+0x1e3>
+		crt_pos -= CRT_COLS;
+  1006d2:	66 83 2d 48 e2 11 00 	subw   $0x50,0x11e248
+  1006d9:	50 
+  1006da:	e9 24 ff ff ff       	jmp    100603 <cons_putc+0x120>
+
+001006df <serial_intr>:
+	if (serial_exists)
+  1006df:	80 3d 54 e2 11 00 00 	cmpb   $0x0,0x11e254
+  1006e6:	75 01                	jne    1006e9 <serial_intr+0xa>
+  1006e8:	c3                   	ret
+{
+  1006e9:	55                   	push   %ebp
+  1006ea:	89 e5                	mov    %esp,%ebp
+  1006ec:	83 ec 08             	sub    $0x8,%esp
+		cons_intr(serial_proc_data);
+  1006ef:	b8 87 03 10 00       	mov    $0x100387,%eax
+  1006f4:	e8 a8 fc ff ff       	call   1003a1 <cons_intr>
+}
+  1006f9:	c9                   	leave
+  1006fa:	c3                   	ret
+
+001006fb <kbd_intr>:
+{
+  1006fb:	55                   	push   %ebp
+  1006fc:	89 e5                	mov    %esp,%ebp
+  1006fe:	83 ec 08             	sub    $0x8,%esp
+	cons_intr(kbd_proc_data);
+  100701:	b8 e1 03 10 00       	mov    $0x1003e1,%eax
+  100706:	e8 96 fc ff ff       	call   1003a1 <cons_intr>
+}
+  10070b:	c9                   	leave
+  10070c:	c3                   	ret
+
+0010070d <cons_getc>:
+{
+  10070d:	55                   	push   %ebp
+  10070e:	89 e5                	mov    %esp,%ebp
+  100710:	83 ec 08             	sub    $0x8,%esp
+	serial_intr();
+  100713:	e8 c7 ff ff ff       	call   1006df <serial_intr>
+	kbd_intr();
+  100718:	e8 de ff ff ff       	call   1006fb <kbd_intr>
+	if (cons.rpos != cons.wpos) {
+  10071d:	a1 40 e2 11 00       	mov    0x11e240,%eax
+	return 0;
+  100722:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (cons.rpos != cons.wpos) {
+  100727:	3b 05 44 e2 11 00    	cmp    0x11e244,%eax
+  10072d:	74 1c                	je     10074b <cons_getc+0x3e>
+		c = cons.buf[cons.rpos++];
+  10072f:	8d 48 01             	lea    0x1(%eax),%ecx
+  100732:	0f b6 90 40 e0 11 00 	movzbl 0x11e040(%eax),%edx
+			cons.rpos = 0;
+  100739:	3d ff 01 00 00       	cmp    $0x1ff,%eax
+  10073e:	b8 00 00 00 00       	mov    $0x0,%eax
+  100743:	0f 45 c1             	cmovne %ecx,%eax
+  100746:	a3 40 e2 11 00       	mov    %eax,0x11e240
+}
+  10074b:	89 d0                	mov    %edx,%eax
+  10074d:	c9                   	leave
+  10074e:	c3                   	ret
+
+0010074f <cons_init>:
+
+// initialize the console devices
+void
+cons_init(void)
+{
+  10074f:	55                   	push   %ebp
+  100750:	89 e5                	mov    %esp,%ebp
+  100752:	57                   	push   %edi
+  100753:	56                   	push   %esi
+  100754:	53                   	push   %ebx
+  100755:	83 ec 0c             	sub    $0xc,%esp
+	was = *cp;                            // CGA_BUF has fixed address.
+  100758:	0f b7 15 00 80 0b 00 	movzwl 0xb8000,%edx
+	*cp = (uint16_t) 0xA55A;
+  10075f:	66 c7 05 00 80 0b 00 	movw   $0xa55a,0xb8000
+  100766:	5a a5 
+	if (*cp != 0xA55A) {
+  100768:	0f b7 05 00 80 0b 00 	movzwl 0xb8000,%eax
+  10076f:	bb b4 03 00 00       	mov    $0x3b4,%ebx
+		cp = (uint16_t*) (KERNTOP + MONO_BUF); // Addressing lower bytes higher KERTOP mapping.
+  100774:	be 00 00 0b 00       	mov    $0xb0000,%esi
+	if (*cp != 0xA55A) {
+  100779:	66 3d 5a a5          	cmp    $0xa55a,%ax
+  10077d:	0f 84 a6 00 00 00    	je     100829 <cons_init+0xda>
+		addr_6845 = MONO_BASE;                 // MONO_BASE has fixed address.
+  100783:	89 1d 50 e2 11 00    	mov    %ebx,0x11e250
+  100789:	b8 0e 00 00 00       	mov    $0xe,%eax
+  10078e:	89 da                	mov    %ebx,%edx
+  100790:	ee                   	out    %al,(%dx)
+	pos = inb(addr_6845 + 1) << 8;
+  100791:	8d 7b 01             	lea    0x1(%ebx),%edi
+	__asm __volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+  100794:	89 fa                	mov    %edi,%edx
+  100796:	ec                   	in     (%dx),%al
+  100797:	0f b6 c8             	movzbl %al,%ecx
+  10079a:	c1 e1 08             	shl    $0x8,%ecx
+	__asm __volatile("outb %0,%w1" : : "a" (data), "d" (port));
+  10079d:	b8 0f 00 00 00       	mov    $0xf,%eax
+  1007a2:	89 da                	mov    %ebx,%edx
+  1007a4:	ee                   	out    %al,(%dx)
+	__asm __volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+  1007a5:	89 fa                	mov    %edi,%edx
+  1007a7:	ec                   	in     (%dx),%al
+	crt_buf = (uint16_t*) cp;
+  1007a8:	89 35 4c e2 11 00    	mov    %esi,0x11e24c
+	pos |= inb(addr_6845 + 1);
+  1007ae:	0f b6 c0             	movzbl %al,%eax
+  1007b1:	09 c8                	or     %ecx,%eax
+	crt_pos = pos;
+  1007b3:	66 a3 48 e2 11 00    	mov    %ax,0x11e248
+	__asm __volatile("outb %0,%w1" : : "a" (data), "d" (port));
+  1007b9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  1007be:	bb fa 03 00 00       	mov    $0x3fa,%ebx
+  1007c3:	89 c8                	mov    %ecx,%eax
+  1007c5:	89 da                	mov    %ebx,%edx
+  1007c7:	ee                   	out    %al,(%dx)
+  1007c8:	bf fb 03 00 00       	mov    $0x3fb,%edi
+  1007cd:	b8 80 ff ff ff       	mov    $0xffffff80,%eax
+  1007d2:	89 fa                	mov    %edi,%edx
+  1007d4:	ee                   	out    %al,(%dx)
+  1007d5:	b8 0c 00 00 00       	mov    $0xc,%eax
+  1007da:	ba f8 03 00 00       	mov    $0x3f8,%edx
+  1007df:	ee                   	out    %al,(%dx)
+  1007e0:	be f9 03 00 00       	mov    $0x3f9,%esi
+  1007e5:	89 c8                	mov    %ecx,%eax
+  1007e7:	89 f2                	mov    %esi,%edx
+  1007e9:	ee                   	out    %al,(%dx)
+  1007ea:	b8 03 00 00 00       	mov    $0x3,%eax
+  1007ef:	89 fa                	mov    %edi,%edx
+  1007f1:	ee                   	out    %al,(%dx)
+  1007f2:	ba fc 03 00 00       	mov    $0x3fc,%edx
+  1007f7:	89 c8                	mov    %ecx,%eax
+  1007f9:	ee                   	out    %al,(%dx)
+  1007fa:	b8 01 00 00 00       	mov    $0x1,%eax
+  1007ff:	89 f2                	mov    %esi,%edx
+  100801:	ee                   	out    %al,(%dx)
+	__asm __volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+  100802:	ba fd 03 00 00       	mov    $0x3fd,%edx
+  100807:	ec                   	in     (%dx),%al
+  100808:	89 c1                	mov    %eax,%ecx
+	serial_exists = (inb(COM1+COM_LSR) != 0xFF);
+  10080a:	3c ff                	cmp    $0xff,%al
+  10080c:	0f 95 05 54 e2 11 00 	setne  0x11e254
+  100813:	89 da                	mov    %ebx,%edx
+  100815:	ec                   	in     (%dx),%al
+  100816:	ba f8 03 00 00       	mov    $0x3f8,%edx
+  10081b:	ec                   	in     (%dx),%al
+	cga_init();
+	kbd_init();
+	serial_init();
+
+	if (!serial_exists)
+  10081c:	80 f9 ff             	cmp    $0xff,%cl
+  10081f:	74 1e                	je     10083f <cons_init+0xf0>
+		cprintf("Serial port does not exist!\n");
+}
+  100821:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  100824:	5b                   	pop    %ebx
+  100825:	5e                   	pop    %esi
+  100826:	5f                   	pop    %edi
+  100827:	5d                   	pop    %ebp
+  100828:	c3                   	ret
+		*cp = was;
+  100829:	66 89 15 00 80 0b 00 	mov    %dx,0xb8000
+  100830:	bb d4 03 00 00       	mov    $0x3d4,%ebx
+	cp = (uint16_t*) (KERNTOP + CGA_BUF); // Addressing lower bytes througth higher KERNTOP mapping.
+  100835:	be 00 80 0b 00       	mov    $0xb8000,%esi
+  10083a:	e9 44 ff ff ff       	jmp    100783 <cons_init+0x34>
+		cprintf("Serial port does not exist!\n");
+  10083f:	83 ec 0c             	sub    $0xc,%esp
+  100842:	68 ff 95 10 00       	push   $0x1095ff
+  100847:	e8 e8 6f 00 00       	call   107834 <cprintf>
+  10084c:	83 c4 10             	add    $0x10,%esp
+}
+  10084f:	eb d0                	jmp    100821 <cons_init+0xd2>
+
+00100851 <cputchar>:
+
+// `High'-level console I/O.  Used by readline and cprintf.
+
+void
+cputchar(int c)
+{
+  100851:	55                   	push   %ebp
+  100852:	89 e5                	mov    %esp,%ebp
+  100854:	83 ec 08             	sub    $0x8,%esp
+	cons_putc(c);
+  100857:	8b 45 08             	mov    0x8(%ebp),%eax
+  10085a:	e8 84 fc ff ff       	call   1004e3 <cons_putc>
+}
+  10085f:	c9                   	leave
+  100860:	c3                   	ret
+
+00100861 <getchar>:
+
+int
+getchar(void)
+{
+  100861:	55                   	push   %ebp
+  100862:	89 e5                	mov    %esp,%ebp
+  100864:	83 ec 08             	sub    $0x8,%esp
+	int c;
+
+	while ((c = cons_getc()) == 0)
+  100867:	e8 a1 fe ff ff       	call   10070d <cons_getc>
+  10086c:	85 c0                	test   %eax,%eax
+  10086e:	74 f7                	je     100867 <getchar+0x6>
+		/* do nothing */;
+	return c;
+}
+  100870:	c9                   	leave
+  100871:	c3                   	ret
+
+00100872 <iscons>:
+int
+iscons(int fdnum)
+{
+	// used by readline
+	return 1;
+}
+  100872:	b8 01 00 00 00       	mov    $0x1,%eax
+  100877:	c3                   	ret
+
+00100878 <ranges_addrx>:
+        }
+}
+
+// The address at `index` in the unit's entries in .debug_addr
+static uintptr_t ranges_addrx(const struct Dwarf_Ranges *rg, uint32_t index) {
+        const unsigned char *p = rg->rg_addrs->addr_begin +
+  100878:	8b 08                	mov    (%eax),%ecx
+                                 rg->rg_cu->cu_addr_base +
+  10087a:	8b 40 04             	mov    0x4(%eax),%eax
+                                 index * rg->rg_cu->cu_address_size;
+  10087d:	0f af 50 18          	imul   0x18(%eax),%edx
+                                 rg->rg_cu->cu_addr_base +
+  100881:	03 50 20             	add    0x20(%eax),%edx
+        const unsigned char *p = rg->rg_addrs->addr_begin +
+  100884:	03 51 48             	add    0x48(%ecx),%edx
+        if (p + sizeof(uint32_t) > rg->rg_addrs->addr_end) {
+  100887:	8d 42 04             	lea    0x4(%edx),%eax
+  10088a:	39 41 4c             	cmp    %eax,0x4c(%ecx)
+  10088d:	73 06                	jae    100895 <ranges_addrx+0x1d>
+                return 0;
+  10088f:	b8 00 00 00 00       	mov    $0x0,%eax
+        }
+        return get_unaligned(p, uint32_t);
+}
+  100894:	c3                   	ret
+static uintptr_t ranges_addrx(const struct Dwarf_Ranges *rg, uint32_t index) {
+  100895:	55                   	push   %ebp
+  100896:	89 e5                	mov    %esp,%ebp
+  100898:	83 ec 1c             	sub    $0x1c,%esp
+        return get_unaligned(p, uint32_t);
+  10089b:	6a 04                	push   $0x4
+  10089d:	52                   	push   %edx
+  10089e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  1008a1:	50                   	push   %eax
+  1008a2:	e8 51 89 00 00       	call   1091f8 <memcpy>
+  1008a7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  1008aa:	83 c4 10             	add    $0x10,%esp
+}
+  1008ad:	c9                   	leave
+  1008ae:	c3                   	ret
+
+001008af <dwarf_read_abbrev_entry>:
+                            int bufsize, unsigned address_size) {
+  1008af:	55                   	push   %ebp
+  1008b0:	89 e5                	mov    %esp,%ebp
+  1008b2:	57                   	push   %edi
+  1008b3:	56                   	push   %esi
+  1008b4:	53                   	push   %ebx
+  1008b5:	83 ec 2c             	sub    $0x2c,%esp
+  1008b8:	8b 45 0c             	mov    0xc(%ebp),%eax
+        switch (form) {
+  1008bb:	83 f8 2c             	cmp    $0x2c,%eax
+  1008be:	0f 87 8a 08 00 00    	ja     10114e <dwarf_read_abbrev_entry+0x89f>
+  1008c4:	ff 24 85 8c 98 10 00 	jmp    *0x10988c(,%eax,4)
+                if (buf && bufsize >= sizeof(uint32_t)) {
+  1008cb:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  1008cf:	74 06                	je     1008d7 <dwarf_read_abbrev_entry+0x28>
+  1008d1:	83 7d 14 03          	cmpl   $0x3,0x14(%ebp)
+  1008d5:	77 0d                	ja     1008e4 <dwarf_read_abbrev_entry+0x35>
+                bytes = address_size;
+  1008d7:	8b 5d 18             	mov    0x18(%ebp),%ebx
+}
+  1008da:	89 d8                	mov    %ebx,%eax
+  1008dc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  1008df:	5b                   	pop    %ebx
+  1008e0:	5e                   	pop    %esi
+  1008e1:	5f                   	pop    %edi
+  1008e2:	5d                   	pop    %ebp
+  1008e3:	c3                   	ret
+                        memcpy(buf, entry, sizeof(uint32_t));
+  1008e4:	83 ec 04             	sub    $0x4,%esp
+  1008e7:	6a 04                	push   $0x4
+  1008e9:	ff 75 08             	push   0x8(%ebp)
+  1008ec:	ff 75 10             	push   0x10(%ebp)
+  1008ef:	e8 04 89 00 00       	call   1091f8 <memcpy>
+  1008f4:	83 c4 10             	add    $0x10,%esp
+  1008f7:	eb de                	jmp    1008d7 <dwarf_read_abbrev_entry+0x28>
+                unsigned length = get_unaligned(entry, uint32_t);
+  1008f9:	83 ec 04             	sub    $0x4,%esp
+  1008fc:	6a 04                	push   $0x4
+  1008fe:	ff 75 08             	push   0x8(%ebp)
+  100901:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  100904:	50                   	push   %eax
+  100905:	e8 ee 88 00 00       	call   1091f8 <memcpy>
+  10090a:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+                entry += sizeof(uint32_t);
+  10090d:	8b 45 08             	mov    0x8(%ebp),%eax
+  100910:	83 c0 04             	add    $0x4,%eax
+  100913:	89 45 08             	mov    %eax,0x8(%ebp)
+                struct Slice slice = {
+  100916:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  100919:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+                if (buf) {
+  10091c:	83 c4 10             	add    $0x10,%esp
+  10091f:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  100923:	74 14                	je     100939 <dwarf_read_abbrev_entry+0x8a>
+                        memcpy(buf, &slice, sizeof(struct Slice));
+  100925:	83 ec 04             	sub    $0x4,%esp
+  100928:	6a 08                	push   $0x8
+  10092a:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  10092d:	50                   	push   %eax
+  10092e:	ff 75 10             	push   0x10(%ebp)
+  100931:	e8 c2 88 00 00       	call   1091f8 <memcpy>
+  100936:	83 c4 10             	add    $0x10,%esp
+                bytes = sizeof(uint32_t) + length;
+  100939:	83 c3 04             	add    $0x4,%ebx
+        } break;
+  10093c:	eb 9c                	jmp    1008da <dwarf_read_abbrev_entry+0x2b>
+                Dwarf_Half data = get_unaligned(entry, Dwarf_Half);
+  10093e:	83 ec 04             	sub    $0x4,%esp
+  100941:	6a 02                	push   $0x2
+  100943:	ff 75 08             	push   0x8(%ebp)
+  100946:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  100949:	50                   	push   %eax
+  10094a:	e8 a9 88 00 00       	call   1091f8 <memcpy>
+                entry += sizeof(Dwarf_Half);
+  10094f:	83 45 08 02          	addl   $0x2,0x8(%ebp)
+                if (buf && bufsize >= sizeof(Dwarf_Half)) {
+  100953:	83 c4 10             	add    $0x10,%esp
+  100956:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  10095a:	74 06                	je     100962 <dwarf_read_abbrev_entry+0xb3>
+  10095c:	83 7d 14 01          	cmpl   $0x1,0x14(%ebp)
+  100960:	77 0a                	ja     10096c <dwarf_read_abbrev_entry+0xbd>
+                bytes = sizeof(Dwarf_Half);
+  100962:	bb 02 00 00 00       	mov    $0x2,%ebx
+  100967:	e9 6e ff ff ff       	jmp    1008da <dwarf_read_abbrev_entry+0x2b>
+                        put_unaligned(data, (Dwarf_Half *)buf);
+  10096c:	83 ec 04             	sub    $0x4,%esp
+  10096f:	6a 02                	push   $0x2
+  100971:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  100974:	50                   	push   %eax
+  100975:	ff 75 10             	push   0x10(%ebp)
+  100978:	e8 7b 88 00 00       	call   1091f8 <memcpy>
+  10097d:	83 c4 10             	add    $0x10,%esp
+                bytes = sizeof(Dwarf_Half);
+  100980:	bb 02 00 00 00       	mov    $0x2,%ebx
+                        put_unaligned(data, (Dwarf_Half *)buf);
+  100985:	e9 50 ff ff ff       	jmp    1008da <dwarf_read_abbrev_entry+0x2b>
+                uint32_t data = get_unaligned(entry, uint32_t);
+  10098a:	83 ec 04             	sub    $0x4,%esp
+  10098d:	6a 04                	push   $0x4
+  10098f:	ff 75 08             	push   0x8(%ebp)
+  100992:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  100995:	50                   	push   %eax
+  100996:	e8 5d 88 00 00       	call   1091f8 <memcpy>
+                entry += sizeof(uint32_t);
+  10099b:	83 45 08 04          	addl   $0x4,0x8(%ebp)
+                if (buf && bufsize >= sizeof(uint32_t)) {
+  10099f:	83 c4 10             	add    $0x10,%esp
+  1009a2:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  1009a6:	74 06                	je     1009ae <dwarf_read_abbrev_entry+0xff>
+  1009a8:	83 7d 14 03          	cmpl   $0x3,0x14(%ebp)
+  1009ac:	77 0a                	ja     1009b8 <dwarf_read_abbrev_entry+0x109>
+                bytes = sizeof(uint32_t);
+  1009ae:	bb 04 00 00 00       	mov    $0x4,%ebx
+  1009b3:	e9 22 ff ff ff       	jmp    1008da <dwarf_read_abbrev_entry+0x2b>
+                        put_unaligned(data, (uint32_t *)buf);
+  1009b8:	83 ec 04             	sub    $0x4,%esp
+  1009bb:	6a 04                	push   $0x4
+  1009bd:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  1009c0:	50                   	push   %eax
+  1009c1:	ff 75 10             	push   0x10(%ebp)
+  1009c4:	e8 2f 88 00 00       	call   1091f8 <memcpy>
+  1009c9:	83 c4 10             	add    $0x10,%esp
+                bytes = sizeof(uint32_t);
+  1009cc:	bb 04 00 00 00       	mov    $0x4,%ebx
+                        put_unaligned(data, (uint32_t *)buf);
+  1009d1:	e9 04 ff ff ff       	jmp    1008da <dwarf_read_abbrev_entry+0x2b>
+                uint64_t data = get_unaligned(entry, uint64_t);
+  1009d6:	83 ec 04             	sub    $0x4,%esp
+  1009d9:	6a 08                	push   $0x8
+  1009db:	ff 75 08             	push   0x8(%ebp)
+  1009de:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  1009e1:	50                   	push   %eax
+  1009e2:	e8 11 88 00 00       	call   1091f8 <memcpy>
+                entry += sizeof(uint64_t);
+  1009e7:	83 45 08 08          	addl   $0x8,0x8(%ebp)
+                if (buf && bufsize >= sizeof(uint64_t)) {
+  1009eb:	83 c4 10             	add    $0x10,%esp
+  1009ee:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  1009f2:	74 06                	je     1009fa <dwarf_read_abbrev_entry+0x14b>
+  1009f4:	83 7d 14 07          	cmpl   $0x7,0x14(%ebp)
+  1009f8:	77 0a                	ja     100a04 <dwarf_read_abbrev_entry+0x155>
+                bytes = sizeof(uint64_t);
+  1009fa:	bb 08 00 00 00       	mov    $0x8,%ebx
+  1009ff:	e9 d6 fe ff ff       	jmp    1008da <dwarf_read_abbrev_entry+0x2b>
+                        put_unaligned(data, (uint64_t *)buf);
+  100a04:	83 ec 04             	sub    $0x4,%esp
+  100a07:	6a 08                	push   $0x8
+  100a09:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  100a0c:	50                   	push   %eax
+  100a0d:	ff 75 10             	push   0x10(%ebp)
+  100a10:	e8 e3 87 00 00       	call   1091f8 <memcpy>
+  100a15:	83 c4 10             	add    $0x10,%esp
+                bytes = sizeof(uint64_t);
+  100a18:	bb 08 00 00 00       	mov    $0x8,%ebx
+                        put_unaligned(data, (uint64_t *)buf);
+  100a1d:	e9 b8 fe ff ff       	jmp    1008da <dwarf_read_abbrev_entry+0x2b>
+                if (buf && bufsize >= sizeof(char *)) {
+  100a22:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  100a26:	74 06                	je     100a2e <dwarf_read_abbrev_entry+0x17f>
+  100a28:	83 7d 14 03          	cmpl   $0x3,0x14(%ebp)
+  100a2c:	77 16                	ja     100a44 <dwarf_read_abbrev_entry+0x195>
+                bytes = strlen(entry) + 1;
+  100a2e:	83 ec 0c             	sub    $0xc,%esp
+  100a31:	ff 75 08             	push   0x8(%ebp)
+  100a34:	e8 9c 85 00 00       	call   108fd5 <strlen>
+  100a39:	8d 58 01             	lea    0x1(%eax),%ebx
+        } break;
+  100a3c:	83 c4 10             	add    $0x10,%esp
+  100a3f:	e9 96 fe ff ff       	jmp    1008da <dwarf_read_abbrev_entry+0x2b>
+                        memcpy(buf, &entry, sizeof(char *));
+  100a44:	83 ec 04             	sub    $0x4,%esp
+  100a47:	6a 04                	push   $0x4
+  100a49:	8d 45 08             	lea    0x8(%ebp),%eax
+  100a4c:	50                   	push   %eax
+  100a4d:	ff 75 10             	push   0x10(%ebp)
+  100a50:	e8 a3 87 00 00       	call   1091f8 <memcpy>
+  100a55:	83 c4 10             	add    $0x10,%esp
+  100a58:	eb d4                	jmp    100a2e <dwarf_read_abbrev_entry+0x17f>
+                unsigned long count = dwarf_read_uleb128(entry, &length);
+  100a5a:	8b 45 08             	mov    0x8(%ebp),%eax
+  100a5d:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+	unsigned char byte;
+	int shift, count;
+
+	result = 0;
+	shift = 0;
+	count = 0;
+  100a60:	b8 00 00 00 00       	mov    $0x0,%eax
+	result = 0;
+  100a65:	bb 00 00 00 00       	mov    $0x0,%ebx
+  100a6a:	89 de                	mov    %ebx,%esi
+  100a6c:	89 c7                	mov    %eax,%edi
+
+	while (1) {
+		byte = *addr;
+  100a6e:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+  100a71:	0f b6 1c 01          	movzbl (%ecx,%eax,1),%ebx
+		addr++;
+		count++;
+  100a75:	83 c0 01             	add    $0x1,%eax
+
+		result |= (byte & 0x7f) << shift;
+  100a78:	89 da                	mov    %ebx,%edx
+  100a7a:	83 e2 7f             	and    $0x7f,%edx
+  100a7d:	8d 0c fd 00 00 00 00 	lea    0x0(,%edi,8),%ecx
+  100a84:	29 f9                	sub    %edi,%ecx
+  100a86:	d3 e2                	shl    %cl,%edx
+  100a88:	09 d6                	or     %edx,%esi
+		shift += 7;
+
+		if (!(byte & 0x80))
+  100a8a:	84 db                	test   %bl,%bl
+  100a8c:	78 de                	js     100a6c <dwarf_read_abbrev_entry+0x1bd>
+			break;
+	}
+
+	*ret = result;
+
+	return count;
+  100a8e:	89 f3                	mov    %esi,%ebx
+  100a90:	89 c6                	mov    %eax,%esi
+                entry += count;
+  100a92:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  100a95:	01 c7                	add    %eax,%edi
+  100a97:	89 7d 08             	mov    %edi,0x8(%ebp)
+                struct Slice slice = {
+  100a9a:	89 7d e0             	mov    %edi,-0x20(%ebp)
+  100a9d:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+                if (buf) {
+  100aa0:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  100aa4:	74 14                	je     100aba <dwarf_read_abbrev_entry+0x20b>
+                        memcpy(buf, &slice, sizeof(struct Slice));
+  100aa6:	83 ec 04             	sub    $0x4,%esp
+  100aa9:	6a 08                	push   $0x8
+  100aab:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  100aae:	50                   	push   %eax
+  100aaf:	ff 75 10             	push   0x10(%ebp)
+  100ab2:	e8 41 87 00 00       	call   1091f8 <memcpy>
+  100ab7:	83 c4 10             	add    $0x10,%esp
+                bytes = count + length;
+  100aba:	01 f3                	add    %esi,%ebx
+        } break;
+  100abc:	e9 19 fe ff ff       	jmp    1008da <dwarf_read_abbrev_entry+0x2b>
+                unsigned length = get_unaligned(entry, Dwarf_Small);
+  100ac1:	83 ec 04             	sub    $0x4,%esp
+  100ac4:	6a 01                	push   $0x1
+  100ac6:	ff 75 08             	push   0x8(%ebp)
+  100ac9:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  100acc:	50                   	push   %eax
+  100acd:	e8 26 87 00 00       	call   1091f8 <memcpy>
+  100ad2:	0f b6 5d e0          	movzbl -0x20(%ebp),%ebx
+                entry += sizeof(Dwarf_Small);
+  100ad6:	8b 45 08             	mov    0x8(%ebp),%eax
+  100ad9:	83 c0 01             	add    $0x1,%eax
+  100adc:	89 45 08             	mov    %eax,0x8(%ebp)
+                struct Slice slice = {
+  100adf:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  100ae2:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+                if (buf) {
+  100ae5:	83 c4 10             	add    $0x10,%esp
+  100ae8:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  100aec:	74 14                	je     100b02 <dwarf_read_abbrev_entry+0x253>
+                        memcpy(buf, &slice, sizeof(struct Slice));
+  100aee:	83 ec 04             	sub    $0x4,%esp
+  100af1:	6a 08                	push   $0x8
+  100af3:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  100af6:	50                   	push   %eax
+  100af7:	ff 75 10             	push   0x10(%ebp)
+  100afa:	e8 f9 86 00 00       	call   1091f8 <memcpy>
+  100aff:	83 c4 10             	add    $0x10,%esp
+                bytes = length + sizeof(Dwarf_Small);
+  100b02:	83 c3 01             	add    $0x1,%ebx
+        } break;
+  100b05:	e9 d0 fd ff ff       	jmp    1008da <dwarf_read_abbrev_entry+0x2b>
+                Dwarf_Small data = get_unaligned(entry, Dwarf_Small);
+  100b0a:	83 ec 04             	sub    $0x4,%esp
+  100b0d:	6a 01                	push   $0x1
+  100b0f:	ff 75 08             	push   0x8(%ebp)
+  100b12:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  100b15:	50                   	push   %eax
+  100b16:	e8 dd 86 00 00       	call   1091f8 <memcpy>
+  100b1b:	0f b6 45 e0          	movzbl -0x20(%ebp),%eax
+                if (buf && bufsize >= sizeof(Dwarf_Small)) {
+  100b1f:	83 c4 10             	add    $0x10,%esp
+  100b22:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  100b26:	0f 84 2c 06 00 00    	je     101158 <dwarf_read_abbrev_entry+0x8a9>
+  100b2c:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+  100b30:	0f 84 22 06 00 00    	je     101158 <dwarf_read_abbrev_entry+0x8a9>
+                        put_unaligned(data, (Dwarf_Small *)buf);
+  100b36:	8b 75 10             	mov    0x10(%ebp),%esi
+  100b39:	88 06                	mov    %al,(%esi)
+                bytes = sizeof(Dwarf_Small);
+  100b3b:	bb 01 00 00 00       	mov    $0x1,%ebx
+                        put_unaligned(data, (Dwarf_Small *)buf);
+  100b40:	e9 95 fd ff ff       	jmp    1008da <dwarf_read_abbrev_entry+0x2b>
+                bool data = get_unaligned(entry, Dwarf_Small);
+  100b45:	83 ec 04             	sub    $0x4,%esp
+  100b48:	6a 01                	push   $0x1
+  100b4a:	ff 75 08             	push   0x8(%ebp)
+  100b4d:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  100b50:	50                   	push   %eax
+  100b51:	e8 a2 86 00 00       	call   1091f8 <memcpy>
+  100b56:	0f b6 45 e0          	movzbl -0x20(%ebp),%eax
+                if (buf && bufsize >= sizeof(bool)) {
+  100b5a:	83 c4 10             	add    $0x10,%esp
+  100b5d:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  100b61:	0f 84 fb 05 00 00    	je     101162 <dwarf_read_abbrev_entry+0x8b3>
+  100b67:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+  100b6b:	0f 84 f1 05 00 00    	je     101162 <dwarf_read_abbrev_entry+0x8b3>
+                bool data = get_unaligned(entry, Dwarf_Small);
+  100b71:	84 c0                	test   %al,%al
+                        put_unaligned(data, (bool *)buf);
+  100b73:	8b 45 10             	mov    0x10(%ebp),%eax
+  100b76:	0f 95 00             	setne  (%eax)
+                bytes = sizeof(Dwarf_Small);
+  100b79:	bb 01 00 00 00       	mov    $0x1,%ebx
+                        put_unaligned(data, (bool *)buf);
+  100b7e:	e9 57 fd ff ff       	jmp    1008da <dwarf_read_abbrev_entry+0x2b>
+                int count = dwarf_read_leb128(entry, &data);
+  100b83:	8b 7d 08             	mov    0x8(%ebp),%edi
+	int num_bits;
+	int count;
+
+	result = 0;
+	shift = 0;
+	count = 0;
+  100b86:	bb 00 00 00 00       	mov    $0x0,%ebx
+	shift = 0;
+  100b8b:	b9 00 00 00 00       	mov    $0x0,%ecx
+	result = 0;
+  100b90:	be 00 00 00 00       	mov    $0x0,%esi
+
+	while (1) {
+		byte = *addr;
+  100b95:	0f b6 14 1f          	movzbl (%edi,%ebx,1),%edx
+		addr++;
+		result |= (byte & 0x7f) << shift;
+  100b99:	89 d0                	mov    %edx,%eax
+  100b9b:	83 e0 7f             	and    $0x7f,%eax
+  100b9e:	d3 e0                	shl    %cl,%eax
+  100ba0:	09 c6                	or     %eax,%esi
+		shift += 7;
+  100ba2:	83 c1 07             	add    $0x7,%ecx
+		count++;
+  100ba5:	83 c3 01             	add    $0x1,%ebx
+
+		if (!(byte & 0x80))
+  100ba8:	84 d2                	test   %dl,%dl
+  100baa:	78 e9                	js     100b95 <dwarf_read_abbrev_entry+0x2e6>
+	}
+
+	/* The number of bits in a signed integer. */
+	num_bits = 8 * sizeof(result);
+
+	if ((shift < num_bits) && (byte & 0x40))
+  100bac:	83 f9 1f             	cmp    $0x1f,%ecx
+  100baf:	7f 0e                	jg     100bbf <dwarf_read_abbrev_entry+0x310>
+  100bb1:	f6 c2 40             	test   $0x40,%dl
+  100bb4:	74 09                	je     100bbf <dwarf_read_abbrev_entry+0x310>
+		result |= (-1U << shift);
+  100bb6:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  100bbb:	d3 e0                	shl    %cl,%eax
+  100bbd:	09 c6                	or     %eax,%esi
+                entry += count;
+  100bbf:	01 df                	add    %ebx,%edi
+  100bc1:	89 7d 08             	mov    %edi,0x8(%ebp)
+                if (buf && bufsize >= sizeof(int)) {
+  100bc4:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  100bc8:	0f 84 0c fd ff ff    	je     1008da <dwarf_read_abbrev_entry+0x2b>
+  100bce:	83 7d 14 03          	cmpl   $0x3,0x14(%ebp)
+  100bd2:	0f 86 02 fd ff ff    	jbe    1008da <dwarf_read_abbrev_entry+0x2b>
+                        put_unaligned(data, (int *)buf);
+  100bd8:	89 75 e0             	mov    %esi,-0x20(%ebp)
+  100bdb:	83 ec 04             	sub    $0x4,%esp
+  100bde:	6a 04                	push   $0x4
+  100be0:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  100be3:	50                   	push   %eax
+  100be4:	ff 75 10             	push   0x10(%ebp)
+  100be7:	e8 0c 86 00 00       	call   1091f8 <memcpy>
+  100bec:	83 c4 10             	add    $0x10,%esp
+  100bef:	e9 e6 fc ff ff       	jmp    1008da <dwarf_read_abbrev_entry+0x2b>
+                int count = dwarf_entry_len(entry, &length);
+  100bf4:	8b 75 08             	mov    0x8(%ebp),%esi
+	initial_len = get_unaligned(addr, uint32_t);
+  100bf7:	83 ec 04             	sub    $0x4,%esp
+  100bfa:	6a 04                	push   $0x4
+  100bfc:	56                   	push   %esi
+  100bfd:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  100c00:	50                   	push   %eax
+  100c01:	e8 f2 85 00 00       	call   1091f8 <memcpy>
+  100c06:	8b 45 e0             	mov    -0x20(%ebp),%eax
+	if (initial_len >= DW_EXT_LO && initial_len <= DW_EXT_HI) {
+  100c09:	83 c4 10             	add    $0x10,%esp
+	count = 4;
+  100c0c:	bb 04 00 00 00       	mov    $0x4,%ebx
+	if (initial_len >= DW_EXT_LO && initial_len <= DW_EXT_HI) {
+  100c11:	83 f8 ef             	cmp    $0xffffffef,%eax
+  100c14:	76 1f                	jbe    100c35 <dwarf_read_abbrev_entry+0x386>
+		if (initial_len == DW_EXT_DWARF64) {
+  100c16:	83 f8 ff             	cmp    $0xffffffff,%eax
+  100c19:	74 4d                	je     100c68 <dwarf_read_abbrev_entry+0x3b9>
+			cprintf("Unknown DWARF extension\n");
+  100c1b:	83 ec 0c             	sub    $0xc,%esp
+  100c1e:	68 40 98 10 00       	push   $0x109840
+  100c23:	e8 0c 6c 00 00       	call   107834 <cprintf>
+  100c28:	83 c4 10             	add    $0x10,%esp
+                unsigned long length = 0;
+  100c2b:	b8 00 00 00 00       	mov    $0x0,%eax
+			count = 0;
+  100c30:	bb 00 00 00 00       	mov    $0x0,%ebx
+                entry += count;
+  100c35:	01 5d 08             	add    %ebx,0x8(%ebp)
+                if (buf && bufsize >= sizeof(unsigned long)) {
+  100c38:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  100c3c:	0f 84 98 fc ff ff    	je     1008da <dwarf_read_abbrev_entry+0x2b>
+  100c42:	83 7d 14 03          	cmpl   $0x3,0x14(%ebp)
+  100c46:	0f 86 8e fc ff ff    	jbe    1008da <dwarf_read_abbrev_entry+0x2b>
+                        put_unaligned(length, (unsigned long *)buf);
+  100c4c:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  100c4f:	83 ec 04             	sub    $0x4,%esp
+  100c52:	6a 04                	push   $0x4
+  100c54:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  100c57:	50                   	push   %eax
+  100c58:	ff 75 10             	push   0x10(%ebp)
+  100c5b:	e8 98 85 00 00       	call   1091f8 <memcpy>
+  100c60:	83 c4 10             	add    $0x10,%esp
+  100c63:	e9 72 fc ff ff       	jmp    1008da <dwarf_read_abbrev_entry+0x2b>
+			*len = get_unaligned((uint64_t *)addr + 4, uint64_t);
+  100c68:	83 ec 04             	sub    $0x4,%esp
+  100c6b:	6a 08                	push   $0x8
+  100c6d:	83 c6 20             	add    $0x20,%esi
+  100c70:	56                   	push   %esi
+  100c71:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  100c74:	50                   	push   %eax
+  100c75:	e8 7e 85 00 00       	call   1091f8 <memcpy>
+  100c7a:	8b 45 e0             	mov    -0x20(%ebp),%eax
+			count = 12;
+  100c7d:	83 c4 10             	add    $0x10,%esp
+  100c80:	bb 0c 00 00 00       	mov    $0xc,%ebx
+  100c85:	eb ae                	jmp    100c35 <dwarf_read_abbrev_entry+0x386>
+                int count = dwarf_read_uleb128(entry, &data);
+  100c87:	8b 45 08             	mov    0x8(%ebp),%eax
+  100c8a:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+	count = 0;
+  100c8d:	bb 00 00 00 00       	mov    $0x0,%ebx
+	result = 0;
+  100c92:	be 00 00 00 00       	mov    $0x0,%esi
+  100c97:	89 df                	mov    %ebx,%edi
+		byte = *addr;
+  100c99:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  100c9c:	0f b6 14 18          	movzbl (%eax,%ebx,1),%edx
+		count++;
+  100ca0:	83 c3 01             	add    $0x1,%ebx
+		result |= (byte & 0x7f) << shift;
+  100ca3:	89 d0                	mov    %edx,%eax
+  100ca5:	83 e0 7f             	and    $0x7f,%eax
+  100ca8:	8d 0c fd 00 00 00 00 	lea    0x0(,%edi,8),%ecx
+  100caf:	29 f9                	sub    %edi,%ecx
+  100cb1:	d3 e0                	shl    %cl,%eax
+  100cb3:	09 c6                	or     %eax,%esi
+		if (!(byte & 0x80))
+  100cb5:	84 d2                	test   %dl,%dl
+  100cb7:	78 de                	js     100c97 <dwarf_read_abbrev_entry+0x3e8>
+                entry += count;
+  100cb9:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  100cbc:	01 d8                	add    %ebx,%eax
+  100cbe:	89 45 08             	mov    %eax,0x8(%ebp)
+                if (buf && bufsize >= sizeof(unsigned int)) {
+  100cc1:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  100cc5:	0f 84 0f fc ff ff    	je     1008da <dwarf_read_abbrev_entry+0x2b>
+  100ccb:	83 7d 14 03          	cmpl   $0x3,0x14(%ebp)
+  100ccf:	0f 86 05 fc ff ff    	jbe    1008da <dwarf_read_abbrev_entry+0x2b>
+                        put_unaligned(data, (unsigned int *)buf);
+  100cd5:	89 75 e0             	mov    %esi,-0x20(%ebp)
+  100cd8:	83 ec 04             	sub    $0x4,%esp
+  100cdb:	6a 04                	push   $0x4
+  100cdd:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  100ce0:	50                   	push   %eax
+  100ce1:	ff 75 10             	push   0x10(%ebp)
+  100ce4:	e8 0f 85 00 00       	call   1091f8 <memcpy>
+  100ce9:	83 c4 10             	add    $0x10,%esp
+  100cec:	e9 e9 fb ff ff       	jmp    1008da <dwarf_read_abbrev_entry+0x2b>
+                int count = dwarf_entry_len(entry, &length);
+  100cf1:	8b 75 08             	mov    0x8(%ebp),%esi
+	initial_len = get_unaligned(addr, uint32_t);
+  100cf4:	83 ec 04             	sub    $0x4,%esp
+  100cf7:	6a 04                	push   $0x4
+  100cf9:	56                   	push   %esi
+  100cfa:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  100cfd:	50                   	push   %eax
+  100cfe:	e8 f5 84 00 00       	call   1091f8 <memcpy>
+  100d03:	8b 45 e0             	mov    -0x20(%ebp),%eax
+	if (initial_len >= DW_EXT_LO && initial_len <= DW_EXT_HI) {
+  100d06:	83 c4 10             	add    $0x10,%esp
+	count = 4;
+  100d09:	bb 04 00 00 00       	mov    $0x4,%ebx
+	if (initial_len >= DW_EXT_LO && initial_len <= DW_EXT_HI) {
+  100d0e:	83 f8 ef             	cmp    $0xffffffef,%eax
+  100d11:	76 1f                	jbe    100d32 <dwarf_read_abbrev_entry+0x483>
+		if (initial_len == DW_EXT_DWARF64) {
+  100d13:	83 f8 ff             	cmp    $0xffffffff,%eax
+  100d16:	74 4d                	je     100d65 <dwarf_read_abbrev_entry+0x4b6>
+			cprintf("Unknown DWARF extension\n");
+  100d18:	83 ec 0c             	sub    $0xc,%esp
+  100d1b:	68 40 98 10 00       	push   $0x109840
+  100d20:	e8 0f 6b 00 00       	call   107834 <cprintf>
+  100d25:	83 c4 10             	add    $0x10,%esp
+                unsigned long length = 0;
+  100d28:	b8 00 00 00 00       	mov    $0x0,%eax
+			count = 0;
+  100d2d:	bb 00 00 00 00       	mov    $0x0,%ebx
+                entry += count;
+  100d32:	01 5d 08             	add    %ebx,0x8(%ebp)
+                if (buf && bufsize >= sizeof(unsigned long)) {
+  100d35:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  100d39:	0f 84 9b fb ff ff    	je     1008da <dwarf_read_abbrev_entry+0x2b>
+  100d3f:	83 7d 14 03          	cmpl   $0x3,0x14(%ebp)
+  100d43:	0f 86 91 fb ff ff    	jbe    1008da <dwarf_read_abbrev_entry+0x2b>
+                        put_unaligned(length, (unsigned long *)buf);
+  100d49:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  100d4c:	83 ec 04             	sub    $0x4,%esp
+  100d4f:	6a 04                	push   $0x4
+  100d51:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  100d54:	50                   	push   %eax
+  100d55:	ff 75 10             	push   0x10(%ebp)
+  100d58:	e8 9b 84 00 00       	call   1091f8 <memcpy>
+  100d5d:	83 c4 10             	add    $0x10,%esp
+  100d60:	e9 75 fb ff ff       	jmp    1008da <dwarf_read_abbrev_entry+0x2b>
+			*len = get_unaligned((uint64_t *)addr + 4, uint64_t);
+  100d65:	83 ec 04             	sub    $0x4,%esp
+  100d68:	6a 08                	push   $0x8
+  100d6a:	83 c6 20             	add    $0x20,%esi
+  100d6d:	56                   	push   %esi
+  100d6e:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  100d71:	50                   	push   %eax
+  100d72:	e8 81 84 00 00       	call   1091f8 <memcpy>
+  100d77:	8b 45 e0             	mov    -0x20(%ebp),%eax
+			count = 12;
+  100d7a:	83 c4 10             	add    $0x10,%esp
+  100d7d:	bb 0c 00 00 00       	mov    $0xc,%ebx
+  100d82:	eb ae                	jmp    100d32 <dwarf_read_abbrev_entry+0x483>
+                Dwarf_Small data = get_unaligned(entry, Dwarf_Small);
+  100d84:	83 ec 04             	sub    $0x4,%esp
+  100d87:	6a 01                	push   $0x1
+  100d89:	ff 75 08             	push   0x8(%ebp)
+  100d8c:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  100d8f:	50                   	push   %eax
+  100d90:	e8 63 84 00 00       	call   1091f8 <memcpy>
+  100d95:	0f b6 45 e0          	movzbl -0x20(%ebp),%eax
+                if (buf && bufsize >= sizeof(Dwarf_Small)) {
+  100d99:	83 c4 10             	add    $0x10,%esp
+  100d9c:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  100da0:	0f 84 c6 03 00 00    	je     10116c <dwarf_read_abbrev_entry+0x8bd>
+  100da6:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+  100daa:	0f 84 bc 03 00 00    	je     10116c <dwarf_read_abbrev_entry+0x8bd>
+                        put_unaligned(data, (Dwarf_Small *)buf);
+  100db0:	8b 75 10             	mov    0x10(%ebp),%esi
+  100db3:	88 06                	mov    %al,(%esi)
+                bytes = sizeof(Dwarf_Small);
+  100db5:	bb 01 00 00 00       	mov    $0x1,%ebx
+                        put_unaligned(data, (Dwarf_Small *)buf);
+  100dba:	e9 1b fb ff ff       	jmp    1008da <dwarf_read_abbrev_entry+0x2b>
+                Dwarf_Half data = get_unaligned(entry, Dwarf_Half);
+  100dbf:	83 ec 04             	sub    $0x4,%esp
+  100dc2:	6a 02                	push   $0x2
+  100dc4:	ff 75 08             	push   0x8(%ebp)
+  100dc7:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  100dca:	50                   	push   %eax
+  100dcb:	e8 28 84 00 00       	call   1091f8 <memcpy>
+                entry += sizeof(Dwarf_Half);
+  100dd0:	83 45 08 02          	addl   $0x2,0x8(%ebp)
+                if (buf && bufsize >= sizeof(Dwarf_Half)) {
+  100dd4:	83 c4 10             	add    $0x10,%esp
+  100dd7:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  100ddb:	74 06                	je     100de3 <dwarf_read_abbrev_entry+0x534>
+  100ddd:	83 7d 14 01          	cmpl   $0x1,0x14(%ebp)
+  100de1:	77 0a                	ja     100ded <dwarf_read_abbrev_entry+0x53e>
+                bytes = sizeof(Dwarf_Half);
+  100de3:	bb 02 00 00 00       	mov    $0x2,%ebx
+  100de8:	e9 ed fa ff ff       	jmp    1008da <dwarf_read_abbrev_entry+0x2b>
+                        put_unaligned(data, (Dwarf_Half *)buf);
+  100ded:	83 ec 04             	sub    $0x4,%esp
+  100df0:	6a 02                	push   $0x2
+  100df2:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  100df5:	50                   	push   %eax
+  100df6:	ff 75 10             	push   0x10(%ebp)
+  100df9:	e8 fa 83 00 00       	call   1091f8 <memcpy>
+  100dfe:	83 c4 10             	add    $0x10,%esp
+                bytes = sizeof(Dwarf_Half);
+  100e01:	bb 02 00 00 00       	mov    $0x2,%ebx
+                        put_unaligned(data, (Dwarf_Half *)buf);
+  100e06:	e9 cf fa ff ff       	jmp    1008da <dwarf_read_abbrev_entry+0x2b>
+                uint32_t data = get_unaligned(entry, uint32_t);
+  100e0b:	83 ec 04             	sub    $0x4,%esp
+  100e0e:	6a 04                	push   $0x4
+  100e10:	ff 75 08             	push   0x8(%ebp)
+  100e13:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  100e16:	50                   	push   %eax
+  100e17:	e8 dc 83 00 00       	call   1091f8 <memcpy>
+                entry += sizeof(uint32_t);
+  100e1c:	83 45 08 04          	addl   $0x4,0x8(%ebp)
+                if (buf && bufsize >= sizeof(uint32_t)) {
+  100e20:	83 c4 10             	add    $0x10,%esp
+  100e23:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  100e27:	74 06                	je     100e2f <dwarf_read_abbrev_entry+0x580>
+  100e29:	83 7d 14 03          	cmpl   $0x3,0x14(%ebp)
+  100e2d:	77 0a                	ja     100e39 <dwarf_read_abbrev_entry+0x58a>
+                bytes = sizeof(uint32_t);
+  100e2f:	bb 04 00 00 00       	mov    $0x4,%ebx
+  100e34:	e9 a1 fa ff ff       	jmp    1008da <dwarf_read_abbrev_entry+0x2b>
+                        put_unaligned(data, (uint32_t *)buf);
+  100e39:	83 ec 04             	sub    $0x4,%esp
+  100e3c:	6a 04                	push   $0x4
+  100e3e:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  100e41:	50                   	push   %eax
+  100e42:	ff 75 10             	push   0x10(%ebp)
+  100e45:	e8 ae 83 00 00       	call   1091f8 <memcpy>
+  100e4a:	83 c4 10             	add    $0x10,%esp
+                bytes = sizeof(uint32_t);
+  100e4d:	bb 04 00 00 00       	mov    $0x4,%ebx
+                        put_unaligned(data, (uint32_t *)buf);
+  100e52:	e9 83 fa ff ff       	jmp    1008da <dwarf_read_abbrev_entry+0x2b>
+                uint64_t data = get_unaligned(entry, uint64_t);
+  100e57:	83 ec 04             	sub    $0x4,%esp
+  100e5a:	6a 08                	push   $0x8
+  100e5c:	ff 75 08             	push   0x8(%ebp)
+  100e5f:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  100e62:	50                   	push   %eax
+  100e63:	e8 90 83 00 00       	call   1091f8 <memcpy>
+                entry += sizeof(uint64_t);
+  100e68:	83 45 08 08          	addl   $0x8,0x8(%ebp)
+                if (buf && bufsize >= sizeof(uint64_t)) {
+  100e6c:	83 c4 10             	add    $0x10,%esp
+  100e6f:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  100e73:	74 06                	je     100e7b <dwarf_read_abbrev_entry+0x5cc>
+  100e75:	83 7d 14 07          	cmpl   $0x7,0x14(%ebp)
+  100e79:	77 0a                	ja     100e85 <dwarf_read_abbrev_entry+0x5d6>
+                bytes = sizeof(uint64_t);
+  100e7b:	bb 08 00 00 00       	mov    $0x8,%ebx
+  100e80:	e9 55 fa ff ff       	jmp    1008da <dwarf_read_abbrev_entry+0x2b>
+                        put_unaligned(data, (uint64_t *)buf);
+  100e85:	83 ec 04             	sub    $0x4,%esp
+  100e88:	6a 08                	push   $0x8
+  100e8a:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  100e8d:	50                   	push   %eax
+  100e8e:	ff 75 10             	push   0x10(%ebp)
+  100e91:	e8 62 83 00 00       	call   1091f8 <memcpy>
+  100e96:	83 c4 10             	add    $0x10,%esp
+                bytes = sizeof(uint64_t);
+  100e99:	bb 08 00 00 00       	mov    $0x8,%ebx
+                        put_unaligned(data, (uint64_t *)buf);
+  100e9e:	e9 37 fa ff ff       	jmp    1008da <dwarf_read_abbrev_entry+0x2b>
+                int count = dwarf_read_uleb128(entry, &data);
+  100ea3:	8b 45 08             	mov    0x8(%ebp),%eax
+  100ea6:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+	count = 0;
+  100ea9:	bb 00 00 00 00       	mov    $0x0,%ebx
+	result = 0;
+  100eae:	be 00 00 00 00       	mov    $0x0,%esi
+  100eb3:	89 df                	mov    %ebx,%edi
+		byte = *addr;
+  100eb5:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  100eb8:	0f b6 14 18          	movzbl (%eax,%ebx,1),%edx
+		count++;
+  100ebc:	83 c3 01             	add    $0x1,%ebx
+		result |= (byte & 0x7f) << shift;
+  100ebf:	89 d0                	mov    %edx,%eax
+  100ec1:	83 e0 7f             	and    $0x7f,%eax
+  100ec4:	8d 0c fd 00 00 00 00 	lea    0x0(,%edi,8),%ecx
+  100ecb:	29 f9                	sub    %edi,%ecx
+  100ecd:	d3 e0                	shl    %cl,%eax
+  100ecf:	09 c6                	or     %eax,%esi
+		if (!(byte & 0x80))
+  100ed1:	84 d2                	test   %dl,%dl
+  100ed3:	78 de                	js     100eb3 <dwarf_read_abbrev_entry+0x604>
+                entry += count;
+  100ed5:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  100ed8:	01 d8                	add    %ebx,%eax
+  100eda:	89 45 08             	mov    %eax,0x8(%ebp)
+                if (buf && bufsize >= sizeof(unsigned int)) {
+  100edd:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  100ee1:	0f 84 f3 f9 ff ff    	je     1008da <dwarf_read_abbrev_entry+0x2b>
+  100ee7:	83 7d 14 03          	cmpl   $0x3,0x14(%ebp)
+  100eeb:	0f 86 e9 f9 ff ff    	jbe    1008da <dwarf_read_abbrev_entry+0x2b>
+                        put_unaligned(data, (unsigned int *)buf);
+  100ef1:	89 75 e0             	mov    %esi,-0x20(%ebp)
+  100ef4:	83 ec 04             	sub    $0x4,%esp
+  100ef7:	6a 04                	push   $0x4
+  100ef9:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  100efc:	50                   	push   %eax
+  100efd:	ff 75 10             	push   0x10(%ebp)
+  100f00:	e8 f3 82 00 00       	call   1091f8 <memcpy>
+  100f05:	83 c4 10             	add    $0x10,%esp
+  100f08:	e9 cd f9 ff ff       	jmp    1008da <dwarf_read_abbrev_entry+0x2b>
+                int count = dwarf_read_uleb128(entry, &form);
+  100f0d:	8b 45 08             	mov    0x8(%ebp),%eax
+  100f10:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+	count = 0;
+  100f13:	be 00 00 00 00       	mov    $0x0,%esi
+	result = 0;
+  100f18:	bb 00 00 00 00       	mov    $0x0,%ebx
+  100f1d:	89 f7                	mov    %esi,%edi
+		byte = *addr;
+  100f1f:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  100f22:	0f b6 14 30          	movzbl (%eax,%esi,1),%edx
+		count++;
+  100f26:	83 c6 01             	add    $0x1,%esi
+		result |= (byte & 0x7f) << shift;
+  100f29:	89 d0                	mov    %edx,%eax
+  100f2b:	83 e0 7f             	and    $0x7f,%eax
+  100f2e:	8d 0c fd 00 00 00 00 	lea    0x0(,%edi,8),%ecx
+  100f35:	29 f9                	sub    %edi,%ecx
+  100f37:	d3 e0                	shl    %cl,%eax
+  100f39:	09 c3                	or     %eax,%ebx
+		if (!(byte & 0x80))
+  100f3b:	84 d2                	test   %dl,%dl
+  100f3d:	78 de                	js     100f1d <dwarf_read_abbrev_entry+0x66e>
+                entry += count;
+  100f3f:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  100f42:	01 f0                	add    %esi,%eax
+  100f44:	89 45 08             	mov    %eax,0x8(%ebp)
+                int read = dwarf_read_abbrev_entry(entry, form, buf, bufsize,
+  100f47:	83 ec 0c             	sub    $0xc,%esp
+  100f4a:	ff 75 18             	push   0x18(%ebp)
+  100f4d:	ff 75 14             	push   0x14(%ebp)
+  100f50:	ff 75 10             	push   0x10(%ebp)
+  100f53:	53                   	push   %ebx
+  100f54:	50                   	push   %eax
+  100f55:	e8 55 f9 ff ff       	call   1008af <dwarf_read_abbrev_entry>
+                bytes = count + read;
+  100f5a:	8d 1c 30             	lea    (%eax,%esi,1),%ebx
+        } break;
+  100f5d:	83 c4 20             	add    $0x20,%esp
+  100f60:	e9 75 f9 ff ff       	jmp    1008da <dwarf_read_abbrev_entry+0x2b>
+                int count = dwarf_entry_len(entry, &length);
+  100f65:	8b 75 08             	mov    0x8(%ebp),%esi
+	initial_len = get_unaligned(addr, uint32_t);
+  100f68:	83 ec 04             	sub    $0x4,%esp
+  100f6b:	6a 04                	push   $0x4
+  100f6d:	56                   	push   %esi
+  100f6e:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  100f71:	50                   	push   %eax
+  100f72:	e8 81 82 00 00       	call   1091f8 <memcpy>
+  100f77:	8b 45 e0             	mov    -0x20(%ebp),%eax
+	if (initial_len >= DW_EXT_LO && initial_len <= DW_EXT_HI) {
+  100f7a:	83 c4 10             	add    $0x10,%esp
+	count = 4;
+  100f7d:	bb 04 00 00 00       	mov    $0x4,%ebx
+	if (initial_len >= DW_EXT_LO && initial_len <= DW_EXT_HI) {
+  100f82:	83 f8 ef             	cmp    $0xffffffef,%eax
+  100f85:	76 1f                	jbe    100fa6 <dwarf_read_abbrev_entry+0x6f7>
+		if (initial_len == DW_EXT_DWARF64) {
+  100f87:	83 f8 ff             	cmp    $0xffffffff,%eax
+  100f8a:	74 4d                	je     100fd9 <dwarf_read_abbrev_entry+0x72a>
+			cprintf("Unknown DWARF extension\n");
+  100f8c:	83 ec 0c             	sub    $0xc,%esp
+  100f8f:	68 40 98 10 00       	push   $0x109840
+  100f94:	e8 9b 68 00 00       	call   107834 <cprintf>
+  100f99:	83 c4 10             	add    $0x10,%esp
+                unsigned long length = 0;
+  100f9c:	b8 00 00 00 00       	mov    $0x0,%eax
+			count = 0;
+  100fa1:	bb 00 00 00 00       	mov    $0x0,%ebx
+                entry += count;
+  100fa6:	01 5d 08             	add    %ebx,0x8(%ebp)
+                if (buf && bufsize >= sizeof(unsigned long)) {
+  100fa9:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  100fad:	0f 84 27 f9 ff ff    	je     1008da <dwarf_read_abbrev_entry+0x2b>
+  100fb3:	83 7d 14 03          	cmpl   $0x3,0x14(%ebp)
+  100fb7:	0f 86 1d f9 ff ff    	jbe    1008da <dwarf_read_abbrev_entry+0x2b>
+                        put_unaligned(length, (unsigned long *)buf);
+  100fbd:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  100fc0:	83 ec 04             	sub    $0x4,%esp
+  100fc3:	6a 04                	push   $0x4
+  100fc5:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  100fc8:	50                   	push   %eax
+  100fc9:	ff 75 10             	push   0x10(%ebp)
+  100fcc:	e8 27 82 00 00       	call   1091f8 <memcpy>
+  100fd1:	83 c4 10             	add    $0x10,%esp
+  100fd4:	e9 01 f9 ff ff       	jmp    1008da <dwarf_read_abbrev_entry+0x2b>
+			*len = get_unaligned((uint64_t *)addr + 4, uint64_t);
+  100fd9:	83 ec 04             	sub    $0x4,%esp
+  100fdc:	6a 08                	push   $0x8
+  100fde:	83 c6 20             	add    $0x20,%esi
+  100fe1:	56                   	push   %esi
+  100fe2:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  100fe5:	50                   	push   %eax
+  100fe6:	e8 0d 82 00 00       	call   1091f8 <memcpy>
+  100feb:	8b 45 e0             	mov    -0x20(%ebp),%eax
+			count = 12;
+  100fee:	83 c4 10             	add    $0x10,%esp
+  100ff1:	bb 0c 00 00 00       	mov    $0xc,%ebx
+  100ff6:	eb ae                	jmp    100fa6 <dwarf_read_abbrev_entry+0x6f7>
+                unsigned long count = dwarf_read_uleb128(entry, &length);
+  100ff8:	8b 45 08             	mov    0x8(%ebp),%eax
+  100ffb:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+	count = 0;
+  100ffe:	b8 00 00 00 00       	mov    $0x0,%eax
+	result = 0;
+  101003:	bb 00 00 00 00       	mov    $0x0,%ebx
+  101008:	89 de                	mov    %ebx,%esi
+  10100a:	89 c7                	mov    %eax,%edi
+		byte = *addr;
+  10100c:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+  10100f:	0f b6 1c 01          	movzbl (%ecx,%eax,1),%ebx
+		count++;
+  101013:	83 c0 01             	add    $0x1,%eax
+		result |= (byte & 0x7f) << shift;
+  101016:	89 da                	mov    %ebx,%edx
+  101018:	83 e2 7f             	and    $0x7f,%edx
+  10101b:	8d 0c fd 00 00 00 00 	lea    0x0(,%edi,8),%ecx
+  101022:	29 f9                	sub    %edi,%ecx
+  101024:	d3 e2                	shl    %cl,%edx
+  101026:	09 d6                	or     %edx,%esi
+		if (!(byte & 0x80))
+  101028:	84 db                	test   %bl,%bl
+  10102a:	78 de                	js     10100a <dwarf_read_abbrev_entry+0x75b>
+	return count;
+  10102c:	89 f3                	mov    %esi,%ebx
+  10102e:	89 c6                	mov    %eax,%esi
+                entry += count;
+  101030:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  101033:	01 c7                	add    %eax,%edi
+  101035:	89 7d 08             	mov    %edi,0x8(%ebp)
+                if (buf) {
+  101038:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  10103c:	74 19                	je     101057 <dwarf_read_abbrev_entry+0x7a8>
+                        memcpy(buf, entry, MIN(length, bufsize));
+  10103e:	83 ec 04             	sub    $0x4,%esp
+  101041:	39 5d 14             	cmp    %ebx,0x14(%ebp)
+  101044:	89 da                	mov    %ebx,%edx
+  101046:	0f 46 55 14          	cmovbe 0x14(%ebp),%edx
+  10104a:	52                   	push   %edx
+  10104b:	57                   	push   %edi
+  10104c:	ff 75 10             	push   0x10(%ebp)
+  10104f:	e8 a4 81 00 00       	call   1091f8 <memcpy>
+  101054:	83 c4 10             	add    $0x10,%esp
+                bytes = count + length;
+  101057:	01 f3                	add    %esi,%ebx
+        } break;
+  101059:	e9 7c f8 ff ff       	jmp    1008da <dwarf_read_abbrev_entry+0x2b>
+                bytes = 0;
+  10105e:	bb 00 00 00 00       	mov    $0x0,%ebx
+                if (buf && sizeof(buf) >= sizeof(bool)) {
+  101063:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  101067:	0f 84 6d f8 ff ff    	je     1008da <dwarf_read_abbrev_entry+0x2b>
+                        put_unaligned(true, (bool *)buf);
+  10106d:	8b 45 10             	mov    0x10(%ebp),%eax
+  101070:	c6 00 01             	movb   $0x1,(%eax)
+  101073:	e9 62 f8 ff ff       	jmp    1008da <dwarf_read_abbrev_entry+0x2b>
+                uint64_t data = get_unaligned(entry, uint64_t);
+  101078:	83 ec 04             	sub    $0x4,%esp
+  10107b:	6a 08                	push   $0x8
+  10107d:	ff 75 08             	push   0x8(%ebp)
+  101080:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  101083:	50                   	push   %eax
+  101084:	e8 6f 81 00 00       	call   1091f8 <memcpy>
+                entry += sizeof(uint64_t);
+  101089:	83 45 08 08          	addl   $0x8,0x8(%ebp)
+                if (buf && bufsize >= sizeof(uint64_t)) {
+  10108d:	83 c4 10             	add    $0x10,%esp
+  101090:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  101094:	74 06                	je     10109c <dwarf_read_abbrev_entry+0x7ed>
+  101096:	83 7d 14 07          	cmpl   $0x7,0x14(%ebp)
+  10109a:	77 0a                	ja     1010a6 <dwarf_read_abbrev_entry+0x7f7>
+                bytes = sizeof(uint64_t);
+  10109c:	bb 08 00 00 00       	mov    $0x8,%ebx
+  1010a1:	e9 34 f8 ff ff       	jmp    1008da <dwarf_read_abbrev_entry+0x2b>
+                        put_unaligned(data, (uint64_t *)buf);
+  1010a6:	83 ec 04             	sub    $0x4,%esp
+  1010a9:	6a 08                	push   $0x8
+  1010ab:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  1010ae:	50                   	push   %eax
+  1010af:	ff 75 10             	push   0x10(%ebp)
+  1010b2:	e8 41 81 00 00       	call   1091f8 <memcpy>
+  1010b7:	83 c4 10             	add    $0x10,%esp
+                bytes = sizeof(uint64_t);
+  1010ba:	bb 08 00 00 00       	mov    $0x8,%ebx
+                        put_unaligned(data, (uint64_t *)buf);
+  1010bf:	e9 16 f8 ff ff       	jmp    1008da <dwarf_read_abbrev_entry+0x2b>
+                bytes = 16;
+  1010c4:	bb 10 00 00 00       	mov    $0x10,%ebx
+                if (buf) {
+  1010c9:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  1010cd:	0f 84 07 f8 ff ff    	je     1008da <dwarf_read_abbrev_entry+0x2b>
+                        memcpy(buf, entry, MIN(16, bufsize));
+  1010d3:	83 ec 04             	sub    $0x4,%esp
+  1010d6:	b8 10 00 00 00       	mov    $0x10,%eax
+  1010db:	39 45 14             	cmp    %eax,0x14(%ebp)
+  1010de:	0f 4e 45 14          	cmovle 0x14(%ebp),%eax
+  1010e2:	50                   	push   %eax
+  1010e3:	ff 75 08             	push   0x8(%ebp)
+  1010e6:	ff 75 10             	push   0x10(%ebp)
+  1010e9:	e8 0a 81 00 00       	call   1091f8 <memcpy>
+  1010ee:	83 c4 10             	add    $0x10,%esp
+  1010f1:	e9 e4 f7 ff ff       	jmp    1008da <dwarf_read_abbrev_entry+0x2b>
+                bytes = (form - DW_FORM_strx1) % 4 + 1;
+  1010f6:	83 e8 25             	sub    $0x25,%eax
+  1010f9:	83 e0 03             	and    $0x3,%eax
+  1010fc:	83 c0 01             	add    $0x1,%eax
+  1010ff:	89 c3                	mov    %eax,%ebx
+                uint32_t data = 0;
+  101101:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%ebp)
+                memcpy(&data, entry, bytes);
+  101108:	83 ec 04             	sub    $0x4,%esp
+  10110b:	50                   	push   %eax
+  10110c:	ff 75 08             	push   0x8(%ebp)
+  10110f:	8d 45 dc             	lea    -0x24(%ebp),%eax
+  101112:	50                   	push   %eax
+  101113:	e8 e0 80 00 00       	call   1091f8 <memcpy>
+                if (buf && bufsize >= sizeof(uint32_t)) {
+  101118:	83 c4 10             	add    $0x10,%esp
+  10111b:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  10111f:	0f 84 b5 f7 ff ff    	je     1008da <dwarf_read_abbrev_entry+0x2b>
+  101125:	83 7d 14 03          	cmpl   $0x3,0x14(%ebp)
+  101129:	0f 86 ab f7 ff ff    	jbe    1008da <dwarf_read_abbrev_entry+0x2b>
+                        put_unaligned(data, (uint32_t *)buf);
+  10112f:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  101132:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  101135:	83 ec 04             	sub    $0x4,%esp
+  101138:	6a 04                	push   $0x4
+  10113a:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  10113d:	50                   	push   %eax
+  10113e:	ff 75 10             	push   0x10(%ebp)
+  101141:	e8 b2 80 00 00       	call   1091f8 <memcpy>
+  101146:	83 c4 10             	add    $0x10,%esp
+        } break;
+  101149:	e9 8c f7 ff ff       	jmp    1008da <dwarf_read_abbrev_entry+0x2b>
+        switch (form) {
+  10114e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  101153:	e9 82 f7 ff ff       	jmp    1008da <dwarf_read_abbrev_entry+0x2b>
+                bytes = sizeof(Dwarf_Small);
+  101158:	bb 01 00 00 00       	mov    $0x1,%ebx
+  10115d:	e9 78 f7 ff ff       	jmp    1008da <dwarf_read_abbrev_entry+0x2b>
+                bytes = sizeof(Dwarf_Small);
+  101162:	bb 01 00 00 00       	mov    $0x1,%ebx
+  101167:	e9 6e f7 ff ff       	jmp    1008da <dwarf_read_abbrev_entry+0x2b>
+                bytes = sizeof(Dwarf_Small);
+  10116c:	bb 01 00 00 00       	mov    $0x1,%ebx
+  101171:	e9 64 f7 ff ff       	jmp    1008da <dwarf_read_abbrev_entry+0x2b>
+
+00101176 <dwarf_read_string>:
+                              const void *entry) {
+  101176:	55                   	push   %ebp
+  101177:	89 e5                	mov    %esp,%ebp
+  101179:	53                   	push   %ebx
+  10117a:	83 ec 14             	sub    $0x14,%esp
+  10117d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  101180:	8b 55 10             	mov    0x10(%ebp),%edx
+        switch (form) {
+  101183:	8d 42 f8             	lea    -0x8(%edx),%eax
+  101186:	83 f8 20             	cmp    $0x20,%eax
+  101189:	0f 87 c6 00 00 00    	ja     101255 <dwarf_read_string+0xdf>
+  10118f:	ff 24 85 40 99 10 00 	jmp    *0x109940(,%eax,4)
+                return entry;
+  101196:	8b 45 14             	mov    0x14(%ebp),%eax
+  101199:	e9 bc 00 00 00       	jmp    10125a <dwarf_read_string+0xe4>
+                offset = get_unaligned(entry, uint32_t);
+  10119e:	83 ec 04             	sub    $0x4,%esp
+  1011a1:	6a 04                	push   $0x4
+  1011a3:	ff 75 14             	push   0x14(%ebp)
+  1011a6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  1011a9:	50                   	push   %eax
+  1011aa:	e8 49 80 00 00       	call   1091f8 <memcpy>
+  1011af:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+                break;
+  1011b2:	83 c4 10             	add    $0x10,%esp
+        if (offset >= addrs->str_end - addrs->str_begin) {
+  1011b5:	8b 43 20             	mov    0x20(%ebx),%eax
+  1011b8:	8b 53 24             	mov    0x24(%ebx),%edx
+  1011bb:	29 c2                	sub    %eax,%edx
+        return (const char *)addrs->str_begin + offset;
+  1011bd:	01 c8                	add    %ecx,%eax
+  1011bf:	39 d1                	cmp    %edx,%ecx
+  1011c1:	ba 00 00 00 00       	mov    $0x0,%edx
+  1011c6:	0f 43 c2             	cmovae %edx,%eax
+  1011c9:	e9 8c 00 00 00       	jmp    10125a <dwarf_read_string+0xe4>
+                offset = get_unaligned(entry, uint32_t);
+  1011ce:	83 ec 04             	sub    $0x4,%esp
+  1011d1:	6a 04                	push   $0x4
+  1011d3:	ff 75 14             	push   0x14(%ebp)
+  1011d6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  1011d9:	50                   	push   %eax
+  1011da:	e8 19 80 00 00       	call   1091f8 <memcpy>
+  1011df:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+                if (offset >= addrs->line_str_end - addrs->line_str_begin) {
+  1011e2:	8b 43 38             	mov    0x38(%ebx),%eax
+  1011e5:	8b 53 3c             	mov    0x3c(%ebx),%edx
+  1011e8:	29 c2                	sub    %eax,%edx
+  1011ea:	83 c4 10             	add    $0x10,%esp
+                return (const char *)addrs->line_str_begin + offset;
+  1011ed:	01 c8                	add    %ecx,%eax
+  1011ef:	39 d1                	cmp    %edx,%ecx
+  1011f1:	ba 00 00 00 00       	mov    $0x0,%edx
+  1011f6:	0f 43 c2             	cmovae %edx,%eax
+  1011f9:	eb 5f                	jmp    10125a <dwarf_read_string+0xe4>
+                uint32_t index = 0;
+  1011fb:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+                dwarf_read_abbrev_entry(entry, form, &index, sizeof(index),
+  101202:	83 ec 0c             	sub    $0xc,%esp
+  101205:	8b 45 0c             	mov    0xc(%ebp),%eax
+  101208:	ff 70 18             	push   0x18(%eax)
+  10120b:	6a 04                	push   $0x4
+  10120d:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  101210:	50                   	push   %eax
+  101211:	52                   	push   %edx
+  101212:	ff 75 14             	push   0x14(%ebp)
+  101215:	e8 95 f6 ff ff       	call   1008af <dwarf_read_abbrev_entry>
+                                         cu->cu_str_offsets_base +
+  10121a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  10121d:	8b 40 1c             	mov    0x1c(%eax),%eax
+  101220:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  101223:	8d 04 90             	lea    (%eax,%edx,4),%eax
+                const unsigned char *p = addrs->str_offsets_begin +
+  101226:	03 43 40             	add    0x40(%ebx),%eax
+                if (p + sizeof(uint32_t) > addrs->str_offsets_end) {
+  101229:	8d 50 04             	lea    0x4(%eax),%edx
+  10122c:	83 c4 20             	add    $0x20,%esp
+  10122f:	39 53 44             	cmp    %edx,0x44(%ebx)
+  101232:	72 1a                	jb     10124e <dwarf_read_string+0xd8>
+                offset = get_unaligned(p, uint32_t);
+  101234:	83 ec 04             	sub    $0x4,%esp
+  101237:	6a 04                	push   $0x4
+  101239:	50                   	push   %eax
+  10123a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  10123d:	50                   	push   %eax
+  10123e:	e8 b5 7f 00 00       	call   1091f8 <memcpy>
+  101243:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+        } break;
+  101246:	83 c4 10             	add    $0x10,%esp
+  101249:	e9 67 ff ff ff       	jmp    1011b5 <dwarf_read_string+0x3f>
+                        return NULL;
+  10124e:	b8 00 00 00 00       	mov    $0x0,%eax
+  101253:	eb 05                	jmp    10125a <dwarf_read_string+0xe4>
+        switch (form) {
+  101255:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  10125a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  10125d:	c9                   	leave
+  10125e:	c3                   	ret
+
+0010125f <dwarf_read_address>:
+                             const void *entry) {
+  10125f:	55                   	push   %ebp
+  101260:	89 e5                	mov    %esp,%ebp
+  101262:	57                   	push   %edi
+  101263:	56                   	push   %esi
+  101264:	53                   	push   %ebx
+  101265:	83 ec 28             	sub    $0x28,%esp
+  101268:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  10126b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  10126e:	8b 7d 10             	mov    0x10(%ebp),%edi
+        uint32_t value = 0;
+  101271:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+        dwarf_read_abbrev_entry(entry, form, &value, sizeof(value),
+  101278:	ff 76 18             	push   0x18(%esi)
+  10127b:	6a 04                	push   $0x4
+  10127d:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  101280:	50                   	push   %eax
+  101281:	57                   	push   %edi
+  101282:	ff 75 14             	push   0x14(%ebp)
+  101285:	e8 25 f6 ff ff       	call   1008af <dwarf_read_abbrev_entry>
+        if (form == DW_FORM_addr) {
+  10128a:	83 c4 20             	add    $0x20,%esp
+                return value;
+  10128d:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+        if (form == DW_FORM_addr) {
+  101290:	83 ff 01             	cmp    $0x1,%edi
+  101293:	74 1a                	je     1012af <dwarf_read_address+0x50>
+            addrs->addr_begin + cu->cu_addr_base + value * cu->cu_address_size;
+  101295:	8b 46 18             	mov    0x18(%esi),%eax
+  101298:	0f af 45 e4          	imul   -0x1c(%ebp),%eax
+  10129c:	03 46 20             	add    0x20(%esi),%eax
+        const unsigned char *p =
+  10129f:	03 43 48             	add    0x48(%ebx),%eax
+        if (p + sizeof(uint32_t) > addrs->addr_end) {
+  1012a2:	8d 48 04             	lea    0x4(%eax),%ecx
+                return 0;
+  1012a5:	ba 00 00 00 00       	mov    $0x0,%edx
+        if (p + sizeof(uint32_t) > addrs->addr_end) {
+  1012aa:	39 4b 4c             	cmp    %ecx,0x4c(%ebx)
+  1012ad:	73 0a                	jae    1012b9 <dwarf_read_address+0x5a>
+}
+  1012af:	89 d0                	mov    %edx,%eax
+  1012b1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  1012b4:	5b                   	pop    %ebx
+  1012b5:	5e                   	pop    %esi
+  1012b6:	5f                   	pop    %edi
+  1012b7:	5d                   	pop    %ebp
+  1012b8:	c3                   	ret
+        return get_unaligned(p, uint32_t);
+  1012b9:	83 ec 04             	sub    $0x4,%esp
+  1012bc:	6a 04                	push   $0x4
+  1012be:	50                   	push   %eax
+  1012bf:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  1012c2:	50                   	push   %eax
+  1012c3:	e8 30 7f 00 00       	call   1091f8 <memcpy>
+  1012c8:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  1012cb:	83 c4 10             	add    $0x10,%esp
+  1012ce:	eb df                	jmp    1012af <dwarf_read_address+0x50>
+
+001012d0 <dwarf_read_cu_header>:
+                         struct Dwarf_CU *cu) {
+  1012d0:	55                   	push   %ebp
+  1012d1:	89 e5                	mov    %esp,%ebp
+  1012d3:	57                   	push   %edi
+  1012d4:	56                   	push   %esi
+  1012d5:	53                   	push   %ebx
+  1012d6:	83 ec 30             	sub    $0x30,%esp
+  1012d9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+        cu->cu_hdr = hdr;
+  1012dc:	8b 45 10             	mov    0x10(%ebp),%eax
+  1012df:	89 18                	mov    %ebx,(%eax)
+	initial_len = get_unaligned(addr, uint32_t);
+  1012e1:	6a 04                	push   $0x4
+  1012e3:	53                   	push   %ebx
+  1012e4:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  1012e7:	50                   	push   %eax
+  1012e8:	e8 0b 7f 00 00       	call   1091f8 <memcpy>
+  1012ed:	8b 45 e0             	mov    -0x20(%ebp),%eax
+	if (initial_len >= DW_EXT_LO && initial_len <= DW_EXT_HI) {
+  1012f0:	83 c4 10             	add    $0x10,%esp
+  1012f3:	83 f8 ef             	cmp    $0xffffffef,%eax
+  1012f6:	0f 86 66 02 00 00    	jbe    101562 <dwarf_read_cu_header+0x292>
+		if (initial_len == DW_EXT_DWARF64) {
+  1012fc:	83 f8 ff             	cmp    $0xffffffff,%eax
+  1012ff:	74 1d                	je     10131e <dwarf_read_cu_header+0x4e>
+			cprintf("Unknown DWARF extension\n");
+  101301:	83 ec 0c             	sub    $0xc,%esp
+  101304:	68 40 98 10 00       	push   $0x109840
+  101309:	e8 26 65 00 00       	call   107834 <cprintf>
+  10130e:	83 c4 10             	add    $0x10,%esp
+                return -E_BAD_DWARF;
+  101311:	b8 fa ff ff ff       	mov    $0xfffffffa,%eax
+}
+  101316:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  101319:	5b                   	pop    %ebx
+  10131a:	5e                   	pop    %esi
+  10131b:	5f                   	pop    %edi
+  10131c:	5d                   	pop    %ebp
+  10131d:	c3                   	ret
+			*len = get_unaligned((uint64_t *)addr + 4, uint64_t);
+  10131e:	83 ec 04             	sub    $0x4,%esp
+  101321:	6a 08                	push   $0x8
+  101323:	8d 43 20             	lea    0x20(%ebx),%eax
+  101326:	50                   	push   %eax
+  101327:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  10132a:	50                   	push   %eax
+  10132b:	e8 c8 7e 00 00       	call   1091f8 <memcpy>
+  101330:	8b 45 e0             	mov    -0x20(%ebp),%eax
+			count = 12;
+  101333:	83 c4 10             	add    $0x10,%esp
+  101336:	ba 0c 00 00 00       	mov    $0xc,%edx
+  10133b:	e9 27 02 00 00       	jmp    101567 <dwarf_read_cu_header+0x297>
+                cu->cu_abbrev_offset = get_unaligned(entry, uint32_t);
+  101340:	83 ec 04             	sub    $0x4,%esp
+  101343:	6a 04                	push   $0x4
+  101345:	56                   	push   %esi
+  101346:	8d 5d e0             	lea    -0x20(%ebp),%ebx
+  101349:	53                   	push   %ebx
+  10134a:	e8 a9 7e 00 00       	call   1091f8 <memcpy>
+  10134f:	8b 45 10             	mov    0x10(%ebp),%eax
+  101352:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  101355:	89 48 0c             	mov    %ecx,0xc(%eax)
+  101358:	c7 40 10 00 00 00 00 	movl   $0x0,0x10(%eax)
+                entry += count;
+  10135f:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  101362:	01 c6                	add    %eax,%esi
+                cu->cu_address_size = get_unaligned(entry++, Dwarf_Small);
+  101364:	8d 46 01             	lea    0x1(%esi),%eax
+  101367:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  10136a:	83 c4 0c             	add    $0xc,%esp
+  10136d:	6a 01                	push   $0x1
+  10136f:	56                   	push   %esi
+  101370:	53                   	push   %ebx
+  101371:	e8 82 7e 00 00       	call   1091f8 <memcpy>
+  101376:	0f b6 45 e0          	movzbl -0x20(%ebp),%eax
+  10137a:	8b 75 10             	mov    0x10(%ebp),%esi
+  10137d:	89 46 18             	mov    %eax,0x18(%esi)
+  101380:	83 c4 10             	add    $0x10,%esp
+        if (cu->cu_address_size != sizeof(uint32_t)) {
+  101383:	8b 45 10             	mov    0x10(%ebp),%eax
+  101386:	83 78 18 04          	cmpl   $0x4,0x18(%eax)
+  10138a:	0f 85 a0 01 00 00    	jne    101530 <dwarf_read_cu_header+0x260>
+        cu->cu_dies = entry;
+  101390:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+  101393:	89 50 04             	mov    %edx,0x4(%eax)
+	count = 0;
+  101396:	bb 00 00 00 00       	mov    $0x0,%ebx
+	result = 0;
+  10139b:	be 00 00 00 00       	mov    $0x0,%esi
+  1013a0:	89 df                	mov    %ebx,%edi
+		byte = *addr;
+  1013a2:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  1013a5:	0f b6 14 18          	movzbl (%eax,%ebx,1),%edx
+		count++;
+  1013a9:	83 c3 01             	add    $0x1,%ebx
+		result |= (byte & 0x7f) << shift;
+  1013ac:	89 d0                	mov    %edx,%eax
+  1013ae:	83 e0 7f             	and    $0x7f,%eax
+  1013b1:	8d 0c fd 00 00 00 00 	lea    0x0(,%edi,8),%ecx
+  1013b8:	29 f9                	sub    %edi,%ecx
+  1013ba:	d3 e0                	shl    %cl,%eax
+  1013bc:	09 c6                	or     %eax,%esi
+		if (!(byte & 0x80))
+  1013be:	84 d2                	test   %dl,%dl
+  1013c0:	78 de                	js     1013a0 <dwarf_read_cu_header+0xd0>
+                return 0;
+  1013c2:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (abbrev_code == 0) {
+  1013c7:	85 f6                	test   %esi,%esi
+  1013c9:	0f 84 47 ff ff ff    	je     101316 <dwarf_read_cu_header+0x46>
+            dwarf_abbrevs(addrs, cu->cu_abbrev_offset);
+  1013cf:	83 ec 04             	sub    $0x4,%esp
+  1013d2:	8b 45 10             	mov    0x10(%ebp),%eax
+  1013d5:	ff 70 10             	push   0x10(%eax)
+  1013d8:	ff 70 0c             	push   0xc(%eax)
+  1013db:	ff 75 08             	push   0x8(%ebp)
+  1013de:	e8 ba 43 00 00       	call   10579d <dwarf_abbrevs>
+            abbrevs ? dwarf_abbrev(abbrevs, abbrev_code) : NULL;
+  1013e3:	83 c4 10             	add    $0x10,%esp
+  1013e6:	85 c0                	test   %eax,%eax
+  1013e8:	0f 84 4c 01 00 00    	je     10153a <dwarf_read_cu_header+0x26a>
+	if (code >= at->at_ncodes || !at->at_abbrevs[code].ab_attrs)
+  1013ee:	3b 70 08             	cmp    0x8(%eax),%esi
+  1013f1:	0f 83 4d 01 00 00    	jae    101544 <dwarf_read_cu_header+0x274>
+  1013f7:	8d 14 b6             	lea    (%esi,%esi,4),%edx
+  1013fa:	c1 e2 02             	shl    $0x2,%edx
+  1013fd:	03 50 0c             	add    0xc(%eax),%edx
+  101400:	8b 72 04             	mov    0x4(%edx),%esi
+  101403:	85 f6                	test   %esi,%esi
+  101405:	0f 84 43 01 00 00    	je     10154e <dwarf_read_cu_header+0x27e>
+        entry += dwarf_read_uleb128(entry, &abbrev_code);
+  10140b:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  10140e:	01 d8                	add    %ebx,%eax
+  101410:	89 c3                	mov    %eax,%ebx
+        unsigned low_pc_form = 0;
+  101412:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%ebp)
+        const void *low_pc_entry = NULL;
+  101419:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+                                                &cu->cu_rnglists_base,
+  101420:	8b 45 10             	mov    0x10(%ebp),%eax
+  101423:	83 c0 24             	add    $0x24,%eax
+  101426:	89 45 c8             	mov    %eax,-0x38(%ebp)
+                                                &cu->cu_addr_base,
+  101429:	8b 45 10             	mov    0x10(%ebp),%eax
+  10142c:	8d 78 20             	lea    0x20(%eax),%edi
+  10142f:	89 7d cc             	mov    %edi,-0x34(%ebp)
+  101432:	89 c7                	mov    %eax,%edi
+  101434:	eb 52                	jmp    101488 <dwarf_read_cu_header+0x1b8>
+                        entry += sizeof(uint64_t);
+  101436:	83 45 d4 08          	addl   $0x8,-0x2c(%ebp)
+                        break;
+  10143a:	e9 44 ff ff ff       	jmp    101383 <dwarf_read_cu_header+0xb3>
+                        entry += sizeof(uint64_t) + count;
+  10143f:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  101442:	8b 55 d0             	mov    -0x30(%ebp),%edx
+  101445:	8d 44 10 08          	lea    0x8(%eax,%edx,1),%eax
+  101449:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+                        break;
+  10144c:	e9 32 ff ff ff       	jmp    101383 <dwarf_read_cu_header+0xb3>
+                        dwarf_read_abbrev_entry(
+  101451:	83 ec 0c             	sub    $0xc,%esp
+  101454:	ff 77 18             	push   0x18(%edi)
+  101457:	6a 04                	push   $0x4
+                            entry, attr->as_form, &cu->cu_str_offsets_base,
+  101459:	8d 47 1c             	lea    0x1c(%edi),%eax
+                        dwarf_read_abbrev_entry(
+  10145c:	50                   	push   %eax
+  10145d:	0f b7 46 02          	movzwl 0x2(%esi),%eax
+  101461:	50                   	push   %eax
+  101462:	53                   	push   %ebx
+  101463:	e8 47 f4 ff ff       	call   1008af <dwarf_read_abbrev_entry>
+  101468:	83 c4 20             	add    $0x20,%esp
+                entry += dwarf_read_abbrev_entry(entry, attr->as_form, NULL, 0,
+  10146b:	83 ec 0c             	sub    $0xc,%esp
+  10146e:	ff 77 18             	push   0x18(%edi)
+  101471:	6a 00                	push   $0x0
+  101473:	6a 00                	push   $0x0
+  101475:	0f b7 46 02          	movzwl 0x2(%esi),%eax
+  101479:	50                   	push   %eax
+  10147a:	53                   	push   %ebx
+  10147b:	e8 2f f4 ff ff       	call   1008af <dwarf_read_abbrev_entry>
+  101480:	01 c3                	add    %eax,%ebx
+        for (attr = abbrev->ab_attrs; attr->as_name || attr->as_form; attr++) {
+  101482:	83 c6 08             	add    $0x8,%esi
+  101485:	83 c4 20             	add    $0x20,%esp
+  101488:	83 3e 00             	cmpl   $0x0,(%esi)
+  10148b:	74 5d                	je     1014ea <dwarf_read_cu_header+0x21a>
+                if (attr->as_name == DW_AT_str_offsets_base) {
+  10148d:	0f b7 06             	movzwl (%esi),%eax
+  101490:	66 83 f8 72          	cmp    $0x72,%ax
+  101494:	74 bb                	je     101451 <dwarf_read_cu_header+0x181>
+                } else if (attr->as_name == DW_AT_addr_base) {
+  101496:	66 83 f8 73          	cmp    $0x73,%ax
+  10149a:	74 18                	je     1014b4 <dwarf_read_cu_header+0x1e4>
+                } else if (attr->as_name == DW_AT_rnglists_base) {
+  10149c:	66 83 f8 74          	cmp    $0x74,%ax
+  1014a0:	74 2d                	je     1014cf <dwarf_read_cu_header+0x1ff>
+                } else if (attr->as_name == DW_AT_low_pc) {
+  1014a2:	66 83 f8 11          	cmp    $0x11,%ax
+  1014a6:	75 c3                	jne    10146b <dwarf_read_cu_header+0x19b>
+                        low_pc_form = attr->as_form;
+  1014a8:	0f b7 46 02          	movzwl 0x2(%esi),%eax
+  1014ac:	89 45 d0             	mov    %eax,-0x30(%ebp)
+                        low_pc_entry = entry;
+  1014af:	89 5d d4             	mov    %ebx,-0x2c(%ebp)
+  1014b2:	eb b7                	jmp    10146b <dwarf_read_cu_header+0x19b>
+                        dwarf_read_abbrev_entry(entry, attr->as_form,
+  1014b4:	83 ec 0c             	sub    $0xc,%esp
+  1014b7:	ff 77 18             	push   0x18(%edi)
+  1014ba:	6a 04                	push   $0x4
+  1014bc:	ff 75 cc             	push   -0x34(%ebp)
+  1014bf:	0f b7 46 02          	movzwl 0x2(%esi),%eax
+  1014c3:	50                   	push   %eax
+  1014c4:	53                   	push   %ebx
+  1014c5:	e8 e5 f3 ff ff       	call   1008af <dwarf_read_abbrev_entry>
+  1014ca:	83 c4 20             	add    $0x20,%esp
+  1014cd:	eb 9c                	jmp    10146b <dwarf_read_cu_header+0x19b>
+                        dwarf_read_abbrev_entry(entry, attr->as_form,
+  1014cf:	83 ec 0c             	sub    $0xc,%esp
+  1014d2:	ff 77 18             	push   0x18(%edi)
+  1014d5:	6a 04                	push   $0x4
+  1014d7:	ff 75 c8             	push   -0x38(%ebp)
+  1014da:	0f b7 46 02          	movzwl 0x2(%esi),%eax
+  1014de:	50                   	push   %eax
+  1014df:	53                   	push   %ebx
+  1014e0:	e8 ca f3 ff ff       	call   1008af <dwarf_read_abbrev_entry>
+  1014e5:	83 c4 20             	add    $0x20,%esp
+  1014e8:	eb 81                	jmp    10146b <dwarf_read_cu_header+0x19b>
+        return 0;
+  1014ea:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (low_pc_entry) {
+  1014ef:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  1014f2:	85 ff                	test   %edi,%edi
+  1014f4:	0f 84 1c fe ff ff    	je     101316 <dwarf_read_cu_header+0x46>
+                cu->cu_base = dwarf_read_address(addrs, cu, low_pc_form,
+  1014fa:	57                   	push   %edi
+  1014fb:	ff 75 d0             	push   -0x30(%ebp)
+  1014fe:	ff 75 10             	push   0x10(%ebp)
+  101501:	ff 75 08             	push   0x8(%ebp)
+  101504:	e8 56 fd ff ff       	call   10125f <dwarf_read_address>
+  101509:	8b 75 10             	mov    0x10(%ebp),%esi
+  10150c:	89 46 28             	mov    %eax,0x28(%esi)
+  10150f:	83 c4 10             	add    $0x10,%esp
+        return 0;
+  101512:	b8 00 00 00 00       	mov    $0x0,%eax
+  101517:	e9 fa fd ff ff       	jmp    101316 <dwarf_read_cu_header+0x46>
+                return -E_BAD_DWARF;
+  10151c:	b8 fa ff ff ff       	mov    $0xfffffffa,%eax
+  101521:	e9 f0 fd ff ff       	jmp    101316 <dwarf_read_cu_header+0x46>
+                switch (unit_type) {
+  101526:	b8 fa ff ff ff       	mov    $0xfffffffa,%eax
+  10152b:	e9 e6 fd ff ff       	jmp    101316 <dwarf_read_cu_header+0x46>
+                return -E_BAD_DWARF;
+  101530:	b8 fa ff ff ff       	mov    $0xfffffffa,%eax
+  101535:	e9 dc fd ff ff       	jmp    101316 <dwarf_read_cu_header+0x46>
+                return -E_BAD_DWARF;
+  10153a:	b8 fa ff ff ff       	mov    $0xfffffffa,%eax
+  10153f:	e9 d2 fd ff ff       	jmp    101316 <dwarf_read_cu_header+0x46>
+  101544:	b8 fa ff ff ff       	mov    $0xfffffffa,%eax
+  101549:	e9 c8 fd ff ff       	jmp    101316 <dwarf_read_cu_header+0x46>
+  10154e:	b8 fa ff ff ff       	mov    $0xfffffffa,%eax
+  101553:	e9 be fd ff ff       	jmp    101316 <dwarf_read_cu_header+0x46>
+                return -E_BAD_DWARF;
+  101558:	b8 fa ff ff ff       	mov    $0xfffffffa,%eax
+  10155d:	e9 b4 fd ff ff       	jmp    101316 <dwarf_read_cu_header+0x46>
+	count = 4;
+  101562:	ba 04 00 00 00       	mov    $0x4,%edx
+        entry += count;
+  101567:	89 55 d0             	mov    %edx,-0x30(%ebp)
+  10156a:	01 d3                	add    %edx,%ebx
+        cu->cu_end = entry + len;
+  10156c:	01 d8                	add    %ebx,%eax
+  10156e:	8b 55 10             	mov    0x10(%ebp),%edx
+  101571:	89 42 08             	mov    %eax,0x8(%edx)
+        if ((const unsigned char *)cu->cu_end > addrs->info_end) {
+  101574:	8b 7d 08             	mov    0x8(%ebp),%edi
+  101577:	39 47 14             	cmp    %eax,0x14(%edi)
+  10157a:	72 dc                	jb     101558 <dwarf_read_cu_header+0x288>
+        cu->cu_version = get_unaligned(entry, Dwarf_Half);
+  10157c:	83 ec 04             	sub    $0x4,%esp
+  10157f:	6a 02                	push   $0x2
+  101581:	53                   	push   %ebx
+  101582:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  101585:	50                   	push   %eax
+  101586:	e8 6d 7c 00 00       	call   1091f8 <memcpy>
+  10158b:	0f b7 45 e0          	movzwl -0x20(%ebp),%eax
+  10158f:	0f b7 d0             	movzwl %ax,%edx
+  101592:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  101595:	89 51 14             	mov    %edx,0x14(%ecx)
+        entry += sizeof(Dwarf_Half);
+  101598:	8d 73 02             	lea    0x2(%ebx),%esi
+        cu->cu_str_offsets_base = 0;
+  10159b:	c7 41 1c 00 00 00 00 	movl   $0x0,0x1c(%ecx)
+        cu->cu_addr_base = 0;
+  1015a2:	c7 41 20 00 00 00 00 	movl   $0x0,0x20(%ecx)
+        cu->cu_rnglists_base = 0;
+  1015a9:	c7 41 24 00 00 00 00 	movl   $0x0,0x24(%ecx)
+        cu->cu_base = 0;
+  1015b0:	c7 41 28 00 00 00 00 	movl   $0x0,0x28(%ecx)
+        if (cu->cu_version == 2 || cu->cu_version == 4) {
+  1015b7:	83 e8 02             	sub    $0x2,%eax
+  1015ba:	83 c4 10             	add    $0x10,%esp
+  1015bd:	66 a9 fd ff          	test   $0xfffd,%ax
+  1015c1:	0f 84 79 fd ff ff    	je     101340 <dwarf_read_cu_header+0x70>
+        } else if (cu->cu_version == 5) {
+  1015c7:	83 fa 05             	cmp    $0x5,%edx
+  1015ca:	0f 85 4c ff ff ff    	jne    10151c <dwarf_read_cu_header+0x24c>
+                Dwarf_Small unit_type = get_unaligned(entry++, Dwarf_Small);
+  1015d0:	83 ec 04             	sub    $0x4,%esp
+  1015d3:	6a 01                	push   $0x1
+  1015d5:	56                   	push   %esi
+  1015d6:	8d 75 e0             	lea    -0x20(%ebp),%esi
+  1015d9:	56                   	push   %esi
+  1015da:	e8 19 7c 00 00       	call   1091f8 <memcpy>
+  1015df:	0f b6 45 e0          	movzbl -0x20(%ebp),%eax
+  1015e3:	88 45 cc             	mov    %al,-0x34(%ebp)
+                cu->cu_address_size = get_unaligned(entry++, Dwarf_Small);
+  1015e6:	8d 7b 04             	lea    0x4(%ebx),%edi
+  1015e9:	83 c4 0c             	add    $0xc,%esp
+  1015ec:	6a 01                	push   $0x1
+                Dwarf_Small unit_type = get_unaligned(entry++, Dwarf_Small);
+  1015ee:	83 c3 03             	add    $0x3,%ebx
+                cu->cu_address_size = get_unaligned(entry++, Dwarf_Small);
+  1015f1:	53                   	push   %ebx
+  1015f2:	56                   	push   %esi
+  1015f3:	e8 00 7c 00 00       	call   1091f8 <memcpy>
+  1015f8:	0f b6 45 e0          	movzbl -0x20(%ebp),%eax
+  1015fc:	8b 55 10             	mov    0x10(%ebp),%edx
+  1015ff:	89 42 18             	mov    %eax,0x18(%edx)
+                cu->cu_abbrev_offset = get_unaligned(entry, uint32_t);
+  101602:	83 c4 0c             	add    $0xc,%esp
+  101605:	6a 04                	push   $0x4
+  101607:	57                   	push   %edi
+  101608:	56                   	push   %esi
+  101609:	e8 ea 7b 00 00       	call   1091f8 <memcpy>
+  10160e:	8b 75 10             	mov    0x10(%ebp),%esi
+  101611:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  101614:	89 56 0c             	mov    %edx,0xc(%esi)
+  101617:	c7 46 10 00 00 00 00 	movl   $0x0,0x10(%esi)
+                entry += count;
+  10161e:	8b 75 d0             	mov    -0x30(%ebp),%esi
+  101621:	01 fe                	add    %edi,%esi
+  101623:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+                switch (unit_type) {
+  101626:	83 c4 10             	add    $0x10,%esp
+  101629:	0f b6 45 cc          	movzbl -0x34(%ebp),%eax
+  10162d:	3c 06                	cmp    $0x6,%al
+  10162f:	0f 87 f1 fe ff ff    	ja     101526 <dwarf_read_cu_header+0x256>
+  101635:	0f b6 c0             	movzbl %al,%eax
+  101638:	ff 24 85 c4 99 10 00 	jmp    *0x1099c4(,%eax,4)
+
+0010163f <dwarf_read_high_pc>:
+                             const void *entry, uintptr_t low_pc) {
+  10163f:	55                   	push   %ebp
+  101640:	89 e5                	mov    %esp,%ebp
+  101642:	83 ec 18             	sub    $0x18,%esp
+  101645:	8b 55 10             	mov    0x10(%ebp),%edx
+        uint32_t value = 0;
+  101648:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+        switch (as->as_form) {
+  10164f:	0f b7 42 02          	movzwl 0x2(%edx),%eax
+  101653:	66 83 f8 21          	cmp    $0x21,%ax
+  101657:	74 54                	je     1016ad <dwarf_read_high_pc+0x6e>
+  101659:	77 23                	ja     10167e <dwarf_read_high_pc+0x3f>
+  10165b:	66 83 f8 01          	cmp    $0x1,%ax
+  10165f:	74 06                	je     101667 <dwarf_read_high_pc+0x28>
+  101661:	66 83 f8 1b          	cmp    $0x1b,%ax
+  101665:	75 20                	jne    101687 <dwarf_read_high_pc+0x48>
+                return dwarf_read_address(addrs, cu, as->as_form, entry);
+  101667:	ff 75 14             	push   0x14(%ebp)
+  10166a:	0f b7 c0             	movzwl %ax,%eax
+  10166d:	50                   	push   %eax
+  10166e:	ff 75 0c             	push   0xc(%ebp)
+  101671:	ff 75 08             	push   0x8(%ebp)
+  101674:	e8 e6 fb ff ff       	call   10125f <dwarf_read_address>
+  101679:	83 c4 10             	add    $0x10,%esp
+}
+  10167c:	c9                   	leave
+  10167d:	c3                   	ret
+        switch (as->as_form) {
+  10167e:	8d 50 d7             	lea    -0x29(%eax),%edx
+  101681:	66 83 fa 03          	cmp    $0x3,%dx
+  101685:	76 e0                	jbe    101667 <dwarf_read_high_pc+0x28>
+                dwarf_read_abbrev_entry(entry, as->as_form, &value,
+  101687:	83 ec 0c             	sub    $0xc,%esp
+  10168a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  10168d:	ff 71 18             	push   0x18(%ecx)
+  101690:	6a 04                	push   $0x4
+  101692:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  101695:	52                   	push   %edx
+  101696:	0f b7 c0             	movzwl %ax,%eax
+  101699:	50                   	push   %eax
+  10169a:	ff 75 14             	push   0x14(%ebp)
+  10169d:	e8 0d f2 ff ff       	call   1008af <dwarf_read_abbrev_entry>
+                return low_pc + value;
+  1016a2:	8b 45 18             	mov    0x18(%ebp),%eax
+  1016a5:	03 45 f4             	add    -0xc(%ebp),%eax
+  1016a8:	83 c4 20             	add    $0x20,%esp
+  1016ab:	eb cf                	jmp    10167c <dwarf_read_high_pc+0x3d>
+                return low_pc + as->as_const;
+  1016ad:	8b 45 18             	mov    0x18(%ebp),%eax
+  1016b0:	03 42 04             	add    0x4(%edx),%eax
+  1016b3:	eb c7                	jmp    10167c <dwarf_read_high_pc+0x3d>
+
+001016b5 <dwarf_read_ref>:
+                           const void *entry) {
+  1016b5:	55                   	push   %ebp
+  1016b6:	89 e5                	mov    %esp,%ebp
+  1016b8:	56                   	push   %esi
+  1016b9:	53                   	push   %ebx
+  1016ba:	83 ec 1c             	sub    $0x1c,%esp
+  1016bd:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  1016c0:	8b 75 10             	mov    0x10(%ebp),%esi
+        uint32_t offset = 0;
+  1016c3:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+        dwarf_read_abbrev_entry(entry, form, &offset, sizeof(offset),
+  1016ca:	ff 73 18             	push   0x18(%ebx)
+  1016cd:	6a 04                	push   $0x4
+  1016cf:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  1016d2:	50                   	push   %eax
+  1016d3:	56                   	push   %esi
+  1016d4:	ff 75 14             	push   0x14(%ebp)
+  1016d7:	e8 d3 f1 ff ff       	call   1008af <dwarf_read_abbrev_entry>
+        if (form == DW_FORM_ref_addr) {
+  1016dc:	83 c4 20             	add    $0x20,%esp
+  1016df:	83 fe 10             	cmp    $0x10,%esi
+  1016e2:	74 1d                	je     101701 <dwarf_read_ref+0x4c>
+        if (offset >= cu->cu_end - cu->cu_hdr) {
+  1016e4:	8b 03                	mov    (%ebx),%eax
+  1016e6:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+  1016e9:	8b 53 08             	mov    0x8(%ebx),%edx
+  1016ec:	29 c2                	sub    %eax,%edx
+        return cu->cu_hdr + offset;
+  1016ee:	01 c8                	add    %ecx,%eax
+  1016f0:	39 d1                	cmp    %edx,%ecx
+  1016f2:	ba 00 00 00 00       	mov    $0x0,%edx
+  1016f7:	0f 43 c2             	cmovae %edx,%eax
+}
+  1016fa:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  1016fd:	5b                   	pop    %ebx
+  1016fe:	5e                   	pop    %esi
+  1016ff:	5d                   	pop    %ebp
+  101700:	c3                   	ret
+                if (offset >= addrs->info_end - addrs->info_begin) {
+  101701:	8b 45 08             	mov    0x8(%ebp),%eax
+  101704:	8b 40 10             	mov    0x10(%eax),%eax
+  101707:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+  10170a:	8b 75 08             	mov    0x8(%ebp),%esi
+  10170d:	8b 56 14             	mov    0x14(%esi),%edx
+  101710:	29 c2                	sub    %eax,%edx
+                return addrs->info_begin + offset;
+  101712:	01 c8                	add    %ecx,%eax
+  101714:	39 d1                	cmp    %edx,%ecx
+  101716:	ba 00 00 00 00       	mov    $0x0,%edx
+  10171b:	0f 43 c2             	cmovae %edx,%eax
+  10171e:	eb da                	jmp    1016fa <dwarf_read_ref+0x45>
+
+00101720 <die_origin>:
+// copy of an inline function, comes from the DIE its DW_AT_abstract_origin
+// or DW_AT_specification refers to in the unit.
+static void die_origin(const struct Dwarf_Addrs *addrs,
+                       const struct Dwarf_CU *cu,
+                       const struct Dwarf_Abbrevtab *abbrevs, const void *die,
+                       const char **name, unsigned *file) {
+  101720:	55                   	push   %ebp
+  101721:	89 e5                	mov    %esp,%ebp
+  101723:	57                   	push   %edi
+  101724:	56                   	push   %esi
+  101725:	53                   	push   %ebx
+  101726:	83 ec 1c             	sub    $0x1c,%esp
+  101729:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  10172c:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  10172f:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+        int depth;
+        for (depth = 0; depth < 4 && !(*name && *file); depth++) {
+  101732:	c7 45 dc 05 00 00 00 	movl   $0x5,-0x24(%ebp)
+  101739:	e9 c7 00 00 00       	jmp    101805 <die_origin+0xe5>
+                }
+                const struct Dwarf_Attrspec *attr;
+                const void *origin = NULL;
+                for (attr = ab->ab_attrs; attr->as_name || attr->as_form;
+                     attr++) {
+                        if (attr->as_name == DW_AT_name && !*name) {
+  10173e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  101741:	83 38 00             	cmpl   $0x0,(%eax)
+  101744:	74 61                	je     1017a7 <die_origin+0x87>
+                                    attr->as_name == DW_AT_specification) &&
+                                   attr->as_form != DW_FORM_ref_sig8) {
+                                origin = dwarf_read_ref(addrs, cu,
+                                                        attr->as_form, die);
+                        }
+                        die += dwarf_read_abbrev_entry(die, attr->as_form,
+  101746:	83 ec 0c             	sub    $0xc,%esp
+  101749:	ff 77 18             	push   0x18(%edi)
+  10174c:	6a 00                	push   $0x0
+  10174e:	6a 00                	push   $0x0
+  101750:	0f b7 46 02          	movzwl 0x2(%esi),%eax
+  101754:	50                   	push   %eax
+  101755:	53                   	push   %ebx
+  101756:	e8 54 f1 ff ff       	call   1008af <dwarf_read_abbrev_entry>
+  10175b:	01 c3                	add    %eax,%ebx
+                     attr++) {
+  10175d:	83 c6 08             	add    $0x8,%esi
+  101760:	83 c4 20             	add    $0x20,%esp
+                for (attr = ab->ab_attrs; attr->as_name || attr->as_form;
+  101763:	83 3e 00             	cmpl   $0x0,(%esi)
+  101766:	0f 84 8f 00 00 00    	je     1017fb <die_origin+0xdb>
+                        if (attr->as_name == DW_AT_name && !*name) {
+  10176c:	0f b7 06             	movzwl (%esi),%eax
+  10176f:	66 83 f8 03          	cmp    $0x3,%ax
+  101773:	74 c9                	je     10173e <die_origin+0x1e>
+                        } else if (attr->as_name == DW_AT_decl_file &&
+  101775:	66 83 f8 3a          	cmp    $0x3a,%ax
+  101779:	74 45                	je     1017c0 <die_origin+0xa0>
+                        } else if ((attr->as_name == DW_AT_abstract_origin ||
+  10177b:	66 83 f8 31          	cmp    $0x31,%ax
+  10177f:	74 06                	je     101787 <die_origin+0x67>
+  101781:	66 83 f8 47          	cmp    $0x47,%ax
+  101785:	75 bf                	jne    101746 <die_origin+0x26>
+                                   attr->as_form != DW_FORM_ref_sig8) {
+  101787:	0f b7 46 02          	movzwl 0x2(%esi),%eax
+                                    attr->as_name == DW_AT_specification) &&
+  10178b:	66 83 f8 20          	cmp    $0x20,%ax
+  10178f:	74 b5                	je     101746 <die_origin+0x26>
+                                origin = dwarf_read_ref(addrs, cu,
+  101791:	53                   	push   %ebx
+  101792:	0f b7 c0             	movzwl %ax,%eax
+  101795:	50                   	push   %eax
+  101796:	57                   	push   %edi
+  101797:	ff 75 e0             	push   -0x20(%ebp)
+  10179a:	e8 16 ff ff ff       	call   1016b5 <dwarf_read_ref>
+  10179f:	89 45 08             	mov    %eax,0x8(%ebp)
+  1017a2:	83 c4 10             	add    $0x10,%esp
+  1017a5:	eb 9f                	jmp    101746 <die_origin+0x26>
+                                *name = dwarf_read_string(addrs, cu,
+  1017a7:	53                   	push   %ebx
+  1017a8:	0f b7 46 02          	movzwl 0x2(%esi),%eax
+  1017ac:	50                   	push   %eax
+  1017ad:	57                   	push   %edi
+  1017ae:	ff 75 e0             	push   -0x20(%ebp)
+  1017b1:	e8 c0 f9 ff ff       	call   101176 <dwarf_read_string>
+  1017b6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  1017b9:	89 01                	mov    %eax,(%ecx)
+  1017bb:	83 c4 10             	add    $0x10,%esp
+  1017be:	eb 86                	jmp    101746 <die_origin+0x26>
+                        } else if (attr->as_name == DW_AT_decl_file &&
+  1017c0:	8b 45 10             	mov    0x10(%ebp),%eax
+  1017c3:	83 38 00             	cmpl   $0x0,(%eax)
+  1017c6:	0f 85 7a ff ff ff    	jne    101746 <die_origin+0x26>
+                                dwarf_read_abbrev_entry(die, attr->as_form,
+  1017cc:	83 ec 0c             	sub    $0xc,%esp
+  1017cf:	ff 77 18             	push   0x18(%edi)
+  1017d2:	6a 04                	push   $0x4
+  1017d4:	50                   	push   %eax
+  1017d5:	0f b7 46 02          	movzwl 0x2(%esi),%eax
+  1017d9:	50                   	push   %eax
+  1017da:	53                   	push   %ebx
+  1017db:	e8 cf f0 ff ff       	call   1008af <dwarf_read_abbrev_entry>
+                                if (attr->as_form == DW_FORM_implicit_const) {
+  1017e0:	83 c4 20             	add    $0x20,%esp
+  1017e3:	66 83 7e 02 21       	cmpw   $0x21,0x2(%esi)
+  1017e8:	0f 85 58 ff ff ff    	jne    101746 <die_origin+0x26>
+                                        *file = attr->as_const;
+  1017ee:	8b 46 04             	mov    0x4(%esi),%eax
+  1017f1:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  1017f4:	89 01                	mov    %eax,(%ecx)
+  1017f6:	e9 4b ff ff ff       	jmp    101746 <die_origin+0x26>
+                                                       NULL, 0,
+                                                       cu->cu_address_size);
+                }
+                if (!origin) {
+  1017fb:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  1017ff:	0f 84 81 00 00 00    	je     101886 <die_origin+0x166>
+        for (depth = 0; depth < 4 && !(*name && *file); depth++) {
+  101805:	83 6d dc 01          	subl   $0x1,-0x24(%ebp)
+  101809:	74 7b                	je     101886 <die_origin+0x166>
+  10180b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  10180e:	83 38 00             	cmpl   $0x0,(%eax)
+  101811:	74 08                	je     10181b <die_origin+0xfb>
+  101813:	8b 45 10             	mov    0x10(%ebp),%eax
+  101816:	83 38 00             	cmpl   $0x0,(%eax)
+  101819:	75 6b                	jne    101886 <die_origin+0x166>
+                if (die < (const void *)cu->cu_dies ||
+  10181b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  10181e:	8b 78 04             	mov    0x4(%eax),%edi
+  101821:	39 7d 08             	cmp    %edi,0x8(%ebp)
+  101824:	72 60                	jb     101886 <die_origin+0x166>
+  101826:	8b 40 08             	mov    0x8(%eax),%eax
+  101829:	39 45 08             	cmp    %eax,0x8(%ebp)
+  10182c:	73 58                	jae    101886 <die_origin+0x166>
+	count = 0;
+  10182e:	b8 00 00 00 00       	mov    $0x0,%eax
+	result = 0;
+  101833:	bf 00 00 00 00       	mov    $0x0,%edi
+  101838:	89 c6                	mov    %eax,%esi
+		byte = *addr;
+  10183a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  10183d:	0f b6 1c 01          	movzbl (%ecx,%eax,1),%ebx
+		count++;
+  101841:	83 c0 01             	add    $0x1,%eax
+		result |= (byte & 0x7f) << shift;
+  101844:	89 da                	mov    %ebx,%edx
+  101846:	83 e2 7f             	and    $0x7f,%edx
+  101849:	8d 0c f5 00 00 00 00 	lea    0x0(,%esi,8),%ecx
+  101850:	29 f1                	sub    %esi,%ecx
+  101852:	d3 e2                	shl    %cl,%edx
+  101854:	09 d7                	or     %edx,%edi
+		if (!(byte & 0x80))
+  101856:	84 db                	test   %bl,%bl
+  101858:	78 de                	js     101838 <die_origin+0x118>
+                die += dwarf_read_uleb128(die, &code);
+  10185a:	03 45 08             	add    0x8(%ebp),%eax
+  10185d:	89 c3                	mov    %eax,%ebx
+	if (code >= at->at_ncodes || !at->at_abbrevs[code].ab_attrs)
+  10185f:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  101862:	3b 79 08             	cmp    0x8(%ecx),%edi
+  101865:	73 1f                	jae    101886 <die_origin+0x166>
+  101867:	8d 04 bf             	lea    (%edi,%edi,4),%eax
+  10186a:	c1 e0 02             	shl    $0x2,%eax
+  10186d:	03 41 0c             	add    0xc(%ecx),%eax
+  101870:	8b 70 04             	mov    0x4(%eax),%esi
+  101873:	85 f6                	test   %esi,%esi
+  101875:	74 0f                	je     101886 <die_origin+0x166>
+                const void *origin = NULL;
+  101877:	c7 45 08 00 00 00 00 	movl   $0x0,0x8(%ebp)
+  10187e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  101881:	e9 dd fe ff ff       	jmp    101763 <die_origin+0x43>
+                        return;
+                }
+                die = origin;
+        }
+}
+  101886:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  101889:	5b                   	pop    %ebx
+  10188a:	5e                   	pop    %esi
+  10188b:	5f                   	pop    %edi
+  10188c:	5d                   	pop    %ebp
+  10188d:	c3                   	ret
+
+0010188e <die_sibling>:
+// Find the DW_AT_sibling of a DIE with abbreviation `ab` whose attributes
+// start at `entry`, by the skip plan. Returns NULL if it has none.
+static const void *die_sibling(const struct Dwarf_Addrs *addrs,
+                               const struct Dwarf_CU *cu,
+                               const struct Dwarf_Abbrev *ab,
+                               const void *entry) {
+  10188e:	55                   	push   %ebp
+  10188f:	89 e5                	mov    %esp,%ebp
+  101891:	57                   	push   %edi
+  101892:	56                   	push   %esi
+  101893:	53                   	push   %ebx
+  101894:	83 ec 1c             	sub    $0x1c,%esp
+  101897:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  10189a:	8b 75 08             	mov    0x8(%ebp),%esi
+        if (ab->ab_sibling_off == DWARF_NOSIBLING) {
+  10189d:	66 83 79 10 ff       	cmpw   $0xffff,0x10(%ecx)
+  1018a2:	74 77                	je     10191b <die_sibling+0x8d>
+  1018a4:	89 d0                	mov    %edx,%eax
+  1018a6:	89 ca                	mov    %ecx,%edx
+                return NULL;
+        }
+        entry = dwarf_skip_steps(ab, entry, ab->ab_sibling_step,
+                                 cu->cu_address_size);
+  1018a8:	8b 48 18             	mov    0x18(%eax),%ecx
+  1018ab:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+	for (st = ab->ab_steps; st < ab->ab_steps + nsteps; st++) {
+  1018ae:	8b 5a 08             	mov    0x8(%edx),%ebx
+        entry = dwarf_skip_steps(ab, entry, ab->ab_sibling_step,
+  1018b1:	0f b6 7a 03          	movzbl 0x3(%edx),%edi
+  1018b5:	c1 e7 02             	shl    $0x2,%edi
+  1018b8:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+  1018bb:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  1018be:	89 d7                	mov    %edx,%edi
+  1018c0:	eb 22                	jmp    1018e4 <die_sibling+0x56>
+		entry += st->ss_fixed;
+  1018c2:	0f b7 03             	movzwl (%ebx),%eax
+  1018c5:	01 c6                	add    %eax,%esi
+		entry += dwarf_read_abbrev_entry(entry, st->ss_form, NULL, 0,
+  1018c7:	83 ec 0c             	sub    $0xc,%esp
+  1018ca:	ff 75 e0             	push   -0x20(%ebp)
+  1018cd:	6a 00                	push   $0x0
+  1018cf:	6a 00                	push   $0x0
+  1018d1:	0f b7 43 02          	movzwl 0x2(%ebx),%eax
+  1018d5:	50                   	push   %eax
+  1018d6:	56                   	push   %esi
+  1018d7:	e8 d3 ef ff ff       	call   1008af <dwarf_read_abbrev_entry>
+  1018dc:	01 c6                	add    %eax,%esi
+	for (st = ab->ab_steps; st < ab->ab_steps + nsteps; st++) {
+  1018de:	83 c3 04             	add    $0x4,%ebx
+  1018e1:	83 c4 20             	add    $0x20,%esp
+  1018e4:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  1018e7:	03 47 08             	add    0x8(%edi),%eax
+  1018ea:	39 c3                	cmp    %eax,%ebx
+  1018ec:	72 d4                	jb     1018c2 <die_sibling+0x34>
+        const void *sibling = dwarf_read_ref(addrs, cu, ab->ab_sibling_form,
+                                             entry + ab->ab_sibling_off);
+  1018ee:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  1018f1:	0f b7 4f 10          	movzwl 0x10(%edi),%ecx
+        const void *sibling = dwarf_read_ref(addrs, cu, ab->ab_sibling_form,
+  1018f5:	01 f1                	add    %esi,%ecx
+  1018f7:	51                   	push   %ecx
+  1018f8:	0f b7 57 12          	movzwl 0x12(%edi),%edx
+  1018fc:	52                   	push   %edx
+  1018fd:	50                   	push   %eax
+  1018fe:	ff 75 dc             	push   -0x24(%ebp)
+  101901:	e8 af fd ff ff       	call   1016b5 <dwarf_read_ref>
+        // A sibling always comes after the DIE's attributes.
+        return sibling > entry ? sibling : NULL;
+  101906:	83 c4 10             	add    $0x10,%esp
+  101909:	39 c6                	cmp    %eax,%esi
+  10190b:	ba 00 00 00 00       	mov    $0x0,%edx
+  101910:	0f 43 c2             	cmovae %edx,%eax
+}
+  101913:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  101916:	5b                   	pop    %ebx
+  101917:	5e                   	pop    %esi
+  101918:	5f                   	pop    %edi
+  101919:	5d                   	pop    %ebp
+  10191a:	c3                   	ret
+                return NULL;
+  10191b:	b8 00 00 00 00       	mov    $0x0,%eax
+  101920:	eb f1                	jmp    101913 <die_sibling+0x85>
+
+00101922 <skip_children>:
+// Skip the children of a DIE, from `entry` just past its attributes to past
+// the null entry that ends them.
+static const void *skip_children(const struct Dwarf_Addrs *addrs,
+                                 const struct Dwarf_CU *cu,
+                                 const struct Dwarf_Abbrevtab *abbrevs,
+                                 const void *entry) {
+  101922:	55                   	push   %ebp
+  101923:	89 e5                	mov    %esp,%ebp
+  101925:	57                   	push   %edi
+  101926:	56                   	push   %esi
+  101927:	53                   	push   %ebx
+  101928:	83 ec 2c             	sub    $0x2c,%esp
+  10192b:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  10192e:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  101931:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+        int depth = 1;
+  101934:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+  10193b:	eb 4f                	jmp    10198c <skip_children+0x6a>
+        while (depth > 0 && entry < (const void *)cu->cu_end) {
+                unsigned abbrev_code = 0;
+                entry += dwarf_read_uleb128(entry, &abbrev_code);
+                if (abbrev_code == 0) {
+                        depth--;
+  10193d:	83 6d d8 01          	subl   $0x1,-0x28(%ebp)
+                entry += dwarf_read_uleb128(entry, &abbrev_code);
+  101941:	89 45 08             	mov    %eax,0x8(%ebp)
+  101944:	eb 3c                	jmp    101982 <skip_children+0x60>
+		entry += st->ss_fixed;
+  101946:	0f b7 06             	movzwl (%esi),%eax
+  101949:	01 c3                	add    %eax,%ebx
+		entry += dwarf_read_abbrev_entry(entry, st->ss_form, NULL, 0,
+  10194b:	83 ec 0c             	sub    $0xc,%esp
+  10194e:	ff 75 e0             	push   -0x20(%ebp)
+  101951:	6a 00                	push   $0x0
+  101953:	6a 00                	push   $0x0
+  101955:	0f b7 46 02          	movzwl 0x2(%esi),%eax
+  101959:	50                   	push   %eax
+  10195a:	53                   	push   %ebx
+  10195b:	e8 4f ef ff ff       	call   1008af <dwarf_read_abbrev_entry>
+  101960:	01 c3                	add    %eax,%ebx
+	for (st = ab->ab_steps; st < ab->ab_steps + nsteps; st++) {
+  101962:	83 c6 04             	add    $0x4,%esi
+  101965:	83 c4 20             	add    $0x20,%esp
+  101968:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  10196b:	03 47 08             	add    0x8(%edi),%eax
+  10196e:	39 c6                	cmp    %eax,%esi
+  101970:	72 d4                	jb     101946 <skip_children+0x24>
+		+ ab->ab_fixed;
+  101972:	0f b7 47 0e          	movzwl 0xe(%edi),%eax
+  101976:	01 d8                	add    %ebx,%eax
+  101978:	89 45 08             	mov    %eax,0x8(%ebp)
+                if (sibling) {
+                        entry = sibling;
+                } else {
+                        entry = dwarf_skip_attrs(abbrev, entry,
+                                                 cu->cu_address_size);
+                        depth += abbrev->ab_children;
+  10197b:	0f b6 47 02          	movzbl 0x2(%edi),%eax
+  10197f:	01 45 d8             	add    %eax,-0x28(%ebp)
+        while (depth > 0 && entry < (const void *)cu->cu_end) {
+  101982:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  101986:	0f 8e aa 00 00 00    	jle    101a36 <skip_children+0x114>
+  10198c:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  10198f:	8b 70 08             	mov    0x8(%eax),%esi
+  101992:	39 75 08             	cmp    %esi,0x8(%ebp)
+  101995:	0f 83 96 00 00 00    	jae    101a31 <skip_children+0x10f>
+	count = 0;
+  10199b:	b8 00 00 00 00       	mov    $0x0,%eax
+	result = 0;
+  1019a0:	bf 00 00 00 00       	mov    $0x0,%edi
+  1019a5:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  1019a8:	89 c6                	mov    %eax,%esi
+		byte = *addr;
+  1019aa:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  1019ad:	0f b6 1c 01          	movzbl (%ecx,%eax,1),%ebx
+		count++;
+  1019b1:	83 c0 01             	add    $0x1,%eax
+		result |= (byte & 0x7f) << shift;
+  1019b4:	89 da                	mov    %ebx,%edx
+  1019b6:	83 e2 7f             	and    $0x7f,%edx
+  1019b9:	8d 0c f5 00 00 00 00 	lea    0x0(,%esi,8),%ecx
+  1019c0:	29 f1                	sub    %esi,%ecx
+  1019c2:	d3 e2                	shl    %cl,%edx
+  1019c4:	09 d7                	or     %edx,%edi
+		if (!(byte & 0x80))
+  1019c6:	84 db                	test   %bl,%bl
+  1019c8:	78 de                	js     1019a8 <skip_children+0x86>
+                entry += dwarf_read_uleb128(entry, &abbrev_code);
+  1019ca:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  1019cd:	03 45 08             	add    0x8(%ebp),%eax
+  1019d0:	89 c3                	mov    %eax,%ebx
+                if (abbrev_code == 0) {
+  1019d2:	85 ff                	test   %edi,%edi
+  1019d4:	0f 84 63 ff ff ff    	je     10193d <skip_children+0x1b>
+	if (code >= at->at_ncodes || !at->at_abbrevs[code].ab_attrs)
+  1019da:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  1019dd:	3b 78 08             	cmp    0x8(%eax),%edi
+  1019e0:	73 59                	jae    101a3b <skip_children+0x119>
+  1019e2:	8d 14 bf             	lea    (%edi,%edi,4),%edx
+  1019e5:	8b 40 0c             	mov    0xc(%eax),%eax
+  1019e8:	8d 3c 90             	lea    (%eax,%edx,4),%edi
+  1019eb:	83 7f 04 00          	cmpl   $0x0,0x4(%edi)
+  1019ef:	74 56                	je     101a47 <skip_children+0x125>
+                                          : NULL;
+  1019f1:	80 7f 02 00          	cmpb   $0x0,0x2(%edi)
+  1019f5:	74 1f                	je     101a16 <skip_children+0xf4>
+                                          ? die_sibling(addrs, cu, abbrev, entry)
+  1019f7:	83 ec 0c             	sub    $0xc,%esp
+  1019fa:	53                   	push   %ebx
+  1019fb:	89 f9                	mov    %edi,%ecx
+  1019fd:	8b 55 dc             	mov    -0x24(%ebp),%edx
+  101a00:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  101a03:	e8 86 fe ff ff       	call   10188e <die_sibling>
+  101a08:	89 45 08             	mov    %eax,0x8(%ebp)
+                if (sibling) {
+  101a0b:	83 c4 10             	add    $0x10,%esp
+  101a0e:	85 c0                	test   %eax,%eax
+  101a10:	0f 85 6c ff ff ff    	jne    101982 <skip_children+0x60>
+                                                 cu->cu_address_size);
+  101a16:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  101a19:	8b 40 18             	mov    0x18(%eax),%eax
+  101a1c:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	for (st = ab->ab_steps; st < ab->ab_steps + nsteps; st++) {
+  101a1f:	8b 77 08             	mov    0x8(%edi),%esi
+	return dwarf_skip_steps(ab, entry, ab->ab_nsteps, address_size)
+  101a22:	0f b7 47 0c          	movzwl 0xc(%edi),%eax
+	for (st = ab->ab_steps; st < ab->ab_steps + nsteps; st++) {
+  101a26:	c1 e0 02             	shl    $0x2,%eax
+  101a29:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  101a2c:	e9 37 ff ff ff       	jmp    101968 <skip_children+0x46>
+  101a31:	8b 55 08             	mov    0x8(%ebp),%edx
+  101a34:	eb 07                	jmp    101a3d <skip_children+0x11b>
+  101a36:	8b 55 08             	mov    0x8(%ebp),%edx
+  101a39:	eb 02                	jmp    101a3d <skip_children+0x11b>
+  101a3b:	89 f2                	mov    %esi,%edx
+                }
+        }
+        return entry;
+}
+  101a3d:	89 d0                	mov    %edx,%eax
+  101a3f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  101a42:	5b                   	pop    %ebx
+  101a43:	5e                   	pop    %esi
+  101a44:	5f                   	pop    %edi
+  101a45:	5d                   	pop    %ebp
+  101a46:	c3                   	ret
+  101a47:	89 f2                	mov    %esi,%edx
+  101a49:	eb f2                	jmp    101a3d <skip_children+0x11b>
+
+00101a4b <dwarf_read_ranges>:
+                       const void *entry, struct Dwarf_Ranges *rg) {
+  101a4b:	55                   	push   %ebp
+  101a4c:	89 e5                	mov    %esp,%ebp
+  101a4e:	57                   	push   %edi
+  101a4f:	56                   	push   %esi
+  101a50:	53                   	push   %ebx
+  101a51:	83 ec 38             	sub    $0x38,%esp
+  101a54:	8b 75 0c             	mov    0xc(%ebp),%esi
+  101a57:	8b 5d 18             	mov    0x18(%ebp),%ebx
+        uint32_t value = 0;
+  101a5a:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+        dwarf_read_abbrev_entry(entry, form, &value, sizeof(value),
+  101a61:	ff 76 18             	push   0x18(%esi)
+  101a64:	6a 04                	push   $0x4
+  101a66:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  101a69:	50                   	push   %eax
+  101a6a:	ff 75 10             	push   0x10(%ebp)
+  101a6d:	ff 75 14             	push   0x14(%ebp)
+  101a70:	e8 3a ee ff ff       	call   1008af <dwarf_read_abbrev_entry>
+        const unsigned char *begin = addrs->ranges_begin;
+  101a75:	8b 45 08             	mov    0x8(%ebp),%eax
+  101a78:	8b 40 58             	mov    0x58(%eax),%eax
+  101a7b:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+        const unsigned char *end = addrs->ranges_end;
+  101a7e:	8b 45 08             	mov    0x8(%ebp),%eax
+  101a81:	8b 78 5c             	mov    0x5c(%eax),%edi
+        if (cu->cu_version >= 5) {
+  101a84:	83 c4 20             	add    $0x20,%esp
+  101a87:	83 7e 14 04          	cmpl   $0x4,0x14(%esi)
+  101a8b:	76 0c                	jbe    101a99 <dwarf_read_ranges+0x4e>
+                begin = addrs->rnglists_begin;
+  101a8d:	8b 40 60             	mov    0x60(%eax),%eax
+  101a90:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+                end = addrs->rnglists_end;
+  101a93:	8b 45 08             	mov    0x8(%ebp),%eax
+  101a96:	8b 78 64             	mov    0x64(%eax),%edi
+        rg->rg_addrs = addrs;
+  101a99:	8b 45 08             	mov    0x8(%ebp),%eax
+  101a9c:	89 03                	mov    %eax,(%ebx)
+        rg->rg_cu = cu;
+  101a9e:	89 73 04             	mov    %esi,0x4(%ebx)
+        rg->rg_end = end;
+  101aa1:	89 7b 0c             	mov    %edi,0xc(%ebx)
+        rg->rg_base = cu->cu_base;
+  101aa4:	8b 46 28             	mov    0x28(%esi),%eax
+  101aa7:	89 43 10             	mov    %eax,0x10(%ebx)
+        rg->rg_next = NULL;
+  101aaa:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+        if (form == DW_FORM_rnglistx) {
+  101ab1:	83 7d 10 23          	cmpl   $0x23,0x10(%ebp)
+  101ab5:	74 19                	je     101ad0 <dwarf_read_ranges+0x85>
+        if (value < end - begin) {
+  101ab7:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  101aba:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+  101abd:	29 cf                	sub    %ecx,%edi
+  101abf:	39 f8                	cmp    %edi,%eax
+  101ac1:	73 05                	jae    101ac8 <dwarf_read_ranges+0x7d>
+                rg->rg_next = begin + value;
+  101ac3:	01 c1                	add    %eax,%ecx
+  101ac5:	89 4b 08             	mov    %ecx,0x8(%ebx)
+}
+  101ac8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  101acb:	5b                   	pop    %ebx
+  101acc:	5e                   	pop    %esi
+  101acd:	5f                   	pop    %edi
+  101ace:	5d                   	pop    %ebp
+  101acf:	c3                   	ret
+                    begin + cu->cu_rnglists_base + value * sizeof(uint32_t);
+  101ad0:	8b 76 24             	mov    0x24(%esi),%esi
+  101ad3:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  101ad6:	8d 04 86             	lea    (%esi,%eax,4),%eax
+                const unsigned char *p =
+  101ad9:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+  101adc:	01 d0                	add    %edx,%eax
+                if (p + sizeof(uint32_t) > end) {
+  101ade:	8d 50 04             	lea    0x4(%eax),%edx
+  101ae1:	39 d7                	cmp    %edx,%edi
+  101ae3:	72 e3                	jb     101ac8 <dwarf_read_ranges+0x7d>
+                value = cu->cu_rnglists_base + get_unaligned(p, uint32_t);
+  101ae5:	83 ec 04             	sub    $0x4,%esp
+  101ae8:	6a 04                	push   $0x4
+  101aea:	50                   	push   %eax
+  101aeb:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  101aee:	50                   	push   %eax
+  101aef:	e8 04 77 00 00       	call   1091f8 <memcpy>
+  101af4:	03 75 e0             	add    -0x20(%ebp),%esi
+  101af7:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  101afa:	83 c4 10             	add    $0x10,%esp
+  101afd:	eb b8                	jmp    101ab7 <dwarf_read_ranges+0x6c>
+
+00101aff <dwarf_ranges_next>:
+                       uintptr_t *high) {
+  101aff:	55                   	push   %ebp
+  101b00:	89 e5                	mov    %esp,%ebp
+  101b02:	57                   	push   %edi
+  101b03:	56                   	push   %esi
+  101b04:	53                   	push   %ebx
+  101b05:	83 ec 2c             	sub    $0x2c,%esp
+        const unsigned char *p = rg->rg_next;
+  101b08:	8b 45 08             	mov    0x8(%ebp),%eax
+  101b0b:	8b 78 08             	mov    0x8(%eax),%edi
+        while (p) {
+  101b0e:	e9 c3 00 00 00       	jmp    101bd6 <dwarf_ranges_next+0xd7>
+                                rg->rg_base = b;
+  101b13:	8b 75 08             	mov    0x8(%ebp),%esi
+  101b16:	89 46 10             	mov    %eax,0x10(%esi)
+                        p += 2 * sizeof(uint32_t);
+  101b19:	89 df                	mov    %ebx,%edi
+                                continue;
+  101b1b:	e9 b6 00 00 00       	jmp    101bd6 <dwarf_ranges_next+0xd7>
+                        if (p >= rg->rg_end) {
+  101b20:	8b 45 08             	mov    0x8(%ebp),%eax
+  101b23:	3b 78 0c             	cmp    0xc(%eax),%edi
+  101b26:	0f 83 79 02 00 00    	jae    101da5 <dwarf_ranges_next+0x2a6>
+                        Dwarf_Small kind = *p++;
+  101b2c:	8d 77 01             	lea    0x1(%edi),%esi
+  101b2f:	0f b6 07             	movzbl (%edi),%eax
+  101b32:	88 45 d4             	mov    %al,-0x2c(%ebp)
+                        if (kind == DW_RLE_base_addressx) {
+  101b35:	3c 01                	cmp    $0x1,%al
+  101b37:	0f 84 0b 01 00 00    	je     101c48 <dwarf_ranges_next+0x149>
+                        } else if (kind == DW_RLE_base_address) {
+  101b3d:	80 7d d4 05          	cmpb   $0x5,-0x2c(%ebp)
+  101b41:	0f 84 51 01 00 00    	je     101c98 <dwarf_ranges_next+0x199>
+                                   kind == DW_RLE_startx_length ||
+  101b47:	0f b6 45 d4          	movzbl -0x2c(%ebp),%eax
+  101b4b:	83 e8 02             	sub    $0x2,%eax
+                        } else if (kind == DW_RLE_startx_endx ||
+  101b4e:	3c 02                	cmp    $0x2,%al
+  101b50:	0f 86 65 01 00 00    	jbe    101cbb <dwarf_ranges_next+0x1bc>
+                        } else if (kind == DW_RLE_start_end ||
+  101b56:	0f b6 4d d4          	movzbl -0x2c(%ebp),%ecx
+  101b5a:	8d 41 fa             	lea    -0x6(%ecx),%eax
+  101b5d:	3c 01                	cmp    $0x1,%al
+  101b5f:	0f 87 40 02 00 00    	ja     101da5 <dwarf_ranges_next+0x2a6>
+                                start = get_unaligned(p, uint32_t);
+  101b65:	83 ec 04             	sub    $0x4,%esp
+  101b68:	6a 04                	push   $0x4
+  101b6a:	56                   	push   %esi
+  101b6b:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  101b6e:	50                   	push   %eax
+  101b6f:	e8 84 76 00 00       	call   1091f8 <memcpy>
+  101b74:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+                                p += sizeof(uint32_t);
+  101b77:	8d 5f 05             	lea    0x5(%edi),%ebx
+                                if (kind == DW_RLE_start_end) {
+  101b7a:	83 c4 10             	add    $0x10,%esp
+	count = 0;
+  101b7d:	b8 00 00 00 00       	mov    $0x0,%eax
+	result = 0;
+  101b82:	ba 00 00 00 00       	mov    $0x0,%edx
+  101b87:	80 7d d4 06          	cmpb   $0x6,-0x2c(%ebp)
+  101b8b:	0f 84 e0 01 00 00    	je     101d71 <dwarf_ranges_next+0x272>
+  101b91:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+  101b94:	89 75 d0             	mov    %esi,-0x30(%ebp)
+  101b97:	89 5d cc             	mov    %ebx,-0x34(%ebp)
+  101b9a:	89 d7                	mov    %edx,%edi
+  101b9c:	89 c6                	mov    %eax,%esi
+		byte = *addr;
+  101b9e:	8b 5d d4             	mov    -0x2c(%ebp),%ebx
+  101ba1:	0f b6 5c 03 05       	movzbl 0x5(%ebx,%eax,1),%ebx
+		count++;
+  101ba6:	83 c0 01             	add    $0x1,%eax
+		result |= (byte & 0x7f) << shift;
+  101ba9:	89 da                	mov    %ebx,%edx
+  101bab:	83 e2 7f             	and    $0x7f,%edx
+  101bae:	8d 0c f5 00 00 00 00 	lea    0x0(,%esi,8),%ecx
+  101bb5:	29 f1                	sub    %esi,%ecx
+  101bb7:	d3 e2                	shl    %cl,%edx
+  101bb9:	09 d7                	or     %edx,%edi
+		if (!(byte & 0x80))
+  101bbb:	84 db                	test   %bl,%bl
+  101bbd:	78 dd                	js     101b9c <dwarf_ranges_next+0x9d>
+                                        p += dwarf_read_uleb128(
+  101bbf:	8b 75 d0             	mov    -0x30(%ebp),%esi
+  101bc2:	8b 5d cc             	mov    -0x34(%ebp),%ebx
+  101bc5:	89 f9                	mov    %edi,%ecx
+  101bc7:	8d 3c 03             	lea    (%ebx,%eax,1),%edi
+                                        finish = start + b;
+  101bca:	01 f1                	add    %esi,%ecx
+  101bcc:	89 ca                	mov    %ecx,%edx
+                if (start < finish) {
+  101bce:	39 d6                	cmp    %edx,%esi
+  101bd0:	0f 82 b8 01 00 00    	jb     101d8e <dwarf_ranges_next+0x28f>
+        while (p) {
+  101bd6:	85 ff                	test   %edi,%edi
+  101bd8:	0f 84 c7 01 00 00    	je     101da5 <dwarf_ranges_next+0x2a6>
+                if (rg->rg_cu->cu_version < 5) {
+  101bde:	8b 45 08             	mov    0x8(%ebp),%eax
+  101be1:	8b 40 04             	mov    0x4(%eax),%eax
+  101be4:	83 78 14 04          	cmpl   $0x4,0x14(%eax)
+  101be8:	0f 87 32 ff ff ff    	ja     101b20 <dwarf_ranges_next+0x21>
+                        if (p + 2 * sizeof(uint32_t) > rg->rg_end) {
+  101bee:	8d 5f 08             	lea    0x8(%edi),%ebx
+  101bf1:	8b 45 08             	mov    0x8(%ebp),%eax
+  101bf4:	39 58 0c             	cmp    %ebx,0xc(%eax)
+  101bf7:	0f 82 a8 01 00 00    	jb     101da5 <dwarf_ranges_next+0x2a6>
+                        a = get_unaligned(p, uint32_t);
+  101bfd:	83 ec 04             	sub    $0x4,%esp
+  101c00:	6a 04                	push   $0x4
+  101c02:	57                   	push   %edi
+  101c03:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  101c06:	50                   	push   %eax
+  101c07:	e8 ec 75 00 00       	call   1091f8 <memcpy>
+  101c0c:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+                        b = get_unaligned(p + sizeof(uint32_t), uint32_t);
+  101c0f:	83 c4 0c             	add    $0xc,%esp
+  101c12:	6a 04                	push   $0x4
+  101c14:	83 c7 04             	add    $0x4,%edi
+  101c17:	57                   	push   %edi
+  101c18:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  101c1b:	50                   	push   %eax
+  101c1c:	e8 d7 75 00 00       	call   1091f8 <memcpy>
+  101c21:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+                        if (a == 0 && b == 0) {
+  101c24:	83 c4 10             	add    $0x10,%esp
+  101c27:	89 f7                	mov    %esi,%edi
+  101c29:	09 c7                	or     %eax,%edi
+  101c2b:	0f 84 74 01 00 00    	je     101da5 <dwarf_ranges_next+0x2a6>
+                        if (a == ~(uint32_t)0) {
+  101c31:	83 fe ff             	cmp    $0xffffffff,%esi
+  101c34:	0f 84 d9 fe ff ff    	je     101b13 <dwarf_ranges_next+0x14>
+                        start = rg->rg_base + a;
+  101c3a:	8b 7d 08             	mov    0x8(%ebp),%edi
+  101c3d:	8b 57 10             	mov    0x10(%edi),%edx
+  101c40:	01 d6                	add    %edx,%esi
+                        finish = rg->rg_base + b;
+  101c42:	01 c2                	add    %eax,%edx
+                        p += 2 * sizeof(uint32_t);
+  101c44:	89 df                	mov    %ebx,%edi
+  101c46:	eb 86                	jmp    101bce <dwarf_ranges_next+0xcf>
+	count = 0;
+  101c48:	b8 00 00 00 00       	mov    $0x0,%eax
+	result = 0;
+  101c4d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  101c52:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+  101c55:	89 75 d0             	mov    %esi,-0x30(%ebp)
+  101c58:	89 de                	mov    %ebx,%esi
+  101c5a:	89 c7                	mov    %eax,%edi
+		byte = *addr;
+  101c5c:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+  101c5f:	0f b6 5c 01 01       	movzbl 0x1(%ecx,%eax,1),%ebx
+		count++;
+  101c64:	83 c0 01             	add    $0x1,%eax
+		result |= (byte & 0x7f) << shift;
+  101c67:	89 da                	mov    %ebx,%edx
+  101c69:	83 e2 7f             	and    $0x7f,%edx
+  101c6c:	8d 0c fd 00 00 00 00 	lea    0x0(,%edi,8),%ecx
+  101c73:	29 f9                	sub    %edi,%ecx
+  101c75:	d3 e2                	shl    %cl,%edx
+  101c77:	09 d6                	or     %edx,%esi
+		if (!(byte & 0x80))
+  101c79:	84 db                	test   %bl,%bl
+  101c7b:	78 dd                	js     101c5a <dwarf_ranges_next+0x15b>
+                                p += dwarf_read_uleb128((const char *)p, &a);
+  101c7d:	89 f2                	mov    %esi,%edx
+  101c7f:	8b 75 d0             	mov    -0x30(%ebp),%esi
+  101c82:	8d 3c 06             	lea    (%esi,%eax,1),%edi
+                                rg->rg_base = ranges_addrx(rg, a);
+  101c85:	8b 45 08             	mov    0x8(%ebp),%eax
+  101c88:	e8 eb eb ff ff       	call   100878 <ranges_addrx>
+  101c8d:	8b 75 08             	mov    0x8(%ebp),%esi
+  101c90:	89 46 10             	mov    %eax,0x10(%esi)
+                                continue;
+  101c93:	e9 3e ff ff ff       	jmp    101bd6 <dwarf_ranges_next+0xd7>
+                                rg->rg_base = get_unaligned(p, uint32_t);
+  101c98:	83 ec 04             	sub    $0x4,%esp
+  101c9b:	6a 04                	push   $0x4
+  101c9d:	56                   	push   %esi
+  101c9e:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  101ca1:	50                   	push   %eax
+  101ca2:	e8 51 75 00 00       	call   1091f8 <memcpy>
+  101ca7:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  101caa:	8b 75 08             	mov    0x8(%ebp),%esi
+  101cad:	89 46 10             	mov    %eax,0x10(%esi)
+                                p += sizeof(uint32_t);
+  101cb0:	83 c7 05             	add    $0x5,%edi
+                                continue;
+  101cb3:	83 c4 10             	add    $0x10,%esp
+  101cb6:	e9 1b ff ff ff       	jmp    101bd6 <dwarf_ranges_next+0xd7>
+	count = 0;
+  101cbb:	b8 00 00 00 00       	mov    $0x0,%eax
+	result = 0;
+  101cc0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  101cc5:	89 7d d0             	mov    %edi,-0x30(%ebp)
+  101cc8:	89 75 cc             	mov    %esi,-0x34(%ebp)
+  101ccb:	89 df                	mov    %ebx,%edi
+  101ccd:	89 c6                	mov    %eax,%esi
+		byte = *addr;
+  101ccf:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  101cd2:	0f b6 5c 03 01       	movzbl 0x1(%ebx,%eax,1),%ebx
+		count++;
+  101cd7:	83 c0 01             	add    $0x1,%eax
+		result |= (byte & 0x7f) << shift;
+  101cda:	89 da                	mov    %ebx,%edx
+  101cdc:	83 e2 7f             	and    $0x7f,%edx
+  101cdf:	8d 0c f5 00 00 00 00 	lea    0x0(,%esi,8),%ecx
+  101ce6:	29 f1                	sub    %esi,%ecx
+  101ce8:	d3 e2                	shl    %cl,%edx
+  101cea:	09 d7                	or     %edx,%edi
+		if (!(byte & 0x80))
+  101cec:	84 db                	test   %bl,%bl
+  101cee:	78 dd                	js     101ccd <dwarf_ranges_next+0x1ce>
+                                p += dwarf_read_uleb128((const char *)p, &a);
+  101cf0:	8b 75 cc             	mov    -0x34(%ebp),%esi
+  101cf3:	89 7d cc             	mov    %edi,-0x34(%ebp)
+  101cf6:	01 f0                	add    %esi,%eax
+  101cf8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+	count = 0;
+  101cfb:	bf 00 00 00 00       	mov    $0x0,%edi
+	result = 0;
+  101d00:	bb 00 00 00 00       	mov    $0x0,%ebx
+  101d05:	89 fe                	mov    %edi,%esi
+		byte = *addr;
+  101d07:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  101d0a:	0f b6 14 38          	movzbl (%eax,%edi,1),%edx
+		count++;
+  101d0e:	83 c7 01             	add    $0x1,%edi
+		result |= (byte & 0x7f) << shift;
+  101d11:	89 d0                	mov    %edx,%eax
+  101d13:	83 e0 7f             	and    $0x7f,%eax
+  101d16:	8d 0c f5 00 00 00 00 	lea    0x0(,%esi,8),%ecx
+  101d1d:	29 f1                	sub    %esi,%ecx
+  101d1f:	d3 e0                	shl    %cl,%eax
+  101d21:	09 c3                	or     %eax,%ebx
+		if (!(byte & 0x80))
+  101d23:	84 d2                	test   %dl,%dl
+  101d25:	78 de                	js     101d05 <dwarf_ranges_next+0x206>
+                                p += dwarf_read_uleb128((const char *)p, &b);
+  101d27:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  101d2a:	01 f8                	add    %edi,%eax
+  101d2c:	89 c7                	mov    %eax,%edi
+                                if (kind == DW_RLE_offset_pair) {
+  101d2e:	80 7d d4 04          	cmpb   $0x4,-0x2c(%ebp)
+  101d32:	75 12                	jne    101d46 <dwarf_ranges_next+0x247>
+                                        start = rg->rg_base + a;
+  101d34:	8b 45 08             	mov    0x8(%ebp),%eax
+  101d37:	8b 50 10             	mov    0x10(%eax),%edx
+  101d3a:	8b 75 cc             	mov    -0x34(%ebp),%esi
+  101d3d:	01 d6                	add    %edx,%esi
+                                        finish = rg->rg_base + b;
+  101d3f:	01 da                	add    %ebx,%edx
+  101d41:	e9 88 fe ff ff       	jmp    101bce <dwarf_ranges_next+0xcf>
+                                        start = ranges_addrx(rg, a);
+  101d46:	8b 55 cc             	mov    -0x34(%ebp),%edx
+  101d49:	8b 45 08             	mov    0x8(%ebp),%eax
+  101d4c:	e8 27 eb ff ff       	call   100878 <ranges_addrx>
+  101d51:	89 c6                	mov    %eax,%esi
+                                                     : start + b;
+  101d53:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+  101d56:	80 7d d4 02          	cmpb   $0x2,-0x2c(%ebp)
+  101d5a:	0f 85 6e fe ff ff    	jne    101bce <dwarf_ranges_next+0xcf>
+                                                     ? ranges_addrx(rg, b)
+  101d60:	89 da                	mov    %ebx,%edx
+  101d62:	8b 45 08             	mov    0x8(%ebp),%eax
+  101d65:	e8 0e eb ff ff       	call   100878 <ranges_addrx>
+  101d6a:	89 c2                	mov    %eax,%edx
+  101d6c:	e9 5d fe ff ff       	jmp    101bce <dwarf_ranges_next+0xcf>
+                                        finish = get_unaligned(p, uint32_t);
+  101d71:	83 ec 04             	sub    $0x4,%esp
+  101d74:	6a 04                	push   $0x4
+  101d76:	53                   	push   %ebx
+  101d77:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  101d7a:	50                   	push   %eax
+  101d7b:	e8 78 74 00 00       	call   1091f8 <memcpy>
+  101d80:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+                                        p += sizeof(uint32_t);
+  101d83:	83 c7 09             	add    $0x9,%edi
+  101d86:	83 c4 10             	add    $0x10,%esp
+  101d89:	e9 40 fe ff ff       	jmp    101bce <dwarf_ranges_next+0xcf>
+                        rg->rg_next = p;
+  101d8e:	8b 45 08             	mov    0x8(%ebp),%eax
+  101d91:	89 78 08             	mov    %edi,0x8(%eax)
+                        *low = start;
+  101d94:	8b 45 0c             	mov    0xc(%ebp),%eax
+  101d97:	89 30                	mov    %esi,(%eax)
+                        *high = finish;
+  101d99:	8b 45 10             	mov    0x10(%ebp),%eax
+  101d9c:	89 10                	mov    %edx,(%eax)
+                        return 1;
+  101d9e:	b8 01 00 00 00       	mov    $0x1,%eax
+  101da3:	eb 0f                	jmp    101db4 <dwarf_ranges_next+0x2b5>
+        rg->rg_next = NULL;
+  101da5:	8b 45 08             	mov    0x8(%ebp),%eax
+  101da8:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%eax)
+        return 0;
+  101daf:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  101db4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  101db7:	5b                   	pop    %ebx
+  101db8:	5e                   	pop    %esi
+  101db9:	5f                   	pop    %edi
+  101dba:	5d                   	pop    %ebp
+  101dbb:	c3                   	ret
+
+00101dbc <dwarf_ranges_find>:
+bool dwarf_ranges_find(struct Dwarf_Ranges *rg, uintptr_t p, uintptr_t *low) {
+  101dbc:	55                   	push   %ebp
+  101dbd:	89 e5                	mov    %esp,%ebp
+  101dbf:	57                   	push   %edi
+  101dc0:	56                   	push   %esi
+  101dc1:	53                   	push   %ebx
+  101dc2:	83 ec 1c             	sub    $0x1c,%esp
+  101dc5:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+        uintptr_t start = 0, finish = 0;
+  101dc8:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  101dcf:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%ebp)
+        while (dwarf_ranges_next(rg, &start, &finish)) {
+  101dd6:	8d 7d e0             	lea    -0x20(%ebp),%edi
+  101dd9:	8d 75 e4             	lea    -0x1c(%ebp),%esi
+  101ddc:	83 ec 04             	sub    $0x4,%esp
+  101ddf:	57                   	push   %edi
+  101de0:	56                   	push   %esi
+  101de1:	ff 75 08             	push   0x8(%ebp)
+  101de4:	e8 16 fd ff ff       	call   101aff <dwarf_ranges_next>
+  101de9:	83 c4 10             	add    $0x10,%esp
+  101dec:	84 c0                	test   %al,%al
+  101dee:	74 11                	je     101e01 <dwarf_ranges_find+0x45>
+                if (p >= start && p <= finish) {
+  101df0:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  101df3:	39 d3                	cmp    %edx,%ebx
+  101df5:	72 e5                	jb     101ddc <dwarf_ranges_find+0x20>
+  101df7:	39 5d e0             	cmp    %ebx,-0x20(%ebp)
+  101dfa:	72 e0                	jb     101ddc <dwarf_ranges_find+0x20>
+                        *low = start;
+  101dfc:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  101dff:	89 11                	mov    %edx,(%ecx)
+}
+  101e01:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  101e04:	5b                   	pop    %ebx
+  101e05:	5e                   	pop    %esi
+  101e06:	5f                   	pop    %edi
+  101e07:	5d                   	pop    %ebp
+  101e08:	c3                   	ret
+
+00101e09 <dwarf_die_name>:
+                           const void *die) {
+  101e09:	55                   	push   %ebp
+  101e0a:	89 e5                	mov    %esp,%ebp
+  101e0c:	83 ec 1c             	sub    $0x1c,%esp
+        const char *name = NULL;
+  101e0f:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+        unsigned file = 0;
+  101e16:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+        die_origin(addrs, cu, abbrevs, die, &name, &file);
+  101e1d:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  101e20:	50                   	push   %eax
+  101e21:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  101e24:	50                   	push   %eax
+  101e25:	ff 75 14             	push   0x14(%ebp)
+  101e28:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  101e2b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  101e2e:	8b 45 08             	mov    0x8(%ebp),%eax
+  101e31:	e8 ea f8 ff ff       	call   101720 <die_origin>
+}
+  101e36:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  101e39:	c9                   	leave
+  101e3a:	c3                   	ret
+
+00101e3b <dwarf_skip_die>:
+// its children too if `subtree`. Returns where the next DIE starts.
+const void *dwarf_skip_die(const struct Dwarf_Addrs *addrs,
+                           const struct Dwarf_CU *cu,
+                           const struct Dwarf_Abbrevtab *abbrevs,
+                           const struct Dwarf_Abbrev *ab, const void *entry,
+                           bool subtree) {
+  101e3b:	55                   	push   %ebp
+  101e3c:	89 e5                	mov    %esp,%ebp
+  101e3e:	57                   	push   %edi
+  101e3f:	56                   	push   %esi
+  101e40:	53                   	push   %ebx
+  101e41:	83 ec 1c             	sub    $0x1c,%esp
+  101e44:	8b 75 18             	mov    0x18(%ebp),%esi
+        if (subtree && ab->ab_children && dwarf_skip_subtrees) {
+  101e47:	80 7d 1c 00          	cmpb   $0x0,0x1c(%ebp)
+  101e4b:	74 12                	je     101e5f <dwarf_skip_die+0x24>
+  101e4d:	8b 45 14             	mov    0x14(%ebp),%eax
+  101e50:	80 78 02 00          	cmpb   $0x0,0x2(%eax)
+  101e54:	74 09                	je     101e5f <dwarf_skip_die+0x24>
+  101e56:	80 3d 20 53 11 00 00 	cmpb   $0x0,0x115320
+  101e5d:	75 1b                	jne    101e7a <dwarf_skip_die+0x3f>
+                        return sibling;
+                }
+                entry = dwarf_skip_attrs(ab, entry, cu->cu_address_size);
+                return skip_children(addrs, cu, abbrevs, entry);
+        }
+        return dwarf_skip_attrs(ab, entry, cu->cu_address_size);
+  101e5f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  101e62:	8b 40 18             	mov    0x18(%eax),%eax
+  101e65:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	for (st = ab->ab_steps; st < ab->ab_steps + nsteps; st++) {
+  101e68:	8b 45 14             	mov    0x14(%ebp),%eax
+  101e6b:	8b 58 08             	mov    0x8(%eax),%ebx
+	return dwarf_skip_steps(ab, entry, ab->ab_nsteps, address_size)
+  101e6e:	0f b7 78 0c          	movzwl 0xc(%eax),%edi
+	for (st = ab->ab_steps; st < ab->ab_steps + nsteps; st++) {
+  101e72:	c1 e7 02             	shl    $0x2,%edi
+  101e75:	e9 a5 00 00 00       	jmp    101f1f <dwarf_skip_die+0xe4>
+                const void *sibling = die_sibling(addrs, cu, ab, entry);
+  101e7a:	83 ec 0c             	sub    $0xc,%esp
+  101e7d:	56                   	push   %esi
+  101e7e:	89 c1                	mov    %eax,%ecx
+  101e80:	8b 55 0c             	mov    0xc(%ebp),%edx
+  101e83:	8b 45 08             	mov    0x8(%ebp),%eax
+  101e86:	e8 03 fa ff ff       	call   10188e <die_sibling>
+                if (sibling) {
+  101e8b:	83 c4 10             	add    $0x10,%esp
+  101e8e:	85 c0                	test   %eax,%eax
+  101e90:	0f 85 9b 00 00 00    	jne    101f31 <dwarf_skip_die+0xf6>
+                entry = dwarf_skip_attrs(ab, entry, cu->cu_address_size);
+  101e96:	8b 45 0c             	mov    0xc(%ebp),%eax
+  101e99:	8b 40 18             	mov    0x18(%eax),%eax
+  101e9c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  101e9f:	8b 45 14             	mov    0x14(%ebp),%eax
+  101ea2:	8b 58 08             	mov    0x8(%eax),%ebx
+	return dwarf_skip_steps(ab, entry, ab->ab_nsteps, address_size)
+  101ea5:	0f b7 40 0c          	movzwl 0xc(%eax),%eax
+	for (st = ab->ab_steps; st < ab->ab_steps + nsteps; st++) {
+  101ea9:	8d 3c 85 00 00 00 00 	lea    0x0(,%eax,4),%edi
+  101eb0:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  101eb3:	89 f8                	mov    %edi,%eax
+  101eb5:	03 41 08             	add    0x8(%ecx),%eax
+  101eb8:	39 c3                	cmp    %eax,%ebx
+  101eba:	73 24                	jae    101ee0 <dwarf_skip_die+0xa5>
+		entry += st->ss_fixed;
+  101ebc:	0f b7 03             	movzwl (%ebx),%eax
+  101ebf:	01 c6                	add    %eax,%esi
+		entry += dwarf_read_abbrev_entry(entry, st->ss_form, NULL, 0,
+  101ec1:	83 ec 0c             	sub    $0xc,%esp
+  101ec4:	ff 75 e4             	push   -0x1c(%ebp)
+  101ec7:	6a 00                	push   $0x0
+  101ec9:	6a 00                	push   $0x0
+  101ecb:	0f b7 43 02          	movzwl 0x2(%ebx),%eax
+  101ecf:	50                   	push   %eax
+  101ed0:	56                   	push   %esi
+  101ed1:	e8 d9 e9 ff ff       	call   1008af <dwarf_read_abbrev_entry>
+  101ed6:	01 c6                	add    %eax,%esi
+	for (st = ab->ab_steps; st < ab->ab_steps + nsteps; st++) {
+  101ed8:	83 c3 04             	add    $0x4,%ebx
+  101edb:	83 c4 20             	add    $0x20,%esp
+  101ede:	eb d0                	jmp    101eb0 <dwarf_skip_die+0x75>
+                return skip_children(addrs, cu, abbrevs, entry);
+  101ee0:	83 ec 0c             	sub    $0xc,%esp
+		+ ab->ab_fixed;
+  101ee3:	0f b7 41 0e          	movzwl 0xe(%ecx),%eax
+  101ee7:	01 f0                	add    %esi,%eax
+  101ee9:	50                   	push   %eax
+  101eea:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  101eed:	8b 55 0c             	mov    0xc(%ebp),%edx
+  101ef0:	8b 45 08             	mov    0x8(%ebp),%eax
+  101ef3:	e8 2a fa ff ff       	call   101922 <skip_children>
+  101ef8:	83 c4 10             	add    $0x10,%esp
+  101efb:	eb 34                	jmp    101f31 <dwarf_skip_die+0xf6>
+		entry += st->ss_fixed;
+  101efd:	0f b7 03             	movzwl (%ebx),%eax
+  101f00:	01 c6                	add    %eax,%esi
+		entry += dwarf_read_abbrev_entry(entry, st->ss_form, NULL, 0,
+  101f02:	83 ec 0c             	sub    $0xc,%esp
+  101f05:	ff 75 e4             	push   -0x1c(%ebp)
+  101f08:	6a 00                	push   $0x0
+  101f0a:	6a 00                	push   $0x0
+  101f0c:	0f b7 43 02          	movzwl 0x2(%ebx),%eax
+  101f10:	50                   	push   %eax
+  101f11:	56                   	push   %esi
+  101f12:	e8 98 e9 ff ff       	call   1008af <dwarf_read_abbrev_entry>
+  101f17:	01 c6                	add    %eax,%esi
+	for (st = ab->ab_steps; st < ab->ab_steps + nsteps; st++) {
+  101f19:	83 c3 04             	add    $0x4,%ebx
+  101f1c:	83 c4 20             	add    $0x20,%esp
+  101f1f:	8b 55 14             	mov    0x14(%ebp),%edx
+  101f22:	89 f8                	mov    %edi,%eax
+  101f24:	03 42 08             	add    0x8(%edx),%eax
+  101f27:	39 c3                	cmp    %eax,%ebx
+  101f29:	72 d2                	jb     101efd <dwarf_skip_die+0xc2>
+		+ ab->ab_fixed;
+  101f2b:	0f b7 42 0e          	movzwl 0xe(%edx),%eax
+  101f2f:	01 f0                	add    %esi,%eax
+}
+  101f31:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  101f34:	5b                   	pop    %ebx
+  101f35:	5e                   	pop    %esi
+  101f36:	5f                   	pop    %edi
+  101f37:	5d                   	pop    %ebp
+  101f38:	c3                   	ret
+
+00101f39 <dwarf_inlines_walk>:
+                       void (*fn)(const struct Dwarf_Inline *)) {
+  101f39:	55                   	push   %ebp
+  101f3a:	89 e5                	mov    %esp,%ebp
+  101f3c:	57                   	push   %edi
+  101f3d:	56                   	push   %esi
+  101f3e:	53                   	push   %ebx
+  101f3f:	81 ec ac 00 00 00    	sub    $0xac,%esp
+        const void *entry = cu->cu_dies;
+  101f45:	8b 45 0c             	mov    0xc(%ebp),%eax
+  101f48:	8b 70 04             	mov    0x4(%eax),%esi
+        int level = 0, nopen = 0;
+  101f4b:	c7 85 58 ff ff ff 00 	movl   $0x0,-0xa8(%ebp)
+  101f52:	00 00 00 
+  101f55:	c7 85 60 ff ff ff 00 	movl   $0x0,-0xa0(%ebp)
+  101f5c:	00 00 00 
+        while (entry < (const void *)cu->cu_end) {
+  101f5f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  101f62:	3b 70 08             	cmp    0x8(%eax),%esi
+  101f65:	0f 83 37 04 00 00    	jae    1023a2 <dwarf_inlines_walk+0x469>
+	count = 0;
+  101f6b:	b8 00 00 00 00       	mov    $0x0,%eax
+	result = 0;
+  101f70:	bf 00 00 00 00       	mov    $0x0,%edi
+  101f75:	89 b5 64 ff ff ff    	mov    %esi,-0x9c(%ebp)
+  101f7b:	89 c6                	mov    %eax,%esi
+		byte = *addr;
+  101f7d:	8b 9d 64 ff ff ff    	mov    -0x9c(%ebp),%ebx
+  101f83:	0f b6 1c 03          	movzbl (%ebx,%eax,1),%ebx
+		count++;
+  101f87:	83 c0 01             	add    $0x1,%eax
+		result |= (byte & 0x7f) << shift;
+  101f8a:	89 da                	mov    %ebx,%edx
+  101f8c:	83 e2 7f             	and    $0x7f,%edx
+  101f8f:	8d 0c f5 00 00 00 00 	lea    0x0(,%esi,8),%ecx
+  101f96:	29 f1                	sub    %esi,%ecx
+  101f98:	d3 e2                	shl    %cl,%edx
+  101f9a:	09 d7                	or     %edx,%edi
+		if (!(byte & 0x80))
+  101f9c:	84 db                	test   %bl,%bl
+  101f9e:	78 db                	js     101f7b <dwarf_inlines_walk+0x42>
+                entry += dwarf_read_uleb128(entry, &code);
+  101fa0:	8b b5 64 ff ff ff    	mov    -0x9c(%ebp),%esi
+  101fa6:	01 c6                	add    %eax,%esi
+                if (code == 0) {
+  101fa8:	85 ff                	test   %edi,%edi
+  101faa:	0f 84 8a 00 00 00    	je     10203a <dwarf_inlines_walk+0x101>
+	if (code >= at->at_ncodes || !at->at_abbrevs[code].ab_attrs)
+  101fb0:	8b 45 10             	mov    0x10(%ebp),%eax
+  101fb3:	3b 78 08             	cmp    0x8(%eax),%edi
+  101fb6:	0f 83 ba 00 00 00    	jae    102076 <dwarf_inlines_walk+0x13d>
+  101fbc:	8d 14 bf             	lea    (%edi,%edi,4),%edx
+  101fbf:	8b 40 0c             	mov    0xc(%eax),%eax
+  101fc2:	8d 04 90             	lea    (%eax,%edx,4),%eax
+  101fc5:	89 85 5c ff ff ff    	mov    %eax,-0xa4(%ebp)
+  101fcb:	83 78 04 00          	cmpl   $0x0,0x4(%eax)
+  101fcf:	0f 84 a1 00 00 00    	je     102076 <dwarf_inlines_walk+0x13d>
+                if (ab->ab_tag != DW_TAG_inlined_subroutine) {
+  101fd5:	0f b7 00             	movzwl (%eax),%eax
+  101fd8:	66 83 f8 1d          	cmp    $0x1d,%ax
+  101fdc:	0f 84 f4 00 00 00    	je     1020d6 <dwarf_inlines_walk+0x19d>
+                        bool subtree = !dwarf_tag_has_code(ab->ab_tag);
+  101fe2:	66 83 f8 1e          	cmp    $0x1e,%ax
+  101fe6:	0f 87 97 00 00 00    	ja     102083 <dwarf_inlines_walk+0x14a>
+  101fec:	66 83 f8 0a          	cmp    $0xa,%ax
+  101ff0:	0f 86 a4 00 00 00    	jbe    10209a <dwarf_inlines_walk+0x161>
+  101ff6:	ba 00 08 02 60       	mov    $0x60020800,%edx
+  101ffb:	0f a3 c2             	bt     %eax,%edx
+  101ffe:	0f 83 96 00 00 00    	jae    10209a <dwarf_inlines_walk+0x161>
+                        entry = dwarf_skip_die(addrs, cu, abbrevs, ab, entry,
+  102004:	83 ec 08             	sub    $0x8,%esp
+  102007:	6a 00                	push   $0x0
+  102009:	56                   	push   %esi
+  10200a:	8b bd 5c ff ff ff    	mov    -0xa4(%ebp),%edi
+  102010:	57                   	push   %edi
+  102011:	ff 75 10             	push   0x10(%ebp)
+  102014:	ff 75 0c             	push   0xc(%ebp)
+  102017:	ff 75 08             	push   0x8(%ebp)
+  10201a:	e8 1c fe ff ff       	call   101e3b <dwarf_skip_die>
+  10201f:	89 c6                	mov    %eax,%esi
+                        if (ab->ab_children &&
+  102021:	83 c4 20             	add    $0x20,%esp
+  102024:	80 7f 02 00          	cmpb   $0x0,0x2(%edi)
+  102028:	0f 84 31 ff ff ff    	je     101f5f <dwarf_inlines_walk+0x26>
+                                level++;
+  10202e:	83 85 60 ff ff ff 01 	addl   $0x1,-0xa0(%ebp)
+  102035:	e9 25 ff ff ff       	jmp    101f5f <dwarf_inlines_walk+0x26>
+                        if (--level < 0) {
+  10203a:	83 ad 60 ff ff ff 01 	subl   $0x1,-0xa0(%ebp)
+  102041:	8b 8d 60 ff ff ff    	mov    -0xa0(%ebp),%ecx
+  102047:	79 07                	jns    102050 <dwarf_inlines_walk+0x117>
+        return 0;
+  102049:	b8 00 00 00 00       	mov    $0x0,%eax
+  10204e:	eb 2b                	jmp    10207b <dwarf_inlines_walk+0x142>
+  102050:	8b 85 58 ff ff ff    	mov    -0xa8(%ebp),%eax
+  102056:	eb 02                	jmp    10205a <dwarf_inlines_walk+0x121>
+                                nopen--;
+  102058:	89 d0                	mov    %edx,%eax
+                        while (nopen > 0 && open[nopen - 1] >= level) {
+  10205a:	85 c0                	test   %eax,%eax
+  10205c:	0f 8e 35 03 00 00    	jle    102397 <dwarf_inlines_walk+0x45e>
+  102062:	8d 50 ff             	lea    -0x1(%eax),%edx
+  102065:	39 4c 85 a4          	cmp    %ecx,-0x5c(%ebp,%eax,4)
+  102069:	7d ed                	jge    102058 <dwarf_inlines_walk+0x11f>
+  10206b:	89 85 58 ff ff ff    	mov    %eax,-0xa8(%ebp)
+  102071:	e9 e9 fe ff ff       	jmp    101f5f <dwarf_inlines_walk+0x26>
+                        return -E_BAD_DWARF;
+  102076:	b8 fa ff ff ff       	mov    $0xfffffffa,%eax
+}
+  10207b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  10207e:	5b                   	pop    %ebx
+  10207f:	5e                   	pop    %esi
+  102080:	5f                   	pop    %edi
+  102081:	5d                   	pop    %ebp
+  102082:	c3                   	ret
+  102083:	83 e8 2e             	sub    $0x2e,%eax
+  102086:	66 83 f8 0e          	cmp    $0xe,%ax
+  10208a:	77 0e                	ja     10209a <dwarf_inlines_walk+0x161>
+  10208c:	ba 01 48 00 00       	mov    $0x4801,%edx
+  102091:	0f a3 c2             	bt     %eax,%edx
+  102094:	0f 82 6a ff ff ff    	jb     102004 <dwarf_inlines_walk+0xcb>
+                        entry = dwarf_skip_die(addrs, cu, abbrevs, ab, entry,
+  10209a:	83 ec 08             	sub    $0x8,%esp
+  10209d:	6a 01                	push   $0x1
+  10209f:	56                   	push   %esi
+  1020a0:	8b bd 5c ff ff ff    	mov    -0xa4(%ebp),%edi
+  1020a6:	57                   	push   %edi
+  1020a7:	ff 75 10             	push   0x10(%ebp)
+  1020aa:	ff 75 0c             	push   0xc(%ebp)
+  1020ad:	ff 75 08             	push   0x8(%ebp)
+  1020b0:	e8 86 fd ff ff       	call   101e3b <dwarf_skip_die>
+  1020b5:	89 c6                	mov    %eax,%esi
+                        if (ab->ab_children &&
+  1020b7:	83 c4 20             	add    $0x20,%esp
+  1020ba:	80 7f 02 00          	cmpb   $0x0,0x2(%edi)
+  1020be:	0f 84 9b fe ff ff    	je     101f5f <dwarf_inlines_walk+0x26>
+                            !(subtree && dwarf_skip_subtrees)) {
+  1020c4:	80 3d 20 53 11 00 00 	cmpb   $0x0,0x115320
+  1020cb:	0f 85 8e fe ff ff    	jne    101f5f <dwarf_inlines_walk+0x26>
+  1020d1:	e9 58 ff ff ff       	jmp    10202e <dwarf_inlines_walk+0xf5>
+                struct Dwarf_Inline in = {0};
+  1020d6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  1020db:	ba 1c 00 00 00       	mov    $0x1c,%edx
+  1020e0:	b8 00 00 00 00       	mov    $0x0,%eax
+  1020e5:	89 4c 05 8c          	mov    %ecx,-0x74(%ebp,%eax,1)
+  1020e9:	83 c0 04             	add    $0x4,%eax
+  1020ec:	39 d0                	cmp    %edx,%eax
+  1020ee:	72 f5                	jb     1020e5 <dwarf_inlines_walk+0x1ac>
+                unsigned file = 0;
+  1020f0:	c7 85 70 ff ff ff 00 	movl   $0x0,-0x90(%ebp)
+  1020f7:	00 00 00 
+                rg.rg_next = NULL;
+  1020fa:	c7 45 80 00 00 00 00 	movl   $0x0,-0x80(%ebp)
+                for (attr = ab->ab_attrs; attr->as_name || attr->as_form;
+  102101:	8b 85 5c ff ff ff    	mov    -0xa4(%ebp),%eax
+  102107:	8b 58 04             	mov    0x4(%eax),%ebx
+                const struct Dwarf_Attrspec *attr, *high = NULL;
+  10210a:	ba 00 00 00 00       	mov    $0x0,%edx
+                bool has_low = 0;
+  10210f:	c6 85 4b ff ff ff 00 	movb   $0x0,-0xb5(%ebp)
+                const void *origin = NULL, *high_entry = NULL;
+  102116:	c7 85 4c ff ff ff 00 	movl   $0x0,-0xb4(%ebp)
+  10211d:	00 00 00 
+  102120:	c7 85 50 ff ff ff 00 	movl   $0x0,-0xb0(%ebp)
+  102127:	00 00 00 
+  10212a:	89 95 54 ff ff ff    	mov    %edx,-0xac(%ebp)
+                for (attr = ab->ab_attrs; attr->as_name || attr->as_form;
+  102130:	e9 a1 00 00 00       	jmp    1021d6 <dwarf_inlines_walk+0x29d>
+                                origin = dwarf_read_ref(addrs, cu, form, entry);
+  102135:	56                   	push   %esi
+  102136:	50                   	push   %eax
+  102137:	ff 75 0c             	push   0xc(%ebp)
+  10213a:	ff 75 08             	push   0x8(%ebp)
+  10213d:	e8 73 f5 ff ff       	call   1016b5 <dwarf_read_ref>
+  102142:	89 85 50 ff ff ff    	mov    %eax,-0xb0(%ebp)
+  102148:	83 c4 10             	add    $0x10,%esp
+  10214b:	eb 68                	jmp    1021b5 <dwarf_inlines_walk+0x27c>
+                                in.in_low = dwarf_read_address(addrs, cu, form,
+  10214d:	56                   	push   %esi
+  10214e:	ff b5 64 ff ff ff    	push   -0x9c(%ebp)
+  102154:	ff 75 0c             	push   0xc(%ebp)
+  102157:	ff 75 08             	push   0x8(%ebp)
+  10215a:	e8 00 f1 ff ff       	call   10125f <dwarf_read_address>
+  10215f:	89 45 8c             	mov    %eax,-0x74(%ebp)
+                                has_low = 1;
+  102162:	83 c4 10             	add    $0x10,%esp
+  102165:	c6 85 4b ff ff ff 01 	movb   $0x1,-0xb5(%ebp)
+  10216c:	eb 47                	jmp    1021b5 <dwarf_inlines_walk+0x27c>
+                                dwarf_read_ranges(addrs, cu, form, entry, &rg);
+  10216e:	83 ec 0c             	sub    $0xc,%esp
+  102171:	8d 85 78 ff ff ff    	lea    -0x88(%ebp),%eax
+  102177:	50                   	push   %eax
+  102178:	56                   	push   %esi
+  102179:	ff b5 64 ff ff ff    	push   -0x9c(%ebp)
+  10217f:	ff 75 0c             	push   0xc(%ebp)
+  102182:	ff 75 08             	push   0x8(%ebp)
+  102185:	e8 c1 f8 ff ff       	call   101a4b <dwarf_read_ranges>
+  10218a:	83 c4 20             	add    $0x20,%esp
+  10218d:	eb 26                	jmp    1021b5 <dwarf_inlines_walk+0x27c>
+                                        value = attr->as_const;
+  10218f:	8b 43 04             	mov    0x4(%ebx),%eax
+  102192:	89 85 74 ff ff ff    	mov    %eax,-0x8c(%ebp)
+  102198:	e9 af 00 00 00       	jmp    10224c <dwarf_inlines_walk+0x313>
+                                        in.in_call_file = value;
+  10219d:	8b 85 74 ff ff ff    	mov    -0x8c(%ebp),%eax
+  1021a3:	66 89 45 9c          	mov    %ax,-0x64(%ebp)
+  1021a7:	eb 0c                	jmp    1021b5 <dwarf_inlines_walk+0x27c>
+                                high = attr;
+  1021a9:	89 9d 54 ff ff ff    	mov    %ebx,-0xac(%ebp)
+  1021af:	89 b5 4c ff ff ff    	mov    %esi,-0xb4(%ebp)
+                        entry += dwarf_read_abbrev_entry(entry, form, NULL, 0,
+  1021b5:	83 ec 0c             	sub    $0xc,%esp
+  1021b8:	8b 45 0c             	mov    0xc(%ebp),%eax
+  1021bb:	ff 70 18             	push   0x18(%eax)
+  1021be:	6a 00                	push   $0x0
+  1021c0:	6a 00                	push   $0x0
+  1021c2:	ff b5 64 ff ff ff    	push   -0x9c(%ebp)
+  1021c8:	56                   	push   %esi
+  1021c9:	e8 e1 e6 ff ff       	call   1008af <dwarf_read_abbrev_entry>
+  1021ce:	01 c6                	add    %eax,%esi
+                     attr++) {
+  1021d0:	83 c3 08             	add    $0x8,%ebx
+  1021d3:	83 c4 20             	add    $0x20,%esp
+                for (attr = ab->ab_attrs; attr->as_name || attr->as_form;
+  1021d6:	83 3b 00             	cmpl   $0x0,(%ebx)
+  1021d9:	0f 84 84 00 00 00    	je     102263 <dwarf_inlines_walk+0x32a>
+                        unsigned name = attr->as_name, form = attr->as_form;
+  1021df:	0f b7 3b             	movzwl (%ebx),%edi
+  1021e2:	0f b7 43 02          	movzwl 0x2(%ebx),%eax
+  1021e6:	89 85 64 ff ff ff    	mov    %eax,-0x9c(%ebp)
+                        uint32_t value = 0;
+  1021ec:	c7 85 74 ff ff ff 00 	movl   $0x0,-0x8c(%ebp)
+  1021f3:	00 00 00 
+                        if (name == DW_AT_abstract_origin) {
+  1021f6:	83 ff 31             	cmp    $0x31,%edi
+  1021f9:	0f 84 36 ff ff ff    	je     102135 <dwarf_inlines_walk+0x1fc>
+                        } else if (name == DW_AT_low_pc) {
+  1021ff:	83 ff 11             	cmp    $0x11,%edi
+  102202:	0f 84 45 ff ff ff    	je     10214d <dwarf_inlines_walk+0x214>
+                        } else if (name == DW_AT_high_pc) {
+  102208:	83 ff 12             	cmp    $0x12,%edi
+  10220b:	74 9c                	je     1021a9 <dwarf_inlines_walk+0x270>
+                        } else if (name == DW_AT_ranges) {
+  10220d:	83 ff 55             	cmp    $0x55,%edi
+  102210:	0f 84 58 ff ff ff    	je     10216e <dwarf_inlines_walk+0x235>
+                        } else if (name == DW_AT_call_file ||
+  102216:	8d 47 a8             	lea    -0x58(%edi),%eax
+  102219:	83 f8 01             	cmp    $0x1,%eax
+  10221c:	77 97                	ja     1021b5 <dwarf_inlines_walk+0x27c>
+                                dwarf_read_abbrev_entry(entry, form, &value,
+  10221e:	83 ec 0c             	sub    $0xc,%esp
+  102221:	8b 45 0c             	mov    0xc(%ebp),%eax
+  102224:	ff 70 18             	push   0x18(%eax)
+  102227:	6a 04                	push   $0x4
+  102229:	8d 85 74 ff ff ff    	lea    -0x8c(%ebp),%eax
+  10222f:	50                   	push   %eax
+  102230:	ff b5 64 ff ff ff    	push   -0x9c(%ebp)
+  102236:	56                   	push   %esi
+  102237:	e8 73 e6 ff ff       	call   1008af <dwarf_read_abbrev_entry>
+                                if (form == DW_FORM_implicit_const) {
+  10223c:	83 c4 20             	add    $0x20,%esp
+  10223f:	83 bd 64 ff ff ff 21 	cmpl   $0x21,-0x9c(%ebp)
+  102246:	0f 84 43 ff ff ff    	je     10218f <dwarf_inlines_walk+0x256>
+                                if (name == DW_AT_call_file) {
+  10224c:	83 ff 58             	cmp    $0x58,%edi
+  10224f:	0f 84 48 ff ff ff    	je     10219d <dwarf_inlines_walk+0x264>
+                                        in.in_call_line = value;
+  102255:	8b 85 74 ff ff ff    	mov    -0x8c(%ebp),%eax
+  10225b:	89 45 a0             	mov    %eax,-0x60(%ebp)
+  10225e:	e9 52 ff ff ff       	jmp    1021b5 <dwarf_inlines_walk+0x27c>
+                if (high) {
+  102263:	8b 95 54 ff ff ff    	mov    -0xac(%ebp),%edx
+  102269:	85 d2                	test   %edx,%edx
+  10226b:	74 1e                	je     10228b <dwarf_inlines_walk+0x352>
+                        in.in_high = dwarf_read_high_pc(addrs, cu, high,
+  10226d:	83 ec 0c             	sub    $0xc,%esp
+  102270:	ff 75 8c             	push   -0x74(%ebp)
+  102273:	ff b5 4c ff ff ff    	push   -0xb4(%ebp)
+  102279:	52                   	push   %edx
+  10227a:	ff 75 0c             	push   0xc(%ebp)
+  10227d:	ff 75 08             	push   0x8(%ebp)
+  102280:	e8 ba f3 ff ff       	call   10163f <dwarf_read_high_pc>
+  102285:	89 45 90             	mov    %eax,-0x70(%ebp)
+  102288:	83 c4 20             	add    $0x20,%esp
+                if (origin) {
+  10228b:	8b bd 50 ff ff ff    	mov    -0xb0(%ebp),%edi
+  102291:	85 ff                	test   %edi,%edi
+  102293:	74 2a                	je     1022bf <dwarf_inlines_walk+0x386>
+                        die_origin(addrs, cu, abbrevs, origin, &in.in_name,
+  102295:	83 ec 04             	sub    $0x4,%esp
+  102298:	8d 85 70 ff ff ff    	lea    -0x90(%ebp),%eax
+  10229e:	50                   	push   %eax
+  10229f:	8d 45 94             	lea    -0x6c(%ebp),%eax
+  1022a2:	50                   	push   %eax
+  1022a3:	57                   	push   %edi
+  1022a4:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  1022a7:	8b 55 0c             	mov    0xc(%ebp),%edx
+  1022aa:	8b 45 08             	mov    0x8(%ebp),%eax
+  1022ad:	e8 6e f4 ff ff       	call   101720 <die_origin>
+                        in.in_decl_file = file;
+  1022b2:	8b 85 70 ff ff ff    	mov    -0x90(%ebp),%eax
+  1022b8:	66 89 45 9a          	mov    %ax,-0x66(%ebp)
+  1022bc:	83 c4 10             	add    $0x10,%esp
+                in.in_namelen = in.in_name ? strlen(in.in_name) : 0;
+  1022bf:	8b 55 94             	mov    -0x6c(%ebp),%edx
+  1022c2:	b8 00 00 00 00       	mov    $0x0,%eax
+  1022c7:	85 d2                	test   %edx,%edx
+  1022c9:	74 0c                	je     1022d7 <dwarf_inlines_walk+0x39e>
+  1022cb:	83 ec 0c             	sub    $0xc,%esp
+  1022ce:	52                   	push   %edx
+  1022cf:	e8 01 6d 00 00       	call   108fd5 <strlen>
+  1022d4:	83 c4 10             	add    $0x10,%esp
+  1022d7:	66 89 45 9e          	mov    %ax,-0x62(%ebp)
+                in.in_depth = nopen;
+  1022db:	8b 85 58 ff ff ff    	mov    -0xa8(%ebp),%eax
+  1022e1:	66 89 45 98          	mov    %ax,-0x68(%ebp)
+                in.in_parent = -1;
+  1022e5:	c7 45 a4 ff ff ff ff 	movl   $0xffffffff,-0x5c(%ebp)
+                if (nopen < DWARF_MAXINLINE) {
+  1022ec:	83 f8 0f             	cmp    $0xf,%eax
+  1022ef:	7e 1c                	jle    10230d <dwarf_inlines_walk+0x3d4>
+                if (ab->ab_children) {
+  1022f1:	8b 85 5c ff ff ff    	mov    -0xa4(%ebp),%eax
+  1022f7:	80 78 02 00          	cmpb   $0x0,0x2(%eax)
+  1022fb:	0f 84 5e fc ff ff    	je     101f5f <dwarf_inlines_walk+0x26>
+                        level++;
+  102301:	83 85 60 ff ff ff 01 	addl   $0x1,-0xa0(%ebp)
+  102308:	e9 52 fc ff ff       	jmp    101f5f <dwarf_inlines_walk+0x26>
+                        if (has_low && in.in_low < in.in_high) {
+  10230d:	80 bd 4b ff ff ff 00 	cmpb   $0x0,-0xb5(%ebp)
+  102314:	74 15                	je     10232b <dwarf_inlines_walk+0x3f2>
+  102316:	8b 45 90             	mov    -0x70(%ebp),%eax
+  102319:	39 45 8c             	cmp    %eax,-0x74(%ebp)
+  10231c:	73 0d                	jae    10232b <dwarf_inlines_walk+0x3f2>
+                                fn(&in);
+  10231e:	83 ec 0c             	sub    $0xc,%esp
+  102321:	8d 45 8c             	lea    -0x74(%ebp),%eax
+  102324:	50                   	push   %eax
+  102325:	ff 55 14             	call   *0x14(%ebp)
+  102328:	83 c4 10             	add    $0x10,%esp
+                        while (rg.rg_next && dwarf_ranges_next(&rg, &in.in_low,
+  10232b:	8d 5d 8c             	lea    -0x74(%ebp),%ebx
+  10232e:	8d 7d 90             	lea    -0x70(%ebp),%edi
+  102331:	89 b5 64 ff ff ff    	mov    %esi,-0x9c(%ebp)
+  102337:	8b 75 14             	mov    0x14(%ebp),%esi
+  10233a:	83 7d 80 00          	cmpl   $0x0,-0x80(%ebp)
+  10233e:	74 23                	je     102363 <dwarf_inlines_walk+0x42a>
+  102340:	83 ec 04             	sub    $0x4,%esp
+  102343:	57                   	push   %edi
+  102344:	53                   	push   %ebx
+  102345:	8d 85 78 ff ff ff    	lea    -0x88(%ebp),%eax
+  10234b:	50                   	push   %eax
+  10234c:	e8 ae f7 ff ff       	call   101aff <dwarf_ranges_next>
+  102351:	83 c4 10             	add    $0x10,%esp
+  102354:	84 c0                	test   %al,%al
+  102356:	74 0b                	je     102363 <dwarf_inlines_walk+0x42a>
+                                fn(&in);
+  102358:	83 ec 0c             	sub    $0xc,%esp
+  10235b:	53                   	push   %ebx
+  10235c:	ff d6                	call   *%esi
+  10235e:	83 c4 10             	add    $0x10,%esp
+  102361:	eb d7                	jmp    10233a <dwarf_inlines_walk+0x401>
+                if (ab->ab_children) {
+  102363:	8b b5 64 ff ff ff    	mov    -0x9c(%ebp),%esi
+  102369:	8b 85 5c ff ff ff    	mov    -0xa4(%ebp),%eax
+  10236f:	80 78 02 00          	cmpb   $0x0,0x2(%eax)
+  102373:	0f 84 e6 fb ff ff    	je     101f5f <dwarf_inlines_walk+0x26>
+                                open[nopen++] = level;
+  102379:	8b 85 58 ff ff ff    	mov    -0xa8(%ebp),%eax
+  10237f:	8b bd 60 ff ff ff    	mov    -0xa0(%ebp),%edi
+  102385:	89 7c 85 a8          	mov    %edi,-0x58(%ebp,%eax,4)
+  102389:	8d 40 01             	lea    0x1(%eax),%eax
+  10238c:	89 85 58 ff ff ff    	mov    %eax,-0xa8(%ebp)
+  102392:	e9 6a ff ff ff       	jmp    102301 <dwarf_inlines_walk+0x3c8>
+  102397:	89 85 58 ff ff ff    	mov    %eax,-0xa8(%ebp)
+  10239d:	e9 bd fb ff ff       	jmp    101f5f <dwarf_inlines_walk+0x26>
+        return 0;
+  1023a2:	b8 00 00 00 00       	mov    $0x0,%eax
+  1023a7:	e9 cf fc ff ff       	jmp    10207b <dwarf_inlines_walk+0x142>
+
+001023ac <dwarf_skip_subtree>:
+// they have one.
+const void *dwarf_skip_subtree(const struct Dwarf_Addrs *addrs,
+                               const struct Dwarf_CU *cu,
+                               const struct Dwarf_Abbrevtab *abbrevs,
+                               const struct Dwarf_Abbrev *ab,
+                               const void *entry, const void *sibling) {
+  1023ac:	55                   	push   %ebp
+  1023ad:	89 e5                	mov    %esp,%ebp
+  1023af:	83 ec 08             	sub    $0x8,%esp
+  1023b2:	8b 45 18             	mov    0x18(%ebp),%eax
+        if (!ab->ab_children || !dwarf_skip_subtrees) {
+  1023b5:	8b 55 14             	mov    0x14(%ebp),%edx
+  1023b8:	80 7a 02 00          	cmpb   $0x0,0x2(%edx)
+  1023bc:	74 11                	je     1023cf <dwarf_skip_subtree+0x23>
+  1023be:	80 3d 20 53 11 00 00 	cmpb   $0x0,0x115320
+  1023c5:	74 08                	je     1023cf <dwarf_skip_subtree+0x23>
+                return entry;
+        }
+        // A sibling always comes after the DIE's attributes.
+        if (sibling > entry) {
+  1023c7:	3b 45 1c             	cmp    0x1c(%ebp),%eax
+  1023ca:	73 05                	jae    1023d1 <dwarf_skip_subtree+0x25>
+                return sibling;
+  1023cc:	8b 45 1c             	mov    0x1c(%ebp),%eax
+        }
+        return skip_children(addrs, cu, abbrevs, entry);
+}
+  1023cf:	c9                   	leave
+  1023d0:	c3                   	ret
+        return skip_children(addrs, cu, abbrevs, entry);
+  1023d1:	83 ec 0c             	sub    $0xc,%esp
+  1023d4:	50                   	push   %eax
+  1023d5:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  1023d8:	8b 55 0c             	mov    0xc(%ebp),%edx
+  1023db:	8b 45 08             	mov    0x8(%ebp),%eax
+  1023de:	e8 3f f5 ff ff       	call   101922 <skip_children>
+  1023e3:	83 c4 10             	add    $0x10,%esp
+  1023e6:	eb e7                	jmp    1023cf <dwarf_skip_subtree+0x23>
+
+001023e8 <info_by_address>:
+        }
+        return 0;
+}
+
+int info_by_address(const struct Dwarf_Addrs *addrs, uintptr_t p,
+                    Dwarf_Off *store) {
+  1023e8:	55                   	push   %ebp
+  1023e9:	89 e5                	mov    %esp,%ebp
+  1023eb:	57                   	push   %edi
+  1023ec:	56                   	push   %esi
+  1023ed:	53                   	push   %ebx
+  1023ee:	83 ec 40             	sub    $0x40,%esp
+  1023f1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+        int code = dwarf_need(DWARF_ARANGES | DWARF_DIES);
+        if (code < 0) {
+                return code;
+        }
+        code = dwarf_aranges_lookup(addrs, p, store);
+  1023f4:	ff 75 10             	push   0x10(%ebp)
+  1023f7:	ff 75 0c             	push   0xc(%ebp)
+  1023fa:	53                   	push   %ebx
+  1023fb:	e8 46 32 00 00       	call   105646 <dwarf_aranges_lookup>
+        if (code < 0) {
+  102400:	83 c4 10             	add    $0x10,%esp
+  102403:	85 c0                	test   %eax,%eax
+  102405:	78 55                	js     10245c <info_by_address+0x74>
+                code = info_by_address_debug_info(addrs, p, store);
+        }
+        return code;
+}
+  102407:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  10240a:	5b                   	pop    %ebx
+  10240b:	5e                   	pop    %esi
+  10240c:	5f                   	pop    %edi
+  10240d:	5d                   	pop    %ebp
+  10240e:	c3                   	ret
+                        assert(abbrev->ab_tag == DW_TAG_compile_unit ||
+  10240f:	68 e0 99 10 00       	push   $0x1099e0
+  102414:	68 00 95 10 00       	push   $0x109500
+  102419:	68 93 03 00 00       	push   $0x393
+  10241e:	68 59 98 10 00       	push   $0x109859
+  102423:	e8 5f dc ff ff       	call   100087 <_panic>
+                                dwarf_read_ranges(addrs, &ci->ci_cu,
+  102428:	83 ec 0c             	sub    $0xc,%esp
+  10242b:	8d 4d d4             	lea    -0x2c(%ebp),%ecx
+  10242e:	51                   	push   %ecx
+  10242f:	ff 70 54             	push   0x54(%eax)
+  102432:	52                   	push   %edx
+  102433:	83 c0 08             	add    $0x8,%eax
+  102436:	50                   	push   %eax
+  102437:	53                   	push   %ebx
+  102438:	e8 0e f6 ff ff       	call   101a4b <dwarf_read_ranges>
+                                found = dwarf_ranges_find(&rg, p, &low);
+  10243d:	83 c4 1c             	add    $0x1c,%esp
+  102440:	8d 45 d0             	lea    -0x30(%ebp),%eax
+  102443:	50                   	push   %eax
+  102444:	ff 75 0c             	push   0xc(%ebp)
+  102447:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+  10244a:	50                   	push   %eax
+  10244b:	e8 6c f9 ff ff       	call   101dbc <dwarf_ranges_find>
+                        if (found) {
+  102450:	83 c4 10             	add    $0x10,%esp
+  102453:	84 c0                	test   %al,%al
+  102455:	74 1f                	je     102476 <info_by_address+0x8e>
+  102457:	e9 96 00 00 00       	jmp    1024f2 <info_by_address+0x10a>
+        Dwarf_Off offset = 0;
+  10245c:	be 00 00 00 00       	mov    $0x0,%esi
+  102461:	bf 00 00 00 00       	mov    $0x0,%edi
+  102466:	eb 1c                	jmp    102484 <info_by_address+0x9c>
+        return 0;
+  102468:	b8 00 00 00 00       	mov    $0x0,%eax
+        return code;
+  10246d:	eb 98                	jmp    102407 <info_by_address+0x1f>
+                        if (ci->ci_ranges_form) {
+  10246f:	8b 50 50             	mov    0x50(%eax),%edx
+  102472:	85 d2                	test   %edx,%edx
+  102474:	75 b2                	jne    102428 <info_by_address+0x40>
+                offset = (const unsigned char *)ci->ci_cu.cu_end -
+  102476:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  102479:	8b 70 10             	mov    0x10(%eax),%esi
+  10247c:	2b 73 10             	sub    0x10(%ebx),%esi
+  10247f:	89 f7                	mov    %esi,%edi
+  102481:	c1 ff 1f             	sar    $0x1f,%edi
+        while (offset < addrs->info_end - addrs->info_begin) {
+  102484:	8b 4b 14             	mov    0x14(%ebx),%ecx
+  102487:	2b 4b 10             	sub    0x10(%ebx),%ecx
+  10248a:	89 c8                	mov    %ecx,%eax
+  10248c:	99                   	cltd
+  10248d:	39 ce                	cmp    %ecx,%esi
+  10248f:	89 f9                	mov    %edi,%ecx
+  102491:	19 d1                	sbb    %edx,%ecx
+  102493:	73 d3                	jae    102468 <info_by_address+0x80>
+                int code = dwarf_cu_get(addrs, offset, &ci);
+  102495:	8d 45 cc             	lea    -0x34(%ebp),%eax
+  102498:	50                   	push   %eax
+  102499:	57                   	push   %edi
+  10249a:	56                   	push   %esi
+  10249b:	53                   	push   %ebx
+  10249c:	e8 50 46 00 00       	call   106af1 <dwarf_cu_get>
+                if (code < 0) {
+  1024a1:	83 c4 10             	add    $0x10,%esp
+  1024a4:	85 c0                	test   %eax,%eax
+  1024a6:	0f 88 5b ff ff ff    	js     102407 <info_by_address+0x1f>
+                const struct Dwarf_Abbrev *abbrev = ci->ci_abbrev;
+  1024ac:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  1024af:	8b 50 38             	mov    0x38(%eax),%edx
+                if (abbrev) {
+  1024b2:	85 d2                	test   %edx,%edx
+  1024b4:	74 c0                	je     102476 <info_by_address+0x8e>
+                        assert(abbrev->ab_tag == DW_TAG_compile_unit ||
+  1024b6:	0f b7 12             	movzwl (%edx),%edx
+  1024b9:	66 83 fa 11          	cmp    $0x11,%dx
+  1024bd:	0f 95 45 c7          	setne  -0x39(%ebp)
+  1024c1:	66 83 fa 3c          	cmp    $0x3c,%dx
+  1024c5:	0f 95 c1             	setne  %cl
+  1024c8:	84 4d c7             	test   %cl,-0x39(%ebp)
+  1024cb:	74 0a                	je     1024d7 <info_by_address+0xef>
+  1024cd:	66 83 fa 41          	cmp    $0x41,%dx
+  1024d1:	0f 85 38 ff ff ff    	jne    10240f <info_by_address+0x27>
+                        bool found = p >= ci->ci_low_pc && p <= ci->ci_high_pc;
+  1024d7:	8b 50 48             	mov    0x48(%eax),%edx
+  1024da:	39 55 0c             	cmp    %edx,0xc(%ebp)
+  1024dd:	72 90                	jb     10246f <info_by_address+0x87>
+                        if (ci->ci_ranges_form) {
+  1024df:	8b 50 50             	mov    0x50(%eax),%edx
+  1024e2:	85 d2                	test   %edx,%edx
+  1024e4:	0f 85 3e ff ff ff    	jne    102428 <info_by_address+0x40>
+                        if (found) {
+  1024ea:	8b 55 0c             	mov    0xc(%ebp),%edx
+  1024ed:	39 50 4c             	cmp    %edx,0x4c(%eax)
+  1024f0:	72 84                	jb     102476 <info_by_address+0x8e>
+                                *store = offset;
+  1024f2:	8b 45 10             	mov    0x10(%ebp),%eax
+  1024f5:	89 30                	mov    %esi,(%eax)
+  1024f7:	89 78 04             	mov    %edi,0x4(%eax)
+                                return 0;
+  1024fa:	b8 00 00 00 00       	mov    $0x0,%eax
+  1024ff:	e9 03 ff ff ff       	jmp    102407 <info_by_address+0x1f>
+
+00102504 <file_name_by_info>:
+
+int file_name_by_info(const struct Dwarf_Addrs *addrs, Dwarf_Off offset,
+                      char *buf, int buflen, Dwarf_Off *line_off) {
+  102504:	55                   	push   %ebp
+  102505:	89 e5                	mov    %esp,%ebp
+  102507:	57                   	push   %edi
+  102508:	56                   	push   %esi
+  102509:	53                   	push   %ebx
+  10250a:	83 ec 1c             	sub    $0x1c,%esp
+  10250d:	8b 7d 08             	mov    0x8(%ebp),%edi
+  102510:	8b 45 0c             	mov    0xc(%ebp),%eax
+  102513:	8b 55 10             	mov    0x10(%ebp),%edx
+        if (dwarf_need(DWARF_DIES) < 0) {
+                return -E_BAD_DWARF;
+        }
+        if (offset > addrs->info_end - addrs->info_begin) {
+  102516:	8b 77 14             	mov    0x14(%edi),%esi
+  102519:	2b 77 10             	sub    0x10(%edi),%esi
+  10251c:	89 f3                	mov    %esi,%ebx
+  10251e:	c1 fb 1f             	sar    $0x1f,%ebx
+  102521:	39 c6                	cmp    %eax,%esi
+  102523:	19 d3                	sbb    %edx,%ebx
+  102525:	0f 82 ac 00 00 00    	jb     1025d7 <file_name_by_info+0xd3>
+                return -E_INVAL;
+        }
+
+        // The CU cache has read the unit's DIE.
+        struct Dwarf_Cuinfo *ci;
+        int code = dwarf_cu_get(addrs, offset, &ci);
+  10252b:	8d 4d e4             	lea    -0x1c(%ebp),%ecx
+  10252e:	51                   	push   %ecx
+  10252f:	52                   	push   %edx
+  102530:	50                   	push   %eax
+  102531:	57                   	push   %edi
+  102532:	e8 ba 45 00 00       	call   106af1 <dwarf_cu_get>
+        if (code < 0) {
+  102537:	83 c4 10             	add    $0x10,%esp
+  10253a:	85 c0                	test   %eax,%eax
+  10253c:	0f 88 a1 00 00 00    	js     1025e3 <file_name_by_info+0xdf>
+                return code;
+        }
+        assert(ci->ci_abbrev != NULL);
+  102542:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  102545:	8b 50 38             	mov    0x38(%eax),%edx
+  102548:	85 d2                	test   %edx,%edx
+  10254a:	74 40                	je     10258c <file_name_by_info+0x88>
+        assert(ci->ci_abbrev->ab_tag == DW_TAG_compile_unit);
+  10254c:	66 83 3a 11          	cmpw   $0x11,(%edx)
+  102550:	75 53                	jne    1025a5 <file_name_by_info+0xa1>
+        if (ci->ci_name && buf && buflen >= sizeof(const char **)) {
+  102552:	8b 40 3c             	mov    0x3c(%eax),%eax
+  102555:	85 c0                	test   %eax,%eax
+  102557:	74 0c                	je     102565 <file_name_by_info+0x61>
+  102559:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+  10255d:	74 06                	je     102565 <file_name_by_info+0x61>
+  10255f:	83 7d 18 03          	cmpl   $0x3,0x18(%ebp)
+  102563:	77 59                	ja     1025be <file_name_by_info+0xba>
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wpointer-to-int-cast"
+                put_unaligned(ci->ci_name, (char **)buf);
+#pragma GCC diagnostic pop
+        }
+        if (ci->ci_stmt_list != DWARF_NOLINES && line_off) {
+  102565:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  102568:	8b 50 40             	mov    0x40(%eax),%edx
+  10256b:	8b 40 44             	mov    0x44(%eax),%eax
+  10256e:	83 7d 1c 00          	cmpl   $0x0,0x1c(%ebp)
+  102572:	74 6a                	je     1025de <file_name_by_info+0xda>
+  102574:	89 d1                	mov    %edx,%ecx
+  102576:	21 c1                	and    %eax,%ecx
+  102578:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  10257b:	74 61                	je     1025de <file_name_by_info+0xda>
+                *line_off = ci->ci_stmt_list;
+  10257d:	8b 5d 1c             	mov    0x1c(%ebp),%ebx
+  102580:	89 13                	mov    %edx,(%ebx)
+  102582:	89 43 04             	mov    %eax,0x4(%ebx)
+        }
+
+        return 0;
+  102585:	b8 00 00 00 00       	mov    $0x0,%eax
+  10258a:	eb 57                	jmp    1025e3 <file_name_by_info+0xdf>
+        assert(ci->ci_abbrev != NULL);
+  10258c:	68 66 98 10 00       	push   $0x109866
+  102591:	68 00 95 10 00       	push   $0x109500
+  102596:	68 c6 03 00 00       	push   $0x3c6
+  10259b:	68 59 98 10 00       	push   $0x109859
+  1025a0:	e8 e2 da ff ff       	call   100087 <_panic>
+        assert(ci->ci_abbrev->ab_tag == DW_TAG_compile_unit);
+  1025a5:	68 58 9a 10 00       	push   $0x109a58
+  1025aa:	68 00 95 10 00       	push   $0x109500
+  1025af:	68 c7 03 00 00       	push   $0x3c7
+  1025b4:	68 59 98 10 00       	push   $0x109859
+  1025b9:	e8 c9 da ff ff       	call   100087 <_panic>
+                put_unaligned(ci->ci_name, (char **)buf);
+  1025be:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  1025c1:	83 ec 04             	sub    $0x4,%esp
+  1025c4:	6a 04                	push   $0x4
+  1025c6:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  1025c9:	50                   	push   %eax
+  1025ca:	ff 75 14             	push   0x14(%ebp)
+  1025cd:	e8 26 6c 00 00       	call   1091f8 <memcpy>
+  1025d2:	83 c4 10             	add    $0x10,%esp
+  1025d5:	eb 8e                	jmp    102565 <file_name_by_info+0x61>
+                return -E_INVAL;
+  1025d7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  1025dc:	eb 05                	jmp    1025e3 <file_name_by_info+0xdf>
+        return 0;
+  1025de:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  1025e3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  1025e6:	5b                   	pop    %ebx
+  1025e7:	5e                   	pop    %esi
+  1025e8:	5f                   	pop    %edi
+  1025e9:	5d                   	pop    %ebp
+  1025ea:	c3                   	ret
+
+001025eb <function_by_info>:
+
+int function_by_info(const struct Dwarf_Addrs *addrs, uintptr_t p,
+                     Dwarf_Off cu_offset, char *buf, int buflen,
+                     uint32_t *offset) {
+  1025eb:	55                   	push   %ebp
+  1025ec:	89 e5                	mov    %esp,%ebp
+  1025ee:	57                   	push   %edi
+  1025ef:	56                   	push   %esi
+  1025f0:	53                   	push   %ebx
+  1025f1:	81 ec 9c 00 00 00    	sub    $0x9c,%esp
+        int count = 0;
+        struct Dwarf_Cuinfo *ci;
+        int code = dwarf_cu_get(addrs, cu_offset, &ci);
+  1025f7:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  1025fa:	50                   	push   %eax
+  1025fb:	ff 75 14             	push   0x14(%ebp)
+  1025fe:	ff 75 10             	push   0x10(%ebp)
+  102601:	ff 75 08             	push   0x8(%ebp)
+  102604:	e8 e8 44 00 00       	call   106af1 <dwarf_cu_get>
+        if (code < 0) {
+  102609:	83 c4 10             	add    $0x10,%esp
+  10260c:	85 c0                	test   %eax,%eax
+  10260e:	0f 88 38 03 00 00    	js     10294c <function_by_info+0x361>
+                return code;
+        }
+        const struct Dwarf_CU cu = ci->ci_cu;
+  102614:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  102617:	8b 50 08             	mov    0x8(%eax),%edx
+  10261a:	89 55 b8             	mov    %edx,-0x48(%ebp)
+  10261d:	8b 50 0c             	mov    0xc(%eax),%edx
+  102620:	89 55 bc             	mov    %edx,-0x44(%ebp)
+  102623:	8b 78 10             	mov    0x10(%eax),%edi
+  102626:	89 7d 88             	mov    %edi,-0x78(%ebp)
+  102629:	89 7d c0             	mov    %edi,-0x40(%ebp)
+  10262c:	8b 48 14             	mov    0x14(%eax),%ecx
+  10262f:	89 4d c4             	mov    %ecx,-0x3c(%ebp)
+  102632:	8b 48 18             	mov    0x18(%eax),%ecx
+  102635:	89 4d c8             	mov    %ecx,-0x38(%ebp)
+  102638:	8b 48 1c             	mov    0x1c(%eax),%ecx
+  10263b:	89 4d cc             	mov    %ecx,-0x34(%ebp)
+  10263e:	8b 78 20             	mov    0x20(%eax),%edi
+  102641:	89 bd 68 ff ff ff    	mov    %edi,-0x98(%ebp)
+  102647:	89 7d d0             	mov    %edi,-0x30(%ebp)
+  10264a:	8b 48 24             	mov    0x24(%eax),%ecx
+  10264d:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+  102650:	8b 48 28             	mov    0x28(%eax),%ecx
+  102653:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+  102656:	8b 48 2c             	mov    0x2c(%eax),%ecx
+  102659:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  10265c:	8b 48 30             	mov    0x30(%eax),%ecx
+  10265f:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+        const void *entry = cu.cu_dies;
+  102662:	89 55 94             	mov    %edx,-0x6c(%ebp)
+        const void *entry_end = cu.cu_end;
+        Dwarf_Small address_size = cu.cu_address_size;
+        const struct Dwarf_Abbrevtab *abbrevs = ci->ci_abbrevs;
+  102665:	8b 40 34             	mov    0x34(%eax),%eax
+  102668:	89 45 90             	mov    %eax,-0x70(%ebp)
+        unsigned abbrev_code = 0;
+        while (entry < entry_end) {
+  10266b:	e9 2a 02 00 00       	jmp    10289a <function_by_info+0x2af>
+                        return -E_BAD_DWARF;
+                }
+                const struct Dwarf_Attrspec *attr;
+                // parse subprogram DIE
+                if (abbrev->ab_tag == DW_TAG_subprogram) {
+                        uintptr_t low_pc = 0, high_pc = 0;
+  102670:	c7 45 a0 00 00 00 00 	movl   $0x0,-0x60(%ebp)
+                        const void *fn_name_entry = 0, *sibling = NULL;
+                        const void *ranges_entry = NULL, *high_entry = NULL;
+                        const struct Dwarf_Attrspec *high = NULL;
+                        unsigned name_form = 0, ranges_form = 0;
+  102677:	c7 85 6c ff ff ff 00 	movl   $0x0,-0x94(%ebp)
+  10267e:	00 00 00 
+  102681:	c7 45 80 00 00 00 00 	movl   $0x0,-0x80(%ebp)
+                        const struct Dwarf_Attrspec *high = NULL;
+  102688:	c7 85 7c ff ff ff 00 	movl   $0x0,-0x84(%ebp)
+  10268f:	00 00 00 
+                        const void *ranges_entry = NULL, *high_entry = NULL;
+  102692:	c7 85 70 ff ff ff 00 	movl   $0x0,-0x90(%ebp)
+  102699:	00 00 00 
+  10269c:	c7 85 78 ff ff ff 00 	movl   $0x0,-0x88(%ebp)
+  1026a3:	00 00 00 
+                        const void *fn_name_entry = 0, *sibling = NULL;
+  1026a6:	c7 85 74 ff ff ff 00 	movl   $0x0,-0x8c(%ebp)
+  1026ad:	00 00 00 
+  1026b0:	c7 45 84 00 00 00 00 	movl   $0x0,-0x7c(%ebp)
+                                        ranges_form = form;
+                                } else if (name == DW_AT_name) {
+                                        fn_name_entry = entry;
+                                        name_form = form;
+                                }
+                                count = dwarf_read_abbrev_entry(
+  1026b7:	0f b6 85 68 ff ff ff 	movzbl -0x98(%ebp),%eax
+  1026be:	89 45 8c             	mov    %eax,-0x74(%ebp)
+  1026c1:	89 bd 64 ff ff ff    	mov    %edi,-0x9c(%ebp)
+                        for (attr = abbrev->ab_attrs;
+  1026c7:	eb 54                	jmp    10271d <function_by_info+0x132>
+                                        sibling = dwarf_read_ref(addrs, &cu,
+  1026c9:	56                   	push   %esi
+  1026ca:	57                   	push   %edi
+  1026cb:	8d 45 b8             	lea    -0x48(%ebp),%eax
+  1026ce:	50                   	push   %eax
+  1026cf:	ff 75 08             	push   0x8(%ebp)
+  1026d2:	e8 de ef ff ff       	call   1016b5 <dwarf_read_ref>
+  1026d7:	89 85 74 ff ff ff    	mov    %eax,-0x8c(%ebp)
+  1026dd:	83 c4 10             	add    $0x10,%esp
+  1026e0:	eb 22                	jmp    102704 <function_by_info+0x119>
+                                        low_pc = dwarf_read_address(
+  1026e2:	56                   	push   %esi
+  1026e3:	57                   	push   %edi
+  1026e4:	8d 45 b8             	lea    -0x48(%ebp),%eax
+  1026e7:	50                   	push   %eax
+  1026e8:	ff 75 08             	push   0x8(%ebp)
+  1026eb:	e8 6f eb ff ff       	call   10125f <dwarf_read_address>
+  1026f0:	89 45 a0             	mov    %eax,-0x60(%ebp)
+  1026f3:	83 c4 10             	add    $0x10,%esp
+  1026f6:	eb 0c                	jmp    102704 <function_by_info+0x119>
+                                        high = attr;
+  1026f8:	89 9d 7c ff ff ff    	mov    %ebx,-0x84(%ebp)
+  1026fe:	89 b5 70 ff ff ff    	mov    %esi,-0x90(%ebp)
+                                count = dwarf_read_abbrev_entry(
+  102704:	83 ec 0c             	sub    $0xc,%esp
+  102707:	ff 75 8c             	push   -0x74(%ebp)
+  10270a:	6a 00                	push   $0x0
+  10270c:	6a 00                	push   $0x0
+  10270e:	57                   	push   %edi
+  10270f:	56                   	push   %esi
+  102710:	e8 9a e1 ff ff       	call   1008af <dwarf_read_abbrev_entry>
+                                    entry, form, NULL, 0, address_size);
+                                entry += count;
+  102715:	01 c6                	add    %eax,%esi
+                             attr->as_name || attr->as_form; attr++) {
+  102717:	83 c3 08             	add    $0x8,%ebx
+  10271a:	83 c4 20             	add    $0x20,%esp
+  10271d:	8b 03                	mov    (%ebx),%eax
+  10271f:	85 c0                	test   %eax,%eax
+  102721:	74 40                	je     102763 <function_by_info+0x178>
+                                unsigned name = attr->as_name;
+  102723:	0f b7 03             	movzwl (%ebx),%eax
+                                unsigned form = attr->as_form;
+  102726:	0f b7 7b 02          	movzwl 0x2(%ebx),%edi
+                                if (name == DW_AT_sibling) {
+  10272a:	83 f8 01             	cmp    $0x1,%eax
+  10272d:	74 9a                	je     1026c9 <function_by_info+0xde>
+                                } else if (name == DW_AT_low_pc) {
+  10272f:	83 f8 11             	cmp    $0x11,%eax
+  102732:	74 ae                	je     1026e2 <function_by_info+0xf7>
+                                } else if (name == DW_AT_high_pc) {
+  102734:	83 f8 12             	cmp    $0x12,%eax
+  102737:	74 bf                	je     1026f8 <function_by_info+0x10d>
+                                } else if (name == DW_AT_ranges) {
+  102739:	83 f8 55             	cmp    $0x55,%eax
+  10273c:	74 17                	je     102755 <function_by_info+0x16a>
+                                        name_form = form;
+  10273e:	83 f8 03             	cmp    $0x3,%eax
+  102741:	8b 4d 80             	mov    -0x80(%ebp),%ecx
+  102744:	0f 44 cf             	cmove  %edi,%ecx
+  102747:	89 4d 80             	mov    %ecx,-0x80(%ebp)
+  10274a:	8b 45 84             	mov    -0x7c(%ebp),%eax
+  10274d:	0f 44 c6             	cmove  %esi,%eax
+  102750:	89 45 84             	mov    %eax,-0x7c(%ebp)
+  102753:	eb af                	jmp    102704 <function_by_info+0x119>
+                                        ranges_form = form;
+  102755:	89 bd 6c ff ff ff    	mov    %edi,-0x94(%ebp)
+  10275b:	89 b5 78 ff ff ff    	mov    %esi,-0x88(%ebp)
+  102761:	eb a1                	jmp    102704 <function_by_info+0x119>
+                        }
+                        // DW_AT_high_pc may be an offset from a DW_AT_low_pc
+                        // after it.
+                        if (high) {
+  102763:	8b bd 64 ff ff ff    	mov    -0x9c(%ebp),%edi
+  102769:	8b 8d 7c ff ff ff    	mov    -0x84(%ebp),%ecx
+  10276f:	85 c9                	test   %ecx,%ecx
+  102771:	74 1c                	je     10278f <function_by_info+0x1a4>
+                                high_pc = dwarf_read_high_pc(
+  102773:	83 ec 0c             	sub    $0xc,%esp
+  102776:	ff 75 a0             	push   -0x60(%ebp)
+  102779:	ff b5 70 ff ff ff    	push   -0x90(%ebp)
+  10277f:	51                   	push   %ecx
+  102780:	8d 45 b8             	lea    -0x48(%ebp),%eax
+  102783:	50                   	push   %eax
+  102784:	ff 75 08             	push   0x8(%ebp)
+  102787:	e8 b3 ee ff ff       	call   10163f <dwarf_read_high_pc>
+  10278c:	83 c4 20             	add    $0x20,%esp
+                                    addrs, &cu, high, high_entry, low_pc);
+                        }
+                        // A function in pieces has a range list instead;
+                        // the piece with `p` in it counts as the function.
+                        bool found = p >= low_pc && p <= high_pc;
+  10278f:	8b 55 a0             	mov    -0x60(%ebp),%edx
+                        if (ranges_entry) {
+  102792:	83 bd 78 ff ff ff 00 	cmpl   $0x0,-0x88(%ebp)
+  102799:	74 5b                	je     1027f6 <function_by_info+0x20b>
+                                struct Dwarf_Ranges rg;
+                                dwarf_read_ranges(addrs, &cu, ranges_form,
+  10279b:	83 ec 0c             	sub    $0xc,%esp
+  10279e:	8d 5d a4             	lea    -0x5c(%ebp),%ebx
+  1027a1:	53                   	push   %ebx
+  1027a2:	ff b5 78 ff ff ff    	push   -0x88(%ebp)
+  1027a8:	ff b5 6c ff ff ff    	push   -0x94(%ebp)
+  1027ae:	8d 45 b8             	lea    -0x48(%ebp),%eax
+  1027b1:	50                   	push   %eax
+  1027b2:	ff 75 08             	push   0x8(%ebp)
+  1027b5:	e8 91 f2 ff ff       	call   101a4b <dwarf_read_ranges>
+                                                  ranges_entry, &rg);
+                                found = dwarf_ranges_find(&rg, p, &low_pc);
+  1027ba:	83 c4 1c             	add    $0x1c,%esp
+  1027bd:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  1027c0:	50                   	push   %eax
+  1027c1:	ff 75 0c             	push   0xc(%ebp)
+  1027c4:	53                   	push   %ebx
+  1027c5:	e8 f2 f5 ff ff       	call   101dbc <dwarf_ranges_find>
+  1027ca:	83 c4 10             	add    $0x10,%esp
+                        }
+                        // load info and finish if addr in function
+                        if (found) {
+  1027cd:	84 c0                	test   %al,%al
+  1027cf:	75 35                	jne    102806 <function_by_info+0x21b>
+                                }
+                                return 0;
+                        }
+                        // Short of GNU C's nested functions, nothing in the
+                        // function's body can contain `p`.
+                        entry = dwarf_skip_subtree(addrs, &cu, abbrevs, abbrev,
+  1027d1:	83 ec 08             	sub    $0x8,%esp
+  1027d4:	ff b5 74 ff ff ff    	push   -0x8c(%ebp)
+  1027da:	56                   	push   %esi
+  1027db:	57                   	push   %edi
+  1027dc:	ff 75 90             	push   -0x70(%ebp)
+  1027df:	8d 45 b8             	lea    -0x48(%ebp),%eax
+  1027e2:	50                   	push   %eax
+  1027e3:	ff 75 08             	push   0x8(%ebp)
+  1027e6:	e8 c1 fb ff ff       	call   1023ac <dwarf_skip_subtree>
+  1027eb:	89 45 94             	mov    %eax,-0x6c(%ebp)
+  1027ee:	83 c4 20             	add    $0x20,%esp
+  1027f1:	e9 a4 00 00 00       	jmp    10289a <function_by_info+0x2af>
+                        bool found = p >= low_pc && p <= high_pc;
+  1027f6:	39 55 0c             	cmp    %edx,0xc(%ebp)
+  1027f9:	0f 93 c2             	setae  %dl
+  1027fc:	3b 45 0c             	cmp    0xc(%ebp),%eax
+  1027ff:	0f 93 c0             	setae  %al
+  102802:	21 d0                	and    %edx,%eax
+  102804:	eb c7                	jmp    1027cd <function_by_info+0x1e2>
+                                *offset = low_pc;
+  102806:	8b 45 20             	mov    0x20(%ebp),%eax
+  102809:	8b 55 a0             	mov    -0x60(%ebp),%edx
+  10280c:	89 10                	mov    %edx,(%eax)
+                                        : dwarf_die_name(addrs, &cu, abbrevs,
+  10280e:	8b 45 84             	mov    -0x7c(%ebp),%eax
+  102811:	85 c0                	test   %eax,%eax
+  102813:	74 2d                	je     102842 <function_by_info+0x257>
+                                        ? dwarf_read_string(addrs, &cu,
+  102815:	50                   	push   %eax
+  102816:	ff 75 80             	push   -0x80(%ebp)
+  102819:	8d 45 b8             	lea    -0x48(%ebp),%eax
+  10281c:	50                   	push   %eax
+  10281d:	ff 75 08             	push   0x8(%ebp)
+  102820:	e8 51 e9 ff ff       	call   101176 <dwarf_read_string>
+  102825:	83 c4 10             	add    $0x10,%esp
+                                if (fn_name && buf &&
+  102828:	85 c0                	test   %eax,%eax
+  10282a:	74 0c                	je     102838 <function_by_info+0x24d>
+  10282c:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+  102830:	74 06                	je     102838 <function_by_info+0x24d>
+  102832:	83 7d 1c 03          	cmpl   $0x3,0x1c(%ebp)
+  102836:	77 21                	ja     102859 <function_by_info+0x26e>
+                                return 0;
+  102838:	b8 00 00 00 00       	mov    $0x0,%eax
+  10283d:	e9 0a 01 00 00       	jmp    10294c <function_by_info+0x361>
+                                        : dwarf_die_name(addrs, &cu, abbrevs,
+  102842:	ff 75 94             	push   -0x6c(%ebp)
+  102845:	ff 75 90             	push   -0x70(%ebp)
+  102848:	8d 45 b8             	lea    -0x48(%ebp),%eax
+  10284b:	50                   	push   %eax
+  10284c:	ff 75 08             	push   0x8(%ebp)
+  10284f:	e8 b5 f5 ff ff       	call   101e09 <dwarf_die_name>
+  102854:	83 c4 10             	add    $0x10,%esp
+  102857:	eb cf                	jmp    102828 <function_by_info+0x23d>
+                                        put_unaligned(fn_name, (char **)buf);
+  102859:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+  10285c:	83 ec 04             	sub    $0x4,%esp
+  10285f:	6a 04                	push   $0x4
+  102861:	8d 45 a4             	lea    -0x5c(%ebp),%eax
+  102864:	50                   	push   %eax
+  102865:	ff 75 18             	push   0x18(%ebp)
+  102868:	e8 8b 69 00 00       	call   1091f8 <memcpy>
+  10286d:	83 c4 10             	add    $0x10,%esp
+  102870:	eb c6                	jmp    102838 <function_by_info+0x24d>
+  102872:	b8 00 08 02 60       	mov    $0x60020800,%eax
+  102877:	d3 e8                	shr    %cl,%eax
+  102879:	83 e0 01             	and    $0x1,%eax
+                                                   entry, sibling);
+                } else {
+                        // skip if not a subprogram, along with its children
+                        // if they can't be code
+                        entry = dwarf_skip_die(
+  10287c:	83 ec 08             	sub    $0x8,%esp
+                            addrs, &cu, abbrevs, abbrev, entry,
+                            !dwarf_tag_has_code(abbrev->ab_tag));
+  10287f:	83 f0 01             	xor    $0x1,%eax
+                        entry = dwarf_skip_die(
+  102882:	50                   	push   %eax
+  102883:	56                   	push   %esi
+  102884:	57                   	push   %edi
+  102885:	ff 75 90             	push   -0x70(%ebp)
+  102888:	8d 45 b8             	lea    -0x48(%ebp),%eax
+  10288b:	50                   	push   %eax
+  10288c:	ff 75 08             	push   0x8(%ebp)
+  10288f:	e8 a7 f5 ff ff       	call   101e3b <dwarf_skip_die>
+  102894:	89 45 94             	mov    %eax,-0x6c(%ebp)
+  102897:	83 c4 20             	add    $0x20,%esp
+        while (entry < entry_end) {
+  10289a:	8b 7d 88             	mov    -0x78(%ebp),%edi
+  10289d:	39 7d 94             	cmp    %edi,-0x6c(%ebp)
+  1028a0:	0f 83 9a 00 00 00    	jae    102940 <function_by_info+0x355>
+	count = 0;
+  1028a6:	b8 00 00 00 00       	mov    $0x0,%eax
+	result = 0;
+  1028ab:	bf 00 00 00 00       	mov    $0x0,%edi
+  1028b0:	89 c6                	mov    %eax,%esi
+		byte = *addr;
+  1028b2:	8b 5d 94             	mov    -0x6c(%ebp),%ebx
+  1028b5:	0f b6 1c 03          	movzbl (%ebx,%eax,1),%ebx
+		count++;
+  1028b9:	83 c0 01             	add    $0x1,%eax
+		result |= (byte & 0x7f) << shift;
+  1028bc:	89 da                	mov    %ebx,%edx
+  1028be:	83 e2 7f             	and    $0x7f,%edx
+  1028c1:	8d 0c f5 00 00 00 00 	lea    0x0(,%esi,8),%ecx
+  1028c8:	29 f1                	sub    %esi,%ecx
+  1028ca:	d3 e2                	shl    %cl,%edx
+  1028cc:	09 d7                	or     %edx,%edi
+		if (!(byte & 0x80))
+  1028ce:	84 db                	test   %bl,%bl
+  1028d0:	78 de                	js     1028b0 <function_by_info+0x2c5>
+                entry += count;
+  1028d2:	8b 75 94             	mov    -0x6c(%ebp),%esi
+  1028d5:	01 c6                	add    %eax,%esi
+                if (abbrev_code == 0) {
+  1028d7:	85 ff                	test   %edi,%edi
+  1028d9:	74 5d                	je     102938 <function_by_info+0x34d>
+	if (code >= at->at_ncodes || !at->at_abbrevs[code].ab_attrs)
+  1028db:	8b 45 90             	mov    -0x70(%ebp),%eax
+  1028de:	3b 78 08             	cmp    0x8(%eax),%edi
+  1028e1:	73 64                	jae    102947 <function_by_info+0x35c>
+  1028e3:	8d 14 bf             	lea    (%edi,%edi,4),%edx
+  1028e6:	8b 40 0c             	mov    0xc(%eax),%eax
+  1028e9:	8d 3c 90             	lea    (%eax,%edx,4),%edi
+  1028ec:	8b 5f 04             	mov    0x4(%edi),%ebx
+  1028ef:	85 db                	test   %ebx,%ebx
+  1028f1:	74 61                	je     102954 <function_by_info+0x369>
+                if (abbrev->ab_tag == DW_TAG_subprogram) {
+  1028f3:	0f b7 0f             	movzwl (%edi),%ecx
+  1028f6:	66 83 f9 2e          	cmp    $0x2e,%cx
+  1028fa:	0f 84 70 fd ff ff    	je     102670 <function_by_info+0x85>
+	return tag == DW_TAG_compile_unit || tag == DW_TAG_partial_unit
+  102900:	66 83 f9 1e          	cmp    $0x1e,%cx
+  102904:	77 14                	ja     10291a <function_by_info+0x32f>
+		|| tag == DW_TAG_module;
+  102906:	b8 00 00 00 00       	mov    $0x0,%eax
+  10290b:	66 83 f9 0a          	cmp    $0xa,%cx
+  10290f:	0f 86 67 ff ff ff    	jbe    10287c <function_by_info+0x291>
+  102915:	e9 58 ff ff ff       	jmp    102872 <function_by_info+0x287>
+  10291a:	83 e9 2e             	sub    $0x2e,%ecx
+  10291d:	b8 01 48 00 00       	mov    $0x4801,%eax
+  102922:	d3 e8                	shr    %cl,%eax
+  102924:	83 e0 01             	and    $0x1,%eax
+  102927:	66 83 f9 0f          	cmp    $0xf,%cx
+  10292b:	ba 00 00 00 00       	mov    $0x0,%edx
+  102930:	0f 43 c2             	cmovae %edx,%eax
+  102933:	e9 44 ff ff ff       	jmp    10287c <function_by_info+0x291>
+                entry += count;
+  102938:	89 75 94             	mov    %esi,-0x6c(%ebp)
+  10293b:	e9 5a ff ff ff       	jmp    10289a <function_by_info+0x2af>
+                }
+        }
+        return 0;
+  102940:	b8 00 00 00 00       	mov    $0x0,%eax
+  102945:	eb 05                	jmp    10294c <function_by_info+0x361>
+                        return -E_BAD_DWARF;
+  102947:	b8 fa ff ff ff       	mov    $0xfffffffa,%eax
+}
+  10294c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  10294f:	5b                   	pop    %ebx
+  102950:	5e                   	pop    %esi
+  102951:	5f                   	pop    %edi
+  102952:	5d                   	pop    %ebp
+  102953:	c3                   	ret
+                        return -E_BAD_DWARF;
+  102954:	b8 fa ff ff ff       	mov    $0xfffffffa,%eax
+  102959:	eb f1                	jmp    10294c <function_by_info+0x361>
+
+0010295b <address_by_fname>:
+// Store the address of the function 'fname' to *offset. Returns
+// -E_NO_ENT, leaving *offset alone, if there is no such function.
+int
+address_by_fname(const struct Dwarf_Addrs *addrs, const char *fname,
+                 uintptr_t *offset)
+{
+  10295b:	55                   	push   %ebp
+  10295c:	89 e5                	mov    %esp,%ebp
+  10295e:	57                   	push   %edi
+  10295f:	56                   	push   %esi
+  102960:	53                   	push   %ebx
+  102961:	83 ec 58             	sub    $0x58,%esp
+	const int flen = strlen(fname);
+  102964:	ff 75 0c             	push   0xc(%ebp)
+  102967:	e8 69 66 00 00       	call   108fd5 <strlen>
+	if (flen == 0)
+  10296c:	83 c4 10             	add    $0x10,%esp
+  10296f:	85 c0                	test   %eax,%eax
+  102971:	0f 84 2e 02 00 00    	je     102ba5 <address_by_fname+0x24a>
+		return -E_NO_ENT;
+	// The name table has every name we would find below.
+	int r = dwarf_name_lookup(addrs, fname, offset);
+  102977:	83 ec 04             	sub    $0x4,%esp
+  10297a:	ff 75 10             	push   0x10(%ebp)
+  10297d:	ff 75 0c             	push   0xc(%ebp)
+  102980:	ff 75 08             	push   0x8(%ebp)
+  102983:	e8 fd 38 00 00       	call   106285 <dwarf_name_lookup>
+  102988:	89 c6                	mov    %eax,%esi
+	if (r != -E_BAD_DWARF)
+  10298a:	83 c4 10             	add    $0x10,%esp
+  10298d:	83 f8 fa             	cmp    $0xfffffffa,%eax
+  102990:	75 4d                	jne    1029df <address_by_fname+0x84>
+		return r;
+	if (dwarf_need(DWARF_PUBNAMES | DWARF_DIES) < 0)
+		return -E_BAD_DWARF;
+	const void *pubnames_entry = addrs->pubnames_begin;
+  102992:	8b 45 08             	mov    0x8(%ebp),%eax
+  102995:	8b 40 28             	mov    0x28(%eax),%eax
+	int count = 0;
+	unsigned long len = 0;
+	Dwarf_Off cu_offset = 0;
+	Dwarf_Off func_offset = 0;
+	// parse pubnames section
+	while ((const unsigned char *)pubnames_entry < addrs->pubnames_end) {
+  102998:	89 c3                	mov    %eax,%ebx
+  10299a:	89 75 b4             	mov    %esi,-0x4c(%ebp)
+  10299d:	8b 45 08             	mov    0x8(%ebp),%eax
+  1029a0:	3b 58 2c             	cmp    0x2c(%eax),%ebx
+  1029a3:	0f 83 f2 01 00 00    	jae    102b9b <address_by_fname+0x240>
+	initial_len = get_unaligned(addr, uint32_t);
+  1029a9:	83 ec 04             	sub    $0x4,%esp
+  1029ac:	6a 04                	push   $0x4
+  1029ae:	53                   	push   %ebx
+  1029af:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  1029b2:	50                   	push   %eax
+  1029b3:	e8 40 68 00 00       	call   1091f8 <memcpy>
+  1029b8:	8b 45 e0             	mov    -0x20(%ebp),%eax
+	if (initial_len >= DW_EXT_LO && initial_len <= DW_EXT_HI) {
+  1029bb:	83 c4 10             	add    $0x10,%esp
+  1029be:	83 f8 ef             	cmp    $0xffffffef,%eax
+  1029c1:	0f 86 e8 01 00 00    	jbe    102baf <address_by_fname+0x254>
+		if (initial_len == DW_EXT_DWARF64) {
+  1029c7:	83 f8 ff             	cmp    $0xffffffff,%eax
+  1029ca:	74 1d                	je     1029e9 <address_by_fname+0x8e>
+			cprintf("Unknown DWARF extension\n");
+  1029cc:	8b 75 b4             	mov    -0x4c(%ebp),%esi
+  1029cf:	83 ec 0c             	sub    $0xc,%esp
+  1029d2:	68 40 98 10 00       	push   $0x109840
+  1029d7:	e8 58 4e 00 00       	call   107834 <cprintf>
+  1029dc:	83 c4 10             	add    $0x10,%esp
+			}
+			pubnames_entry += strlen(pubnames_entry) + 1;
+		}
+	}
+	return -E_NO_ENT;
+}
+  1029df:	89 f0                	mov    %esi,%eax
+  1029e1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  1029e4:	5b                   	pop    %ebx
+  1029e5:	5e                   	pop    %esi
+  1029e6:	5f                   	pop    %edi
+  1029e7:	5d                   	pop    %ebp
+  1029e8:	c3                   	ret
+			*len = get_unaligned((uint64_t *)addr + 4, uint64_t);
+  1029e9:	83 ec 04             	sub    $0x4,%esp
+  1029ec:	6a 08                	push   $0x8
+  1029ee:	8d 43 20             	lea    0x20(%ebx),%eax
+  1029f1:	50                   	push   %eax
+  1029f2:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  1029f5:	50                   	push   %eax
+  1029f6:	e8 fd 67 00 00       	call   1091f8 <memcpy>
+  1029fb:	8b 45 e0             	mov    -0x20(%ebp),%eax
+			count = 12;
+  1029fe:	83 c4 10             	add    $0x10,%esp
+  102a01:	ba 0c 00 00 00       	mov    $0xc,%edx
+  102a06:	e9 a9 01 00 00       	jmp    102bb4 <address_by_fname+0x259>
+		assert(version == 2);
+  102a0b:	68 7c 98 10 00       	push   $0x10987c
+  102a10:	68 00 95 10 00       	push   $0x109500
+  102a15:	68 60 04 00 00       	push   $0x460
+  102a1a:	68 59 98 10 00       	push   $0x109859
+  102a1f:	e8 63 d6 ff ff       	call   100087 <_panic>
+			*len = get_unaligned((uint64_t *)addr + 4, uint64_t);
+  102a24:	83 ec 04             	sub    $0x4,%esp
+  102a27:	6a 08                	push   $0x8
+  102a29:	83 c3 26             	add    $0x26,%ebx
+  102a2c:	53                   	push   %ebx
+  102a2d:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  102a30:	50                   	push   %eax
+  102a31:	e8 c2 67 00 00       	call   1091f8 <memcpy>
+			count = 12;
+  102a36:	83 c4 10             	add    $0x10,%esp
+  102a39:	ba 0c 00 00 00       	mov    $0xc,%edx
+  102a3e:	e9 f5 01 00 00       	jmp    102c38 <address_by_fname+0x2dd>
+							*offset = dwarf_read_address(
+  102a43:	53                   	push   %ebx
+  102a44:	0f b7 47 02          	movzwl 0x2(%edi),%eax
+  102a48:	50                   	push   %eax
+				const struct Dwarf_CU *cu = &ci->ci_cu;
+  102a49:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  102a4c:	83 c0 08             	add    $0x8,%eax
+							*offset = dwarf_read_address(
+  102a4f:	50                   	push   %eax
+  102a50:	ff 75 08             	push   0x8(%ebp)
+  102a53:	e8 07 e8 ff ff       	call   10125f <dwarf_read_address>
+  102a58:	8b 7d 10             	mov    0x10(%ebp),%edi
+  102a5b:	89 07                	mov    %eax,(%edi)
+							return 0;
+  102a5d:	83 c4 10             	add    $0x10,%esp
+  102a60:	8b 75 d0             	mov    -0x30(%ebp),%esi
+  102a63:	e9 77 ff ff ff       	jmp    1029df <address_by_fname+0x84>
+  102a68:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+			pubnames_entry += strlen(pubnames_entry) + 1;
+  102a6b:	83 ec 0c             	sub    $0xc,%esp
+  102a6e:	56                   	push   %esi
+  102a6f:	e8 61 65 00 00       	call   108fd5 <strlen>
+  102a74:	8d 74 06 01          	lea    0x1(%esi,%eax,1),%esi
+  102a78:	83 c4 10             	add    $0x10,%esp
+		while (pubnames_entry < pubnames_entry_end) {
+  102a7b:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  102a7e:	39 c6                	cmp    %eax,%esi
+  102a80:	0f 83 07 01 00 00    	jae    102b8d <address_by_fname+0x232>
+			func_offset = get_unaligned(pubnames_entry, uint32_t);
+  102a86:	83 ec 04             	sub    $0x4,%esp
+  102a89:	6a 04                	push   $0x4
+  102a8b:	56                   	push   %esi
+  102a8c:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  102a8f:	50                   	push   %eax
+  102a90:	e8 63 67 00 00       	call   1091f8 <memcpy>
+  102a95:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+			pubnames_entry += sizeof(uint32_t);
+  102a98:	83 c6 04             	add    $0x4,%esi
+			if (func_offset == 0) {
+  102a9b:	83 c4 10             	add    $0x10,%esp
+  102a9e:	85 db                	test   %ebx,%ebx
+  102aa0:	0f 84 ee 00 00 00    	je     102b94 <address_by_fname+0x239>
+			if (!strcmp(fname, pubnames_entry)) {
+  102aa6:	83 ec 08             	sub    $0x8,%esp
+  102aa9:	56                   	push   %esi
+  102aaa:	ff 75 0c             	push   0xc(%ebp)
+  102aad:	e8 0f 66 00 00       	call   1090c1 <strcmp>
+  102ab2:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  102ab5:	83 c4 10             	add    $0x10,%esp
+  102ab8:	85 c0                	test   %eax,%eax
+  102aba:	75 af                	jne    102a6b <address_by_fname+0x110>
+				int code = dwarf_cu_get(addrs, cu_offset, &ci);
+  102abc:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  102abf:	50                   	push   %eax
+  102ac0:	ff 75 bc             	push   -0x44(%ebp)
+  102ac3:	ff 75 b8             	push   -0x48(%ebp)
+  102ac6:	ff 75 08             	push   0x8(%ebp)
+  102ac9:	e8 23 40 00 00       	call   106af1 <dwarf_cu_get>
+				if (code < 0) {
+  102ace:	83 c4 10             	add    $0x10,%esp
+  102ad1:	85 c0                	test   %eax,%eax
+  102ad3:	0f 88 ad 00 00 00    	js     102b86 <address_by_fname+0x22b>
+				const struct Dwarf_CU *cu = &ci->ci_cu;
+  102ad9:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  102adc:	89 45 c8             	mov    %eax,-0x38(%ebp)
+				Dwarf_Small address_size = cu->cu_address_size;
+  102adf:	8b 78 20             	mov    0x20(%eax),%edi
+  102ae2:	89 7d c0             	mov    %edi,-0x40(%ebp)
+				const void *entry = cu->cu_hdr + func_offset;
+  102ae5:	03 58 08             	add    0x8(%eax),%ebx
+  102ae8:	89 5d d4             	mov    %ebx,-0x2c(%ebp)
+	count = 0;
+  102aeb:	8b 45 d0             	mov    -0x30(%ebp),%eax
+	result = 0;
+  102aee:	bf 00 00 00 00       	mov    $0x0,%edi
+  102af3:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+  102af6:	89 c6                	mov    %eax,%esi
+		byte = *addr;
+  102af8:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+  102afb:	0f b6 1c 01          	movzbl (%ecx,%eax,1),%ebx
+		count++;
+  102aff:	83 c0 01             	add    $0x1,%eax
+		result |= (byte & 0x7f) << shift;
+  102b02:	89 da                	mov    %ebx,%edx
+  102b04:	83 e2 7f             	and    $0x7f,%edx
+  102b07:	8d 0c f5 00 00 00 00 	lea    0x0(,%esi,8),%ecx
+  102b0e:	29 f1                	sub    %esi,%ecx
+  102b10:	d3 e2                	shl    %cl,%edx
+  102b12:	09 d7                	or     %edx,%edi
+		if (!(byte & 0x80))
+  102b14:	84 db                	test   %bl,%bl
+  102b16:	78 de                	js     102af6 <address_by_fname+0x19b>
+				    = dwarf_abbrev(ci->ci_abbrevs, abbrev_code);
+  102b18:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+  102b1b:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+  102b1e:	8b 53 34             	mov    0x34(%ebx),%edx
+	if (code >= at->at_ncodes || !at->at_abbrevs[code].ab_attrs)
+  102b21:	3b 7a 08             	cmp    0x8(%edx),%edi
+  102b24:	0f 83 18 01 00 00    	jae    102c42 <address_by_fname+0x2e7>
+  102b2a:	8d 0c bf             	lea    (%edi,%edi,4),%ecx
+  102b2d:	8b 52 0c             	mov    0xc(%edx),%edx
+  102b30:	8d 14 8a             	lea    (%edx,%ecx,4),%edx
+  102b33:	8b 7a 04             	mov    0x4(%edx),%edi
+  102b36:	85 ff                	test   %edi,%edi
+  102b38:	0f 84 0c 01 00 00    	je     102c4a <address_by_fname+0x2ef>
+				if (abbrev->ab_tag == DW_TAG_subprogram) {
+  102b3e:	66 83 3a 2e          	cmpw   $0x2e,(%edx)
+  102b42:	0f 85 23 ff ff ff    	jne    102a6b <address_by_fname+0x110>
+				entry += count;
+  102b48:	8b 5d d4             	mov    -0x2c(%ebp),%ebx
+  102b4b:	01 c3                	add    %eax,%ebx
+						entry += dwarf_read_abbrev_entry(
+  102b4d:	0f b6 45 c0          	movzbl -0x40(%ebp),%eax
+  102b51:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+  102b54:	89 c6                	mov    %eax,%esi
+					     attr->as_name || attr->as_form;
+  102b56:	83 3f 00             	cmpl   $0x0,(%edi)
+  102b59:	0f 84 09 ff ff ff    	je     102a68 <address_by_fname+0x10d>
+						if (attr->as_name == DW_AT_low_pc) {
+  102b5f:	66 83 3f 11          	cmpw   $0x11,(%edi)
+  102b63:	0f 84 da fe ff ff    	je     102a43 <address_by_fname+0xe8>
+						entry += dwarf_read_abbrev_entry(
+  102b69:	83 ec 0c             	sub    $0xc,%esp
+  102b6c:	56                   	push   %esi
+  102b6d:	6a 00                	push   $0x0
+  102b6f:	6a 00                	push   $0x0
+  102b71:	0f b7 47 02          	movzwl 0x2(%edi),%eax
+  102b75:	50                   	push   %eax
+  102b76:	53                   	push   %ebx
+  102b77:	e8 33 dd ff ff       	call   1008af <dwarf_read_abbrev_entry>
+  102b7c:	01 c3                	add    %eax,%ebx
+					     attr++) {
+  102b7e:	83 c7 08             	add    $0x8,%edi
+  102b81:	83 c4 20             	add    $0x20,%esp
+  102b84:	eb d0                	jmp    102b56 <address_by_fname+0x1fb>
+				int code = dwarf_cu_get(addrs, cu_offset, &ci);
+  102b86:	89 c6                	mov    %eax,%esi
+  102b88:	e9 52 fe ff ff       	jmp    1029df <address_by_fname+0x84>
+  102b8d:	89 f3                	mov    %esi,%ebx
+  102b8f:	e9 09 fe ff ff       	jmp    10299d <address_by_fname+0x42>
+  102b94:	89 f3                	mov    %esi,%ebx
+  102b96:	e9 02 fe ff ff       	jmp    10299d <address_by_fname+0x42>
+	return -E_NO_ENT;
+  102b9b:	be f8 ff ff ff       	mov    $0xfffffff8,%esi
+  102ba0:	e9 3a fe ff ff       	jmp    1029df <address_by_fname+0x84>
+		return -E_NO_ENT;
+  102ba5:	be f8 ff ff ff       	mov    $0xfffffff8,%esi
+  102baa:	e9 30 fe ff ff       	jmp    1029df <address_by_fname+0x84>
+	count = 4;
+  102baf:	ba 04 00 00 00       	mov    $0x4,%edx
+		pubnames_entry += count;
+  102bb4:	01 d3                	add    %edx,%ebx
+		const void *pubnames_entry_end = pubnames_entry + len;
+  102bb6:	01 d8                	add    %ebx,%eax
+  102bb8:	89 45 cc             	mov    %eax,-0x34(%ebp)
+		Dwarf_Half version = get_unaligned(pubnames_entry, Dwarf_Half);
+  102bbb:	83 ec 04             	sub    $0x4,%esp
+  102bbe:	6a 02                	push   $0x2
+  102bc0:	53                   	push   %ebx
+  102bc1:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  102bc4:	50                   	push   %eax
+  102bc5:	e8 2e 66 00 00       	call   1091f8 <memcpy>
+		pubnames_entry += sizeof(Dwarf_Half);
+  102bca:	8d 43 02             	lea    0x2(%ebx),%eax
+		assert(version == 2);
+  102bcd:	83 c4 10             	add    $0x10,%esp
+  102bd0:	66 83 7d e0 02       	cmpw   $0x2,-0x20(%ebp)
+  102bd5:	0f 85 30 fe ff ff    	jne    102a0b <address_by_fname+0xb0>
+		cu_offset = get_unaligned(pubnames_entry, uint32_t);
+  102bdb:	83 ec 04             	sub    $0x4,%esp
+  102bde:	6a 04                	push   $0x4
+  102be0:	50                   	push   %eax
+  102be1:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  102be4:	50                   	push   %eax
+  102be5:	e8 0e 66 00 00       	call   1091f8 <memcpy>
+  102bea:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  102bed:	ba 00 00 00 00       	mov    $0x0,%edx
+  102bf2:	89 45 b8             	mov    %eax,-0x48(%ebp)
+  102bf5:	89 55 bc             	mov    %edx,-0x44(%ebp)
+		pubnames_entry += sizeof(uint32_t);
+  102bf8:	8d 73 06             	lea    0x6(%ebx),%esi
+	initial_len = get_unaligned(addr, uint32_t);
+  102bfb:	83 c4 0c             	add    $0xc,%esp
+  102bfe:	6a 04                	push   $0x4
+  102c00:	56                   	push   %esi
+  102c01:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  102c04:	50                   	push   %eax
+  102c05:	e8 ee 65 00 00       	call   1091f8 <memcpy>
+  102c0a:	8b 45 e0             	mov    -0x20(%ebp),%eax
+	if (initial_len >= DW_EXT_LO && initial_len <= DW_EXT_HI) {
+  102c0d:	83 c4 10             	add    $0x10,%esp
+	count = 4;
+  102c10:	ba 04 00 00 00       	mov    $0x4,%edx
+	if (initial_len >= DW_EXT_LO && initial_len <= DW_EXT_HI) {
+  102c15:	83 f8 ef             	cmp    $0xffffffef,%eax
+  102c18:	76 1e                	jbe    102c38 <address_by_fname+0x2dd>
+		if (initial_len == DW_EXT_DWARF64) {
+  102c1a:	83 f8 ff             	cmp    $0xffffffff,%eax
+  102c1d:	0f 84 01 fe ff ff    	je     102a24 <address_by_fname+0xc9>
+			cprintf("Unknown DWARF extension\n");
+  102c23:	83 ec 0c             	sub    $0xc,%esp
+  102c26:	68 40 98 10 00       	push   $0x109840
+  102c2b:	e8 04 4c 00 00       	call   107834 <cprintf>
+  102c30:	83 c4 10             	add    $0x10,%esp
+			count = 0;
+  102c33:	ba 00 00 00 00       	mov    $0x0,%edx
+		pubnames_entry += count;
+  102c38:	8d 1c 16             	lea    (%esi,%edx,1),%ebx
+		while (pubnames_entry < pubnames_entry_end) {
+  102c3b:	89 de                	mov    %ebx,%esi
+  102c3d:	e9 39 fe ff ff       	jmp    102a7b <address_by_fname+0x120>
+  102c42:	8b 75 b4             	mov    -0x4c(%ebp),%esi
+  102c45:	e9 95 fd ff ff       	jmp    1029df <address_by_fname+0x84>
+  102c4a:	8b 75 b4             	mov    -0x4c(%ebp),%esi
+  102c4d:	e9 8d fd ff ff       	jmp    1029df <address_by_fname+0x84>
+
+00102c52 <naive_address_by_fname>:
+
+int
+naive_address_by_fname(const struct Dwarf_Addrs *addrs, const char *fname,
+                       uintptr_t *offset)
+{
+  102c52:	55                   	push   %ebp
+  102c53:	89 e5                	mov    %esp,%ebp
+  102c55:	57                   	push   %edi
+  102c56:	56                   	push   %esi
+  102c57:	53                   	push   %ebx
+  102c58:	83 ec 68             	sub    $0x68,%esp
+	if (dwarf_need(DWARF_DIES) < 0)
+		return -E_BAD_DWARF;
+	const int flen = strlen(fname);
+  102c5b:	ff 75 0c             	push   0xc(%ebp)
+  102c5e:	e8 72 63 00 00       	call   108fd5 <strlen>
+	if (flen == 0)
+  102c63:	83 c4 10             	add    $0x10,%esp
+  102c66:	85 c0                	test   %eax,%eax
+  102c68:	0f 84 22 02 00 00    	je     102e90 <naive_address_by_fname+0x23e>
+		return -E_NO_ENT;
+	const void *entry = addrs->info_begin;
+  102c6e:	8b 45 08             	mov    0x8(%ebp),%eax
+  102c71:	8b 40 10             	mov    0x10(%eax),%eax
+  102c74:	89 45 b4             	mov    %eax,-0x4c(%ebp)
+	int count = 0;
+	while ((const unsigned char *)entry < addrs->info_end) {
+  102c77:	8b 45 08             	mov    0x8(%ebp),%eax
+  102c7a:	8b 7d b4             	mov    -0x4c(%ebp),%edi
+  102c7d:	3b 78 14             	cmp    0x14(%eax),%edi
+  102c80:	0f 83 03 02 00 00    	jae    102e89 <naive_address_by_fname+0x237>
+		// Parse compilation unit header.
+		struct Dwarf_CU cu;
+		int code = dwarf_read_cu_header(addrs, entry, &cu);
+  102c86:	83 ec 04             	sub    $0x4,%esp
+  102c89:	8d 45 bc             	lea    -0x44(%ebp),%eax
+  102c8c:	50                   	push   %eax
+  102c8d:	ff 75 b4             	push   -0x4c(%ebp)
+  102c90:	ff 75 08             	push   0x8(%ebp)
+  102c93:	e8 38 e6 ff ff       	call   1012d0 <dwarf_read_cu_header>
+		if (code < 0) {
+  102c98:	83 c4 10             	add    $0x10,%esp
+  102c9b:	85 c0                	test   %eax,%eax
+  102c9d:	0f 88 d7 01 00 00    	js     102e7a <naive_address_by_fname+0x228>
+			return code;
+		}
+		const void *entry_end = cu.cu_end;
+  102ca3:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+  102ca6:	89 45 a8             	mov    %eax,-0x58(%ebp)
+		Dwarf_Off abbrev_offset = cu.cu_abbrev_offset;
+		Dwarf_Small address_size = cu.cu_address_size;
+  102ca9:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  102cac:	89 45 ac             	mov    %eax,-0x54(%ebp)
+		entry = cu.cu_dies;
+  102caf:	8b 45 c0             	mov    -0x40(%ebp),%eax
+  102cb2:	89 45 b4             	mov    %eax,-0x4c(%ebp)
+		// Parse related DIE's
+		const struct Dwarf_Abbrevtab *abbrevs
+		    = dwarf_abbrevs(addrs, abbrev_offset);
+  102cb5:	83 ec 04             	sub    $0x4,%esp
+  102cb8:	ff 75 cc             	push   -0x34(%ebp)
+  102cbb:	ff 75 c8             	push   -0x38(%ebp)
+  102cbe:	ff 75 08             	push   0x8(%ebp)
+  102cc1:	e8 d7 2a 00 00       	call   10579d <dwarf_abbrevs>
+  102cc6:	89 c6                	mov    %eax,%esi
+		if (!abbrevs) {
+  102cc8:	83 c4 10             	add    $0x10,%esp
+  102ccb:	85 c0                	test   %eax,%eax
+  102ccd:	0f 85 f5 00 00 00    	jne    102dc8 <naive_address_by_fname+0x176>
+			return -E_BAD_DWARF;
+  102cd3:	b8 fa ff ff ff       	mov    $0xfffffffa,%eax
+  102cd8:	e9 9d 01 00 00       	jmp    102e7a <naive_address_by_fname+0x228>
+				for (attr = abbrev->ab_attrs;
+				     attr->as_name || attr->as_form; attr++) {
+					unsigned name = attr->as_name;
+					unsigned form = attr->as_form;
+					if (name == DW_AT_low_pc) {
+						low_pc = dwarf_read_address(
+  102cdd:	56                   	push   %esi
+  102cde:	57                   	push   %edi
+  102cdf:	8d 45 bc             	lea    -0x44(%ebp),%eax
+  102ce2:	50                   	push   %eax
+  102ce3:	ff 75 08             	push   0x8(%ebp)
+  102ce6:	e8 74 e5 ff ff       	call   10125f <dwarf_read_address>
+  102ceb:	89 45 a0             	mov    %eax,-0x60(%ebp)
+						    addrs, &cu, form, entry);
+						has_low = 1;
+  102cee:	83 c4 10             	add    $0x10,%esp
+  102cf1:	c7 45 a4 01 00 00 00 	movl   $0x1,-0x5c(%ebp)
+						if (name_str
+						    && !strcmp(fname, name_str)) {
+							found = 1;
+						}
+					}
+					count = dwarf_read_abbrev_entry(
+  102cf8:	83 ec 0c             	sub    $0xc,%esp
+  102cfb:	0f b6 45 ac          	movzbl -0x54(%ebp),%eax
+  102cff:	50                   	push   %eax
+  102d00:	6a 00                	push   $0x0
+  102d02:	6a 00                	push   $0x0
+  102d04:	57                   	push   %edi
+  102d05:	56                   	push   %esi
+  102d06:	e8 a4 db ff ff       	call   1008af <dwarf_read_abbrev_entry>
+					    entry, form, NULL, 0, address_size);
+					entry += count;
+  102d0b:	01 c6                	add    %eax,%esi
+				     attr->as_name || attr->as_form; attr++) {
+  102d0d:	83 c3 08             	add    $0x8,%ebx
+  102d10:	83 c4 20             	add    $0x20,%esp
+  102d13:	83 3b 00             	cmpl   $0x0,(%ebx)
+  102d16:	74 63                	je     102d7b <naive_address_by_fname+0x129>
+					unsigned name = attr->as_name;
+  102d18:	0f b7 03             	movzwl (%ebx),%eax
+					unsigned form = attr->as_form;
+  102d1b:	0f b7 7b 02          	movzwl 0x2(%ebx),%edi
+					if (name == DW_AT_low_pc) {
+  102d1f:	83 f8 11             	cmp    $0x11,%eax
+  102d22:	74 b9                	je     102cdd <naive_address_by_fname+0x8b>
+					} else if (name == DW_AT_name) {
+  102d24:	83 f8 03             	cmp    $0x3,%eax
+  102d27:	75 cf                	jne    102cf8 <naive_address_by_fname+0xa6>
+						    = dwarf_read_string(
+  102d29:	56                   	push   %esi
+  102d2a:	57                   	push   %edi
+  102d2b:	8d 45 bc             	lea    -0x44(%ebp),%eax
+  102d2e:	50                   	push   %eax
+  102d2f:	ff 75 08             	push   0x8(%ebp)
+  102d32:	e8 3f e4 ff ff       	call   101176 <dwarf_read_string>
+						if (name_str
+  102d37:	83 c4 10             	add    $0x10,%esp
+  102d3a:	85 c0                	test   %eax,%eax
+  102d3c:	74 ba                	je     102cf8 <naive_address_by_fname+0xa6>
+						    && !strcmp(fname, name_str)) {
+  102d3e:	83 ec 08             	sub    $0x8,%esp
+  102d41:	50                   	push   %eax
+  102d42:	ff 75 0c             	push   0xc(%ebp)
+  102d45:	e8 77 63 00 00       	call   1090c1 <strcmp>
+  102d4a:	83 c4 10             	add    $0x10,%esp
+							found = 1;
+  102d4d:	85 c0                	test   %eax,%eax
+  102d4f:	b8 01 00 00 00       	mov    $0x1,%eax
+  102d54:	0f 45 45 b0          	cmovne -0x50(%ebp),%eax
+  102d58:	89 45 b0             	mov    %eax,-0x50(%ebp)
+  102d5b:	eb 9b                	jmp    102cf8 <naive_address_by_fname+0xa6>
+				int found = 0, has_low = 0;
+  102d5d:	c7 45 a4 00 00 00 00 	movl   $0x0,-0x5c(%ebp)
+  102d64:	bf 00 00 00 00       	mov    $0x0,%edi
+				uint32_t low_pc = 0;
+  102d69:	c7 45 a0 00 00 00 00 	movl   $0x0,-0x60(%ebp)
+						has_low = 1;
+  102d70:	89 7d b0             	mov    %edi,-0x50(%ebp)
+  102d73:	89 75 9c             	mov    %esi,-0x64(%ebp)
+  102d76:	8b 75 b4             	mov    -0x4c(%ebp),%esi
+  102d79:	eb 98                	jmp    102d13 <naive_address_by_fname+0xc1>
+				}
+				// declarations and abstract instances have no
+				// address: keep looking for the definition
+				if (found && has_low) {
+  102d7b:	89 75 b4             	mov    %esi,-0x4c(%ebp)
+  102d7e:	8b 7d b0             	mov    -0x50(%ebp),%edi
+  102d81:	8b 75 9c             	mov    -0x64(%ebp),%esi
+  102d84:	85 ff                	test   %edi,%edi
+  102d86:	74 40                	je     102dc8 <naive_address_by_fname+0x176>
+  102d88:	83 7d a4 00          	cmpl   $0x0,-0x5c(%ebp)
+  102d8c:	74 3a                	je     102dc8 <naive_address_by_fname+0x176>
+					// finish if fname found
+					*offset = low_pc;
+  102d8e:	8b 45 10             	mov    0x10(%ebp),%eax
+  102d91:	8b 7d a0             	mov    -0x60(%ebp),%edi
+  102d94:	89 38                	mov    %edi,(%eax)
+					return 0;
+  102d96:	b8 00 00 00 00       	mov    $0x0,%eax
+  102d9b:	e9 da 00 00 00       	jmp    102e7a <naive_address_by_fname+0x228>
+  102da0:	ba 00 08 02 60       	mov    $0x60020800,%edx
+  102da5:	d3 ea                	shr    %cl,%edx
+  102da7:	83 e2 01             	and    $0x1,%edx
+				}
+			} else {
+				// skip if not a subprogram or label, along with
+				// its children if they can't be code
+				entry = dwarf_skip_die(
+  102daa:	83 ec 08             	sub    $0x8,%esp
+				    addrs, &cu, abbrevs, abbrev, entry,
+				    !dwarf_tag_has_code(abbrev->ab_tag));
+  102dad:	83 f2 01             	xor    $0x1,%edx
+				entry = dwarf_skip_die(
+  102db0:	52                   	push   %edx
+  102db1:	ff 75 b4             	push   -0x4c(%ebp)
+  102db4:	50                   	push   %eax
+  102db5:	56                   	push   %esi
+  102db6:	8d 45 bc             	lea    -0x44(%ebp),%eax
+  102db9:	50                   	push   %eax
+  102dba:	ff 75 08             	push   0x8(%ebp)
+  102dbd:	e8 79 f0 ff ff       	call   101e3b <dwarf_skip_die>
+  102dc2:	89 45 b4             	mov    %eax,-0x4c(%ebp)
+  102dc5:	83 c4 20             	add    $0x20,%esp
+		while (entry < entry_end) {
+  102dc8:	8b 7d a8             	mov    -0x58(%ebp),%edi
+  102dcb:	39 7d b4             	cmp    %edi,-0x4c(%ebp)
+  102dce:	0f 83 a3 fe ff ff    	jae    102c77 <naive_address_by_fname+0x25>
+	count = 0;
+  102dd4:	b8 00 00 00 00       	mov    $0x0,%eax
+	result = 0;
+  102dd9:	bf 00 00 00 00       	mov    $0x0,%edi
+  102dde:	89 75 b0             	mov    %esi,-0x50(%ebp)
+  102de1:	89 c6                	mov    %eax,%esi
+		byte = *addr;
+  102de3:	8b 5d b4             	mov    -0x4c(%ebp),%ebx
+  102de6:	0f b6 1c 03          	movzbl (%ebx,%eax,1),%ebx
+		count++;
+  102dea:	83 c0 01             	add    $0x1,%eax
+		result |= (byte & 0x7f) << shift;
+  102ded:	89 da                	mov    %ebx,%edx
+  102def:	83 e2 7f             	and    $0x7f,%edx
+  102df2:	8d 0c f5 00 00 00 00 	lea    0x0(,%esi,8),%ecx
+  102df9:	29 f1                	sub    %esi,%ecx
+  102dfb:	d3 e2                	shl    %cl,%edx
+  102dfd:	09 d7                	or     %edx,%edi
+		if (!(byte & 0x80))
+  102dff:	84 db                	test   %bl,%bl
+  102e01:	78 de                	js     102de1 <naive_address_by_fname+0x18f>
+			entry += count;
+  102e03:	8b 75 b0             	mov    -0x50(%ebp),%esi
+  102e06:	01 45 b4             	add    %eax,-0x4c(%ebp)
+			if (abbrev_code == 0) {
+  102e09:	85 ff                	test   %edi,%edi
+  102e0b:	74 bb                	je     102dc8 <naive_address_by_fname+0x176>
+	if (code >= at->at_ncodes || !at->at_abbrevs[code].ab_attrs)
+  102e0d:	3b 7e 08             	cmp    0x8(%esi),%edi
+  102e10:	73 63                	jae    102e75 <naive_address_by_fname+0x223>
+  102e12:	8d 14 bf             	lea    (%edi,%edi,4),%edx
+  102e15:	8b 46 0c             	mov    0xc(%esi),%eax
+  102e18:	8d 04 90             	lea    (%eax,%edx,4),%eax
+  102e1b:	8b 58 04             	mov    0x4(%eax),%ebx
+  102e1e:	85 db                	test   %ebx,%ebx
+  102e20:	74 60                	je     102e82 <naive_address_by_fname+0x230>
+			if (abbrev->ab_tag == DW_TAG_subprogram
+  102e22:	0f b7 08             	movzwl (%eax),%ecx
+  102e25:	66 83 f9 2e          	cmp    $0x2e,%cx
+  102e29:	0f 84 2e ff ff ff    	je     102d5d <naive_address_by_fname+0x10b>
+  102e2f:	66 83 f9 0a          	cmp    $0xa,%cx
+  102e33:	0f 84 24 ff ff ff    	je     102d5d <naive_address_by_fname+0x10b>
+	return tag == DW_TAG_compile_unit || tag == DW_TAG_partial_unit
+  102e39:	66 83 f9 1e          	cmp    $0x1e,%cx
+  102e3d:	77 14                	ja     102e53 <naive_address_by_fname+0x201>
+		|| tag == DW_TAG_module;
+  102e3f:	ba 00 00 00 00       	mov    $0x0,%edx
+  102e44:	66 83 f9 0a          	cmp    $0xa,%cx
+  102e48:	0f 86 5c ff ff ff    	jbe    102daa <naive_address_by_fname+0x158>
+  102e4e:	e9 4d ff ff ff       	jmp    102da0 <naive_address_by_fname+0x14e>
+  102e53:	83 e9 2e             	sub    $0x2e,%ecx
+  102e56:	bb 01 48 00 00       	mov    $0x4801,%ebx
+  102e5b:	d3 eb                	shr    %cl,%ebx
+  102e5d:	89 df                	mov    %ebx,%edi
+  102e5f:	83 e7 01             	and    $0x1,%edi
+  102e62:	89 fa                	mov    %edi,%edx
+  102e64:	66 83 f9 0f          	cmp    $0xf,%cx
+  102e68:	b9 00 00 00 00       	mov    $0x0,%ecx
+  102e6d:	0f 43 d1             	cmovae %ecx,%edx
+  102e70:	e9 35 ff ff ff       	jmp    102daa <naive_address_by_fname+0x158>
+				return -E_BAD_DWARF;
+  102e75:	b8 fa ff ff ff       	mov    $0xfffffffa,%eax
+			}
+		}
+	}
+
+	return -E_NO_ENT;
+}
+  102e7a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  102e7d:	5b                   	pop    %ebx
+  102e7e:	5e                   	pop    %esi
+  102e7f:	5f                   	pop    %edi
+  102e80:	5d                   	pop    %ebp
+  102e81:	c3                   	ret
+				return -E_BAD_DWARF;
+  102e82:	b8 fa ff ff ff       	mov    $0xfffffffa,%eax
+  102e87:	eb f1                	jmp    102e7a <naive_address_by_fname+0x228>
+	return -E_NO_ENT;
+  102e89:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  102e8e:	eb ea                	jmp    102e7a <naive_address_by_fname+0x228>
+		return -E_NO_ENT;
+  102e90:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  102e95:	eb e3                	jmp    102e7a <naive_address_by_fname+0x228>
+
+00102e97 <line_search_row>:
+        uintptr_t destination_addr;
+        struct Line_Number_State last_state;
+        bool found;
+};
+
+static int line_search_row(void *arg, const struct Line_Number_State *row) {
+  102e97:	55                   	push   %ebp
+  102e98:	89 e5                	mov    %esp,%ebp
+  102e9a:	8b 45 08             	mov    0x8(%ebp),%eax
+  102e9d:	8b 55 0c             	mov    0xc(%ebp),%edx
+        struct Line_Search *search = arg;
+        if (search->last_state.address <= search->destination_addr &&
+  102ea0:	8b 08                	mov    (%eax),%ecx
+  102ea2:	3b 48 04             	cmp    0x4(%eax),%ecx
+  102ea5:	72 04                	jb     102eab <line_search_row+0x14>
+  102ea7:	3b 0a                	cmp    (%edx),%ecx
+  102ea9:	72 24                	jb     102ecf <line_search_row+0x38>
+            search->destination_addr < row->address) {
+                search->found = true;
+                return 1;
+        }
+        search->last_state = *row;
+  102eab:	8b 0a                	mov    (%edx),%ecx
+  102ead:	89 48 04             	mov    %ecx,0x4(%eax)
+  102eb0:	8b 4a 04             	mov    0x4(%edx),%ecx
+  102eb3:	89 48 08             	mov    %ecx,0x8(%eax)
+  102eb6:	8b 4a 08             	mov    0x8(%edx),%ecx
+  102eb9:	89 48 0c             	mov    %ecx,0xc(%eax)
+  102ebc:	8b 4a 0c             	mov    0xc(%edx),%ecx
+  102ebf:	89 48 10             	mov    %ecx,0x10(%eax)
+  102ec2:	8b 52 10             	mov    0x10(%edx),%edx
+  102ec5:	89 50 14             	mov    %edx,0x14(%eax)
+        return 0;
+  102ec8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  102ecd:	5d                   	pop    %ebp
+  102ece:	c3                   	ret
+                search->found = true;
+  102ecf:	c6 40 18 01          	movb   $0x1,0x18(%eax)
+                return 1;
+  102ed3:	b8 01 00 00 00       	mov    $0x1,%eax
+  102ed8:	eb f3                	jmp    102ecd <line_search_row+0x36>
+
+00102eda <line_skip_row>:
+// The most sequences in a unit we decode: gcc emits one per text section.
+#define DWARF_LINE_MAXSEQ 32
+
+static int line_skip_row(void *arg, const struct Line_Number_State *row) {
+        return 0;
+}
+  102eda:	b8 00 00 00 00       	mov    $0x0,%eax
+  102edf:	c3                   	ret
+
+00102ee0 <line_sequence_start>:
+
+static int line_sequence_start(void *arg,
+                               const struct Line_Number_State *row) {
+  102ee0:	55                   	push   %ebp
+  102ee1:	89 e5                	mov    %esp,%ebp
+        *(uint32_t *)arg = row->address;
+  102ee3:	8b 45 0c             	mov    0xc(%ebp),%eax
+  102ee6:	8b 10                	mov    (%eax),%edx
+  102ee8:	8b 45 08             	mov    0x8(%ebp),%eax
+  102eeb:	89 10                	mov    %edx,(%eax)
+        return 1;
+}
+  102eed:	b8 01 00 00 00       	mov    $0x1,%eax
+  102ef2:	5d                   	pop    %ebp
+  102ef3:	c3                   	ret
+
+00102ef4 <line_encode_row>:
+                count++;
+        } while (more);
+        return count;
+}
+
+static int line_encode_row(void *arg, const struct Line_Number_State *row) {
+  102ef4:	55                   	push   %ebp
+  102ef5:	89 e5                	mov    %esp,%ebp
+  102ef7:	57                   	push   %edi
+  102ef8:	56                   	push   %esi
+  102ef9:	53                   	push   %ebx
+  102efa:	83 ec 04             	sub    $0x4,%esp
+  102efd:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  102f00:	8b 7d 0c             	mov    0xc(%ebp),%edi
+        struct Line_Encoder *enc = arg;
+        int line = row->end_sequence ? 0 : row->line;
+  102f03:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  102f0a:	80 7f 0c 00          	cmpb   $0x0,0xc(%edi)
+  102f0e:	75 06                	jne    102f16 <line_encode_row+0x22>
+  102f10:	8b 47 04             	mov    0x4(%edi),%eax
+  102f13:	89 45 f0             	mov    %eax,-0x10(%ebp)
+        if (enc->nrows % DWARF_LINE_STRIDE == 0) {
+  102f16:	8b 43 0c             	mov    0xc(%ebx),%eax
+  102f19:	a8 0f                	test   $0xf,%al
+  102f1b:	75 2f                	jne    102f4c <line_encode_row+0x58>
+                if (enc->rows) {
+  102f1d:	83 7b 04 00          	cmpl   $0x0,0x4(%ebx)
+  102f21:	0f 84 8c 00 00 00    	je     102fb3 <line_encode_row+0xbf>
+                        struct Line_Anchor *anchor =
+                            &enc->anchors[enc->nrows / DWARF_LINE_STRIDE];
+  102f27:	8d 50 0f             	lea    0xf(%eax),%edx
+  102f2a:	85 c0                	test   %eax,%eax
+  102f2c:	0f 48 c2             	cmovs  %edx,%eax
+  102f2f:	c1 f8 04             	sar    $0x4,%eax
+  102f32:	8d 14 40             	lea    (%eax,%eax,2),%edx
+                        struct Line_Anchor *anchor =
+  102f35:	8b 03                	mov    (%ebx),%eax
+  102f37:	8d 04 90             	lea    (%eax,%edx,4),%eax
+                        anchor->address = row->address;
+  102f3a:	8b 17                	mov    (%edi),%edx
+  102f3c:	89 10                	mov    %edx,(%eax)
+                        anchor->line = line;
+  102f3e:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  102f41:	89 70 04             	mov    %esi,0x4(%eax)
+                        anchor->deltas = enc->size;
+  102f44:	8b 53 08             	mov    0x8(%ebx),%edx
+  102f47:	89 50 08             	mov    %edx,0x8(%eax)
+  102f4a:	eb 67                	jmp    102fb3 <line_encode_row+0xbf>
+                }
+        } else {
+                unsigned char *p = enc->rows ? enc->rows + enc->size : NULL;
+  102f4c:	8b 73 04             	mov    0x4(%ebx),%esi
+  102f4f:	85 f6                	test   %esi,%esi
+  102f51:	74 03                	je     102f56 <line_encode_row+0x62>
+  102f53:	03 73 08             	add    0x8(%ebx),%esi
+                enc->size +=
+                    put_uleb128(p, row->address - enc->address);
+  102f56:	8b 07                	mov    (%edi),%eax
+  102f58:	2b 43 10             	sub    0x10(%ebx),%eax
+        int count = 0;
+  102f5b:	ba 00 00 00 00       	mov    $0x0,%edx
+  102f60:	e9 9b 00 00 00       	jmp    103000 <line_encode_row+0x10c>
+                more = !((val == 0 && !(byte & 0x40)) ||
+  102f65:	83 f8 ff             	cmp    $0xffffffff,%eax
+  102f68:	75 05                	jne    102f6f <line_encode_row+0x7b>
+                         (val == -1 && (byte & 0x40)));
+  102f6a:	f6 c3 40             	test   $0x40,%bl
+  102f6d:	75 2b                	jne    102f9a <line_encode_row+0xa6>
+                if (p) {
+  102f6f:	85 f6                	test   %esi,%esi
+  102f71:	0f 84 9c 00 00 00    	je     103013 <line_encode_row+0x11f>
+                        byte |= 0x80;
+  102f77:	83 c9 80             	or     $0xffffff80,%ecx
+  102f7a:	bb 01 00 00 00       	mov    $0x1,%ebx
+                        p[count] = byte;
+  102f7f:	88 0c 16             	mov    %cl,(%esi,%edx,1)
+                count++;
+  102f82:	83 c2 01             	add    $0x1,%edx
+        } while (more);
+  102f85:	84 db                	test   %bl,%bl
+  102f87:	74 1c                	je     102fa5 <line_encode_row+0xb1>
+                unsigned char byte = val & 0x7f;
+  102f89:	89 c3                	mov    %eax,%ebx
+  102f8b:	89 c1                	mov    %eax,%ecx
+  102f8d:	83 e1 7f             	and    $0x7f,%ecx
+                more = !((val == 0 && !(byte & 0x40)) ||
+  102f90:	c1 f8 07             	sar    $0x7,%eax
+  102f93:	75 d0                	jne    102f65 <line_encode_row+0x71>
+  102f95:	f6 c3 40             	test   $0x40,%bl
+  102f98:	75 d5                	jne    102f6f <line_encode_row+0x7b>
+                if (p) {
+  102f9a:	85 f6                	test   %esi,%esi
+  102f9c:	74 0c                	je     102faa <line_encode_row+0xb6>
+  102f9e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  102fa3:	eb da                	jmp    102f7f <line_encode_row+0x8b>
+  102fa5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  102fa8:	eb 06                	jmp    102fb0 <line_encode_row+0xbc>
+  102faa:	8b 5d 08             	mov    0x8(%ebp),%ebx
+                count++;
+  102fad:	83 c2 01             	add    $0x1,%edx
+                p = enc->rows ? enc->rows + enc->size : NULL;
+                enc->size += put_sleb128(p, line - enc->line);
+  102fb0:	01 53 08             	add    %edx,0x8(%ebx)
+        }
+        enc->address = row->address;
+  102fb3:	8b 07                	mov    (%edi),%eax
+  102fb5:	89 43 10             	mov    %eax,0x10(%ebx)
+        enc->line = line;
+  102fb8:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  102fbb:	89 43 14             	mov    %eax,0x14(%ebx)
+        enc->nrows++;
+  102fbe:	83 43 0c 01          	addl   $0x1,0xc(%ebx)
+        return 0;
+}
+  102fc2:	b8 00 00 00 00       	mov    $0x0,%eax
+  102fc7:	83 c4 04             	add    $0x4,%esp
+  102fca:	5b                   	pop    %ebx
+  102fcb:	5e                   	pop    %esi
+  102fcc:	5f                   	pop    %edi
+  102fcd:	5d                   	pop    %ebp
+  102fce:	c3                   	ret
+                count++;
+  102fcf:	83 c2 01             	add    $0x1,%edx
+                enc->size +=
+  102fd2:	03 53 08             	add    0x8(%ebx),%edx
+  102fd5:	89 53 08             	mov    %edx,0x8(%ebx)
+                p = enc->rows ? enc->rows + enc->size : NULL;
+  102fd8:	8b 73 04             	mov    0x4(%ebx),%esi
+  102fdb:	01 f2                	add    %esi,%edx
+  102fdd:	85 f6                	test   %esi,%esi
+  102fdf:	0f 45 f2             	cmovne %edx,%esi
+                enc->size += put_sleb128(p, line - enc->line);
+  102fe2:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  102fe5:	2b 43 14             	sub    0x14(%ebx),%eax
+        int count = 0;
+  102fe8:	ba 00 00 00 00       	mov    $0x0,%edx
+                        byte |= 0x80;
+  102fed:	89 5d 08             	mov    %ebx,0x8(%ebp)
+  102ff0:	eb 97                	jmp    102f89 <line_encode_row+0x95>
+                if (p) {
+  102ff2:	85 f6                	test   %esi,%esi
+  102ff4:	74 d9                	je     102fcf <line_encode_row+0xdb>
+                        p[count] = byte;
+  102ff6:	88 0c 16             	mov    %cl,(%esi,%edx,1)
+                count++;
+  102ff9:	83 c2 01             	add    $0x1,%edx
+        } while (val);
+  102ffc:	85 c0                	test   %eax,%eax
+  102ffe:	74 d2                	je     102fd2 <line_encode_row+0xde>
+                unsigned char byte = val & 0x7f;
+  103000:	89 c1                	mov    %eax,%ecx
+  103002:	83 e1 7f             	and    $0x7f,%ecx
+                if (val) {
+  103005:	c1 e8 07             	shr    $0x7,%eax
+  103008:	74 e8                	je     102ff2 <line_encode_row+0xfe>
+                if (p) {
+  10300a:	85 f6                	test   %esi,%esi
+  10300c:	74 0d                	je     10301b <line_encode_row+0x127>
+                        byte |= 0x80;
+  10300e:	83 c9 80             	or     $0xffffff80,%ecx
+  103011:	eb e3                	jmp    102ff6 <line_encode_row+0x102>
+                count++;
+  103013:	83 c2 01             	add    $0x1,%edx
+        } while (more);
+  103016:	e9 6e ff ff ff       	jmp    102f89 <line_encode_row+0x95>
+                count++;
+  10301b:	83 c2 01             	add    $0x1,%edx
+        } while (val);
+  10301e:	eb e0                	jmp    103000 <line_encode_row+0x10c>
+
+00103020 <run_line_number_program>:
+                                           line_row_fn row_fn, void *arg) {
+  103020:	55                   	push   %ebp
+  103021:	89 e5                	mov    %esp,%ebp
+  103023:	57                   	push   %edi
+  103024:	56                   	push   %esi
+  103025:	53                   	push   %ebx
+  103026:	83 ec 4c             	sub    $0x4c,%esp
+  103029:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+  10302c:	89 55 bc             	mov    %edx,-0x44(%ebp)
+  10302f:	89 4d c0             	mov    %ecx,-0x40(%ebp)
+        struct Line_Number_State state = {
+  103032:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+  103039:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+  103040:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%ebp)
+  103047:	c6 45 e0 00          	movb   $0x0,-0x20(%ebp)
+  10304b:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+        while (program_addr < end_addr) {
+  103052:	e9 8c 03 00 00       	jmp    1033e3 <run_line_number_program+0x3c3>
+	count = 0;
+  103057:	b8 00 00 00 00       	mov    $0x0,%eax
+	result = 0;
+  10305c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  103061:	89 de                	mov    %ebx,%esi
+  103063:	89 7d b8             	mov    %edi,-0x48(%ebp)
+  103066:	89 c7                	mov    %eax,%edi
+		byte = *addr;
+  103068:	8b 5d c4             	mov    -0x3c(%ebp),%ebx
+  10306b:	0f b6 5c 03 01       	movzbl 0x1(%ebx,%eax,1),%ebx
+		count++;
+  103070:	83 c0 01             	add    $0x1,%eax
+		result |= (byte & 0x7f) << shift;
+  103073:	89 da                	mov    %ebx,%edx
+  103075:	83 e2 7f             	and    $0x7f,%edx
+  103078:	8d 0c fd 00 00 00 00 	lea    0x0(,%edi,8),%ecx
+  10307f:	29 f9                	sub    %edi,%ecx
+  103081:	d3 e2                	shl    %cl,%edx
+  103083:	09 d6                	or     %edx,%esi
+		if (!(byte & 0x80))
+  103085:	84 db                	test   %bl,%bl
+  103087:	78 dd                	js     103066 <run_line_number_program+0x46>
+                        program_addr += count;
+  103089:	89 f3                	mov    %esi,%ebx
+  10308b:	8b 7d b8             	mov    -0x48(%ebp),%edi
+  10308e:	8d 34 07             	lea    (%edi,%eax,1),%esi
+                        const void *opcode_end = program_addr + length;
+  103091:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+  103094:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+                        opcode = get_unaligned(program_addr, Dwarf_Small);
+  103097:	83 ec 04             	sub    $0x4,%esp
+  10309a:	6a 01                	push   $0x1
+  10309c:	56                   	push   %esi
+  10309d:	8d 45 d0             	lea    -0x30(%ebp),%eax
+  1030a0:	50                   	push   %eax
+  1030a1:	e8 52 61 00 00       	call   1091f8 <memcpy>
+  1030a6:	0f b6 45 d0          	movzbl -0x30(%ebp),%eax
+                        program_addr += sizeof(Dwarf_Small);
+  1030aa:	8d 7e 01             	lea    0x1(%esi),%edi
+                        switch (opcode) {
+  1030ad:	83 c4 10             	add    $0x10,%esp
+  1030b0:	3c 03                	cmp    $0x3,%al
+  1030b2:	0f 84 cf 00 00 00    	je     103187 <run_line_number_program+0x167>
+  1030b8:	77 4c                	ja     103106 <run_line_number_program+0xe6>
+  1030ba:	3c 01                	cmp    $0x1,%al
+  1030bc:	0f 84 89 00 00 00    	je     10314b <run_line_number_program+0x12b>
+  1030c2:	3c 02                	cmp    $0x2,%al
+  1030c4:	0f 85 02 01 00 00    	jne    1031cc <run_line_number_program+0x1ac>
+                                    get_unaligned(program_addr, uint32_t);
+  1030ca:	83 ec 04             	sub    $0x4,%esp
+  1030cd:	6a 04                	push   $0x4
+  1030cf:	57                   	push   %edi
+  1030d0:	8d 45 d0             	lea    -0x30(%ebp),%eax
+  1030d3:	50                   	push   %eax
+  1030d4:	e8 1f 61 00 00       	call   1091f8 <memcpy>
+  1030d9:	8b 45 d0             	mov    -0x30(%ebp),%eax
+                                state.address = addr;
+  1030dc:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+                                program_addr += sizeof(uint32_t);
+  1030df:	8d 46 05             	lea    0x5(%esi),%eax
+                        } break;
+  1030e2:	83 c4 10             	add    $0x10,%esp
+                        assert(program_addr == opcode_end);
+  1030e5:	8b 7d c4             	mov    -0x3c(%ebp),%edi
+  1030e8:	39 f8                	cmp    %edi,%eax
+  1030ea:	0f 84 f3 02 00 00    	je     1033e3 <run_line_number_program+0x3c3>
+  1030f0:	68 85 9a 10 00       	push   $0x109a85
+  1030f5:	68 00 95 10 00       	push   $0x109500
+  1030fa:	6a 71                	push   $0x71
+  1030fc:	68 a0 9a 10 00       	push   $0x109aa0
+  103101:	e8 81 cf ff ff       	call   100087 <_panic>
+                        switch (opcode) {
+  103106:	3c 04                	cmp    $0x4,%al
+  103108:	0f 85 be 00 00 00    	jne    1031cc <run_line_number_program+0x1ac>
+  10310e:	b8 00 00 00 00       	mov    $0x0,%eax
+  103113:	c7 45 b8 00 00 00 00 	movl   $0x0,-0x48(%ebp)
+  10311a:	89 7d b4             	mov    %edi,-0x4c(%ebp)
+  10311d:	89 c7                	mov    %eax,%edi
+		byte = *addr;
+  10311f:	0f b6 5c 06 01       	movzbl 0x1(%esi,%eax,1),%ebx
+		count++;
+  103124:	83 c0 01             	add    $0x1,%eax
+		result |= (byte & 0x7f) << shift;
+  103127:	89 da                	mov    %ebx,%edx
+  103129:	83 e2 7f             	and    $0x7f,%edx
+  10312c:	8d 0c fd 00 00 00 00 	lea    0x0(,%edi,8),%ecx
+  103133:	29 f9                	sub    %edi,%ecx
+  103135:	d3 e2                	shl    %cl,%edx
+  103137:	09 55 b8             	or     %edx,-0x48(%ebp)
+		if (!(byte & 0x80))
+  10313a:	84 db                	test   %bl,%bl
+  10313c:	78 df                	js     10311d <run_line_number_program+0xfd>
+                                state.discriminator = discriminator;
+  10313e:	8b 7d b4             	mov    -0x4c(%ebp),%edi
+  103141:	8b 75 b8             	mov    -0x48(%ebp),%esi
+  103144:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+                                program_addr += count;
+  103147:	01 f8                	add    %edi,%eax
+                        } break;
+  103149:	eb 9a                	jmp    1030e5 <run_line_number_program+0xc5>
+                                state.end_sequence = true;
+  10314b:	c6 45 e0 01          	movb   $0x1,-0x20(%ebp)
+                                row_fn(arg, &state);
+  10314f:	83 ec 08             	sub    $0x8,%esp
+  103152:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+  103155:	50                   	push   %eax
+  103156:	ff 75 0c             	push   0xc(%ebp)
+  103159:	ff 55 08             	call   *0x8(%ebp)
+                                assert(program_addr == opcode_end);
+  10315c:	83 c4 10             	add    $0x10,%esp
+  10315f:	39 7d c4             	cmp    %edi,-0x3c(%ebp)
+  103162:	75 0a                	jne    10316e <run_line_number_program+0x14e>
+}
+  103164:	89 f8                	mov    %edi,%eax
+  103166:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  103169:	5b                   	pop    %ebx
+  10316a:	5e                   	pop    %esi
+  10316b:	5f                   	pop    %edi
+  10316c:	5d                   	pop    %ebp
+  10316d:	c3                   	ret
+                                assert(program_addr == opcode_end);
+  10316e:	68 85 9a 10 00       	push   $0x109a85
+  103173:	68 00 95 10 00       	push   $0x109500
+  103178:	6a 49                	push   $0x49
+  10317a:	68 a0 9a 10 00       	push   $0x109aa0
+  10317f:	e8 03 cf ff ff       	call   100087 <_panic>
+                                        ++program_addr;
+  103184:	83 c7 01             	add    $0x1,%edi
+                                while (*(char *)program_addr) {
+  103187:	80 3f 00             	cmpb   $0x0,(%edi)
+  10318a:	75 f8                	jne    103184 <run_line_number_program+0x164>
+	count = 0;
+  10318c:	b8 00 00 00 00       	mov    $0x0,%eax
+		byte = *addr;
+  103191:	0f b6 54 07 01       	movzbl 0x1(%edi,%eax,1),%edx
+		count++;
+  103196:	89 c1                	mov    %eax,%ecx
+  103198:	83 c0 01             	add    $0x1,%eax
+		if (!(byte & 0x80))
+  10319b:	84 d2                	test   %dl,%dl
+  10319d:	78 f2                	js     103191 <run_line_number_program+0x171>
+                                program_addr += count;
+  10319f:	8d 44 0f 02          	lea    0x2(%edi,%ecx,1),%eax
+	count = 0;
+  1031a3:	ba 00 00 00 00       	mov    $0x0,%edx
+		byte = *addr;
+  1031a8:	0f b6 0c 10          	movzbl (%eax,%edx,1),%ecx
+		count++;
+  1031ac:	83 c2 01             	add    $0x1,%edx
+		if (!(byte & 0x80))
+  1031af:	84 c9                	test   %cl,%cl
+  1031b1:	78 f5                	js     1031a8 <run_line_number_program+0x188>
+                                program_addr += count;
+  1031b3:	01 d0                	add    %edx,%eax
+	count = 0;
+  1031b5:	ba 00 00 00 00       	mov    $0x0,%edx
+		byte = *addr;
+  1031ba:	0f b6 0c 10          	movzbl (%eax,%edx,1),%ecx
+		count++;
+  1031be:	83 c2 01             	add    $0x1,%edx
+		if (!(byte & 0x80))
+  1031c1:	84 c9                	test   %cl,%cl
+  1031c3:	78 f5                	js     1031ba <run_line_number_program+0x19a>
+                                program_addr += count;
+  1031c5:	01 d0                	add    %edx,%eax
+                        } break;
+  1031c7:	e9 19 ff ff ff       	jmp    1030e5 <run_line_number_program+0xc5>
+                        switch (opcode) {
+  1031cc:	0f b6 c0             	movzbl %al,%eax
+                                panic("Unknown opcode: %x", opcode);
+  1031cf:	50                   	push   %eax
+  1031d0:	68 b3 9a 10 00       	push   $0x109ab3
+  1031d5:	6a 6e                	push   $0x6e
+  1031d7:	68 a0 9a 10 00       	push   $0x109aa0
+  1031dc:	e8 a6 ce ff ff       	call   100087 <_panic>
+                                if (row_fn(arg, &state)) {
+  1031e1:	83 ec 08             	sub    $0x8,%esp
+  1031e4:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+  1031e7:	50                   	push   %eax
+  1031e8:	ff 75 0c             	push   0xc(%ebp)
+  1031eb:	ff 55 08             	call   *0x8(%ebp)
+  1031ee:	83 c4 10             	add    $0x10,%esp
+  1031f1:	85 c0                	test   %eax,%eax
+  1031f3:	0f 85 6b ff ff ff    	jne    103164 <run_line_number_program+0x144>
+                                state.discriminator = 0;
+  1031f9:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+                program_addr += sizeof(Dwarf_Small);
+  103200:	89 7d c4             	mov    %edi,-0x3c(%ebp)
+                                break;
+  103203:	e9 db 01 00 00       	jmp    1033e3 <run_line_number_program+0x3c3>
+                        switch (opcode) {
+  103208:	bb 00 00 00 00       	mov    $0x0,%ebx
+  10320d:	be 00 00 00 00       	mov    $0x0,%esi
+  103212:	89 7d b8             	mov    %edi,-0x48(%ebp)
+  103215:	89 df                	mov    %ebx,%edi
+		byte = *addr;
+  103217:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+  10321a:	0f b6 54 18 01       	movzbl 0x1(%eax,%ebx,1),%edx
+		count++;
+  10321f:	83 c3 01             	add    $0x1,%ebx
+		result |= (byte & 0x7f) << shift;
+  103222:	89 d0                	mov    %edx,%eax
+  103224:	83 e0 7f             	and    $0x7f,%eax
+  103227:	8d 0c fd 00 00 00 00 	lea    0x0(,%edi,8),%ecx
+  10322e:	29 f9                	sub    %edi,%ecx
+  103230:	d3 e0                	shl    %cl,%eax
+  103232:	09 c6                	or     %eax,%esi
+		if (!(byte & 0x80))
+  103234:	84 d2                	test   %dl,%dl
+  103236:	78 dd                	js     103215 <run_line_number_program+0x1f5>
+                                     info->maximum_operations_per_instruction);
+  103238:	8b 7d b8             	mov    -0x48(%ebp),%edi
+  10323b:	8b 45 c0             	mov    -0x40(%ebp),%eax
+  10323e:	0f b6 48 01          	movzbl 0x1(%eax),%ecx
+                                    (op_advance /
+  103242:	89 f0                	mov    %esi,%eax
+  103244:	ba 00 00 00 00       	mov    $0x0,%edx
+  103249:	f7 f1                	div    %ecx
+  10324b:	89 c6                	mov    %eax,%esi
+                                    info->minimum_instruction_length *
+  10324d:	8b 45 c0             	mov    -0x40(%ebp),%eax
+  103250:	0f b6 10             	movzbl (%eax),%edx
+  103253:	0f af f2             	imul   %edx,%esi
+                                state.address +=
+  103256:	01 75 d4             	add    %esi,-0x2c(%ebp)
+                                program_addr += count;
+  103259:	8d 04 1f             	lea    (%edi,%ebx,1),%eax
+  10325c:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+                        } break;
+  10325f:	e9 7f 01 00 00       	jmp    1033e3 <run_line_number_program+0x3c3>
+                        switch (opcode) {
+  103264:	ba 00 00 00 00       	mov    $0x0,%edx
+  103269:	b9 00 00 00 00       	mov    $0x0,%ecx
+  10326e:	be 00 00 00 00       	mov    $0x0,%esi
+  103273:	89 7d b8             	mov    %edi,-0x48(%ebp)
+  103276:	8b 7d c4             	mov    -0x3c(%ebp),%edi
+		byte = *addr;
+  103279:	0f b6 5c 17 01       	movzbl 0x1(%edi,%edx,1),%ebx
+		result |= (byte & 0x7f) << shift;
+  10327e:	89 d8                	mov    %ebx,%eax
+  103280:	83 e0 7f             	and    $0x7f,%eax
+  103283:	d3 e0                	shl    %cl,%eax
+  103285:	09 c6                	or     %eax,%esi
+		shift += 7;
+  103287:	83 c1 07             	add    $0x7,%ecx
+		count++;
+  10328a:	83 c2 01             	add    $0x1,%edx
+		if (!(byte & 0x80))
+  10328d:	84 db                	test   %bl,%bl
+  10328f:	78 e8                	js     103279 <run_line_number_program+0x259>
+	if ((shift < num_bits) && (byte & 0x40))
+  103291:	8b 7d b8             	mov    -0x48(%ebp),%edi
+  103294:	83 f9 1f             	cmp    $0x1f,%ecx
+  103297:	7f 0e                	jg     1032a7 <run_line_number_program+0x287>
+  103299:	f6 c3 40             	test   $0x40,%bl
+  10329c:	74 09                	je     1032a7 <run_line_number_program+0x287>
+		result |= (-1U << shift);
+  10329e:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  1032a3:	d3 e0                	shl    %cl,%eax
+  1032a5:	09 c6                	or     %eax,%esi
+                                state.line += line_incr;
+  1032a7:	01 75 d8             	add    %esi,-0x28(%ebp)
+                                program_addr += count;
+  1032aa:	8d 04 17             	lea    (%edi,%edx,1),%eax
+  1032ad:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+                        } break;
+  1032b0:	e9 2e 01 00 00       	jmp    1033e3 <run_line_number_program+0x3c3>
+                        switch (opcode) {
+  1032b5:	b8 00 00 00 00       	mov    $0x0,%eax
+  1032ba:	8b 4d c4             	mov    -0x3c(%ebp),%ecx
+		byte = *addr;
+  1032bd:	0f b6 54 01 01       	movzbl 0x1(%ecx,%eax,1),%edx
+		count++;
+  1032c2:	83 c0 01             	add    $0x1,%eax
+		if (!(byte & 0x80))
+  1032c5:	84 d2                	test   %dl,%dl
+  1032c7:	78 f4                	js     1032bd <run_line_number_program+0x29d>
+                                program_addr += count;
+  1032c9:	01 f8                	add    %edi,%eax
+  1032cb:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+                        } break;
+  1032ce:	e9 10 01 00 00       	jmp    1033e3 <run_line_number_program+0x3c3>
+                        switch (opcode) {
+  1032d3:	b8 00 00 00 00       	mov    $0x0,%eax
+  1032d8:	be 00 00 00 00       	mov    $0x0,%esi
+  1032dd:	89 7d b8             	mov    %edi,-0x48(%ebp)
+  1032e0:	89 c7                	mov    %eax,%edi
+		byte = *addr;
+  1032e2:	8b 5d c4             	mov    -0x3c(%ebp),%ebx
+  1032e5:	0f b6 5c 03 01       	movzbl 0x1(%ebx,%eax,1),%ebx
+		count++;
+  1032ea:	83 c0 01             	add    $0x1,%eax
+		result |= (byte & 0x7f) << shift;
+  1032ed:	89 da                	mov    %ebx,%edx
+  1032ef:	83 e2 7f             	and    $0x7f,%edx
+  1032f2:	8d 0c fd 00 00 00 00 	lea    0x0(,%edi,8),%ecx
+  1032f9:	29 f9                	sub    %edi,%ecx
+  1032fb:	d3 e2                	shl    %cl,%edx
+  1032fd:	09 d6                	or     %edx,%esi
+		if (!(byte & 0x80))
+  1032ff:	84 db                	test   %bl,%bl
+  103301:	78 dd                	js     1032e0 <run_line_number_program+0x2c0>
+                                state.column = column;
+  103303:	8b 7d b8             	mov    -0x48(%ebp),%edi
+  103306:	89 75 dc             	mov    %esi,-0x24(%ebp)
+                                program_addr += count;
+  103309:	01 f8                	add    %edi,%eax
+  10330b:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+                        } break;
+  10330e:	e9 d0 00 00 00       	jmp    1033e3 <run_line_number_program+0x3c3>
+                                Dwarf_Small adjusted_opcode =
+  103313:	f7 d2                	not    %edx
+                                    adjusted_opcode / info->line_range;
+  103315:	0f b6 c2             	movzbl %dl,%eax
+  103318:	8b 75 c0             	mov    -0x40(%ebp),%esi
+  10331b:	f6 76 03             	divb   0x3(%esi)
+                                int op_advance =
+  10331e:	0f b6 c0             	movzbl %al,%eax
+                                     info->maximum_operations_per_instruction);
+  103321:	0f b6 4e 01          	movzbl 0x1(%esi),%ecx
+                                    (op_advance /
+  103325:	99                   	cltd
+  103326:	f7 f9                	idiv   %ecx
+                                    info->minimum_instruction_length *
+  103328:	0f b6 16             	movzbl (%esi),%edx
+  10332b:	0f af c2             	imul   %edx,%eax
+                                state.address +=
+  10332e:	01 45 d4             	add    %eax,-0x2c(%ebp)
+                program_addr += sizeof(Dwarf_Small);
+  103331:	89 7d c4             	mov    %edi,-0x3c(%ebp)
+                        } break;
+  103334:	e9 aa 00 00 00       	jmp    1033e3 <run_line_number_program+0x3c3>
+                                    get_unaligned(program_addr, Dwarf_Half);
+  103339:	83 ec 04             	sub    $0x4,%esp
+  10333c:	6a 02                	push   $0x2
+  10333e:	57                   	push   %edi
+  10333f:	8d 45 d0             	lea    -0x30(%ebp),%eax
+  103342:	50                   	push   %eax
+  103343:	e8 b0 5e 00 00       	call   1091f8 <memcpy>
+                                state.address += pc_inc;
+  103348:	0f b7 45 d0          	movzwl -0x30(%ebp),%eax
+  10334c:	01 45 d4             	add    %eax,-0x2c(%ebp)
+                                program_addr += sizeof(Dwarf_Half);
+  10334f:	83 45 c4 03          	addl   $0x3,-0x3c(%ebp)
+                        } break;
+  103353:	83 c4 10             	add    $0x10,%esp
+  103356:	e9 88 00 00 00       	jmp    1033e3 <run_line_number_program+0x3c3>
+                        switch (opcode) {
+  10335b:	b8 00 00 00 00       	mov    $0x0,%eax
+  103360:	8b 4d c4             	mov    -0x3c(%ebp),%ecx
+		byte = *addr;
+  103363:	0f b6 54 01 01       	movzbl 0x1(%ecx,%eax,1),%edx
+		count++;
+  103368:	83 c0 01             	add    $0x1,%eax
+		if (!(byte & 0x80))
+  10336b:	84 d2                	test   %dl,%dl
+  10336d:	78 f4                	js     103363 <run_line_number_program+0x343>
+                                program_addr += count;
+  10336f:	01 f8                	add    %edi,%eax
+  103371:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+                        } break;
+  103374:	eb 6d                	jmp    1033e3 <run_line_number_program+0x3c3>
+                        switch (opcode) {
+  103376:	0f b6 c0             	movzbl %al,%eax
+                                panic("Unknown opcode: %x", opcode);
+  103379:	50                   	push   %eax
+  10337a:	68 b3 9a 10 00       	push   $0x109ab3
+  10337f:	68 c1 00 00 00       	push   $0xc1
+  103384:	68 a0 9a 10 00       	push   $0x109aa0
+  103389:	e8 f9 cc ff ff       	call   100087 <_panic>
+                        Dwarf_Small adjusted_opcode =
+  10338e:	29 d0                	sub    %edx,%eax
+                        int op_advance = adjusted_opcode / info->line_range;
+  103390:	8b 75 c0             	mov    -0x40(%ebp),%esi
+  103393:	0f b6 5e 03          	movzbl 0x3(%esi),%ebx
+  103397:	88 5d c4             	mov    %bl,-0x3c(%ebp)
+                        state.line += (info->line_base +
+  10339a:	0f be 56 02          	movsbl 0x2(%esi),%edx
+                                       (adjusted_opcode % info->line_range));
+  10339e:	0f b6 c0             	movzbl %al,%eax
+  1033a1:	f6 f3                	div    %bl
+  1033a3:	0f b6 cc             	movzbl %ah,%ecx
+  1033a6:	0f b6 c9             	movzbl %cl,%ecx
+                        state.line += (info->line_base +
+  1033a9:	01 ca                	add    %ecx,%edx
+  1033ab:	01 55 d8             	add    %edx,-0x28(%ebp)
+                        int op_advance = adjusted_opcode / info->line_range;
+  1033ae:	0f b6 c0             	movzbl %al,%eax
+                             info->maximum_operations_per_instruction);
+  1033b1:	0f b6 4e 01          	movzbl 0x1(%esi),%ecx
+                            (op_advance /
+  1033b5:	99                   	cltd
+  1033b6:	f7 f9                	idiv   %ecx
+                            info->minimum_instruction_length *
+  1033b8:	0f b6 16             	movzbl (%esi),%edx
+  1033bb:	0f af c2             	imul   %edx,%eax
+                        state.address +=
+  1033be:	01 45 d4             	add    %eax,-0x2c(%ebp)
+                        if (row_fn(arg, &state)) {
+  1033c1:	83 ec 08             	sub    $0x8,%esp
+  1033c4:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+  1033c7:	50                   	push   %eax
+  1033c8:	ff 75 0c             	push   0xc(%ebp)
+  1033cb:	ff 55 08             	call   *0x8(%ebp)
+  1033ce:	83 c4 10             	add    $0x10,%esp
+  1033d1:	85 c0                	test   %eax,%eax
+  1033d3:	0f 85 8b fd ff ff    	jne    103164 <run_line_number_program+0x144>
+                        state.discriminator = 0;
+  1033d9:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+                program_addr += sizeof(Dwarf_Small);
+  1033e0:	89 7d c4             	mov    %edi,-0x3c(%ebp)
+        while (program_addr < end_addr) {
+  1033e3:	8b 75 bc             	mov    -0x44(%ebp),%esi
+  1033e6:	39 75 c4             	cmp    %esi,-0x3c(%ebp)
+  1033e9:	73 4a                	jae    103435 <run_line_number_program+0x415>
+                Dwarf_Small opcode = get_unaligned(program_addr, Dwarf_Small);
+  1033eb:	83 ec 04             	sub    $0x4,%esp
+  1033ee:	6a 01                	push   $0x1
+  1033f0:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+  1033f3:	56                   	push   %esi
+  1033f4:	8d 45 d0             	lea    -0x30(%ebp),%eax
+  1033f7:	50                   	push   %eax
+  1033f8:	e8 fb 5d 00 00       	call   1091f8 <memcpy>
+  1033fd:	0f b6 45 d0          	movzbl -0x30(%ebp),%eax
+                program_addr += sizeof(Dwarf_Small);
+  103401:	8d 7e 01             	lea    0x1(%esi),%edi
+                if (opcode == 0) {
+  103404:	83 c4 10             	add    $0x10,%esp
+  103407:	84 c0                	test   %al,%al
+  103409:	0f 84 48 fc ff ff    	je     103057 <run_line_number_program+0x37>
+                } else if (opcode < info->opcode_base) {
+  10340f:	8b 5d c0             	mov    -0x40(%ebp),%ebx
+  103412:	0f b6 53 04          	movzbl 0x4(%ebx),%edx
+  103416:	38 d0                	cmp    %dl,%al
+  103418:	0f 83 70 ff ff ff    	jae    10338e <run_line_number_program+0x36e>
+                        switch (opcode) {
+  10341e:	3c 0c                	cmp    $0xc,%al
+  103420:	0f 87 50 ff ff ff    	ja     103376 <run_line_number_program+0x356>
+  103426:	0f b6 c8             	movzbl %al,%ecx
+  103429:	ff 24 8d e8 9a 10 00 	jmp    *0x109ae8(,%ecx,4)
+  103430:	89 7d c4             	mov    %edi,-0x3c(%ebp)
+  103433:	eb ae                	jmp    1033e3 <run_line_number_program+0x3c3>
+  103435:	8b 7d c4             	mov    -0x3c(%ebp),%edi
+  103438:	e9 27 fd ff ff       	jmp    103164 <run_line_number_program+0x144>
+
+0010343d <line_file_entry>:
+// entries have the `nformat` (content type, form) pairs at `format`, and
+// store its path and directory index.  Returns the size of the entry.
+static int line_file_entry(const struct Dwarf_Addrs *addrs,
+                           const struct Dwarf_CU *cu, const char *p,
+                           const char *format, int nformat,
+                           const char **path, unsigned *dir) {
+  10343d:	55                   	push   %ebp
+  10343e:	89 e5                	mov    %esp,%ebp
+  103440:	57                   	push   %edi
+  103441:	56                   	push   %esi
+  103442:	53                   	push   %ebx
+  103443:	83 ec 2c             	sub    $0x2c,%esp
+  103446:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  103449:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+        const char *start = p;
+        int i;
+        for (i = 0; i < nformat; i++) {
+  10344c:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%ebp)
+  103453:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  103456:	89 4d cc             	mov    %ecx,-0x34(%ebp)
+  103459:	eb 3a                	jmp    103495 <line_file_entry+0x58>
+                unsigned type = 0, form = 0;
+                format += dwarf_read_uleb128(format, &type);
+                format += dwarf_read_uleb128(format, &form);
+                if (type == DW_LNCT_path) {
+                        *path = dwarf_read_string(addrs, cu, form, p);
+  10345b:	ff 75 e0             	push   -0x20(%ebp)
+  10345e:	56                   	push   %esi
+  10345f:	ff 75 d4             	push   -0x2c(%ebp)
+  103462:	ff 75 d0             	push   -0x30(%ebp)
+  103465:	e8 0c dd ff ff       	call   101176 <dwarf_read_string>
+  10346a:	8b 75 10             	mov    0x10(%ebp),%esi
+  10346d:	89 06                	mov    %eax,(%esi)
+  10346f:	83 c4 10             	add    $0x10,%esp
+                } else if (type == DW_LNCT_directory_index) {
+                        *dir = 0;
+                        dwarf_read_abbrev_entry(p, form, dir, sizeof(*dir),
+                                                cu->cu_address_size);
+                }
+                p += dwarf_read_abbrev_entry(p, form, NULL, 0,
+  103472:	83 ec 0c             	sub    $0xc,%esp
+  103475:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  103478:	ff 70 18             	push   0x18(%eax)
+  10347b:	6a 00                	push   $0x0
+  10347d:	6a 00                	push   $0x0
+  10347f:	53                   	push   %ebx
+  103480:	8b 75 e0             	mov    -0x20(%ebp),%esi
+  103483:	56                   	push   %esi
+  103484:	e8 26 d4 ff ff       	call   1008af <dwarf_read_abbrev_entry>
+  103489:	01 c6                	add    %eax,%esi
+  10348b:	89 75 e0             	mov    %esi,-0x20(%ebp)
+        for (i = 0; i < nformat; i++) {
+  10348e:	83 45 dc 01          	addl   $0x1,-0x24(%ebp)
+  103492:	83 c4 20             	add    $0x20,%esp
+  103495:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  103498:	3b 45 0c             	cmp    0xc(%ebp),%eax
+  10349b:	0f 8d aa 00 00 00    	jge    10354b <line_file_entry+0x10e>
+	count = 0;
+  1034a1:	b8 00 00 00 00       	mov    $0x0,%eax
+	result = 0;
+  1034a6:	bf 00 00 00 00       	mov    $0x0,%edi
+  1034ab:	89 c6                	mov    %eax,%esi
+		byte = *addr;
+  1034ad:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  1034b0:	0f b6 1c 03          	movzbl (%ebx,%eax,1),%ebx
+		count++;
+  1034b4:	83 c0 01             	add    $0x1,%eax
+		result |= (byte & 0x7f) << shift;
+  1034b7:	89 da                	mov    %ebx,%edx
+  1034b9:	83 e2 7f             	and    $0x7f,%edx
+  1034bc:	8d 0c f5 00 00 00 00 	lea    0x0(,%esi,8),%ecx
+  1034c3:	29 f1                	sub    %esi,%ecx
+  1034c5:	d3 e2                	shl    %cl,%edx
+  1034c7:	09 d7                	or     %edx,%edi
+		if (!(byte & 0x80))
+  1034c9:	84 db                	test   %bl,%bl
+  1034cb:	78 de                	js     1034ab <line_file_entry+0x6e>
+                format += dwarf_read_uleb128(format, &type);
+  1034cd:	03 45 08             	add    0x8(%ebp),%eax
+  1034d0:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	count = 0;
+  1034d3:	ba 00 00 00 00       	mov    $0x0,%edx
+	result = 0;
+  1034d8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  1034dd:	89 de                	mov    %ebx,%esi
+  1034df:	89 7d d8             	mov    %edi,-0x28(%ebp)
+  1034e2:	89 d7                	mov    %edx,%edi
+		byte = *addr;
+  1034e4:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  1034e7:	0f b6 1c 10          	movzbl (%eax,%edx,1),%ebx
+		count++;
+  1034eb:	83 c2 01             	add    $0x1,%edx
+		result |= (byte & 0x7f) << shift;
+  1034ee:	89 d8                	mov    %ebx,%eax
+  1034f0:	83 e0 7f             	and    $0x7f,%eax
+  1034f3:	8d 0c fd 00 00 00 00 	lea    0x0(,%edi,8),%ecx
+  1034fa:	29 f9                	sub    %edi,%ecx
+  1034fc:	d3 e0                	shl    %cl,%eax
+  1034fe:	09 c6                	or     %eax,%esi
+		if (!(byte & 0x80))
+  103500:	84 db                	test   %bl,%bl
+  103502:	78 de                	js     1034e2 <line_file_entry+0xa5>
+                format += dwarf_read_uleb128(format, &form);
+  103504:	89 f3                	mov    %esi,%ebx
+  103506:	8b 7d d8             	mov    -0x28(%ebp),%edi
+  103509:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  10350c:	01 d0                	add    %edx,%eax
+  10350e:	89 45 08             	mov    %eax,0x8(%ebp)
+                if (type == DW_LNCT_path) {
+  103511:	83 ff 01             	cmp    $0x1,%edi
+  103514:	0f 84 41 ff ff ff    	je     10345b <line_file_entry+0x1e>
+                } else if (type == DW_LNCT_directory_index) {
+  10351a:	83 ff 02             	cmp    $0x2,%edi
+  10351d:	0f 85 4f ff ff ff    	jne    103472 <line_file_entry+0x35>
+                        *dir = 0;
+  103523:	8b 45 14             	mov    0x14(%ebp),%eax
+  103526:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+                        dwarf_read_abbrev_entry(p, form, dir, sizeof(*dir),
+  10352c:	83 ec 0c             	sub    $0xc,%esp
+  10352f:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  103532:	ff 70 18             	push   0x18(%eax)
+  103535:	6a 04                	push   $0x4
+  103537:	ff 75 14             	push   0x14(%ebp)
+  10353a:	56                   	push   %esi
+  10353b:	ff 75 e0             	push   -0x20(%ebp)
+  10353e:	e8 6c d3 ff ff       	call   1008af <dwarf_read_abbrev_entry>
+  103543:	83 c4 20             	add    $0x20,%esp
+  103546:	e9 27 ff ff ff       	jmp    103472 <line_file_entry+0x35>
+                                             cu->cu_address_size);
+        }
+        return p - start;
+  10354b:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  10354e:	8b 75 cc             	mov    -0x34(%ebp),%esi
+  103551:	89 f8                	mov    %edi,%eax
+  103553:	29 f0                	sub    %esi,%eax
+}
+  103555:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  103558:	5b                   	pop    %ebx
+  103559:	5e                   	pop    %esi
+  10355a:	5f                   	pop    %edi
+  10355b:	5d                   	pop    %ebp
+  10355c:	c3                   	ret
+
+0010355d <line_file_dir>:
+
+// The directory `dir` as a prefix for the file name `name`: NULL if it is
+// the compilation directory, which names are relative to anyway, or if
+// the name is absolute.
+static const char *line_file_dir(const char *dir, const char *name) {
+  10355d:	55                   	push   %ebp
+  10355e:	89 e5                	mov    %esp,%ebp
+  103560:	53                   	push   %ebx
+  103561:	83 ec 04             	sub    $0x4,%esp
+  103564:	89 c3                	mov    %eax,%ebx
+        if (name[0] == '/') {
+  103566:	80 3a 2f             	cmpb   $0x2f,(%edx)
+  103569:	75 0a                	jne    103575 <line_file_dir+0x18>
+                return NULL;
+  10356b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  103570:	eb 32                	jmp    1035a4 <line_file_dir+0x47>
+        }
+        while (dir && dir[0] == '.' && dir[1] == '/') {
+                dir += 2;
+  103572:	83 c3 02             	add    $0x2,%ebx
+        while (dir && dir[0] == '.' && dir[1] == '/') {
+  103575:	85 db                	test   %ebx,%ebx
+  103577:	74 2b                	je     1035a4 <line_file_dir+0x47>
+  103579:	80 3b 2e             	cmpb   $0x2e,(%ebx)
+  10357c:	75 06                	jne    103584 <line_file_dir+0x27>
+  10357e:	80 7b 01 2f          	cmpb   $0x2f,0x1(%ebx)
+  103582:	74 ee                	je     103572 <line_file_dir+0x15>
+        }
+        if (!dir || !dir[0] || !strcmp(dir, ".")) {
+  103584:	80 3b 00             	cmpb   $0x0,(%ebx)
+  103587:	74 22                	je     1035ab <line_file_dir+0x4e>
+  103589:	83 ec 08             	sub    $0x8,%esp
+  10358c:	68 c6 9a 10 00       	push   $0x109ac6
+  103591:	53                   	push   %ebx
+  103592:	e8 2a 5b 00 00       	call   1090c1 <strcmp>
+  103597:	83 c4 10             	add    $0x10,%esp
+                return NULL;
+  10359a:	85 c0                	test   %eax,%eax
+  10359c:	b8 00 00 00 00       	mov    $0x0,%eax
+  1035a1:	0f 44 d8             	cmove  %eax,%ebx
+        }
+        return dir;
+}
+  1035a4:	89 d8                	mov    %ebx,%eax
+  1035a6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  1035a9:	c9                   	leave
+  1035aa:	c3                   	ret
+                return NULL;
+  1035ab:	bb 00 00 00 00       	mov    $0x0,%ebx
+  1035b0:	eb f2                	jmp    1035a4 <line_file_dir+0x47>
+
+001035b2 <line_program_header>:
+                               const void **end_store) {
+  1035b2:	55                   	push   %ebp
+  1035b3:	89 e5                	mov    %esp,%ebp
+  1035b5:	57                   	push   %edi
+  1035b6:	56                   	push   %esi
+  1035b7:	53                   	push   %ebx
+  1035b8:	83 ec 2c             	sub    $0x2c,%esp
+  1035bb:	89 c3                	mov    %eax,%ebx
+  1035bd:	89 d6                	mov    %edx,%esi
+  1035bf:	89 ca                	mov    %ecx,%edx
+        if (line_offset >= addrs->line_end - addrs->line_begin) {
+  1035c1:	8b 40 18             	mov    0x18(%eax),%eax
+  1035c4:	8b 7b 1c             	mov    0x1c(%ebx),%edi
+  1035c7:	29 c7                	sub    %eax,%edi
+  1035c9:	89 fb                	mov    %edi,%ebx
+  1035cb:	c1 fb 1f             	sar    $0x1f,%ebx
+  1035ce:	39 fe                	cmp    %edi,%esi
+  1035d0:	19 da                	sbb    %ebx,%edx
+  1035d2:	0f 83 cb 00 00 00    	jae    1036a3 <line_program_header+0xf1>
+        const void *curr_addr = addrs->line_begin + line_offset;
+  1035d8:	01 c6                	add    %eax,%esi
+	initial_len = get_unaligned(addr, uint32_t);
+  1035da:	83 ec 04             	sub    $0x4,%esp
+  1035dd:	6a 04                	push   $0x4
+  1035df:	56                   	push   %esi
+  1035e0:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  1035e3:	50                   	push   %eax
+  1035e4:	e8 0f 5c 00 00       	call   1091f8 <memcpy>
+  1035e9:	8b 45 e0             	mov    -0x20(%ebp),%eax
+	if (initial_len >= DW_EXT_LO && initial_len <= DW_EXT_HI) {
+  1035ec:	83 c4 10             	add    $0x10,%esp
+  1035ef:	83 f8 ef             	cmp    $0xffffffef,%eax
+  1035f2:	0f 86 96 01 00 00    	jbe    10378e <line_program_header+0x1dc>
+		if (initial_len == DW_EXT_DWARF64) {
+  1035f8:	83 f8 ff             	cmp    $0xffffffff,%eax
+  1035fb:	74 1a                	je     103617 <line_program_header+0x65>
+			cprintf("Unknown DWARF extension\n");
+  1035fd:	83 ec 0c             	sub    $0xc,%esp
+  103600:	68 40 98 10 00       	push   $0x109840
+  103605:	e8 2a 42 00 00       	call   107834 <cprintf>
+  10360a:	83 c4 10             	add    $0x10,%esp
+                return -E_BAD_DWARF;
+  10360d:	b8 fa ff ff ff       	mov    $0xfffffffa,%eax
+  103612:	e9 6f 01 00 00       	jmp    103786 <line_program_header+0x1d4>
+			*len = get_unaligned((uint64_t *)addr + 4, uint64_t);
+  103617:	83 ec 04             	sub    $0x4,%esp
+  10361a:	6a 08                	push   $0x8
+  10361c:	8d 46 20             	lea    0x20(%esi),%eax
+  10361f:	50                   	push   %eax
+  103620:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  103623:	50                   	push   %eax
+  103624:	e8 cf 5b 00 00       	call   1091f8 <memcpy>
+  103629:	8b 45 e0             	mov    -0x20(%ebp),%eax
+			count = 12;
+  10362c:	83 c4 10             	add    $0x10,%esp
+  10362f:	ba 0c 00 00 00       	mov    $0xc,%edx
+  103634:	e9 5a 01 00 00       	jmp    103793 <line_program_header+0x1e1>
+        assert(version >= 2 && version <= 5);
+  103639:	68 c8 9a 10 00       	push   $0x109ac8
+  10363e:	68 00 95 10 00       	push   $0x109500
+  103643:	68 ef 00 00 00       	push   $0xef
+  103648:	68 a0 9a 10 00       	push   $0x109aa0
+  10364d:	e8 35 ca ff ff       	call   100087 <_panic>
+			*len = get_unaligned((uint64_t *)addr + 4, uint64_t);
+  103652:	83 ec 04             	sub    $0x4,%esp
+  103655:	6a 08                	push   $0x8
+  103657:	8d 43 20             	lea    0x20(%ebx),%eax
+  10365a:	50                   	push   %eax
+  10365b:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  10365e:	50                   	push   %eax
+  10365f:	e8 94 5b 00 00       	call   1091f8 <memcpy>
+  103664:	8b 45 e0             	mov    -0x20(%ebp),%eax
+			count = 12;
+  103667:	83 c4 10             	add    $0x10,%esp
+  10366a:	ba 0c 00 00 00       	mov    $0xc,%edx
+  10366f:	eb 41                	jmp    1036b2 <line_program_header+0x100>
+        assert(minimum_instruction_length == 1);
+  103671:	68 1c 9b 10 00       	push   $0x109b1c
+  103676:	68 00 95 10 00       	push   $0x109500
+  10367b:	68 00 01 00 00       	push   $0x100
+  103680:	68 a0 9a 10 00       	push   $0x109aa0
+  103685:	e8 fd c9 ff ff       	call   100087 <_panic>
+        assert(maximum_operations_per_instruction == 1);
+  10368a:	68 3c 9b 10 00       	push   $0x109b3c
+  10368f:	68 00 95 10 00       	push   $0x109500
+  103694:	68 0a 01 00 00       	push   $0x10a
+  103699:	68 a0 9a 10 00       	push   $0x109aa0
+  10369e:	e8 e4 c9 ff ff       	call   100087 <_panic>
+                return -E_INVAL;
+  1036a3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  1036a8:	e9 d9 00 00 00       	jmp    103786 <line_program_header+0x1d4>
+	count = 4;
+  1036ad:	ba 04 00 00 00       	mov    $0x4,%edx
+                curr_addr += count;
+  1036b2:	01 d3                	add    %edx,%ebx
+        *program_store = curr_addr + header_length;
+  1036b4:	01 d8                	add    %ebx,%eax
+  1036b6:	8b 55 0c             	mov    0xc(%ebp),%edx
+  1036b9:	89 02                	mov    %eax,(%edx)
+            get_unaligned(curr_addr, Dwarf_Small);
+  1036bb:	83 ec 04             	sub    $0x4,%esp
+  1036be:	6a 01                	push   $0x1
+  1036c0:	53                   	push   %ebx
+  1036c1:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  1036c4:	50                   	push   %eax
+  1036c5:	e8 2e 5b 00 00       	call   1091f8 <memcpy>
+        assert(minimum_instruction_length == 1);
+  1036ca:	83 c4 10             	add    $0x10,%esp
+  1036cd:	80 7d e0 01          	cmpb   $0x1,-0x20(%ebp)
+  1036d1:	75 9e                	jne    103671 <line_program_header+0xbf>
+        curr_addr += sizeof(Dwarf_Small);
+  1036d3:	8d 73 01             	lea    0x1(%ebx),%esi
+        if (version >= 4) {
+  1036d6:	66 83 ff 03          	cmp    $0x3,%di
+  1036da:	76 1b                	jbe    1036f7 <line_program_header+0x145>
+                    get_unaligned(curr_addr, Dwarf_Small);
+  1036dc:	83 ec 04             	sub    $0x4,%esp
+  1036df:	6a 01                	push   $0x1
+  1036e1:	56                   	push   %esi
+  1036e2:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  1036e5:	50                   	push   %eax
+  1036e6:	e8 0d 5b 00 00       	call   1091f8 <memcpy>
+                curr_addr += sizeof(Dwarf_Small);
+  1036eb:	8d 73 02             	lea    0x2(%ebx),%esi
+        assert(maximum_operations_per_instruction == 1);
+  1036ee:	83 c4 10             	add    $0x10,%esp
+  1036f1:	80 7d e0 01          	cmpb   $0x1,-0x20(%ebp)
+  1036f5:	75 93                	jne    10368a <line_program_header+0xd8>
+        signed char line_base = get_unaligned(curr_addr, signed char);
+  1036f7:	83 ec 04             	sub    $0x4,%esp
+  1036fa:	6a 01                	push   $0x1
+        curr_addr += sizeof(Dwarf_Small);
+  1036fc:	8d 46 01             	lea    0x1(%esi),%eax
+        signed char line_base = get_unaligned(curr_addr, signed char);
+  1036ff:	50                   	push   %eax
+  103700:	8d 5d e0             	lea    -0x20(%ebp),%ebx
+  103703:	53                   	push   %ebx
+  103704:	e8 ef 5a 00 00       	call   1091f8 <memcpy>
+  103709:	0f b6 45 e0          	movzbl -0x20(%ebp),%eax
+  10370d:	88 45 d7             	mov    %al,-0x29(%ebp)
+        Dwarf_Small line_range = get_unaligned(curr_addr, Dwarf_Small);
+  103710:	83 c4 0c             	add    $0xc,%esp
+  103713:	6a 01                	push   $0x1
+        curr_addr += sizeof(signed char);
+  103715:	8d 46 02             	lea    0x2(%esi),%eax
+        Dwarf_Small line_range = get_unaligned(curr_addr, Dwarf_Small);
+  103718:	50                   	push   %eax
+  103719:	53                   	push   %ebx
+  10371a:	e8 d9 5a 00 00       	call   1091f8 <memcpy>
+  10371f:	0f b6 4d e0          	movzbl -0x20(%ebp),%ecx
+  103723:	88 4d d6             	mov    %cl,-0x2a(%ebp)
+        Dwarf_Small opcode_base = get_unaligned(curr_addr, Dwarf_Small);
+  103726:	83 c4 0c             	add    $0xc,%esp
+  103729:	6a 01                	push   $0x1
+        curr_addr += sizeof(Dwarf_Small);
+  10372b:	8d 46 03             	lea    0x3(%esi),%eax
+        Dwarf_Small opcode_base = get_unaligned(curr_addr, Dwarf_Small);
+  10372e:	50                   	push   %eax
+  10372f:	53                   	push   %ebx
+  103730:	e8 c3 5a 00 00       	call   1091f8 <memcpy>
+  103735:	0f b6 4d e0          	movzbl -0x20(%ebp),%ecx
+  103739:	88 4d d5             	mov    %cl,-0x2b(%ebp)
+        curr_addr += sizeof(Dwarf_Small);
+  10373c:	83 c6 04             	add    $0x4,%esi
+            (Dwarf_Small *)get_unaligned(curr_addr, Dwarf_Small *);
+  10373f:	83 c4 0c             	add    $0xc,%esp
+  103742:	6a 04                	push   $0x4
+  103744:	56                   	push   %esi
+  103745:	53                   	push   %ebx
+  103746:	e8 ad 5a 00 00       	call   1091f8 <memcpy>
+        info->version = version;
+  10374b:	8b 55 08             	mov    0x8(%ebp),%edx
+  10374e:	66 89 7a 0c          	mov    %di,0xc(%edx)
+        info->file_tables = curr_addr + (opcode_base - 1);
+  103752:	0f b6 4d d5          	movzbl -0x2b(%ebp),%ecx
+  103756:	0f b6 c1             	movzbl %cl,%eax
+  103759:	8d 44 06 ff          	lea    -0x1(%esi,%eax,1),%eax
+  10375d:	89 42 10             	mov    %eax,0x10(%edx)
+        info->minimum_instruction_length = minimum_instruction_length;
+  103760:	c6 02 01             	movb   $0x1,(%edx)
+        info->maximum_operations_per_instruction =
+  103763:	c6 42 01 01          	movb   $0x1,0x1(%edx)
+        info->line_base = line_base;
+  103767:	0f b6 45 d7          	movzbl -0x29(%ebp),%eax
+  10376b:	88 42 02             	mov    %al,0x2(%edx)
+        info->line_range = line_range;
+  10376e:	0f b6 45 d6          	movzbl -0x2a(%ebp),%eax
+  103772:	88 42 03             	mov    %al,0x3(%edx)
+        info->opcode_base = opcode_base;
+  103775:	88 4a 04             	mov    %cl,0x4(%edx)
+        info->standard_opcode_lengths = standard_opcode_lengths;
+  103778:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  10377b:	89 42 08             	mov    %eax,0x8(%edx)
+        return 0;
+  10377e:	83 c4 10             	add    $0x10,%esp
+  103781:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  103786:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  103789:	5b                   	pop    %ebx
+  10378a:	5e                   	pop    %esi
+  10378b:	5f                   	pop    %edi
+  10378c:	5d                   	pop    %ebp
+  10378d:	c3                   	ret
+  10378e:	ba 04 00 00 00       	mov    $0x4,%edx
+                curr_addr += count;
+  103793:	8d 1c 16             	lea    (%esi,%edx,1),%ebx
+        *end_store = curr_addr + unit_length;
+  103796:	01 d8                	add    %ebx,%eax
+  103798:	8b 55 10             	mov    0x10(%ebp),%edx
+  10379b:	89 02                	mov    %eax,(%edx)
+        Dwarf_Half version = get_unaligned(curr_addr, Dwarf_Half);
+  10379d:	83 ec 04             	sub    $0x4,%esp
+  1037a0:	6a 02                	push   $0x2
+  1037a2:	53                   	push   %ebx
+  1037a3:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  1037a6:	50                   	push   %eax
+  1037a7:	e8 4c 5a 00 00       	call   1091f8 <memcpy>
+  1037ac:	0f b7 7d e0          	movzwl -0x20(%ebp),%edi
+        assert(version >= 2 && version <= 5);
+  1037b0:	8d 47 fe             	lea    -0x2(%edi),%eax
+  1037b3:	83 c4 10             	add    $0x10,%esp
+  1037b6:	66 83 f8 03          	cmp    $0x3,%ax
+  1037ba:	0f 87 79 fe ff ff    	ja     103639 <line_program_header+0x87>
+        curr_addr += sizeof(Dwarf_Half);
+  1037c0:	8d 53 02             	lea    0x2(%ebx),%edx
+  1037c3:	83 c3 04             	add    $0x4,%ebx
+  1037c6:	66 83 ff 05          	cmp    $0x5,%di
+  1037ca:	0f 45 da             	cmovne %edx,%ebx
+	initial_len = get_unaligned(addr, uint32_t);
+  1037cd:	83 ec 04             	sub    $0x4,%esp
+  1037d0:	6a 04                	push   $0x4
+  1037d2:	53                   	push   %ebx
+  1037d3:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  1037d6:	50                   	push   %eax
+  1037d7:	e8 1c 5a 00 00       	call   1091f8 <memcpy>
+  1037dc:	8b 45 e0             	mov    -0x20(%ebp),%eax
+	if (initial_len >= DW_EXT_LO && initial_len <= DW_EXT_HI) {
+  1037df:	83 c4 10             	add    $0x10,%esp
+  1037e2:	83 f8 ef             	cmp    $0xffffffef,%eax
+  1037e5:	0f 86 c2 fe ff ff    	jbe    1036ad <line_program_header+0xfb>
+		if (initial_len == DW_EXT_DWARF64) {
+  1037eb:	83 f8 ff             	cmp    $0xffffffff,%eax
+  1037ee:	0f 84 5e fe ff ff    	je     103652 <line_program_header+0xa0>
+			cprintf("Unknown DWARF extension\n");
+  1037f4:	83 ec 0c             	sub    $0xc,%esp
+  1037f7:	68 40 98 10 00       	push   $0x109840
+  1037fc:	e8 33 40 00 00       	call   107834 <cprintf>
+  103801:	83 c4 10             	add    $0x10,%esp
+                return -E_BAD_DWARF;
+  103804:	b8 fa ff ff ff       	mov    $0xfffffffa,%eax
+  103809:	e9 78 ff ff ff       	jmp    103786 <line_program_header+0x1d4>
+
+0010380e <line_table_build>:
+                                           struct Dwarf_Cuinfo *ci) {
+  10380e:	55                   	push   %ebp
+  10380f:	89 e5                	mov    %esp,%ebp
+  103811:	57                   	push   %edi
+  103812:	56                   	push   %esi
+  103813:	53                   	push   %ebx
+  103814:	81 ec 60 01 00 00    	sub    $0x160,%esp
+  10381a:	89 c3                	mov    %eax,%ebx
+  10381c:	89 d6                	mov    %edx,%esi
+	__asm __volatile("rdtsc" : "=A" (tsc));
+  10381e:	0f 31                	rdtsc
+  103820:	89 85 98 fe ff ff    	mov    %eax,-0x168(%ebp)
+  103826:	89 95 9c fe ff ff    	mov    %edx,-0x164(%ebp)
+        if (line_program_header(addrs, line_offset, &info, &program_addr,
+  10382c:	8d 45 cc             	lea    -0x34(%ebp),%eax
+  10382f:	50                   	push   %eax
+  103830:	8d 45 d0             	lea    -0x30(%ebp),%eax
+  103833:	50                   	push   %eax
+  103834:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+  103837:	50                   	push   %eax
+  103838:	89 f2                	mov    %esi,%edx
+  10383a:	89 d8                	mov    %ebx,%eax
+  10383c:	e8 71 fd ff ff       	call   1035b2 <line_program_header>
+  103841:	83 c4 10             	add    $0x10,%esp
+  103844:	85 c0                	test   %eax,%eax
+  103846:	0f 88 1e 02 00 00    	js     103a6a <line_table_build+0x25c>
+        int nseqs = 0, i, j;
+  10384c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  103851:	eb 6d                	jmp    1038c0 <line_table_build+0xb2>
+                        seqs[j] = seqs[j - 1];
+  103853:	8b 8c c5 cc fe ff ff 	mov    -0x134(%ebp,%eax,8),%ecx
+  10385a:	8b 9c c5 d0 fe ff ff 	mov    -0x130(%ebp,%eax,8),%ebx
+  103861:	89 8c c5 d4 fe ff ff 	mov    %ecx,-0x12c(%ebp,%eax,8)
+  103868:	89 9c c5 d8 fe ff ff 	mov    %ebx,-0x128(%ebp,%eax,8)
+                     j--) {
+  10386f:	89 c1                	mov    %eax,%ecx
+                for (j = nseqs; j > 0 && seqs[j - 1].address > seq.address;
+  103871:	85 c9                	test   %ecx,%ecx
+  103873:	7e 0c                	jle    103881 <line_table_build+0x73>
+  103875:	8d 41 ff             	lea    -0x1(%ecx),%eax
+  103878:	3b 94 cd c4 fe ff ff 	cmp    -0x13c(%ebp,%ecx,8),%edx
+  10387f:	72 d2                	jb     103853 <line_table_build+0x45>
+                seqs[j] = seq;
+  103881:	8b 9d a4 fe ff ff    	mov    -0x15c(%ebp),%ebx
+  103887:	8b 85 c4 fe ff ff    	mov    -0x13c(%ebp),%eax
+  10388d:	8b 95 c8 fe ff ff    	mov    -0x138(%ebp),%edx
+  103893:	89 84 cd cc fe ff ff 	mov    %eax,-0x134(%ebp,%ecx,8)
+  10389a:	89 94 cd d0 fe ff ff 	mov    %edx,-0x130(%ebp,%ecx,8)
+                nseqs++;
+  1038a1:	83 c3 01             	add    $0x1,%ebx
+                program_addr = run_line_number_program(
+  1038a4:	83 ec 08             	sub    $0x8,%esp
+  1038a7:	6a 00                	push   $0x0
+  1038a9:	68 da 2e 10 00       	push   $0x102eda
+  1038ae:	8d 4d d4             	lea    -0x2c(%ebp),%ecx
+  1038b1:	89 f2                	mov    %esi,%edx
+  1038b3:	89 f8                	mov    %edi,%eax
+  1038b5:	e8 66 f7 ff ff       	call   103020 <run_line_number_program>
+  1038ba:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  1038bd:	83 c4 10             	add    $0x10,%esp
+        while (program_addr < end_addr) {
+  1038c0:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  1038c3:	8b 75 cc             	mov    -0x34(%ebp),%esi
+  1038c6:	39 f7                	cmp    %esi,%edi
+  1038c8:	73 4a                	jae    103914 <line_table_build+0x106>
+                if (nseqs == DWARF_LINE_MAXSEQ) {
+  1038ca:	83 fb 20             	cmp    $0x20,%ebx
+  1038cd:	0f 84 a3 01 00 00    	je     103a76 <line_table_build+0x268>
+                seq.program_addr = program_addr;
+  1038d3:	89 bd c8 fe ff ff    	mov    %edi,-0x138(%ebp)
+                seq.address = 0;
+  1038d9:	c7 85 c4 fe ff ff 00 	movl   $0x0,-0x13c(%ebp)
+  1038e0:	00 00 00 
+                run_line_number_program(program_addr, end_addr, &info,
+  1038e3:	83 ec 08             	sub    $0x8,%esp
+  1038e6:	8d 85 c4 fe ff ff    	lea    -0x13c(%ebp),%eax
+  1038ec:	50                   	push   %eax
+  1038ed:	68 e0 2e 10 00       	push   $0x102ee0
+  1038f2:	8d 4d d4             	lea    -0x2c(%ebp),%ecx
+  1038f5:	89 f2                	mov    %esi,%edx
+  1038f7:	89 f8                	mov    %edi,%eax
+  1038f9:	e8 22 f7 ff ff       	call   103020 <run_line_number_program>
+                for (j = nseqs; j > 0 && seqs[j - 1].address > seq.address;
+  1038fe:	8b 95 c4 fe ff ff    	mov    -0x13c(%ebp),%edx
+  103904:	83 c4 10             	add    $0x10,%esp
+  103907:	89 d9                	mov    %ebx,%ecx
+  103909:	89 9d a4 fe ff ff    	mov    %ebx,-0x15c(%ebp)
+  10390f:	e9 5d ff ff ff       	jmp    103871 <line_table_build+0x63>
+        struct Line_Encoder enc = {0};
+  103914:	b9 00 00 00 00       	mov    $0x0,%ecx
+  103919:	ba 18 00 00 00       	mov    $0x18,%edx
+  10391e:	b8 00 00 00 00       	mov    $0x0,%eax
+  103923:	89 8c 05 ac fe ff ff 	mov    %ecx,-0x154(%ebp,%eax,1)
+  10392a:	83 c0 04             	add    $0x4,%eax
+  10392d:	39 d0                	cmp    %edx,%eax
+  10392f:	72 f2                	jb     103923 <line_table_build+0x115>
+        for (i = 0; i < nseqs; i++) {
+  103931:	bf 00 00 00 00       	mov    $0x0,%edi
+  103936:	eb 26                	jmp    10395e <line_table_build+0x150>
+                run_line_number_program(seqs[i].program_addr, end_addr, &info,
+  103938:	8b 84 fd d0 fe ff ff 	mov    -0x130(%ebp,%edi,8),%eax
+  10393f:	83 ec 08             	sub    $0x8,%esp
+  103942:	8d 95 ac fe ff ff    	lea    -0x154(%ebp),%edx
+  103948:	52                   	push   %edx
+  103949:	68 f4 2e 10 00       	push   $0x102ef4
+  10394e:	8d 4d d4             	lea    -0x2c(%ebp),%ecx
+  103951:	89 f2                	mov    %esi,%edx
+  103953:	e8 c8 f6 ff ff       	call   103020 <run_line_number_program>
+        for (i = 0; i < nseqs; i++) {
+  103958:	83 c7 01             	add    $0x1,%edi
+  10395b:	83 c4 10             	add    $0x10,%esp
+  10395e:	39 fb                	cmp    %edi,%ebx
+  103960:	7f d6                	jg     103938 <line_table_build+0x12a>
+            (enc.nrows + DWARF_LINE_STRIDE - 1) / DWARF_LINE_STRIDE;
+  103962:	8b 95 b8 fe ff ff    	mov    -0x148(%ebp),%edx
+  103968:	8d 42 1e             	lea    0x1e(%edx),%eax
+  10396b:	83 c2 0f             	add    $0xf,%edx
+  10396e:	0f 49 c2             	cmovns %edx,%eax
+  103971:	c1 f8 04             	sar    $0x4,%eax
+        uint32_t size = sizeof(struct Line_Table) +
+  103974:	8d 44 40 03          	lea    0x3(%eax,%eax,2),%eax
+  103978:	8d 3c 85 00 00 00 00 	lea    0x0(,%eax,4),%edi
+  10397f:	89 f8                	mov    %edi,%eax
+  103981:	03 85 b4 fe ff ff    	add    -0x14c(%ebp),%eax
+  103987:	89 85 a0 fe ff ff    	mov    %eax,-0x160(%ebp)
+        struct Line_Table *table = dwarf_cu_alloc(ci, size + 1);
+  10398d:	83 ec 08             	sub    $0x8,%esp
+  103990:	83 c0 01             	add    $0x1,%eax
+  103993:	50                   	push   %eax
+  103994:	ff 75 08             	push   0x8(%ebp)
+  103997:	e8 1c 30 00 00       	call   1069b8 <dwarf_cu_alloc>
+  10399c:	89 c2                	mov    %eax,%edx
+  10399e:	89 85 a4 fe ff ff    	mov    %eax,-0x15c(%ebp)
+        if (!table) {
+  1039a4:	83 c4 10             	add    $0x10,%esp
+  1039a7:	85 c0                	test   %eax,%eax
+  1039a9:	0f 84 ad 00 00 00    	je     103a5c <line_table_build+0x24e>
+        enc.anchors = (struct Line_Anchor *)(table + 1);
+  1039af:	8d 40 0c             	lea    0xc(%eax),%eax
+  1039b2:	89 85 ac fe ff ff    	mov    %eax,-0x154(%ebp)
+        enc.rows = (unsigned char *)(enc.anchors + nanchors);
+  1039b8:	01 d7                	add    %edx,%edi
+  1039ba:	89 bd b0 fe ff ff    	mov    %edi,-0x150(%ebp)
+        table->nrows = enc.nrows;
+  1039c0:	8b 85 b8 fe ff ff    	mov    -0x148(%ebp),%eax
+  1039c6:	89 02                	mov    %eax,(%edx)
+        table->anchors = enc.anchors;
+  1039c8:	8b 85 ac fe ff ff    	mov    -0x154(%ebp),%eax
+  1039ce:	89 42 04             	mov    %eax,0x4(%edx)
+        table->rows = enc.rows;
+  1039d1:	8b 85 b0 fe ff ff    	mov    -0x150(%ebp),%eax
+  1039d7:	89 42 08             	mov    %eax,0x8(%edx)
+        enc.size = enc.nrows = 0;
+  1039da:	c7 85 b8 fe ff ff 00 	movl   $0x0,-0x148(%ebp)
+  1039e1:	00 00 00 
+  1039e4:	c7 85 b4 fe ff ff 00 	movl   $0x0,-0x14c(%ebp)
+  1039eb:	00 00 00 
+        for (i = 0; i < nseqs; i++) {
+  1039ee:	bf 00 00 00 00       	mov    $0x0,%edi
+  1039f3:	eb 26                	jmp    103a1b <line_table_build+0x20d>
+                run_line_number_program(seqs[i].program_addr, end_addr, &info,
+  1039f5:	8b 84 fd d0 fe ff ff 	mov    -0x130(%ebp,%edi,8),%eax
+  1039fc:	83 ec 08             	sub    $0x8,%esp
+  1039ff:	8d 95 ac fe ff ff    	lea    -0x154(%ebp),%edx
+  103a05:	52                   	push   %edx
+  103a06:	68 f4 2e 10 00       	push   $0x102ef4
+  103a0b:	8d 4d d4             	lea    -0x2c(%ebp),%ecx
+  103a0e:	89 f2                	mov    %esi,%edx
+  103a10:	e8 0b f6 ff ff       	call   103020 <run_line_number_program>
+        for (i = 0; i < nseqs; i++) {
+  103a15:	83 c7 01             	add    $0x1,%edi
+  103a18:	83 c4 10             	add    $0x10,%esp
+  103a1b:	39 fb                	cmp    %edi,%ebx
+  103a1d:	7f d6                	jg     1039f5 <line_table_build+0x1e7>
+        dwarf_stats.dws_nlinetabs++;
+  103a1f:	83 05 a0 e2 11 00 01 	addl   $0x1,0x11e2a0
+        dwarf_stats.dws_linetabs_size += size;
+  103a26:	8b 85 a0 fe ff ff    	mov    -0x160(%ebp),%eax
+  103a2c:	01 05 a4 e2 11 00    	add    %eax,0x11e2a4
+  103a32:	0f 31                	rdtsc
+        dwarf_stats.dws_lines_build += read_tsc() - tsc;
+  103a34:	8b 0d a8 e2 11 00    	mov    0x11e2a8,%ecx
+  103a3a:	8b 1d ac e2 11 00    	mov    0x11e2ac,%ebx
+  103a40:	2b 8d 98 fe ff ff    	sub    -0x168(%ebp),%ecx
+  103a46:	1b 9d 9c fe ff ff    	sbb    -0x164(%ebp),%ebx
+  103a4c:	01 c1                	add    %eax,%ecx
+  103a4e:	11 d3                	adc    %edx,%ebx
+  103a50:	89 0d a8 e2 11 00    	mov    %ecx,0x11e2a8
+  103a56:	89 1d ac e2 11 00    	mov    %ebx,0x11e2ac
+}
+  103a5c:	8b 85 a4 fe ff ff    	mov    -0x15c(%ebp),%eax
+  103a62:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  103a65:	5b                   	pop    %ebx
+  103a66:	5e                   	pop    %esi
+  103a67:	5f                   	pop    %edi
+  103a68:	5d                   	pop    %ebp
+  103a69:	c3                   	ret
+                return NULL;
+  103a6a:	c7 85 a4 fe ff ff 00 	movl   $0x0,-0x15c(%ebp)
+  103a71:	00 00 00 
+  103a74:	eb e6                	jmp    103a5c <line_table_build+0x24e>
+                        return NULL;
+  103a76:	c7 85 a4 fe ff ff 00 	movl   $0x0,-0x15c(%ebp)
+  103a7d:	00 00 00 
+  103a80:	eb da                	jmp    103a5c <line_table_build+0x24e>
+
+00103a82 <line_table_get>:
+                                         Dwarf_Off line_offset) {
+  103a82:	55                   	push   %ebp
+  103a83:	89 e5                	mov    %esp,%ebp
+  103a85:	57                   	push   %edi
+  103a86:	56                   	push   %esi
+  103a87:	53                   	push   %ebx
+  103a88:	83 ec 24             	sub    $0x24,%esp
+  103a8b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  103a8e:	89 d6                	mov    %edx,%esi
+  103a90:	89 cf                	mov    %ecx,%edi
+        struct Dwarf_Cuinfo *ci = dwarf_cu_by_lines(line_offset);
+  103a92:	51                   	push   %ecx
+  103a93:	52                   	push   %edx
+  103a94:	e8 af 31 00 00       	call   106c48 <dwarf_cu_by_lines>
+  103a99:	89 c3                	mov    %eax,%ebx
+        if (!ci) {
+  103a9b:	83 c4 10             	add    $0x10,%esp
+  103a9e:	85 c0                	test   %eax,%eax
+  103aa0:	74 09                	je     103aab <line_table_get+0x29>
+        if (!ci->ci_lines_tried) {
+  103aa2:	80 78 74 00          	cmpb   $0x0,0x74(%eax)
+  103aa6:	74 0d                	je     103ab5 <line_table_get+0x33>
+        return ci->ci_lines;
+  103aa8:	8b 5b 58             	mov    0x58(%ebx),%ebx
+}
+  103aab:	89 d8                	mov    %ebx,%eax
+  103aad:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  103ab0:	5b                   	pop    %ebx
+  103ab1:	5e                   	pop    %esi
+  103ab2:	5f                   	pop    %edi
+  103ab3:	5d                   	pop    %ebp
+  103ab4:	c3                   	ret
+                ci->ci_lines_tried = true;
+  103ab5:	c6 40 74 01          	movb   $0x1,0x74(%eax)
+                ci->ci_lines = line_table_build(addrs, line_offset, ci);
+  103ab9:	83 ec 0c             	sub    $0xc,%esp
+  103abc:	50                   	push   %eax
+  103abd:	89 f2                	mov    %esi,%edx
+  103abf:	89 f9                	mov    %edi,%ecx
+  103ac1:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  103ac4:	e8 45 fd ff ff       	call   10380e <line_table_build>
+  103ac9:	89 43 58             	mov    %eax,0x58(%ebx)
+  103acc:	83 c4 10             	add    $0x10,%esp
+  103acf:	eb d7                	jmp    103aa8 <line_table_get+0x26>
+
+00103ad1 <line_for_address>:
+                     Dwarf_Off line_offset, int *lineno_store) {
+  103ad1:	55                   	push   %ebp
+  103ad2:	89 e5                	mov    %esp,%ebp
+  103ad4:	57                   	push   %edi
+  103ad5:	56                   	push   %esi
+  103ad6:	53                   	push   %ebx
+  103ad7:	83 ec 6c             	sub    $0x6c,%esp
+  103ada:	8b 75 10             	mov    0x10(%ebp),%esi
+  103add:	8b 7d 14             	mov    0x14(%ebp),%edi
+        if (lineno_store == NULL) {
+  103ae0:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+  103ae4:	0f 84 21 02 00 00    	je     103d0b <line_for_address+0x23a>
+  103aea:	0f 31                	rdtsc
+  103aec:	89 45 88             	mov    %eax,-0x78(%ebp)
+  103aef:	89 55 8c             	mov    %edx,-0x74(%ebp)
+        struct Line_Table *table = line_table_get(addrs, line_offset);
+  103af2:	89 f2                	mov    %esi,%edx
+  103af4:	89 f9                	mov    %edi,%ecx
+  103af6:	8b 45 08             	mov    0x8(%ebp),%eax
+  103af9:	e8 84 ff ff ff       	call   103a82 <line_table_get>
+        if (table) {
+  103afe:	85 c0                	test   %eax,%eax
+  103b00:	0f 84 83 01 00 00    	je     103c89 <line_for_address+0x1b8>
+        int lo = 0, hi = (table->nrows + DWARF_LINE_STRIDE - 1) /
+  103b06:	8b 30                	mov    (%eax),%esi
+  103b08:	8d 56 1e             	lea    0x1e(%esi),%edx
+  103b0b:	89 f1                	mov    %esi,%ecx
+  103b0d:	83 c1 0f             	add    $0xf,%ecx
+  103b10:	0f 48 ca             	cmovs  %edx,%ecx
+  103b13:	89 cb                	mov    %ecx,%ebx
+  103b15:	c1 fb 04             	sar    $0x4,%ebx
+  103b18:	ba 00 00 00 00       	mov    $0x0,%edx
+        while (lo < hi) {
+  103b1d:	39 d3                	cmp    %edx,%ebx
+  103b1f:	7e 29                	jle    103b4a <line_for_address+0x79>
+                int mid = (lo + hi) / 2;
+  103b21:	8d 3c 13             	lea    (%ebx,%edx,1),%edi
+  103b24:	89 f9                	mov    %edi,%ecx
+  103b26:	c1 e9 1f             	shr    $0x1f,%ecx
+  103b29:	01 f9                	add    %edi,%ecx
+  103b2b:	89 cf                	mov    %ecx,%edi
+  103b2d:	d1 ff                	sar    %edi
+                if (table->anchors[mid].address <= p) {
+  103b2f:	83 e1 fe             	and    $0xfffffffe,%ecx
+  103b32:	01 f9                	add    %edi,%ecx
+  103b34:	c1 e1 02             	shl    $0x2,%ecx
+  103b37:	03 48 04             	add    0x4(%eax),%ecx
+  103b3a:	8b 09                	mov    (%ecx),%ecx
+  103b3c:	39 4d 0c             	cmp    %ecx,0xc(%ebp)
+  103b3f:	73 04                	jae    103b45 <line_for_address+0x74>
+                int mid = (lo + hi) / 2;
+  103b41:	89 fb                	mov    %edi,%ebx
+  103b43:	eb d8                	jmp    103b1d <line_for_address+0x4c>
+                        lo = mid + 1;
+  103b45:	8d 57 01             	lea    0x1(%edi),%edx
+  103b48:	eb d3                	jmp    103b1d <line_for_address+0x4c>
+        if (lo == 0) {
+  103b4a:	85 d2                	test   %edx,%edx
+  103b4c:	0f 84 29 01 00 00    	je     103c7b <line_for_address+0x1aa>
+        const struct Line_Anchor *anchor = &table->anchors[lo - 1];
+  103b52:	8d 1c 52             	lea    (%edx,%edx,2),%ebx
+  103b55:	8b 48 04             	mov    0x4(%eax),%ecx
+  103b58:	8d 4c 99 f4          	lea    -0xc(%ecx,%ebx,4),%ecx
+        uint32_t address = anchor->address;
+  103b5c:	8b 39                	mov    (%ecx),%edi
+  103b5e:	89 7d a0             	mov    %edi,-0x60(%ebp)
+        int line = anchor->line;
+  103b61:	8b 79 04             	mov    0x4(%ecx),%edi
+  103b64:	89 7d 90             	mov    %edi,-0x70(%ebp)
+        const char *deltas = (const char *)table->rows + anchor->deltas;
+  103b67:	8b 49 08             	mov    0x8(%ecx),%ecx
+  103b6a:	03 48 08             	add    0x8(%eax),%ecx
+  103b6d:	89 4d a4             	mov    %ecx,-0x5c(%ebp)
+        int row = (lo - 1) * DWARF_LINE_STRIDE + 1;
+  103b70:	83 ea 01             	sub    $0x1,%edx
+  103b73:	c1 e2 04             	shl    $0x4,%edx
+  103b76:	8d 42 01             	lea    0x1(%edx),%eax
+  103b79:	89 45 9c             	mov    %eax,-0x64(%ebp)
+        int end = MIN(row - 1 + DWARF_LINE_STRIDE, table->nrows);
+  103b7c:	8d 42 10             	lea    0x10(%edx),%eax
+  103b7f:	39 f0                	cmp    %esi,%eax
+  103b81:	0f 4e f0             	cmovle %eax,%esi
+  103b84:	89 75 94             	mov    %esi,-0x6c(%ebp)
+        for (; row < end; row++) {
+  103b87:	eb 1e                	jmp    103ba7 <line_for_address+0xd6>
+                deltas += dwarf_read_leb128(deltas, &line_incr);
+  103b89:	01 d0                	add    %edx,%eax
+  103b8b:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+                if (address + address_incr > p) {
+  103b8e:	8b 75 98             	mov    -0x68(%ebp),%esi
+  103b91:	01 75 a0             	add    %esi,-0x60(%ebp)
+  103b94:	8b 45 a0             	mov    -0x60(%ebp),%eax
+  103b97:	39 45 0c             	cmp    %eax,0xc(%ebp)
+  103b9a:	0f 82 95 00 00 00    	jb     103c35 <line_for_address+0x164>
+                line += line_incr;
+  103ba0:	01 7d 90             	add    %edi,-0x70(%ebp)
+        for (; row < end; row++) {
+  103ba3:	83 45 9c 01          	addl   $0x1,-0x64(%ebp)
+  103ba7:	8b 75 9c             	mov    -0x64(%ebp),%esi
+  103baa:	39 75 94             	cmp    %esi,-0x6c(%ebp)
+  103bad:	0f 8e 82 00 00 00    	jle    103c35 <line_for_address+0x164>
+	count = 0;
+  103bb3:	ba 00 00 00 00       	mov    $0x0,%edx
+	result = 0;
+  103bb8:	be 00 00 00 00       	mov    $0x0,%esi
+  103bbd:	89 d7                	mov    %edx,%edi
+		byte = *addr;
+  103bbf:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+  103bc2:	0f b6 04 10          	movzbl (%eax,%edx,1),%eax
+		count++;
+  103bc6:	83 c2 01             	add    $0x1,%edx
+		result |= (byte & 0x7f) << shift;
+  103bc9:	89 c3                	mov    %eax,%ebx
+  103bcb:	83 e3 7f             	and    $0x7f,%ebx
+  103bce:	8d 0c fd 00 00 00 00 	lea    0x0(,%edi,8),%ecx
+  103bd5:	29 f9                	sub    %edi,%ecx
+  103bd7:	d3 e3                	shl    %cl,%ebx
+  103bd9:	09 de                	or     %ebx,%esi
+		if (!(byte & 0x80))
+  103bdb:	84 c0                	test   %al,%al
+  103bdd:	78 de                	js     103bbd <line_for_address+0xec>
+                deltas += dwarf_read_uleb128(deltas, &address_incr);
+  103bdf:	89 75 98             	mov    %esi,-0x68(%ebp)
+  103be2:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+  103be5:	01 d0                	add    %edx,%eax
+  103be7:	89 c2                	mov    %eax,%edx
+	count = 0;
+  103be9:	b8 00 00 00 00       	mov    $0x0,%eax
+	shift = 0;
+  103bee:	b9 00 00 00 00       	mov    $0x0,%ecx
+	result = 0;
+  103bf3:	bf 00 00 00 00       	mov    $0x0,%edi
+  103bf8:	89 d6                	mov    %edx,%esi
+		byte = *addr;
+  103bfa:	0f b6 14 06          	movzbl (%esi,%eax,1),%edx
+		result |= (byte & 0x7f) << shift;
+  103bfe:	89 d3                	mov    %edx,%ebx
+  103c00:	83 e3 7f             	and    $0x7f,%ebx
+  103c03:	d3 e3                	shl    %cl,%ebx
+  103c05:	09 df                	or     %ebx,%edi
+		shift += 7;
+  103c07:	83 c1 07             	add    $0x7,%ecx
+		count++;
+  103c0a:	83 c0 01             	add    $0x1,%eax
+		if (!(byte & 0x80))
+  103c0d:	84 d2                	test   %dl,%dl
+  103c0f:	78 e9                	js     103bfa <line_for_address+0x129>
+	if ((shift < num_bits) && (byte & 0x40))
+  103c11:	89 d3                	mov    %edx,%ebx
+  103c13:	89 f2                	mov    %esi,%edx
+  103c15:	83 f9 1f             	cmp    $0x1f,%ecx
+  103c18:	0f 8f 6b ff ff ff    	jg     103b89 <line_for_address+0xb8>
+  103c1e:	f6 c3 40             	test   $0x40,%bl
+  103c21:	0f 84 62 ff ff ff    	je     103b89 <line_for_address+0xb8>
+		result |= (-1U << shift);
+  103c27:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  103c2c:	d3 e6                	shl    %cl,%esi
+  103c2e:	09 f7                	or     %esi,%edi
+  103c30:	e9 54 ff ff ff       	jmp    103b89 <line_for_address+0xb8>
+        if (line == 0) {
+  103c35:	8b 45 90             	mov    -0x70(%ebp),%eax
+  103c38:	85 c0                	test   %eax,%eax
+  103c3a:	74 46                	je     103c82 <line_for_address+0x1b1>
+        *lineno_store = line;
+  103c3c:	8b 75 18             	mov    0x18(%ebp),%esi
+  103c3f:	89 06                	mov    %eax,(%esi)
+        return 0;
+  103c41:	b9 00 00 00 00       	mov    $0x0,%ecx
+                dwarf_stats.dws_line_lookups++;
+  103c46:	83 05 b0 e2 11 00 01 	addl   $0x1,0x11e2b0
+  103c4d:	0f 31                	rdtsc
+                dwarf_stats.dws_line_cycles += read_tsc() - tsc;
+  103c4f:	8b 35 b4 e2 11 00    	mov    0x11e2b4,%esi
+  103c55:	8b 3d b8 e2 11 00    	mov    0x11e2b8,%edi
+  103c5b:	2b 75 88             	sub    -0x78(%ebp),%esi
+  103c5e:	1b 7d 8c             	sbb    -0x74(%ebp),%edi
+  103c61:	01 c6                	add    %eax,%esi
+  103c63:	11 d7                	adc    %edx,%edi
+  103c65:	89 35 b4 e2 11 00    	mov    %esi,0x11e2b4
+  103c6b:	89 3d b8 e2 11 00    	mov    %edi,0x11e2b8
+}
+  103c71:	89 c8                	mov    %ecx,%eax
+  103c73:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  103c76:	5b                   	pop    %ebx
+  103c77:	5e                   	pop    %esi
+  103c78:	5f                   	pop    %edi
+  103c79:	5d                   	pop    %ebp
+  103c7a:	c3                   	ret
+                return -E_BAD_DWARF;
+  103c7b:	b9 fa ff ff ff       	mov    $0xfffffffa,%ecx
+  103c80:	eb c4                	jmp    103c46 <line_for_address+0x175>
+                return -E_BAD_DWARF;
+  103c82:	b9 fa ff ff ff       	mov    $0xfffffffa,%ecx
+  103c87:	eb bd                	jmp    103c46 <line_for_address+0x175>
+        code = line_program_header(addrs, line_offset, &info, &program_addr,
+  103c89:	83 ec 04             	sub    $0x4,%esp
+  103c8c:	8d 45 cc             	lea    -0x34(%ebp),%eax
+  103c8f:	50                   	push   %eax
+  103c90:	8d 45 d0             	lea    -0x30(%ebp),%eax
+  103c93:	50                   	push   %eax
+  103c94:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+  103c97:	50                   	push   %eax
+  103c98:	89 f2                	mov    %esi,%edx
+  103c9a:	89 f9                	mov    %edi,%ecx
+  103c9c:	8b 45 08             	mov    0x8(%ebp),%eax
+  103c9f:	e8 0e f9 ff ff       	call   1035b2 <line_program_header>
+  103ca4:	89 c1                	mov    %eax,%ecx
+        if (code < 0) {
+  103ca6:	83 c4 10             	add    $0x10,%esp
+  103ca9:	85 c0                	test   %eax,%eax
+  103cab:	78 c4                	js     103c71 <line_for_address+0x1a0>
+        struct Line_Search search = {
+  103cad:	b9 00 00 00 00       	mov    $0x0,%ecx
+  103cb2:	ba 18 00 00 00       	mov    $0x18,%edx
+  103cb7:	b8 00 00 00 00       	mov    $0x0,%eax
+  103cbc:	89 4c 05 b4          	mov    %ecx,-0x4c(%ebp,%eax,1)
+  103cc0:	83 c0 04             	add    $0x4,%eax
+  103cc3:	39 d0                	cmp    %edx,%eax
+  103cc5:	72 f5                	jb     103cbc <line_for_address+0x1eb>
+  103cc7:	8b 45 0c             	mov    0xc(%ebp),%eax
+  103cca:	89 45 b0             	mov    %eax,-0x50(%ebp)
+                program_addr = run_line_number_program(
+  103ccd:	8d 5d b0             	lea    -0x50(%ebp),%ebx
+        while (program_addr < end_addr && !search.found) {
+  103cd0:	eb 17                	jmp    103ce9 <line_for_address+0x218>
+                program_addr = run_line_number_program(
+  103cd2:	83 ec 08             	sub    $0x8,%esp
+  103cd5:	53                   	push   %ebx
+  103cd6:	68 97 2e 10 00       	push   $0x102e97
+  103cdb:	8d 4d d4             	lea    -0x2c(%ebp),%ecx
+  103cde:	e8 3d f3 ff ff       	call   103020 <run_line_number_program>
+  103ce3:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  103ce6:	83 c4 10             	add    $0x10,%esp
+        while (program_addr < end_addr && !search.found) {
+  103ce9:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  103cec:	8b 55 cc             	mov    -0x34(%ebp),%edx
+  103cef:	39 d0                	cmp    %edx,%eax
+  103cf1:	73 06                	jae    103cf9 <line_for_address+0x228>
+  103cf3:	80 7d c8 00          	cmpb   $0x0,-0x38(%ebp)
+  103cf7:	74 d9                	je     103cd2 <line_for_address+0x201>
+        *lineno_store = search.last_state.line;
+  103cf9:	8b 45 b8             	mov    -0x48(%ebp),%eax
+  103cfc:	8b 75 18             	mov    0x18(%ebp),%esi
+  103cff:	89 06                	mov    %eax,(%esi)
+        return 0;
+  103d01:	b9 00 00 00 00       	mov    $0x0,%ecx
+  103d06:	e9 66 ff ff ff       	jmp    103c71 <line_for_address+0x1a0>
+                return -E_INVAL;
+  103d0b:	b9 fd ff ff ff       	mov    $0xfffffffd,%ecx
+  103d10:	e9 5c ff ff ff       	jmp    103c71 <line_for_address+0x1a0>
+
+00103d15 <lines_for_addresses>:
+                        int *linenos) {
+  103d15:	55                   	push   %ebp
+  103d16:	89 e5                	mov    %esp,%ebp
+  103d18:	57                   	push   %edi
+  103d19:	56                   	push   %esi
+  103d1a:	53                   	push   %ebx
+  103d1b:	83 ec 4c             	sub    $0x4c,%esp
+  103d1e:	8b 75 0c             	mov    0xc(%ebp),%esi
+  103d21:	8b 7d 10             	mov    0x10(%ebp),%edi
+        if (linenos == NULL) {
+  103d24:	83 7d 1c 00          	cmpl   $0x0,0x1c(%ebp)
+  103d28:	0f 84 8f 02 00 00    	je     103fbd <lines_for_addresses+0x2a8>
+  103d2e:	0f 31                	rdtsc
+  103d30:	89 45 b0             	mov    %eax,-0x50(%ebp)
+  103d33:	89 55 b4             	mov    %edx,-0x4c(%ebp)
+        struct Line_Table *table = line_table_get(addrs, line_offset);
+  103d36:	89 f2                	mov    %esi,%edx
+  103d38:	89 f9                	mov    %edi,%ecx
+  103d3a:	8b 45 08             	mov    0x8(%ebp),%eax
+  103d3d:	e8 40 fd ff ff       	call   103a82 <line_table_get>
+  103d42:	89 45 d8             	mov    %eax,-0x28(%ebp)
+        if (!table) {
+  103d45:	85 c0                	test   %eax,%eax
+  103d47:	74 46                	je     103d8f <lines_for_addresses+0x7a>
+        int nanchors = (table->nrows + DWARF_LINE_STRIDE - 1) /
+  103d49:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  103d4c:	8b 00                	mov    (%eax),%eax
+  103d4e:	8d 50 1e             	lea    0x1e(%eax),%edx
+  103d51:	83 c0 0f             	add    $0xf,%eax
+  103d54:	0f 49 d0             	cmovns %eax,%edx
+  103d57:	c1 fa 04             	sar    $0x4,%edx
+  103d5a:	89 55 b8             	mov    %edx,-0x48(%ebp)
+        for (i = 0; i < n; i++) {
+  103d5d:	8b 45 14             	mov    0x14(%ebp),%eax
+  103d60:	89 45 dc             	mov    %eax,-0x24(%ebp)
+        const char *deltas = NULL;
+  103d63:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%ebp)
+        uint32_t address = 0;
+  103d6a:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%ebp)
+        int row = -1, line = 0;
+  103d71:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+  103d78:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+        for (i = 0; i < n; i++) {
+  103d7d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  103d82:	89 7d cc             	mov    %edi,-0x34(%ebp)
+  103d85:	89 de                	mov    %ebx,%esi
+  103d87:	8b 5d 1c             	mov    0x1c(%ebp),%ebx
+  103d8a:	e9 9c 01 00 00       	jmp    103f2b <lines_for_addresses+0x216>
+  103d8f:	8b 45 1c             	mov    0x1c(%ebp),%eax
+                for (i = 0; i < n; i++) {
+  103d92:	bb 00 00 00 00       	mov    $0x0,%ebx
+  103d97:	89 75 e0             	mov    %esi,-0x20(%ebp)
+  103d9a:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+  103d9d:	89 c7                	mov    %eax,%edi
+  103d9f:	eb 27                	jmp    103dc8 <lines_for_addresses+0xb3>
+                        linenos[i] = 0;
+  103da1:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+                        line_for_address(addrs, ps[i], line_offset,
+  103da7:	83 ec 0c             	sub    $0xc,%esp
+  103daa:	57                   	push   %edi
+  103dab:	ff 75 e4             	push   -0x1c(%ebp)
+  103dae:	ff 75 e0             	push   -0x20(%ebp)
+  103db1:	8b 45 14             	mov    0x14(%ebp),%eax
+  103db4:	ff 34 98             	push   (%eax,%ebx,4)
+  103db7:	ff 75 08             	push   0x8(%ebp)
+  103dba:	e8 12 fd ff ff       	call   103ad1 <line_for_address>
+                for (i = 0; i < n; i++) {
+  103dbf:	83 c3 01             	add    $0x1,%ebx
+  103dc2:	83 c7 04             	add    $0x4,%edi
+  103dc5:	83 c4 20             	add    $0x20,%esp
+  103dc8:	3b 5d 18             	cmp    0x18(%ebp),%ebx
+  103dcb:	7c d4                	jl     103da1 <lines_for_addresses+0x8c>
+                return 0;
+  103dcd:	b8 00 00 00 00       	mov    $0x0,%eax
+  103dd2:	e9 de 01 00 00       	jmp    103fb5 <lines_for_addresses+0x2a0>
+                                lo = mid + 1;
+  103dd7:	8d 4f 01             	lea    0x1(%edi),%ecx
+  103dda:	e9 6f 01 00 00       	jmp    103f4e <lines_for_addresses+0x239>
+                if (lo > 0 && (lo - 1) * DWARF_LINE_STRIDE > row) {
+  103ddf:	8b 5d 1c             	mov    0x1c(%ebp),%ebx
+  103de2:	85 c9                	test   %ecx,%ecx
+  103de4:	7e 31                	jle    103e17 <lines_for_addresses+0x102>
+  103de6:	8d 41 ff             	lea    -0x1(%ecx),%eax
+  103de9:	c1 e0 04             	shl    $0x4,%eax
+  103dec:	8b 7d cc             	mov    -0x34(%ebp),%edi
+  103def:	39 f8                	cmp    %edi,%eax
+  103df1:	7e 24                	jle    103e17 <lines_for_addresses+0x102>
+                            &table->anchors[lo - 1];
+  103df3:	8d 0c 49             	lea    (%ecx,%ecx,2),%ecx
+                        const struct Line_Anchor *anchor =
+  103df6:	8b 7d d8             	mov    -0x28(%ebp),%edi
+  103df9:	8b 57 04             	mov    0x4(%edi),%edx
+  103dfc:	8d 54 8a f4          	lea    -0xc(%edx,%ecx,4),%edx
+                        address = anchor->address;
+  103e00:	8b 0a                	mov    (%edx),%ecx
+  103e02:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+                        line = anchor->line;
+  103e05:	8b 4a 04             	mov    0x4(%edx),%ecx
+  103e08:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+                        deltas = (const char *)table->rows + anchor->deltas;
+  103e0b:	8b 52 08             	mov    0x8(%edx),%edx
+  103e0e:	03 57 08             	add    0x8(%edi),%edx
+  103e11:	89 55 e0             	mov    %edx,-0x20(%ebp)
+                        row = (lo - 1) * DWARF_LINE_STRIDE;
+  103e14:	89 45 cc             	mov    %eax,-0x34(%ebp)
+                while (row + 1 < table->nrows) {
+  103e17:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  103e1a:	8b 00                	mov    (%eax),%eax
+  103e1c:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  103e1f:	89 75 bc             	mov    %esi,-0x44(%ebp)
+  103e22:	89 5d 1c             	mov    %ebx,0x1c(%ebp)
+  103e25:	8b 5d cc             	mov    -0x34(%ebp),%ebx
+  103e28:	e9 a6 00 00 00       	jmp    103ed3 <lines_for_addresses+0x1be>
+	count = 0;
+  103e2d:	b8 00 00 00 00       	mov    $0x0,%eax
+	result = 0;
+  103e32:	be 00 00 00 00       	mov    $0x0,%esi
+  103e37:	89 5d c4             	mov    %ebx,-0x3c(%ebp)
+  103e3a:	89 c7                	mov    %eax,%edi
+		byte = *addr;
+  103e3c:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  103e3f:	0f b6 1c 01          	movzbl (%ecx,%eax,1),%ebx
+		count++;
+  103e43:	83 c0 01             	add    $0x1,%eax
+		result |= (byte & 0x7f) << shift;
+  103e46:	89 da                	mov    %ebx,%edx
+  103e48:	83 e2 7f             	and    $0x7f,%edx
+  103e4b:	8d 0c fd 00 00 00 00 	lea    0x0(,%edi,8),%ecx
+  103e52:	29 f9                	sub    %edi,%ecx
+  103e54:	d3 e2                	shl    %cl,%edx
+  103e56:	09 d6                	or     %edx,%esi
+		if (!(byte & 0x80))
+  103e58:	84 db                	test   %bl,%bl
+  103e5a:	78 de                	js     103e3a <lines_for_addresses+0x125>
+                                next_deltas += dwarf_read_uleb128(
+  103e5c:	8b 5d c4             	mov    -0x3c(%ebp),%ebx
+  103e5f:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+  103e62:	8b 75 e0             	mov    -0x20(%ebp),%esi
+  103e65:	01 f0                	add    %esi,%eax
+	count = 0;
+  103e67:	ba 00 00 00 00       	mov    $0x0,%edx
+	shift = 0;
+  103e6c:	b9 00 00 00 00       	mov    $0x0,%ecx
+	result = 0;
+  103e71:	be 00 00 00 00       	mov    $0x0,%esi
+  103e76:	89 5d c0             	mov    %ebx,-0x40(%ebp)
+  103e79:	89 c7                	mov    %eax,%edi
+		byte = *addr;
+  103e7b:	0f b6 04 17          	movzbl (%edi,%edx,1),%eax
+		result |= (byte & 0x7f) << shift;
+  103e7f:	89 c3                	mov    %eax,%ebx
+  103e81:	83 e3 7f             	and    $0x7f,%ebx
+  103e84:	d3 e3                	shl    %cl,%ebx
+  103e86:	09 de                	or     %ebx,%esi
+		shift += 7;
+  103e88:	83 c1 07             	add    $0x7,%ecx
+		count++;
+  103e8b:	83 c2 01             	add    $0x1,%edx
+		if (!(byte & 0x80))
+  103e8e:	84 c0                	test   %al,%al
+  103e90:	78 e9                	js     103e7b <lines_for_addresses+0x166>
+	if ((shift < num_bits) && (byte & 0x40))
+  103e92:	8b 5d c0             	mov    -0x40(%ebp),%ebx
+  103e95:	88 45 c0             	mov    %al,-0x40(%ebp)
+  103e98:	89 f8                	mov    %edi,%eax
+  103e9a:	0f b6 7d c0          	movzbl -0x40(%ebp),%edi
+  103e9e:	83 f9 1f             	cmp    $0x1f,%ecx
+  103ea1:	7f 11                	jg     103eb4 <lines_for_addresses+0x19f>
+  103ea3:	f7 c7 40 00 00 00    	test   $0x40,%edi
+  103ea9:	74 09                	je     103eb4 <lines_for_addresses+0x19f>
+		result |= (-1U << shift);
+  103eab:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+  103eb0:	d3 e7                	shl    %cl,%edi
+  103eb2:	09 fe                	or     %edi,%esi
+                                next_deltas +=
+  103eb4:	01 c2                	add    %eax,%edx
+                                next_address = address + address_incr;
+  103eb6:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+  103eb9:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  103ebc:	01 f8                	add    %edi,%eax
+                                next_line = line + line_incr;
+  103ebe:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  103ec1:	01 fe                	add    %edi,%esi
+                        if (next_address > ps[i]) {
+  103ec3:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  103ec6:	39 01                	cmp    %eax,(%ecx)
+  103ec8:	72 43                	jb     103f0d <lines_for_addresses+0x1f8>
+                        deltas = next_deltas;
+  103eca:	89 55 e0             	mov    %edx,-0x20(%ebp)
+                        address = next_address;
+  103ecd:	89 45 d0             	mov    %eax,-0x30(%ebp)
+                        line = next_line;
+  103ed0:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+                while (row + 1 < table->nrows) {
+  103ed3:	89 5d cc             	mov    %ebx,-0x34(%ebp)
+  103ed6:	83 c3 01             	add    $0x1,%ebx
+  103ed9:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  103edc:	39 c3                	cmp    %eax,%ebx
+  103ede:	7d 2d                	jge    103f0d <lines_for_addresses+0x1f8>
+                        if ((row + 1) % DWARF_LINE_STRIDE == 0) {
+  103ee0:	f6 c3 0f             	test   $0xf,%bl
+  103ee3:	0f 85 44 ff ff ff    	jne    103e2d <lines_for_addresses+0x118>
+                                    &table->anchors[(row + 1) /
+  103ee9:	8d 43 0f             	lea    0xf(%ebx),%eax
+  103eec:	85 db                	test   %ebx,%ebx
+  103eee:	0f 49 c3             	cmovns %ebx,%eax
+  103ef1:	c1 f8 04             	sar    $0x4,%eax
+  103ef4:	8d 14 40             	lea    (%eax,%eax,2),%edx
+                                const struct Line_Anchor *anchor =
+  103ef7:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  103efa:	8b 41 04             	mov    0x4(%ecx),%eax
+  103efd:	8d 14 90             	lea    (%eax,%edx,4),%edx
+                                next_address = anchor->address;
+  103f00:	8b 02                	mov    (%edx),%eax
+                                next_line = anchor->line;
+  103f02:	8b 72 04             	mov    0x4(%edx),%esi
+                                next_deltas = (const char *)table->rows +
+  103f05:	8b 52 08             	mov    0x8(%edx),%edx
+  103f08:	03 51 08             	add    0x8(%ecx),%edx
+  103f0b:	eb b6                	jmp    103ec3 <lines_for_addresses+0x1ae>
+                linenos[i] = row < 0 ? 0 : line;
+  103f0d:	8b 75 bc             	mov    -0x44(%ebp),%esi
+  103f10:	8b 5d 1c             	mov    0x1c(%ebp),%ebx
+  103f13:	8b 7d cc             	mov    -0x34(%ebp),%edi
+  103f16:	85 ff                	test   %edi,%edi
+  103f18:	b8 00 00 00 00       	mov    $0x0,%eax
+  103f1d:	0f 49 45 d4          	cmovns -0x2c(%ebp),%eax
+  103f21:	89 04 b3             	mov    %eax,(%ebx,%esi,4)
+        for (i = 0; i < n; i++) {
+  103f24:	83 c6 01             	add    $0x1,%esi
+  103f27:	83 45 dc 04          	addl   $0x4,-0x24(%ebp)
+  103f2b:	3b 75 18             	cmp    0x18(%ebp),%esi
+  103f2e:	7d 53                	jge    103f83 <lines_for_addresses+0x26e>
+                int lo = row < 0 ? 0 : row / DWARF_LINE_STRIDE + 1;
+  103f30:	b9 00 00 00 00       	mov    $0x0,%ecx
+  103f35:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  103f38:	85 c0                	test   %eax,%eax
+  103f3a:	78 0c                	js     103f48 <lines_for_addresses+0x233>
+  103f3c:	8d 48 0f             	lea    0xf(%eax),%ecx
+  103f3f:	0f 49 c8             	cmovns %eax,%ecx
+  103f42:	c1 f9 04             	sar    $0x4,%ecx
+  103f45:	83 c1 01             	add    $0x1,%ecx
+  103f48:	8b 55 b8             	mov    -0x48(%ebp),%edx
+  103f4b:	89 5d 1c             	mov    %ebx,0x1c(%ebp)
+                while (lo < hi) {
+  103f4e:	39 d1                	cmp    %edx,%ecx
+  103f50:	0f 8d 89 fe ff ff    	jge    103ddf <lines_for_addresses+0xca>
+                        int mid = (lo + hi) / 2;
+  103f56:	8d 04 11             	lea    (%ecx,%edx,1),%eax
+  103f59:	89 c7                	mov    %eax,%edi
+  103f5b:	c1 ef 1f             	shr    $0x1f,%edi
+  103f5e:	01 f8                	add    %edi,%eax
+  103f60:	89 c7                	mov    %eax,%edi
+  103f62:	d1 ff                	sar    %edi
+                        if (table->anchors[mid].address <= ps[i]) {
+  103f64:	83 e0 fe             	and    $0xfffffffe,%eax
+  103f67:	01 f8                	add    %edi,%eax
+  103f69:	c1 e0 02             	shl    $0x2,%eax
+  103f6c:	8b 5d d8             	mov    -0x28(%ebp),%ebx
+  103f6f:	03 43 04             	add    0x4(%ebx),%eax
+  103f72:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+  103f75:	8b 00                	mov    (%eax),%eax
+  103f77:	39 03                	cmp    %eax,(%ebx)
+  103f79:	0f 83 58 fe ff ff    	jae    103dd7 <lines_for_addresses+0xc2>
+                        int mid = (lo + hi) / 2;
+  103f7f:	89 fa                	mov    %edi,%edx
+  103f81:	eb cb                	jmp    103f4e <lines_for_addresses+0x239>
+        dwarf_stats.dws_line_lookups += n;
+  103f83:	8b 45 18             	mov    0x18(%ebp),%eax
+  103f86:	01 05 b0 e2 11 00    	add    %eax,0x11e2b0
+  103f8c:	0f 31                	rdtsc
+        dwarf_stats.dws_line_cycles += read_tsc() - tsc;
+  103f8e:	8b 0d b4 e2 11 00    	mov    0x11e2b4,%ecx
+  103f94:	8b 1d b8 e2 11 00    	mov    0x11e2b8,%ebx
+  103f9a:	2b 4d b0             	sub    -0x50(%ebp),%ecx
+  103f9d:	1b 5d b4             	sbb    -0x4c(%ebp),%ebx
+  103fa0:	01 c1                	add    %eax,%ecx
+  103fa2:	11 d3                	adc    %edx,%ebx
+  103fa4:	89 0d b4 e2 11 00    	mov    %ecx,0x11e2b4
+  103faa:	89 1d b8 e2 11 00    	mov    %ebx,0x11e2b8
+        return 0;
+  103fb0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  103fb5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  103fb8:	5b                   	pop    %ebx
+  103fb9:	5e                   	pop    %esi
+  103fba:	5f                   	pop    %edi
+  103fbb:	5d                   	pop    %ebp
+  103fbc:	c3                   	ret
+                return -E_INVAL;
+  103fbd:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  103fc2:	eb f1                	jmp    103fb5 <lines_for_addresses+0x2a0>
+
+00103fc4 <dwarf_line_files>:
+// Files count from 1 before DWARF 5, from 0 since.  Returns one more than
+// the highest number, or an error.
+int dwarf_line_files(const struct Dwarf_Addrs *addrs,
+                     const struct Dwarf_CU *cu, Dwarf_Off line_offset,
+                     void (*fn)(unsigned index, const char *dir,
+                                const char *name)) {
+  103fc4:	55                   	push   %ebp
+  103fc5:	89 e5                	mov    %esp,%ebp
+  103fc7:	57                   	push   %edi
+  103fc8:	56                   	push   %esi
+  103fc9:	53                   	push   %ebx
+  103fca:	83 ec 70             	sub    $0x70,%esp
+        struct Line_Number_Info info;
+        const void *program_addr, *end_addr;
+        int code = line_program_header(addrs, line_offset, &info,
+  103fcd:	8d 45 cc             	lea    -0x34(%ebp),%eax
+  103fd0:	50                   	push   %eax
+  103fd1:	8d 45 d0             	lea    -0x30(%ebp),%eax
+  103fd4:	50                   	push   %eax
+  103fd5:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+  103fd8:	50                   	push   %eax
+  103fd9:	8b 55 10             	mov    0x10(%ebp),%edx
+  103fdc:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  103fdf:	8b 45 08             	mov    0x8(%ebp),%eax
+  103fe2:	e8 cb f5 ff ff       	call   1035b2 <line_program_header>
+                                       &program_addr, &end_addr);
+        if (code < 0) {
+  103fe7:	83 c4 10             	add    $0x10,%esp
+  103fea:	85 c0                	test   %eax,%eax
+  103fec:	0f 88 59 03 00 00    	js     10434b <dwarf_line_files+0x387>
+                return code;
+        }
+        const char *p = info.file_tables;
+  103ff2:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+        const char *end = program_addr;
+  103ff5:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  103ff8:	89 45 b0             	mov    %eax,-0x50(%ebp)
+        unsigned index = 0;
+
+        if (info.version < 5) {
+  103ffb:	66 83 7d e0 04       	cmpw   $0x4,-0x20(%ebp)
+  104000:	76 4b                	jbe    10404d <dwarf_line_files+0x89>
+                return index + 1;
+        }
+
+        // Each table has the format of its entries first, then their
+        // number, then the entries.
+        int ndir_format = *p++;
+  104002:	8d 41 01             	lea    0x1(%ecx),%eax
+  104005:	89 45 ac             	mov    %eax,-0x54(%ebp)
+  104008:	0f be 31             	movsbl (%ecx),%esi
+  10400b:	89 75 a0             	mov    %esi,-0x60(%ebp)
+        const char *dir_format = p;
+        unsigned skip, ndirs = 0, nfiles = 0;
+        int i;
+        for (i = 0; i < 2 * ndir_format; i++) {
+  10400e:	8d 1c 36             	lea    (%esi,%esi,1),%ebx
+        int ndir_format = *p++;
+  104011:	89 45 b4             	mov    %eax,-0x4c(%ebp)
+        for (i = 0; i < 2 * ndir_format; i++) {
+  104014:	bf 00 00 00 00       	mov    $0x0,%edi
+  104019:	89 5d a4             	mov    %ebx,-0x5c(%ebp)
+  10401c:	e9 60 01 00 00       	jmp    104181 <dwarf_line_files+0x1bd>
+                        p += strlen(p) + 1;
+  104021:	83 ec 0c             	sub    $0xc,%esp
+  104024:	53                   	push   %ebx
+  104025:	e8 ab 4f 00 00       	call   108fd5 <strlen>
+  10402a:	8d 5c 03 01          	lea    0x1(%ebx,%eax,1),%ebx
+  10402e:	83 c4 10             	add    $0x10,%esp
+                while (p < end && *p) {
+  104031:	39 f3                	cmp    %esi,%ebx
+  104033:	73 05                	jae    10403a <dwarf_line_files+0x76>
+  104035:	80 3b 00             	cmpb   $0x0,(%ebx)
+  104038:	75 e7                	jne    104021 <dwarf_line_files+0x5d>
+                for (p++; p < end && *p;) {
+  10403a:	89 f9                	mov    %edi,%ecx
+  10403c:	8d 43 01             	lea    0x1(%ebx),%eax
+        unsigned index = 0;
+  10403f:	c7 45 ac 00 00 00 00 	movl   $0x0,-0x54(%ebp)
+  104046:	89 c7                	mov    %eax,%edi
+  104048:	89 4d a4             	mov    %ecx,-0x5c(%ebp)
+                for (p++; p < end && *p;) {
+  10404b:	eb 49                	jmp    104096 <dwarf_line_files+0xd2>
+        const char *p = info.file_tables;
+  10404d:	89 cb                	mov    %ecx,%ebx
+  10404f:	89 cf                	mov    %ecx,%edi
+  104051:	8b 75 b0             	mov    -0x50(%ebp),%esi
+  104054:	eb db                	jmp    104031 <dwarf_line_files+0x6d>
+                                        dir += strlen(dir) + 1;
+  104056:	83 ec 0c             	sub    $0xc,%esp
+  104059:	53                   	push   %ebx
+  10405a:	e8 76 4f 00 00       	call   108fd5 <strlen>
+  10405f:	8d 5c 03 01          	lea    0x1(%ebx,%eax,1),%ebx
+  104063:	83 c4 10             	add    $0x10,%esp
+                                while (--dir_index > 0 && *dir) {
+  104066:	83 ef 01             	sub    $0x1,%edi
+  104069:	74 0a                	je     104075 <dwarf_line_files+0xb1>
+  10406b:	80 3b 00             	cmpb   $0x0,(%ebx)
+  10406e:	75 e6                	jne    104056 <dwarf_line_files+0x92>
+  104070:	8b 7d b4             	mov    -0x4c(%ebp),%edi
+  104073:	eb 03                	jmp    104078 <dwarf_line_files+0xb4>
+  104075:	8b 7d b4             	mov    -0x4c(%ebp),%edi
+                        fn(++index, line_file_dir(dir, name), name);
+  104078:	89 fa                	mov    %edi,%edx
+  10407a:	89 d8                	mov    %ebx,%eax
+  10407c:	e8 dc f4 ff ff       	call   10355d <line_file_dir>
+  104081:	83 45 ac 01          	addl   $0x1,-0x54(%ebp)
+  104085:	8b 4d ac             	mov    -0x54(%ebp),%ecx
+  104088:	83 ec 04             	sub    $0x4,%esp
+  10408b:	57                   	push   %edi
+  10408c:	50                   	push   %eax
+  10408d:	51                   	push   %ecx
+  10408e:	ff 55 18             	call   *0x18(%ebp)
+  104091:	83 c4 10             	add    $0x10,%esp
+                        p += dwarf_read_uleb128(p, &skip);
+  104094:	89 f7                	mov    %esi,%edi
+                for (p++; p < end && *p;) {
+  104096:	8b 45 b0             	mov    -0x50(%ebp),%eax
+  104099:	39 c7                	cmp    %eax,%edi
+  10409b:	0f 83 9a 00 00 00    	jae    10413b <dwarf_line_files+0x177>
+  1040a1:	80 3f 00             	cmpb   $0x0,(%edi)
+  1040a4:	0f 84 91 00 00 00    	je     10413b <dwarf_line_files+0x177>
+                        p += strlen(p) + 1;
+  1040aa:	83 ec 0c             	sub    $0xc,%esp
+  1040ad:	57                   	push   %edi
+  1040ae:	e8 22 4f 00 00       	call   108fd5 <strlen>
+  1040b3:	8d 74 07 01          	lea    0x1(%edi,%eax,1),%esi
+  1040b7:	83 c4 10             	add    $0x10,%esp
+	count = 0;
+  1040ba:	b8 00 00 00 00       	mov    $0x0,%eax
+	result = 0;
+  1040bf:	b9 00 00 00 00       	mov    $0x0,%ecx
+  1040c4:	89 7d a8             	mov    %edi,-0x58(%ebp)
+  1040c7:	89 75 b4             	mov    %esi,-0x4c(%ebp)
+  1040ca:	89 ce                	mov    %ecx,%esi
+  1040cc:	89 c7                	mov    %eax,%edi
+		byte = *addr;
+  1040ce:	8b 4d b4             	mov    -0x4c(%ebp),%ecx
+  1040d1:	0f b6 1c 01          	movzbl (%ecx,%eax,1),%ebx
+		count++;
+  1040d5:	83 c0 01             	add    $0x1,%eax
+		result |= (byte & 0x7f) << shift;
+  1040d8:	89 da                	mov    %ebx,%edx
+  1040da:	83 e2 7f             	and    $0x7f,%edx
+  1040dd:	8d 0c fd 00 00 00 00 	lea    0x0(,%edi,8),%ecx
+  1040e4:	29 f9                	sub    %edi,%ecx
+  1040e6:	d3 e2                	shl    %cl,%edx
+  1040e8:	09 d6                	or     %edx,%esi
+		if (!(byte & 0x80))
+  1040ea:	84 db                	test   %bl,%bl
+  1040ec:	78 de                	js     1040cc <dwarf_line_files+0x108>
+                        p += dwarf_read_uleb128(p, &dir_index);
+  1040ee:	8b 7d a8             	mov    -0x58(%ebp),%edi
+  1040f1:	89 75 a8             	mov    %esi,-0x58(%ebp)
+  1040f4:	8b 75 b4             	mov    -0x4c(%ebp),%esi
+  1040f7:	01 c6                	add    %eax,%esi
+	count = 0;
+  1040f9:	b8 00 00 00 00       	mov    $0x0,%eax
+		byte = *addr;
+  1040fe:	0f b6 14 06          	movzbl (%esi,%eax,1),%edx
+		count++;
+  104102:	83 c0 01             	add    $0x1,%eax
+		if (!(byte & 0x80))
+  104105:	84 d2                	test   %dl,%dl
+  104107:	78 f5                	js     1040fe <dwarf_line_files+0x13a>
+                        p += dwarf_read_uleb128(p, &skip);
+  104109:	01 f0                	add    %esi,%eax
+	count = 0;
+  10410b:	ba 00 00 00 00       	mov    $0x0,%edx
+		byte = *addr;
+  104110:	0f b6 0c 10          	movzbl (%eax,%edx,1),%ecx
+		count++;
+  104114:	83 c2 01             	add    $0x1,%edx
+		if (!(byte & 0x80))
+  104117:	84 c9                	test   %cl,%cl
+  104119:	78 f5                	js     104110 <dwarf_line_files+0x14c>
+                        p += dwarf_read_uleb128(p, &skip);
+  10411b:	8d 34 10             	lea    (%eax,%edx,1),%esi
+                        const char *name = p, *dir = NULL;
+  10411e:	bb 00 00 00 00       	mov    $0x0,%ebx
+                        if (dir_index > 0) {
+  104123:	83 7d a8 00          	cmpl   $0x0,-0x58(%ebp)
+  104127:	0f 84 4b ff ff ff    	je     104078 <dwarf_line_files+0xb4>
+                                dir = dirs;
+  10412d:	8b 5d a4             	mov    -0x5c(%ebp),%ebx
+  104130:	89 7d b4             	mov    %edi,-0x4c(%ebp)
+  104133:	8b 7d a8             	mov    -0x58(%ebp),%edi
+  104136:	e9 2b ff ff ff       	jmp    104066 <dwarf_line_files+0xa2>
+                return index + 1;
+  10413b:	8b 45 ac             	mov    -0x54(%ebp),%eax
+  10413e:	83 c0 01             	add    $0x1,%eax
+  104141:	e9 05 02 00 00       	jmp    10434b <dwarf_line_files+0x387>
+	count = 0;
+  104146:	b8 00 00 00 00       	mov    $0x0,%eax
+	result = 0;
+  10414b:	be 00 00 00 00       	mov    $0x0,%esi
+  104150:	89 7d a8             	mov    %edi,-0x58(%ebp)
+  104153:	89 c7                	mov    %eax,%edi
+		byte = *addr;
+  104155:	8b 5d b4             	mov    -0x4c(%ebp),%ebx
+  104158:	0f b6 1c 03          	movzbl (%ebx,%eax,1),%ebx
+		count++;
+  10415c:	83 c0 01             	add    $0x1,%eax
+		result |= (byte & 0x7f) << shift;
+  10415f:	89 da                	mov    %ebx,%edx
+  104161:	83 e2 7f             	and    $0x7f,%edx
+  104164:	8d 0c fd 00 00 00 00 	lea    0x0(,%edi,8),%ecx
+  10416b:	29 f9                	sub    %edi,%ecx
+  10416d:	d3 e2                	shl    %cl,%edx
+  10416f:	09 d6                	or     %edx,%esi
+		if (!(byte & 0x80))
+  104171:	84 db                	test   %bl,%bl
+  104173:	78 de                	js     104153 <dwarf_line_files+0x18f>
+	*ret = result;
+  104175:	8b 7d a8             	mov    -0x58(%ebp),%edi
+  104178:	89 75 c8             	mov    %esi,-0x38(%ebp)
+                p += dwarf_read_uleb128(p, &skip);
+  10417b:	01 45 b4             	add    %eax,-0x4c(%ebp)
+        for (i = 0; i < 2 * ndir_format; i++) {
+  10417e:	83 c7 01             	add    $0x1,%edi
+  104181:	39 7d a4             	cmp    %edi,-0x5c(%ebp)
+  104184:	7f c0                	jg     104146 <dwarf_line_files+0x182>
+	count = 0;
+  104186:	b8 00 00 00 00       	mov    $0x0,%eax
+	result = 0;
+  10418b:	be 00 00 00 00       	mov    $0x0,%esi
+  104190:	89 c7                	mov    %eax,%edi
+		byte = *addr;
+  104192:	8b 4d b4             	mov    -0x4c(%ebp),%ecx
+  104195:	0f b6 1c 01          	movzbl (%ecx,%eax,1),%ebx
+		count++;
+  104199:	83 c0 01             	add    $0x1,%eax
+		result |= (byte & 0x7f) << shift;
+  10419c:	89 da                	mov    %ebx,%edx
+  10419e:	83 e2 7f             	and    $0x7f,%edx
+  1041a1:	8d 0c fd 00 00 00 00 	lea    0x0(,%edi,8),%ecx
+  1041a8:	29 f9                	sub    %edi,%ecx
+  1041aa:	d3 e2                	shl    %cl,%edx
+  1041ac:	09 d6                	or     %edx,%esi
+		if (!(byte & 0x80))
+  1041ae:	84 db                	test   %bl,%bl
+  1041b0:	78 de                	js     104190 <dwarf_line_files+0x1cc>
+        }
+        p += dwarf_read_uleb128(p, &ndirs);
+  1041b2:	89 75 a8             	mov    %esi,-0x58(%ebp)
+  1041b5:	8b 75 b4             	mov    -0x4c(%ebp),%esi
+  1041b8:	01 c6                	add    %eax,%esi
+  1041ba:	89 75 90             	mov    %esi,-0x70(%ebp)
+  1041bd:	89 f3                	mov    %esi,%ebx
+        const char *dirs = p;
+        for (i = 0; i < ndirs && p < end; i++) {
+  1041bf:	be 00 00 00 00       	mov    $0x0,%esi
+                const char *path = NULL;
+                p += line_file_entry(addrs, cu, p, dir_format, ndir_format,
+  1041c4:	8d 7d c4             	lea    -0x3c(%ebp),%edi
+        for (i = 0; i < ndirs && p < end; i++) {
+  1041c7:	8b 45 b0             	mov    -0x50(%ebp),%eax
+  1041ca:	39 c3                	cmp    %eax,%ebx
+  1041cc:	73 29                	jae    1041f7 <dwarf_line_files+0x233>
+  1041ce:	8b 45 a8             	mov    -0x58(%ebp),%eax
+  1041d1:	39 c6                	cmp    %eax,%esi
+  1041d3:	73 22                	jae    1041f7 <dwarf_line_files+0x233>
+                p += line_file_entry(addrs, cu, p, dir_format, ndir_format,
+  1041d5:	8d 45 c8             	lea    -0x38(%ebp),%eax
+  1041d8:	50                   	push   %eax
+  1041d9:	57                   	push   %edi
+  1041da:	ff 75 a0             	push   -0x60(%ebp)
+  1041dd:	ff 75 ac             	push   -0x54(%ebp)
+  1041e0:	89 d9                	mov    %ebx,%ecx
+  1041e2:	8b 55 0c             	mov    0xc(%ebp),%edx
+  1041e5:	8b 45 08             	mov    0x8(%ebp),%eax
+  1041e8:	e8 50 f2 ff ff       	call   10343d <line_file_entry>
+  1041ed:	01 c3                	add    %eax,%ebx
+        for (i = 0; i < ndirs && p < end; i++) {
+  1041ef:	83 c6 01             	add    $0x1,%esi
+  1041f2:	83 c4 10             	add    $0x10,%esp
+  1041f5:	eb d0                	jmp    1041c7 <dwarf_line_files+0x203>
+                                     &path, &skip);
+        }
+        int nfile_format = *p++;
+  1041f7:	8d 43 01             	lea    0x1(%ebx),%eax
+  1041fa:	89 45 98             	mov    %eax,-0x68(%ebp)
+  1041fd:	0f be 33             	movsbl (%ebx),%esi
+  104200:	89 75 94             	mov    %esi,-0x6c(%ebp)
+        const char *file_format = p;
+        for (i = 0; i < 2 * nfile_format; i++) {
+  104203:	8d 1c 36             	lea    (%esi,%esi,1),%ebx
+        int nfile_format = *p++;
+  104206:	89 45 b4             	mov    %eax,-0x4c(%ebp)
+        for (i = 0; i < 2 * nfile_format; i++) {
+  104209:	bf 00 00 00 00       	mov    $0x0,%edi
+  10420e:	89 5d 9c             	mov    %ebx,-0x64(%ebp)
+  104211:	eb 3b                	jmp    10424e <dwarf_line_files+0x28a>
+	count = 0;
+  104213:	b8 00 00 00 00       	mov    $0x0,%eax
+	result = 0;
+  104218:	be 00 00 00 00       	mov    $0x0,%esi
+  10421d:	89 7d a4             	mov    %edi,-0x5c(%ebp)
+  104220:	89 c7                	mov    %eax,%edi
+		byte = *addr;
+  104222:	8b 5d b4             	mov    -0x4c(%ebp),%ebx
+  104225:	0f b6 1c 03          	movzbl (%ebx,%eax,1),%ebx
+		count++;
+  104229:	83 c0 01             	add    $0x1,%eax
+		result |= (byte & 0x7f) << shift;
+  10422c:	89 da                	mov    %ebx,%edx
+  10422e:	83 e2 7f             	and    $0x7f,%edx
+  104231:	8d 0c fd 00 00 00 00 	lea    0x0(,%edi,8),%ecx
+  104238:	29 f9                	sub    %edi,%ecx
+  10423a:	d3 e2                	shl    %cl,%edx
+  10423c:	09 d6                	or     %edx,%esi
+		if (!(byte & 0x80))
+  10423e:	84 db                	test   %bl,%bl
+  104240:	78 de                	js     104220 <dwarf_line_files+0x25c>
+	*ret = result;
+  104242:	8b 7d a4             	mov    -0x5c(%ebp),%edi
+  104245:	89 75 c8             	mov    %esi,-0x38(%ebp)
+                p += dwarf_read_uleb128(p, &skip);
+  104248:	01 45 b4             	add    %eax,-0x4c(%ebp)
+        for (i = 0; i < 2 * nfile_format; i++) {
+  10424b:	83 c7 01             	add    $0x1,%edi
+  10424e:	39 7d 9c             	cmp    %edi,-0x64(%ebp)
+  104251:	7f c0                	jg     104213 <dwarf_line_files+0x24f>
+	count = 0;
+  104253:	b8 00 00 00 00       	mov    $0x0,%eax
+	result = 0;
+  104258:	be 00 00 00 00       	mov    $0x0,%esi
+  10425d:	89 c7                	mov    %eax,%edi
+		byte = *addr;
+  10425f:	8b 4d b4             	mov    -0x4c(%ebp),%ecx
+  104262:	0f b6 1c 01          	movzbl (%ecx,%eax,1),%ebx
+		count++;
+  104266:	83 c0 01             	add    $0x1,%eax
+		result |= (byte & 0x7f) << shift;
+  104269:	89 da                	mov    %ebx,%edx
+  10426b:	83 e2 7f             	and    $0x7f,%edx
+  10426e:	8d 0c fd 00 00 00 00 	lea    0x0(,%edi,8),%ecx
+  104275:	29 f9                	sub    %edi,%ecx
+  104277:	d3 e2                	shl    %cl,%edx
+  104279:	09 d6                	or     %edx,%esi
+		if (!(byte & 0x80))
+  10427b:	84 db                	test   %bl,%bl
+  10427d:	78 de                	js     10425d <dwarf_line_files+0x299>
+        }
+        p += dwarf_read_uleb128(p, &nfiles);
+  10427f:	89 75 a4             	mov    %esi,-0x5c(%ebp)
+  104282:	8b 75 b4             	mov    -0x4c(%ebp),%esi
+  104285:	01 c6                	add    %eax,%esi
+        for (index = 0; index < nfiles && p < end; index++) {
+  104287:	bf 00 00 00 00       	mov    $0x0,%edi
+  10428c:	89 f8                	mov    %edi,%eax
+  10428e:	89 f7                	mov    %esi,%edi
+  104290:	89 c6                	mov    %eax,%esi
+  104292:	eb 4c                	jmp    1042e0 <dwarf_line_files+0x31c>
+                                     &name, &dir_index);
+                // Directory 0 is the compilation directory.
+                if (dir_index > 0 && dir_index < ndirs) {
+                        const char *q = dirs;
+                        for (i = 0; i <= dir_index; i++) {
+                                q += line_file_entry(addrs, cu, q,
+  104294:	8d 45 c8             	lea    -0x38(%ebp),%eax
+  104297:	50                   	push   %eax
+  104298:	8d 45 c0             	lea    -0x40(%ebp),%eax
+  10429b:	50                   	push   %eax
+  10429c:	57                   	push   %edi
+  10429d:	ff 75 ac             	push   -0x54(%ebp)
+  1042a0:	89 f1                	mov    %esi,%ecx
+  1042a2:	8b 55 0c             	mov    0xc(%ebp),%edx
+  1042a5:	8b 45 08             	mov    0x8(%ebp),%eax
+  1042a8:	e8 90 f1 ff ff       	call   10343d <line_file_entry>
+  1042ad:	01 c6                	add    %eax,%esi
+                        for (i = 0; i <= dir_index; i++) {
+  1042af:	83 c3 01             	add    $0x1,%ebx
+  1042b2:	83 c4 10             	add    $0x10,%esp
+  1042b5:	39 5d c4             	cmp    %ebx,-0x3c(%ebp)
+  1042b8:	73 da                	jae    104294 <dwarf_line_files+0x2d0>
+  1042ba:	8b 7d b4             	mov    -0x4c(%ebp),%edi
+  1042bd:	8b 75 9c             	mov    -0x64(%ebp),%esi
+                                                     dir_format, ndir_format,
+                                                     &dir, &skip);
+                        }
+                }
+                if (name) {
+  1042c0:	8b 5d bc             	mov    -0x44(%ebp),%ebx
+  1042c3:	85 db                	test   %ebx,%ebx
+  1042c5:	74 16                	je     1042dd <dwarf_line_files+0x319>
+                        fn(index, line_file_dir(dir, name), name);
+  1042c7:	89 da                	mov    %ebx,%edx
+  1042c9:	8b 45 c0             	mov    -0x40(%ebp),%eax
+  1042cc:	e8 8c f2 ff ff       	call   10355d <line_file_dir>
+  1042d1:	83 ec 04             	sub    $0x4,%esp
+  1042d4:	53                   	push   %ebx
+  1042d5:	50                   	push   %eax
+  1042d6:	56                   	push   %esi
+  1042d7:	ff 55 18             	call   *0x18(%ebp)
+  1042da:	83 c4 10             	add    $0x10,%esp
+        for (index = 0; index < nfiles && p < end; index++) {
+  1042dd:	83 c6 01             	add    $0x1,%esi
+  1042e0:	8b 45 b0             	mov    -0x50(%ebp),%eax
+  1042e3:	39 c7                	cmp    %eax,%edi
+  1042e5:	73 62                	jae    104349 <dwarf_line_files+0x385>
+  1042e7:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+  1042ea:	39 c6                	cmp    %eax,%esi
+  1042ec:	73 5b                	jae    104349 <dwarf_line_files+0x385>
+                const char *name = NULL, *dir = NULL;
+  1042ee:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%ebp)
+  1042f5:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%ebp)
+                unsigned dir_index = 0;
+  1042fc:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%ebp)
+                p += line_file_entry(addrs, cu, p, file_format, nfile_format,
+  104303:	8d 45 c4             	lea    -0x3c(%ebp),%eax
+  104306:	50                   	push   %eax
+  104307:	8d 45 bc             	lea    -0x44(%ebp),%eax
+  10430a:	50                   	push   %eax
+  10430b:	ff 75 94             	push   -0x6c(%ebp)
+  10430e:	ff 75 98             	push   -0x68(%ebp)
+  104311:	89 f9                	mov    %edi,%ecx
+  104313:	8b 55 0c             	mov    0xc(%ebp),%edx
+  104316:	8b 45 08             	mov    0x8(%ebp),%eax
+  104319:	e8 1f f1 ff ff       	call   10343d <line_file_entry>
+  10431e:	01 c7                	add    %eax,%edi
+                if (dir_index > 0 && dir_index < ndirs) {
+  104320:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+  104323:	83 c4 10             	add    $0x10,%esp
+  104326:	8b 5d a8             	mov    -0x58(%ebp),%ebx
+  104329:	39 d8                	cmp    %ebx,%eax
+  10432b:	73 93                	jae    1042c0 <dwarf_line_files+0x2fc>
+  10432d:	85 c0                	test   %eax,%eax
+  10432f:	74 8f                	je     1042c0 <dwarf_line_files+0x2fc>
+                        const char *q = dirs;
+  104331:	8b 45 90             	mov    -0x70(%ebp),%eax
+                        for (i = 0; i <= dir_index; i++) {
+  104334:	bb 00 00 00 00       	mov    $0x0,%ebx
+                                q += line_file_entry(addrs, cu, q,
+  104339:	89 7d b4             	mov    %edi,-0x4c(%ebp)
+  10433c:	89 75 9c             	mov    %esi,-0x64(%ebp)
+  10433f:	89 c6                	mov    %eax,%esi
+  104341:	8b 7d a0             	mov    -0x60(%ebp),%edi
+  104344:	e9 6c ff ff ff       	jmp    1042b5 <dwarf_line_files+0x2f1>
+                }
+        }
+        return index;
+  104349:	89 f0                	mov    %esi,%eax
+}
+  10434b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  10434e:	5b                   	pop    %ebx
+  10434f:	5e                   	pop    %esi
+  104350:	5f                   	pop    %edi
+  104351:	5d                   	pop    %ebp
+  104352:	c3                   	ret
+
+00104353 <aranges_count>:
+}
+
+static void
+aranges_count(uintptr_t start, uint32_t size, uint32_t cu)
+{
+	naranges++;
+  104353:	83 05 44 e3 11 00 01 	addl   $0x1,0x11e344
+}
+  10435a:	c3                   	ret
+
+0010435b <aranges_add>:
+
+static void
+aranges_add(uintptr_t start, uint32_t size, uint32_t cu)
+{
+  10435b:	55                   	push   %ebp
+  10435c:	89 e5                	mov    %esp,%ebp
+  10435e:	56                   	push   %esi
+  10435f:	53                   	push   %ebx
+  104360:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	struct Dwarf_Arange *ar;
+
+	// Insertion sort: the compiler emits the ranges mostly in order.
+	for (ar = aranges + naranges; ar > aranges && ar[-1].ar_start > start; ar--)
+  104363:	8b 1d 48 e3 11 00    	mov    0x11e348,%ebx
+  104369:	8b 35 44 e3 11 00    	mov    0x11e344,%esi
+  10436f:	8d 04 76             	lea    (%esi,%esi,2),%eax
+  104372:	8d 04 83             	lea    (%ebx,%eax,4),%eax
+  104375:	eb 14                	jmp    10438b <aranges_add+0x30>
+		ar[0] = ar[-1];
+  104377:	8b 50 f4             	mov    -0xc(%eax),%edx
+  10437a:	89 10                	mov    %edx,(%eax)
+  10437c:	8b 50 f8             	mov    -0x8(%eax),%edx
+  10437f:	89 50 04             	mov    %edx,0x4(%eax)
+  104382:	8b 50 fc             	mov    -0x4(%eax),%edx
+  104385:	89 50 08             	mov    %edx,0x8(%eax)
+	for (ar = aranges + naranges; ar > aranges && ar[-1].ar_start > start; ar--)
+  104388:	83 e8 0c             	sub    $0xc,%eax
+  10438b:	39 c3                	cmp    %eax,%ebx
+  10438d:	73 05                	jae    104394 <aranges_add+0x39>
+  10438f:	3b 48 f4             	cmp    -0xc(%eax),%ecx
+  104392:	72 e3                	jb     104377 <aranges_add+0x1c>
+	ar->ar_start = start;
+  104394:	89 08                	mov    %ecx,(%eax)
+	ar->ar_end = start + size;
+  104396:	03 4d 0c             	add    0xc(%ebp),%ecx
+  104399:	89 48 04             	mov    %ecx,0x4(%eax)
+	ar->ar_cu = cu;
+  10439c:	8b 55 10             	mov    0x10(%ebp),%edx
+  10439f:	89 50 08             	mov    %edx,0x8(%eax)
+	naranges++;
+  1043a2:	83 c6 01             	add    $0x1,%esi
+  1043a5:	89 35 44 e3 11 00    	mov    %esi,0x11e344
+}
+  1043ab:	5b                   	pop    %ebx
+  1043ac:	5e                   	pop    %esi
+  1043ad:	5d                   	pop    %ebp
+  1043ae:	c3                   	ret
+
+001043af <form_size>:
+
+// The size of attributes of 'form', or -1 if it varies.  Units with
+// addresses of other than 4 bytes are rejected before we get here.
+static int
+form_size(unsigned form)
+{
+  1043af:	89 c1                	mov    %eax,%ecx
+	switch (form) {
+  1043b1:	83 f8 2c             	cmp    $0x2c,%eax
+  1043b4:	0f 87 85 00 00 00    	ja     10443f <form_size+0x90>
+  1043ba:	83 f8 11             	cmp    $0x11,%eax
+  1043bd:	76 0f                	jbe    1043ce <form_size+0x1f>
+  1043bf:	83 e9 12             	sub    $0x12,%ecx
+  1043c2:	83 f9 1a             	cmp    $0x1a,%ecx
+  1043c5:	77 60                	ja     104427 <form_size+0x78>
+  1043c7:	ff 24 8d 64 9b 10 00 	jmp    *0x109b64(,%ecx,4)
+  1043ce:	83 f8 05             	cmp    $0x5,%eax
+  1043d1:	76 2f                	jbe    104402 <form_size+0x53>
+  1043d3:	ba 01 00 00 00       	mov    $0x1,%edx
+  1043d8:	d3 e2                	shl    %cl,%edx
+  1043da:	b8 01 00 00 00       	mov    $0x1,%eax
+  1043df:	f7 c2 00 18 02 00    	test   $0x21800,%edx
+  1043e5:	75 69                	jne    104450 <form_size+0xa1>
+	case DW_FORM_strp_sup:
+	case DW_FORM_ref_sup4:
+	case DW_FORM_sec_offset:
+	case DW_FORM_strx4:
+	case DW_FORM_addrx4:
+		return 4;
+  1043e7:	b8 04 00 00 00       	mov    $0x4,%eax
+	switch (form) {
+  1043ec:	f7 c2 40 40 01 00    	test   $0x14040,%edx
+  1043f2:	75 5c                	jne    104450 <form_size+0xa1>
+	case DW_FORM_ref_sup8:
+		return 8;
+	case DW_FORM_data16:
+		return 16;
+	default:
+		return -1;
+  1043f4:	83 f9 07             	cmp    $0x7,%ecx
+  1043f7:	0f 94 c0             	sete   %al
+  1043fa:	0f b6 c0             	movzbl %al,%eax
+  1043fd:	8d 44 c0 ff          	lea    -0x1(%eax,%eax,8),%eax
+  104401:	c3                   	ret
+	switch (form) {
+  104402:	83 f8 01             	cmp    $0x1,%eax
+  104405:	74 3e                	je     104445 <form_size+0x96>
+		return -1;
+  104407:	83 f8 05             	cmp    $0x5,%eax
+  10440a:	0f 94 c0             	sete   %al
+  10440d:	0f b6 c0             	movzbl %al,%eax
+  104410:	8d 44 40 ff          	lea    -0x1(%eax,%eax,2),%eax
+  104414:	c3                   	ret
+		return 0;
+  104415:	b8 00 00 00 00       	mov    $0x0,%eax
+  10441a:	c3                   	ret
+		return 4;
+  10441b:	b8 04 00 00 00       	mov    $0x4,%eax
+  104420:	c3                   	ret
+		return 2;
+  104421:	b8 02 00 00 00       	mov    $0x2,%eax
+  104426:	c3                   	ret
+		return -1;
+  104427:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  10442c:	c3                   	ret
+		return 3;
+  10442d:	b8 03 00 00 00       	mov    $0x3,%eax
+  104432:	c3                   	ret
+		return 8;
+  104433:	b8 08 00 00 00       	mov    $0x8,%eax
+  104438:	c3                   	ret
+		return 16;
+  104439:	b8 10 00 00 00       	mov    $0x10,%eax
+  10443e:	c3                   	ret
+		return -1;
+  10443f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  104444:	c3                   	ret
+		return 4;
+  104445:	b8 04 00 00 00       	mov    $0x4,%eax
+  10444a:	c3                   	ret
+	switch (form) {
+  10444b:	b8 01 00 00 00       	mov    $0x1,%eax
+	}
+}
+  104450:	c3                   	ret
+
+00104451 <funcs_count>:
+	return 0;
+}
+
+static void
+funcs_count(unsigned tag, const struct Dwarf_Func *f)
+{
+  104451:	55                   	push   %ebp
+  104452:	89 e5                	mov    %esp,%ebp
+	if (tag == DW_TAG_subprogram)
+  104454:	83 7d 08 2e          	cmpl   $0x2e,0x8(%ebp)
+  104458:	74 02                	je     10445c <funcs_count+0xb>
+		nfuncs++;
+}
+  10445a:	5d                   	pop    %ebp
+  10445b:	c3                   	ret
+		nfuncs++;
+  10445c:	83 05 34 e3 11 00 01 	addl   $0x1,0x11e334
+}
+  104463:	eb f5                	jmp    10445a <funcs_count+0x9>
+
+00104465 <inlines_count>:
+static size_t fnames_size;
+
+static void
+inlines_count(const struct Dwarf_Inline *in)
+{
+	ninlines++;
+  104465:	83 05 2c e3 11 00 01 	addl   $0x1,0x11e32c
+}
+  10446c:	c3                   	ret
+
+0010446d <inlines_add>:
+
+static void
+inlines_add(const struct Dwarf_Inline *in)
+{
+  10446d:	55                   	push   %ebp
+  10446e:	89 e5                	mov    %esp,%ebp
+  104470:	57                   	push   %edi
+  104471:	56                   	push   %esi
+  104472:	53                   	push   %ebx
+  104473:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	struct Dwarf_Inline *ip;
+
+	// Insertion sort: pieces mostly come in address order, and a piece
+	// before the pieces inside it.
+	for (ip = inlines + ninlines; ip > inlines
+  104476:	8b 35 30 e3 11 00    	mov    0x11e330,%esi
+  10447c:	8b 3d 2c e3 11 00    	mov    0x11e32c,%edi
+  104482:	6b c7 1c             	imul   $0x1c,%edi,%eax
+  104485:	01 f0                	add    %esi,%eax
+  104487:	eb 2c                	jmp    1044b5 <inlines_add+0x48>
+	     && (ip[-1].in_low > in->in_low || (ip[-1].in_low == in->in_low
+		 && ip[-1].in_depth > in->in_depth)); ip--)
+		ip[0] = ip[-1];
+  104489:	8b 50 e4             	mov    -0x1c(%eax),%edx
+  10448c:	89 10                	mov    %edx,(%eax)
+  10448e:	8b 50 e8             	mov    -0x18(%eax),%edx
+  104491:	89 50 04             	mov    %edx,0x4(%eax)
+  104494:	8b 50 ec             	mov    -0x14(%eax),%edx
+  104497:	89 50 08             	mov    %edx,0x8(%eax)
+  10449a:	8b 50 f0             	mov    -0x10(%eax),%edx
+  10449d:	89 50 0c             	mov    %edx,0xc(%eax)
+  1044a0:	8b 50 f4             	mov    -0xc(%eax),%edx
+  1044a3:	89 50 10             	mov    %edx,0x10(%eax)
+  1044a6:	8b 50 f8             	mov    -0x8(%eax),%edx
+  1044a9:	89 50 14             	mov    %edx,0x14(%eax)
+  1044ac:	8b 50 fc             	mov    -0x4(%eax),%edx
+  1044af:	89 50 18             	mov    %edx,0x18(%eax)
+		 && ip[-1].in_depth > in->in_depth)); ip--)
+  1044b2:	83 e8 1c             	sub    $0x1c,%eax
+	     && (ip[-1].in_low > in->in_low || (ip[-1].in_low == in->in_low
+  1044b5:	39 c6                	cmp    %eax,%esi
+  1044b7:	73 17                	jae    1044d0 <inlines_add+0x63>
+  1044b9:	8b 48 e4             	mov    -0x1c(%eax),%ecx
+  1044bc:	8b 13                	mov    (%ebx),%edx
+  1044be:	39 ca                	cmp    %ecx,%edx
+  1044c0:	72 c7                	jb     104489 <inlines_add+0x1c>
+  1044c2:	39 d1                	cmp    %edx,%ecx
+  1044c4:	75 0a                	jne    1044d0 <inlines_add+0x63>
+		 && ip[-1].in_depth > in->in_depth)); ip--)
+  1044c6:	0f b7 48 f0          	movzwl -0x10(%eax),%ecx
+  1044ca:	66 39 4b 0c          	cmp    %cx,0xc(%ebx)
+  1044ce:	72 b9                	jb     104489 <inlines_add+0x1c>
+	*ip = *in;
+  1044d0:	8b 13                	mov    (%ebx),%edx
+  1044d2:	89 10                	mov    %edx,(%eax)
+  1044d4:	8b 53 04             	mov    0x4(%ebx),%edx
+  1044d7:	89 50 04             	mov    %edx,0x4(%eax)
+  1044da:	8b 53 08             	mov    0x8(%ebx),%edx
+  1044dd:	89 50 08             	mov    %edx,0x8(%eax)
+  1044e0:	8b 53 0c             	mov    0xc(%ebx),%edx
+  1044e3:	89 50 0c             	mov    %edx,0xc(%eax)
+  1044e6:	8b 53 10             	mov    0x10(%ebx),%edx
+  1044e9:	89 50 10             	mov    %edx,0x10(%eax)
+  1044ec:	8b 53 14             	mov    0x14(%ebx),%edx
+  1044ef:	89 50 14             	mov    %edx,0x14(%eax)
+  1044f2:	8b 53 18             	mov    0x18(%ebx),%edx
+  1044f5:	89 50 18             	mov    %edx,0x18(%eax)
+	ninlines++;
+  1044f8:	83 c7 01             	add    $0x1,%edi
+  1044fb:	89 3d 2c e3 11 00    	mov    %edi,0x11e32c
+}
+  104501:	5b                   	pop    %ebx
+  104502:	5e                   	pop    %esi
+  104503:	5f                   	pop    %edi
+  104504:	5d                   	pop    %ebp
+  104505:	c3                   	ret
+
+00104506 <names_count>:
+}
+
+static void
+names_count(const char *name, uintptr_t addr)
+{
+	nnames++;
+  104506:	83 05 10 e3 11 00 01 	addl   $0x1,0x11e310
+}
+  10450d:	c3                   	ret
+
+0010450e <funcs_add>:
+{
+  10450e:	55                   	push   %ebp
+  10450f:	89 e5                	mov    %esp,%ebp
+  104511:	53                   	push   %ebx
+  104512:	83 ec 04             	sub    $0x4,%esp
+  104515:	8b 55 0c             	mov    0xc(%ebp),%edx
+	if (tag != DW_TAG_subprogram)
+  104518:	83 7d 08 2e          	cmpl   $0x2e,0x8(%ebp)
+  10451c:	75 79                	jne    104597 <funcs_add+0x89>
+	for (fp = funcs + nfuncs; fp > funcs && fp[-1].fn_low > f->fn_low; fp--)
+  10451e:	8b 0d 38 e3 11 00    	mov    0x11e338,%ecx
+  104524:	a1 34 e3 11 00       	mov    0x11e334,%eax
+  104529:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  10452c:	8d 1c 81             	lea    (%ecx,%eax,4),%ebx
+  10452f:	eb 20                	jmp    104551 <funcs_add+0x43>
+		fp[0] = fp[-1];
+  104531:	8b 43 ec             	mov    -0x14(%ebx),%eax
+  104534:	89 03                	mov    %eax,(%ebx)
+  104536:	8b 43 f0             	mov    -0x10(%ebx),%eax
+  104539:	89 43 04             	mov    %eax,0x4(%ebx)
+  10453c:	8b 43 f4             	mov    -0xc(%ebx),%eax
+  10453f:	89 43 08             	mov    %eax,0x8(%ebx)
+  104542:	8b 43 f8             	mov    -0x8(%ebx),%eax
+  104545:	89 43 0c             	mov    %eax,0xc(%ebx)
+  104548:	8b 43 fc             	mov    -0x4(%ebx),%eax
+  10454b:	89 43 10             	mov    %eax,0x10(%ebx)
+	for (fp = funcs + nfuncs; fp > funcs && fp[-1].fn_low > f->fn_low; fp--)
+  10454e:	83 eb 14             	sub    $0x14,%ebx
+  104551:	39 d9                	cmp    %ebx,%ecx
+  104553:	73 07                	jae    10455c <funcs_add+0x4e>
+  104555:	8b 43 ec             	mov    -0x14(%ebx),%eax
+  104558:	39 02                	cmp    %eax,(%edx)
+  10455a:	72 d5                	jb     104531 <funcs_add+0x23>
+	*fp = *f;
+  10455c:	8b 02                	mov    (%edx),%eax
+  10455e:	89 03                	mov    %eax,(%ebx)
+  104560:	8b 42 04             	mov    0x4(%edx),%eax
+  104563:	89 43 04             	mov    %eax,0x4(%ebx)
+  104566:	8b 42 08             	mov    0x8(%edx),%eax
+  104569:	89 43 08             	mov    %eax,0x8(%ebx)
+  10456c:	8b 42 0c             	mov    0xc(%edx),%eax
+  10456f:	89 43 0c             	mov    %eax,0xc(%ebx)
+  104572:	8b 42 10             	mov    0x10(%edx),%eax
+  104575:	89 43 10             	mov    %eax,0x10(%ebx)
+	if (!fp->fn_name)
+  104578:	83 7b 08 00          	cmpl   $0x0,0x8(%ebx)
+  10457c:	74 1e                	je     10459c <funcs_add+0x8e>
+	fp->fn_namelen = strlen(fp->fn_name);
+  10457e:	83 ec 0c             	sub    $0xc,%esp
+  104581:	ff 73 08             	push   0x8(%ebx)
+  104584:	e8 4c 4a 00 00       	call   108fd5 <strlen>
+  104589:	66 89 43 0c          	mov    %ax,0xc(%ebx)
+	nfuncs++;
+  10458d:	83 05 34 e3 11 00 01 	addl   $0x1,0x11e334
+  104594:	83 c4 10             	add    $0x10,%esp
+}
+  104597:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  10459a:	c9                   	leave
+  10459b:	c3                   	ret
+		fp->fn_name = "<unknown>";
+  10459c:	c7 43 08 d0 9b 10 00 	movl   $0x109bd0,0x8(%ebx)
+  1045a3:	eb d9                	jmp    10457e <funcs_add+0x70>
+
+001045a5 <fnames_count>:
+{
+  1045a5:	55                   	push   %ebp
+  1045a6:	89 e5                	mov    %esp,%ebp
+  1045a8:	53                   	push   %ebx
+  1045a9:	83 ec 04             	sub    $0x4,%esp
+  1045ac:	8b 45 08             	mov    0x8(%ebp),%eax
+  1045af:	8b 55 0c             	mov    0xc(%ebp),%edx
+	if (index >= nfnames)
+  1045b2:	3b 05 24 e3 11 00    	cmp    0x11e324,%eax
+  1045b8:	72 08                	jb     1045c2 <fnames_count+0x1d>
+		nfnames = index + 1;
+  1045ba:	83 c0 01             	add    $0x1,%eax
+  1045bd:	a3 24 e3 11 00       	mov    %eax,0x11e324
+	fnames_size += (dir ? strlen(dir) + 1 : 0) + strlen(name) + 1;
+  1045c2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  1045c7:	85 d2                	test   %edx,%edx
+  1045c9:	74 0f                	je     1045da <fnames_count+0x35>
+  1045cb:	83 ec 0c             	sub    $0xc,%esp
+  1045ce:	52                   	push   %edx
+  1045cf:	e8 01 4a 00 00       	call   108fd5 <strlen>
+  1045d4:	8d 58 01             	lea    0x1(%eax),%ebx
+  1045d7:	83 c4 10             	add    $0x10,%esp
+  1045da:	83 ec 0c             	sub    $0xc,%esp
+  1045dd:	ff 75 10             	push   0x10(%ebp)
+  1045e0:	e8 f0 49 00 00       	call   108fd5 <strlen>
+  1045e5:	8d 44 03 01          	lea    0x1(%ebx,%eax,1),%eax
+  1045e9:	01 05 1c e3 11 00    	add    %eax,0x11e31c
+}
+  1045ef:	83 c4 10             	add    $0x10,%esp
+  1045f2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  1045f5:	c9                   	leave
+  1045f6:	c3                   	ret
+
+001045f7 <die_read>:
+{
+  1045f7:	55                   	push   %ebp
+  1045f8:	89 e5                	mov    %esp,%ebp
+  1045fa:	57                   	push   %edi
+  1045fb:	56                   	push   %esi
+  1045fc:	53                   	push   %ebx
+  1045fd:	83 ec 4c             	sub    $0x4c,%esp
+  104600:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  104603:	89 d7                	mov    %edx,%edi
+  104605:	89 4d b0             	mov    %ecx,-0x50(%ebp)
+  104608:	8b 75 0c             	mov    0xc(%ebp),%esi
+  10460b:	8b 55 14             	mov    0x14(%ebp),%edx
+		rg = &ranges;
+  10460e:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+  104611:	85 d2                	test   %edx,%edx
+  104613:	0f 44 d0             	cmove  %eax,%edx
+	rg->rg_next = NULL;
+  104616:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	f->fn_low = f->fn_high = 0;
+  10461d:	8b 45 10             	mov    0x10(%ebp),%eax
+  104620:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+  104627:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+	f->fn_name = NULL;
+  10462d:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%eax)
+	for (as = ab->ab_attrs; as->as_name || as->as_form; as++) {
+  104634:	8b 45 08             	mov    0x8(%ebp),%eax
+  104637:	8b 58 04             	mov    0x4(%eax),%ebx
+	bool has_low = 0;
+  10463a:	c6 45 c7 00          	movb   $0x0,-0x39(%ebp)
+	const void *origin = NULL, *high_entry = NULL;
+  10463e:	c7 45 b8 00 00 00 00 	movl   $0x0,-0x48(%ebp)
+  104645:	c7 45 b4 00 00 00 00 	movl   $0x0,-0x4c(%ebp)
+	const struct Dwarf_Attrspec *as, *high = NULL;
+  10464c:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%ebp)
+  104653:	89 55 14             	mov    %edx,0x14(%ebp)
+	for (as = ab->ab_attrs; as->as_name || as->as_form; as++) {
+  104656:	e9 8c 00 00 00       	jmp    1046e7 <die_read+0xf0>
+			f->fn_low = dwarf_read_address(addrs, cu, as->as_form,
+  10465b:	56                   	push   %esi
+  10465c:	0f b7 43 02          	movzwl 0x2(%ebx),%eax
+  104660:	50                   	push   %eax
+  104661:	57                   	push   %edi
+  104662:	ff 75 c0             	push   -0x40(%ebp)
+  104665:	e8 f5 cb ff ff       	call   10125f <dwarf_read_address>
+  10466a:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  10466d:	89 01                	mov    %eax,(%ecx)
+			has_low = 1;
+  10466f:	83 c4 10             	add    $0x10,%esp
+  104672:	c6 45 c7 01          	movb   $0x1,-0x39(%ebp)
+  104676:	eb 52                	jmp    1046ca <die_read+0xd3>
+			dwarf_read_ranges(addrs, cu, as->as_form, entry, rg);
+  104678:	83 ec 0c             	sub    $0xc,%esp
+  10467b:	ff 75 14             	push   0x14(%ebp)
+  10467e:	56                   	push   %esi
+  10467f:	0f b7 43 02          	movzwl 0x2(%ebx),%eax
+  104683:	50                   	push   %eax
+  104684:	57                   	push   %edi
+  104685:	ff 75 c0             	push   -0x40(%ebp)
+  104688:	e8 be d3 ff ff       	call   101a4b <dwarf_read_ranges>
+			has_low = dwarf_ranges_next(rg, &f->fn_low, &f->fn_high);
+  10468d:	83 c4 1c             	add    $0x1c,%esp
+  104690:	8b 45 10             	mov    0x10(%ebp),%eax
+  104693:	83 c0 04             	add    $0x4,%eax
+  104696:	50                   	push   %eax
+  104697:	ff 75 10             	push   0x10(%ebp)
+  10469a:	ff 75 14             	push   0x14(%ebp)
+  10469d:	e8 5d d4 ff ff       	call   101aff <dwarf_ranges_next>
+  1046a2:	88 45 c7             	mov    %al,-0x39(%ebp)
+  1046a5:	83 c4 10             	add    $0x10,%esp
+  1046a8:	eb 20                	jmp    1046ca <die_read+0xd3>
+			f->fn_name = dwarf_read_string(addrs, cu, as->as_form,
+  1046aa:	56                   	push   %esi
+  1046ab:	0f b7 43 02          	movzwl 0x2(%ebx),%eax
+  1046af:	50                   	push   %eax
+  1046b0:	57                   	push   %edi
+  1046b1:	ff 75 c0             	push   -0x40(%ebp)
+  1046b4:	e8 bd ca ff ff       	call   101176 <dwarf_read_string>
+  1046b9:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  1046bc:	89 41 08             	mov    %eax,0x8(%ecx)
+  1046bf:	83 c4 10             	add    $0x10,%esp
+  1046c2:	eb 06                	jmp    1046ca <die_read+0xd3>
+  1046c4:	89 75 b8             	mov    %esi,-0x48(%ebp)
+			high = as;
+  1046c7:	89 5d bc             	mov    %ebx,-0x44(%ebp)
+		entry += dwarf_read_abbrev_entry(entry, as->as_form, NULL, 0,
+  1046ca:	83 ec 0c             	sub    $0xc,%esp
+  1046cd:	ff 77 18             	push   0x18(%edi)
+  1046d0:	6a 00                	push   $0x0
+  1046d2:	6a 00                	push   $0x0
+  1046d4:	0f b7 43 02          	movzwl 0x2(%ebx),%eax
+  1046d8:	50                   	push   %eax
+  1046d9:	56                   	push   %esi
+  1046da:	e8 d0 c1 ff ff       	call   1008af <dwarf_read_abbrev_entry>
+  1046df:	01 c6                	add    %eax,%esi
+	for (as = ab->ab_attrs; as->as_name || as->as_form; as++) {
+  1046e1:	83 c3 08             	add    $0x8,%ebx
+  1046e4:	83 c4 20             	add    $0x20,%esp
+  1046e7:	83 3b 00             	cmpl   $0x0,(%ebx)
+  1046ea:	74 4f                	je     10473b <die_read+0x144>
+		if (as->as_name == DW_AT_low_pc) {
+  1046ec:	0f b7 03             	movzwl (%ebx),%eax
+  1046ef:	66 83 f8 11          	cmp    $0x11,%ax
+  1046f3:	0f 84 62 ff ff ff    	je     10465b <die_read+0x64>
+		} else if (as->as_name == DW_AT_high_pc) {
+  1046f9:	66 83 f8 12          	cmp    $0x12,%ax
+  1046fd:	74 c5                	je     1046c4 <die_read+0xcd>
+		} else if (as->as_name == DW_AT_ranges) {
+  1046ff:	66 83 f8 55          	cmp    $0x55,%ax
+  104703:	0f 84 6f ff ff ff    	je     104678 <die_read+0x81>
+		} else if (as->as_name == DW_AT_name)
+  104709:	66 83 f8 03          	cmp    $0x3,%ax
+  10470d:	74 9b                	je     1046aa <die_read+0xb3>
+		else if ((as->as_name == DW_AT_abstract_origin
+  10470f:	66 83 f8 31          	cmp    $0x31,%ax
+  104713:	74 06                	je     10471b <die_read+0x124>
+  104715:	66 83 f8 47          	cmp    $0x47,%ax
+  104719:	75 af                	jne    1046ca <die_read+0xd3>
+			 && as->as_form != DW_FORM_ref_sig8)
+  10471b:	0f b7 43 02          	movzwl 0x2(%ebx),%eax
+  10471f:	66 83 f8 20          	cmp    $0x20,%ax
+  104723:	74 a5                	je     1046ca <die_read+0xd3>
+			origin = dwarf_read_ref(addrs, cu, as->as_form, entry);
+  104725:	56                   	push   %esi
+  104726:	0f b7 c0             	movzwl %ax,%eax
+  104729:	50                   	push   %eax
+  10472a:	57                   	push   %edi
+  10472b:	ff 75 c0             	push   -0x40(%ebp)
+  10472e:	e8 82 cf ff ff       	call   1016b5 <dwarf_read_ref>
+  104733:	89 45 b4             	mov    %eax,-0x4c(%ebp)
+  104736:	83 c4 10             	add    $0x10,%esp
+  104739:	eb 8f                	jmp    1046ca <die_read+0xd3>
+	if (high)
+  10473b:	8b 45 bc             	mov    -0x44(%ebp),%eax
+  10473e:	85 c0                	test   %eax,%eax
+  104740:	74 1e                	je     104760 <die_read+0x169>
+		f->fn_high = dwarf_read_high_pc(addrs, cu, high, high_entry,
+  104742:	83 ec 0c             	sub    $0xc,%esp
+  104745:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  104748:	ff 31                	push   (%ecx)
+  10474a:	ff 75 b8             	push   -0x48(%ebp)
+  10474d:	50                   	push   %eax
+  10474e:	57                   	push   %edi
+  10474f:	ff 75 c0             	push   -0x40(%ebp)
+  104752:	e8 e8 ce ff ff       	call   10163f <dwarf_read_high_pc>
+  104757:	8b 55 10             	mov    0x10(%ebp),%edx
+  10475a:	89 42 04             	mov    %eax,0x4(%edx)
+  10475d:	83 c4 20             	add    $0x20,%esp
+	if (has_low && !f->fn_name && origin)
+  104760:	80 7d c7 00          	cmpb   $0x0,-0x39(%ebp)
+  104764:	74 0f                	je     104775 <die_read+0x17e>
+  104766:	8b 45 10             	mov    0x10(%ebp),%eax
+  104769:	83 78 08 00          	cmpl   $0x0,0x8(%eax)
+  10476d:	75 06                	jne    104775 <die_read+0x17e>
+  10476f:	83 7d b4 00          	cmpl   $0x0,-0x4c(%ebp)
+  104773:	75 11                	jne    104786 <die_read+0x18f>
+	*next = entry;
+  104775:	8b 45 18             	mov    0x18(%ebp),%eax
+  104778:	89 30                	mov    %esi,(%eax)
+}
+  10477a:	0f b6 45 c7          	movzbl -0x39(%ebp),%eax
+  10477e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  104781:	5b                   	pop    %ebx
+  104782:	5e                   	pop    %esi
+  104783:	5f                   	pop    %edi
+  104784:	5d                   	pop    %ebp
+  104785:	c3                   	ret
+		f->fn_name = dwarf_die_name(addrs, cu, abbrevs, origin);
+  104786:	ff 75 b4             	push   -0x4c(%ebp)
+  104789:	ff 75 b0             	push   -0x50(%ebp)
+  10478c:	57                   	push   %edi
+  10478d:	ff 75 c0             	push   -0x40(%ebp)
+  104790:	e8 74 d6 ff ff       	call   101e09 <dwarf_die_name>
+  104795:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  104798:	89 41 08             	mov    %eax,0x8(%ecx)
+  10479b:	83 c4 10             	add    $0x10,%esp
+  10479e:	eb d5                	jmp    104775 <die_read+0x17e>
+
+001047a0 <funcs_walk_unit>:
+{
+  1047a0:	55                   	push   %ebp
+  1047a1:	89 e5                	mov    %esp,%ebp
+  1047a3:	57                   	push   %edi
+  1047a4:	56                   	push   %esi
+  1047a5:	53                   	push   %ebx
+  1047a6:	83 ec 5c             	sub    $0x5c,%esp
+  1047a9:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+  1047ac:	89 55 ac             	mov    %edx,-0x54(%ebp)
+  1047af:	89 4d a8             	mov    %ecx,-0x58(%ebp)
+	for (entry = cu->cu_dies; entry < cu->cu_end; ) {
+  1047b2:	8b 42 04             	mov    0x4(%edx),%eax
+  1047b5:	89 45 bc             	mov    %eax,-0x44(%ebp)
+  1047b8:	eb 4c                	jmp    104806 <funcs_walk_unit+0x66>
+  1047ba:	83 e9 2e             	sub    $0x2e,%ecx
+  1047bd:	ba 01 48 00 00       	mov    $0x4801,%edx
+  1047c2:	d3 ea                	shr    %cl,%edx
+		|| tag == DW_TAG_module;
+  1047c4:	89 d0                	mov    %edx,%eax
+  1047c6:	83 e0 01             	and    $0x1,%eax
+  1047c9:	66 83 f9 0f          	cmp    $0xf,%cx
+  1047cd:	ba 00 00 00 00       	mov    $0x0,%edx
+  1047d2:	0f 43 c2             	cmovae %edx,%eax
+  1047d5:	e9 d5 00 00 00       	jmp    1048af <funcs_walk_unit+0x10f>
+		if (die_read(addrs, cu, abbrevs, ab, entry, &f, &rg, &entry)) {
+  1047da:	83 ec 0c             	sub    $0xc,%esp
+  1047dd:	8d 45 bc             	lea    -0x44(%ebp),%eax
+  1047e0:	50                   	push   %eax
+  1047e1:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+  1047e4:	50                   	push   %eax
+  1047e5:	8d 45 c0             	lea    -0x40(%ebp),%eax
+  1047e8:	50                   	push   %eax
+  1047e9:	ff 75 b4             	push   -0x4c(%ebp)
+  1047ec:	53                   	push   %ebx
+  1047ed:	8b 4d a8             	mov    -0x58(%ebp),%ecx
+  1047f0:	8b 55 ac             	mov    -0x54(%ebp),%edx
+  1047f3:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+  1047f6:	e8 fc fd ff ff       	call   1045f7 <die_read>
+  1047fb:	83 c4 20             	add    $0x20,%esp
+  1047fe:	84 c0                	test   %al,%al
+  104800:	0f 85 cd 00 00 00    	jne    1048d3 <funcs_walk_unit+0x133>
+	for (entry = cu->cu_dies; entry < cu->cu_end; ) {
+  104806:	8b 45 ac             	mov    -0x54(%ebp),%eax
+  104809:	8b 70 08             	mov    0x8(%eax),%esi
+  10480c:	8b 45 bc             	mov    -0x44(%ebp),%eax
+  10480f:	89 45 b4             	mov    %eax,-0x4c(%ebp)
+  104812:	89 75 b0             	mov    %esi,-0x50(%ebp)
+  104815:	8b 7d b0             	mov    -0x50(%ebp),%edi
+  104818:	39 7d b4             	cmp    %edi,-0x4c(%ebp)
+  10481b:	0f 83 f8 00 00 00    	jae    104919 <funcs_walk_unit+0x179>
+	count = 0;
+  104821:	b8 00 00 00 00       	mov    $0x0,%eax
+	result = 0;
+  104826:	bf 00 00 00 00       	mov    $0x0,%edi
+  10482b:	89 c6                	mov    %eax,%esi
+		byte = *addr;
+  10482d:	8b 5d b4             	mov    -0x4c(%ebp),%ebx
+  104830:	0f b6 1c 03          	movzbl (%ebx,%eax,1),%ebx
+		count++;
+  104834:	83 c0 01             	add    $0x1,%eax
+		result |= (byte & 0x7f) << shift;
+  104837:	89 da                	mov    %ebx,%edx
+  104839:	83 e2 7f             	and    $0x7f,%edx
+  10483c:	8d 0c f5 00 00 00 00 	lea    0x0(,%esi,8),%ecx
+  104843:	29 f1                	sub    %esi,%ecx
+  104845:	d3 e2                	shl    %cl,%edx
+  104847:	09 d7                	or     %edx,%edi
+		if (!(byte & 0x80))
+  104849:	84 db                	test   %bl,%bl
+  10484b:	78 de                	js     10482b <funcs_walk_unit+0x8b>
+		entry += dwarf_read_uleb128(entry, &code);
+  10484d:	01 45 b4             	add    %eax,-0x4c(%ebp)
+  104850:	8b 45 b4             	mov    -0x4c(%ebp),%eax
+		if (code == 0)
+  104853:	85 ff                	test   %edi,%edi
+  104855:	74 be                	je     104815 <funcs_walk_unit+0x75>
+  104857:	89 45 bc             	mov    %eax,-0x44(%ebp)
+	if (code >= at->at_ncodes || !at->at_abbrevs[code].ab_attrs)
+  10485a:	8b 45 a8             	mov    -0x58(%ebp),%eax
+  10485d:	3b 78 08             	cmp    0x8(%eax),%edi
+  104860:	0f 83 ba 00 00 00    	jae    104920 <funcs_walk_unit+0x180>
+  104866:	8d 14 bf             	lea    (%edi,%edi,4),%edx
+  104869:	8b 40 0c             	mov    0xc(%eax),%eax
+  10486c:	8d 1c 90             	lea    (%eax,%edx,4),%ebx
+  10486f:	83 7b 04 00          	cmpl   $0x0,0x4(%ebx)
+  104873:	0f 84 b4 00 00 00    	je     10492d <funcs_walk_unit+0x18d>
+		if (ab->ab_tag != DW_TAG_subprogram
+  104879:	0f b7 0b             	movzwl (%ebx),%ecx
+  10487c:	66 83 f9 2e          	cmp    $0x2e,%cx
+  104880:	0f 84 54 ff ff ff    	je     1047da <funcs_walk_unit+0x3a>
+  104886:	66 83 f9 0a          	cmp    $0xa,%cx
+  10488a:	0f 84 4a ff ff ff    	je     1047da <funcs_walk_unit+0x3a>
+	return tag == DW_TAG_compile_unit || tag == DW_TAG_partial_unit
+  104890:	66 83 f9 1e          	cmp    $0x1e,%cx
+  104894:	0f 87 20 ff ff ff    	ja     1047ba <funcs_walk_unit+0x1a>
+		|| tag == DW_TAG_module;
+  10489a:	b8 00 00 00 00       	mov    $0x0,%eax
+  10489f:	66 83 f9 0a          	cmp    $0xa,%cx
+  1048a3:	76 0a                	jbe    1048af <funcs_walk_unit+0x10f>
+  1048a5:	b8 00 08 02 60       	mov    $0x60020800,%eax
+  1048aa:	d3 e8                	shr    %cl,%eax
+  1048ac:	83 e0 01             	and    $0x1,%eax
+			entry = dwarf_skip_die(addrs, cu, abbrevs, ab, entry,
+  1048af:	83 ec 08             	sub    $0x8,%esp
+					       !dwarf_tag_has_code(ab->ab_tag));
+  1048b2:	83 f0 01             	xor    $0x1,%eax
+			entry = dwarf_skip_die(addrs, cu, abbrevs, ab, entry,
+  1048b5:	50                   	push   %eax
+  1048b6:	ff 75 b4             	push   -0x4c(%ebp)
+  1048b9:	53                   	push   %ebx
+  1048ba:	ff 75 a8             	push   -0x58(%ebp)
+  1048bd:	ff 75 ac             	push   -0x54(%ebp)
+  1048c0:	ff 75 a4             	push   -0x5c(%ebp)
+  1048c3:	e8 73 d5 ff ff       	call   101e3b <dwarf_skip_die>
+  1048c8:	89 45 bc             	mov    %eax,-0x44(%ebp)
+			continue;
+  1048cb:	83 c4 20             	add    $0x20,%esp
+  1048ce:	e9 33 ff ff ff       	jmp    104806 <funcs_walk_unit+0x66>
+			f.fn_cu = cu->cu_hdr - (const char *) addrs->info_begin;
+  1048d3:	8b 45 ac             	mov    -0x54(%ebp),%eax
+  1048d6:	8b 00                	mov    (%eax),%eax
+  1048d8:	8b 7d a4             	mov    -0x5c(%ebp),%edi
+  1048db:	2b 47 10             	sub    0x10(%edi),%eax
+  1048de:	89 45 d0             	mov    %eax,-0x30(%ebp)
+				fn(ab->ab_tag, &f);
+  1048e1:	8d 75 c0             	lea    -0x40(%ebp),%esi
+			       && dwarf_ranges_next(&rg, &f.fn_low, &f.fn_high));
+  1048e4:	8d 7d c4             	lea    -0x3c(%ebp),%edi
+				fn(ab->ab_tag, &f);
+  1048e7:	83 ec 08             	sub    $0x8,%esp
+  1048ea:	56                   	push   %esi
+  1048eb:	0f b7 03             	movzwl (%ebx),%eax
+  1048ee:	50                   	push   %eax
+  1048ef:	ff 55 08             	call   *0x8(%ebp)
+			       && dwarf_ranges_next(&rg, &f.fn_low, &f.fn_high));
+  1048f2:	83 c4 10             	add    $0x10,%esp
+  1048f5:	83 7d dc 00          	cmpl   $0x0,-0x24(%ebp)
+  1048f9:	0f 84 07 ff ff ff    	je     104806 <funcs_walk_unit+0x66>
+  1048ff:	83 ec 04             	sub    $0x4,%esp
+  104902:	57                   	push   %edi
+  104903:	56                   	push   %esi
+  104904:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+  104907:	50                   	push   %eax
+  104908:	e8 f2 d1 ff ff       	call   101aff <dwarf_ranges_next>
+  10490d:	83 c4 10             	add    $0x10,%esp
+  104910:	84 c0                	test   %al,%al
+  104912:	75 d3                	jne    1048e7 <funcs_walk_unit+0x147>
+  104914:	e9 ed fe ff ff       	jmp    104806 <funcs_walk_unit+0x66>
+	return 0;
+  104919:	b8 00 00 00 00       	mov    $0x0,%eax
+  10491e:	eb 05                	jmp    104925 <funcs_walk_unit+0x185>
+			return -E_BAD_DWARF;
+  104920:	b8 fa ff ff ff       	mov    $0xfffffffa,%eax
+}
+  104925:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  104928:	5b                   	pop    %ebx
+  104929:	5e                   	pop    %esi
+  10492a:	5f                   	pop    %edi
+  10492b:	5d                   	pop    %ebp
+  10492c:	c3                   	ret
+			return -E_BAD_DWARF;
+  10492d:	b8 fa ff ff ff       	mov    $0xfffffffa,%eax
+  104932:	eb f1                	jmp    104925 <funcs_walk_unit+0x185>
+
+00104934 <inlines_build>:
+{
+  104934:	55                   	push   %ebp
+  104935:	89 e5                	mov    %esp,%ebp
+  104937:	57                   	push   %edi
+  104938:	56                   	push   %esi
+  104939:	53                   	push   %ebx
+  10493a:	83 ec 2c             	sub    $0x2c,%esp
+  10493d:	89 c3                	mov    %eax,%ebx
+  10493f:	89 d7                	mov    %edx,%edi
+  104941:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  104944:	0f 31                	rdtsc
+  104946:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  104949:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+	ci->ci_inlines_tried = 1;
+  10494c:	c6 47 76 01          	movb   $0x1,0x76(%edi)
+	ninlines = nfnames = 0;
+  104950:	c7 05 24 e3 11 00 00 	movl   $0x0,0x11e324
+  104957:	00 00 00 
+  10495a:	c7 05 2c e3 11 00 00 	movl   $0x0,0x11e32c
+  104961:	00 00 00 
+	fnames_size = 0;
+  104964:	c7 05 1c e3 11 00 00 	movl   $0x0,0x11e31c
+  10496b:	00 00 00 
+	if (dwarf_inlines_walk(addrs, &ci->ci_cu, ci->ci_abbrevs,
+  10496e:	8d 77 08             	lea    0x8(%edi),%esi
+  104971:	68 65 44 10 00       	push   $0x104465
+  104976:	ff 77 34             	push   0x34(%edi)
+  104979:	56                   	push   %esi
+  10497a:	53                   	push   %ebx
+  10497b:	e8 b9 d5 ff ff       	call   101f39 <dwarf_inlines_walk>
+  104980:	83 c4 10             	add    $0x10,%esp
+  104983:	85 c0                	test   %eax,%eax
+  104985:	0f 88 a2 01 00 00    	js     104b2d <inlines_build+0x1f9>
+			       inlines_count) < 0 || ninlines == 0)
+  10498b:	83 3d 2c e3 11 00 00 	cmpl   $0x0,0x11e32c
+  104992:	0f 84 95 01 00 00    	je     104b2d <inlines_build+0x1f9>
+	if (ci->ci_stmt_list == DWARF_NOLINES
+  104998:	8b 57 40             	mov    0x40(%edi),%edx
+  10499b:	8b 4f 44             	mov    0x44(%edi),%ecx
+  10499e:	89 d0                	mov    %edx,%eax
+  1049a0:	f7 d0                	not    %eax
+  1049a2:	89 cf                	mov    %ecx,%edi
+  1049a4:	f7 d7                	not    %edi
+  1049a6:	09 f8                	or     %edi,%eax
+  1049a8:	0f 85 c3 00 00 00    	jne    104a71 <inlines_build+0x13d>
+		nfnames = fnames_size = 0;
+  1049ae:	c7 05 1c e3 11 00 00 	movl   $0x0,0x11e31c
+  1049b5:	00 00 00 
+  1049b8:	c7 05 24 e3 11 00 00 	movl   $0x0,0x11e324
+  1049bf:	00 00 00 
+	if (!(inlines = dwarf_cu_alloc(ci, size)))
+  1049c2:	83 ec 08             	sub    $0x8,%esp
+	size = ninlines * sizeof(*inlines) + nfnames * sizeof(*fnames)
+  1049c5:	8b 15 2c e3 11 00    	mov    0x11e32c,%edx
+  1049cb:	8d 04 d5 00 00 00 00 	lea    0x0(,%edx,8),%eax
+  1049d2:	29 d0                	sub    %edx,%eax
+  1049d4:	03 05 24 e3 11 00    	add    0x11e324,%eax
+  1049da:	8b 15 1c e3 11 00    	mov    0x11e31c,%edx
+  1049e0:	8d 04 82             	lea    (%edx,%eax,4),%eax
+	if (!(inlines = dwarf_cu_alloc(ci, size)))
+  1049e3:	50                   	push   %eax
+  1049e4:	ff 75 dc             	push   -0x24(%ebp)
+  1049e7:	e8 cc 1f 00 00       	call   1069b8 <dwarf_cu_alloc>
+  1049ec:	a3 30 e3 11 00       	mov    %eax,0x11e330
+  1049f1:	83 c4 10             	add    $0x10,%esp
+  1049f4:	85 c0                	test   %eax,%eax
+  1049f6:	0f 84 31 01 00 00    	je     104b2d <inlines_build+0x1f9>
+	fnames = (const char **) (inlines + ninlines);
+  1049fc:	6b 15 2c e3 11 00 1c 	imul   $0x1c,0x11e32c,%edx
+  104a03:	01 d0                	add    %edx,%eax
+  104a05:	a3 28 e3 11 00       	mov    %eax,0x11e328
+	fnames_next = (char *) (fnames + nfnames);
+  104a0a:	8b 3d 24 e3 11 00    	mov    0x11e324,%edi
+  104a10:	8d 14 bd 00 00 00 00 	lea    0x0(,%edi,4),%edx
+  104a17:	8d 0c 10             	lea    (%eax,%edx,1),%ecx
+  104a1a:	89 0d 20 e3 11 00    	mov    %ecx,0x11e320
+	memset(fnames, 0, nfnames * sizeof(*fnames));
+  104a20:	83 ec 04             	sub    $0x4,%esp
+  104a23:	52                   	push   %edx
+  104a24:	6a 00                	push   $0x0
+  104a26:	50                   	push   %eax
+  104a27:	e8 35 47 00 00       	call   109161 <memset>
+	if (nfnames)
+  104a2c:	83 c4 10             	add    $0x10,%esp
+  104a2f:	83 3d 24 e3 11 00 00 	cmpl   $0x0,0x11e324
+  104a36:	75 5a                	jne    104a92 <inlines_build+0x15e>
+	ninlines = 0;
+  104a38:	c7 05 2c e3 11 00 00 	movl   $0x0,0x11e32c
+  104a3f:	00 00 00 
+	dwarf_inlines_walk(addrs, &ci->ci_cu, ci->ci_abbrevs, inlines_add);
+  104a42:	68 6d 44 10 00       	push   $0x10446d
+  104a47:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  104a4a:	ff 70 34             	push   0x34(%eax)
+  104a4d:	56                   	push   %esi
+  104a4e:	53                   	push   %ebx
+  104a4f:	e8 e5 d4 ff ff       	call   101f39 <dwarf_inlines_walk>
+	for (i = 0; i < ninlines; i++) {
+  104a54:	a1 2c e3 11 00       	mov    0x11e32c,%eax
+  104a59:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		     && (inlines[j].in_high <= inlines[i].in_low
+  104a5c:	8b 1d 30 e3 11 00    	mov    0x11e330,%ebx
+  104a62:	8d 7b 18             	lea    0x18(%ebx),%edi
+  104a65:	89 d9                	mov    %ebx,%ecx
+	for (i = 0; i < ninlines; i++) {
+  104a67:	83 c4 10             	add    $0x10,%esp
+  104a6a:	be 00 00 00 00       	mov    $0x0,%esi
+  104a6f:	eb 69                	jmp    104ada <inlines_build+0x1a6>
+	    || dwarf_line_files(addrs, &ci->ci_cu, ci->ci_stmt_list,
+  104a71:	83 ec 0c             	sub    $0xc,%esp
+  104a74:	68 a5 45 10 00       	push   $0x1045a5
+  104a79:	51                   	push   %ecx
+  104a7a:	52                   	push   %edx
+  104a7b:	56                   	push   %esi
+  104a7c:	53                   	push   %ebx
+  104a7d:	e8 42 f5 ff ff       	call   103fc4 <dwarf_line_files>
+  104a82:	83 c4 20             	add    $0x20,%esp
+  104a85:	85 c0                	test   %eax,%eax
+  104a87:	0f 89 35 ff ff ff    	jns    1049c2 <inlines_build+0x8e>
+  104a8d:	e9 1c ff ff ff       	jmp    1049ae <inlines_build+0x7a>
+		dwarf_line_files(addrs, &ci->ci_cu, ci->ci_stmt_list,
+  104a92:	83 ec 0c             	sub    $0xc,%esp
+  104a95:	68 35 4b 10 00       	push   $0x104b35
+  104a9a:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  104a9d:	ff 70 44             	push   0x44(%eax)
+  104aa0:	ff 70 40             	push   0x40(%eax)
+  104aa3:	56                   	push   %esi
+  104aa4:	53                   	push   %ebx
+  104aa5:	e8 1a f5 ff ff       	call   103fc4 <dwarf_line_files>
+  104aaa:	83 c4 20             	add    $0x20,%esp
+  104aad:	eb 89                	jmp    104a38 <inlines_build+0x104>
+		     j = inlines[j].in_parent)
+  104aaf:	8b 50 18             	mov    0x18(%eax),%edx
+		     && (inlines[j].in_high <= inlines[i].in_low
+  104ab2:	85 d2                	test   %edx,%edx
+  104ab4:	78 16                	js     104acc <inlines_build+0x198>
+  104ab6:	6b c2 1c             	imul   $0x1c,%edx,%eax
+  104ab9:	01 d8                	add    %ebx,%eax
+  104abb:	8b 70 04             	mov    0x4(%eax),%esi
+  104abe:	39 31                	cmp    %esi,(%ecx)
+  104ac0:	73 ed                	jae    104aaf <inlines_build+0x17b>
+			 || inlines[j].in_depth >= inlines[i].in_depth);
+  104ac2:	0f b7 71 0c          	movzwl 0xc(%ecx),%esi
+  104ac6:	66 39 70 0c          	cmp    %si,0xc(%eax)
+  104aca:	73 e3                	jae    104aaf <inlines_build+0x17b>
+		inlines[i].in_parent = j;
+  104acc:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  104acf:	89 17                	mov    %edx,(%edi)
+	for (i = 0; i < ninlines; i++) {
+  104ad1:	83 c6 01             	add    $0x1,%esi
+  104ad4:	83 c7 1c             	add    $0x1c,%edi
+  104ad7:	83 c1 1c             	add    $0x1c,%ecx
+  104ada:	39 75 e0             	cmp    %esi,-0x20(%ebp)
+  104add:	7e 08                	jle    104ae7 <inlines_build+0x1b3>
+		for (j = i - 1; j >= 0
+  104adf:	8d 56 ff             	lea    -0x1(%esi),%edx
+  104ae2:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  104ae5:	eb cb                	jmp    104ab2 <inlines_build+0x17e>
+	ci->ci_inlines = inlines;
+  104ae7:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  104aea:	89 5f 64             	mov    %ebx,0x64(%edi)
+	ci->ci_ninlines = ninlines;
+  104aed:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  104af0:	89 5f 68             	mov    %ebx,0x68(%edi)
+	ci->ci_files = fnames;
+  104af3:	a1 28 e3 11 00       	mov    0x11e328,%eax
+  104af8:	89 47 6c             	mov    %eax,0x6c(%edi)
+	ci->ci_nfiles = nfnames;
+  104afb:	a1 24 e3 11 00       	mov    0x11e324,%eax
+  104b00:	89 47 70             	mov    %eax,0x70(%edi)
+	dwarf_stats.dws_ninlines += ninlines;
+  104b03:	01 1d bc e2 11 00    	add    %ebx,0x11e2bc
+  104b09:	0f 31                	rdtsc
+	dwarf_stats.dws_inlines_build += read_tsc() - tsc;
+  104b0b:	8b 0d c0 e2 11 00    	mov    0x11e2c0,%ecx
+  104b11:	8b 1d c4 e2 11 00    	mov    0x11e2c4,%ebx
+  104b17:	2b 4d d0             	sub    -0x30(%ebp),%ecx
+  104b1a:	1b 5d d4             	sbb    -0x2c(%ebp),%ebx
+  104b1d:	01 c1                	add    %eax,%ecx
+  104b1f:	11 d3                	adc    %edx,%ebx
+  104b21:	89 0d c0 e2 11 00    	mov    %ecx,0x11e2c0
+  104b27:	89 1d c4 e2 11 00    	mov    %ebx,0x11e2c4
+}
+  104b2d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  104b30:	5b                   	pop    %ebx
+  104b31:	5e                   	pop    %esi
+  104b32:	5f                   	pop    %edi
+  104b33:	5d                   	pop    %ebp
+  104b34:	c3                   	ret
+
+00104b35 <fnames_add>:
+{
+  104b35:	55                   	push   %ebp
+  104b36:	89 e5                	mov    %esp,%ebp
+  104b38:	56                   	push   %esi
+  104b39:	53                   	push   %ebx
+  104b3a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  104b3d:	8b 75 10             	mov    0x10(%ebp),%esi
+	fnames[index] = fnames_next;
+  104b40:	a1 20 e3 11 00       	mov    0x11e320,%eax
+  104b45:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  104b48:	8b 15 28 e3 11 00    	mov    0x11e328,%edx
+  104b4e:	89 04 8a             	mov    %eax,(%edx,%ecx,4)
+	if (dir) {
+  104b51:	85 db                	test   %ebx,%ebx
+  104b53:	74 27                	je     104b7c <fnames_add+0x47>
+		strcpy(fnames_next, dir);
+  104b55:	83 ec 08             	sub    $0x8,%esp
+  104b58:	53                   	push   %ebx
+  104b59:	50                   	push   %eax
+  104b5a:	e8 b1 44 00 00       	call   109010 <strcpy>
+		fnames_next += strlen(dir);
+  104b5f:	89 1c 24             	mov    %ebx,(%esp)
+  104b62:	e8 6e 44 00 00       	call   108fd5 <strlen>
+  104b67:	03 05 20 e3 11 00    	add    0x11e320,%eax
+		*fnames_next++ = '/';
+  104b6d:	8d 50 01             	lea    0x1(%eax),%edx
+  104b70:	89 15 20 e3 11 00    	mov    %edx,0x11e320
+  104b76:	c6 00 2f             	movb   $0x2f,(%eax)
+  104b79:	83 c4 10             	add    $0x10,%esp
+	strcpy(fnames_next, name);
+  104b7c:	83 ec 08             	sub    $0x8,%esp
+  104b7f:	56                   	push   %esi
+  104b80:	ff 35 20 e3 11 00    	push   0x11e320
+  104b86:	e8 85 44 00 00       	call   109010 <strcpy>
+	fnames_next += strlen(name) + 1;
+  104b8b:	89 34 24             	mov    %esi,(%esp)
+  104b8e:	e8 42 44 00 00       	call   108fd5 <strlen>
+  104b93:	83 c0 01             	add    $0x1,%eax
+  104b96:	01 05 20 e3 11 00    	add    %eax,0x11e320
+}
+  104b9c:	83 c4 10             	add    $0x10,%esp
+  104b9f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  104ba2:	5b                   	pop    %ebx
+  104ba3:	5e                   	pop    %esi
+  104ba4:	5d                   	pop    %ebp
+  104ba5:	c3                   	ret
+
+00104ba6 <names_insert>:
+
+static void
+names_insert(const char *name, uintptr_t addr)
+{
+  104ba6:	55                   	push   %ebp
+  104ba7:	89 e5                	mov    %esp,%ebp
+  104ba9:	57                   	push   %edi
+  104baa:	56                   	push   %esi
+  104bab:	53                   	push   %ebx
+  104bac:	83 ec 0c             	sub    $0xc,%esp
+  104baf:	8b 7d 08             	mov    0x8(%ebp),%edi
+	while (*s) {
+  104bb2:	89 fa                	mov    %edi,%edx
+	uint32_t h = 2166136261U;
+  104bb4:	be c5 9d 1c 81       	mov    $0x811c9dc5,%esi
+	while (*s) {
+  104bb9:	eb 0e                	jmp    104bc9 <names_insert+0x23>
+		h ^= (uint8_t) *s++;
+  104bbb:	83 c2 01             	add    $0x1,%edx
+  104bbe:	0f b6 c0             	movzbl %al,%eax
+  104bc1:	31 f0                	xor    %esi,%eax
+		h *= 16777619;
+  104bc3:	69 f0 93 01 00 01    	imul   $0x1000193,%eax,%esi
+	while (*s) {
+  104bc9:	0f b6 02             	movzbl (%edx),%eax
+  104bcc:	84 c0                	test   %al,%al
+  104bce:	75 eb                	jne    104bbb <names_insert+0x15>
+	uint32_t h = name_hash(name), i;
+
+	for (i = h & names_mask; names[i].nm_name; i = (i + 1) & names_mask)
+  104bd0:	89 f3                	mov    %esi,%ebx
+  104bd2:	23 1d 14 e3 11 00    	and    0x11e314,%ebx
+  104bd8:	eb 09                	jmp    104be3 <names_insert+0x3d>
+  104bda:	83 c3 01             	add    $0x1,%ebx
+  104bdd:	23 1d 14 e3 11 00    	and    0x11e314,%ebx
+  104be3:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  104be6:	8b 15 18 e3 11 00    	mov    0x11e318,%edx
+  104bec:	8d 04 82             	lea    (%edx,%eax,4),%eax
+  104bef:	8b 50 08             	mov    0x8(%eax),%edx
+  104bf2:	85 d2                	test   %edx,%edx
+  104bf4:	74 17                	je     104c0d <names_insert+0x67>
+		// Static functions can share a name; the first one wins.
+		if (names[i].nm_hash == h && strcmp(names[i].nm_name, name) == 0)
+  104bf6:	39 30                	cmp    %esi,(%eax)
+  104bf8:	75 e0                	jne    104bda <names_insert+0x34>
+  104bfa:	83 ec 08             	sub    $0x8,%esp
+  104bfd:	57                   	push   %edi
+  104bfe:	52                   	push   %edx
+  104bff:	e8 bd 44 00 00       	call   1090c1 <strcmp>
+  104c04:	83 c4 10             	add    $0x10,%esp
+  104c07:	85 c0                	test   %eax,%eax
+  104c09:	75 cf                	jne    104bda <names_insert+0x34>
+  104c0b:	eb 12                	jmp    104c1f <names_insert+0x79>
+			return;
+	names[i].nm_hash = h;
+  104c0d:	89 30                	mov    %esi,(%eax)
+	names[i].nm_addr = addr;
+  104c0f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  104c12:	89 50 04             	mov    %edx,0x4(%eax)
+	names[i].nm_name = name;
+  104c15:	89 78 08             	mov    %edi,0x8(%eax)
+	nnames++;
+  104c18:	83 05 10 e3 11 00 01 	addl   $0x1,0x11e310
+}
+  104c1f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  104c22:	5b                   	pop    %ebx
+  104c23:	5e                   	pop    %esi
+  104c24:	5f                   	pop    %edi
+  104c25:	5d                   	pop    %ebp
+  104c26:	c3                   	ret
+
+00104c27 <names_insert_die>:
+		names_count(f->fn_name, f->fn_low);
+}
+
+static void
+names_insert_die(unsigned tag, const struct Dwarf_Func *f)
+{
+  104c27:	55                   	push   %ebp
+  104c28:	89 e5                	mov    %esp,%ebp
+  104c2a:	83 ec 08             	sub    $0x8,%esp
+  104c2d:	8b 55 0c             	mov    0xc(%ebp),%edx
+	if (f->fn_name)
+  104c30:	8b 42 08             	mov    0x8(%edx),%eax
+  104c33:	85 c0                	test   %eax,%eax
+  104c35:	74 0e                	je     104c45 <names_insert_die+0x1e>
+		names_insert(f->fn_name, f->fn_low);
+  104c37:	83 ec 08             	sub    $0x8,%esp
+  104c3a:	ff 32                	push   (%edx)
+  104c3c:	50                   	push   %eax
+  104c3d:	e8 64 ff ff ff       	call   104ba6 <names_insert>
+  104c42:	83 c4 10             	add    $0x10,%esp
+}
+  104c45:	c9                   	leave
+  104c46:	c3                   	ret
+
+00104c47 <aranges_walk>:
+{
+  104c47:	55                   	push   %ebp
+  104c48:	89 e5                	mov    %esp,%ebp
+  104c4a:	57                   	push   %edi
+  104c4b:	56                   	push   %esi
+  104c4c:	53                   	push   %ebx
+  104c4d:	83 ec 3c             	sub    $0x3c,%esp
+  104c50:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+  104c53:	89 55 cc             	mov    %edx,-0x34(%ebp)
+	const void *set = addrs->aranges_begin;
+  104c56:	8b 40 08             	mov    0x8(%eax),%eax
+	initial_len = get_unaligned(addr, uint32_t);
+  104c59:	8d 7d e0             	lea    -0x20(%ebp),%edi
+  104c5c:	89 c6                	mov    %eax,%esi
+	while ((const unsigned char *) set < addrs->aranges_end) {
+  104c5e:	e9 83 00 00 00       	jmp    104ce6 <aranges_walk+0x9f>
+			*len = get_unaligned((uint64_t *)addr + 4, uint64_t);
+  104c63:	83 ec 04             	sub    $0x4,%esp
+  104c66:	6a 08                	push   $0x8
+  104c68:	8d 46 20             	lea    0x20(%esi),%eax
+  104c6b:	50                   	push   %eax
+  104c6c:	57                   	push   %edi
+  104c6d:	e8 86 45 00 00       	call   1091f8 <memcpy>
+  104c72:	8b 45 e0             	mov    -0x20(%ebp),%eax
+			count = 12;
+  104c75:	83 c4 10             	add    $0x10,%esp
+  104c78:	c7 45 c8 0c 00 00 00 	movl   $0xc,-0x38(%ebp)
+  104c7f:	e9 ca 00 00 00       	jmp    104d4e <aranges_walk+0x107>
+		for (; set < set_end; set += entry_size) {
+  104c84:	83 c3 08             	add    $0x8,%ebx
+  104c87:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  104c8a:	39 c3                	cmp    %eax,%ebx
+  104c8c:	73 3a                	jae    104cc8 <aranges_walk+0x81>
+			addr = get_unaligned(set, uint32_t);
+  104c8e:	83 ec 04             	sub    $0x4,%esp
+  104c91:	6a 04                	push   $0x4
+  104c93:	53                   	push   %ebx
+  104c94:	57                   	push   %edi
+  104c95:	e8 5e 45 00 00       	call   1091f8 <memcpy>
+  104c9a:	8b 75 e0             	mov    -0x20(%ebp),%esi
+			size = get_unaligned(set + sizeof(uint32_t), uint32_t);
+  104c9d:	83 c4 0c             	add    $0xc,%esp
+  104ca0:	6a 04                	push   $0x4
+  104ca2:	8d 43 04             	lea    0x4(%ebx),%eax
+  104ca5:	50                   	push   %eax
+  104ca6:	57                   	push   %edi
+  104ca7:	e8 4c 45 00 00       	call   1091f8 <memcpy>
+  104cac:	8b 45 e0             	mov    -0x20(%ebp),%eax
+			if (size)
+  104caf:	83 c4 10             	add    $0x10,%esp
+  104cb2:	85 c0                	test   %eax,%eax
+  104cb4:	74 ce                	je     104c84 <aranges_walk+0x3d>
+				fn(addr, size, offset);
+  104cb6:	83 ec 04             	sub    $0x4,%esp
+  104cb9:	ff 75 d0             	push   -0x30(%ebp)
+  104cbc:	50                   	push   %eax
+  104cbd:	56                   	push   %esi
+  104cbe:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  104cc1:	ff d0                	call   *%eax
+  104cc3:	83 c4 10             	add    $0x10,%esp
+  104cc6:	eb bc                	jmp    104c84 <aranges_walk+0x3d>
+  104cc8:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  104ccb:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+  104cce:	8d 56 07             	lea    0x7(%esi),%edx
+  104cd1:	29 c2                	sub    %eax,%edx
+  104cd3:	83 e2 f8             	and    $0xfffffff8,%edx
+  104cd6:	8d 48 f9             	lea    -0x7(%eax),%ecx
+  104cd9:	39 ce                	cmp    %ecx,%esi
+  104cdb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  104ce0:	0f 42 d1             	cmovb  %ecx,%edx
+  104ce3:	8d 34 10             	lea    (%eax,%edx,1),%esi
+	while ((const unsigned char *) set < addrs->aranges_end) {
+  104ce6:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+  104ce9:	3b 70 0c             	cmp    0xc(%eax),%esi
+  104cec:	73 3d                	jae    104d2b <aranges_walk+0xe4>
+	initial_len = get_unaligned(addr, uint32_t);
+  104cee:	83 ec 04             	sub    $0x4,%esp
+  104cf1:	6a 04                	push   $0x4
+  104cf3:	56                   	push   %esi
+  104cf4:	57                   	push   %edi
+  104cf5:	e8 fe 44 00 00       	call   1091f8 <memcpy>
+  104cfa:	8b 45 e0             	mov    -0x20(%ebp),%eax
+	if (initial_len >= DW_EXT_LO && initial_len <= DW_EXT_HI) {
+  104cfd:	83 c4 10             	add    $0x10,%esp
+  104d00:	83 f8 ef             	cmp    $0xffffffef,%eax
+  104d03:	76 42                	jbe    104d47 <aranges_walk+0x100>
+		if (initial_len == DW_EXT_DWARF64) {
+  104d05:	83 f8 ff             	cmp    $0xffffffff,%eax
+  104d08:	0f 84 55 ff ff ff    	je     104c63 <aranges_walk+0x1c>
+			cprintf("Unknown DWARF extension\n");
+  104d0e:	83 ec 0c             	sub    $0xc,%esp
+  104d11:	68 40 98 10 00       	push   $0x109840
+  104d16:	e8 19 2b 00 00       	call   107834 <cprintf>
+  104d1b:	83 c4 10             	add    $0x10,%esp
+  104d1e:	b8 fa ff ff ff       	mov    $0xfffffffa,%eax
+}
+  104d23:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  104d26:	5b                   	pop    %ebx
+  104d27:	5e                   	pop    %esi
+  104d28:	5f                   	pop    %edi
+  104d29:	5d                   	pop    %ebp
+  104d2a:	c3                   	ret
+	return 0;
+  104d2b:	b8 00 00 00 00       	mov    $0x0,%eax
+  104d30:	eb f1                	jmp    104d23 <aranges_walk+0xdc>
+  104d32:	b8 fa ff ff ff       	mov    $0xfffffffa,%eax
+  104d37:	eb ea                	jmp    104d23 <aranges_walk+0xdc>
+  104d39:	b8 fa ff ff ff       	mov    $0xfffffffa,%eax
+  104d3e:	eb e3                	jmp    104d23 <aranges_walk+0xdc>
+  104d40:	b8 fa ff ff ff       	mov    $0xfffffffa,%eax
+  104d45:	eb dc                	jmp    104d23 <aranges_walk+0xdc>
+	count = 4;
+  104d47:	c7 45 c8 04 00 00 00 	movl   $0x4,-0x38(%ebp)
+		set += count;
+  104d4e:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  104d51:	8d 1c 0e             	lea    (%esi,%ecx,1),%ebx
+		set_end = set + len;
+  104d54:	01 d8                	add    %ebx,%eax
+  104d56:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+		if (get_unaligned(set, Dwarf_Half) != 2)
+  104d59:	83 ec 04             	sub    $0x4,%esp
+  104d5c:	6a 02                	push   $0x2
+  104d5e:	53                   	push   %ebx
+  104d5f:	57                   	push   %edi
+  104d60:	e8 93 44 00 00       	call   1091f8 <memcpy>
+  104d65:	83 c4 10             	add    $0x10,%esp
+  104d68:	66 83 7d e0 02       	cmpw   $0x2,-0x20(%ebp)
+  104d6d:	75 d1                	jne    104d40 <aranges_walk+0xf9>
+		set += sizeof(Dwarf_Half);
+  104d6f:	83 c3 02             	add    $0x2,%ebx
+		offset = get_unaligned(set, uint32_t);
+  104d72:	83 ec 04             	sub    $0x4,%esp
+  104d75:	6a 04                	push   $0x4
+  104d77:	53                   	push   %ebx
+  104d78:	57                   	push   %edi
+  104d79:	e8 7a 44 00 00       	call   1091f8 <memcpy>
+  104d7e:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  104d81:	89 45 d0             	mov    %eax,-0x30(%ebp)
+		set += count;
+  104d84:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  104d87:	01 c3                	add    %eax,%ebx
+		if (get_unaligned(set, Dwarf_Small) != 4
+  104d89:	83 c4 0c             	add    $0xc,%esp
+  104d8c:	6a 01                	push   $0x1
+  104d8e:	53                   	push   %ebx
+  104d8f:	57                   	push   %edi
+  104d90:	e8 63 44 00 00       	call   1091f8 <memcpy>
+  104d95:	83 c4 10             	add    $0x10,%esp
+  104d98:	80 7d e0 04          	cmpb   $0x4,-0x20(%ebp)
+  104d9c:	75 94                	jne    104d32 <aranges_walk+0xeb>
+		    || get_unaligned(set + 1, Dwarf_Small) != 0)
+  104d9e:	83 ec 04             	sub    $0x4,%esp
+  104da1:	6a 01                	push   $0x1
+  104da3:	8d 43 01             	lea    0x1(%ebx),%eax
+  104da6:	50                   	push   %eax
+  104da7:	57                   	push   %edi
+  104da8:	e8 4b 44 00 00       	call   1091f8 <memcpy>
+  104dad:	83 c4 10             	add    $0x10,%esp
+  104db0:	80 7d e0 00          	cmpb   $0x0,-0x20(%ebp)
+  104db4:	75 83                	jne    104d39 <aranges_walk+0xf2>
+		set += 2;
+  104db6:	8d 43 02             	lea    0x2(%ebx),%eax
+		if ((remainder = (set - header) % entry_size))
+  104db9:	89 c2                	mov    %eax,%edx
+  104dbb:	29 f2                	sub    %esi,%edx
+  104dbd:	83 e2 07             	and    $0x7,%edx
+  104dc0:	74 05                	je     104dc7 <aranges_walk+0x180>
+			set += entry_size - remainder;
+  104dc2:	29 d0                	sub    %edx,%eax
+  104dc4:	8d 40 08             	lea    0x8(%eax),%eax
+{
+  104dc7:	89 c3                	mov    %eax,%ebx
+  104dc9:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  104dcc:	e9 b6 fe ff ff       	jmp    104c87 <aranges_walk+0x40>
+
+00104dd1 <nameidx_walk>:
+
+// Parse the headers of the name indexes in .debug_names into 'ni', if it
+// is not NULL.  Returns how many there are, or -E_BAD_DWARF.
+static int
+nameidx_walk(const struct Dwarf_Addrs *addrs, struct Dwarf_Nameidx *ni)
+{
+  104dd1:	55                   	push   %ebp
+  104dd2:	89 e5                	mov    %esp,%ebp
+  104dd4:	57                   	push   %edi
+  104dd5:	56                   	push   %esi
+  104dd6:	53                   	push   %ebx
+  104dd7:	83 ec 4c             	sub    $0x4c,%esp
+  104dda:	89 45 b0             	mov    %eax,-0x50(%ebp)
+  104ddd:	89 d3                	mov    %edx,%ebx
+	const char *set = (const char *) addrs->names_begin, *p, *end;
+  104ddf:	8b 78 50             	mov    0x50(%eax),%edi
+	uint32_t ncus, nltus, nftus, nbuckets, nnames, abbrev_size, aug_size;
+	unsigned long len;
+	int count, n = 0;
+  104de2:	c7 45 b4 00 00 00 00 	movl   $0x0,-0x4c(%ebp)
+	initial_len = get_unaligned(addr, uint32_t);
+  104de9:	8d 75 e0             	lea    -0x20(%ebp),%esi
+
+	for (; (const unsigned char *) set < addrs->names_end; set = end) {
+  104dec:	e9 b1 01 00 00       	jmp    104fa2 <nameidx_walk+0x1d1>
+			*len = get_unaligned((uint64_t *)addr + 4, uint64_t);
+  104df1:	83 ec 04             	sub    $0x4,%esp
+  104df4:	6a 08                	push   $0x8
+  104df6:	8d 47 20             	lea    0x20(%edi),%eax
+  104df9:	50                   	push   %eax
+  104dfa:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  104dfd:	50                   	push   %eax
+  104dfe:	e8 f5 43 00 00       	call   1091f8 <memcpy>
+			count = 12;
+  104e03:	83 c4 10             	add    $0x10,%esp
+  104e06:	e9 d3 01 00 00       	jmp    104fde <nameidx_walk+0x20d>
+			ni->ni_end = end;
+			ni++;
+		}
+		p += 8 * nnames + abbrev_size;
+		if (p > end)
+			return -E_BAD_DWARF;
+  104e0b:	c7 45 b4 fa ff ff ff 	movl   $0xfffffffa,-0x4c(%ebp)
+  104e12:	e9 ce 01 00 00       	jmp    104fe5 <nameidx_walk+0x214>
+			return -E_BAD_DWARF;
+  104e17:	c7 45 b4 fa ff ff ff 	movl   $0xfffffffa,-0x4c(%ebp)
+  104e1e:	e9 c2 01 00 00       	jmp    104fe5 <nameidx_walk+0x214>
+		p += 4 * (ncus + nltus) + 8 * nftus;
+  104e23:	8b 45 c0             	mov    -0x40(%ebp),%eax
+  104e26:	8b 55 bc             	mov    -0x44(%ebp),%edx
+  104e29:	01 d0                	add    %edx,%eax
+  104e2b:	8b 55 b8             	mov    -0x48(%ebp),%edx
+  104e2e:	8d 04 50             	lea    (%eax,%edx,2),%eax
+  104e31:	8d 04 81             	lea    (%ecx,%eax,4),%eax
+		if (nbuckets)
+  104e34:	83 7d d0 00          	cmpl   $0x0,-0x30(%ebp)
+  104e38:	0f 84 44 01 00 00    	je     104f82 <nameidx_walk+0x1b1>
+			p += 4 * (nbuckets + nnames);
+  104e3e:	8b 55 d0             	mov    -0x30(%ebp),%edx
+  104e41:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+  104e44:	01 ca                	add    %ecx,%edx
+  104e46:	8d 04 90             	lea    (%eax,%edx,4),%eax
+		if (ni) {
+  104e49:	e9 34 01 00 00       	jmp    104f82 <nameidx_walk+0x1b1>
+		p = set + count;
+  104e4e:	8d 47 04             	lea    0x4(%edi),%eax
+		end = p + len;
+  104e51:	8d 0c 10             	lea    (%eax,%edx,1),%ecx
+  104e54:	89 4d c8             	mov    %ecx,-0x38(%ebp)
+		if (get_unaligned(p, Dwarf_Half) != 5)
+  104e57:	83 ec 04             	sub    $0x4,%esp
+  104e5a:	6a 02                	push   $0x2
+  104e5c:	50                   	push   %eax
+  104e5d:	56                   	push   %esi
+  104e5e:	e8 95 43 00 00       	call   1091f8 <memcpy>
+  104e63:	83 c4 10             	add    $0x10,%esp
+  104e66:	66 83 7d e0 05       	cmpw   $0x5,-0x20(%ebp)
+  104e6b:	75 aa                	jne    104e17 <nameidx_walk+0x46>
+		p += 2 * sizeof(Dwarf_Half);	// and padding
+  104e6d:	8d 47 08             	lea    0x8(%edi),%eax
+		ncus = get_unaligned(p, uint32_t);
+  104e70:	83 ec 04             	sub    $0x4,%esp
+  104e73:	6a 04                	push   $0x4
+  104e75:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  104e78:	50                   	push   %eax
+  104e79:	56                   	push   %esi
+  104e7a:	e8 79 43 00 00       	call   1091f8 <memcpy>
+  104e7f:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  104e82:	89 4d c0             	mov    %ecx,-0x40(%ebp)
+		nltus = get_unaligned(p + 4, uint32_t);
+  104e85:	83 c4 0c             	add    $0xc,%esp
+  104e88:	6a 04                	push   $0x4
+  104e8a:	8d 47 0c             	lea    0xc(%edi),%eax
+  104e8d:	50                   	push   %eax
+  104e8e:	56                   	push   %esi
+  104e8f:	e8 64 43 00 00       	call   1091f8 <memcpy>
+  104e94:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  104e97:	89 45 bc             	mov    %eax,-0x44(%ebp)
+		nftus = get_unaligned(p + 8, uint32_t);
+  104e9a:	83 c4 0c             	add    $0xc,%esp
+  104e9d:	6a 04                	push   $0x4
+  104e9f:	8d 47 10             	lea    0x10(%edi),%eax
+  104ea2:	50                   	push   %eax
+  104ea3:	56                   	push   %esi
+  104ea4:	e8 4f 43 00 00       	call   1091f8 <memcpy>
+  104ea9:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  104eac:	89 55 b8             	mov    %edx,-0x48(%ebp)
+		nbuckets = get_unaligned(p + 12, uint32_t);
+  104eaf:	83 c4 0c             	add    $0xc,%esp
+  104eb2:	6a 04                	push   $0x4
+  104eb4:	8d 47 14             	lea    0x14(%edi),%eax
+  104eb7:	50                   	push   %eax
+  104eb8:	56                   	push   %esi
+  104eb9:	e8 3a 43 00 00       	call   1091f8 <memcpy>
+  104ebe:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  104ec1:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+		nnames = get_unaligned(p + 16, uint32_t);
+  104ec4:	83 c4 0c             	add    $0xc,%esp
+  104ec7:	6a 04                	push   $0x4
+  104ec9:	8d 47 18             	lea    0x18(%edi),%eax
+  104ecc:	50                   	push   %eax
+  104ecd:	56                   	push   %esi
+  104ece:	e8 25 43 00 00       	call   1091f8 <memcpy>
+  104ed3:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  104ed6:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+		abbrev_size = get_unaligned(p + 20, uint32_t);
+  104ed9:	83 c4 0c             	add    $0xc,%esp
+  104edc:	6a 04                	push   $0x4
+  104ede:	8d 47 1c             	lea    0x1c(%edi),%eax
+  104ee1:	50                   	push   %eax
+  104ee2:	56                   	push   %esi
+  104ee3:	e8 10 43 00 00       	call   1091f8 <memcpy>
+  104ee8:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  104eeb:	89 4d c4             	mov    %ecx,-0x3c(%ebp)
+		aug_size = get_unaligned(p + 24, uint32_t);
+  104eee:	83 c4 0c             	add    $0xc,%esp
+  104ef1:	6a 04                	push   $0x4
+  104ef3:	83 c7 20             	add    $0x20,%edi
+  104ef6:	57                   	push   %edi
+  104ef7:	56                   	push   %esi
+  104ef8:	e8 fb 42 00 00       	call   1091f8 <memcpy>
+		p += 28 + ROUNDUP(aug_size, 4);
+  104efd:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  104f00:	8d 47 03             	lea    0x3(%edi),%eax
+  104f03:	83 e0 fc             	and    $0xfffffffc,%eax
+  104f06:	8b 7d cc             	mov    -0x34(%ebp),%edi
+  104f09:	8d 4c 07 1c          	lea    0x1c(%edi,%eax,1),%ecx
+		if (ni) {
+  104f0d:	83 c4 10             	add    $0x10,%esp
+  104f10:	85 db                	test   %ebx,%ebx
+  104f12:	0f 84 0b ff ff ff    	je     104e23 <nameidx_walk+0x52>
+		p += 4 * (ncus + nltus) + 8 * nftus;
+  104f18:	8b 45 bc             	mov    -0x44(%ebp),%eax
+  104f1b:	8b 55 c0             	mov    -0x40(%ebp),%edx
+  104f1e:	01 d0                	add    %edx,%eax
+  104f20:	8b 55 b8             	mov    -0x48(%ebp),%edx
+  104f23:	8d 04 50             	lea    (%eax,%edx,2),%eax
+  104f26:	8d 14 81             	lea    (%ecx,%eax,4),%edx
+			ni->ni_hashes = p + 4 * nbuckets;
+  104f29:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  104f2c:	8d 3c 82             	lea    (%edx,%eax,4),%edi
+  104f2f:	89 7d cc             	mov    %edi,-0x34(%ebp)
+		if (nbuckets)
+  104f32:	85 c0                	test   %eax,%eax
+  104f34:	0f 85 b6 00 00 00    	jne    104ff0 <nameidx_walk+0x21f>
+		p += 4 * (ncus + nltus) + 8 * nftus;
+  104f3a:	89 d0                	mov    %edx,%eax
+			ni->ni_cus = p;
+  104f3c:	89 0b                	mov    %ecx,(%ebx)
+			ni->ni_ncus = ncus;
+  104f3e:	8b 4d c0             	mov    -0x40(%ebp),%ecx
+  104f41:	89 4b 04             	mov    %ecx,0x4(%ebx)
+			ni->ni_buckets = p;
+  104f44:	89 53 08             	mov    %edx,0x8(%ebx)
+			ni->ni_nbuckets = nbuckets;
+  104f47:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  104f4a:	89 4b 0c             	mov    %ecx,0xc(%ebx)
+			ni->ni_hashes = p + 4 * nbuckets;
+  104f4d:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  104f50:	89 4b 10             	mov    %ecx,0x10(%ebx)
+			ni->ni_strs = p;
+  104f53:	89 43 14             	mov    %eax,0x14(%ebx)
+			ni->ni_entries = p + 4 * nnames;
+  104f56:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  104f59:	8d 0c bd 00 00 00 00 	lea    0x0(,%edi,4),%ecx
+  104f60:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  104f63:	89 53 18             	mov    %edx,0x18(%ebx)
+			ni->ni_nnames = nnames;
+  104f66:	89 7b 1c             	mov    %edi,0x1c(%ebx)
+			ni->ni_abbrevs = p + 8 * nnames;
+  104f69:	01 ca                	add    %ecx,%edx
+  104f6b:	89 53 20             	mov    %edx,0x20(%ebx)
+			ni->ni_pool = p + 8 * nnames + abbrev_size;
+  104f6e:	8b 55 c4             	mov    -0x3c(%ebp),%edx
+  104f71:	8d 14 fa             	lea    (%edx,%edi,8),%edx
+  104f74:	01 c2                	add    %eax,%edx
+  104f76:	89 53 24             	mov    %edx,0x24(%ebx)
+			ni->ni_end = end;
+  104f79:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  104f7c:	89 4b 28             	mov    %ecx,0x28(%ebx)
+			ni++;
+  104f7f:	83 c3 2c             	add    $0x2c,%ebx
+		p += 8 * nnames + abbrev_size;
+  104f82:	8b 55 c4             	mov    -0x3c(%ebp),%edx
+  104f85:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+  104f88:	8d 14 ca             	lea    (%edx,%ecx,8),%edx
+  104f8b:	01 d0                	add    %edx,%eax
+		if (p > end)
+  104f8d:	8b 7d c8             	mov    -0x38(%ebp),%edi
+  104f90:	39 c7                	cmp    %eax,%edi
+  104f92:	0f 82 73 fe ff ff    	jb     104e0b <nameidx_walk+0x3a>
+		dwarf_stats.dws_nnames += nnames;
+  104f98:	01 0d dc e2 11 00    	add    %ecx,0x11e2dc
+		n++;
+  104f9e:	83 45 b4 01          	addl   $0x1,-0x4c(%ebp)
+	for (; (const unsigned char *) set < addrs->names_end; set = end) {
+  104fa2:	8b 45 b0             	mov    -0x50(%ebp),%eax
+  104fa5:	3b 78 54             	cmp    0x54(%eax),%edi
+  104fa8:	73 3b                	jae    104fe5 <nameidx_walk+0x214>
+	initial_len = get_unaligned(addr, uint32_t);
+  104faa:	83 ec 04             	sub    $0x4,%esp
+  104fad:	6a 04                	push   $0x4
+  104faf:	57                   	push   %edi
+  104fb0:	56                   	push   %esi
+  104fb1:	e8 42 42 00 00       	call   1091f8 <memcpy>
+  104fb6:	8b 55 e0             	mov    -0x20(%ebp),%edx
+	if (initial_len >= DW_EXT_LO && initial_len <= DW_EXT_HI) {
+  104fb9:	83 c4 10             	add    $0x10,%esp
+  104fbc:	83 fa ef             	cmp    $0xffffffef,%edx
+  104fbf:	0f 86 89 fe ff ff    	jbe    104e4e <nameidx_walk+0x7d>
+		if (initial_len == DW_EXT_DWARF64) {
+  104fc5:	83 fa ff             	cmp    $0xffffffff,%edx
+  104fc8:	0f 84 23 fe ff ff    	je     104df1 <nameidx_walk+0x20>
+			cprintf("Unknown DWARF extension\n");
+  104fce:	83 ec 0c             	sub    $0xc,%esp
+  104fd1:	68 40 98 10 00       	push   $0x109840
+  104fd6:	e8 59 28 00 00       	call   107834 <cprintf>
+  104fdb:	83 c4 10             	add    $0x10,%esp
+			return -E_BAD_DWARF;
+  104fde:	c7 45 b4 fa ff ff ff 	movl   $0xfffffffa,-0x4c(%ebp)
+	}
+	return n;
+}
+  104fe5:	8b 45 b4             	mov    -0x4c(%ebp),%eax
+  104fe8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  104feb:	5b                   	pop    %ebx
+  104fec:	5e                   	pop    %esi
+  104fed:	5f                   	pop    %edi
+  104fee:	5d                   	pop    %ebp
+  104fef:	c3                   	ret
+			p += 4 * (nbuckets + nnames);
+  104ff0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  104ff3:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  104ff6:	01 f8                	add    %edi,%eax
+  104ff8:	8d 04 82             	lea    (%edx,%eax,4),%eax
+		if (ni) {
+  104ffb:	e9 3c ff ff ff       	jmp    104f3c <nameidx_walk+0x16b>
+
+00105000 <die_concrete>:
+{
+  105000:	55                   	push   %ebp
+  105001:	89 e5                	mov    %esp,%ebp
+  105003:	57                   	push   %edi
+  105004:	56                   	push   %esi
+  105005:	53                   	push   %ebx
+  105006:	83 ec 4c             	sub    $0x4c,%esp
+  105009:	89 45 b4             	mov    %eax,-0x4c(%ebp)
+  10500c:	89 55 bc             	mov    %edx,-0x44(%ebp)
+  10500f:	89 4d b8             	mov    %ecx,-0x48(%ebp)
+	for (entry = cu->cu_dies; entry < cu->cu_end; ) {
+  105012:	8b 42 04             	mov    0x4(%edx),%eax
+  105015:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+  105018:	eb 29                	jmp    105043 <die_concrete+0x43>
+  10501a:	ba 00 08 02 60       	mov    $0x60020800,%edx
+  10501f:	d3 ea                	shr    %cl,%edx
+  105021:	83 e2 01             	and    $0x1,%edx
+			entry = dwarf_skip_die(addrs, cu, abbrevs, ab, entry,
+  105024:	83 ec 08             	sub    $0x8,%esp
+					       !dwarf_tag_has_code(ab->ab_tag));
+  105027:	83 f2 01             	xor    $0x1,%edx
+			entry = dwarf_skip_die(addrs, cu, abbrevs, ab, entry,
+  10502a:	52                   	push   %edx
+  10502b:	ff 75 c4             	push   -0x3c(%ebp)
+  10502e:	57                   	push   %edi
+  10502f:	ff 75 b8             	push   -0x48(%ebp)
+  105032:	ff 75 bc             	push   -0x44(%ebp)
+  105035:	ff 75 b4             	push   -0x4c(%ebp)
+  105038:	e8 fe cd ff ff       	call   101e3b <dwarf_skip_die>
+  10503d:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+			continue;
+  105040:	83 c4 20             	add    $0x20,%esp
+	for (entry = cu->cu_dies; entry < cu->cu_end; ) {
+  105043:	8b 45 bc             	mov    -0x44(%ebp),%eax
+  105046:	8b 70 08             	mov    0x8(%eax),%esi
+  105049:	89 75 c0             	mov    %esi,-0x40(%ebp)
+  10504c:	8b 7d c0             	mov    -0x40(%ebp),%edi
+  10504f:	39 7d c4             	cmp    %edi,-0x3c(%ebp)
+  105052:	0f 83 3e 01 00 00    	jae    105196 <die_concrete+0x196>
+	count = 0;
+  105058:	b8 00 00 00 00       	mov    $0x0,%eax
+	result = 0;
+  10505d:	bf 00 00 00 00       	mov    $0x0,%edi
+  105062:	89 c6                	mov    %eax,%esi
+		byte = *addr;
+  105064:	8b 5d c4             	mov    -0x3c(%ebp),%ebx
+  105067:	0f b6 1c 03          	movzbl (%ebx,%eax,1),%ebx
+		count++;
+  10506b:	83 c0 01             	add    $0x1,%eax
+		result |= (byte & 0x7f) << shift;
+  10506e:	89 da                	mov    %ebx,%edx
+  105070:	83 e2 7f             	and    $0x7f,%edx
+  105073:	8d 0c f5 00 00 00 00 	lea    0x0(,%esi,8),%ecx
+  10507a:	29 f1                	sub    %esi,%ecx
+  10507c:	d3 e2                	shl    %cl,%edx
+  10507e:	09 d7                	or     %edx,%edi
+		if (!(byte & 0x80))
+  105080:	84 db                	test   %bl,%bl
+  105082:	78 de                	js     105062 <die_concrete+0x62>
+		entry += dwarf_read_uleb128(entry, &code);
+  105084:	01 45 c4             	add    %eax,-0x3c(%ebp)
+		if (code == 0)
+  105087:	85 ff                	test   %edi,%edi
+  105089:	74 c1                	je     10504c <die_concrete+0x4c>
+	if (code >= at->at_ncodes || !at->at_abbrevs[code].ab_attrs)
+  10508b:	8b 45 b8             	mov    -0x48(%ebp),%eax
+  10508e:	3b 78 08             	cmp    0x8(%eax),%edi
+  105091:	0f 83 06 01 00 00    	jae    10519d <die_concrete+0x19d>
+  105097:	8d 14 bf             	lea    (%edi,%edi,4),%edx
+  10509a:	8b 40 0c             	mov    0xc(%eax),%eax
+  10509d:	8d 3c 90             	lea    (%eax,%edx,4),%edi
+  1050a0:	8b 5f 04             	mov    0x4(%edi),%ebx
+  1050a3:	85 db                	test   %ebx,%ebx
+  1050a5:	0f 84 ff 00 00 00    	je     1051aa <die_concrete+0x1aa>
+		if (ab->ab_tag != DW_TAG_subprogram) {
+  1050ab:	0f b7 0f             	movzwl (%edi),%ecx
+  1050ae:	66 83 f9 2e          	cmp    $0x2e,%cx
+  1050b2:	74 38                	je     1050ec <die_concrete+0xec>
+	return tag == DW_TAG_compile_unit || tag == DW_TAG_partial_unit
+  1050b4:	66 83 f9 1e          	cmp    $0x1e,%cx
+  1050b8:	77 14                	ja     1050ce <die_concrete+0xce>
+		|| tag == DW_TAG_module;
+  1050ba:	ba 00 00 00 00       	mov    $0x0,%edx
+  1050bf:	66 83 f9 0a          	cmp    $0xa,%cx
+  1050c3:	0f 86 5b ff ff ff    	jbe    105024 <die_concrete+0x24>
+  1050c9:	e9 4c ff ff ff       	jmp    10501a <die_concrete+0x1a>
+  1050ce:	83 e9 2e             	sub    $0x2e,%ecx
+  1050d1:	ba 01 48 00 00       	mov    $0x4801,%edx
+  1050d6:	d3 ea                	shr    %cl,%edx
+  1050d8:	83 e2 01             	and    $0x1,%edx
+  1050db:	66 83 f9 0f          	cmp    $0xf,%cx
+  1050df:	b9 00 00 00 00       	mov    $0x0,%ecx
+  1050e4:	0f 43 d1             	cmovae %ecx,%edx
+  1050e7:	e9 38 ff ff ff       	jmp    105024 <die_concrete+0x24>
+		attrs = entry;
+  1050ec:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+  1050ef:	89 45 d0             	mov    %eax,-0x30(%ebp)
+		entry += dwarf_read_uleb128(entry, &code);
+  1050f2:	89 c6                	mov    %eax,%esi
+		origin = NULL;
+  1050f4:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%ebp)
+  1050fb:	89 7d b0             	mov    %edi,-0x50(%ebp)
+  1050fe:	8b 7d bc             	mov    -0x44(%ebp),%edi
+		for (as = ab->ab_attrs; as->as_name || as->as_form; as++) {
+  105101:	eb 1d                	jmp    105120 <die_concrete+0x120>
+			entry += dwarf_read_abbrev_entry(entry, as->as_form,
+  105103:	83 ec 0c             	sub    $0xc,%esp
+  105106:	ff 77 18             	push   0x18(%edi)
+  105109:	6a 00                	push   $0x0
+  10510b:	6a 00                	push   $0x0
+  10510d:	0f b7 43 02          	movzwl 0x2(%ebx),%eax
+  105111:	50                   	push   %eax
+  105112:	56                   	push   %esi
+  105113:	e8 97 b7 ff ff       	call   1008af <dwarf_read_abbrev_entry>
+  105118:	01 c6                	add    %eax,%esi
+		for (as = ab->ab_attrs; as->as_name || as->as_form; as++) {
+  10511a:	83 c3 08             	add    $0x8,%ebx
+  10511d:	83 c4 20             	add    $0x20,%esp
+  105120:	83 3b 00             	cmpl   $0x0,(%ebx)
+  105123:	74 26                	je     10514b <die_concrete+0x14b>
+			if (as->as_name == DW_AT_abstract_origin
+  105125:	66 83 3b 31          	cmpw   $0x31,(%ebx)
+  105129:	75 d8                	jne    105103 <die_concrete+0x103>
+			    && as->as_form != DW_FORM_ref_sig8)
+  10512b:	0f b7 43 02          	movzwl 0x2(%ebx),%eax
+  10512f:	66 83 f8 20          	cmp    $0x20,%ax
+  105133:	74 ce                	je     105103 <die_concrete+0x103>
+				origin = dwarf_read_ref(addrs, cu, as->as_form,
+  105135:	56                   	push   %esi
+  105136:	0f b7 c0             	movzwl %ax,%eax
+  105139:	50                   	push   %eax
+  10513a:	57                   	push   %edi
+  10513b:	ff 75 b4             	push   -0x4c(%ebp)
+  10513e:	e8 72 c5 ff ff       	call   1016b5 <dwarf_read_ref>
+  105143:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  105146:	83 c4 10             	add    $0x10,%esp
+  105149:	eb b8                	jmp    105103 <die_concrete+0x103>
+		if (origin == die
+  10514b:	8b 7d b0             	mov    -0x50(%ebp),%edi
+  10514e:	8b 45 c0             	mov    -0x40(%ebp),%eax
+  105151:	3b 45 08             	cmp    0x8(%ebp),%eax
+  105154:	74 08                	je     10515e <die_concrete+0x15e>
+  105156:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+  105159:	e9 e5 fe ff ff       	jmp    105043 <die_concrete+0x43>
+		    && die_read(addrs, cu, abbrevs, ab, attrs, &f, NULL, &attrs)) {
+  10515e:	83 ec 0c             	sub    $0xc,%esp
+  105161:	8d 55 d0             	lea    -0x30(%ebp),%edx
+  105164:	52                   	push   %edx
+  105165:	6a 00                	push   $0x0
+  105167:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+  10516a:	52                   	push   %edx
+  10516b:	ff 75 c4             	push   -0x3c(%ebp)
+  10516e:	57                   	push   %edi
+  10516f:	8b 4d b8             	mov    -0x48(%ebp),%ecx
+  105172:	8b 55 bc             	mov    -0x44(%ebp),%edx
+  105175:	8b 45 b4             	mov    -0x4c(%ebp),%eax
+  105178:	e8 7a f4 ff ff       	call   1045f7 <die_read>
+  10517d:	83 c4 20             	add    $0x20,%esp
+  105180:	84 c0                	test   %al,%al
+  105182:	75 08                	jne    10518c <die_concrete+0x18c>
+  105184:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+  105187:	e9 b7 fe ff ff       	jmp    105043 <die_concrete+0x43>
+			*addr = f.fn_low;
+  10518c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  10518f:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+  105192:	89 0a                	mov    %ecx,(%edx)
+			return 1;
+  105194:	eb 0c                	jmp    1051a2 <die_concrete+0x1a2>
+	return 0;
+  105196:	b8 00 00 00 00       	mov    $0x0,%eax
+  10519b:	eb 05                	jmp    1051a2 <die_concrete+0x1a2>
+			return 0;
+  10519d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  1051a2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  1051a5:	5b                   	pop    %ebx
+  1051a6:	5e                   	pop    %esi
+  1051a7:	5f                   	pop    %edi
+  1051a8:	5d                   	pop    %ebp
+  1051a9:	c3                   	ret
+			return 0;
+  1051aa:	b8 00 00 00 00       	mov    $0x0,%eax
+  1051af:	eb f1                	jmp    1051a2 <die_concrete+0x1a2>
+
+001051b1 <nameidx_entries>:
+// Find the address of the first subprogram or label among the entries
+// of name number 'i' in 'ni'.  Returns -E_NO_ENT if none has one.
+static int
+nameidx_entries(const struct Dwarf_Addrs *addrs,
+		const struct Dwarf_Nameidx *ni, uint32_t i, uintptr_t *addr)
+{
+  1051b1:	55                   	push   %ebp
+  1051b2:	89 e5                	mov    %esp,%ebp
+  1051b4:	57                   	push   %edi
+  1051b5:	56                   	push   %esi
+  1051b6:	53                   	push   %ebx
+  1051b7:	83 ec 60             	sub    $0x60,%esp
+  1051ba:	89 45 98             	mov    %eax,-0x68(%ebp)
+  1051bd:	89 55 a8             	mov    %edx,-0x58(%ebp)
+	const char *e = ni->ni_pool + get_unaligned(ni->ni_entries + 4 * i, uint32_t);
+  1051c0:	8b 5a 24             	mov    0x24(%edx),%ebx
+  1051c3:	6a 04                	push   $0x4
+  1051c5:	8b 42 18             	mov    0x18(%edx),%eax
+  1051c8:	8d 04 88             	lea    (%eax,%ecx,4),%eax
+  1051cb:	50                   	push   %eax
+  1051cc:	8d 45 c4             	lea    -0x3c(%ebp),%eax
+  1051cf:	50                   	push   %eax
+  1051d0:	e8 23 40 00 00       	call   1091f8 <memcpy>
+  1051d5:	03 5d c4             	add    -0x3c(%ebp),%ebx
+  1051d8:	89 5d ac             	mov    %ebx,-0x54(%ebp)
+	struct Dwarf_Func f;
+	unsigned code, acode, tag, idx, form;
+	uint32_t val, cu_index, die_offset;
+	int value;
+
+	while (e < ni->ni_end) {
+  1051db:	83 c4 10             	add    $0x10,%esp
+  1051de:	8b 45 a8             	mov    -0x58(%ebp),%eax
+  1051e1:	8b 75 ac             	mov    -0x54(%ebp),%esi
+  1051e4:	3b 70 28             	cmp    0x28(%eax),%esi
+  1051e7:	0f 83 ce 03 00 00    	jae    1055bb <nameidx_entries+0x40a>
+	count = 0;
+  1051ed:	b8 00 00 00 00       	mov    $0x0,%eax
+	result = 0;
+  1051f2:	bf 00 00 00 00       	mov    $0x0,%edi
+  1051f7:	89 c6                	mov    %eax,%esi
+		byte = *addr;
+  1051f9:	8b 4d ac             	mov    -0x54(%ebp),%ecx
+  1051fc:	0f b6 1c 01          	movzbl (%ecx,%eax,1),%ebx
+		count++;
+  105200:	83 c0 01             	add    $0x1,%eax
+		result |= (byte & 0x7f) << shift;
+  105203:	89 da                	mov    %ebx,%edx
+  105205:	83 e2 7f             	and    $0x7f,%edx
+  105208:	8d 0c f5 00 00 00 00 	lea    0x0(,%esi,8),%ecx
+  10520f:	29 f1                	sub    %esi,%ecx
+  105211:	d3 e2                	shl    %cl,%edx
+  105213:	09 d7                	or     %edx,%edi
+		if (!(byte & 0x80))
+  105215:	84 db                	test   %bl,%bl
+  105217:	78 de                	js     1051f7 <nameidx_entries+0x46>
+		e += dwarf_read_uleb128(e, &code);
+		if (code == 0)
+  105219:	85 ff                	test   %edi,%edi
+  10521b:	0f 84 a1 03 00 00    	je     1055c2 <nameidx_entries+0x411>
+			break;
+
+		// The abbreviation table is small: search it.
+		for (a = ni->ni_abbrevs; ; ) {
+  105221:	8b 75 a8             	mov    -0x58(%ebp),%esi
+  105224:	8b 76 20             	mov    0x20(%esi),%esi
+  105227:	89 75 b4             	mov    %esi,-0x4c(%ebp)
+  10522a:	89 45 a0             	mov    %eax,-0x60(%ebp)
+  10522d:	89 7d a4             	mov    %edi,-0x5c(%ebp)
+  105230:	e9 8e 00 00 00       	jmp    1052c3 <nameidx_entries+0x112>
+	count = 0;
+  105235:	b8 00 00 00 00       	mov    $0x0,%eax
+		byte = *addr;
+  10523a:	0f b6 14 01          	movzbl (%ecx,%eax,1),%edx
+		count++;
+  10523e:	83 c0 01             	add    $0x1,%eax
+		if (!(byte & 0x80))
+  105241:	84 d2                	test   %dl,%dl
+  105243:	78 f5                	js     10523a <nameidx_entries+0x89>
+				break;
+			do {
+				a += dwarf_read_uleb128(a, &idx);
+				a += dwarf_read_uleb128(a, &form);
+				if (form == DW_FORM_implicit_const)
+					a += dwarf_read_leb128(a, &value);
+  105245:	01 45 b4             	add    %eax,-0x4c(%ebp)
+	count = 0;
+  105248:	bb 00 00 00 00       	mov    $0x0,%ebx
+	result = 0;
+  10524d:	bf 00 00 00 00       	mov    $0x0,%edi
+  105252:	89 de                	mov    %ebx,%esi
+		byte = *addr;
+  105254:	8b 45 b4             	mov    -0x4c(%ebp),%eax
+  105257:	0f b6 14 18          	movzbl (%eax,%ebx,1),%edx
+		count++;
+  10525b:	83 c3 01             	add    $0x1,%ebx
+		result |= (byte & 0x7f) << shift;
+  10525e:	89 d0                	mov    %edx,%eax
+  105260:	83 e0 7f             	and    $0x7f,%eax
+  105263:	8d 0c f5 00 00 00 00 	lea    0x0(,%esi,8),%ecx
+  10526a:	29 f1                	sub    %esi,%ecx
+  10526c:	d3 e0                	shl    %cl,%eax
+  10526e:	09 c7                	or     %eax,%edi
+		if (!(byte & 0x80))
+  105270:	84 d2                	test   %dl,%dl
+  105272:	78 de                	js     105252 <nameidx_entries+0xa1>
+				a += dwarf_read_uleb128(a, &idx);
+  105274:	8b 45 b4             	mov    -0x4c(%ebp),%eax
+  105277:	01 d8                	add    %ebx,%eax
+  105279:	89 45 b4             	mov    %eax,-0x4c(%ebp)
+	count = 0;
+  10527c:	b8 00 00 00 00       	mov    $0x0,%eax
+	result = 0;
+  105281:	be 00 00 00 00       	mov    $0x0,%esi
+  105286:	89 7d b0             	mov    %edi,-0x50(%ebp)
+  105289:	89 c7                	mov    %eax,%edi
+		byte = *addr;
+  10528b:	8b 5d b4             	mov    -0x4c(%ebp),%ebx
+  10528e:	0f b6 1c 03          	movzbl (%ebx,%eax,1),%ebx
+		count++;
+  105292:	83 c0 01             	add    $0x1,%eax
+		result |= (byte & 0x7f) << shift;
+  105295:	89 da                	mov    %ebx,%edx
+  105297:	83 e2 7f             	and    $0x7f,%edx
+  10529a:	8d 0c fd 00 00 00 00 	lea    0x0(,%edi,8),%ecx
+  1052a1:	29 f9                	sub    %edi,%ecx
+  1052a3:	d3 e2                	shl    %cl,%edx
+  1052a5:	09 d6                	or     %edx,%esi
+		if (!(byte & 0x80))
+  1052a7:	84 db                	test   %bl,%bl
+  1052a9:	78 de                	js     105289 <nameidx_entries+0xd8>
+				a += dwarf_read_uleb128(a, &form);
+  1052ab:	8b 7d b0             	mov    -0x50(%ebp),%edi
+  1052ae:	8b 4d b4             	mov    -0x4c(%ebp),%ecx
+  1052b1:	01 c1                	add    %eax,%ecx
+  1052b3:	89 4d b4             	mov    %ecx,-0x4c(%ebp)
+				if (form == DW_FORM_implicit_const)
+  1052b6:	83 fe 21             	cmp    $0x21,%esi
+  1052b9:	0f 84 76 ff ff ff    	je     105235 <nameidx_entries+0x84>
+			} while (idx != 0 || form != 0);
+  1052bf:	09 fe                	or     %edi,%esi
+  1052c1:	75 85                	jne    105248 <nameidx_entries+0x97>
+	count = 0;
+  1052c3:	be 00 00 00 00       	mov    $0x0,%esi
+	result = 0;
+  1052c8:	bf 00 00 00 00       	mov    $0x0,%edi
+  1052cd:	89 f3                	mov    %esi,%ebx
+		byte = *addr;
+  1052cf:	8b 45 b4             	mov    -0x4c(%ebp),%eax
+  1052d2:	0f b6 14 30          	movzbl (%eax,%esi,1),%edx
+		count++;
+  1052d6:	83 c6 01             	add    $0x1,%esi
+		result |= (byte & 0x7f) << shift;
+  1052d9:	89 d0                	mov    %edx,%eax
+  1052db:	83 e0 7f             	and    $0x7f,%eax
+  1052de:	8d 0c dd 00 00 00 00 	lea    0x0(,%ebx,8),%ecx
+  1052e5:	29 d9                	sub    %ebx,%ecx
+  1052e7:	d3 e0                	shl    %cl,%eax
+  1052e9:	09 c7                	or     %eax,%edi
+		if (!(byte & 0x80))
+  1052eb:	84 d2                	test   %dl,%dl
+  1052ed:	78 de                	js     1052cd <nameidx_entries+0x11c>
+			a += dwarf_read_uleb128(a, &acode);
+  1052ef:	8b 45 b4             	mov    -0x4c(%ebp),%eax
+  1052f2:	01 f0                	add    %esi,%eax
+  1052f4:	89 c6                	mov    %eax,%esi
+			if (acode == 0 || a >= ni->ni_pool)
+  1052f6:	85 ff                	test   %edi,%edi
+  1052f8:	0f 84 cb 02 00 00    	je     1055c9 <nameidx_entries+0x418>
+  1052fe:	8b 45 a8             	mov    -0x58(%ebp),%eax
+  105301:	3b 70 24             	cmp    0x24(%eax),%esi
+  105304:	0f 83 cc 02 00 00    	jae    1055d6 <nameidx_entries+0x425>
+	count = 0;
+  10530a:	b8 00 00 00 00       	mov    $0x0,%eax
+	result = 0;
+  10530f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  105314:	89 75 b4             	mov    %esi,-0x4c(%ebp)
+  105317:	89 7d b0             	mov    %edi,-0x50(%ebp)
+  10531a:	89 ce                	mov    %ecx,%esi
+  10531c:	89 c7                	mov    %eax,%edi
+		byte = *addr;
+  10531e:	8b 5d b4             	mov    -0x4c(%ebp),%ebx
+  105321:	0f b6 1c 03          	movzbl (%ebx,%eax,1),%ebx
+		count++;
+  105325:	83 c0 01             	add    $0x1,%eax
+		result |= (byte & 0x7f) << shift;
+  105328:	89 da                	mov    %ebx,%edx
+  10532a:	83 e2 7f             	and    $0x7f,%edx
+  10532d:	8d 0c fd 00 00 00 00 	lea    0x0(,%edi,8),%ecx
+  105334:	29 f9                	sub    %edi,%ecx
+  105336:	d3 e2                	shl    %cl,%edx
+  105338:	09 d6                	or     %edx,%esi
+		if (!(byte & 0x80))
+  10533a:	84 db                	test   %bl,%bl
+  10533c:	78 de                	js     10531c <nameidx_entries+0x16b>
+			a += dwarf_read_uleb128(a, &tag);
+  10533e:	8b 7d b0             	mov    -0x50(%ebp),%edi
+  105341:	89 75 b0             	mov    %esi,-0x50(%ebp)
+  105344:	8b 75 b4             	mov    -0x4c(%ebp),%esi
+  105347:	01 f0                	add    %esi,%eax
+  105349:	89 45 b4             	mov    %eax,-0x4c(%ebp)
+			if (acode == code)
+  10534c:	39 7d a4             	cmp    %edi,-0x5c(%ebp)
+  10534f:	0f 85 f3 fe ff ff    	jne    105248 <nameidx_entries+0x97>
+		e += dwarf_read_uleb128(e, &code);
+  105355:	8b 45 a0             	mov    -0x60(%ebp),%eax
+  105358:	01 45 ac             	add    %eax,-0x54(%ebp)
+		}
+
+		// A lone CU needs no index.  Offset 0 is a unit header, so
+		// never that of a DIE.
+		cu_index = die_offset = 0;
+  10535b:	c7 45 9c 00 00 00 00 	movl   $0x0,-0x64(%ebp)
+  105362:	c7 45 a0 00 00 00 00 	movl   $0x0,-0x60(%ebp)
+  105369:	eb 50                	jmp    1053bb <nameidx_entries+0x20a>
+	count = 0;
+  10536b:	ba 00 00 00 00       	mov    $0x0,%edx
+	shift = 0;
+  105370:	b9 00 00 00 00       	mov    $0x0,%ecx
+	result = 0;
+  105375:	bf 00 00 00 00       	mov    $0x0,%edi
+  10537a:	8b 75 b4             	mov    -0x4c(%ebp),%esi
+		byte = *addr;
+  10537d:	0f b6 1c 16          	movzbl (%esi,%edx,1),%ebx
+		result |= (byte & 0x7f) << shift;
+  105381:	89 d8                	mov    %ebx,%eax
+  105383:	83 e0 7f             	and    $0x7f,%eax
+  105386:	d3 e0                	shl    %cl,%eax
+  105388:	09 c7                	or     %eax,%edi
+		shift += 7;
+  10538a:	83 c1 07             	add    $0x7,%ecx
+		count++;
+  10538d:	83 c2 01             	add    $0x1,%edx
+		if (!(byte & 0x80))
+  105390:	84 db                	test   %bl,%bl
+  105392:	78 e9                	js     10537d <nameidx_entries+0x1cc>
+	if ((shift < num_bits) && (byte & 0x40))
+  105394:	8b 75 a4             	mov    -0x5c(%ebp),%esi
+  105397:	83 f9 1f             	cmp    $0x1f,%ecx
+  10539a:	7f 0e                	jg     1053aa <nameidx_entries+0x1f9>
+  10539c:	f6 c3 40             	test   $0x40,%bl
+  10539f:	74 09                	je     1053aa <nameidx_entries+0x1f9>
+		result |= (-1U << shift);
+  1053a1:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  1053a6:	d3 e0                	shl    %cl,%eax
+  1053a8:	09 c7                	or     %eax,%edi
+			a += dwarf_read_uleb128(a, &form);
+			if (idx == 0 && form == 0)
+				break;
+			val = 0;
+			if (form == DW_FORM_implicit_const) {
+				a += dwarf_read_leb128(a, &value);
+  1053aa:	01 55 b4             	add    %edx,-0x4c(%ebp)
+				val = value;
+  1053ad:	89 7d c8             	mov    %edi,-0x38(%ebp)
+  1053b0:	e9 a7 00 00 00       	jmp    10545c <nameidx_entries+0x2ab>
+			} else
+				e += dwarf_read_abbrev_entry(e, form, &val, sizeof(val),
+							     sizeof(uint32_t));
+			if (idx == DW_IDX_compile_unit)
+				cu_index = val;
+  1053b5:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  1053b8:	89 45 a0             	mov    %eax,-0x60(%ebp)
+	count = 0;
+  1053bb:	b8 00 00 00 00       	mov    $0x0,%eax
+	result = 0;
+  1053c0:	be 00 00 00 00       	mov    $0x0,%esi
+  1053c5:	89 c7                	mov    %eax,%edi
+		byte = *addr;
+  1053c7:	8b 4d b4             	mov    -0x4c(%ebp),%ecx
+  1053ca:	0f b6 1c 01          	movzbl (%ecx,%eax,1),%ebx
+		count++;
+  1053ce:	83 c0 01             	add    $0x1,%eax
+		result |= (byte & 0x7f) << shift;
+  1053d1:	89 da                	mov    %ebx,%edx
+  1053d3:	83 e2 7f             	and    $0x7f,%edx
+  1053d6:	8d 0c fd 00 00 00 00 	lea    0x0(,%edi,8),%ecx
+  1053dd:	29 f9                	sub    %edi,%ecx
+  1053df:	d3 e2                	shl    %cl,%edx
+  1053e1:	09 d6                	or     %edx,%esi
+		if (!(byte & 0x80))
+  1053e3:	84 db                	test   %bl,%bl
+  1053e5:	78 de                	js     1053c5 <nameidx_entries+0x214>
+			a += dwarf_read_uleb128(a, &idx);
+  1053e7:	8b 7d b4             	mov    -0x4c(%ebp),%edi
+  1053ea:	01 c7                	add    %eax,%edi
+  1053ec:	89 7d b4             	mov    %edi,-0x4c(%ebp)
+	count = 0;
+  1053ef:	b8 00 00 00 00       	mov    $0x0,%eax
+	result = 0;
+  1053f4:	bf 00 00 00 00       	mov    $0x0,%edi
+  1053f9:	89 75 a4             	mov    %esi,-0x5c(%ebp)
+  1053fc:	89 c6                	mov    %eax,%esi
+		byte = *addr;
+  1053fe:	8b 5d b4             	mov    -0x4c(%ebp),%ebx
+  105401:	0f b6 1c 03          	movzbl (%ebx,%eax,1),%ebx
+		count++;
+  105405:	83 c0 01             	add    $0x1,%eax
+		result |= (byte & 0x7f) << shift;
+  105408:	89 da                	mov    %ebx,%edx
+  10540a:	83 e2 7f             	and    $0x7f,%edx
+  10540d:	8d 0c f5 00 00 00 00 	lea    0x0(,%esi,8),%ecx
+  105414:	29 f1                	sub    %esi,%ecx
+  105416:	d3 e2                	shl    %cl,%edx
+  105418:	09 d7                	or     %edx,%edi
+		if (!(byte & 0x80))
+  10541a:	84 db                	test   %bl,%bl
+  10541c:	78 de                	js     1053fc <nameidx_entries+0x24b>
+			a += dwarf_read_uleb128(a, &form);
+  10541e:	8b 75 a4             	mov    -0x5c(%ebp),%esi
+  105421:	8b 4d b4             	mov    -0x4c(%ebp),%ecx
+  105424:	01 c1                	add    %eax,%ecx
+  105426:	89 4d b4             	mov    %ecx,-0x4c(%ebp)
+			if (idx == 0 && form == 0)
+  105429:	89 f8                	mov    %edi,%eax
+  10542b:	09 f0                	or     %esi,%eax
+  10542d:	74 5d                	je     10548c <nameidx_entries+0x2db>
+			val = 0;
+  10542f:	c7 45 c8 00 00 00 00 	movl   $0x0,-0x38(%ebp)
+			if (form == DW_FORM_implicit_const) {
+  105436:	83 ff 21             	cmp    $0x21,%edi
+  105439:	0f 84 2c ff ff ff    	je     10536b <nameidx_entries+0x1ba>
+				e += dwarf_read_abbrev_entry(e, form, &val, sizeof(val),
+  10543f:	83 ec 0c             	sub    $0xc,%esp
+  105442:	6a 04                	push   $0x4
+  105444:	6a 04                	push   $0x4
+  105446:	8d 45 c8             	lea    -0x38(%ebp),%eax
+  105449:	50                   	push   %eax
+  10544a:	57                   	push   %edi
+  10544b:	8b 7d ac             	mov    -0x54(%ebp),%edi
+  10544e:	57                   	push   %edi
+  10544f:	e8 5b b4 ff ff       	call   1008af <dwarf_read_abbrev_entry>
+  105454:	01 c7                	add    %eax,%edi
+  105456:	89 7d ac             	mov    %edi,-0x54(%ebp)
+  105459:	83 c4 20             	add    $0x20,%esp
+			if (idx == DW_IDX_compile_unit)
+  10545c:	83 fe 01             	cmp    $0x1,%esi
+  10545f:	0f 84 50 ff ff ff    	je     1053b5 <nameidx_entries+0x204>
+			else if (idx == DW_IDX_die_offset)
+  105465:	83 fe 03             	cmp    $0x3,%esi
+  105468:	74 17                	je     105481 <nameidx_entries+0x2d0>
+				die_offset = val;
+			else if (idx == DW_IDX_type_unit)
+  10546a:	83 fe 02             	cmp    $0x2,%esi
+  10546d:	0f 85 48 ff ff ff    	jne    1053bb <nameidx_entries+0x20a>
+				// Not in .debug_info's CUs
+				cu_index = ni->ni_ncus;
+  105473:	8b 45 a8             	mov    -0x58(%ebp),%eax
+  105476:	8b 40 04             	mov    0x4(%eax),%eax
+  105479:	89 45 a0             	mov    %eax,-0x60(%ebp)
+  10547c:	e9 3a ff ff ff       	jmp    1053bb <nameidx_entries+0x20a>
+				die_offset = val;
+  105481:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  105484:	89 45 9c             	mov    %eax,-0x64(%ebp)
+  105487:	e9 2f ff ff ff       	jmp    1053bb <nameidx_entries+0x20a>
+		}
+
+		if ((tag != DW_TAG_subprogram && tag != DW_TAG_label)
+  10548c:	89 c6                	mov    %eax,%esi
+  10548e:	8b 45 b0             	mov    -0x50(%ebp),%eax
+  105491:	83 f8 2e             	cmp    $0x2e,%eax
+  105494:	0f 95 c2             	setne  %dl
+  105497:	83 f8 0a             	cmp    $0xa,%eax
+  10549a:	0f 95 c0             	setne  %al
+		    || die_offset == 0 || cu_index >= ni->ni_ncus)
+  10549d:	84 c2                	test   %al,%dl
+  10549f:	0f 85 39 fd ff ff    	jne    1051de <nameidx_entries+0x2d>
+  1054a5:	83 7d 9c 00          	cmpl   $0x0,-0x64(%ebp)
+  1054a9:	0f 84 2f fd ff ff    	je     1051de <nameidx_entries+0x2d>
+  1054af:	8b 45 a8             	mov    -0x58(%ebp),%eax
+  1054b2:	8b 7d a0             	mov    -0x60(%ebp),%edi
+  1054b5:	3b 78 04             	cmp    0x4(%eax),%edi
+  1054b8:	0f 83 20 fd ff ff    	jae    1051de <nameidx_entries+0x2d>
+			continue;
+		if (dwarf_cu_get(addrs, get_unaligned(ni->ni_cus + 4 * cu_index,
+  1054be:	83 ec 04             	sub    $0x4,%esp
+  1054c1:	6a 04                	push   $0x4
+  1054c3:	8b 00                	mov    (%eax),%eax
+  1054c5:	8d 04 b8             	lea    (%eax,%edi,4),%eax
+  1054c8:	50                   	push   %eax
+  1054c9:	8d 45 c4             	lea    -0x3c(%ebp),%eax
+  1054cc:	50                   	push   %eax
+  1054cd:	e8 26 3d 00 00       	call   1091f8 <memcpy>
+  1054d2:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  1054d5:	50                   	push   %eax
+  1054d6:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+  1054d9:	ba 00 00 00 00       	mov    $0x0,%edx
+  1054de:	52                   	push   %edx
+  1054df:	50                   	push   %eax
+  1054e0:	ff 75 98             	push   -0x68(%ebp)
+  1054e3:	e8 09 16 00 00       	call   106af1 <dwarf_cu_get>
+  1054e8:	83 c4 20             	add    $0x20,%esp
+  1054eb:	85 c0                	test   %eax,%eax
+  1054ed:	0f 88 ea 00 00 00    	js     1055dd <nameidx_entries+0x42c>
+						      uint32_t), &ci) < 0)
+			return -E_BAD_DWARF;
+		die = ci->ci_cu.cu_hdr + die_offset;
+  1054f3:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  1054f6:	8b 45 9c             	mov    -0x64(%ebp),%eax
+  1054f9:	03 43 08             	add    0x8(%ebx),%eax
+  1054fc:	89 45 b4             	mov    %eax,-0x4c(%ebp)
+	count = 0;
+  1054ff:	bf 00 00 00 00       	mov    $0x0,%edi
+  105504:	89 fa                	mov    %edi,%edx
+		byte = *addr;
+  105506:	8b 45 b4             	mov    -0x4c(%ebp),%eax
+  105509:	0f b6 04 38          	movzbl (%eax,%edi,1),%eax
+		count++;
+  10550d:	83 c7 01             	add    $0x1,%edi
+		result |= (byte & 0x7f) << shift;
+  105510:	89 c1                	mov    %eax,%ecx
+  105512:	83 e1 7f             	and    $0x7f,%ecx
+  105515:	89 4d a4             	mov    %ecx,-0x5c(%ebp)
+  105518:	8d 0c d5 00 00 00 00 	lea    0x0(,%edx,8),%ecx
+  10551f:	29 d1                	sub    %edx,%ecx
+  105521:	8b 55 a4             	mov    -0x5c(%ebp),%edx
+  105524:	d3 e2                	shl    %cl,%edx
+  105526:	09 d6                	or     %edx,%esi
+		if (!(byte & 0x80))
+  105528:	84 c0                	test   %al,%al
+  10552a:	78 d8                	js     105504 <nameidx_entries+0x353>
+		entry = die + dwarf_read_uleb128(die, &code);
+  10552c:	8b 45 b4             	mov    -0x4c(%ebp),%eax
+  10552f:	01 c7                	add    %eax,%edi
+  105531:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+		if (!(ab = dwarf_abbrev(ci->ci_abbrevs, code)))
+  105534:	8b 4b 34             	mov    0x34(%ebx),%ecx
+	if (code >= at->at_ncodes || !at->at_abbrevs[code].ab_attrs)
+  105537:	3b 71 08             	cmp    0x8(%ecx),%esi
+  10553a:	0f 83 a4 00 00 00    	jae    1055e4 <nameidx_entries+0x433>
+  105540:	8d 14 b6             	lea    (%esi,%esi,4),%edx
+  105543:	8b 41 0c             	mov    0xc(%ecx),%eax
+  105546:	8d 04 90             	lea    (%eax,%edx,4),%eax
+  105549:	83 78 04 00          	cmpl   $0x0,0x4(%eax)
+  10554d:	0f 84 98 00 00 00    	je     1055eb <nameidx_entries+0x43a>
+			return -E_BAD_DWARF;
+		// Declarations have no address; the definition has its own entry.
+		// An abstract instance has none either, but its out-of-line
+		// copy need not have an entry.
+		if (die_read(addrs, &ci->ci_cu, ci->ci_abbrevs, ab, entry, &f,
+  105553:	83 c3 08             	add    $0x8,%ebx
+  105556:	83 ec 0c             	sub    $0xc,%esp
+  105559:	8d 55 e4             	lea    -0x1c(%ebp),%edx
+  10555c:	52                   	push   %edx
+  10555d:	6a 00                	push   $0x0
+  10555f:	8d 55 cc             	lea    -0x34(%ebp),%edx
+  105562:	52                   	push   %edx
+  105563:	57                   	push   %edi
+  105564:	50                   	push   %eax
+  105565:	89 da                	mov    %ebx,%edx
+  105567:	8b 45 98             	mov    -0x68(%ebp),%eax
+  10556a:	e8 88 f0 ff ff       	call   1045f7 <die_read>
+  10556f:	83 c4 20             	add    $0x20,%esp
+  105572:	84 c0                	test   %al,%al
+  105574:	75 36                	jne    1055ac <nameidx_entries+0x3fb>
+			     NULL, &entry)) {
+			*addr = f.fn_low;
+			return 0;
+		}
+		if (tag == DW_TAG_subprogram
+  105576:	83 7d b0 2e          	cmpl   $0x2e,-0x50(%ebp)
+  10557a:	0f 85 5e fc ff ff    	jne    1051de <nameidx_entries+0x2d>
+		    && die_concrete(addrs, &ci->ci_cu, ci->ci_abbrevs, die, addr))
+  105580:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  105583:	8b 48 34             	mov    0x34(%eax),%ecx
+  105586:	8d 50 08             	lea    0x8(%eax),%edx
+  105589:	83 ec 08             	sub    $0x8,%esp
+  10558c:	ff 75 08             	push   0x8(%ebp)
+  10558f:	ff 75 b4             	push   -0x4c(%ebp)
+  105592:	8b 45 98             	mov    -0x68(%ebp),%eax
+  105595:	e8 66 fa ff ff       	call   105000 <die_concrete>
+  10559a:	83 c4 10             	add    $0x10,%esp
+  10559d:	84 c0                	test   %al,%al
+  10559f:	0f 84 39 fc ff ff    	je     1051de <nameidx_entries+0x2d>
+			return 0;
+  1055a5:	b8 00 00 00 00       	mov    $0x0,%eax
+  1055aa:	eb 22                	jmp    1055ce <nameidx_entries+0x41d>
+			*addr = f.fn_low;
+  1055ac:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  1055af:	8b 75 08             	mov    0x8(%ebp),%esi
+  1055b2:	89 06                	mov    %eax,(%esi)
+			return 0;
+  1055b4:	b8 00 00 00 00       	mov    $0x0,%eax
+  1055b9:	eb 13                	jmp    1055ce <nameidx_entries+0x41d>
+	}
+	return -E_NO_ENT;
+  1055bb:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  1055c0:	eb 0c                	jmp    1055ce <nameidx_entries+0x41d>
+  1055c2:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  1055c7:	eb 05                	jmp    1055ce <nameidx_entries+0x41d>
+				return -E_BAD_DWARF;
+  1055c9:	b8 fa ff ff ff       	mov    $0xfffffffa,%eax
+}
+  1055ce:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  1055d1:	5b                   	pop    %ebx
+  1055d2:	5e                   	pop    %esi
+  1055d3:	5f                   	pop    %edi
+  1055d4:	5d                   	pop    %ebp
+  1055d5:	c3                   	ret
+				return -E_BAD_DWARF;
+  1055d6:	b8 fa ff ff ff       	mov    $0xfffffffa,%eax
+  1055db:	eb f1                	jmp    1055ce <nameidx_entries+0x41d>
+			return -E_BAD_DWARF;
+  1055dd:	b8 fa ff ff ff       	mov    $0xfffffffa,%eax
+  1055e2:	eb ea                	jmp    1055ce <nameidx_entries+0x41d>
+			return -E_BAD_DWARF;
+  1055e4:	b8 fa ff ff ff       	mov    $0xfffffffa,%eax
+  1055e9:	eb e3                	jmp    1055ce <nameidx_entries+0x41d>
+  1055eb:	b8 fa ff ff ff       	mov    $0xfffffffa,%eax
+  1055f0:	eb dc                	jmp    1055ce <nameidx_entries+0x41d>
+
+001055f2 <names_count_die>:
+{
+  1055f2:	55                   	push   %ebp
+  1055f3:	89 e5                	mov    %esp,%ebp
+	if (f->fn_name)
+  1055f5:	8b 45 0c             	mov    0xc(%ebp),%eax
+  1055f8:	83 78 08 00          	cmpl   $0x0,0x8(%eax)
+  1055fc:	74 07                	je     105605 <names_count_die+0x13>
+	nnames++;
+  1055fe:	83 05 10 e3 11 00 01 	addl   $0x1,0x11e310
+}
+  105605:	5d                   	pop    %ebp
+  105606:	c3                   	ret
+
+00105607 <dwarf_alloc>:
+{
+  105607:	55                   	push   %ebp
+  105608:	89 e5                	mov    %esp,%ebp
+  10560a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	arena_next = ROUNDUP(arena_next, sizeof(uint32_t));
+  10560d:	a1 24 53 11 00       	mov    0x115324,%eax
+  105612:	83 c0 03             	add    $0x3,%eax
+  105615:	83 e0 fc             	and    $0xfffffffc,%eax
+	if (n > DWARF_ARENA_END - arena_next)
+  105618:	ba 00 00 40 00       	mov    $0x400000,%edx
+  10561d:	29 c2                	sub    %eax,%edx
+  10561f:	39 ca                	cmp    %ecx,%edx
+  105621:	72 17                	jb     10563a <dwarf_alloc+0x33>
+	p = (void *) arena_next;
+  105623:	89 c2                	mov    %eax,%edx
+	arena_next += n;
+  105625:	01 c8                	add    %ecx,%eax
+  105627:	a3 24 53 11 00       	mov    %eax,0x115324
+	dwarf_stats.dws_arena_used = arena_next - (uintptr_t) __DEBUG_END__;
+  10562c:	2d 00 d0 14 00       	sub    $0x14d000,%eax
+  105631:	a3 60 e2 11 00       	mov    %eax,0x11e260
+}
+  105636:	89 d0                	mov    %edx,%eax
+  105638:	5d                   	pop    %ebp
+  105639:	c3                   	ret
+	arena_next = ROUNDUP(arena_next, sizeof(uint32_t));
+  10563a:	a3 24 53 11 00       	mov    %eax,0x115324
+		return NULL;
+  10563f:	ba 00 00 00 00       	mov    $0x0,%edx
+  105644:	eb f0                	jmp    105636 <dwarf_alloc+0x2f>
+
+00105646 <dwarf_aranges_lookup>:
+{
+  105646:	55                   	push   %ebp
+  105647:	89 e5                	mov    %esp,%ebp
+  105649:	57                   	push   %edi
+  10564a:	56                   	push   %esi
+  10564b:	53                   	push   %ebx
+  10564c:	83 ec 1c             	sub    $0x1c,%esp
+  10564f:	8b 75 0c             	mov    0xc(%ebp),%esi
+  105652:	0f 31                	rdtsc
+  105654:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  105657:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+	if (!aranges_built)
+  10565a:	80 3d 40 e3 11 00 00 	cmpb   $0x0,0x11e340
+  105661:	74 39                	je     10569c <dwarf_aranges_lookup+0x56>
+	hi = naranges;
+  105663:	8b 15 44 e3 11 00    	mov    0x11e344,%edx
+		if (aranges[mid].ar_start <= p)
+  105669:	8b 3d 48 e3 11 00    	mov    0x11e348,%edi
+	int lo = 0, hi, mid, r = -E_BAD_DWARF;
+  10566f:	b9 00 00 00 00       	mov    $0x0,%ecx
+	while (lo < hi) {
+  105674:	39 d1                	cmp    %edx,%ecx
+  105676:	0f 8d ba 00 00 00    	jge    105736 <dwarf_aranges_lookup+0xf0>
+		mid = (lo + hi) / 2;
+  10567c:	8d 1c 11             	lea    (%ecx,%edx,1),%ebx
+  10567f:	89 d8                	mov    %ebx,%eax
+  105681:	c1 e8 1f             	shr    $0x1f,%eax
+  105684:	01 d8                	add    %ebx,%eax
+  105686:	89 c3                	mov    %eax,%ebx
+  105688:	d1 fb                	sar    %ebx
+		if (aranges[mid].ar_start <= p)
+  10568a:	83 e0 fe             	and    $0xfffffffe,%eax
+  10568d:	01 d8                	add    %ebx,%eax
+  10568f:	3b 34 87             	cmp    (%edi,%eax,4),%esi
+  105692:	0f 83 96 00 00 00    	jae    10572e <dwarf_aranges_lookup+0xe8>
+		mid = (lo + hi) / 2;
+  105698:	89 da                	mov    %ebx,%edx
+  10569a:	eb d8                	jmp    105674 <dwarf_aranges_lookup+0x2e>
+  10569c:	0f 31                	rdtsc
+  10569e:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  1056a1:	89 55 dc             	mov    %edx,-0x24(%ebp)
+	aranges_built = 1;
+  1056a4:	c6 05 40 e3 11 00 01 	movb   $0x1,0x11e340
+	naranges = 0;
+  1056ab:	c7 05 44 e3 11 00 00 	movl   $0x0,0x11e344
+  1056b2:	00 00 00 
+	if (aranges_walk(addrs, aranges_count) < 0
+  1056b5:	ba 53 43 10 00       	mov    $0x104353,%edx
+  1056ba:	8b 45 08             	mov    0x8(%ebp),%eax
+  1056bd:	e8 85 f5 ff ff       	call   104c47 <aranges_walk>
+  1056c2:	85 c0                	test   %eax,%eax
+  1056c4:	78 59                	js     10571f <dwarf_aranges_lookup+0xd9>
+	    || !(aranges = dwarf_alloc(naranges * sizeof(*aranges)))) {
+  1056c6:	83 ec 0c             	sub    $0xc,%esp
+  1056c9:	a1 44 e3 11 00       	mov    0x11e344,%eax
+  1056ce:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  1056d1:	c1 e0 02             	shl    $0x2,%eax
+  1056d4:	50                   	push   %eax
+  1056d5:	e8 2d ff ff ff       	call   105607 <dwarf_alloc>
+  1056da:	a3 48 e3 11 00       	mov    %eax,0x11e348
+  1056df:	83 c4 10             	add    $0x10,%esp
+  1056e2:	85 c0                	test   %eax,%eax
+  1056e4:	74 39                	je     10571f <dwarf_aranges_lookup+0xd9>
+	naranges = 0;
+  1056e6:	c7 05 44 e3 11 00 00 	movl   $0x0,0x11e344
+  1056ed:	00 00 00 
+	aranges_walk(addrs, aranges_add);
+  1056f0:	ba 5b 43 10 00       	mov    $0x10435b,%edx
+  1056f5:	8b 45 08             	mov    0x8(%ebp),%eax
+  1056f8:	e8 4a f5 ff ff       	call   104c47 <aranges_walk>
+	dwarf_stats.dws_naranges = naranges;
+  1056fd:	a1 44 e3 11 00       	mov    0x11e344,%eax
+  105702:	a3 64 e2 11 00       	mov    %eax,0x11e264
+  105707:	0f 31                	rdtsc
+	dwarf_stats.dws_aranges_build = read_tsc() - tsc;
+  105709:	2b 45 d8             	sub    -0x28(%ebp),%eax
+  10570c:	1b 55 dc             	sbb    -0x24(%ebp),%edx
+  10570f:	a3 68 e2 11 00       	mov    %eax,0x11e268
+  105714:	89 15 6c e2 11 00    	mov    %edx,0x11e26c
+  10571a:	e9 44 ff ff ff       	jmp    105663 <dwarf_aranges_lookup+0x1d>
+		naranges = 0;
+  10571f:	c7 05 44 e3 11 00 00 	movl   $0x0,0x11e344
+  105726:	00 00 00 
+		return;
+  105729:	e9 35 ff ff ff       	jmp    105663 <dwarf_aranges_lookup+0x1d>
+			lo = mid + 1;
+  10572e:	8d 4b 01             	lea    0x1(%ebx),%ecx
+  105731:	e9 3e ff ff ff       	jmp    105674 <dwarf_aranges_lookup+0x2e>
+	if (lo > 0 && p <= aranges[lo - 1].ar_end) {
+  105736:	85 c9                	test   %ecx,%ecx
+  105738:	7e 55                	jle    10578f <dwarf_aranges_lookup+0x149>
+  10573a:	8d 04 49             	lea    (%ecx,%ecx,2),%eax
+  10573d:	8d 44 87 f4          	lea    -0xc(%edi,%eax,4),%eax
+  105741:	39 70 04             	cmp    %esi,0x4(%eax)
+  105744:	72 50                	jb     105796 <dwarf_aranges_lookup+0x150>
+		*store = aranges[lo - 1].ar_cu;
+  105746:	8b 55 10             	mov    0x10(%ebp),%edx
+  105749:	8b 40 08             	mov    0x8(%eax),%eax
+  10574c:	89 02                	mov    %eax,(%edx)
+  10574e:	c7 42 04 00 00 00 00 	movl   $0x0,0x4(%edx)
+		r = 0;
+  105755:	b9 00 00 00 00       	mov    $0x0,%ecx
+	dwarf_stats.dws_arange_lookups++;
+  10575a:	83 05 70 e2 11 00 01 	addl   $0x1,0x11e270
+  105761:	0f 31                	rdtsc
+	dwarf_stats.dws_arange_cycles += read_tsc() - tsc;
+  105763:	8b 35 74 e2 11 00    	mov    0x11e274,%esi
+  105769:	8b 3d 78 e2 11 00    	mov    0x11e278,%edi
+  10576f:	2b 75 e0             	sub    -0x20(%ebp),%esi
+  105772:	1b 7d e4             	sbb    -0x1c(%ebp),%edi
+  105775:	01 c6                	add    %eax,%esi
+  105777:	11 d7                	adc    %edx,%edi
+  105779:	89 35 74 e2 11 00    	mov    %esi,0x11e274
+  10577f:	89 3d 78 e2 11 00    	mov    %edi,0x11e278
+}
+  105785:	89 c8                	mov    %ecx,%eax
+  105787:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  10578a:	5b                   	pop    %ebx
+  10578b:	5e                   	pop    %esi
+  10578c:	5f                   	pop    %edi
+  10578d:	5d                   	pop    %ebp
+  10578e:	c3                   	ret
+	int lo = 0, hi, mid, r = -E_BAD_DWARF;
+  10578f:	b9 fa ff ff ff       	mov    $0xfffffffa,%ecx
+  105794:	eb c4                	jmp    10575a <dwarf_aranges_lookup+0x114>
+  105796:	b9 fa ff ff ff       	mov    $0xfffffffa,%ecx
+  10579b:	eb bd                	jmp    10575a <dwarf_aranges_lookup+0x114>
+
+0010579d <dwarf_abbrevs>:
+{
+  10579d:	55                   	push   %ebp
+  10579e:	89 e5                	mov    %esp,%ebp
+  1057a0:	57                   	push   %edi
+  1057a1:	56                   	push   %esi
+  1057a2:	53                   	push   %ebx
+  1057a3:	83 ec 4c             	sub    $0x4c,%esp
+  1057a6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  1057a9:	8b 75 0c             	mov    0xc(%ebp),%esi
+  1057ac:	8b 7d 10             	mov    0x10(%ebp),%edi
+  1057af:	89 75 b8             	mov    %esi,-0x48(%ebp)
+  1057b2:	89 7d bc             	mov    %edi,-0x44(%ebp)
+	for (at = abbrevtabs; at; at = at->at_next)
+  1057b5:	a1 3c e3 11 00       	mov    0x11e33c,%eax
+  1057ba:	89 c3                	mov    %eax,%ebx
+  1057bc:	85 db                	test   %ebx,%ebx
+  1057be:	74 16                	je     1057d6 <dwarf_abbrevs+0x39>
+		if (at->at_offset == offset)
+  1057c0:	89 f0                	mov    %esi,%eax
+  1057c2:	89 fa                	mov    %edi,%edx
+  1057c4:	33 03                	xor    (%ebx),%eax
+  1057c6:	33 53 04             	xor    0x4(%ebx),%edx
+  1057c9:	09 d0                	or     %edx,%eax
+  1057cb:	0f 84 bd 04 00 00    	je     105c8e <dwarf_abbrevs+0x4f1>
+	for (at = abbrevtabs; at; at = at->at_next)
+  1057d1:	8b 5b 10             	mov    0x10(%ebx),%ebx
+  1057d4:	eb e6                	jmp    1057bc <dwarf_abbrevs+0x1f>
+	if (offset >= addrs->abbrev_end - addrs->abbrev_begin)
+  1057d6:	89 5d c8             	mov    %ebx,-0x38(%ebp)
+  1057d9:	8b 79 04             	mov    0x4(%ecx),%edi
+  1057dc:	89 7d c4             	mov    %edi,-0x3c(%ebp)
+  1057df:	8b 01                	mov    (%ecx),%eax
+  1057e1:	29 c7                	sub    %eax,%edi
+  1057e3:	89 fa                	mov    %edi,%edx
+  1057e5:	89 fb                	mov    %edi,%ebx
+  1057e7:	c1 fb 1f             	sar    $0x1f,%ebx
+  1057ea:	8b 75 b8             	mov    -0x48(%ebp),%esi
+  1057ed:	8b 7d bc             	mov    -0x44(%ebp),%edi
+  1057f0:	39 d6                	cmp    %edx,%esi
+  1057f2:	89 fa                	mov    %edi,%edx
+  1057f4:	19 da                	sbb    %ebx,%edx
+  1057f6:	0f 83 95 04 00 00    	jae    105c91 <dwarf_abbrevs+0x4f4>
+	const char *p, *start = (const char *) addrs->abbrev_begin + offset;
+  1057fc:	89 f7                	mov    %esi,%edi
+  1057fe:	01 c7                	add    %eax,%edi
+  105800:	89 7d e0             	mov    %edi,-0x20(%ebp)
+  105803:	0f 31                	rdtsc
+  105805:	89 45 b0             	mov    %eax,-0x50(%ebp)
+  105808:	89 55 b4             	mov    %edx,-0x4c(%ebp)
+	for (p = start; p < end; ) {
+  10580b:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+	unsigned code = 1, tag, name, form, maxcode = 0, nattrs = 0, nsteps = 0;
+  10580e:	c7 45 d0 01 00 00 00 	movl   $0x1,-0x30(%ebp)
+  105815:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+  10581c:	bf 00 00 00 00       	mov    $0x0,%edi
+  105821:	bb 00 00 00 00       	mov    $0x0,%ebx
+  105826:	89 5d cc             	mov    %ebx,-0x34(%ebp)
+  105829:	89 7d d8             	mov    %edi,-0x28(%ebp)
+	for (p = start; p < end; ) {
+  10582c:	8b 7d c4             	mov    -0x3c(%ebp),%edi
+  10582f:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+  105832:	0f 83 2d 01 00 00    	jae    105965 <dwarf_abbrevs+0x1c8>
+	count = 0;
+  105838:	b8 00 00 00 00       	mov    $0x0,%eax
+	result = 0;
+  10583d:	be 00 00 00 00       	mov    $0x0,%esi
+  105842:	89 c7                	mov    %eax,%edi
+		byte = *addr;
+  105844:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  105847:	0f b6 1c 03          	movzbl (%ebx,%eax,1),%ebx
+		count++;
+  10584b:	83 c0 01             	add    $0x1,%eax
+		result |= (byte & 0x7f) << shift;
+  10584e:	89 da                	mov    %ebx,%edx
+  105850:	83 e2 7f             	and    $0x7f,%edx
+  105853:	8d 0c fd 00 00 00 00 	lea    0x0(,%edi,8),%ecx
+  10585a:	29 f9                	sub    %edi,%ecx
+  10585c:	d3 e2                	shl    %cl,%edx
+  10585e:	09 d6                	or     %edx,%esi
+		if (!(byte & 0x80))
+  105860:	84 db                	test   %bl,%bl
+  105862:	78 de                	js     105842 <dwarf_abbrevs+0xa5>
+		p += dwarf_read_uleb128(p, &code);
+  105864:	89 75 d0             	mov    %esi,-0x30(%ebp)
+  105867:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  10586a:	01 c7                	add    %eax,%edi
+  10586c:	89 f8                	mov    %edi,%eax
+		if (code == 0)
+  10586e:	85 f6                	test   %esi,%esi
+  105870:	0f 84 ef 00 00 00    	je     105965 <dwarf_abbrevs+0x1c8>
+	count = 0;
+  105876:	ba 00 00 00 00       	mov    $0x0,%edx
+		byte = *addr;
+  10587b:	89 d1                	mov    %edx,%ecx
+		count++;
+  10587d:	83 c2 01             	add    $0x1,%edx
+		if (!(byte & 0x80))
+  105880:	80 3c 08 00          	cmpb   $0x0,(%eax,%ecx,1)
+  105884:	78 f5                	js     10587b <dwarf_abbrevs+0xde>
+		p++;
+  105886:	8d 44 08 02          	lea    0x2(%eax,%ecx,1),%eax
+  10588a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		maxcode = MAX(maxcode, code);
+  10588d:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  105890:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  105893:	39 f8                	cmp    %edi,%eax
+  105895:	0f 42 c7             	cmovb  %edi,%eax
+  105898:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  10589b:	eb 39                	jmp    1058d6 <dwarf_abbrevs+0x139>
+	count = 0;
+  10589d:	b8 00 00 00 00       	mov    $0x0,%eax
+  1058a2:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+		byte = *addr;
+  1058a5:	0f b6 14 01          	movzbl (%ecx,%eax,1),%edx
+		count++;
+  1058a9:	83 c0 01             	add    $0x1,%eax
+		if (!(byte & 0x80))
+  1058ac:	84 d2                	test   %dl,%dl
+  1058ae:	78 f5                	js     1058a5 <dwarf_abbrevs+0x108>
+				p += dwarf_read_leb128(p, &value);
+  1058b0:	01 45 e4             	add    %eax,-0x1c(%ebp)
+			if (form_size(form) < 0)
+  1058b3:	89 d8                	mov    %ebx,%eax
+  1058b5:	e8 f5 ea ff ff       	call   1043af <form_size>
+  1058ba:	85 c0                	test   %eax,%eax
+  1058bc:	78 06                	js     1058c4 <dwarf_abbrevs+0x127>
+			nattrs++;
+  1058be:	83 45 d8 01          	addl   $0x1,-0x28(%ebp)
+		} while (name != 0 || form != 0);
+  1058c2:	eb 12                	jmp    1058d6 <dwarf_abbrevs+0x139>
+				nsteps++;
+  1058c4:	83 45 d4 01          	addl   $0x1,-0x2c(%ebp)
+			nattrs++;
+  1058c8:	83 45 d8 01          	addl   $0x1,-0x28(%ebp)
+		} while (name != 0 || form != 0);
+  1058cc:	89 d8                	mov    %ebx,%eax
+  1058ce:	09 f8                	or     %edi,%eax
+  1058d0:	0f 84 56 ff ff ff    	je     10582c <dwarf_abbrevs+0x8f>
+	count = 0;
+  1058d6:	b8 00 00 00 00       	mov    $0x0,%eax
+	result = 0;
+  1058db:	bf 00 00 00 00       	mov    $0x0,%edi
+  1058e0:	89 c6                	mov    %eax,%esi
+		byte = *addr;
+  1058e2:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  1058e5:	0f b6 1c 01          	movzbl (%ecx,%eax,1),%ebx
+		count++;
+  1058e9:	83 c0 01             	add    $0x1,%eax
+		result |= (byte & 0x7f) << shift;
+  1058ec:	89 da                	mov    %ebx,%edx
+  1058ee:	83 e2 7f             	and    $0x7f,%edx
+  1058f1:	8d 0c f5 00 00 00 00 	lea    0x0(,%esi,8),%ecx
+  1058f8:	29 f1                	sub    %esi,%ecx
+  1058fa:	d3 e2                	shl    %cl,%edx
+  1058fc:	09 d7                	or     %edx,%edi
+		if (!(byte & 0x80))
+  1058fe:	84 db                	test   %bl,%bl
+  105900:	78 de                	js     1058e0 <dwarf_abbrevs+0x143>
+			p += dwarf_read_uleb128(p, &name);
+  105902:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  105905:	01 c6                	add    %eax,%esi
+  105907:	89 f0                	mov    %esi,%eax
+	count = 0;
+  105909:	ba 00 00 00 00       	mov    $0x0,%edx
+	result = 0;
+  10590e:	be 00 00 00 00       	mov    $0x0,%esi
+  105913:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  105916:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  105919:	89 d7                	mov    %edx,%edi
+		byte = *addr;
+  10591b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  10591e:	0f b6 04 10          	movzbl (%eax,%edx,1),%eax
+		count++;
+  105922:	83 c2 01             	add    $0x1,%edx
+		result |= (byte & 0x7f) << shift;
+  105925:	89 c3                	mov    %eax,%ebx
+  105927:	83 e3 7f             	and    $0x7f,%ebx
+  10592a:	8d 0c fd 00 00 00 00 	lea    0x0(,%edi,8),%ecx
+  105931:	29 f9                	sub    %edi,%ecx
+  105933:	d3 e3                	shl    %cl,%ebx
+  105935:	09 de                	or     %ebx,%esi
+		if (!(byte & 0x80))
+  105937:	84 c0                	test   %al,%al
+  105939:	78 de                	js     105919 <dwarf_abbrevs+0x17c>
+			p += dwarf_read_uleb128(p, &form);
+  10593b:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  10593e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  105941:	89 f3                	mov    %esi,%ebx
+  105943:	01 d0                	add    %edx,%eax
+  105945:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+			if (form == DW_FORM_implicit_const)
+  105948:	83 fe 21             	cmp    $0x21,%esi
+  10594b:	0f 84 4c ff ff ff    	je     10589d <dwarf_abbrevs+0x100>
+			if (form_size(form) < 0)
+  105951:	89 f0                	mov    %esi,%eax
+  105953:	e8 57 ea ff ff       	call   1043af <form_size>
+  105958:	85 c0                	test   %eax,%eax
+  10595a:	0f 89 68 ff ff ff    	jns    1058c8 <dwarf_abbrevs+0x12b>
+  105960:	e9 5f ff ff ff       	jmp    1058c4 <dwarf_abbrevs+0x127>
+	if (code != 0 || maxcode > DWARF_MAXABBREV)
+  105965:	8b 5d cc             	mov    -0x34(%ebp),%ebx
+  105968:	8b 7d d8             	mov    -0x28(%ebp),%edi
+  10596b:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+  105971:	0f 87 1a 03 00 00    	ja     105c91 <dwarf_abbrevs+0x4f4>
+  105977:	83 7d d0 00          	cmpl   $0x0,-0x30(%ebp)
+  10597b:	0f 85 10 03 00 00    	jne    105c91 <dwarf_abbrevs+0x4f4>
+	if (!(at = dwarf_alloc(sizeof(*at)))
+  105981:	83 ec 0c             	sub    $0xc,%esp
+  105984:	6a 14                	push   $0x14
+  105986:	e8 7c fc ff ff       	call   105607 <dwarf_alloc>
+  10598b:	83 c4 10             	add    $0x10,%esp
+  10598e:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  105991:	85 c0                	test   %eax,%eax
+  105993:	0f 84 f8 02 00 00    	je     105c91 <dwarf_abbrevs+0x4f4>
+	    || !(at->at_abbrevs = dwarf_alloc((maxcode + 1) * sizeof(*ab)))
+  105999:	83 c3 01             	add    $0x1,%ebx
+  10599c:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  10599f:	8d 34 85 00 00 00 00 	lea    0x0(,%eax,4),%esi
+  1059a6:	83 ec 0c             	sub    $0xc,%esp
+  1059a9:	56                   	push   %esi
+  1059aa:	e8 58 fc ff ff       	call   105607 <dwarf_alloc>
+  1059af:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  1059b2:	89 41 0c             	mov    %eax,0xc(%ecx)
+  1059b5:	83 c4 10             	add    $0x10,%esp
+  1059b8:	85 c0                	test   %eax,%eax
+  1059ba:	0f 84 b9 02 00 00    	je     105c79 <dwarf_abbrevs+0x4dc>
+	    || !(as = dwarf_alloc(nattrs * sizeof(*as)))
+  1059c0:	83 ec 0c             	sub    $0xc,%esp
+  1059c3:	c1 e7 03             	shl    $0x3,%edi
+  1059c6:	57                   	push   %edi
+  1059c7:	e8 3b fc ff ff       	call   105607 <dwarf_alloc>
+  1059cc:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  1059cf:	83 c4 10             	add    $0x10,%esp
+  1059d2:	85 c0                	test   %eax,%eax
+  1059d4:	0f 84 a4 02 00 00    	je     105c7e <dwarf_abbrevs+0x4e1>
+	    || !(st = dwarf_alloc(nsteps * sizeof(*st))))
+  1059da:	83 ec 0c             	sub    $0xc,%esp
+  1059dd:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+  1059e0:	c1 e1 02             	shl    $0x2,%ecx
+  1059e3:	51                   	push   %ecx
+  1059e4:	e8 1e fc ff ff       	call   105607 <dwarf_alloc>
+  1059e9:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  1059ec:	83 c4 10             	add    $0x10,%esp
+  1059ef:	85 c0                	test   %eax,%eax
+  1059f1:	0f 84 8f 02 00 00    	je     105c86 <dwarf_abbrevs+0x4e9>
+	memset(at->at_abbrevs, 0, (maxcode + 1) * sizeof(*ab));
+  1059f7:	83 ec 04             	sub    $0x4,%esp
+  1059fa:	56                   	push   %esi
+  1059fb:	6a 00                	push   $0x0
+  1059fd:	8b 7d c8             	mov    -0x38(%ebp),%edi
+  105a00:	ff 77 0c             	push   0xc(%edi)
+  105a03:	e8 59 37 00 00       	call   109161 <memset>
+	at->at_offset = offset;
+  105a08:	8b 45 b8             	mov    -0x48(%ebp),%eax
+  105a0b:	8b 55 bc             	mov    -0x44(%ebp),%edx
+  105a0e:	89 07                	mov    %eax,(%edi)
+  105a10:	89 57 04             	mov    %edx,0x4(%edi)
+	at->at_ncodes = maxcode + 1;
+  105a13:	89 5f 08             	mov    %ebx,0x8(%edi)
+  105a16:	83 c4 10             	add    $0x10,%esp
+	count = 0;
+  105a19:	b8 00 00 00 00       	mov    $0x0,%eax
+	result = 0;
+  105a1e:	bf 00 00 00 00       	mov    $0x0,%edi
+  105a23:	89 c6                	mov    %eax,%esi
+		byte = *addr;
+  105a25:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  105a28:	0f b6 1c 01          	movzbl (%ecx,%eax,1),%ebx
+		count++;
+  105a2c:	83 c0 01             	add    $0x1,%eax
+		result |= (byte & 0x7f) << shift;
+  105a2f:	89 da                	mov    %ebx,%edx
+  105a31:	83 e2 7f             	and    $0x7f,%edx
+  105a34:	8d 0c f5 00 00 00 00 	lea    0x0(,%esi,8),%ecx
+  105a3b:	29 f1                	sub    %esi,%ecx
+  105a3d:	d3 e2                	shl    %cl,%edx
+  105a3f:	09 d7                	or     %edx,%edi
+		if (!(byte & 0x80))
+  105a41:	84 db                	test   %bl,%bl
+  105a43:	78 de                	js     105a23 <dwarf_abbrevs+0x286>
+		p += dwarf_read_uleb128(p, &code);
+  105a45:	8b 75 e0             	mov    -0x20(%ebp),%esi
+  105a48:	01 c6                	add    %eax,%esi
+  105a4a:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+		if (code == 0)
+  105a4d:	85 ff                	test   %edi,%edi
+  105a4f:	0f 84 e6 01 00 00    	je     105c3b <dwarf_abbrevs+0x49e>
+		ab = &at->at_abbrevs[code];
+  105a55:	8d 14 bf             	lea    (%edi,%edi,4),%edx
+  105a58:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  105a5b:	8b 40 0c             	mov    0xc(%eax),%eax
+  105a5e:	8d 04 90             	lea    (%eax,%edx,4),%eax
+  105a61:	89 45 d8             	mov    %eax,-0x28(%ebp)
+	count = 0;
+  105a64:	b8 00 00 00 00       	mov    $0x0,%eax
+	result = 0;
+  105a69:	bf 00 00 00 00       	mov    $0x0,%edi
+  105a6e:	89 c6                	mov    %eax,%esi
+		byte = *addr;
+  105a70:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  105a73:	0f b6 1c 01          	movzbl (%ecx,%eax,1),%ebx
+		count++;
+  105a77:	83 c0 01             	add    $0x1,%eax
+		result |= (byte & 0x7f) << shift;
+  105a7a:	89 da                	mov    %ebx,%edx
+  105a7c:	83 e2 7f             	and    $0x7f,%edx
+  105a7f:	8d 0c f5 00 00 00 00 	lea    0x0(,%esi,8),%ecx
+  105a86:	29 f1                	sub    %esi,%ecx
+  105a88:	d3 e2                	shl    %cl,%edx
+  105a8a:	09 d7                	or     %edx,%edi
+		if (!(byte & 0x80))
+  105a8c:	84 db                	test   %bl,%bl
+  105a8e:	78 de                	js     105a6e <dwarf_abbrevs+0x2d1>
+		p += dwarf_read_uleb128(p, &tag);
+  105a90:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  105a93:	01 c6                	add    %eax,%esi
+  105a95:	89 f0                	mov    %esi,%eax
+		ab->ab_tag = tag;
+  105a97:	8b 75 d8             	mov    -0x28(%ebp),%esi
+  105a9a:	66 89 3e             	mov    %di,(%esi)
+		ab->ab_children = *p++;
+  105a9d:	8d 78 01             	lea    0x1(%eax),%edi
+  105aa0:	89 7d e0             	mov    %edi,-0x20(%ebp)
+  105aa3:	0f b6 00             	movzbl (%eax),%eax
+  105aa6:	88 46 02             	mov    %al,0x2(%esi)
+		ab->ab_attrs = as;
+  105aa9:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  105aac:	89 46 04             	mov    %eax,0x4(%esi)
+		ab->ab_steps = st;
+  105aaf:	8b 7d cc             	mov    -0x34(%ebp),%edi
+  105ab2:	89 7e 08             	mov    %edi,0x8(%esi)
+		ab->ab_nsteps = 0;
+  105ab5:	66 c7 46 0c 00 00    	movw   $0x0,0xc(%esi)
+		ab->ab_fixed = 0;
+  105abb:	66 c7 46 0e 00 00    	movw   $0x0,0xe(%esi)
+		ab->ab_sibling_off = DWARF_NOSIBLING;
+  105ac1:	66 c7 46 10 ff ff    	movw   $0xffff,0x10(%esi)
+  105ac7:	83 c0 08             	add    $0x8,%eax
+  105aca:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  105acd:	e9 81 00 00 00       	jmp    105b53 <dwarf_abbrevs+0x3b6>
+	count = 0;
+  105ad2:	ba 00 00 00 00       	mov    $0x0,%edx
+	shift = 0;
+  105ad7:	b9 00 00 00 00       	mov    $0x0,%ecx
+	result = 0;
+  105adc:	be 00 00 00 00       	mov    $0x0,%esi
+  105ae1:	89 7d c4             	mov    %edi,-0x3c(%ebp)
+  105ae4:	8b 7d e0             	mov    -0x20(%ebp),%edi
+		byte = *addr;
+  105ae7:	0f b6 1c 17          	movzbl (%edi,%edx,1),%ebx
+		result |= (byte & 0x7f) << shift;
+  105aeb:	89 d8                	mov    %ebx,%eax
+  105aed:	83 e0 7f             	and    $0x7f,%eax
+  105af0:	d3 e0                	shl    %cl,%eax
+  105af2:	09 c6                	or     %eax,%esi
+		shift += 7;
+  105af4:	83 c1 07             	add    $0x7,%ecx
+		count++;
+  105af7:	83 c2 01             	add    $0x1,%edx
+		if (!(byte & 0x80))
+  105afa:	84 db                	test   %bl,%bl
+  105afc:	78 e9                	js     105ae7 <dwarf_abbrevs+0x34a>
+	if ((shift < num_bits) && (byte & 0x40))
+  105afe:	8b 7d c4             	mov    -0x3c(%ebp),%edi
+  105b01:	83 f9 1f             	cmp    $0x1f,%ecx
+  105b04:	7f 0e                	jg     105b14 <dwarf_abbrevs+0x377>
+  105b06:	f6 c3 40             	test   $0x40,%bl
+  105b09:	74 09                	je     105b14 <dwarf_abbrevs+0x377>
+		result |= (-1U << shift);
+  105b0b:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  105b10:	d3 e0                	shl    %cl,%eax
+  105b12:	09 c6                	or     %eax,%esi
+				p += dwarf_read_leb128(p, &value);
+  105b14:	01 55 e0             	add    %edx,-0x20(%ebp)
+				as->as_const = value;
+  105b17:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  105b1a:	89 70 fc             	mov    %esi,-0x4(%eax)
+			if (name == 0 && form == 0)
+  105b1d:	e9 d4 00 00 00       	jmp    105bf6 <dwarf_abbrevs+0x459>
+				ab->ab_sibling_step = ab->ab_nsteps;
+  105b22:	8b 7d d8             	mov    -0x28(%ebp),%edi
+  105b25:	0f b7 47 0c          	movzwl 0xc(%edi),%eax
+  105b29:	88 47 03             	mov    %al,0x3(%edi)
+				ab->ab_sibling_off = ab->ab_fixed;
+  105b2c:	0f b7 47 0e          	movzwl 0xe(%edi),%eax
+  105b30:	66 89 47 10          	mov    %ax,0x10(%edi)
+				ab->ab_sibling_form = form;
+  105b34:	0f b7 45 e4          	movzwl -0x1c(%ebp),%eax
+  105b38:	66 89 47 12          	mov    %ax,0x12(%edi)
+  105b3c:	e9 be 00 00 00       	jmp    105bff <dwarf_abbrevs+0x462>
+				ab->ab_fixed += size;
+  105b41:	8b 7d d8             	mov    -0x28(%ebp),%edi
+  105b44:	66 03 47 0e          	add    0xe(%edi),%ax
+				ab->ab_fixed = 0;
+  105b48:	8b 7d d8             	mov    -0x28(%ebp),%edi
+  105b4b:	66 89 47 0e          	mov    %ax,0xe(%edi)
+  105b4f:	83 45 d4 08          	addl   $0x8,-0x2c(%ebp)
+	count = 0;
+  105b53:	b8 00 00 00 00       	mov    $0x0,%eax
+	result = 0;
+  105b58:	bf 00 00 00 00       	mov    $0x0,%edi
+  105b5d:	89 c6                	mov    %eax,%esi
+		byte = *addr;
+  105b5f:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  105b62:	0f b6 1c 03          	movzbl (%ebx,%eax,1),%ebx
+		count++;
+  105b66:	83 c0 01             	add    $0x1,%eax
+		result |= (byte & 0x7f) << shift;
+  105b69:	89 da                	mov    %ebx,%edx
+  105b6b:	83 e2 7f             	and    $0x7f,%edx
+  105b6e:	8d 0c f5 00 00 00 00 	lea    0x0(,%esi,8),%ecx
+  105b75:	29 f1                	sub    %esi,%ecx
+  105b77:	d3 e2                	shl    %cl,%edx
+  105b79:	09 d7                	or     %edx,%edi
+		if (!(byte & 0x80))
+  105b7b:	84 db                	test   %bl,%bl
+  105b7d:	78 de                	js     105b5d <dwarf_abbrevs+0x3c0>
+			p += dwarf_read_uleb128(p, &name);
+  105b7f:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  105b82:	01 c2                	add    %eax,%edx
+	count = 0;
+  105b84:	be 00 00 00 00       	mov    $0x0,%esi
+	result = 0;
+  105b89:	b8 00 00 00 00       	mov    $0x0,%eax
+  105b8e:	89 7d e0             	mov    %edi,-0x20(%ebp)
+  105b91:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  105b94:	89 c2                	mov    %eax,%edx
+  105b96:	89 f7                	mov    %esi,%edi
+		byte = *addr;
+  105b98:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  105b9b:	0f b6 1c 30          	movzbl (%eax,%esi,1),%ebx
+		count++;
+  105b9f:	83 c6 01             	add    $0x1,%esi
+		result |= (byte & 0x7f) << shift;
+  105ba2:	89 d8                	mov    %ebx,%eax
+  105ba4:	83 e0 7f             	and    $0x7f,%eax
+  105ba7:	8d 0c fd 00 00 00 00 	lea    0x0(,%edi,8),%ecx
+  105bae:	29 f9                	sub    %edi,%ecx
+  105bb0:	d3 e0                	shl    %cl,%eax
+  105bb2:	09 c2                	or     %eax,%edx
+		if (!(byte & 0x80))
+  105bb4:	84 db                	test   %bl,%bl
+  105bb6:	78 de                	js     105b96 <dwarf_abbrevs+0x3f9>
+			p += dwarf_read_uleb128(p, &form);
+  105bb8:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  105bbb:	89 d3                	mov    %edx,%ebx
+  105bbd:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  105bc0:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  105bc3:	8d 04 32             	lea    (%edx,%esi,1),%eax
+  105bc6:	89 45 e0             	mov    %eax,-0x20(%ebp)
+			as->as_name = name;
+  105bc9:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  105bcc:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  105bcf:	66 89 78 f8          	mov    %di,-0x8(%eax)
+			as->as_form = form;
+  105bd3:	66 89 5d e4          	mov    %bx,-0x1c(%ebp)
+  105bd7:	66 89 58 fa          	mov    %bx,-0x6(%eax)
+			as->as_const = 0;
+  105bdb:	c7 40 fc 00 00 00 00 	movl   $0x0,-0x4(%eax)
+			if (form == DW_FORM_implicit_const) {
+  105be2:	83 fb 21             	cmp    $0x21,%ebx
+  105be5:	0f 84 e7 fe ff ff    	je     105ad2 <dwarf_abbrevs+0x335>
+			if (name == 0 && form == 0)
+  105beb:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  105bee:	09 f8                	or     %edi,%eax
+  105bf0:	0f 84 23 fe ff ff    	je     105a19 <dwarf_abbrevs+0x27c>
+			if (name == DW_AT_sibling) {
+  105bf6:	83 ff 01             	cmp    $0x1,%edi
+  105bf9:	0f 84 23 ff ff ff    	je     105b22 <dwarf_abbrevs+0x385>
+			if ((size = form_size(form)) >= 0)
+  105bff:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  105c02:	e8 a8 e7 ff ff       	call   1043af <form_size>
+  105c07:	85 c0                	test   %eax,%eax
+  105c09:	0f 89 32 ff ff ff    	jns    105b41 <dwarf_abbrevs+0x3a4>
+				st->ss_fixed = ab->ab_fixed;
+  105c0f:	8b 75 d8             	mov    -0x28(%ebp),%esi
+  105c12:	0f b7 46 0e          	movzwl 0xe(%esi),%eax
+  105c16:	8b 7d cc             	mov    -0x34(%ebp),%edi
+  105c19:	66 89 07             	mov    %ax,(%edi)
+				st->ss_form = form;
+  105c1c:	89 f8                	mov    %edi,%eax
+  105c1e:	0f b7 7d e4          	movzwl -0x1c(%ebp),%edi
+  105c22:	66 89 78 02          	mov    %di,0x2(%eax)
+				st++;
+  105c26:	83 c0 04             	add    $0x4,%eax
+  105c29:	89 45 cc             	mov    %eax,-0x34(%ebp)
+				ab->ab_nsteps++;
+  105c2c:	66 83 46 0c 01       	addw   $0x1,0xc(%esi)
+  105c31:	b8 00 00 00 00       	mov    $0x0,%eax
+  105c36:	e9 0d ff ff ff       	jmp    105b48 <dwarf_abbrevs+0x3ab>
+	at->at_next = abbrevtabs;
+  105c3b:	a1 3c e3 11 00       	mov    0x11e33c,%eax
+  105c40:	8b 7d c8             	mov    -0x38(%ebp),%edi
+  105c43:	89 47 10             	mov    %eax,0x10(%edi)
+	abbrevtabs = at;
+  105c46:	89 3d 3c e3 11 00    	mov    %edi,0x11e33c
+	dwarf_stats.dws_nabbrevtabs++;
+  105c4c:	83 05 7c e2 11 00 01 	addl   $0x1,0x11e27c
+  105c53:	0f 31                	rdtsc
+	dwarf_stats.dws_abbrev_build += read_tsc() - tsc;
+  105c55:	8b 0d 80 e2 11 00    	mov    0x11e280,%ecx
+  105c5b:	8b 1d 84 e2 11 00    	mov    0x11e284,%ebx
+  105c61:	2b 4d b0             	sub    -0x50(%ebp),%ecx
+  105c64:	1b 5d b4             	sbb    -0x4c(%ebp),%ebx
+  105c67:	01 c1                	add    %eax,%ecx
+  105c69:	11 d3                	adc    %edx,%ebx
+  105c6b:	89 0d 80 e2 11 00    	mov    %ecx,0x11e280
+  105c71:	89 1d 84 e2 11 00    	mov    %ebx,0x11e284
+	return at;
+  105c77:	eb 18                	jmp    105c91 <dwarf_abbrevs+0x4f4>
+		return NULL;
+  105c79:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  105c7c:	eb 13                	jmp    105c91 <dwarf_abbrevs+0x4f4>
+  105c7e:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  105c81:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  105c84:	eb 0b                	jmp    105c91 <dwarf_abbrevs+0x4f4>
+  105c86:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  105c89:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  105c8c:	eb 03                	jmp    105c91 <dwarf_abbrevs+0x4f4>
+  105c8e:	89 5d c8             	mov    %ebx,-0x38(%ebp)
+}
+  105c91:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  105c94:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  105c97:	5b                   	pop    %ebx
+  105c98:	5e                   	pop    %esi
+  105c99:	5f                   	pop    %edi
+  105c9a:	5d                   	pop    %ebp
+  105c9b:	c3                   	ret
+
+00105c9c <pubnames_walk>:
+{
+  105c9c:	55                   	push   %ebp
+  105c9d:	89 e5                	mov    %esp,%ebp
+  105c9f:	57                   	push   %edi
+  105ca0:	56                   	push   %esi
+  105ca1:	53                   	push   %ebx
+  105ca2:	83 ec 7c             	sub    $0x7c,%esp
+  105ca5:	89 45 80             	mov    %eax,-0x80(%ebp)
+  105ca8:	89 95 7c ff ff ff    	mov    %edx,-0x84(%ebp)
+	const char *set = (const char *) addrs->pubnames_begin, *set_end;
+  105cae:	8b 40 28             	mov    0x28(%eax),%eax
+  105cb1:	89 45 90             	mov    %eax,-0x70(%ebp)
+	while ((const unsigned char *) set < addrs->pubnames_end) {
+  105cb4:	8b 45 80             	mov    -0x80(%ebp),%eax
+  105cb7:	8b 7d 90             	mov    -0x70(%ebp),%edi
+  105cba:	3b 78 2c             	cmp    0x2c(%eax),%edi
+  105cbd:	0f 83 77 01 00 00    	jae    105e3a <pubnames_walk+0x19e>
+	initial_len = get_unaligned(addr, uint32_t);
+  105cc3:	83 ec 04             	sub    $0x4,%esp
+  105cc6:	6a 04                	push   $0x4
+  105cc8:	ff 75 90             	push   -0x70(%ebp)
+  105ccb:	8d 45 98             	lea    -0x68(%ebp),%eax
+  105cce:	50                   	push   %eax
+  105ccf:	e8 24 35 00 00       	call   1091f8 <memcpy>
+  105cd4:	8b 45 98             	mov    -0x68(%ebp),%eax
+	if (initial_len >= DW_EXT_LO && initial_len <= DW_EXT_HI) {
+  105cd7:	83 c4 10             	add    $0x10,%esp
+  105cda:	83 f8 ef             	cmp    $0xffffffef,%eax
+  105cdd:	0f 86 80 01 00 00    	jbe    105e63 <pubnames_walk+0x1c7>
+		if (initial_len == DW_EXT_DWARF64) {
+  105ce3:	83 f8 ff             	cmp    $0xffffffff,%eax
+  105ce6:	74 1a                	je     105d02 <pubnames_walk+0x66>
+			cprintf("Unknown DWARF extension\n");
+  105ce8:	83 ec 0c             	sub    $0xc,%esp
+  105ceb:	68 40 98 10 00       	push   $0x109840
+  105cf0:	e8 3f 1b 00 00       	call   107834 <cprintf>
+  105cf5:	83 c4 10             	add    $0x10,%esp
+			return -E_BAD_DWARF;
+  105cf8:	b8 fa ff ff ff       	mov    $0xfffffffa,%eax
+  105cfd:	e9 4b 01 00 00       	jmp    105e4d <pubnames_walk+0x1b1>
+			*len = get_unaligned((uint64_t *)addr + 4, uint64_t);
+  105d02:	83 ec 04             	sub    $0x4,%esp
+  105d05:	6a 08                	push   $0x8
+  105d07:	8b 45 90             	mov    -0x70(%ebp),%eax
+  105d0a:	83 c0 20             	add    $0x20,%eax
+  105d0d:	50                   	push   %eax
+  105d0e:	8d 45 98             	lea    -0x68(%ebp),%eax
+  105d11:	50                   	push   %eax
+  105d12:	e8 e1 34 00 00       	call   1091f8 <memcpy>
+  105d17:	8b 45 98             	mov    -0x68(%ebp),%eax
+			count = 12;
+  105d1a:	83 c4 10             	add    $0x10,%esp
+  105d1d:	be 0c 00 00 00       	mov    $0xc,%esi
+  105d22:	e9 41 01 00 00       	jmp    105e68 <pubnames_walk+0x1cc>
+			    && (die_read(addrs, &cu, abbrevs, ab, entry, &f, NULL,
+  105d27:	83 ec 0c             	sub    $0xc,%esp
+  105d2a:	8d 4d e4             	lea    -0x1c(%ebp),%ecx
+  105d2d:	51                   	push   %ecx
+  105d2e:	6a 00                	push   $0x0
+  105d30:	8d 4d a4             	lea    -0x5c(%ebp),%ecx
+  105d33:	51                   	push   %ecx
+  105d34:	50                   	push   %eax
+  105d35:	52                   	push   %edx
+  105d36:	89 f1                	mov    %esi,%ecx
+  105d38:	8d 55 b8             	lea    -0x48(%ebp),%edx
+  105d3b:	8b 45 80             	mov    -0x80(%ebp),%eax
+  105d3e:	e8 b4 e8 ff ff       	call   1045f7 <die_read>
+  105d43:	83 c4 20             	add    $0x20,%esp
+  105d46:	84 c0                	test   %al,%al
+  105d48:	0f 84 c5 00 00 00    	je     105e13 <pubnames_walk+0x177>
+				fn(set, f.fn_low);
+  105d4e:	83 ec 08             	sub    $0x8,%esp
+  105d51:	ff 75 a4             	push   -0x5c(%ebp)
+  105d54:	53                   	push   %ebx
+  105d55:	8b 85 7c ff ff ff    	mov    -0x84(%ebp),%eax
+  105d5b:	ff d0                	call   *%eax
+  105d5d:	83 c4 10             	add    $0x10,%esp
+			set += strlen(set) + 1;
+  105d60:	83 ec 0c             	sub    $0xc,%esp
+  105d63:	53                   	push   %ebx
+  105d64:	e8 6c 32 00 00       	call   108fd5 <strlen>
+  105d69:	8d 5c 03 01          	lea    0x1(%ebx,%eax,1),%ebx
+  105d6d:	83 c4 10             	add    $0x10,%esp
+		       && (die_offset = get_unaligned(set, uint32_t)) != 0) {
+  105d70:	8b 45 90             	mov    -0x70(%ebp),%eax
+  105d73:	39 c3                	cmp    %eax,%ebx
+  105d75:	0f 83 39 ff ff ff    	jae    105cb4 <pubnames_walk+0x18>
+  105d7b:	83 ec 04             	sub    $0x4,%esp
+  105d7e:	6a 04                	push   $0x4
+  105d80:	53                   	push   %ebx
+  105d81:	8d 45 98             	lea    -0x68(%ebp),%eax
+  105d84:	50                   	push   %eax
+  105d85:	e8 6e 34 00 00       	call   1091f8 <memcpy>
+  105d8a:	8b 45 98             	mov    -0x68(%ebp),%eax
+  105d8d:	83 c4 10             	add    $0x10,%esp
+  105d90:	85 c0                	test   %eax,%eax
+  105d92:	0f 84 1c ff ff ff    	je     105cb4 <pubnames_walk+0x18>
+			set += sizeof(uint32_t);
+  105d98:	83 c3 04             	add    $0x4,%ebx
+			die = hdr + die_offset;
+  105d9b:	8b 7d 84             	mov    -0x7c(%ebp),%edi
+  105d9e:	01 f8                	add    %edi,%eax
+  105da0:	89 45 94             	mov    %eax,-0x6c(%ebp)
+	count = 0;
+  105da3:	b8 00 00 00 00       	mov    $0x0,%eax
+	result = 0;
+  105da8:	bf 00 00 00 00       	mov    $0x0,%edi
+  105dad:	89 75 8c             	mov    %esi,-0x74(%ebp)
+  105db0:	89 5d 88             	mov    %ebx,-0x78(%ebp)
+  105db3:	89 c6                	mov    %eax,%esi
+		byte = *addr;
+  105db5:	8b 5d 94             	mov    -0x6c(%ebp),%ebx
+  105db8:	0f b6 1c 03          	movzbl (%ebx,%eax,1),%ebx
+		count++;
+  105dbc:	83 c0 01             	add    $0x1,%eax
+		result |= (byte & 0x7f) << shift;
+  105dbf:	89 da                	mov    %ebx,%edx
+  105dc1:	83 e2 7f             	and    $0x7f,%edx
+  105dc4:	8d 0c f5 00 00 00 00 	lea    0x0(,%esi,8),%ecx
+  105dcb:	29 f1                	sub    %esi,%ecx
+  105dcd:	d3 e2                	shl    %cl,%edx
+  105dcf:	09 d7                	or     %edx,%edi
+		if (!(byte & 0x80))
+  105dd1:	84 db                	test   %bl,%bl
+  105dd3:	78 de                	js     105db3 <pubnames_walk+0x117>
+			entry = die + dwarf_read_uleb128(die, &code);
+  105dd5:	8b 75 8c             	mov    -0x74(%ebp),%esi
+  105dd8:	8b 5d 88             	mov    -0x78(%ebp),%ebx
+  105ddb:	8b 4d 94             	mov    -0x6c(%ebp),%ecx
+  105dde:	01 c8                	add    %ecx,%eax
+  105de0:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if (code >= at->at_ncodes || !at->at_abbrevs[code].ab_attrs)
+  105de3:	3b 7e 08             	cmp    0x8(%esi),%edi
+  105de6:	73 60                	jae    105e48 <pubnames_walk+0x1ac>
+  105de8:	8d 0c bf             	lea    (%edi,%edi,4),%ecx
+  105deb:	8b 56 0c             	mov    0xc(%esi),%edx
+  105dee:	8d 14 8a             	lea    (%edx,%ecx,4),%edx
+  105df1:	83 7a 04 00          	cmpl   $0x0,0x4(%edx)
+  105df5:	74 5e                	je     105e55 <pubnames_walk+0x1b9>
+			if ((ab->ab_tag == DW_TAG_subprogram
+  105df7:	0f b7 0a             	movzwl (%edx),%ecx
+  105dfa:	66 83 f9 2e          	cmp    $0x2e,%cx
+  105dfe:	0f 84 23 ff ff ff    	je     105d27 <pubnames_walk+0x8b>
+  105e04:	66 83 f9 0a          	cmp    $0xa,%cx
+  105e08:	0f 85 52 ff ff ff    	jne    105d60 <pubnames_walk+0xc4>
+  105e0e:	e9 14 ff ff ff       	jmp    105d27 <pubnames_walk+0x8b>
+				|| die_concrete(addrs, &cu, abbrevs, die,
+  105e13:	83 ec 08             	sub    $0x8,%esp
+  105e16:	8d 45 a4             	lea    -0x5c(%ebp),%eax
+  105e19:	50                   	push   %eax
+  105e1a:	ff 75 94             	push   -0x6c(%ebp)
+  105e1d:	89 f1                	mov    %esi,%ecx
+  105e1f:	8d 55 b8             	lea    -0x48(%ebp),%edx
+  105e22:	8b 45 80             	mov    -0x80(%ebp),%eax
+  105e25:	e8 d6 f1 ff ff       	call   105000 <die_concrete>
+  105e2a:	83 c4 10             	add    $0x10,%esp
+  105e2d:	84 c0                	test   %al,%al
+  105e2f:	0f 84 2b ff ff ff    	je     105d60 <pubnames_walk+0xc4>
+  105e35:	e9 14 ff ff ff       	jmp    105d4e <pubnames_walk+0xb2>
+	return 0;
+  105e3a:	b8 00 00 00 00       	mov    $0x0,%eax
+  105e3f:	eb 0c                	jmp    105e4d <pubnames_walk+0x1b1>
+			return -E_BAD_DWARF;
+  105e41:	b8 fa ff ff ff       	mov    $0xfffffffa,%eax
+  105e46:	eb 05                	jmp    105e4d <pubnames_walk+0x1b1>
+				return -E_BAD_DWARF;
+  105e48:	b8 fa ff ff ff       	mov    $0xfffffffa,%eax
+}
+  105e4d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  105e50:	5b                   	pop    %ebx
+  105e51:	5e                   	pop    %esi
+  105e52:	5f                   	pop    %edi
+  105e53:	5d                   	pop    %ebp
+  105e54:	c3                   	ret
+				return -E_BAD_DWARF;
+  105e55:	b8 fa ff ff ff       	mov    $0xfffffffa,%eax
+  105e5a:	eb f1                	jmp    105e4d <pubnames_walk+0x1b1>
+			return -E_BAD_DWARF;
+  105e5c:	b8 fa ff ff ff       	mov    $0xfffffffa,%eax
+  105e61:	eb ea                	jmp    105e4d <pubnames_walk+0x1b1>
+	count = 4;
+  105e63:	be 04 00 00 00       	mov    $0x4,%esi
+		set += count;
+  105e68:	8b 7d 90             	mov    -0x70(%ebp),%edi
+  105e6b:	01 f7                	add    %esi,%edi
+  105e6d:	89 fe                	mov    %edi,%esi
+		set_end = set + len;
+  105e6f:	01 f8                	add    %edi,%eax
+  105e71:	89 45 90             	mov    %eax,-0x70(%ebp)
+		if (get_unaligned(set, Dwarf_Half) != 2)
+  105e74:	83 ec 04             	sub    $0x4,%esp
+  105e77:	6a 02                	push   $0x2
+  105e79:	57                   	push   %edi
+  105e7a:	8d 45 98             	lea    -0x68(%ebp),%eax
+  105e7d:	50                   	push   %eax
+  105e7e:	e8 75 33 00 00       	call   1091f8 <memcpy>
+  105e83:	83 c4 10             	add    $0x10,%esp
+  105e86:	66 83 7d 98 02       	cmpw   $0x2,-0x68(%ebp)
+  105e8b:	75 cf                	jne    105e5c <pubnames_walk+0x1c0>
+		cu_offset = get_unaligned(set, uint32_t);
+  105e8d:	83 ec 04             	sub    $0x4,%esp
+  105e90:	6a 04                	push   $0x4
+		set += sizeof(Dwarf_Half);
+  105e92:	8d 46 02             	lea    0x2(%esi),%eax
+		cu_offset = get_unaligned(set, uint32_t);
+  105e95:	50                   	push   %eax
+  105e96:	8d 45 98             	lea    -0x68(%ebp),%eax
+  105e99:	50                   	push   %eax
+  105e9a:	e8 59 33 00 00       	call   1091f8 <memcpy>
+		set += 2 * sizeof(uint32_t);	// and the CU's length
+  105e9f:	83 c6 0a             	add    $0xa,%esi
+		hdr = (const char *) addrs->info_begin + cu_offset;
+  105ea2:	8b 4d 80             	mov    -0x80(%ebp),%ecx
+  105ea5:	8b 41 10             	mov    0x10(%ecx),%eax
+  105ea8:	03 45 98             	add    -0x68(%ebp),%eax
+  105eab:	89 c7                	mov    %eax,%edi
+  105ead:	89 45 84             	mov    %eax,-0x7c(%ebp)
+		if ((r = dwarf_read_cu_header(addrs, hdr, &cu)) < 0)
+  105eb0:	83 c4 0c             	add    $0xc,%esp
+  105eb3:	8d 45 b8             	lea    -0x48(%ebp),%eax
+  105eb6:	50                   	push   %eax
+  105eb7:	57                   	push   %edi
+  105eb8:	89 cf                	mov    %ecx,%edi
+  105eba:	51                   	push   %ecx
+  105ebb:	e8 10 b4 ff ff       	call   1012d0 <dwarf_read_cu_header>
+  105ec0:	83 c4 10             	add    $0x10,%esp
+  105ec3:	85 c0                	test   %eax,%eax
+  105ec5:	78 86                	js     105e4d <pubnames_walk+0x1b1>
+		if (!(abbrevs = dwarf_abbrevs(addrs, cu.cu_abbrev_offset)))
+  105ec7:	83 ec 04             	sub    $0x4,%esp
+  105eca:	ff 75 c8             	push   -0x38(%ebp)
+  105ecd:	ff 75 c4             	push   -0x3c(%ebp)
+  105ed0:	57                   	push   %edi
+  105ed1:	e8 c7 f8 ff ff       	call   10579d <dwarf_abbrevs>
+  105ed6:	83 c4 10             	add    $0x10,%esp
+  105ed9:	85 c0                	test   %eax,%eax
+  105edb:	0f 84 60 ff ff ff    	je     105e41 <pubnames_walk+0x1a5>
+  105ee1:	89 f3                	mov    %esi,%ebx
+  105ee3:	89 c6                	mov    %eax,%esi
+  105ee5:	e9 86 fe ff ff       	jmp    105d70 <pubnames_walk+0xd4>
+
+00105eea <funcs_walk>:
+{
+  105eea:	55                   	push   %ebp
+  105eeb:	89 e5                	mov    %esp,%ebp
+  105eed:	57                   	push   %edi
+  105eee:	56                   	push   %esi
+  105eef:	53                   	push   %ebx
+  105ef0:	83 ec 3c             	sub    $0x3c,%esp
+  105ef3:	89 c3                	mov    %eax,%ebx
+  105ef5:	89 d7                	mov    %edx,%edi
+	const char *hdr = (const char *) addrs->info_begin;
+  105ef7:	8b 40 10             	mov    0x10(%eax),%eax
+		if ((r = dwarf_read_cu_header(addrs, hdr, &cu)) < 0)
+  105efa:	8d 75 bc             	lea    -0x44(%ebp),%esi
+	for (; (const unsigned char *) hdr < addrs->info_end; hdr = cu.cu_end) {
+  105efd:	3b 43 14             	cmp    0x14(%ebx),%eax
+  105f00:	73 43                	jae    105f45 <funcs_walk+0x5b>
+		if ((r = dwarf_read_cu_header(addrs, hdr, &cu)) < 0)
+  105f02:	83 ec 04             	sub    $0x4,%esp
+  105f05:	56                   	push   %esi
+  105f06:	50                   	push   %eax
+  105f07:	53                   	push   %ebx
+  105f08:	e8 c3 b3 ff ff       	call   1012d0 <dwarf_read_cu_header>
+  105f0d:	83 c4 10             	add    $0x10,%esp
+  105f10:	85 c0                	test   %eax,%eax
+  105f12:	78 36                	js     105f4a <funcs_walk+0x60>
+		if (!(abbrevs = dwarf_abbrevs(addrs, cu.cu_abbrev_offset)))
+  105f14:	83 ec 04             	sub    $0x4,%esp
+  105f17:	ff 75 cc             	push   -0x34(%ebp)
+  105f1a:	ff 75 c8             	push   -0x38(%ebp)
+  105f1d:	53                   	push   %ebx
+  105f1e:	e8 7a f8 ff ff       	call   10579d <dwarf_abbrevs>
+  105f23:	89 c1                	mov    %eax,%ecx
+  105f25:	83 c4 10             	add    $0x10,%esp
+  105f28:	85 c0                	test   %eax,%eax
+  105f2a:	74 26                	je     105f52 <funcs_walk+0x68>
+		if ((r = funcs_walk_unit(addrs, &cu, abbrevs, fn)) < 0)
+  105f2c:	83 ec 0c             	sub    $0xc,%esp
+  105f2f:	57                   	push   %edi
+  105f30:	89 f2                	mov    %esi,%edx
+  105f32:	89 d8                	mov    %ebx,%eax
+  105f34:	e8 67 e8 ff ff       	call   1047a0 <funcs_walk_unit>
+  105f39:	83 c4 10             	add    $0x10,%esp
+  105f3c:	85 c0                	test   %eax,%eax
+  105f3e:	78 0a                	js     105f4a <funcs_walk+0x60>
+	for (; (const unsigned char *) hdr < addrs->info_end; hdr = cu.cu_end) {
+  105f40:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+  105f43:	eb b8                	jmp    105efd <funcs_walk+0x13>
+	return 0;
+  105f45:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  105f4a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  105f4d:	5b                   	pop    %ebx
+  105f4e:	5e                   	pop    %esi
+  105f4f:	5f                   	pop    %edi
+  105f50:	5d                   	pop    %ebp
+  105f51:	c3                   	ret
+			return -E_BAD_DWARF;
+  105f52:	b8 fa ff ff ff       	mov    $0xfffffffa,%eax
+  105f57:	eb f1                	jmp    105f4a <funcs_walk+0x60>
+
+00105f59 <dwarf_func_lookup>:
+{
+  105f59:	55                   	push   %ebp
+  105f5a:	89 e5                	mov    %esp,%ebp
+  105f5c:	57                   	push   %edi
+  105f5d:	56                   	push   %esi
+  105f5e:	53                   	push   %ebx
+  105f5f:	83 ec 2c             	sub    $0x2c,%esp
+  105f62:	8b 75 14             	mov    0x14(%ebp),%esi
+  105f65:	0f 31                	rdtsc
+  105f67:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  105f6a:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+	if ((r = dwarf_cu_get(addrs, cu_offset, &ci)) < 0)
+  105f6d:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  105f70:	50                   	push   %eax
+  105f71:	ff 75 10             	push   0x10(%ebp)
+  105f74:	ff 75 0c             	push   0xc(%ebp)
+  105f77:	ff 75 08             	push   0x8(%ebp)
+  105f7a:	e8 72 0b 00 00       	call   106af1 <dwarf_cu_get>
+  105f7f:	89 c1                	mov    %eax,%ecx
+  105f81:	83 c4 10             	add    $0x10,%esp
+  105f84:	85 c0                	test   %eax,%eax
+  105f86:	0f 88 66 01 00 00    	js     1060f2 <dwarf_func_lookup+0x199>
+	if (!ci->ci_funcs_tried)
+  105f8c:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  105f8f:	80 7b 75 00          	cmpb   $0x0,0x75(%ebx)
+  105f93:	74 3b                	je     105fd0 <dwarf_func_lookup+0x77>
+	fp = ci->ci_funcs;
+  105f95:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  105f98:	8b 58 5c             	mov    0x5c(%eax),%ebx
+	hi = fp ? ci->ci_nfuncs : 0;
+  105f9b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  105fa0:	85 db                	test   %ebx,%ebx
+  105fa2:	74 03                	je     105fa7 <dwarf_func_lookup+0x4e>
+  105fa4:	8b 48 60             	mov    0x60(%eax),%ecx
+  105fa7:	ba 00 00 00 00       	mov    $0x0,%edx
+	while (lo < hi) {
+  105fac:	39 ca                	cmp    %ecx,%edx
+  105fae:	0f 8d e1 00 00 00    	jge    106095 <dwarf_func_lookup+0x13c>
+		mid = (lo + hi) / 2;
+  105fb4:	8d 3c 0a             	lea    (%edx,%ecx,1),%edi
+  105fb7:	89 f8                	mov    %edi,%eax
+  105fb9:	c1 e8 1f             	shr    $0x1f,%eax
+  105fbc:	01 f8                	add    %edi,%eax
+  105fbe:	d1 f8                	sar    %eax
+		if (fp[mid].fn_low <= p)
+  105fc0:	8d 3c 80             	lea    (%eax,%eax,4),%edi
+  105fc3:	3b 34 bb             	cmp    (%ebx,%edi,4),%esi
+  105fc6:	0f 83 c1 00 00 00    	jae    10608d <dwarf_func_lookup+0x134>
+		mid = (lo + hi) / 2;
+  105fcc:	89 c1                	mov    %eax,%ecx
+  105fce:	eb dc                	jmp    105fac <dwarf_func_lookup+0x53>
+  105fd0:	0f 31                	rdtsc
+  105fd2:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  105fd5:	89 55 cc             	mov    %edx,-0x34(%ebp)
+	ci->ci_funcs_tried = 1;
+  105fd8:	c6 43 75 01          	movb   $0x1,0x75(%ebx)
+	nfuncs = 0;
+  105fdc:	c7 05 34 e3 11 00 00 	movl   $0x0,0x11e334
+  105fe3:	00 00 00 
+	if (funcs_walk_unit(addrs, &ci->ci_cu, ci->ci_abbrevs, funcs_count) < 0
+  105fe6:	8d 7b 08             	lea    0x8(%ebx),%edi
+  105fe9:	8b 4b 34             	mov    0x34(%ebx),%ecx
+  105fec:	83 ec 0c             	sub    $0xc,%esp
+  105fef:	68 51 44 10 00       	push   $0x104451
+  105ff4:	89 fa                	mov    %edi,%edx
+  105ff6:	8b 45 08             	mov    0x8(%ebp),%eax
+  105ff9:	e8 a2 e7 ff ff       	call   1047a0 <funcs_walk_unit>
+  105ffe:	83 c4 10             	add    $0x10,%esp
+  106001:	85 c0                	test   %eax,%eax
+  106003:	78 90                	js     105f95 <dwarf_func_lookup+0x3c>
+	    || !(funcs = dwarf_cu_alloc(ci, nfuncs * sizeof(*funcs))))
+  106005:	83 ec 08             	sub    $0x8,%esp
+  106008:	a1 34 e3 11 00       	mov    0x11e334,%eax
+  10600d:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  106010:	c1 e0 02             	shl    $0x2,%eax
+  106013:	50                   	push   %eax
+  106014:	53                   	push   %ebx
+  106015:	e8 9e 09 00 00       	call   1069b8 <dwarf_cu_alloc>
+  10601a:	a3 38 e3 11 00       	mov    %eax,0x11e338
+  10601f:	83 c4 10             	add    $0x10,%esp
+  106022:	85 c0                	test   %eax,%eax
+  106024:	0f 84 6b ff ff ff    	je     105f95 <dwarf_func_lookup+0x3c>
+	nfuncs = 0;
+  10602a:	c7 05 34 e3 11 00 00 	movl   $0x0,0x11e334
+  106031:	00 00 00 
+	funcs_walk_unit(addrs, &ci->ci_cu, ci->ci_abbrevs, funcs_add);
+  106034:	8b 4b 34             	mov    0x34(%ebx),%ecx
+  106037:	83 ec 0c             	sub    $0xc,%esp
+  10603a:	68 0e 45 10 00       	push   $0x10450e
+  10603f:	89 fa                	mov    %edi,%edx
+  106041:	8b 45 08             	mov    0x8(%ebp),%eax
+  106044:	e8 57 e7 ff ff       	call   1047a0 <funcs_walk_unit>
+	ci->ci_funcs = funcs;
+  106049:	a1 38 e3 11 00       	mov    0x11e338,%eax
+  10604e:	89 43 5c             	mov    %eax,0x5c(%ebx)
+	ci->ci_nfuncs = nfuncs;
+  106051:	a1 34 e3 11 00       	mov    0x11e334,%eax
+  106056:	89 43 60             	mov    %eax,0x60(%ebx)
+	dwarf_stats.dws_nfuncs += nfuncs;
+  106059:	01 05 88 e2 11 00    	add    %eax,0x11e288
+  10605f:	0f 31                	rdtsc
+  106061:	89 c1                	mov    %eax,%ecx
+  106063:	89 d3                	mov    %edx,%ebx
+	dwarf_stats.dws_funcs_build += read_tsc() - tsc;
+  106065:	a1 8c e2 11 00       	mov    0x11e28c,%eax
+  10606a:	8b 15 90 e2 11 00    	mov    0x11e290,%edx
+  106070:	2b 45 c8             	sub    -0x38(%ebp),%eax
+  106073:	1b 55 cc             	sbb    -0x34(%ebp),%edx
+  106076:	01 c8                	add    %ecx,%eax
+  106078:	11 da                	adc    %ebx,%edx
+  10607a:	a3 8c e2 11 00       	mov    %eax,0x11e28c
+  10607f:	89 15 90 e2 11 00    	mov    %edx,0x11e290
+  106085:	83 c4 10             	add    $0x10,%esp
+  106088:	e9 08 ff ff ff       	jmp    105f95 <dwarf_func_lookup+0x3c>
+			lo = mid + 1;
+  10608d:	8d 50 01             	lea    0x1(%eax),%edx
+  106090:	e9 17 ff ff ff       	jmp    105fac <dwarf_func_lookup+0x53>
+	r = -E_BAD_DWARF;
+  106095:	b9 fa ff ff ff       	mov    $0xfffffffa,%ecx
+	if (lo > 0 && p <= fp[lo - 1].fn_high) {
+  10609a:	85 d2                	test   %edx,%edx
+  10609c:	7e 29                	jle    1060c7 <dwarf_func_lookup+0x16e>
+  10609e:	8d 04 92             	lea    (%edx,%edx,4),%eax
+  1060a1:	8d 44 83 ec          	lea    -0x14(%ebx,%eax,4),%eax
+  1060a5:	39 70 04             	cmp    %esi,0x4(%eax)
+  1060a8:	72 1d                	jb     1060c7 <dwarf_func_lookup+0x16e>
+		*name = fp[lo - 1].fn_name;
+  1060aa:	8b 48 08             	mov    0x8(%eax),%ecx
+  1060ad:	8b 55 18             	mov    0x18(%ebp),%edx
+  1060b0:	89 0a                	mov    %ecx,(%edx)
+		*namelen = fp[lo - 1].fn_namelen;
+  1060b2:	0f b7 48 0c          	movzwl 0xc(%eax),%ecx
+  1060b6:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  1060b9:	89 0a                	mov    %ecx,(%edx)
+		*addr = fp[lo - 1].fn_low;
+  1060bb:	8b 10                	mov    (%eax),%edx
+  1060bd:	8b 45 20             	mov    0x20(%ebp),%eax
+  1060c0:	89 10                	mov    %edx,(%eax)
+		r = 0;
+  1060c2:	b9 00 00 00 00       	mov    $0x0,%ecx
+	dwarf_stats.dws_func_lookups++;
+  1060c7:	83 05 94 e2 11 00 01 	addl   $0x1,0x11e294
+  1060ce:	0f 31                	rdtsc
+	dwarf_stats.dws_func_cycles += read_tsc() - tsc;
+  1060d0:	8b 35 98 e2 11 00    	mov    0x11e298,%esi
+  1060d6:	8b 3d 9c e2 11 00    	mov    0x11e29c,%edi
+  1060dc:	2b 75 d0             	sub    -0x30(%ebp),%esi
+  1060df:	1b 7d d4             	sbb    -0x2c(%ebp),%edi
+  1060e2:	01 c6                	add    %eax,%esi
+  1060e4:	11 d7                	adc    %edx,%edi
+  1060e6:	89 35 98 e2 11 00    	mov    %esi,0x11e298
+  1060ec:	89 3d 9c e2 11 00    	mov    %edi,0x11e29c
+}
+  1060f2:	89 c8                	mov    %ecx,%eax
+  1060f4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  1060f7:	5b                   	pop    %ebx
+  1060f8:	5e                   	pop    %esi
+  1060f9:	5f                   	pop    %edi
+  1060fa:	5d                   	pop    %ebp
+  1060fb:	c3                   	ret
+
+001060fc <dwarf_inline_lookup>:
+{
+  1060fc:	55                   	push   %ebp
+  1060fd:	89 e5                	mov    %esp,%ebp
+  1060ff:	57                   	push   %edi
+  106100:	56                   	push   %esi
+  106101:	53                   	push   %ebx
+  106102:	83 ec 2c             	sub    $0x2c,%esp
+  106105:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  106108:	8b 75 14             	mov    0x14(%ebp),%esi
+  10610b:	0f 31                	rdtsc
+  10610d:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  106110:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+	if ((r = dwarf_cu_get(addrs, cu_offset, &ci)) < 0)
+  106113:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  106116:	50                   	push   %eax
+  106117:	ff 75 10             	push   0x10(%ebp)
+  10611a:	ff 75 0c             	push   0xc(%ebp)
+  10611d:	53                   	push   %ebx
+  10611e:	e8 ce 09 00 00       	call   106af1 <dwarf_cu_get>
+  106123:	89 c1                	mov    %eax,%ecx
+  106125:	83 c4 10             	add    $0x10,%esp
+  106128:	85 c0                	test   %eax,%eax
+  10612a:	0f 88 d6 00 00 00    	js     106206 <dwarf_inline_lookup+0x10a>
+	if (!ci->ci_inlines_tried)
+  106130:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  106133:	80 7a 76 00          	cmpb   $0x0,0x76(%edx)
+  106137:	74 33                	je     10616c <dwarf_inline_lookup+0x70>
+	ip = ci->ci_inlines;
+  106139:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  10613c:	8b 78 64             	mov    0x64(%eax),%edi
+	hi = ip ? ci->ci_ninlines : 0;
+  10613f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  106144:	85 ff                	test   %edi,%edi
+  106146:	74 03                	je     10614b <dwarf_inline_lookup+0x4f>
+  106148:	8b 48 68             	mov    0x68(%eax),%ecx
+  10614b:	b8 00 00 00 00       	mov    $0x0,%eax
+	while (lo < hi) {
+  106150:	39 c8                	cmp    %ecx,%eax
+  106152:	7d 26                	jge    10617a <dwarf_inline_lookup+0x7e>
+		mid = (lo + hi) / 2;
+  106154:	8d 1c 08             	lea    (%eax,%ecx,1),%ebx
+  106157:	89 da                	mov    %ebx,%edx
+  106159:	c1 ea 1f             	shr    $0x1f,%edx
+  10615c:	01 da                	add    %ebx,%edx
+  10615e:	d1 fa                	sar    %edx
+		if (ip[mid].in_low <= p)
+  106160:	6b da 1c             	imul   $0x1c,%edx,%ebx
+  106163:	3b 34 1f             	cmp    (%edi,%ebx,1),%esi
+  106166:	73 0d                	jae    106175 <dwarf_inline_lookup+0x79>
+		mid = (lo + hi) / 2;
+  106168:	89 d1                	mov    %edx,%ecx
+  10616a:	eb e4                	jmp    106150 <dwarf_inline_lookup+0x54>
+		inlines_build(addrs, ci);
+  10616c:	89 d8                	mov    %ebx,%eax
+  10616e:	e8 c1 e7 ff ff       	call   104934 <inlines_build>
+  106173:	eb c4                	jmp    106139 <dwarf_inline_lookup+0x3d>
+			lo = mid + 1;
+  106175:	8d 42 01             	lea    0x1(%edx),%eax
+  106178:	eb d6                	jmp    106150 <dwarf_inline_lookup+0x54>
+	for (i = lo - 1; i >= 0 && p >= ip[i].in_high; i = ip[i].in_parent)
+  10617a:	83 e8 01             	sub    $0x1,%eax
+  10617d:	eb 03                	jmp    106182 <dwarf_inline_lookup+0x86>
+  10617f:	8b 42 18             	mov    0x18(%edx),%eax
+  106182:	85 c0                	test   %eax,%eax
+  106184:	78 0a                	js     106190 <dwarf_inline_lookup+0x94>
+  106186:	6b d0 1c             	imul   $0x1c,%eax,%edx
+  106189:	01 fa                	add    %edi,%edx
+  10618b:	3b 72 04             	cmp    0x4(%edx),%esi
+  10618e:	73 ef                	jae    10617f <dwarf_inline_lookup+0x83>
+  106190:	8b 55 18             	mov    0x18(%ebp),%edx
+		mid = (lo + hi) / 2;
+  106193:	b9 00 00 00 00       	mov    $0x0,%ecx
+  106198:	8b 5d 1c             	mov    0x1c(%ebp),%ebx
+  10619b:	eb 36                	jmp    1061d3 <dwarf_inline_lookup+0xd7>
+		chain[r++] = ip[i];
+  10619d:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  1061a0:	01 f8                	add    %edi,%eax
+  1061a2:	83 c1 01             	add    $0x1,%ecx
+  1061a5:	8b 30                	mov    (%eax),%esi
+  1061a7:	89 32                	mov    %esi,(%edx)
+  1061a9:	8b 70 04             	mov    0x4(%eax),%esi
+  1061ac:	89 72 04             	mov    %esi,0x4(%edx)
+  1061af:	8b 70 08             	mov    0x8(%eax),%esi
+  1061b2:	89 72 08             	mov    %esi,0x8(%edx)
+  1061b5:	8b 70 0c             	mov    0xc(%eax),%esi
+  1061b8:	89 72 0c             	mov    %esi,0xc(%edx)
+  1061bb:	8b 70 10             	mov    0x10(%eax),%esi
+  1061be:	89 72 10             	mov    %esi,0x10(%edx)
+  1061c1:	8b 70 14             	mov    0x14(%eax),%esi
+  1061c4:	89 72 14             	mov    %esi,0x14(%edx)
+  1061c7:	8b 70 18             	mov    0x18(%eax),%esi
+  1061ca:	89 72 18             	mov    %esi,0x18(%edx)
+	for (r = 0; i >= 0 && r < n; i = ip[i].in_parent)
+  1061cd:	8b 40 18             	mov    0x18(%eax),%eax
+  1061d0:	83 c2 1c             	add    $0x1c,%edx
+  1061d3:	85 c0                	test   %eax,%eax
+  1061d5:	78 04                	js     1061db <dwarf_inline_lookup+0xdf>
+  1061d7:	39 d9                	cmp    %ebx,%ecx
+  1061d9:	7c c2                	jl     10619d <dwarf_inline_lookup+0xa1>
+	dwarf_stats.dws_inline_lookups++;
+  1061db:	83 05 c8 e2 11 00 01 	addl   $0x1,0x11e2c8
+  1061e2:	0f 31                	rdtsc
+	dwarf_stats.dws_inline_cycles += read_tsc() - tsc;
+  1061e4:	8b 35 cc e2 11 00    	mov    0x11e2cc,%esi
+  1061ea:	8b 3d d0 e2 11 00    	mov    0x11e2d0,%edi
+  1061f0:	2b 75 d0             	sub    -0x30(%ebp),%esi
+  1061f3:	1b 7d d4             	sbb    -0x2c(%ebp),%edi
+  1061f6:	01 c6                	add    %eax,%esi
+  1061f8:	11 d7                	adc    %edx,%edi
+  1061fa:	89 35 cc e2 11 00    	mov    %esi,0x11e2cc
+  106200:	89 3d d0 e2 11 00    	mov    %edi,0x11e2d0
+}
+  106206:	89 c8                	mov    %ecx,%eax
+  106208:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  10620b:	5b                   	pop    %ebx
+  10620c:	5e                   	pop    %esi
+  10620d:	5f                   	pop    %edi
+  10620e:	5d                   	pop    %ebp
+  10620f:	c3                   	ret
+
+00106210 <dwarf_inline_file>:
+{
+  106210:	55                   	push   %ebp
+  106211:	89 e5                	mov    %esp,%ebp
+  106213:	56                   	push   %esi
+  106214:	53                   	push   %ebx
+  106215:	83 ec 10             	sub    $0x10,%esp
+  106218:	8b 75 08             	mov    0x8(%ebp),%esi
+  10621b:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	if ((r = dwarf_cu_get(addrs, cu_offset, &ci)) < 0)
+  10621e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  106221:	50                   	push   %eax
+  106222:	ff 75 10             	push   0x10(%ebp)
+  106225:	ff 75 0c             	push   0xc(%ebp)
+  106228:	56                   	push   %esi
+  106229:	e8 c3 08 00 00       	call   106af1 <dwarf_cu_get>
+  10622e:	83 c4 10             	add    $0x10,%esp
+  106231:	85 c0                	test   %eax,%eax
+  106233:	78 32                	js     106267 <dwarf_inline_file+0x57>
+	if (!ci->ci_inlines_tried)
+  106235:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  106238:	80 7a 76 00          	cmpb   $0x0,0x76(%edx)
+  10623c:	74 30                	je     10626e <dwarf_inline_file+0x5e>
+	if (index >= ci->ci_nfiles || !ci->ci_files[index])
+  10623e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  106241:	3b 58 70             	cmp    0x70(%eax),%ebx
+  106244:	73 31                	jae    106277 <dwarf_inline_file+0x67>
+  106246:	8b 40 6c             	mov    0x6c(%eax),%eax
+  106249:	8b 04 98             	mov    (%eax,%ebx,4),%eax
+  10624c:	85 c0                	test   %eax,%eax
+  10624e:	74 2e                	je     10627e <dwarf_inline_file+0x6e>
+	strlcpy(buf, ci->ci_files[index], len);
+  106250:	83 ec 04             	sub    $0x4,%esp
+  106253:	ff 75 1c             	push   0x1c(%ebp)
+  106256:	50                   	push   %eax
+  106257:	ff 75 18             	push   0x18(%ebp)
+  10625a:	e8 27 2e 00 00       	call   109086 <strlcpy>
+	return 0;
+  10625f:	83 c4 10             	add    $0x10,%esp
+  106262:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  106267:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  10626a:	5b                   	pop    %ebx
+  10626b:	5e                   	pop    %esi
+  10626c:	5d                   	pop    %ebp
+  10626d:	c3                   	ret
+		inlines_build(addrs, ci);
+  10626e:	89 f0                	mov    %esi,%eax
+  106270:	e8 bf e6 ff ff       	call   104934 <inlines_build>
+  106275:	eb c7                	jmp    10623e <dwarf_inline_file+0x2e>
+		return -E_NO_ENT;
+  106277:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  10627c:	eb e9                	jmp    106267 <dwarf_inline_file+0x57>
+  10627e:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  106283:	eb e2                	jmp    106267 <dwarf_inline_file+0x57>
+
+00106285 <dwarf_name_lookup>:
+// table.  Returns -E_NO_ENT if there is no such name, and -E_BAD_DWARF if
+// the table could not be built.
+int
+dwarf_name_lookup(const struct Dwarf_Addrs *addrs, const char *name,
+		  uintptr_t *addr)
+{
+  106285:	55                   	push   %ebp
+  106286:	89 e5                	mov    %esp,%ebp
+  106288:	57                   	push   %edi
+  106289:	56                   	push   %esi
+  10628a:	53                   	push   %ebx
+  10628b:	83 ec 4c             	sub    $0x4c,%esp
+  10628e:	0f 31                	rdtsc
+  106290:	89 45 b0             	mov    %eax,-0x50(%ebp)
+  106293:	89 55 b4             	mov    %edx,-0x4c(%ebp)
+	while (*s) {
+  106296:	8b 55 0c             	mov    0xc(%ebp),%edx
+	uint32_t h = 2166136261U;
+  106299:	bf c5 9d 1c 81       	mov    $0x811c9dc5,%edi
+	while (*s) {
+  10629e:	eb 0e                	jmp    1062ae <dwarf_name_lookup+0x29>
+		h ^= (uint8_t) *s++;
+  1062a0:	83 c2 01             	add    $0x1,%edx
+  1062a3:	0f b6 c0             	movzbl %al,%eax
+  1062a6:	31 c7                	xor    %eax,%edi
+		h *= 16777619;
+  1062a8:	69 ff 93 01 00 01    	imul   $0x1000193,%edi,%edi
+	while (*s) {
+  1062ae:	0f b6 02             	movzbl (%edx),%eax
+  1062b1:	84 c0                	test   %al,%al
+  1062b3:	75 eb                	jne    1062a0 <dwarf_name_lookup+0x1b>
+	uint64_t tsc = read_tsc();
+	uint32_t h = name_hash(name), i;
+	int r = -E_NO_ENT, j;
+
+	if (!names_built) {
+  1062b5:	80 3d 0c e3 11 00 00 	cmpb   $0x0,0x11e30c
+  1062bc:	0f 85 60 01 00 00    	jne    106422 <dwarf_name_lookup+0x19d>
+		names_built = 1;
+  1062c2:	c6 05 0c e3 11 00 01 	movb   $0x1,0x11e30c
+		// The compiler's own hash table needs no building.
+		if (addrs->names_begin < addrs->names_end
+  1062c9:	8b 45 08             	mov    0x8(%ebp),%eax
+  1062cc:	8b 50 54             	mov    0x54(%eax),%edx
+  1062cf:	39 50 50             	cmp    %edx,0x50(%eax)
+  1062d2:	72 1a                	jb     1062ee <dwarf_name_lookup+0x69>
+		    && dwarf_need(DWARF_NAMES | DWARF_DIES) == 0)
+			nameidx_build(addrs);
+		if (!nameidxs && dwarf_need(DWARF_PUBNAMES | DWARF_DIES) == 0)
+  1062d4:	83 3d 08 e3 11 00 00 	cmpl   $0x0,0x11e308
+  1062db:	74 73                	je     106350 <dwarf_name_lookup+0xcb>
+			names_build(addrs);
+	}
+
+	if (nameidxs) {
+		for (j = 0; j < nnameidxs && r == -E_NO_ENT; j++)
+  1062dd:	c7 45 c8 00 00 00 00 	movl   $0x0,-0x38(%ebp)
+	int r = -E_NO_ENT, j;
+  1062e4:	b9 f8 ff ff ff       	mov    $0xfffffff8,%ecx
+  1062e9:	e9 ca 01 00 00       	jmp    1064b8 <dwarf_name_lookup+0x233>
+  1062ee:	0f 31                	rdtsc
+  1062f0:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  1062f3:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+	if ((n = nameidx_walk(addrs, NULL)) <= 0
+  1062f6:	ba 00 00 00 00       	mov    $0x0,%edx
+  1062fb:	8b 45 08             	mov    0x8(%ebp),%eax
+  1062fe:	e8 ce ea ff ff       	call   104dd1 <nameidx_walk>
+  106303:	89 c3                	mov    %eax,%ebx
+  106305:	85 c0                	test   %eax,%eax
+  106307:	7e cb                	jle    1062d4 <dwarf_name_lookup+0x4f>
+	    || !(nameidxs = dwarf_alloc(n * sizeof(*nameidxs))))
+  106309:	83 ec 0c             	sub    $0xc,%esp
+  10630c:	6b c0 2c             	imul   $0x2c,%eax,%eax
+  10630f:	50                   	push   %eax
+  106310:	e8 f2 f2 ff ff       	call   105607 <dwarf_alloc>
+  106315:	89 c2                	mov    %eax,%edx
+  106317:	a3 08 e3 11 00       	mov    %eax,0x11e308
+  10631c:	83 c4 10             	add    $0x10,%esp
+  10631f:	85 c0                	test   %eax,%eax
+  106321:	74 2d                	je     106350 <dwarf_name_lookup+0xcb>
+	dwarf_stats.dws_nnames = 0;
+  106323:	c7 05 dc e2 11 00 00 	movl   $0x0,0x11e2dc
+  10632a:	00 00 00 
+	nameidx_walk(addrs, nameidxs);
+  10632d:	8b 45 08             	mov    0x8(%ebp),%eax
+  106330:	e8 9c ea ff ff       	call   104dd1 <nameidx_walk>
+	nnameidxs = n;
+  106335:	89 1d 04 e3 11 00    	mov    %ebx,0x11e304
+  10633b:	0f 31                	rdtsc
+	dwarf_stats.dws_names_build = read_tsc() - tsc;
+  10633d:	2b 45 d0             	sub    -0x30(%ebp),%eax
+  106340:	1b 55 d4             	sbb    -0x2c(%ebp),%edx
+  106343:	a3 e0 e2 11 00       	mov    %eax,0x11e2e0
+  106348:	89 15 e4 e2 11 00    	mov    %edx,0x11e2e4
+  10634e:	eb 84                	jmp    1062d4 <dwarf_name_lookup+0x4f>
+  106350:	0f 31                	rdtsc
+  106352:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  106355:	89 55 c4             	mov    %edx,-0x3c(%ebp)
+	bool pubnames = addrs->pubnames_begin < addrs->pubnames_end;
+  106358:	8b 45 08             	mov    0x8(%ebp),%eax
+  10635b:	8b 40 28             	mov    0x28(%eax),%eax
+  10635e:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  106361:	8b 55 08             	mov    0x8(%ebp),%edx
+  106364:	8b 72 2c             	mov    0x2c(%edx),%esi
+	nnames = 0;
+  106367:	c7 05 10 e3 11 00 00 	movl   $0x0,0x11e310
+  10636e:	00 00 00 
+	if (pubnames)
+  106371:	39 f0                	cmp    %esi,%eax
+  106373:	73 23                	jae    106398 <dwarf_name_lookup+0x113>
+		r = pubnames_walk(addrs, names_count);
+  106375:	ba 06 45 10 00       	mov    $0x104506,%edx
+  10637a:	8b 45 08             	mov    0x8(%ebp),%eax
+  10637d:	e8 1a f9 ff ff       	call   105c9c <pubnames_walk>
+	if (r < 0)
+  106382:	85 c0                	test   %eax,%eax
+  106384:	0f 88 98 00 00 00    	js     106422 <dwarf_name_lookup+0x19d>
+	for (size = 16; size < 2 * nnames; size *= 2)
+  10638a:	a1 10 e3 11 00       	mov    0x11e310,%eax
+  10638f:	01 c0                	add    %eax,%eax
+  106391:	bb 10 00 00 00       	mov    $0x10,%ebx
+  106396:	eb 11                	jmp    1063a9 <dwarf_name_lookup+0x124>
+		r = funcs_walk(addrs, names_count_die);
+  106398:	ba f2 55 10 00       	mov    $0x1055f2,%edx
+  10639d:	8b 45 08             	mov    0x8(%ebp),%eax
+  1063a0:	e8 45 fb ff ff       	call   105eea <funcs_walk>
+  1063a5:	eb db                	jmp    106382 <dwarf_name_lookup+0xfd>
+	for (size = 16; size < 2 * nnames; size *= 2)
+  1063a7:	01 db                	add    %ebx,%ebx
+  1063a9:	39 c3                	cmp    %eax,%ebx
+  1063ab:	72 fa                	jb     1063a7 <dwarf_name_lookup+0x122>
+	if (!(names = dwarf_alloc(size * sizeof(*names))))
+  1063ad:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  1063b0:	c1 e0 02             	shl    $0x2,%eax
+  1063b3:	83 ec 0c             	sub    $0xc,%esp
+  1063b6:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  1063b9:	50                   	push   %eax
+  1063ba:	e8 48 f2 ff ff       	call   105607 <dwarf_alloc>
+  1063bf:	a3 18 e3 11 00       	mov    %eax,0x11e318
+  1063c4:	83 c4 10             	add    $0x10,%esp
+  1063c7:	85 c0                	test   %eax,%eax
+  1063c9:	0f 84 d2 02 00 00    	je     1066a1 <dwarf_name_lookup+0x41c>
+	memset(names, 0, size * sizeof(*names));
+  1063cf:	83 ec 04             	sub    $0x4,%esp
+  1063d2:	ff 75 d0             	push   -0x30(%ebp)
+  1063d5:	6a 00                	push   $0x0
+  1063d7:	50                   	push   %eax
+  1063d8:	e8 84 2d 00 00       	call   109161 <memset>
+	names_mask = size - 1;
+  1063dd:	83 eb 01             	sub    $0x1,%ebx
+  1063e0:	89 1d 14 e3 11 00    	mov    %ebx,0x11e314
+	nnames = 0;
+  1063e6:	c7 05 10 e3 11 00 00 	movl   $0x0,0x11e310
+  1063ed:	00 00 00 
+	if (pubnames)
+  1063f0:	83 c4 10             	add    $0x10,%esp
+  1063f3:	39 75 cc             	cmp    %esi,-0x34(%ebp)
+  1063f6:	73 51                	jae    106449 <dwarf_name_lookup+0x1c4>
+		pubnames_walk(addrs, names_insert);
+  1063f8:	ba a6 4b 10 00       	mov    $0x104ba6,%edx
+  1063fd:	8b 45 08             	mov    0x8(%ebp),%eax
+  106400:	e8 97 f8 ff ff       	call   105c9c <pubnames_walk>
+	dwarf_stats.dws_nnames = nnames;
+  106405:	a1 10 e3 11 00       	mov    0x11e310,%eax
+  10640a:	a3 dc e2 11 00       	mov    %eax,0x11e2dc
+  10640f:	0f 31                	rdtsc
+	dwarf_stats.dws_names_build = read_tsc() - tsc;
+  106411:	2b 45 c0             	sub    -0x40(%ebp),%eax
+  106414:	1b 55 c4             	sbb    -0x3c(%ebp),%edx
+  106417:	a3 e0 e2 11 00       	mov    %eax,0x11e2e0
+  10641c:	89 15 e4 e2 11 00    	mov    %edx,0x11e2e4
+	if (nameidxs) {
+  106422:	83 3d 08 e3 11 00 00 	cmpl   $0x0,0x11e308
+  106429:	0f 85 ae fe ff ff    	jne    1062dd <dwarf_name_lookup+0x58>
+			r = nameidx_lookup(addrs, &nameidxs[j], name, addr);
+	} else if (!names)
+  10642f:	83 3d 18 e3 11 00 00 	cmpl   $0x0,0x11e318
+  106436:	0f 84 5e 02 00 00    	je     10669a <dwarf_name_lookup+0x415>
+		return -E_BAD_DWARF;
+	else
+		for (i = h & names_mask; names[i].nm_name; i = (i + 1) & names_mask)
+  10643c:	89 fb                	mov    %edi,%ebx
+  10643e:	23 1d 14 e3 11 00    	and    0x11e314,%ebx
+  106444:	e9 d9 01 00 00       	jmp    106622 <dwarf_name_lookup+0x39d>
+		funcs_walk(addrs, names_insert_die);
+  106449:	ba 27 4c 10 00       	mov    $0x104c27,%edx
+  10644e:	8b 45 08             	mov    0x8(%ebp),%eax
+  106451:	e8 94 fa ff ff       	call   105eea <funcs_walk>
+  106456:	eb ad                	jmp    106405 <dwarf_name_lookup+0x180>
+		for (i = 0; i < ni->ni_nnames; i++)
+  106458:	83 c3 01             	add    $0x1,%ebx
+  10645b:	3b 5f 1c             	cmp    0x1c(%edi),%ebx
+  10645e:	73 4f                	jae    1064af <dwarf_name_lookup+0x22a>
+			if (strcmp((const char *) addrs->str_begin
+  106460:	8b 45 08             	mov    0x8(%ebp),%eax
+  106463:	8b 70 20             	mov    0x20(%eax),%esi
+				   + get_unaligned(ni->ni_strs + 4 * i, uint32_t),
+  106466:	83 ec 04             	sub    $0x4,%esp
+  106469:	6a 04                	push   $0x4
+  10646b:	8b 47 14             	mov    0x14(%edi),%eax
+  10646e:	8d 04 98             	lea    (%eax,%ebx,4),%eax
+  106471:	50                   	push   %eax
+  106472:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  106475:	50                   	push   %eax
+  106476:	e8 7d 2d 00 00       	call   1091f8 <memcpy>
+			if (strcmp((const char *) addrs->str_begin
+  10647b:	83 c4 08             	add    $0x8,%esp
+  10647e:	ff 75 0c             	push   0xc(%ebp)
+  106481:	03 75 e4             	add    -0x1c(%ebp),%esi
+  106484:	56                   	push   %esi
+  106485:	e8 37 2c 00 00       	call   1090c1 <strcmp>
+  10648a:	83 c4 10             	add    $0x10,%esp
+  10648d:	85 c0                	test   %eax,%eax
+  10648f:	75 c7                	jne    106458 <dwarf_name_lookup+0x1d3>
+			    && (r = nameidx_entries(addrs, ni, i, addr)) != -E_NO_ENT)
+  106491:	83 ec 0c             	sub    $0xc,%esp
+  106494:	ff 75 10             	push   0x10(%ebp)
+  106497:	89 d9                	mov    %ebx,%ecx
+  106499:	89 fa                	mov    %edi,%edx
+  10649b:	8b 45 08             	mov    0x8(%ebp),%eax
+  10649e:	e8 0e ed ff ff       	call   1051b1 <nameidx_entries>
+  1064a3:	83 c4 10             	add    $0x10,%esp
+  1064a6:	83 f8 f8             	cmp    $0xfffffff8,%eax
+  1064a9:	74 ad                	je     106458 <dwarf_name_lookup+0x1d3>
+  1064ab:	89 c1                	mov    %eax,%ecx
+  1064ad:	eb 05                	jmp    1064b4 <dwarf_name_lookup+0x22f>
+		return -E_NO_ENT;
+  1064af:	b9 f8 ff ff ff       	mov    $0xfffffff8,%ecx
+		for (j = 0; j < nnameidxs && r == -E_NO_ENT; j++)
+  1064b4:	83 45 c8 01          	addl   $0x1,-0x38(%ebp)
+  1064b8:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  1064bb:	39 05 04 e3 11 00    	cmp    %eax,0x11e304
+  1064c1:	0f 8e 9e 01 00 00    	jle    106665 <dwarf_name_lookup+0x3e0>
+  1064c7:	83 f9 f8             	cmp    $0xfffffff8,%ecx
+  1064ca:	0f 85 95 01 00 00    	jne    106665 <dwarf_name_lookup+0x3e0>
+			r = nameidx_lookup(addrs, &nameidxs[j], name, addr);
+  1064d0:	6b 45 c8 2c          	imul   $0x2c,-0x38(%ebp),%eax
+  1064d4:	03 05 08 e3 11 00    	add    0x11e308,%eax
+  1064da:	89 c7                	mov    %eax,%edi
+	if (ni->ni_nbuckets == 0) {
+  1064dc:	8b 58 0c             	mov    0xc(%eax),%ebx
+  1064df:	85 db                	test   %ebx,%ebx
+  1064e1:	0f 84 74 ff ff ff    	je     10645b <dwarf_name_lookup+0x1d6>
+  1064e7:	8b 55 0c             	mov    0xc(%ebp),%edx
+	uint32_t h = 5381;
+  1064ea:	b9 05 15 00 00       	mov    $0x1505,%ecx
+  1064ef:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  1064f2:	89 df                	mov    %ebx,%edi
+	for (; *s; s++) {
+  1064f4:	0f b6 02             	movzbl (%edx),%eax
+  1064f7:	84 c0                	test   %al,%al
+  1064f9:	74 1d                	je     106518 <dwarf_name_lookup+0x293>
+		if (c >= 'A' && c <= 'Z')
+  1064fb:	8d 58 bf             	lea    -0x41(%eax),%ebx
+			c += 'a' - 'A';
+  1064fe:	8d 70 20             	lea    0x20(%eax),%esi
+  106501:	80 fb 1a             	cmp    $0x1a,%bl
+  106504:	0f 42 c6             	cmovb  %esi,%eax
+		h = h * 33 + c;
+  106507:	89 cb                	mov    %ecx,%ebx
+  106509:	c1 e3 05             	shl    $0x5,%ebx
+  10650c:	01 d9                	add    %ebx,%ecx
+  10650e:	0f b6 c0             	movzbl %al,%eax
+  106511:	01 c1                	add    %eax,%ecx
+	for (; *s; s++) {
+  106513:	83 c2 01             	add    $0x1,%edx
+  106516:	eb dc                	jmp    1064f4 <dwarf_name_lookup+0x26f>
+	bucket = h % ni->ni_nbuckets;
+  106518:	89 fb                	mov    %edi,%ebx
+  10651a:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  10651d:	89 c8                	mov    %ecx,%eax
+  10651f:	89 4d c0             	mov    %ecx,-0x40(%ebp)
+  106522:	ba 00 00 00 00       	mov    $0x0,%edx
+  106527:	f7 f3                	div    %ebx
+  106529:	89 55 cc             	mov    %edx,-0x34(%ebp)
+	i = get_unaligned(ni->ni_buckets + 4 * bucket, uint32_t);
+  10652c:	83 ec 04             	sub    $0x4,%esp
+  10652f:	6a 04                	push   $0x4
+  106531:	8b 47 08             	mov    0x8(%edi),%eax
+  106534:	8d 04 90             	lea    (%eax,%edx,4),%eax
+  106537:	50                   	push   %eax
+  106538:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  10653b:	50                   	push   %eax
+  10653c:	e8 b7 2c 00 00       	call   1091f8 <memcpy>
+	for (; i != 0 && i <= ni->ni_nnames; i++) {
+  106541:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  106544:	8d 70 ff             	lea    -0x1(%eax),%esi
+  106547:	83 c4 10             	add    $0x10,%esp
+  10654a:	eb 02                	jmp    10654e <dwarf_name_lookup+0x2c9>
+	uint32_t h = 5381;
+  10654c:	89 de                	mov    %ebx,%esi
+	for (; i != 0 && i <= ni->ni_nnames; i++) {
+  10654e:	83 fe ff             	cmp    $0xffffffff,%esi
+  106551:	0f 84 b8 00 00 00    	je     10660f <dwarf_name_lookup+0x38a>
+  106557:	8d 5e 01             	lea    0x1(%esi),%ebx
+  10655a:	39 5f 1c             	cmp    %ebx,0x1c(%edi)
+  10655d:	0f 82 98 00 00 00    	jb     1065fb <dwarf_name_lookup+0x376>
+		hi = get_unaligned(ni->ni_hashes + 4 * (i - 1), uint32_t);
+  106563:	8d 04 b5 00 00 00 00 	lea    0x0(,%esi,4),%eax
+  10656a:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  10656d:	83 ec 04             	sub    $0x4,%esp
+  106570:	6a 04                	push   $0x4
+  106572:	03 47 10             	add    0x10(%edi),%eax
+  106575:	50                   	push   %eax
+  106576:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  106579:	50                   	push   %eax
+  10657a:	e8 79 2c 00 00       	call   1091f8 <memcpy>
+  10657f:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+		if (hi % ni->ni_nbuckets != bucket)
+  106582:	89 c8                	mov    %ecx,%eax
+  106584:	ba 00 00 00 00       	mov    $0x0,%edx
+  106589:	f7 77 0c             	divl   0xc(%edi)
+  10658c:	83 c4 10             	add    $0x10,%esp
+  10658f:	39 55 cc             	cmp    %edx,-0x34(%ebp)
+  106592:	75 71                	jne    106605 <dwarf_name_lookup+0x380>
+		if (hi == h
+  106594:	8b 45 c0             	mov    -0x40(%ebp),%eax
+  106597:	39 c1                	cmp    %eax,%ecx
+  106599:	75 b1                	jne    10654c <dwarf_name_lookup+0x2c7>
+		    && strcmp((const char *) addrs->str_begin
+  10659b:	8b 45 08             	mov    0x8(%ebp),%eax
+  10659e:	8b 40 20             	mov    0x20(%eax),%eax
+  1065a1:	89 45 bc             	mov    %eax,-0x44(%ebp)
+			      + get_unaligned(ni->ni_strs + 4 * (i - 1), uint32_t),
+  1065a4:	83 ec 04             	sub    $0x4,%esp
+  1065a7:	6a 04                	push   $0x4
+  1065a9:	8b 55 d0             	mov    -0x30(%ebp),%edx
+  1065ac:	03 57 14             	add    0x14(%edi),%edx
+  1065af:	52                   	push   %edx
+  1065b0:	8d 55 e4             	lea    -0x1c(%ebp),%edx
+  1065b3:	52                   	push   %edx
+  1065b4:	e8 3f 2c 00 00       	call   1091f8 <memcpy>
+		    && strcmp((const char *) addrs->str_begin
+  1065b9:	83 c4 08             	add    $0x8,%esp
+  1065bc:	ff 75 0c             	push   0xc(%ebp)
+  1065bf:	8b 45 bc             	mov    -0x44(%ebp),%eax
+  1065c2:	03 45 e4             	add    -0x1c(%ebp),%eax
+  1065c5:	50                   	push   %eax
+  1065c6:	e8 f6 2a 00 00       	call   1090c1 <strcmp>
+  1065cb:	83 c4 10             	add    $0x10,%esp
+  1065ce:	85 c0                	test   %eax,%eax
+  1065d0:	0f 85 76 ff ff ff    	jne    10654c <dwarf_name_lookup+0x2c7>
+		    && (r = nameidx_entries(addrs, ni, i - 1, addr)) != -E_NO_ENT)
+  1065d6:	83 ec 0c             	sub    $0xc,%esp
+  1065d9:	ff 75 10             	push   0x10(%ebp)
+  1065dc:	89 f1                	mov    %esi,%ecx
+  1065de:	89 fa                	mov    %edi,%edx
+  1065e0:	8b 45 08             	mov    0x8(%ebp),%eax
+  1065e3:	e8 c9 eb ff ff       	call   1051b1 <nameidx_entries>
+  1065e8:	83 c4 10             	add    $0x10,%esp
+  1065eb:	83 f8 f8             	cmp    $0xfffffff8,%eax
+  1065ee:	0f 84 58 ff ff ff    	je     10654c <dwarf_name_lookup+0x2c7>
+  1065f4:	89 c1                	mov    %eax,%ecx
+  1065f6:	e9 b9 fe ff ff       	jmp    1064b4 <dwarf_name_lookup+0x22f>
+	return -E_NO_ENT;
+  1065fb:	b9 f8 ff ff ff       	mov    $0xfffffff8,%ecx
+  106600:	e9 af fe ff ff       	jmp    1064b4 <dwarf_name_lookup+0x22f>
+  106605:	b9 f8 ff ff ff       	mov    $0xfffffff8,%ecx
+  10660a:	e9 a5 fe ff ff       	jmp    1064b4 <dwarf_name_lookup+0x22f>
+  10660f:	b9 f8 ff ff ff       	mov    $0xfffffff8,%ecx
+  106614:	e9 9b fe ff ff       	jmp    1064b4 <dwarf_name_lookup+0x22f>
+		for (i = h & names_mask; names[i].nm_name; i = (i + 1) & names_mask)
+  106619:	83 c3 01             	add    $0x1,%ebx
+  10661c:	23 1d 14 e3 11 00    	and    0x11e314,%ebx
+  106622:	8d 34 5b             	lea    (%ebx,%ebx,2),%esi
+  106625:	c1 e6 02             	shl    $0x2,%esi
+  106628:	89 f0                	mov    %esi,%eax
+  10662a:	03 05 18 e3 11 00    	add    0x11e318,%eax
+  106630:	8b 50 08             	mov    0x8(%eax),%edx
+  106633:	85 d2                	test   %edx,%edx
+  106635:	74 29                	je     106660 <dwarf_name_lookup+0x3db>
+			if (names[i].nm_hash == h
+  106637:	39 38                	cmp    %edi,(%eax)
+  106639:	75 de                	jne    106619 <dwarf_name_lookup+0x394>
+			    && strcmp(names[i].nm_name, name) == 0) {
+  10663b:	83 ec 08             	sub    $0x8,%esp
+  10663e:	ff 75 0c             	push   0xc(%ebp)
+  106641:	52                   	push   %edx
+  106642:	e8 7a 2a 00 00       	call   1090c1 <strcmp>
+  106647:	83 c4 10             	add    $0x10,%esp
+  10664a:	85 c0                	test   %eax,%eax
+  10664c:	75 cb                	jne    106619 <dwarf_name_lookup+0x394>
+				*addr = names[i].nm_addr;
+  10664e:	89 c1                	mov    %eax,%ecx
+  106650:	a1 18 e3 11 00       	mov    0x11e318,%eax
+  106655:	8b 44 30 04          	mov    0x4(%eax,%esi,1),%eax
+  106659:	8b 55 10             	mov    0x10(%ebp),%edx
+  10665c:	89 02                	mov    %eax,(%edx)
+				r = 0;
+				break;
+  10665e:	eb 05                	jmp    106665 <dwarf_name_lookup+0x3e0>
+	int r = -E_NO_ENT, j;
+  106660:	b9 f8 ff ff ff       	mov    $0xfffffff8,%ecx
+			}
+
+	dwarf_stats.dws_name_lookups++;
+  106665:	83 05 e8 e2 11 00 01 	addl   $0x1,0x11e2e8
+  10666c:	0f 31                	rdtsc
+	dwarf_stats.dws_name_cycles += read_tsc() - tsc;
+  10666e:	8b 35 ec e2 11 00    	mov    0x11e2ec,%esi
+  106674:	8b 3d f0 e2 11 00    	mov    0x11e2f0,%edi
+  10667a:	2b 75 b0             	sub    -0x50(%ebp),%esi
+  10667d:	1b 7d b4             	sbb    -0x4c(%ebp),%edi
+  106680:	01 c6                	add    %eax,%esi
+  106682:	11 d7                	adc    %edx,%edi
+  106684:	89 35 ec e2 11 00    	mov    %esi,0x11e2ec
+  10668a:	89 3d f0 e2 11 00    	mov    %edi,0x11e2f0
+	return r;
+}
+  106690:	89 c8                	mov    %ecx,%eax
+  106692:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  106695:	5b                   	pop    %ebx
+  106696:	5e                   	pop    %esi
+  106697:	5f                   	pop    %edi
+  106698:	5d                   	pop    %ebp
+  106699:	c3                   	ret
+		return -E_BAD_DWARF;
+  10669a:	b9 fa ff ff ff       	mov    $0xfffffffa,%ecx
+  10669f:	eb ef                	jmp    106690 <dwarf_name_lookup+0x40b>
+	if (nameidxs) {
+  1066a1:	83 3d 08 e3 11 00 00 	cmpl   $0x0,0x11e308
+  1066a8:	0f 85 2f fc ff ff    	jne    1062dd <dwarf_name_lookup+0x58>
+		return -E_BAD_DWARF;
+  1066ae:	b9 fa ff ff ff       	mov    $0xfffffffa,%ecx
+  1066b3:	eb db                	jmp    106690 <dwarf_name_lookup+0x40b>
+
+001066b5 <pool_free>:
+static void
+pool_free(void *p)
+{
+	struct Cu_Block *b = (struct Cu_Block *) p - 1, *prev = NULL, *next;
+
+	if (!p)
+  1066b5:	85 c0                	test   %eax,%eax
+  1066b7:	74 76                	je     10672f <pool_free+0x7a>
+{
+  1066b9:	55                   	push   %ebp
+  1066ba:	89 e5                	mov    %esp,%ebp
+  1066bc:	57                   	push   %edi
+  1066bd:	56                   	push   %esi
+  1066be:	53                   	push   %ebx
+  1066bf:	89 c3                	mov    %eax,%ebx
+  1066c1:	8d 48 f8             	lea    -0x8(%eax),%ecx
+		return;
+	dwarf_stats.dws_cu_used -= b->cb_size;
+  1066c4:	a1 00 e3 11 00       	mov    0x11e300,%eax
+  1066c9:	2b 43 f8             	sub    -0x8(%ebx),%eax
+  1066cc:	a3 00 e3 11 00       	mov    %eax,0x11e300
+	for (next = pool_free_list; next && next < b; next = next->cb_next)
+  1066d1:	a1 04 e5 11 00       	mov    0x11e504,%eax
+	struct Cu_Block *b = (struct Cu_Block *) p - 1, *prev = NULL, *next;
+  1066d6:	ba 00 00 00 00       	mov    $0x0,%edx
+	for (next = pool_free_list; next && next < b; next = next->cb_next)
+  1066db:	eb 05                	jmp    1066e2 <pool_free+0x2d>
+  1066dd:	89 c2                	mov    %eax,%edx
+  1066df:	8b 40 04             	mov    0x4(%eax),%eax
+  1066e2:	85 c0                	test   %eax,%eax
+  1066e4:	74 04                	je     1066ea <pool_free+0x35>
+  1066e6:	39 c8                	cmp    %ecx,%eax
+  1066e8:	72 f3                	jb     1066dd <pool_free+0x28>
+		prev = next;
+	if (next && (char *) b + b->cb_size == (char *) next) {
+  1066ea:	85 c0                	test   %eax,%eax
+  1066ec:	74 0a                	je     1066f8 <pool_free+0x43>
+  1066ee:	8b 73 f8             	mov    -0x8(%ebx),%esi
+  1066f1:	8d 3c 31             	lea    (%ecx,%esi,1),%edi
+  1066f4:	39 f8                	cmp    %edi,%eax
+  1066f6:	74 18                	je     106710 <pool_free+0x5b>
+		b->cb_size += next->cb_size;
+		next = next->cb_next;
+	}
+	b->cb_next = next;
+  1066f8:	89 43 fc             	mov    %eax,-0x4(%ebx)
+	if (prev && (char *) prev + prev->cb_size == (char *) b) {
+  1066fb:	85 d2                	test   %edx,%edx
+  1066fd:	74 28                	je     106727 <pool_free+0x72>
+  1066ff:	8b 02                	mov    (%edx),%eax
+  106701:	8d 34 02             	lea    (%edx,%eax,1),%esi
+  106704:	39 f1                	cmp    %esi,%ecx
+  106706:	74 12                	je     10671a <pool_free+0x65>
+		prev->cb_size += b->cb_size;
+		prev->cb_next = b->cb_next;
+	} else if (prev)
+		prev->cb_next = b;
+  106708:	89 4a 04             	mov    %ecx,0x4(%edx)
+	else
+		pool_free_list = b;
+}
+  10670b:	5b                   	pop    %ebx
+  10670c:	5e                   	pop    %esi
+  10670d:	5f                   	pop    %edi
+  10670e:	5d                   	pop    %ebp
+  10670f:	c3                   	ret
+		b->cb_size += next->cb_size;
+  106710:	03 30                	add    (%eax),%esi
+  106712:	89 73 f8             	mov    %esi,-0x8(%ebx)
+		next = next->cb_next;
+  106715:	8b 40 04             	mov    0x4(%eax),%eax
+  106718:	eb de                	jmp    1066f8 <pool_free+0x43>
+		prev->cb_size += b->cb_size;
+  10671a:	03 43 f8             	add    -0x8(%ebx),%eax
+  10671d:	89 02                	mov    %eax,(%edx)
+		prev->cb_next = b->cb_next;
+  10671f:	8b 43 fc             	mov    -0x4(%ebx),%eax
+  106722:	89 42 04             	mov    %eax,0x4(%edx)
+  106725:	eb e4                	jmp    10670b <pool_free+0x56>
+		pool_free_list = b;
+  106727:	89 0d 04 e5 11 00    	mov    %ecx,0x11e504
+  10672d:	eb dc                	jmp    10670b <pool_free+0x56>
+  10672f:	c3                   	ret
+
+00106730 <lru_unlink>:
+}
+
+static void
+lru_unlink(struct Dwarf_Cuinfo *ci)
+{
+	if (ci->ci_lru_prev)
+  106730:	8b 50 7c             	mov    0x7c(%eax),%edx
+  106733:	85 d2                	test   %edx,%edx
+  106735:	74 1d                	je     106754 <lru_unlink+0x24>
+		ci->ci_lru_prev->ci_lru_next = ci->ci_lru_next;
+  106737:	8b 88 80 00 00 00    	mov    0x80(%eax),%ecx
+  10673d:	89 8a 80 00 00 00    	mov    %ecx,0x80(%edx)
+	else
+		cu_lru_head = ci->ci_lru_next;
+	if (ci->ci_lru_next)
+  106743:	8b 90 80 00 00 00    	mov    0x80(%eax),%edx
+  106749:	85 d2                	test   %edx,%edx
+  10674b:	74 15                	je     106762 <lru_unlink+0x32>
+		ci->ci_lru_next->ci_lru_prev = ci->ci_lru_prev;
+  10674d:	8b 40 7c             	mov    0x7c(%eax),%eax
+  106750:	89 42 7c             	mov    %eax,0x7c(%edx)
+  106753:	c3                   	ret
+		cu_lru_head = ci->ci_lru_next;
+  106754:	8b 90 80 00 00 00    	mov    0x80(%eax),%edx
+  10675a:	89 15 e8 e3 11 00    	mov    %edx,0x11e3e8
+  106760:	eb e1                	jmp    106743 <lru_unlink+0x13>
+	else
+		cu_lru_tail = ci->ci_lru_prev;
+  106762:	8b 40 7c             	mov    0x7c(%eax),%eax
+  106765:	a3 e4 e3 11 00       	mov    %eax,0x11e3e4
+}
+  10676a:	c3                   	ret
+
+0010676b <lru_touch>:
+
+// Mark 'ci' as used most recently.
+static void
+lru_touch(struct Dwarf_Cuinfo *ci)
+{
+	if (ci != cu_lru_head && ci != &cu_scratch) {
+  10676b:	39 05 e8 e3 11 00    	cmp    %eax,0x11e3e8
+  106771:	74 41                	je     1067b4 <lru_touch+0x49>
+{
+  106773:	55                   	push   %ebp
+  106774:	89 e5                	mov    %esp,%ebp
+  106776:	53                   	push   %ebx
+  106777:	83 ec 04             	sub    $0x4,%esp
+  10677a:	89 c3                	mov    %eax,%ebx
+	if (ci != cu_lru_head && ci != &cu_scratch) {
+  10677c:	3d 60 e3 11 00       	cmp    $0x11e360,%eax
+  106781:	74 24                	je     1067a7 <lru_touch+0x3c>
+		lru_unlink(ci);
+  106783:	e8 a8 ff ff ff       	call   106730 <lru_unlink>
+	ci->ci_lru_prev = NULL;
+  106788:	c7 43 7c 00 00 00 00 	movl   $0x0,0x7c(%ebx)
+	ci->ci_lru_next = cu_lru_head;
+  10678f:	a1 e8 e3 11 00       	mov    0x11e3e8,%eax
+  106794:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	if (cu_lru_head)
+  10679a:	85 c0                	test   %eax,%eax
+  10679c:	74 0e                	je     1067ac <lru_touch+0x41>
+		cu_lru_head->ci_lru_prev = ci;
+  10679e:	89 58 7c             	mov    %ebx,0x7c(%eax)
+	cu_lru_head = ci;
+  1067a1:	89 1d e8 e3 11 00    	mov    %ebx,0x11e3e8
+		lru_push(ci);
+	}
+}
+  1067a7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  1067aa:	c9                   	leave
+  1067ab:	c3                   	ret
+		cu_lru_tail = ci;
+  1067ac:	89 1d e4 e3 11 00    	mov    %ebx,0x11e3e4
+  1067b2:	eb ed                	jmp    1067a1 <lru_touch+0x36>
+  1067b4:	c3                   	ret
+
+001067b5 <cu_read>:
+
+// Fill in the descriptor 'ci' of the unit at 'offset' in .debug_info.
+static int
+cu_read(const struct Dwarf_Addrs *addrs, Dwarf_Off offset,
+	struct Dwarf_Cuinfo *ci)
+{
+  1067b5:	55                   	push   %ebp
+  1067b6:	89 e5                	mov    %esp,%ebp
+  1067b8:	57                   	push   %edi
+  1067b9:	56                   	push   %esi
+  1067ba:	53                   	push   %ebx
+  1067bb:	83 ec 30             	sub    $0x30,%esp
+  1067be:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  1067c1:	89 d3                	mov    %edx,%ebx
+  1067c3:	89 cf                	mov    %ecx,%edi
+  1067c5:	8b 75 08             	mov    0x8(%ebp),%esi
+	const char *entry, *high_entry = NULL;
+	uint32_t stmt_list;
+	unsigned code;
+	int r;
+
+	memset(ci, 0, sizeof(*ci));
+  1067c8:	68 84 00 00 00       	push   $0x84
+  1067cd:	6a 00                	push   $0x0
+  1067cf:	56                   	push   %esi
+  1067d0:	e8 8c 29 00 00       	call   109161 <memset>
+	ci->ci_offset = offset;
+  1067d5:	89 1e                	mov    %ebx,(%esi)
+  1067d7:	89 7e 04             	mov    %edi,0x4(%esi)
+	ci->ci_stmt_list = DWARF_NOLINES;
+  1067da:	c7 46 40 ff ff ff ff 	movl   $0xffffffff,0x40(%esi)
+  1067e1:	c7 46 44 ff ff ff ff 	movl   $0xffffffff,0x44(%esi)
+	if ((r = dwarf_read_cu_header(addrs, addrs->info_begin + offset,
+  1067e8:	8d 56 08             	lea    0x8(%esi),%edx
+  1067eb:	89 55 cc             	mov    %edx,-0x34(%ebp)
+  1067ee:	83 c4 0c             	add    $0xc,%esp
+  1067f1:	52                   	push   %edx
+  1067f2:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  1067f5:	03 5f 10             	add    0x10(%edi),%ebx
+  1067f8:	53                   	push   %ebx
+  1067f9:	57                   	push   %edi
+  1067fa:	e8 d1 aa ff ff       	call   1012d0 <dwarf_read_cu_header>
+  1067ff:	83 c4 10             	add    $0x10,%esp
+  106802:	85 c0                	test   %eax,%eax
+  106804:	0f 88 91 01 00 00    	js     10699b <cu_read+0x1e6>
+				      &ci->ci_cu)) < 0)
+		return r;
+	if (!(ci->ci_abbrevs = dwarf_abbrevs(addrs, ci->ci_cu.cu_abbrev_offset)))
+  10680a:	83 ec 04             	sub    $0x4,%esp
+  10680d:	ff 76 18             	push   0x18(%esi)
+  106810:	ff 76 14             	push   0x14(%esi)
+  106813:	57                   	push   %edi
+  106814:	e8 84 ef ff ff       	call   10579d <dwarf_abbrevs>
+  106819:	89 c3                	mov    %eax,%ebx
+  10681b:	89 46 34             	mov    %eax,0x34(%esi)
+  10681e:	83 c4 10             	add    $0x10,%esp
+  106821:	85 c0                	test   %eax,%eax
+  106823:	0f 84 7a 01 00 00    	je     1069a3 <cu_read+0x1ee>
+		return -E_BAD_DWARF;
+
+	entry = ci->ci_cu.cu_dies;
+  106829:	8b 46 0c             	mov    0xc(%esi),%eax
+  10682c:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+	count = 0;
+  10682f:	ba 00 00 00 00       	mov    $0x0,%edx
+	result = 0;
+  106834:	bf 00 00 00 00       	mov    $0x0,%edi
+  106839:	89 5d c8             	mov    %ebx,-0x38(%ebp)
+  10683c:	89 75 08             	mov    %esi,0x8(%ebp)
+  10683f:	89 d6                	mov    %edx,%esi
+		byte = *addr;
+  106841:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  106844:	0f b6 1c 10          	movzbl (%eax,%edx,1),%ebx
+		count++;
+  106848:	83 c2 01             	add    $0x1,%edx
+		result |= (byte & 0x7f) << shift;
+  10684b:	89 d8                	mov    %ebx,%eax
+  10684d:	83 e0 7f             	and    $0x7f,%eax
+  106850:	8d 0c f5 00 00 00 00 	lea    0x0(,%esi,8),%ecx
+  106857:	29 f1                	sub    %esi,%ecx
+  106859:	d3 e0                	shl    %cl,%eax
+  10685b:	09 c7                	or     %eax,%edi
+		if (!(byte & 0x80))
+  10685d:	84 db                	test   %bl,%bl
+  10685f:	78 de                	js     10683f <cu_read+0x8a>
+	entry += dwarf_read_uleb128(entry, &code);
+	// An empty unit, like the one kernel.ld pads with
+	if (code == 0)
+		return 0;
+  106861:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+  106864:	8b 75 08             	mov    0x8(%ebp),%esi
+  106867:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (code == 0)
+  10686c:	85 ff                	test   %edi,%edi
+  10686e:	0f 84 27 01 00 00    	je     10699b <cu_read+0x1e6>
+	if (code >= at->at_ncodes || !at->at_abbrevs[code].ab_attrs)
+  106874:	3b 7b 08             	cmp    0x8(%ebx),%edi
+  106877:	0f 83 2d 01 00 00    	jae    1069aa <cu_read+0x1f5>
+  10687d:	8d 04 bf             	lea    (%edi,%edi,4),%eax
+  106880:	8b 4b 0c             	mov    0xc(%ebx),%ecx
+  106883:	8d 04 81             	lea    (%ecx,%eax,4),%eax
+  106886:	83 78 04 00          	cmpl   $0x0,0x4(%eax)
+  10688a:	0f 84 1a 01 00 00    	je     1069aa <cu_read+0x1f5>
+	entry += dwarf_read_uleb128(entry, &code);
+  106890:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  106893:	01 d7                	add    %edx,%edi
+	if (!(ci->ci_abbrev = dwarf_abbrev(ci->ci_abbrevs, code)))
+  106895:	89 46 38             	mov    %eax,0x38(%esi)
+		return -E_BAD_DWARF;
+	for (as = ci->ci_abbrev->ab_attrs; as->as_name || as->as_form; as++) {
+  106898:	8b 58 04             	mov    0x4(%eax),%ebx
+	const char *entry, *high_entry = NULL;
+  10689b:	c7 45 c8 00 00 00 00 	movl   $0x0,-0x38(%ebp)
+	const struct Dwarf_Attrspec *as, *high = NULL;
+  1068a2:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+	for (as = ci->ci_abbrev->ab_attrs; as->as_name || as->as_form; as++) {
+  1068a9:	eb 34                	jmp    1068df <cu_read+0x12a>
+		if (as->as_name == DW_AT_name)
+			ci->ci_name = dwarf_read_string(addrs, &ci->ci_cu,
+  1068ab:	57                   	push   %edi
+  1068ac:	0f b7 43 02          	movzwl 0x2(%ebx),%eax
+  1068b0:	50                   	push   %eax
+  1068b1:	ff 75 cc             	push   -0x34(%ebp)
+  1068b4:	ff 75 d0             	push   -0x30(%ebp)
+  1068b7:	e8 ba a8 ff ff       	call   101176 <dwarf_read_string>
+  1068bc:	89 46 3c             	mov    %eax,0x3c(%esi)
+  1068bf:	83 c4 10             	add    $0x10,%esp
+			high_entry = entry;
+		} else if (as->as_name == DW_AT_ranges) {
+			ci->ci_ranges_form = as->as_form;
+			ci->ci_ranges = entry;
+		}
+		entry += dwarf_read_abbrev_entry(entry, as->as_form, NULL, 0,
+  1068c2:	83 ec 0c             	sub    $0xc,%esp
+  1068c5:	ff 76 20             	push   0x20(%esi)
+  1068c8:	6a 00                	push   $0x0
+  1068ca:	6a 00                	push   $0x0
+  1068cc:	0f b7 43 02          	movzwl 0x2(%ebx),%eax
+  1068d0:	50                   	push   %eax
+  1068d1:	57                   	push   %edi
+  1068d2:	e8 d8 9f ff ff       	call   1008af <dwarf_read_abbrev_entry>
+  1068d7:	01 c7                	add    %eax,%edi
+	for (as = ci->ci_abbrev->ab_attrs; as->as_name || as->as_form; as++) {
+  1068d9:	83 c3 08             	add    $0x8,%ebx
+  1068dc:	83 c4 20             	add    $0x20,%esp
+  1068df:	83 3b 00             	cmpl   $0x0,(%ebx)
+  1068e2:	0f 84 87 00 00 00    	je     10696f <cu_read+0x1ba>
+		if (as->as_name == DW_AT_name)
+  1068e8:	0f b7 03             	movzwl (%ebx),%eax
+  1068eb:	66 83 f8 03          	cmp    $0x3,%ax
+  1068ef:	74 ba                	je     1068ab <cu_read+0xf6>
+		else if (as->as_name == DW_AT_stmt_list) {
+  1068f1:	66 83 f8 10          	cmp    $0x10,%ax
+  1068f5:	74 1e                	je     106915 <cu_read+0x160>
+		else if (as->as_name == DW_AT_low_pc)
+  1068f7:	66 83 f8 11          	cmp    $0x11,%ax
+  1068fb:	74 4b                	je     106948 <cu_read+0x193>
+		else if (as->as_name == DW_AT_high_pc) {
+  1068fd:	66 83 f8 12          	cmp    $0x12,%ax
+  106901:	74 61                	je     106964 <cu_read+0x1af>
+		} else if (as->as_name == DW_AT_ranges) {
+  106903:	66 83 f8 55          	cmp    $0x55,%ax
+  106907:	75 b9                	jne    1068c2 <cu_read+0x10d>
+			ci->ci_ranges_form = as->as_form;
+  106909:	0f b7 43 02          	movzwl 0x2(%ebx),%eax
+  10690d:	89 46 50             	mov    %eax,0x50(%esi)
+			ci->ci_ranges = entry;
+  106910:	89 7e 54             	mov    %edi,0x54(%esi)
+  106913:	eb ad                	jmp    1068c2 <cu_read+0x10d>
+			stmt_list = 0;
+  106915:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+			dwarf_read_abbrev_entry(entry, as->as_form, &stmt_list,
+  10691c:	83 ec 0c             	sub    $0xc,%esp
+  10691f:	ff 76 20             	push   0x20(%esi)
+  106922:	6a 04                	push   $0x4
+  106924:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  106927:	50                   	push   %eax
+  106928:	0f b7 43 02          	movzwl 0x2(%ebx),%eax
+  10692c:	50                   	push   %eax
+  10692d:	57                   	push   %edi
+  10692e:	e8 7c 9f ff ff       	call   1008af <dwarf_read_abbrev_entry>
+			ci->ci_stmt_list = stmt_list;
+  106933:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  106936:	89 46 40             	mov    %eax,0x40(%esi)
+  106939:	c7 46 44 00 00 00 00 	movl   $0x0,0x44(%esi)
+  106940:	83 c4 20             	add    $0x20,%esp
+  106943:	e9 7a ff ff ff       	jmp    1068c2 <cu_read+0x10d>
+			ci->ci_low_pc = dwarf_read_address(addrs, &ci->ci_cu,
+  106948:	57                   	push   %edi
+  106949:	0f b7 43 02          	movzwl 0x2(%ebx),%eax
+  10694d:	50                   	push   %eax
+  10694e:	ff 75 cc             	push   -0x34(%ebp)
+  106951:	ff 75 d0             	push   -0x30(%ebp)
+  106954:	e8 06 a9 ff ff       	call   10125f <dwarf_read_address>
+  106959:	89 46 48             	mov    %eax,0x48(%esi)
+  10695c:	83 c4 10             	add    $0x10,%esp
+  10695f:	e9 5e ff ff ff       	jmp    1068c2 <cu_read+0x10d>
+			high_entry = entry;
+  106964:	89 7d c8             	mov    %edi,-0x38(%ebp)
+			high = as;
+  106967:	89 5d d4             	mov    %ebx,-0x2c(%ebp)
+  10696a:	e9 53 ff ff ff       	jmp    1068c2 <cu_read+0x10d>
+	}
+	// DW_AT_high_pc may be an offset from a DW_AT_low_pc after it.
+	if (high)
+		ci->ci_high_pc = dwarf_read_high_pc(addrs, &ci->ci_cu, high,
+						    high_entry, ci->ci_low_pc);
+	return 0;
+  10696f:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (high)
+  106974:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+  106977:	85 c9                	test   %ecx,%ecx
+  106979:	74 20                	je     10699b <cu_read+0x1e6>
+		ci->ci_high_pc = dwarf_read_high_pc(addrs, &ci->ci_cu, high,
+  10697b:	83 ec 0c             	sub    $0xc,%esp
+  10697e:	ff 76 48             	push   0x48(%esi)
+  106981:	ff 75 c8             	push   -0x38(%ebp)
+  106984:	51                   	push   %ecx
+  106985:	ff 75 cc             	push   -0x34(%ebp)
+  106988:	ff 75 d0             	push   -0x30(%ebp)
+  10698b:	e8 af ac ff ff       	call   10163f <dwarf_read_high_pc>
+  106990:	89 46 4c             	mov    %eax,0x4c(%esi)
+  106993:	83 c4 20             	add    $0x20,%esp
+	return 0;
+  106996:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  10699b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  10699e:	5b                   	pop    %ebx
+  10699f:	5e                   	pop    %esi
+  1069a0:	5f                   	pop    %edi
+  1069a1:	5d                   	pop    %ebp
+  1069a2:	c3                   	ret
+		return -E_BAD_DWARF;
+  1069a3:	b8 fa ff ff ff       	mov    $0xfffffffa,%eax
+  1069a8:	eb f1                	jmp    10699b <cu_read+0x1e6>
+	if (!(ci->ci_abbrev = dwarf_abbrev(ci->ci_abbrevs, code)))
+  1069aa:	c7 46 38 00 00 00 00 	movl   $0x0,0x38(%esi)
+		return -E_BAD_DWARF;
+  1069b1:	b8 fa ff ff ff       	mov    $0xfffffffa,%eax
+  1069b6:	eb e3                	jmp    10699b <cu_read+0x1e6>
+
+001069b8 <dwarf_cu_alloc>:
+{
+  1069b8:	55                   	push   %ebp
+  1069b9:	89 e5                	mov    %esp,%ebp
+  1069bb:	57                   	push   %edi
+  1069bc:	56                   	push   %esi
+  1069bd:	53                   	push   %ebx
+  1069be:	83 ec 0c             	sub    $0xc,%esp
+  1069c1:	8b 7d 08             	mov    0x8(%ebp),%edi
+	if (ci == &cu_scratch || (!pool_made && !pool_make()))
+  1069c4:	81 ff 60 e3 11 00    	cmp    $0x11e360,%edi
+  1069ca:	0f 84 13 01 00 00    	je     106ae3 <dwarf_cu_alloc+0x12b>
+  1069d0:	80 3d 00 e5 11 00 00 	cmpb   $0x0,0x11e500
+  1069d7:	74 11                	je     1069ea <dwarf_cu_alloc+0x32>
+	uint32_t size = ROUNDUP(n, sizeof(struct Cu_Block))
+  1069d9:	8b 45 0c             	mov    0xc(%ebp),%eax
+  1069dc:	8d 70 07             	lea    0x7(%eax),%esi
+  1069df:	83 e6 f8             	and    $0xfffffff8,%esi
+  1069e2:	83 c6 08             	add    $0x8,%esi
+  1069e5:	e9 a2 00 00 00       	jmp    106a8c <dwarf_cu_alloc+0xd4>
+	pool_made = 1;
+  1069ea:	c6 05 00 e5 11 00 01 	movb   $0x1,0x11e500
+	if (!(pool_free_list = dwarf_alloc(DWARF_CU_BUDGET)))
+  1069f1:	83 ec 0c             	sub    $0xc,%esp
+  1069f4:	68 00 00 01 00       	push   $0x10000
+  1069f9:	e8 09 ec ff ff       	call   105607 <dwarf_alloc>
+  1069fe:	a3 04 e5 11 00       	mov    %eax,0x11e504
+  106a03:	83 c4 10             	add    $0x10,%esp
+  106a06:	85 c0                	test   %eax,%eax
+  106a08:	0f 84 c0 00 00 00    	je     106ace <dwarf_cu_alloc+0x116>
+	pool_free_list->cb_size = ROUNDDOWN(DWARF_CU_BUDGET, sizeof(struct Cu_Block));
+  106a0e:	c7 00 00 00 01 00    	movl   $0x10000,(%eax)
+	pool_free_list->cb_next = NULL;
+  106a14:	a1 04 e5 11 00       	mov    0x11e504,%eax
+  106a19:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+	return 1;
+  106a20:	eb b7                	jmp    1069d9 <dwarf_cu_alloc+0x21>
+		if (!cu_lru_tail || cu_lru_tail == ci)
+  106a22:	a1 e4 e3 11 00       	mov    0x11e3e4,%eax
+  106a27:	39 f8                	cmp    %edi,%eax
+  106a29:	0f 84 bb 00 00 00    	je     106aea <dwarf_cu_alloc+0x132>
+  106a2f:	85 c0                	test   %eax,%eax
+  106a31:	0f 84 b3 00 00 00    	je     106aea <dwarf_cu_alloc+0x132>
+	return &cu_buckets[(uint32_t) offset * 2654435761U >> 26];
+  106a37:	69 08 b1 79 37 9e    	imul   $0x9e3779b1,(%eax),%ecx
+  106a3d:	c1 e9 1a             	shr    $0x1a,%ecx
+  106a40:	8d 14 8d 00 e4 11 00 	lea    0x11e400(,%ecx,4),%edx
+  106a47:	8b 1c 8d 00 e4 11 00 	mov    0x11e400(,%ecx,4),%ebx
+	for (cp = cu_bucket(ci->ci_offset); *cp != ci; cp = &(*cp)->ci_hash_next)
+  106a4e:	eb 06                	jmp    106a56 <dwarf_cu_alloc+0x9e>
+  106a50:	8d 53 78             	lea    0x78(%ebx),%edx
+  106a53:	8b 5b 78             	mov    0x78(%ebx),%ebx
+  106a56:	39 d8                	cmp    %ebx,%eax
+  106a58:	75 f6                	jne    106a50 <dwarf_cu_alloc+0x98>
+	*cp = ci->ci_hash_next;
+  106a5a:	8b 43 78             	mov    0x78(%ebx),%eax
+  106a5d:	89 02                	mov    %eax,(%edx)
+	lru_unlink(ci);
+  106a5f:	89 d8                	mov    %ebx,%eax
+  106a61:	e8 ca fc ff ff       	call   106730 <lru_unlink>
+	pool_free(ci->ci_lines);
+  106a66:	8b 43 58             	mov    0x58(%ebx),%eax
+  106a69:	e8 47 fc ff ff       	call   1066b5 <pool_free>
+	pool_free(ci->ci_funcs);
+  106a6e:	8b 43 5c             	mov    0x5c(%ebx),%eax
+  106a71:	e8 3f fc ff ff       	call   1066b5 <pool_free>
+	pool_free(ci->ci_inlines);
+  106a76:	8b 43 64             	mov    0x64(%ebx),%eax
+  106a79:	e8 37 fc ff ff       	call   1066b5 <pool_free>
+	pool_free(ci);
+  106a7e:	89 d8                	mov    %ebx,%eax
+  106a80:	e8 30 fc ff ff       	call   1066b5 <pool_free>
+	dwarf_stats.dws_cu_evictions++;
+  106a85:	83 05 fc e2 11 00 01 	addl   $0x1,0x11e2fc
+	for (bp = &pool_free_list; (b = *bp) != NULL; bp = &b->cb_next) {
+  106a8c:	a1 04 e5 11 00       	mov    0x11e504,%eax
+  106a91:	b9 04 e5 11 00       	mov    $0x11e504,%ecx
+	if (n > DWARF_CU_BUDGET)
+  106a96:	81 7d 0c 00 00 01 00 	cmpl   $0x10000,0xc(%ebp)
+  106a9d:	77 83                	ja     106a22 <dwarf_cu_alloc+0x6a>
+	for (bp = &pool_free_list; (b = *bp) != NULL; bp = &b->cb_next) {
+  106a9f:	85 c0                	test   %eax,%eax
+  106aa1:	0f 84 7b ff ff ff    	je     106a22 <dwarf_cu_alloc+0x6a>
+		if (b->cb_size < size)
+  106aa7:	8b 10                	mov    (%eax),%edx
+  106aa9:	39 f2                	cmp    %esi,%edx
+  106aab:	72 29                	jb     106ad6 <dwarf_cu_alloc+0x11e>
+		if (b->cb_size - size >= 2 * sizeof(struct Cu_Block)) {
+  106aad:	29 f2                	sub    %esi,%edx
+  106aaf:	83 fa 0f             	cmp    $0xf,%edx
+  106ab2:	76 2a                	jbe    106ade <dwarf_cu_alloc+0x126>
+			rest = (struct Cu_Block *) ((char *) b + size);
+  106ab4:	8d 1c 30             	lea    (%eax,%esi,1),%ebx
+			rest->cb_size = b->cb_size - size;
+  106ab7:	89 13                	mov    %edx,(%ebx)
+			rest->cb_next = b->cb_next;
+  106ab9:	8b 50 04             	mov    0x4(%eax),%edx
+  106abc:	89 53 04             	mov    %edx,0x4(%ebx)
+			b->cb_size = size;
+  106abf:	89 30                	mov    %esi,(%eax)
+			*bp = rest;
+  106ac1:	89 19                	mov    %ebx,(%ecx)
+		dwarf_stats.dws_cu_used += b->cb_size;
+  106ac3:	8b 10                	mov    (%eax),%edx
+  106ac5:	01 15 00 e3 11 00    	add    %edx,0x11e300
+		return b + 1;
+  106acb:	83 c0 08             	add    $0x8,%eax
+}
+  106ace:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  106ad1:	5b                   	pop    %ebx
+  106ad2:	5e                   	pop    %esi
+  106ad3:	5f                   	pop    %edi
+  106ad4:	5d                   	pop    %ebp
+  106ad5:	c3                   	ret
+	for (bp = &pool_free_list; (b = *bp) != NULL; bp = &b->cb_next) {
+  106ad6:	8d 48 04             	lea    0x4(%eax),%ecx
+  106ad9:	8b 40 04             	mov    0x4(%eax),%eax
+  106adc:	eb c1                	jmp    106a9f <dwarf_cu_alloc+0xe7>
+			*bp = b->cb_next;
+  106ade:	8b 58 04             	mov    0x4(%eax),%ebx
+  106ae1:	eb de                	jmp    106ac1 <dwarf_cu_alloc+0x109>
+		return NULL;
+  106ae3:	b8 00 00 00 00       	mov    $0x0,%eax
+  106ae8:	eb e4                	jmp    106ace <dwarf_cu_alloc+0x116>
+			return NULL;
+  106aea:	b8 00 00 00 00       	mov    $0x0,%eax
+  106aef:	eb dd                	jmp    106ace <dwarf_cu_alloc+0x116>
+
+00106af1 <dwarf_cu_get>:
+// *store.  The descriptor is good until the next call, which may evict
+// it.  Returns -E_BAD_DWARF if the unit is malformed.
+int
+dwarf_cu_get(const struct Dwarf_Addrs *addrs, Dwarf_Off offset,
+	     struct Dwarf_Cuinfo **store)
+{
+  106af1:	55                   	push   %ebp
+  106af2:	89 e5                	mov    %esp,%ebp
+  106af4:	57                   	push   %edi
+  106af5:	56                   	push   %esi
+  106af6:	53                   	push   %ebx
+  106af7:	83 ec 1c             	sub    $0x1c,%esp
+  106afa:	8b 75 0c             	mov    0xc(%ebp),%esi
+  106afd:	8b 7d 10             	mov    0x10(%ebp),%edi
+	return &cu_buckets[(uint32_t) offset * 2654435761U >> 26];
+  106b00:	69 c6 b1 79 37 9e    	imul   $0x9e3779b1,%esi,%eax
+  106b06:	c1 e8 1a             	shr    $0x1a,%eax
+  106b09:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	struct Dwarf_Cuinfo *ci, **bucket = cu_bucket(offset);
+	int r;
+
+	if ((r = dwarf_need(DWARF_DIES)) < 0)
+		return r;
+	for (ci = *bucket; ci; ci = ci->ci_hash_next)
+  106b0c:	8b 1c 85 00 e4 11 00 	mov    0x11e400(,%eax,4),%ebx
+  106b13:	eb 03                	jmp    106b18 <dwarf_cu_get+0x27>
+  106b15:	8b 5b 78             	mov    0x78(%ebx),%ebx
+  106b18:	85 db                	test   %ebx,%ebx
+  106b1a:	74 2f                	je     106b4b <dwarf_cu_get+0x5a>
+		if (ci->ci_offset == offset) {
+  106b1c:	89 f0                	mov    %esi,%eax
+  106b1e:	89 fa                	mov    %edi,%edx
+  106b20:	33 03                	xor    (%ebx),%eax
+  106b22:	33 53 04             	xor    0x4(%ebx),%edx
+  106b25:	09 d0                	or     %edx,%eax
+  106b27:	75 ec                	jne    106b15 <dwarf_cu_get+0x24>
+			lru_touch(ci);
+  106b29:	89 d8                	mov    %ebx,%eax
+  106b2b:	e8 3b fc ff ff       	call   10676b <lru_touch>
+			dwarf_stats.dws_cu_hits++;
+  106b30:	83 05 f4 e2 11 00 01 	addl   $0x1,0x11e2f4
+			*store = ci;
+  106b37:	8b 45 14             	mov    0x14(%ebp),%eax
+  106b3a:	89 18                	mov    %ebx,(%eax)
+			return 0;
+  106b3c:	be 00 00 00 00       	mov    $0x0,%esi
+	ci->ci_hash_next = *bucket;
+	*bucket = ci;
+	lru_push(ci);
+	*store = ci;
+	return 0;
+}
+  106b41:	89 f0                	mov    %esi,%eax
+  106b43:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  106b46:	5b                   	pop    %ebx
+  106b47:	5e                   	pop    %esi
+  106b48:	5f                   	pop    %edi
+  106b49:	5d                   	pop    %ebp
+  106b4a:	c3                   	ret
+	dwarf_stats.dws_cu_misses++;
+  106b4b:	83 05 f8 e2 11 00 01 	addl   $0x1,0x11e2f8
+	if (offset >= addrs->info_end - addrs->info_begin)
+  106b52:	8b 45 08             	mov    0x8(%ebp),%eax
+  106b55:	8b 48 14             	mov    0x14(%eax),%ecx
+  106b58:	2b 48 10             	sub    0x10(%eax),%ecx
+  106b5b:	89 c8                	mov    %ecx,%eax
+  106b5d:	99                   	cltd
+  106b5e:	39 ce                	cmp    %ecx,%esi
+  106b60:	89 f9                	mov    %edi,%ecx
+  106b62:	19 d1                	sbb    %edx,%ecx
+  106b64:	0f 83 d4 00 00 00    	jae    106c3e <dwarf_cu_get+0x14d>
+	if (!(ci = dwarf_cu_alloc(NULL, sizeof(*ci)))) {
+  106b6a:	83 ec 08             	sub    $0x8,%esp
+  106b6d:	68 84 00 00 00       	push   $0x84
+  106b72:	6a 00                	push   $0x0
+  106b74:	e8 3f fe ff ff       	call   1069b8 <dwarf_cu_alloc>
+  106b79:	89 c3                	mov    %eax,%ebx
+  106b7b:	83 c4 10             	add    $0x10,%esp
+  106b7e:	85 c0                	test   %eax,%eax
+  106b80:	74 5f                	je     106be1 <dwarf_cu_get+0xf0>
+	if ((r = cu_read(addrs, offset, ci)) < 0) {
+  106b82:	83 ec 0c             	sub    $0xc,%esp
+  106b85:	50                   	push   %eax
+  106b86:	89 f2                	mov    %esi,%edx
+  106b88:	89 f9                	mov    %edi,%ecx
+  106b8a:	8b 45 08             	mov    0x8(%ebp),%eax
+  106b8d:	e8 23 fc ff ff       	call   1067b5 <cu_read>
+  106b92:	89 c6                	mov    %eax,%esi
+  106b94:	83 c4 10             	add    $0x10,%esp
+  106b97:	85 c0                	test   %eax,%eax
+  106b99:	0f 88 8b 00 00 00    	js     106c2a <dwarf_cu_get+0x139>
+	ci->ci_hash_next = *bucket;
+  106b9f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  106ba2:	8b 04 bd 00 e4 11 00 	mov    0x11e400(,%edi,4),%eax
+  106ba9:	89 43 78             	mov    %eax,0x78(%ebx)
+	*bucket = ci;
+  106bac:	89 1c bd 00 e4 11 00 	mov    %ebx,0x11e400(,%edi,4)
+	ci->ci_lru_prev = NULL;
+  106bb3:	c7 43 7c 00 00 00 00 	movl   $0x0,0x7c(%ebx)
+	ci->ci_lru_next = cu_lru_head;
+  106bba:	a1 e8 e3 11 00       	mov    0x11e3e8,%eax
+  106bbf:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	if (cu_lru_head)
+  106bc5:	85 c0                	test   %eax,%eax
+  106bc7:	74 6d                	je     106c36 <dwarf_cu_get+0x145>
+		cu_lru_head->ci_lru_prev = ci;
+  106bc9:	89 58 7c             	mov    %ebx,0x7c(%eax)
+	cu_lru_head = ci;
+  106bcc:	89 1d e8 e3 11 00    	mov    %ebx,0x11e3e8
+	*store = ci;
+  106bd2:	8b 45 14             	mov    0x14(%ebp),%eax
+  106bd5:	89 18                	mov    %ebx,(%eax)
+	return 0;
+  106bd7:	be 00 00 00 00       	mov    $0x0,%esi
+  106bdc:	e9 60 ff ff ff       	jmp    106b41 <dwarf_cu_get+0x50>
+		if ((r = cu_read(addrs, offset, &cu_scratch)) < 0)
+  106be1:	83 ec 0c             	sub    $0xc,%esp
+  106be4:	68 60 e3 11 00       	push   $0x11e360
+  106be9:	89 f2                	mov    %esi,%edx
+  106beb:	89 f9                	mov    %edi,%ecx
+  106bed:	8b 45 08             	mov    0x8(%ebp),%eax
+  106bf0:	e8 c0 fb ff ff       	call   1067b5 <cu_read>
+  106bf5:	89 c6                	mov    %eax,%esi
+  106bf7:	83 c4 10             	add    $0x10,%esp
+  106bfa:	85 c0                	test   %eax,%eax
+  106bfc:	0f 88 3f ff ff ff    	js     106b41 <dwarf_cu_get+0x50>
+		cu_scratch.ci_lines_tried = cu_scratch.ci_funcs_tried = 1;
+  106c02:	c6 05 d5 e3 11 00 01 	movb   $0x1,0x11e3d5
+  106c09:	c6 05 d4 e3 11 00 01 	movb   $0x1,0x11e3d4
+		cu_scratch.ci_inlines_tried = 1;
+  106c10:	c6 05 d6 e3 11 00 01 	movb   $0x1,0x11e3d6
+		*store = &cu_scratch;
+  106c17:	8b 45 14             	mov    0x14(%ebp),%eax
+  106c1a:	c7 00 60 e3 11 00    	movl   $0x11e360,(%eax)
+		return 0;
+  106c20:	be 00 00 00 00       	mov    $0x0,%esi
+  106c25:	e9 17 ff ff ff       	jmp    106b41 <dwarf_cu_get+0x50>
+		pool_free(ci);
+  106c2a:	89 d8                	mov    %ebx,%eax
+  106c2c:	e8 84 fa ff ff       	call   1066b5 <pool_free>
+		return r;
+  106c31:	e9 0b ff ff ff       	jmp    106b41 <dwarf_cu_get+0x50>
+		cu_lru_tail = ci;
+  106c36:	89 1d e4 e3 11 00    	mov    %ebx,0x11e3e4
+  106c3c:	eb 8e                	jmp    106bcc <dwarf_cu_get+0xdb>
+		return -E_BAD_DWARF;
+  106c3e:	be fa ff ff ff       	mov    $0xfffffffa,%esi
+  106c43:	e9 f9 fe ff ff       	jmp    106b41 <dwarf_cu_get+0x50>
+
+00106c48 <dwarf_cu_by_lines>:
+// The cached unit whose line program is at 'line_offset' in .debug_line,
+// or NULL if none is.  The unit has just been looked up, most likely, so
+// it is near the front.
+struct Dwarf_Cuinfo *
+dwarf_cu_by_lines(Dwarf_Off line_offset)
+{
+  106c48:	55                   	push   %ebp
+  106c49:	89 e5                	mov    %esp,%ebp
+  106c4b:	57                   	push   %edi
+  106c4c:	56                   	push   %esi
+  106c4d:	53                   	push   %ebx
+  106c4e:	83 ec 0c             	sub    $0xc,%esp
+  106c51:	8b 75 08             	mov    0x8(%ebp),%esi
+  106c54:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	struct Dwarf_Cuinfo *ci;
+
+	for (ci = cu_lru_head; ci; ci = ci->ci_lru_next)
+  106c57:	8b 1d e8 e3 11 00    	mov    0x11e3e8,%ebx
+  106c5d:	eb 06                	jmp    106c65 <dwarf_cu_by_lines+0x1d>
+  106c5f:	8b 9b 80 00 00 00    	mov    0x80(%ebx),%ebx
+  106c65:	85 db                	test   %ebx,%ebx
+  106c67:	74 15                	je     106c7e <dwarf_cu_by_lines+0x36>
+		if (ci->ci_stmt_list == line_offset) {
+  106c69:	89 f0                	mov    %esi,%eax
+  106c6b:	89 fa                	mov    %edi,%edx
+  106c6d:	33 43 40             	xor    0x40(%ebx),%eax
+  106c70:	33 53 44             	xor    0x44(%ebx),%edx
+  106c73:	09 d0                	or     %edx,%eax
+  106c75:	75 e8                	jne    106c5f <dwarf_cu_by_lines+0x17>
+			lru_touch(ci);
+  106c77:	89 d8                	mov    %ebx,%eax
+  106c79:	e8 ed fa ff ff       	call   10676b <lru_touch>
+			return ci;
+		}
+	return NULL;
+}
+  106c7e:	89 d8                	mov    %ebx,%eax
+  106c80:	83 c4 0c             	add    $0xc,%esp
+  106c83:	5b                   	pop    %ebx
+  106c84:	5e                   	pop    %esi
+  106c85:	5f                   	pop    %edi
+  106c86:	5d                   	pop    %ebp
+  106c87:	c3                   	ret
+
+00106c88 <mon_help>:
+
+/***** Implementations of basic kernel monitor commands *****/
+
+int
+mon_help(int argc, char **argv, struct Trapframe *tf)
+{
+  106c88:	55                   	push   %ebp
+  106c89:	89 e5                	mov    %esp,%ebp
+  106c8b:	56                   	push   %esi
+  106c8c:	53                   	push   %ebx
+	int i;
+
+	for (i = 0; i < NCOMMANDS; i++)
+  106c8d:	bb c0 a3 10 00       	mov    $0x10a3c0,%ebx
+  106c92:	be 14 a4 10 00       	mov    $0x10a414,%esi
+  106c97:	eb 18                	jmp    106cb1 <mon_help+0x29>
+		cprintf("%s - %s\n", commands[i].name, commands[i].desc);
+  106c99:	83 ec 04             	sub    $0x4,%esp
+  106c9c:	ff 73 04             	push   0x4(%ebx)
+  106c9f:	ff 33                	push   (%ebx)
+  106ca1:	68 da 9b 10 00       	push   $0x109bda
+  106ca6:	e8 89 0b 00 00       	call   107834 <cprintf>
+	for (i = 0; i < NCOMMANDS; i++)
+  106cab:	83 c3 0c             	add    $0xc,%ebx
+  106cae:	83 c4 10             	add    $0x10,%esp
+  106cb1:	39 f3                	cmp    %esi,%ebx
+  106cb3:	75 e4                	jne    106c99 <mon_help+0x11>
+	return 0;
+}
+  106cb5:	b8 00 00 00 00       	mov    $0x0,%eax
+  106cba:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  106cbd:	5b                   	pop    %ebx
+  106cbe:	5e                   	pop    %esi
+  106cbf:	5d                   	pop    %ebp
+  106cc0:	c3                   	ret
+
+00106cc1 <mon_kerninfo>:
+
+int
+mon_kerninfo(int argc, char **argv, struct Trapframe *tf)
+{
+  106cc1:	55                   	push   %ebp
+  106cc2:	89 e5                	mov    %esp,%ebp
+  106cc4:	83 ec 14             	sub    $0x14,%esp
+	extern char _start[], entry[], etext[], edata[], end[];
+#ifdef CONFIG_DWARF_LAZY
+	uint32_t nread, ninflated;
+#endif
+
+	cprintf("Special kernel symbols:\n");
+  106cc7:	68 e3 9b 10 00       	push   $0x109be3
+  106ccc:	e8 63 0b 00 00       	call   107834 <cprintf>
+	cprintf("  _start                  %08x (phys)\n", (uint32_t)_start);
+  106cd1:	83 c4 08             	add    $0x8,%esp
+  106cd4:	68 0c 00 10 00       	push   $0x10000c
+  106cd9:	68 a4 9d 10 00       	push   $0x109da4
+  106cde:	e8 51 0b 00 00       	call   107834 <cprintf>
+	cprintf("  entry  %08x (virt)  %08x (phys)\n",
+  106ce3:	83 c4 0c             	add    $0xc,%esp
+  106ce6:	68 0c 00 10 00       	push   $0x10000c
+  106ceb:	68 0c 00 10 00       	push   $0x10000c
+  106cf0:	68 cc 9d 10 00       	push   $0x109dcc
+  106cf5:	e8 3a 0b 00 00       	call   107834 <cprintf>
+            (uint32_t)entry, (uint32_t)entry - KERNTOP);
+	cprintf("  etext  %08x (virt)  %08x (phys)\n",
+  106cfa:	83 c4 0c             	add    $0xc,%esp
+  106cfd:	68 72 94 10 00       	push   $0x109472
+  106d02:	68 72 94 10 00       	push   $0x109472
+  106d07:	68 f0 9d 10 00       	push   $0x109df0
+  106d0c:	e8 23 0b 00 00       	call   107834 <cprintf>
+            (uint32_t)etext, (uint32_t)etext - KERNTOP);
+	cprintf("  edata  %08x (virt)  %08x (phys)\n",
+  106d11:	83 c4 0c             	add    $0xc,%esp
+  106d14:	68 00 e0 11 00       	push   $0x11e000
+  106d19:	68 00 e0 11 00       	push   $0x11e000
+  106d1e:	68 14 9e 10 00       	push   $0x109e14
+  106d23:	e8 0c 0b 00 00       	call   107834 <cprintf>
+            (uint32_t)edata, (uint32_t)edata - KERNTOP);
+	cprintf("  end    %08x (virt)  %08x (phys)\n",
+  106d28:	83 c4 0c             	add    $0xc,%esp
+  106d2b:	68 c0 11 12 00       	push   $0x1211c0
+  106d30:	68 c0 11 12 00       	push   $0x1211c0
+  106d35:	68 38 9e 10 00       	push   $0x109e38
+  106d3a:	e8 f5 0a 00 00       	call   107834 <cprintf>
+            (uint32_t)end, (uint32_t)end - KERNTOP);
+	cprintf("Kernel executable memory footprint: %dKB\n",
+  106d3f:	83 c4 08             	add    $0x8,%esp
+            (uint32_t)ROUNDUP(end - entry, 1024) / 1024);
+  106d42:	b8 c0 11 12 00       	mov    $0x1211c0,%eax
+  106d47:	2d 0d fc 0f 00       	sub    $0xffc0d,%eax
+	cprintf("Kernel executable memory footprint: %dKB\n",
+  106d4c:	c1 e8 0a             	shr    $0xa,%eax
+  106d4f:	50                   	push   %eax
+  106d50:	68 5c 9e 10 00       	push   $0x109e5c
+  106d55:	e8 da 0a 00 00       	call   107834 <cprintf>
+	dwarf_lazy_stats(&nread, &ninflated);
+	cprintf("Debug sections read on demand: %u bytes from disk,"
+		" %u bytes inflated\n", nread, ninflated);
+#endif
+	return 0;
+}
+  106d5a:	b8 00 00 00 00       	mov    $0x0,%eax
+  106d5f:	c9                   	leave
+  106d60:	c3                   	ret
+
+00106d61 <mon_dwarfstats>:
+	return 0;
+}
+
+int
+mon_dwarfstats(int argc, char **argv, struct Trapframe *tf)
+{
+  106d61:	55                   	push   %ebp
+  106d62:	89 e5                	mov    %esp,%ebp
+  106d64:	53                   	push   %ebx
+  106d65:	83 ec 0c             	sub    $0xc,%esp
+	struct Dwarf_Stats *st = &dwarf_stats;
+
+	cprintf("Index memory: %u bytes\n", st->dws_arena_used);
+  106d68:	ff 35 60 e2 11 00    	push   0x11e260
+  106d6e:	68 fc 9b 10 00       	push   $0x109bfc
+  106d73:	e8 bc 0a 00 00       	call   107834 <cprintf>
+	cprintf("CU index: %u ranges, built in %llu cycles\n",
+  106d78:	ff 35 6c e2 11 00    	push   0x11e26c
+  106d7e:	ff 35 68 e2 11 00    	push   0x11e268
+  106d84:	ff 35 64 e2 11 00    	push   0x11e264
+  106d8a:	68 88 9e 10 00       	push   $0x109e88
+  106d8f:	e8 a0 0a 00 00       	call   107834 <cprintf>
+		st->dws_naranges, st->dws_aranges_build);
+	cprintf("CU lookups: %u, %llu cycles each\n", st->dws_arange_lookups,
+		st->dws_arange_lookups
+  106d94:	8b 1d 70 e2 11 00    	mov    0x11e270,%ebx
+	cprintf("CU lookups: %u, %llu cycles each\n", st->dws_arange_lookups,
+  106d9a:	83 c4 20             	add    $0x20,%esp
+  106d9d:	b8 00 00 00 00       	mov    $0x0,%eax
+  106da2:	ba 00 00 00 00       	mov    $0x0,%edx
+  106da7:	85 db                	test   %ebx,%ebx
+  106da9:	74 1b                	je     106dc6 <mon_dwarfstats+0x65>
+		? st->dws_arange_cycles / st->dws_arange_lookups : 0);
+  106dab:	ba 00 00 00 00       	mov    $0x0,%edx
+	cprintf("CU lookups: %u, %llu cycles each\n", st->dws_arange_lookups,
+  106db0:	52                   	push   %edx
+  106db1:	53                   	push   %ebx
+  106db2:	ff 35 78 e2 11 00    	push   0x11e278
+  106db8:	ff 35 74 e2 11 00    	push   0x11e274
+  106dbe:	e8 68 26 00 00       	call   10942b <__udivdi3>
+  106dc3:	83 c4 10             	add    $0x10,%esp
+  106dc6:	52                   	push   %edx
+  106dc7:	50                   	push   %eax
+  106dc8:	53                   	push   %ebx
+  106dc9:	68 b4 9e 10 00       	push   $0x109eb4
+  106dce:	e8 61 0a 00 00       	call   107834 <cprintf>
+	cprintf("Abbreviation tables: %u decoded in %llu cycles\n",
+  106dd3:	ff 35 84 e2 11 00    	push   0x11e284
+  106dd9:	ff 35 80 e2 11 00    	push   0x11e280
+  106ddf:	ff 35 7c e2 11 00    	push   0x11e27c
+  106de5:	68 d8 9e 10 00       	push   $0x109ed8
+  106dea:	e8 45 0a 00 00       	call   107834 <cprintf>
+		st->dws_nabbrevtabs, st->dws_abbrev_build);
+	cprintf("CU cache: %u bytes used, %u hits, %u misses, %u evictions\n",
+  106def:	83 c4 14             	add    $0x14,%esp
+  106df2:	ff 35 fc e2 11 00    	push   0x11e2fc
+  106df8:	ff 35 f8 e2 11 00    	push   0x11e2f8
+  106dfe:	ff 35 f4 e2 11 00    	push   0x11e2f4
+  106e04:	ff 35 00 e3 11 00    	push   0x11e300
+  106e0a:	68 08 9f 10 00       	push   $0x109f08
+  106e0f:	e8 20 0a 00 00       	call   107834 <cprintf>
+		st->dws_cu_used, st->dws_cu_hits, st->dws_cu_misses,
+		st->dws_cu_evictions);
+	cprintf("Function indexes: %u functions, built in %llu cycles\n",
+  106e14:	83 c4 20             	add    $0x20,%esp
+  106e17:	ff 35 90 e2 11 00    	push   0x11e290
+  106e1d:	ff 35 8c e2 11 00    	push   0x11e28c
+  106e23:	ff 35 88 e2 11 00    	push   0x11e288
+  106e29:	68 44 9f 10 00       	push   $0x109f44
+  106e2e:	e8 01 0a 00 00       	call   107834 <cprintf>
+		st->dws_nfuncs, st->dws_funcs_build);
+	cprintf("Function lookups: %u, %llu cycles each\n", st->dws_func_lookups,
+		st->dws_func_lookups
+  106e33:	8b 1d 94 e2 11 00    	mov    0x11e294,%ebx
+	cprintf("Function lookups: %u, %llu cycles each\n", st->dws_func_lookups,
+  106e39:	83 c4 10             	add    $0x10,%esp
+  106e3c:	b8 00 00 00 00       	mov    $0x0,%eax
+  106e41:	ba 00 00 00 00       	mov    $0x0,%edx
+  106e46:	85 db                	test   %ebx,%ebx
+  106e48:	74 1b                	je     106e65 <mon_dwarfstats+0x104>
+		? st->dws_func_cycles / st->dws_func_lookups : 0);
+  106e4a:	ba 00 00 00 00       	mov    $0x0,%edx
+	cprintf("Function lookups: %u, %llu cycles each\n", st->dws_func_lookups,
+  106e4f:	52                   	push   %edx
+  106e50:	53                   	push   %ebx
+  106e51:	ff 35 9c e2 11 00    	push   0x11e29c
+  106e57:	ff 35 98 e2 11 00    	push   0x11e298
+  106e5d:	e8 c9 25 00 00       	call   10942b <__udivdi3>
+  106e62:	83 c4 10             	add    $0x10,%esp
+  106e65:	52                   	push   %edx
+  106e66:	50                   	push   %eax
+  106e67:	53                   	push   %ebx
+  106e68:	68 7c 9f 10 00       	push   $0x109f7c
+  106e6d:	e8 c2 09 00 00       	call   107834 <cprintf>
+	cprintf("Line tables: %u decoded into %u bytes in %llu cycles\n",
+  106e72:	83 c4 04             	add    $0x4,%esp
+  106e75:	ff 35 ac e2 11 00    	push   0x11e2ac
+  106e7b:	ff 35 a8 e2 11 00    	push   0x11e2a8
+  106e81:	ff 35 a4 e2 11 00    	push   0x11e2a4
+  106e87:	ff 35 a0 e2 11 00    	push   0x11e2a0
+  106e8d:	68 a4 9f 10 00       	push   $0x109fa4
+  106e92:	e8 9d 09 00 00       	call   107834 <cprintf>
+		st->dws_nlinetabs, st->dws_linetabs_size, st->dws_lines_build);
+	cprintf("Line lookups: %u, %llu cycles each\n", st->dws_line_lookups,
+		st->dws_line_lookups
+  106e97:	8b 1d b0 e2 11 00    	mov    0x11e2b0,%ebx
+	cprintf("Line lookups: %u, %llu cycles each\n", st->dws_line_lookups,
+  106e9d:	83 c4 20             	add    $0x20,%esp
+  106ea0:	b8 00 00 00 00       	mov    $0x0,%eax
+  106ea5:	ba 00 00 00 00       	mov    $0x0,%edx
+  106eaa:	85 db                	test   %ebx,%ebx
+  106eac:	74 1b                	je     106ec9 <mon_dwarfstats+0x168>
+		? st->dws_line_cycles / st->dws_line_lookups : 0);
+  106eae:	ba 00 00 00 00       	mov    $0x0,%edx
+	cprintf("Line lookups: %u, %llu cycles each\n", st->dws_line_lookups,
+  106eb3:	52                   	push   %edx
+  106eb4:	53                   	push   %ebx
+  106eb5:	ff 35 b8 e2 11 00    	push   0x11e2b8
+  106ebb:	ff 35 b4 e2 11 00    	push   0x11e2b4
+  106ec1:	e8 65 25 00 00       	call   10942b <__udivdi3>
+  106ec6:	83 c4 10             	add    $0x10,%esp
+  106ec9:	52                   	push   %edx
+  106eca:	50                   	push   %eax
+  106ecb:	53                   	push   %ebx
+  106ecc:	68 dc 9f 10 00       	push   $0x109fdc
+  106ed1:	e8 5e 09 00 00       	call   107834 <cprintf>
+	cprintf("Inline indexes: %u pieces, built in %llu cycles\n",
+  106ed6:	ff 35 c4 e2 11 00    	push   0x11e2c4
+  106edc:	ff 35 c0 e2 11 00    	push   0x11e2c0
+  106ee2:	ff 35 bc e2 11 00    	push   0x11e2bc
+  106ee8:	68 00 a0 10 00       	push   $0x10a000
+  106eed:	e8 42 09 00 00       	call   107834 <cprintf>
+		st->dws_ninlines, st->dws_inlines_build);
+	cprintf("Inline lookups: %u, %llu cycles each\n",
+		st->dws_inline_lookups, st->dws_inline_lookups
+  106ef2:	8b 1d c8 e2 11 00    	mov    0x11e2c8,%ebx
+	cprintf("Inline lookups: %u, %llu cycles each\n",
+  106ef8:	83 c4 20             	add    $0x20,%esp
+  106efb:	b8 00 00 00 00       	mov    $0x0,%eax
+  106f00:	ba 00 00 00 00       	mov    $0x0,%edx
+  106f05:	85 db                	test   %ebx,%ebx
+  106f07:	74 1b                	je     106f24 <mon_dwarfstats+0x1c3>
+		? st->dws_inline_cycles / st->dws_inline_lookups : 0);
+  106f09:	ba 00 00 00 00       	mov    $0x0,%edx
+	cprintf("Inline lookups: %u, %llu cycles each\n",
+  106f0e:	52                   	push   %edx
+  106f0f:	53                   	push   %ebx
+  106f10:	ff 35 d0 e2 11 00    	push   0x11e2d0
+  106f16:	ff 35 cc e2 11 00    	push   0x11e2cc
+  106f1c:	e8 0a 25 00 00       	call   10942b <__udivdi3>
+  106f21:	83 c4 10             	add    $0x10,%esp
+  106f24:	52                   	push   %edx
+  106f25:	50                   	push   %eax
+  106f26:	53                   	push   %ebx
+  106f27:	68 34 a0 10 00       	push   $0x10a034
+  106f2c:	e8 03 09 00 00       	call   107834 <cprintf>
+	cprintf("debuginfo_eip cache: %u hits, %u misses\n",
+  106f31:	83 c4 0c             	add    $0xc,%esp
+  106f34:	ff 35 d8 e2 11 00    	push   0x11e2d8
+  106f3a:	ff 35 d4 e2 11 00    	push   0x11e2d4
+  106f40:	68 5c a0 10 00       	push   $0x10a05c
+  106f45:	e8 ea 08 00 00       	call   107834 <cprintf>
+		st->dws_eip_hits, st->dws_eip_misses);
+	cprintf("Name table: %u names, built in %llu cycles\n",
+  106f4a:	ff 35 e4 e2 11 00    	push   0x11e2e4
+  106f50:	ff 35 e0 e2 11 00    	push   0x11e2e0
+  106f56:	ff 35 dc e2 11 00    	push   0x11e2dc
+  106f5c:	68 88 a0 10 00       	push   $0x10a088
+  106f61:	e8 ce 08 00 00       	call   107834 <cprintf>
+		st->dws_nnames, st->dws_names_build);
+	cprintf("Name lookups: %u, %llu cycles each\n", st->dws_name_lookups,
+		st->dws_name_lookups
+  106f66:	8b 1d e8 e2 11 00    	mov    0x11e2e8,%ebx
+	cprintf("Name lookups: %u, %llu cycles each\n", st->dws_name_lookups,
+  106f6c:	83 c4 20             	add    $0x20,%esp
+  106f6f:	b8 00 00 00 00       	mov    $0x0,%eax
+  106f74:	ba 00 00 00 00       	mov    $0x0,%edx
+  106f79:	85 db                	test   %ebx,%ebx
+  106f7b:	74 1b                	je     106f98 <mon_dwarfstats+0x237>
+		? st->dws_name_cycles / st->dws_name_lookups : 0);
+  106f7d:	ba 00 00 00 00       	mov    $0x0,%edx
+	cprintf("Name lookups: %u, %llu cycles each\n", st->dws_name_lookups,
+  106f82:	52                   	push   %edx
+  106f83:	53                   	push   %ebx
+  106f84:	ff 35 f0 e2 11 00    	push   0x11e2f0
+  106f8a:	ff 35 ec e2 11 00    	push   0x11e2ec
+  106f90:	e8 96 24 00 00       	call   10942b <__udivdi3>
+  106f95:	83 c4 10             	add    $0x10,%esp
+  106f98:	52                   	push   %edx
+  106f99:	50                   	push   %eax
+  106f9a:	53                   	push   %ebx
+  106f9b:	68 b4 a0 10 00       	push   $0x10a0b4
+  106fa0:	e8 8f 08 00 00       	call   107834 <cprintf>
+	return 0;
+}
+  106fa5:	b8 00 00 00 00       	mov    $0x0,%eax
+  106faa:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  106fad:	c9                   	leave
+  106fae:	c3                   	ret
+
+00106faf <mon_backtrace>:
+{
+  106faf:	55                   	push   %ebp
+  106fb0:	89 e5                	mov    %esp,%ebp
+  106fb2:	57                   	push   %edi
+  106fb3:	56                   	push   %esi
+  106fb4:	53                   	push   %ebx
+  106fb5:	81 ec 4c 09 00 00    	sub    $0x94c,%esp
+	__asm __volatile("movl %%ebp,%0" : "=r" (ebp));
+  106fbb:	89 e8                	mov    %ebp,%eax
+	uint32_t *ebp = (uint32_t *) read_ebp();
+  106fbd:	89 c3                	mov    %eax,%ebx
+	for (n = 0; ebp && n < BACKTRACE_DEPTH; n++) {
+  106fbf:	b8 00 00 00 00       	mov    $0x0,%eax
+  106fc4:	eb 16                	jmp    106fdc <mon_backtrace+0x2d>
+		ebps[n] = ebp;
+  106fc6:	89 9c 85 e8 fe ff ff 	mov    %ebx,-0x118(%ebp,%eax,4)
+		eips[n] = ebp[1];
+  106fcd:	8b 53 04             	mov    0x4(%ebx),%edx
+  106fd0:	89 94 85 e8 fd ff ff 	mov    %edx,-0x218(%ebp,%eax,4)
+		ebp = (uint32_t *) ebp[0];
+  106fd7:	8b 1b                	mov    (%ebx),%ebx
+	for (n = 0; ebp && n < BACKTRACE_DEPTH; n++) {
+  106fd9:	83 c0 01             	add    $0x1,%eax
+  106fdc:	85 db                	test   %ebx,%ebx
+  106fde:	74 05                	je     106fe5 <mon_backtrace+0x36>
+  106fe0:	83 f8 3f             	cmp    $0x3f,%eax
+  106fe3:	7e e1                	jle    106fc6 <mon_backtrace+0x17>
+	debuginfo_eip_batch(eips, n, info);
+  106fe5:	89 85 b4 f6 ff ff    	mov    %eax,-0x94c(%ebp)
+  106feb:	83 ec 04             	sub    $0x4,%esp
+  106fee:	8d b5 e8 f7 ff ff    	lea    -0x818(%ebp),%esi
+  106ff4:	56                   	push   %esi
+  106ff5:	50                   	push   %eax
+  106ff6:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+  106ffc:	50                   	push   %eax
+  106ffd:	e8 31 0c 00 00       	call   107c33 <debuginfo_eip_batch>
+	cprintf("Stack backtrace:\n");
+  107002:	c7 04 24 14 9c 10 00 	movl   $0x109c14,(%esp)
+  107009:	e8 26 08 00 00       	call   107834 <cprintf>
+	for (i = 0; i < n; i++) {
+  10700e:	89 b5 b8 f6 ff ff    	mov    %esi,-0x948(%ebp)
+  107014:	83 c4 10             	add    $0x10,%esp
+  107017:	c7 85 c4 f6 ff ff 00 	movl   $0x0,-0x93c(%ebp)
+  10701e:	00 00 00 
+  107021:	89 9d b0 f6 ff ff    	mov    %ebx,-0x950(%ebp)
+  107027:	e9 8d 00 00 00       	jmp    1070b9 <mon_backtrace+0x10a>
+			cprintf("         %s:%d: %.*s (inlined)\n",
+  10702c:	83 ec 0c             	sub    $0xc,%esp
+  10702f:	ff 73 08             	push   0x8(%ebx)
+  107032:	ff 73 0c             	push   0xc(%ebx)
+  107035:	ff 73 04             	push   0x4(%ebx)
+  107038:	ff 33                	push   (%ebx)
+  10703a:	68 10 a1 10 00       	push   $0x10a110
+  10703f:	e8 f0 07 00 00       	call   107834 <cprintf>
+		for (j = 0; j < nframes - 1; j++)
+  107044:	83 c6 01             	add    $0x1,%esi
+  107047:	83 c3 10             	add    $0x10,%ebx
+  10704a:	83 c4 20             	add    $0x20,%esp
+  10704d:	39 f7                	cmp    %esi,%edi
+  10704f:	7f db                	jg     10702c <mon_backtrace+0x7d>
+		if (info[i].eip_fn_addr == eips[i]
+  107051:	8b 85 bc f6 ff ff    	mov    -0x944(%ebp),%eax
+  107057:	8b 84 85 e8 fd ff ff 	mov    -0x218(%ebp,%eax,4),%eax
+  10705e:	8b 95 c0 f6 ff ff    	mov    -0x940(%ebp),%edx
+  107064:	39 42 10             	cmp    %eax,0x10(%edx)
+  107067:	0f 84 cd 00 00 00    	je     10713a <mon_backtrace+0x18b>
+		cprintf("         %s:%d: %.*s+%u\n", fr->ei_file, fr->ei_line,
+  10706d:	83 ec 08             	sub    $0x8,%esp
+  107070:	8b 85 bc f6 ff ff    	mov    -0x944(%ebp),%eax
+  107076:	8b 84 85 e8 fd ff ff 	mov    -0x218(%ebp,%eax,4),%eax
+  10707d:	8b 8d c0 f6 ff ff    	mov    -0x940(%ebp),%ecx
+  107083:	2b 41 10             	sub    0x10(%ecx),%eax
+  107086:	50                   	push   %eax
+  107087:	ff 71 08             	push   0x8(%ecx)
+  10708a:	ff 71 0c             	push   0xc(%ecx)
+  10708d:	c1 e7 04             	shl    $0x4,%edi
+  107090:	ff b4 3d 5c f7 ff ff 	push   -0x8a4(%ebp,%edi,1)
+  107097:	ff b4 3d 58 f7 ff ff 	push   -0x8a8(%ebp,%edi,1)
+  10709e:	68 3d 9c 10 00       	push   $0x109c3d
+  1070a3:	e8 8c 07 00 00       	call   107834 <cprintf>
+  1070a8:	83 c4 20             	add    $0x20,%esp
+	for (i = 0; i < n; i++) {
+  1070ab:	83 85 c4 f6 ff ff 01 	addl   $0x1,-0x93c(%ebp)
+  1070b2:	83 85 b8 f6 ff ff 18 	addl   $0x18,-0x948(%ebp)
+  1070b9:	8b 95 b4 f6 ff ff    	mov    -0x94c(%ebp),%edx
+  1070bf:	39 95 c4 f6 ff ff    	cmp    %edx,-0x93c(%ebp)
+  1070c5:	0f 8d c4 00 00 00    	jge    10718f <mon_backtrace+0x1e0>
+		cprintf("  ebp %08x  eip %08x  args %08x %08x %08x %08x %08x\n",
+  1070cb:	8b bd c4 f6 ff ff    	mov    -0x93c(%ebp),%edi
+  1070d1:	89 bd bc f6 ff ff    	mov    %edi,-0x944(%ebp)
+			ebps[i][5], ebps[i][6]);
+  1070d7:	8b 84 bd e8 fe ff ff 	mov    -0x118(%ebp,%edi,4),%eax
+		cprintf("  ebp %08x  eip %08x  args %08x %08x %08x %08x %08x\n",
+  1070de:	ff 70 18             	push   0x18(%eax)
+  1070e1:	ff 70 14             	push   0x14(%eax)
+  1070e4:	ff 70 10             	push   0x10(%eax)
+  1070e7:	ff 70 0c             	push   0xc(%eax)
+  1070ea:	ff 70 08             	push   0x8(%eax)
+  1070ed:	ff b4 bd e8 fd ff ff 	push   -0x218(%ebp,%edi,4)
+  1070f4:	50                   	push   %eax
+  1070f5:	68 d8 a0 10 00       	push   $0x10a0d8
+  1070fa:	e8 35 07 00 00       	call   107834 <cprintf>
+		nframes = debuginfo_eip_inline(eips[i], &info[i], frames,
+  1070ff:	8b 85 b8 f6 ff ff    	mov    -0x948(%ebp),%eax
+  107105:	89 85 c0 f6 ff ff    	mov    %eax,-0x940(%ebp)
+  10710b:	83 c4 20             	add    $0x20,%esp
+  10710e:	6a 09                	push   $0x9
+  107110:	8d 95 58 f7 ff ff    	lea    -0x8a8(%ebp),%edx
+  107116:	52                   	push   %edx
+  107117:	50                   	push   %eax
+  107118:	ff b4 bd e8 fd ff ff 	push   -0x218(%ebp,%edi,4)
+  10711f:	e8 27 0f 00 00       	call   10804b <debuginfo_eip_inline>
+		for (j = 0; j < nframes - 1; j++)
+  107124:	8d 9d 58 f7 ff ff    	lea    -0x8a8(%ebp),%ebx
+  10712a:	83 c4 10             	add    $0x10,%esp
+  10712d:	be 00 00 00 00       	mov    $0x0,%esi
+  107132:	8d 78 ff             	lea    -0x1(%eax),%edi
+  107135:	e9 13 ff ff ff       	jmp    10704d <mon_backtrace+0x9e>
+		    && ksym_lookup(eips[i], name, &offset)) {
+  10713a:	83 ec 04             	sub    $0x4,%esp
+  10713d:	8d 95 d4 f6 ff ff    	lea    -0x92c(%ebp),%edx
+  107143:	52                   	push   %edx
+  107144:	8d 95 d8 f6 ff ff    	lea    -0x928(%ebp),%edx
+  10714a:	52                   	push   %edx
+  10714b:	50                   	push   %eax
+  10714c:	e8 29 17 00 00       	call   10887a <ksym_lookup>
+  107151:	83 c4 10             	add    $0x10,%esp
+  107154:	85 c0                	test   %eax,%eax
+  107156:	0f 84 11 ff ff ff    	je     10706d <mon_backtrace+0xbe>
+			cprintf("         %s:%d: %s+%u\n", fr->ei_file,
+  10715c:	83 ec 0c             	sub    $0xc,%esp
+  10715f:	ff b5 d4 f6 ff ff    	push   -0x92c(%ebp)
+  107165:	8d 85 d8 f6 ff ff    	lea    -0x928(%ebp),%eax
+  10716b:	50                   	push   %eax
+  10716c:	c1 e7 04             	shl    $0x4,%edi
+  10716f:	ff b4 3d 5c f7 ff ff 	push   -0x8a4(%ebp,%edi,1)
+  107176:	ff b4 3d 58 f7 ff ff 	push   -0x8a8(%ebp,%edi,1)
+  10717d:	68 26 9c 10 00       	push   $0x109c26
+  107182:	e8 ad 06 00 00       	call   107834 <cprintf>
+			continue;
+  107187:	83 c4 20             	add    $0x20,%esp
+  10718a:	e9 1c ff ff ff       	jmp    1070ab <mon_backtrace+0xfc>
+	if (ebp)
+  10718f:	8b 9d b0 f6 ff ff    	mov    -0x950(%ebp),%ebx
+  107195:	85 db                	test   %ebx,%ebx
+  107197:	74 10                	je     1071a9 <mon_backtrace+0x1fa>
+		cprintf("  ...\n");
+  107199:	83 ec 0c             	sub    $0xc,%esp
+  10719c:	68 56 9c 10 00       	push   $0x109c56
+  1071a1:	e8 8e 06 00 00       	call   107834 <cprintf>
+  1071a6:	83 c4 10             	add    $0x10,%esp
+}
+  1071a9:	b8 00 00 00 00       	mov    $0x0,%eax
+  1071ae:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  1071b1:	5b                   	pop    %ebx
+  1071b2:	5e                   	pop    %esi
+  1071b3:	5f                   	pop    %edi
+  1071b4:	5d                   	pop    %ebp
+  1071b5:	c3                   	ret
+
+001071b6 <mon_fnaddr>:
+{
+  1071b6:	55                   	push   %ebp
+  1071b7:	89 e5                	mov    %esp,%ebp
+  1071b9:	53                   	push   %ebx
+  1071ba:	83 ec 74             	sub    $0x74,%esp
+	if (argc != 2) {
+  1071bd:	83 7d 08 02          	cmpl   $0x2,0x8(%ebp)
+  1071c1:	74 1a                	je     1071dd <mon_fnaddr+0x27>
+		cprintf("usage: fnaddr NAME\n");
+  1071c3:	83 ec 0c             	sub    $0xc,%esp
+  1071c6:	68 5d 9c 10 00       	push   $0x109c5d
+  1071cb:	e8 64 06 00 00       	call   107834 <cprintf>
+		return 0;
+  1071d0:	83 c4 10             	add    $0x10,%esp
+}
+  1071d3:	b8 00 00 00 00       	mov    $0x0,%eax
+  1071d8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  1071db:	c9                   	leave
+  1071dc:	c3                   	ret
+	load_kernel_dwarf_info(&addrs);
+  1071dd:	83 ec 0c             	sub    $0xc,%esp
+  1071e0:	8d 5d 90             	lea    -0x70(%ebp),%ebx
+  1071e3:	53                   	push   %ebx
+  1071e4:	e8 e3 07 00 00       	call   1079cc <load_kernel_dwarf_info>
+	if ((r = address_by_fname(&addrs, argv[1], &addr)) < 0)
+  1071e9:	83 c4 0c             	add    $0xc,%esp
+  1071ec:	8d 45 8c             	lea    -0x74(%ebp),%eax
+  1071ef:	50                   	push   %eax
+  1071f0:	8b 45 0c             	mov    0xc(%ebp),%eax
+  1071f3:	ff 70 04             	push   0x4(%eax)
+  1071f6:	53                   	push   %ebx
+  1071f7:	e8 5f b7 ff ff       	call   10295b <address_by_fname>
+  1071fc:	83 c4 10             	add    $0x10,%esp
+  1071ff:	85 c0                	test   %eax,%eax
+  107201:	78 1b                	js     10721e <mon_fnaddr+0x68>
+		cprintf("%s at %08x\n", argv[1], addr);
+  107203:	83 ec 04             	sub    $0x4,%esp
+  107206:	ff 75 8c             	push   -0x74(%ebp)
+  107209:	8b 45 0c             	mov    0xc(%ebp),%eax
+  10720c:	ff 70 04             	push   0x4(%eax)
+  10720f:	68 79 9c 10 00       	push   $0x109c79
+  107214:	e8 1b 06 00 00       	call   107834 <cprintf>
+  107219:	83 c4 10             	add    $0x10,%esp
+  10721c:	eb b5                	jmp    1071d3 <mon_fnaddr+0x1d>
+		cprintf("%s: %i\n", argv[1], r);
+  10721e:	83 ec 04             	sub    $0x4,%esp
+  107221:	50                   	push   %eax
+  107222:	8b 45 0c             	mov    0xc(%ebp),%eax
+  107225:	ff 70 04             	push   0x4(%eax)
+  107228:	68 71 9c 10 00       	push   $0x109c71
+  10722d:	e8 02 06 00 00       	call   107834 <cprintf>
+  107232:	83 c4 10             	add    $0x10,%esp
+  107235:	eb 9c                	jmp    1071d3 <mon_fnaddr+0x1d>
+
+00107237 <mon_boottime>:
+{
+  107237:	55                   	push   %ebp
+  107238:	89 e5                	mov    %esp,%ebp
+  10723a:	57                   	push   %edi
+  10723b:	56                   	push   %esi
+  10723c:	53                   	push   %ebx
+  10723d:	83 ec 2c             	sub    $0x2c,%esp
+	uint32_t i, n = MIN(BOOTINFO->bi_nevents, BOOTINFO_NEVENTS);
+  107240:	8b 35 24 10 00 00    	mov    0x1024,%esi
+	if (hz)
+  107246:	a1 10 e5 11 00       	mov    0x11e510,%eax
+  10724b:	8b 15 14 e5 11 00    	mov    0x11e514,%edx
+  107251:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  107254:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  107257:	89 d7                	mov    %edx,%edi
+  107259:	09 c7                	or     %eax,%edi
+  10725b:	0f 85 ad 00 00 00    	jne    10730e <mon_boottime+0xd7>
+	__asm __volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+  107261:	ba 61 00 00 00       	mov    $0x61,%edx
+  107266:	ec                   	in     (%dx),%al
+	__asm __volatile("outb %0,%w1" : : "a" (data), "d" (port));
+  107267:	83 e0 fc             	and    $0xfffffffc,%eax
+  10726a:	83 c8 01             	or     $0x1,%eax
+  10726d:	ee                   	out    %al,(%dx)
+  10726e:	b8 b0 ff ff ff       	mov    $0xffffffb0,%eax
+  107273:	ba 43 00 00 00       	mov    $0x43,%edx
+  107278:	ee                   	out    %al,(%dx)
+  107279:	ba 42 00 00 00       	mov    $0x42,%edx
+  10727e:	b8 9b ff ff ff       	mov    $0xffffff9b,%eax
+  107283:	ee                   	out    %al,(%dx)
+  107284:	b8 2e 00 00 00       	mov    $0x2e,%eax
+  107289:	ee                   	out    %al,(%dx)
+	__asm __volatile("rdtsc" : "=A" (tsc));
+  10728a:	0f 31                	rdtsc
+  10728c:	89 c1                	mov    %eax,%ecx
+  10728e:	89 d3                	mov    %edx,%ebx
+	__asm __volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+  107290:	ba 61 00 00 00       	mov    $0x61,%edx
+  107295:	ec                   	in     (%dx),%al
+	while (!(inb(PIT_GATE) & 0x20))
+  107296:	a8 20                	test   $0x20,%al
+  107298:	74 fb                	je     107295 <mon_boottime+0x5e>
+	__asm __volatile("rdtsc" : "=A" (tsc));
+  10729a:	0f 31                	rdtsc
+	hz = (read_tsc() - tsc) * 1000 / TSC_CAL_MS;
+  10729c:	29 c8                	sub    %ecx,%eax
+  10729e:	19 da                	sbb    %ebx,%edx
+  1072a0:	69 fa e8 03 00 00    	imul   $0x3e8,%edx,%edi
+  1072a6:	bb e8 03 00 00       	mov    $0x3e8,%ebx
+  1072ab:	f7 e3                	mul    %ebx
+  1072ad:	89 c1                	mov    %eax,%ecx
+  1072af:	89 d3                	mov    %edx,%ebx
+  1072b1:	01 fb                	add    %edi,%ebx
+  1072b3:	89 c7                	mov    %eax,%edi
+  1072b5:	01 df                	add    %ebx,%edi
+  1072b7:	83 d7 00             	adc    $0x0,%edi
+  1072ba:	b8 cd cc cc cc       	mov    $0xcccccccd,%eax
+  1072bf:	f7 e7                	mul    %edi
+  1072c1:	89 d0                	mov    %edx,%eax
+  1072c3:	c1 e8 02             	shr    $0x2,%eax
+  1072c6:	83 e2 fc             	and    $0xfffffffc,%edx
+  1072c9:	01 c2                	add    %eax,%edx
+  1072cb:	29 d7                	sub    %edx,%edi
+  1072cd:	ba 00 00 00 00       	mov    $0x0,%edx
+  1072d2:	29 f9                	sub    %edi,%ecx
+  1072d4:	19 d3                	sbb    %edx,%ebx
+  1072d6:	89 da                	mov    %ebx,%edx
+  1072d8:	69 db cd cc cc cc    	imul   $0xcccccccd,%ebx,%ebx
+  1072de:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  1072e1:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  1072e4:	69 45 e0 cc cc cc cc 	imul   $0xcccccccc,-0x20(%ebp),%eax
+  1072eb:	01 c3                	add    %eax,%ebx
+  1072ed:	b8 cd cc cc cc       	mov    $0xcccccccd,%eax
+  1072f2:	f7 65 e0             	mull   -0x20(%ebp)
+  1072f5:	01 da                	add    %ebx,%edx
+  1072f7:	0f ac d0 01          	shrd   $0x1,%edx,%eax
+  1072fb:	d1 ea                	shr    %edx
+  1072fd:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  107300:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  107303:	a3 10 e5 11 00       	mov    %eax,0x11e510
+  107308:	89 15 14 e5 11 00    	mov    %edx,0x11e514
+	if (n == 0) {
+  10730e:	85 f6                	test   %esi,%esi
+  107310:	74 5e                	je     107370 <mon_boottime+0x139>
+	uint32_t i, n = MIN(BOOTINFO->bi_nevents, BOOTINFO_NEVENTS);
+  107312:	b8 20 00 00 00       	mov    $0x20,%eax
+  107317:	39 c6                	cmp    %eax,%esi
+  107319:	0f 46 c6             	cmovbe %esi,%eax
+  10731c:	89 45 d0             	mov    %eax,-0x30(%ebp)
+	cprintf("Boot timeline, TSC at about %llu MHz:\n", hz / 1000000);
+  10731f:	83 ec 10             	sub    $0x10,%esp
+  107322:	6a 00                	push   $0x0
+  107324:	68 40 42 0f 00       	push   $0xf4240
+  107329:	ff 75 dc             	push   -0x24(%ebp)
+  10732c:	ff 75 d8             	push   -0x28(%ebp)
+  10732f:	e8 f7 20 00 00       	call   10942b <__udivdi3>
+  107334:	83 c4 1c             	add    $0x1c,%esp
+  107337:	52                   	push   %edx
+  107338:	50                   	push   %eax
+  107339:	68 30 a1 10 00       	push   $0x10a130
+  10733e:	e8 f1 04 00 00       	call   107834 <cprintf>
+	cprintf("      cycles     time    elapsed  event\n");
+  107343:	c7 04 24 58 a1 10 00 	movl   $0x10a158,(%esp)
+  10734a:	e8 e5 04 00 00       	call   107834 <cprintf>
+  10734f:	83 c4 10             	add    $0x10,%esp
+  107352:	bb 28 10 00 00       	mov    $0x1028,%ebx
+	for (i = 0; i < n; i++) {
+  107357:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%ebp)
+		cycles = i > 0 ? ev[i].be_tsc - ev[i-1].be_tsc : 0;
+  10735e:	be 00 00 00 00       	mov    $0x0,%esi
+  107363:	bf 00 00 00 00       	mov    $0x0,%edi
+  107368:	89 75 c8             	mov    %esi,-0x38(%ebp)
+  10736b:	89 7d cc             	mov    %edi,-0x34(%ebp)
+  10736e:	eb 7e                	jmp    1073ee <mon_boottime+0x1b7>
+		cprintf("No boot timeline recorded\n");
+  107370:	83 ec 0c             	sub    $0xc,%esp
+  107373:	68 85 9c 10 00       	push   $0x109c85
+  107378:	e8 b7 04 00 00       	call   107834 <cprintf>
+		return 0;
+  10737d:	83 c4 10             	add    $0x10,%esp
+}
+  107380:	b8 00 00 00 00       	mov    $0x0,%eax
+  107385:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  107388:	5b                   	pop    %ebx
+  107389:	5e                   	pop    %esi
+  10738a:	5f                   	pop    %edi
+  10738b:	5d                   	pop    %ebp
+  10738c:	c3                   	ret
+			cprintf("%s", bootev_names[ev[i].be_what]);
+  10738d:	83 ec 08             	sub    $0x8,%esp
+  107390:	ff 34 85 a0 a3 10 00 	push   0x10a3a0(,%eax,4)
+  107397:	68 12 95 10 00       	push   $0x109512
+  10739c:	e8 93 04 00 00       	call   107834 <cprintf>
+  1073a1:	83 c4 10             	add    $0x10,%esp
+		if (ev[i].be_what == BOOTEV_PROGHDR)
+  1073a4:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  1073a7:	8b 00                	mov    (%eax),%eax
+  1073a9:	83 f8 01             	cmp    $0x1,%eax
+  1073ac:	0f 84 f3 00 00 00    	je     1074a5 <mon_boottime+0x26e>
+		else if (ev[i].be_what == BOOTEV_DEBUGSECT)
+  1073b2:	83 f8 05             	cmp    $0x5,%eax
+  1073b5:	0f 84 05 01 00 00    	je     1074c0 <mon_boottime+0x289>
+		cprintf("\n");
+  1073bb:	83 ec 0c             	sub    $0xc,%esp
+  1073be:	68 3a 95 10 00       	push   $0x10953a
+  1073c3:	e8 6c 04 00 00       	call   107834 <cprintf>
+	for (i = 0; i < n; i++) {
+  1073c8:	83 45 e0 01          	addl   $0x1,-0x20(%ebp)
+  1073cc:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  1073cf:	8d 43 10             	lea    0x10(%ebx),%eax
+  1073d2:	83 c4 10             	add    $0x10,%esp
+  1073d5:	39 7d d0             	cmp    %edi,-0x30(%ebp)
+  1073d8:	74 a6                	je     107380 <mon_boottime+0x149>
+		cycles = i > 0 ? ev[i].be_tsc - ev[i-1].be_tsc : 0;
+  1073da:	8b 70 08             	mov    0x8(%eax),%esi
+  1073dd:	8b 78 0c             	mov    0xc(%eax),%edi
+  1073e0:	2b 73 08             	sub    0x8(%ebx),%esi
+  1073e3:	1b 7b 0c             	sbb    0xc(%ebx),%edi
+  1073e6:	89 75 c8             	mov    %esi,-0x38(%ebp)
+  1073e9:	89 7d cc             	mov    %edi,-0x34(%ebp)
+  1073ec:	89 c3                	mov    %eax,%ebx
+		us = (ev[i].be_tsc - ev[0].be_tsc) * 1000000 / hz;
+  1073ee:	89 5d d4             	mov    %ebx,-0x2c(%ebp)
+  1073f1:	8b 43 08             	mov    0x8(%ebx),%eax
+  1073f4:	8b 53 0c             	mov    0xc(%ebx),%edx
+  1073f7:	b9 28 10 00 00       	mov    $0x1028,%ecx
+  1073fc:	2b 41 08             	sub    0x8(%ecx),%eax
+  1073ff:	1b 51 0c             	sbb    0xc(%ecx),%edx
+  107402:	69 ca 40 42 0f 00    	imul   $0xf4240,%edx,%ecx
+  107408:	bf 40 42 0f 00       	mov    $0xf4240,%edi
+  10740d:	f7 e7                	mul    %edi
+  10740f:	01 ca                	add    %ecx,%edx
+  107411:	ff 75 dc             	push   -0x24(%ebp)
+  107414:	ff 75 d8             	push   -0x28(%ebp)
+  107417:	52                   	push   %edx
+  107418:	50                   	push   %eax
+  107419:	e8 0d 20 00 00       	call   10942b <__udivdi3>
+  10741e:	89 c6                	mov    %eax,%esi
+  107420:	89 d7                	mov    %edx,%edi
+		cprintf("%12llu %5llu us %6llu.%03llu ms  ", cycles,
+  107422:	6a 00                	push   $0x0
+  107424:	68 e8 03 00 00       	push   $0x3e8
+  107429:	52                   	push   %edx
+  10742a:	50                   	push   %eax
+  10742b:	e8 19 20 00 00       	call   109449 <__umoddi3>
+  107430:	83 c4 14             	add    $0x14,%esp
+  107433:	52                   	push   %edx
+  107434:	50                   	push   %eax
+  107435:	83 ec 0c             	sub    $0xc,%esp
+  107438:	6a 00                	push   $0x0
+  10743a:	68 e8 03 00 00       	push   $0x3e8
+  10743f:	57                   	push   %edi
+  107440:	56                   	push   %esi
+  107441:	e8 e5 1f 00 00       	call   10942b <__udivdi3>
+  107446:	83 c4 1c             	add    $0x1c,%esp
+  107449:	52                   	push   %edx
+  10744a:	50                   	push   %eax
+			cycles * 1000000 / hz, us / 1000, us % 1000);
+  10744b:	8b 75 c8             	mov    -0x38(%ebp),%esi
+  10744e:	8b 7d cc             	mov    -0x34(%ebp),%edi
+  107451:	69 cf 40 42 0f 00    	imul   $0xf4240,%edi,%ecx
+  107457:	b8 40 42 0f 00       	mov    $0xf4240,%eax
+  10745c:	f7 e6                	mul    %esi
+  10745e:	01 ca                	add    %ecx,%edx
+		cprintf("%12llu %5llu us %6llu.%03llu ms  ", cycles,
+  107460:	83 ec 04             	sub    $0x4,%esp
+  107463:	ff 75 dc             	push   -0x24(%ebp)
+  107466:	ff 75 d8             	push   -0x28(%ebp)
+  107469:	52                   	push   %edx
+  10746a:	50                   	push   %eax
+  10746b:	e8 bb 1f 00 00       	call   10942b <__udivdi3>
+  107470:	83 c4 14             	add    $0x14,%esp
+  107473:	52                   	push   %edx
+  107474:	50                   	push   %eax
+  107475:	57                   	push   %edi
+  107476:	56                   	push   %esi
+  107477:	68 84 a1 10 00       	push   $0x10a184
+  10747c:	e8 b3 03 00 00       	call   107834 <cprintf>
+		if (ev[i].be_what >= NBOOTEV_NAMES)
+  107481:	8b 03                	mov    (%ebx),%eax
+  107483:	83 c4 30             	add    $0x30,%esp
+  107486:	83 f8 06             	cmp    $0x6,%eax
+  107489:	0f 86 fe fe ff ff    	jbe    10738d <mon_boottime+0x156>
+			cprintf("event %u", ev[i].be_what);
+  10748f:	83 ec 08             	sub    $0x8,%esp
+  107492:	50                   	push   %eax
+  107493:	68 a0 9c 10 00       	push   $0x109ca0
+  107498:	e8 97 03 00 00       	call   107834 <cprintf>
+  10749d:	83 c4 10             	add    $0x10,%esp
+  1074a0:	e9 ff fe ff ff       	jmp    1073a4 <mon_boottime+0x16d>
+			cprintf(" %u", ev[i].be_arg);
+  1074a5:	83 ec 08             	sub    $0x8,%esp
+  1074a8:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  1074ab:	ff 70 04             	push   0x4(%eax)
+  1074ae:	68 a5 9c 10 00       	push   $0x109ca5
+  1074b3:	e8 7c 03 00 00       	call   107834 <cprintf>
+  1074b8:	83 c4 10             	add    $0x10,%esp
+  1074bb:	e9 fb fe ff ff       	jmp    1073bb <mon_boottime+0x184>
+			cprintf(" %s", debug_section_name(ev[i].be_arg));
+  1074c0:	83 ec 0c             	sub    $0xc,%esp
+  1074c3:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  1074c6:	ff 70 04             	push   0x4(%eax)
+  1074c9:	e8 39 07 00 00       	call   107c07 <debug_section_name>
+  1074ce:	83 c4 08             	add    $0x8,%esp
+  1074d1:	50                   	push   %eax
+  1074d2:	68 11 95 10 00       	push   $0x109511
+  1074d7:	e8 58 03 00 00       	call   107834 <cprintf>
+  1074dc:	83 c4 10             	add    $0x10,%esp
+  1074df:	e9 d7 fe ff ff       	jmp    1073bb <mon_boottime+0x184>
+
+001074e4 <mon_dwarfbench>:
+// A name no function has, so that looking it up walks every DIE.
+#define NO_SUCH_NAME	"-"
+
+int
+mon_dwarfbench(int argc, char **argv, struct Trapframe *tf)
+{
+  1074e4:	55                   	push   %ebp
+  1074e5:	89 e5                	mov    %esp,%ebp
+  1074e7:	57                   	push   %edi
+  1074e8:	56                   	push   %esi
+  1074e9:	53                   	push   %ebx
+  1074ea:	81 ec 08 01 00 00    	sub    $0x108,%esp
+	struct Dwarf_Addrs addrs;
+	struct Dwarf_CU cu;
+	const char *hdr;
+	bool skip = dwarf_skip_subtrees;
+  1074f0:	0f b6 05 20 53 11 00 	movzbl 0x115320,%eax
+  1074f7:	88 85 07 ff ff ff    	mov    %al,-0xf9(%ebp)
+	uintptr_t addr;
+	uint32_t fn_addr;
+	const char *fn_name;
+	int i;
+
+	load_kernel_dwarf_info(&addrs);
+  1074fd:	8d 5d 80             	lea    -0x80(%ebp),%ebx
+  107500:	53                   	push   %ebx
+  107501:	e8 c6 04 00 00       	call   1079cc <load_kernel_dwarf_info>
+	// Load the sections and decode the abbreviation tables first.
+	naive_address_by_fname(&addrs, NO_SUCH_NAME, &addr);
+  107506:	83 c4 0c             	add    $0xc,%esp
+  107509:	8d 85 2c ff ff ff    	lea    -0xd4(%ebp),%eax
+  10750f:	50                   	push   %eax
+  107510:	68 a9 9c 10 00       	push   $0x109ca9
+  107515:	53                   	push   %ebx
+  107516:	e8 37 b7 ff ff       	call   102c52 <naive_address_by_fname>
+  10751b:	83 c4 10             	add    $0x10,%esp
+
+	for (i = 0; i < 2; i++) {
+  10751e:	c7 85 14 ff ff ff 00 	movl   $0x0,-0xec(%ebp)
+  107525:	00 00 00 
+		dwarf_skip_subtrees = i;
+
+		tsc = read_tsc();
+		naive_address_by_fname(&addrs, NO_SUCH_NAME, &addr);
+  107528:	89 df                	mov    %ebx,%edi
+  10752a:	eb 77                	jmp    1075a3 <mon_dwarfbench+0xbf>
+		tsc = read_tsc();
+		for (hdr = (const char *) addrs.info_begin;
+		     (const unsigned char *) hdr < addrs.info_end
+		     && dwarf_read_cu_header(&addrs, hdr, &cu) == 0;
+		     hdr = cu.cu_end)
+			function_by_info(&addrs, 0, hdr - (const char *) addrs.info_begin,
+  10752c:	83 ec 04             	sub    $0x4,%esp
+  10752f:	8d 85 28 ff ff ff    	lea    -0xd8(%ebp),%eax
+  107535:	50                   	push   %eax
+  107536:	6a 04                	push   $0x4
+  107538:	8d 85 24 ff ff ff    	lea    -0xdc(%ebp),%eax
+  10753e:	50                   	push   %eax
+  10753f:	89 d8                	mov    %ebx,%eax
+  107541:	2b 45 90             	sub    -0x70(%ebp),%eax
+  107544:	99                   	cltd
+  107545:	52                   	push   %edx
+  107546:	50                   	push   %eax
+  107547:	6a 00                	push   $0x0
+  107549:	57                   	push   %edi
+  10754a:	e8 9c b0 ff ff       	call   1025eb <function_by_info>
+		     hdr = cu.cu_end)
+  10754f:	8b 9d 5c ff ff ff    	mov    -0xa4(%ebp),%ebx
+  107555:	83 c4 20             	add    $0x20,%esp
+		     && dwarf_read_cu_header(&addrs, hdr, &cu) == 0;
+  107558:	3b 5d 94             	cmp    -0x6c(%ebp),%ebx
+  10755b:	73 12                	jae    10756f <mon_dwarfbench+0x8b>
+  10755d:	83 ec 04             	sub    $0x4,%esp
+  107560:	56                   	push   %esi
+  107561:	53                   	push   %ebx
+  107562:	57                   	push   %edi
+  107563:	e8 68 9d ff ff       	call   1012d0 <dwarf_read_cu_header>
+  107568:	83 c4 10             	add    $0x10,%esp
+  10756b:	85 c0                	test   %eax,%eax
+  10756d:	74 bd                	je     10752c <mon_dwarfbench+0x48>
+  10756f:	0f 31                	rdtsc
+					 (char *) &fn_name, sizeof(fn_name), &fn_addr);
+		funcs[i] = read_tsc() - tsc;
+  107571:	2b 85 08 ff ff ff    	sub    -0xf8(%ebp),%eax
+  107577:	1b 95 0c ff ff ff    	sbb    -0xf4(%ebp),%edx
+  10757d:	8b 8d 10 ff ff ff    	mov    -0xf0(%ebp),%ecx
+  107583:	89 84 cd 30 ff ff ff 	mov    %eax,-0xd0(%ebp,%ecx,8)
+  10758a:	89 94 cd 34 ff ff ff 	mov    %edx,-0xcc(%ebp,%ecx,8)
+	for (i = 0; i < 2; i++) {
+  107591:	83 85 14 ff ff ff 01 	addl   $0x1,-0xec(%ebp)
+  107598:	8b 85 14 ff ff ff    	mov    -0xec(%ebp),%eax
+  10759e:	83 f8 02             	cmp    $0x2,%eax
+  1075a1:	74 68                	je     10760b <mon_dwarfbench+0x127>
+		dwarf_skip_subtrees = i;
+  1075a3:	83 bd 14 ff ff ff 00 	cmpl   $0x0,-0xec(%ebp)
+  1075aa:	0f 95 05 20 53 11 00 	setne  0x115320
+  1075b1:	0f 31                	rdtsc
+  1075b3:	89 c3                	mov    %eax,%ebx
+  1075b5:	89 d6                	mov    %edx,%esi
+		naive_address_by_fname(&addrs, NO_SUCH_NAME, &addr);
+  1075b7:	83 ec 04             	sub    $0x4,%esp
+  1075ba:	8d 85 2c ff ff ff    	lea    -0xd4(%ebp),%eax
+  1075c0:	50                   	push   %eax
+  1075c1:	68 a9 9c 10 00       	push   $0x109ca9
+  1075c6:	57                   	push   %edi
+  1075c7:	e8 86 b6 ff ff       	call   102c52 <naive_address_by_fname>
+  1075cc:	0f 31                	rdtsc
+	return tsc;
+  1075ce:	8b 8d 14 ff ff ff    	mov    -0xec(%ebp),%ecx
+  1075d4:	89 8d 10 ff ff ff    	mov    %ecx,-0xf0(%ebp)
+		names[i] = read_tsc() - tsc;
+  1075da:	29 d8                	sub    %ebx,%eax
+  1075dc:	19 f2                	sbb    %esi,%edx
+  1075de:	89 84 cd 40 ff ff ff 	mov    %eax,-0xc0(%ebp,%ecx,8)
+  1075e5:	89 94 cd 44 ff ff ff 	mov    %edx,-0xbc(%ebp,%ecx,8)
+	__asm __volatile("rdtsc" : "=A" (tsc));
+  1075ec:	0f 31                	rdtsc
+  1075ee:	89 85 08 ff ff ff    	mov    %eax,-0xf8(%ebp)
+  1075f4:	89 95 0c ff ff ff    	mov    %edx,-0xf4(%ebp)
+		for (hdr = (const char *) addrs.info_begin;
+  1075fa:	8b 5d 90             	mov    -0x70(%ebp),%ebx
+  1075fd:	83 c4 10             	add    $0x10,%esp
+		     && dwarf_read_cu_header(&addrs, hdr, &cu) == 0;
+  107600:	8d b5 54 ff ff ff    	lea    -0xac(%ebp),%esi
+		for (hdr = (const char *) addrs.info_begin;
+  107606:	e9 4d ff ff ff       	jmp    107558 <mon_dwarfbench+0x74>
+	}
+	dwarf_skip_subtrees = skip;
+  10760b:	0f b6 85 07 ff ff ff 	movzbl -0xf9(%ebp),%eax
+  107612:	a2 20 53 11 00       	mov    %al,0x115320
+
+	cprintf("naive_address_by_fname: %llu cycles, %llu skipping subtrees\n",
+  107617:	83 ec 0c             	sub    $0xc,%esp
+  10761a:	ff b5 4c ff ff ff    	push   -0xb4(%ebp)
+  107620:	ff b5 48 ff ff ff    	push   -0xb8(%ebp)
+  107626:	ff b5 44 ff ff ff    	push   -0xbc(%ebp)
+  10762c:	ff b5 40 ff ff ff    	push   -0xc0(%ebp)
+  107632:	68 a8 a1 10 00       	push   $0x10a1a8
+  107637:	e8 f8 01 00 00       	call   107834 <cprintf>
+		names[0], names[1]);
+	cprintf("function_by_info, all CUs: %llu cycles, %llu skipping subtrees\n",
+  10763c:	83 c4 14             	add    $0x14,%esp
+  10763f:	ff b5 3c ff ff ff    	push   -0xc4(%ebp)
+  107645:	ff b5 38 ff ff ff    	push   -0xc8(%ebp)
+  10764b:	ff b5 34 ff ff ff    	push   -0xcc(%ebp)
+  107651:	ff b5 30 ff ff ff    	push   -0xd0(%ebp)
+  107657:	68 e8 a1 10 00       	push   $0x10a1e8
+  10765c:	e8 d3 01 00 00       	call   107834 <cprintf>
+		funcs[0], funcs[1]);
+	return 0;
+}
+  107661:	b8 00 00 00 00       	mov    $0x0,%eax
+  107666:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  107669:	5b                   	pop    %ebx
+  10766a:	5e                   	pop    %esi
+  10766b:	5f                   	pop    %edi
+  10766c:	5d                   	pop    %ebp
+  10766d:	c3                   	ret
+
+0010766e <monitor>:
+	return 0;
+}
+
+void
+monitor(struct Trapframe *tf)
+{
+  10766e:	55                   	push   %ebp
+  10766f:	89 e5                	mov    %esp,%ebp
+  107671:	57                   	push   %edi
+  107672:	56                   	push   %esi
+  107673:	53                   	push   %ebx
+  107674:	83 ec 58             	sub    $0x58,%esp
+	static bool prompted;
+	char *buf;
+
+	cprintf("Welcome to the JOS kernel monitor!\n");
+  107677:	68 28 a2 10 00       	push   $0x10a228
+  10767c:	e8 b3 01 00 00       	call   107834 <cprintf>
+	cprintf("Type 'help' for a list of commands.\n");
+  107681:	c7 04 24 4c a2 10 00 	movl   $0x10a24c,(%esp)
+  107688:	e8 a7 01 00 00       	call   107834 <cprintf>
+
+	if (!prompted) {
+  10768d:	83 c4 10             	add    $0x10,%esp
+  107690:	80 3d 08 e5 11 00 00 	cmpb   $0x0,0x11e508
+  107697:	0f 85 8c 00 00 00    	jne    107729 <monitor+0xbb>
+		prompted = 1;
+  10769d:	c6 05 08 e5 11 00 01 	movb   $0x1,0x11e508
+  1076a4:	0f 31                	rdtsc
+  1076a6:	89 c1                	mov    %eax,%ecx
+  1076a8:	89 d3                	mov    %edx,%ebx
+  1076aa:	8b 15 24 10 00 00    	mov    0x1024,%edx
+  1076b0:	83 fa 1f             	cmp    $0x1f,%edx
+  1076b3:	77 74                	ja     107729 <monitor+0xbb>
+	ev = &BOOTINFO->bi_events[BOOTINFO->bi_nevents++];
+  1076b5:	8d 42 01             	lea    0x1(%edx),%eax
+  1076b8:	a3 24 10 00 00       	mov    %eax,0x1024
+  1076bd:	c1 e2 04             	shl    $0x4,%edx
+	ev->be_what = what;
+  1076c0:	c7 82 28 10 00 00 06 	movl   $0x6,0x1028(%edx)
+  1076c7:	00 00 00 
+	ev->be_arg = arg;
+  1076ca:	c7 82 2c 10 00 00 00 	movl   $0x0,0x102c(%edx)
+  1076d1:	00 00 00 
+	ev->be_tsc = tsc;
+  1076d4:	89 8a 30 10 00 00    	mov    %ecx,0x1030(%edx)
+  1076da:	89 9a 34 10 00 00    	mov    %ebx,0x1034(%edx)
+  1076e0:	eb 47                	jmp    107729 <monitor+0xbb>
+		while (*buf && strchr(WHITESPACE, *buf))
+  1076e2:	83 ec 08             	sub    $0x8,%esp
+  1076e5:	0f be c0             	movsbl %al,%eax
+  1076e8:	50                   	push   %eax
+  1076e9:	68 af 9c 10 00       	push   $0x109caf
+  1076ee:	e8 2f 1a 00 00       	call   109122 <strchr>
+  1076f3:	83 c4 10             	add    $0x10,%esp
+  1076f6:	85 c0                	test   %eax,%eax
+  1076f8:	74 0a                	je     107704 <monitor+0x96>
+			*buf++ = 0;
+  1076fa:	c6 03 00             	movb   $0x0,(%ebx)
+  1076fd:	89 f7                	mov    %esi,%edi
+  1076ff:	8d 5b 01             	lea    0x1(%ebx),%ebx
+  107702:	eb 6b                	jmp    10776f <monitor+0x101>
+		if (*buf == 0)
+  107704:	80 3b 00             	cmpb   $0x0,(%ebx)
+  107707:	74 73                	je     10777c <monitor+0x10e>
+		if (argc == MAXARGS-1) {
+  107709:	83 fe 0f             	cmp    $0xf,%esi
+  10770c:	74 09                	je     107717 <monitor+0xa9>
+		argv[argc++] = buf;
+  10770e:	8d 7e 01             	lea    0x1(%esi),%edi
+  107711:	89 5c b5 a8          	mov    %ebx,-0x58(%ebp,%esi,4)
+		while (*buf && !strchr(WHITESPACE, *buf))
+  107715:	eb 39                	jmp    107750 <monitor+0xe2>
+			cprintf("Too many arguments (max %d)\n", MAXARGS);
+  107717:	83 ec 08             	sub    $0x8,%esp
+  10771a:	6a 10                	push   $0x10
+  10771c:	68 b4 9c 10 00       	push   $0x109cb4
+  107721:	e8 0e 01 00 00       	call   107834 <cprintf>
+			return 0;
+  107726:	83 c4 10             	add    $0x10,%esp
+		boot_event(BOOTEV_MONITOR, 0, read_tsc());
+	}
+
+	while (1) {
+		buf = readline("K> ");
+  107729:	83 ec 0c             	sub    $0xc,%esp
+  10772c:	68 ab 9c 10 00       	push   $0x109cab
+  107731:	e8 bd 17 00 00       	call   108ef3 <readline>
+  107736:	89 c3                	mov    %eax,%ebx
+		if (buf != NULL)
+  107738:	83 c4 10             	add    $0x10,%esp
+  10773b:	85 c0                	test   %eax,%eax
+  10773d:	74 ea                	je     107729 <monitor+0xbb>
+	argv[argc] = 0;
+  10773f:	c7 45 a8 00 00 00 00 	movl   $0x0,-0x58(%ebp)
+	argc = 0;
+  107746:	be 00 00 00 00       	mov    $0x0,%esi
+  10774b:	eb 24                	jmp    107771 <monitor+0x103>
+			buf++;
+  10774d:	83 c3 01             	add    $0x1,%ebx
+		while (*buf && !strchr(WHITESPACE, *buf))
+  107750:	0f b6 03             	movzbl (%ebx),%eax
+  107753:	84 c0                	test   %al,%al
+  107755:	74 18                	je     10776f <monitor+0x101>
+  107757:	83 ec 08             	sub    $0x8,%esp
+  10775a:	0f be c0             	movsbl %al,%eax
+  10775d:	50                   	push   %eax
+  10775e:	68 af 9c 10 00       	push   $0x109caf
+  107763:	e8 ba 19 00 00       	call   109122 <strchr>
+  107768:	83 c4 10             	add    $0x10,%esp
+  10776b:	85 c0                	test   %eax,%eax
+  10776d:	74 de                	je     10774d <monitor+0xdf>
+			*buf++ = 0;
+  10776f:	89 fe                	mov    %edi,%esi
+		while (*buf && strchr(WHITESPACE, *buf))
+  107771:	0f b6 03             	movzbl (%ebx),%eax
+  107774:	84 c0                	test   %al,%al
+  107776:	0f 85 66 ff ff ff    	jne    1076e2 <monitor+0x74>
+	argv[argc] = 0;
+  10777c:	c7 44 b5 a8 00 00 00 	movl   $0x0,-0x58(%ebp,%esi,4)
+  107783:	00 
+	if (argc == 0)
+  107784:	85 f6                	test   %esi,%esi
+  107786:	74 a1                	je     107729 <monitor+0xbb>
+	for (i = 0; i < NCOMMANDS; i++) {
+  107788:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (strcmp(argv[0], commands[i].name) == 0)
+  10778d:	83 ec 08             	sub    $0x8,%esp
+  107790:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  107793:	ff 34 85 c0 a3 10 00 	push   0x10a3c0(,%eax,4)
+  10779a:	ff 75 a8             	push   -0x58(%ebp)
+  10779d:	e8 1f 19 00 00       	call   1090c1 <strcmp>
+  1077a2:	83 c4 10             	add    $0x10,%esp
+  1077a5:	85 c0                	test   %eax,%eax
+  1077a7:	74 20                	je     1077c9 <monitor+0x15b>
+	for (i = 0; i < NCOMMANDS; i++) {
+  1077a9:	83 c3 01             	add    $0x1,%ebx
+  1077ac:	83 fb 07             	cmp    $0x7,%ebx
+  1077af:	75 dc                	jne    10778d <monitor+0x11f>
+	cprintf("Unknown command '%s'\n", argv[0]);
+  1077b1:	83 ec 08             	sub    $0x8,%esp
+  1077b4:	ff 75 a8             	push   -0x58(%ebp)
+  1077b7:	68 d1 9c 10 00       	push   $0x109cd1
+  1077bc:	e8 73 00 00 00       	call   107834 <cprintf>
+	return 0;
+  1077c1:	83 c4 10             	add    $0x10,%esp
+  1077c4:	e9 60 ff ff ff       	jmp    107729 <monitor+0xbb>
+			return commands[i].func(argc, argv, tf);
+  1077c9:	83 ec 04             	sub    $0x4,%esp
+  1077cc:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  1077cf:	ff 75 08             	push   0x8(%ebp)
+  1077d2:	8d 4d a8             	lea    -0x58(%ebp),%ecx
+  1077d5:	51                   	push   %ecx
+  1077d6:	56                   	push   %esi
+  1077d7:	ff 14 85 c8 a3 10 00 	call   *0x10a3c8(,%eax,4)
+			if (runcmd(buf, tf) < 0)
+  1077de:	83 c4 10             	add    $0x10,%esp
+  1077e1:	85 c0                	test   %eax,%eax
+  1077e3:	0f 89 40 ff ff ff    	jns    107729 <monitor+0xbb>
+				break;
+	}
+}
+  1077e9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  1077ec:	5b                   	pop    %ebx
+  1077ed:	5e                   	pop    %esi
+  1077ee:	5f                   	pop    %edi
+  1077ef:	5d                   	pop    %ebp
+  1077f0:	c3                   	ret
+
+001077f1 <putch>:
+#include <inc/stdarg.h>
+
+
+static void
+putch(int ch, int *cnt)
+{
+  1077f1:	55                   	push   %ebp
+  1077f2:	89 e5                	mov    %esp,%ebp
+  1077f4:	53                   	push   %ebx
+  1077f5:	83 ec 10             	sub    $0x10,%esp
+  1077f8:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	cputchar(ch);
+  1077fb:	ff 75 08             	push   0x8(%ebp)
+  1077fe:	e8 4e 90 ff ff       	call   100851 <cputchar>
+	(*cnt)++;
+  107803:	83 03 01             	addl   $0x1,(%ebx)
+}
+  107806:	83 c4 10             	add    $0x10,%esp
+  107809:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  10780c:	c9                   	leave
+  10780d:	c3                   	ret
+
+0010780e <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  10780e:	55                   	push   %ebp
+  10780f:	89 e5                	mov    %esp,%ebp
+  107811:	83 ec 18             	sub    $0x18,%esp
+	int cnt = 0;
+  107814:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	vprintfmt((void*)putch, &cnt, fmt, ap);
+  10781b:	ff 75 0c             	push   0xc(%ebp)
+  10781e:	ff 75 08             	push   0x8(%ebp)
+  107821:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  107824:	50                   	push   %eax
+  107825:	68 f1 77 10 00       	push   $0x1077f1
+  10782a:	e8 3d 12 00 00       	call   108a6c <vprintfmt>
+	return cnt;
+}
+  10782f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  107832:	c9                   	leave
+  107833:	c3                   	ret
+
+00107834 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  107834:	55                   	push   %ebp
+  107835:	89 e5                	mov    %esp,%ebp
+  107837:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  10783a:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  10783d:	50                   	push   %eax
+  10783e:	ff 75 08             	push   0x8(%ebp)
+  107841:	e8 c8 ff ff ff       	call   10780e <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  107846:	c9                   	leave
+  107847:	c3                   	ret
+
+00107848 <eipcache_find>:
+}
+
+// The cached entry for 'addr', or NULL if there is none.
+static struct Eipcache_entry *
+eipcache_find(uintptr_t addr)
+{
+  107848:	55                   	push   %ebp
+  107849:	89 e5                	mov    %esp,%ebp
+  10784b:	53                   	push   %ebx
+  10784c:	89 c2                	mov    %eax,%edx
+	return ((addr >> 2) ^ (addr >> 8)) % EIPCACHE_SETS;
+  10784e:	c1 e8 02             	shr    $0x2,%eax
+  107851:	89 d1                	mov    %edx,%ecx
+  107853:	c1 e9 08             	shr    $0x8,%ecx
+  107856:	31 c8                	xor    %ecx,%eax
+  107858:	83 e0 3f             	and    $0x3f,%eax
+	unsigned s = eipcache_set(addr);
+	struct Eipcache_entry *ec;
+
+	for (ec = eipcache[s]; ec < eipcache[s] + EIPCACHE_WAYS; ec++)
+  10785b:	8d 0c c0             	lea    (%eax,%eax,8),%ecx
+  10785e:	c1 e1 04             	shl    $0x4,%ecx
+  107861:	8d 81 a0 e9 11 00    	lea    0x11e9a0(%ecx),%eax
+		if (ec->ec_eip == addr && ec->ec_generation == dwarf_generation) {
+  107867:	8b 1d 28 53 11 00    	mov    0x115328,%ebx
+  10786d:	8d 89 30 ea 11 00    	lea    0x11ea30(%ecx),%ecx
+	for (ec = eipcache[s]; ec < eipcache[s] + EIPCACHE_WAYS; ec++)
+  107873:	eb 03                	jmp    107878 <eipcache_find+0x30>
+  107875:	83 c0 24             	add    $0x24,%eax
+  107878:	39 c8                	cmp    %ecx,%eax
+  10787a:	74 12                	je     10788e <eipcache_find+0x46>
+		if (ec->ec_eip == addr && ec->ec_generation == dwarf_generation) {
+  10787c:	39 10                	cmp    %edx,(%eax)
+  10787e:	75 f5                	jne    107875 <eipcache_find+0x2d>
+  107880:	39 58 04             	cmp    %ebx,0x4(%eax)
+  107883:	75 f0                	jne    107875 <eipcache_find+0x2d>
+			dwarf_stats.dws_eip_hits++;
+  107885:	83 05 d4 e2 11 00 01 	addl   $0x1,0x11e2d4
+			return ec;
+  10788c:	eb 0c                	jmp    10789a <eipcache_find+0x52>
+		}
+	dwarf_stats.dws_eip_misses++;
+  10788e:	83 05 d8 e2 11 00 01 	addl   $0x1,0x11e2d8
+	return NULL;
+  107895:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  10789a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  10789d:	c9                   	leave
+  10789e:	c3                   	ret
+
+0010789f <debuginfo_eip_function>:
+
+// Fill in the function of 'addr', in the unit at 'offset' in .debug_info.
+static int
+debuginfo_eip_function(const struct Dwarf_Addrs *addrs, uintptr_t addr,
+		       Dwarf_Off offset, struct Eipdebuginfo *info)
+{
+  10789f:	55                   	push   %ebp
+  1078a0:	89 e5                	mov    %esp,%ebp
+  1078a2:	57                   	push   %edi
+  1078a3:	56                   	push   %esi
+  1078a4:	53                   	push   %ebx
+  1078a5:	83 ec 20             	sub    $0x20,%esp
+  1078a8:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  1078ab:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  1078ae:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  1078b1:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  1078b4:	89 ca                	mov    %ecx,%edx
+  1078b6:	89 d9                	mov    %ebx,%ecx
+  1078b8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// The unit's function index knows the name's length, too.
+	int code = dwarf_func_lookup(addrs, offset, addr, &info->eip_fn_name,
+  1078bb:	8d 7b 10             	lea    0x10(%ebx),%edi
+  1078be:	8d 73 08             	lea    0x8(%ebx),%esi
+  1078c1:	57                   	push   %edi
+  1078c2:	8d 43 0c             	lea    0xc(%ebx),%eax
+  1078c5:	50                   	push   %eax
+  1078c6:	56                   	push   %esi
+  1078c7:	ff 75 e0             	push   -0x20(%ebp)
+  1078ca:	89 55 d8             	mov    %edx,-0x28(%ebp)
+  1078cd:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  1078d0:	51                   	push   %ecx
+  1078d1:	52                   	push   %edx
+  1078d2:	ff 75 e4             	push   -0x1c(%ebp)
+  1078d5:	e8 7f e6 ff ff       	call   105f59 <dwarf_func_lookup>
+				     &info->eip_fn_namelen, &info->eip_fn_addr);
+	if (code == 0)
+  1078da:	83 c4 20             	add    $0x20,%esp
+  1078dd:	85 c0                	test   %eax,%eax
+  1078df:	75 08                	jne    1078e9 <debuginfo_eip_function+0x4a>
+	info->eip_fn_namelen = strlen(info->eip_fn_name);
+	if (code < 0) {
+		return code;
+	}
+	return 0;
+}
+  1078e1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  1078e4:	5b                   	pop    %ebx
+  1078e5:	5e                   	pop    %esi
+  1078e6:	5f                   	pop    %edi
+  1078e7:	5d                   	pop    %ebp
+  1078e8:	c3                   	ret
+	code = function_by_info(addrs, addr, offset, buf, sizeof(char *), &info->eip_fn_addr);
+  1078e9:	83 ec 04             	sub    $0x4,%esp
+  1078ec:	57                   	push   %edi
+  1078ed:	6a 04                	push   $0x4
+  1078ef:	56                   	push   %esi
+  1078f0:	ff 75 dc             	push   -0x24(%ebp)
+  1078f3:	ff 75 d8             	push   -0x28(%ebp)
+  1078f6:	ff 75 e0             	push   -0x20(%ebp)
+  1078f9:	ff 75 e4             	push   -0x1c(%ebp)
+  1078fc:	e8 ea ac ff ff       	call   1025eb <function_by_info>
+  107901:	89 c6                	mov    %eax,%esi
+	info->eip_fn_namelen = strlen(info->eip_fn_name);
+  107903:	83 c4 14             	add    $0x14,%esp
+  107906:	ff 73 08             	push   0x8(%ebx)
+  107909:	e8 c7 16 00 00       	call   108fd5 <strlen>
+  10790e:	89 43 0c             	mov    %eax,0xc(%ebx)
+	if (code < 0) {
+  107911:	85 f6                	test   %esi,%esi
+  107913:	b8 00 00 00 00       	mov    $0x0,%eax
+  107918:	0f 4e c6             	cmovle %esi,%eax
+  10791b:	83 c4 10             	add    $0x10,%esp
+  10791e:	eb c1                	jmp    1078e1 <debuginfo_eip_function+0x42>
+
+00107920 <eipcache_insert>:
+{
+  107920:	55                   	push   %ebp
+  107921:	89 e5                	mov    %esp,%ebp
+  107923:	57                   	push   %edi
+  107924:	56                   	push   %esi
+  107925:	53                   	push   %ebx
+  107926:	83 ec 0c             	sub    $0xc,%esp
+  107929:	89 c3                	mov    %eax,%ebx
+  10792b:	89 55 e8             	mov    %edx,-0x18(%ebp)
+  10792e:	89 ca                	mov    %ecx,%edx
+	return ((addr >> 2) ^ (addr >> 8)) % EIPCACHE_SETS;
+  107930:	c1 e8 02             	shr    $0x2,%eax
+  107933:	89 d9                	mov    %ebx,%ecx
+  107935:	c1 e9 08             	shr    $0x8,%ecx
+  107938:	31 c8                	xor    %ecx,%eax
+  10793a:	83 e0 3f             	and    $0x3f,%eax
+	ec = &eipcache[s][eipcache_victim[s]++ % EIPCACHE_WAYS];
+  10793d:	0f b6 b8 60 e9 11 00 	movzbl 0x11e960(%eax),%edi
+  107944:	8d 77 01             	lea    0x1(%edi),%esi
+  107947:	89 f1                	mov    %esi,%ecx
+  107949:	88 88 60 e9 11 00    	mov    %cl,0x11e960(%eax)
+  10794f:	89 f9                	mov    %edi,%ecx
+  107951:	83 e1 03             	and    $0x3,%ecx
+	ec->ec_eip = addr;
+  107954:	8d 3c cd 00 00 00 00 	lea    0x0(,%ecx,8),%edi
+  10795b:	89 7d f0             	mov    %edi,-0x10(%ebp)
+  10795e:	01 cf                	add    %ecx,%edi
+  107960:	8d 34 c5 00 00 00 00 	lea    0x0(,%eax,8),%esi
+  107967:	89 75 ec             	mov    %esi,-0x14(%ebp)
+  10796a:	01 c6                	add    %eax,%esi
+  10796c:	c1 e6 04             	shl    $0x4,%esi
+  10796f:	8d 3c be             	lea    (%esi,%edi,4),%edi
+  107972:	89 9f a0 e9 11 00    	mov    %ebx,0x11e9a0(%edi)
+	ec->ec_generation = dwarf_generation;
+  107978:	8b 1d 28 53 11 00    	mov    0x115328,%ebx
+  10797e:	89 9f a4 e9 11 00    	mov    %ebx,0x11e9a4(%edi)
+	ec->ec_code = code;
+  107984:	8b 5d e8             	mov    -0x18(%ebp),%ebx
+  107987:	89 9f a8 e9 11 00    	mov    %ebx,0x11e9a8(%edi)
+	ec->ec_info = *info;
+  10798d:	8b 7d f0             	mov    -0x10(%ebp),%edi
+  107990:	01 f9                	add    %edi,%ecx
+  107992:	8b 75 ec             	mov    -0x14(%ebp),%esi
+  107995:	01 f0                	add    %esi,%eax
+  107997:	c1 e0 04             	shl    $0x4,%eax
+  10799a:	8d 84 88 a0 e9 11 00 	lea    0x11e9a0(%eax,%ecx,4),%eax
+  1079a1:	8b 0a                	mov    (%edx),%ecx
+  1079a3:	89 48 0c             	mov    %ecx,0xc(%eax)
+  1079a6:	8b 4a 04             	mov    0x4(%edx),%ecx
+  1079a9:	89 48 10             	mov    %ecx,0x10(%eax)
+  1079ac:	8b 4a 08             	mov    0x8(%edx),%ecx
+  1079af:	89 48 14             	mov    %ecx,0x14(%eax)
+  1079b2:	8b 4a 0c             	mov    0xc(%edx),%ecx
+  1079b5:	89 48 18             	mov    %ecx,0x18(%eax)
+  1079b8:	8b 4a 10             	mov    0x10(%edx),%ecx
+  1079bb:	89 48 1c             	mov    %ecx,0x1c(%eax)
+  1079be:	8b 52 14             	mov    0x14(%edx),%edx
+  1079c1:	89 50 20             	mov    %edx,0x20(%eax)
+}
+  1079c4:	83 c4 0c             	add    $0xc,%esp
+  1079c7:	5b                   	pop    %ebx
+  1079c8:	5e                   	pop    %esi
+  1079c9:	5f                   	pop    %edi
+  1079ca:	5d                   	pop    %ebp
+  1079cb:	c3                   	ret
+
+001079cc <load_kernel_dwarf_info>:
+{
+  1079cc:	55                   	push   %ebp
+  1079cd:	89 e5                	mov    %esp,%ebp
+  1079cf:	8b 45 08             	mov    0x8(%ebp),%eax
+	addrs->abbrev_begin = __DEBUG_ABBREV_BEGIN__;
+  1079d2:	c7 00 00 30 12 00    	movl   $0x123000,(%eax)
+	addrs->abbrev_end = __DEBUG_ABBREV_END__;
+  1079d8:	c7 40 04 78 5d 12 00 	movl   $0x125d78,0x4(%eax)
+	addrs->aranges_begin = __DEBUG_ARANGES_BEGIN__;
+  1079df:	c7 40 08 00 20 12 00 	movl   $0x122000,0x8(%eax)
+	addrs->aranges_end = __DEBUG_ARANGES_END__;
+  1079e6:	c7 40 0c e0 21 12 00 	movl   $0x1221e0,0xc(%eax)
+	addrs->info_begin = __DEBUG_INFO_BEGIN__;
+  1079ed:	c7 40 10 00 60 12 00 	movl   $0x126000,0x10(%eax)
+	addrs->info_end = __DEBUG_INFO_END__;
+  1079f4:	c7 40 14 b9 7c 13 00 	movl   $0x137cb9,0x14(%eax)
+	addrs->line_begin = __DEBUG_LINE_BEGIN__;
+  1079fb:	c7 40 18 00 80 13 00 	movl   $0x138000,0x18(%eax)
+	addrs->line_end = __DEBUG_LINE_END__;
+  107a02:	c7 40 1c 95 0d 14 00 	movl   $0x140d95,0x1c(%eax)
+	addrs->str_begin = __DEBUG_STR_BEGIN__;
+  107a09:	c7 40 20 00 10 14 00 	movl   $0x141000,0x20(%eax)
+	addrs->str_end = __DEBUG_STR_END__;
+  107a10:	c7 40 24 0d 2e 14 00 	movl   $0x142e0d,0x24(%eax)
+	addrs->pubnames_begin = __DEBUG_PUBNAMES_BEGIN__;
+  107a17:	c7 40 28 00 30 14 00 	movl   $0x143000,0x28(%eax)
+	addrs->pubnames_end = __DEBUG_PUBNAMES_END__;
+  107a1e:	c7 40 2c e0 4d 14 00 	movl   $0x144de0,0x2c(%eax)
+	addrs->pubtypes_begin = __DEBUG_PUBTYPES_BEGIN__;
+  107a25:	c7 40 30 00 50 14 00 	movl   $0x145000,0x30(%eax)
+	addrs->pubtypes_end = __DEBUG_PUBTYPES_END__;
+  107a2c:	c7 40 34 d4 62 14 00 	movl   $0x1462d4,0x34(%eax)
+	addrs->line_str_begin = __DEBUG_LINE_STR_BEGIN__;
+  107a33:	c7 40 38 00 70 14 00 	movl   $0x147000,0x38(%eax)
+	addrs->line_str_end = __DEBUG_LINE_STR_END__;
+  107a3a:	c7 40 3c 6d 71 14 00 	movl   $0x14716d,0x3c(%eax)
+	addrs->str_offsets_begin = __DEBUG_STR_OFFSETS_BEGIN__;
+  107a41:	c7 40 40 00 80 14 00 	movl   $0x148000,0x40(%eax)
+	addrs->str_offsets_end = __DEBUG_STR_OFFSETS_END__;
+  107a48:	c7 40 44 00 80 14 00 	movl   $0x148000,0x44(%eax)
+	addrs->addr_begin = __DEBUG_ADDR_BEGIN__;
+  107a4f:	c7 40 48 00 90 14 00 	movl   $0x149000,0x48(%eax)
+	addrs->addr_end = __DEBUG_ADDR_END__;
+  107a56:	c7 40 4c 00 90 14 00 	movl   $0x149000,0x4c(%eax)
+	addrs->names_begin = __DEBUG_NAMES_BEGIN__;
+  107a5d:	c7 40 50 00 a0 14 00 	movl   $0x14a000,0x50(%eax)
+	addrs->names_end = __DEBUG_NAMES_END__;
+  107a64:	c7 40 54 00 a0 14 00 	movl   $0x14a000,0x54(%eax)
+	addrs->ranges_begin = __DEBUG_RANGES_BEGIN__;
+  107a6b:	c7 40 58 00 b0 14 00 	movl   $0x14b000,0x58(%eax)
+	addrs->ranges_end = __DEBUG_RANGES_END__;
+  107a72:	c7 40 5c 00 b0 14 00 	movl   $0x14b000,0x5c(%eax)
+	addrs->rnglists_begin = __DEBUG_RNGLISTS_BEGIN__;
+  107a79:	c7 40 60 00 c0 14 00 	movl   $0x14c000,0x60(%eax)
+	addrs->rnglists_end = __DEBUG_RNGLISTS_END__;
+  107a80:	c7 40 64 cb c7 14 00 	movl   $0x14c7cb,0x64(%eax)
+}
+  107a87:	5d                   	pop    %ebp
+  107a88:	c3                   	ret
+
+00107a89 <debuginfo_eip>:
+{
+  107a89:	55                   	push   %ebp
+  107a8a:	89 e5                	mov    %esp,%ebp
+  107a8c:	57                   	push   %edi
+  107a8d:	56                   	push   %esi
+  107a8e:	53                   	push   %ebx
+  107a8f:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  107a95:	8b 75 08             	mov    0x8(%ebp),%esi
+  107a98:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	if ((ec = eipcache_find(addr)) != NULL) {
+  107a9b:	89 f0                	mov    %esi,%eax
+  107a9d:	e8 a6 fd ff ff       	call   107848 <eipcache_find>
+  107aa2:	85 c0                	test   %eax,%eax
+  107aa4:	74 30                	je     107ad6 <debuginfo_eip+0x4d>
+		*info = ec->ec_info;
+  107aa6:	8b 50 0c             	mov    0xc(%eax),%edx
+  107aa9:	89 13                	mov    %edx,(%ebx)
+  107aab:	8b 50 10             	mov    0x10(%eax),%edx
+  107aae:	89 53 04             	mov    %edx,0x4(%ebx)
+  107ab1:	8b 50 14             	mov    0x14(%eax),%edx
+  107ab4:	89 53 08             	mov    %edx,0x8(%ebx)
+  107ab7:	8b 50 18             	mov    0x18(%eax),%edx
+  107aba:	89 53 0c             	mov    %edx,0xc(%ebx)
+  107abd:	8b 50 1c             	mov    0x1c(%eax),%edx
+  107ac0:	89 53 10             	mov    %edx,0x10(%ebx)
+  107ac3:	8b 50 20             	mov    0x20(%eax),%edx
+  107ac6:	89 53 14             	mov    %edx,0x14(%ebx)
+		return ec->ec_code;
+  107ac9:	8b 78 08             	mov    0x8(%eax),%edi
+}
+  107acc:	89 f8                	mov    %edi,%eax
+  107ace:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  107ad1:	5b                   	pop    %ebx
+  107ad2:	5e                   	pop    %esi
+  107ad3:	5f                   	pop    %edi
+  107ad4:	5d                   	pop    %ebp
+  107ad5:	c3                   	ret
+	info->eip_file = "<unknown>";
+  107ad6:	c7 03 d0 9b 10 00    	movl   $0x109bd0,(%ebx)
+	info->eip_line = 0;
+  107adc:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+	info->eip_fn_name = "<unknown>";
+  107ae3:	c7 43 08 d0 9b 10 00 	movl   $0x109bd0,0x8(%ebx)
+	info->eip_fn_namelen = 9;
+  107aea:	c7 43 0c 09 00 00 00 	movl   $0x9,0xc(%ebx)
+	info->eip_fn_addr = addr;
+  107af1:	89 73 10             	mov    %esi,0x10(%ebx)
+	info->eip_fn_narg = 0;
+  107af4:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+	if (addr >= ULIM)
+  107afb:	81 fe ff ff 21 00    	cmp    $0x21ffff,%esi
+  107b01:	0f 87 ca 00 00 00    	ja     107bd1 <debuginfo_eip+0x148>
+{
+	// Initialize *info
+	debuginfo_eip_init(addr, info);
+
+	// The debug table has it all, without reading the debug sections.
+	if (dbgtab_present())
+  107b07:	e8 bd 0a 00 00       	call   1085c9 <dbgtab_present>
+  107b0c:	84 c0                	test   %al,%al
+  107b0e:	0f 85 d4 00 00 00    	jne    107be8 <debuginfo_eip+0x15f>
+		return dbgtab_debuginfo(addr, info);
+
+	struct Dwarf_Addrs addrs;
+	load_kernel_dwarf_info(&addrs);
+  107b14:	83 ec 0c             	sub    $0xc,%esp
+  107b17:	8d 7d 80             	lea    -0x80(%ebp),%edi
+  107b1a:	57                   	push   %edi
+  107b1b:	e8 ac fe ff ff       	call   1079cc <load_kernel_dwarf_info>
+	Dwarf_Off offset = 0, line_offset = 0;
+  107b20:	c7 85 70 ff ff ff 00 	movl   $0x0,-0x90(%ebp)
+  107b27:	00 00 00 
+  107b2a:	c7 85 74 ff ff ff 00 	movl   $0x0,-0x8c(%ebp)
+  107b31:	00 00 00 
+  107b34:	c7 85 78 ff ff ff 00 	movl   $0x0,-0x88(%ebp)
+  107b3b:	00 00 00 
+  107b3e:	c7 85 7c ff ff ff 00 	movl   $0x0,-0x84(%ebp)
+  107b45:	00 00 00 
+	int code = info_by_address(&addrs, addr, &offset);
+  107b48:	83 c4 0c             	add    $0xc,%esp
+  107b4b:	8d 85 70 ff ff ff    	lea    -0x90(%ebp),%eax
+  107b51:	50                   	push   %eax
+  107b52:	56                   	push   %esi
+  107b53:	57                   	push   %edi
+  107b54:	e8 8f a8 ff ff       	call   1023e8 <info_by_address>
+  107b59:	89 c7                	mov    %eax,%edi
+	if (code < 0) {
+  107b5b:	83 c4 10             	add    $0x10,%esp
+  107b5e:	85 c0                	test   %eax,%eax
+  107b60:	0f 88 91 00 00 00    	js     107bf7 <debuginfo_eip+0x16e>
+		return code;
+	}
+	void *buf;
+	buf = &info->eip_file;
+	code = file_name_by_info(&addrs, offset, buf, sizeof(char*), &line_offset);
+  107b66:	83 ec 08             	sub    $0x8,%esp
+  107b69:	8d 85 78 ff ff ff    	lea    -0x88(%ebp),%eax
+  107b6f:	50                   	push   %eax
+  107b70:	6a 04                	push   $0x4
+  107b72:	53                   	push   %ebx
+  107b73:	ff b5 74 ff ff ff    	push   -0x8c(%ebp)
+  107b79:	ff b5 70 ff ff ff    	push   -0x90(%ebp)
+  107b7f:	8d 45 80             	lea    -0x80(%ebp),%eax
+  107b82:	50                   	push   %eax
+  107b83:	e8 7c a9 ff ff       	call   102504 <file_name_by_info>
+  107b88:	89 c7                	mov    %eax,%edi
+	if (code < 0) {
+  107b8a:	83 c4 20             	add    $0x20,%esp
+  107b8d:	85 c0                	test   %eax,%eax
+  107b8f:	78 66                	js     107bf7 <debuginfo_eip+0x16e>
+	}
+	// Find line number corresponding to given address.
+	// Hint: note that we need the address of `call` instruction, but eip holds
+	// address of the next instruction, so we should substract 5 from it.
+	// Without a line, the function is still worth looking up.
+	line_for_address(&addrs, addr - 5, line_offset, &info->eip_line);
+  107b91:	83 ec 0c             	sub    $0xc,%esp
+  107b94:	8d 43 04             	lea    0x4(%ebx),%eax
+  107b97:	50                   	push   %eax
+  107b98:	ff b5 7c ff ff ff    	push   -0x84(%ebp)
+  107b9e:	ff b5 78 ff ff ff    	push   -0x88(%ebp)
+  107ba4:	8d 46 fb             	lea    -0x5(%esi),%eax
+  107ba7:	50                   	push   %eax
+  107ba8:	8d 7d 80             	lea    -0x80(%ebp),%edi
+  107bab:	57                   	push   %edi
+  107bac:	e8 20 bf ff ff       	call   103ad1 <line_for_address>
+
+	return debuginfo_eip_function(&addrs, addr, offset, info);
+  107bb1:	83 c4 1c             	add    $0x1c,%esp
+  107bb4:	53                   	push   %ebx
+  107bb5:	ff b5 74 ff ff ff    	push   -0x8c(%ebp)
+  107bbb:	ff b5 70 ff ff ff    	push   -0x90(%ebp)
+  107bc1:	89 f2                	mov    %esi,%edx
+  107bc3:	89 f8                	mov    %edi,%eax
+  107bc5:	e8 d5 fc ff ff       	call   10789f <debuginfo_eip_function>
+  107bca:	89 c7                	mov    %eax,%edi
+  107bcc:	83 c4 10             	add    $0x10,%esp
+  107bcf:	eb 26                	jmp    107bf7 <debuginfo_eip+0x16e>
+		panic("Can't search for user-level addresses yet!");
+  107bd1:	83 ec 04             	sub    $0x4,%esp
+  107bd4:	68 ec a4 10 00       	push   $0x10a4ec
+  107bd9:	68 9f 00 00 00       	push   $0x9f
+  107bde:	68 14 a4 10 00       	push   $0x10a414
+  107be3:	e8 9f 84 ff ff       	call   100087 <_panic>
+		return dbgtab_debuginfo(addr, info);
+  107be8:	83 ec 08             	sub    $0x8,%esp
+  107beb:	53                   	push   %ebx
+  107bec:	56                   	push   %esi
+  107bed:	e8 a8 0a 00 00       	call   10869a <dbgtab_debuginfo>
+  107bf2:	89 c7                	mov    %eax,%edi
+  107bf4:	83 c4 10             	add    $0x10,%esp
+	eipcache_insert(addr, code, info);
+  107bf7:	89 d9                	mov    %ebx,%ecx
+  107bf9:	89 fa                	mov    %edi,%edx
+  107bfb:	89 f0                	mov    %esi,%eax
+  107bfd:	e8 1e fd ff ff       	call   107920 <eipcache_insert>
+	return code;
+  107c02:	e9 c5 fe ff ff       	jmp    107acc <debuginfo_eip+0x43>
+
+00107c07 <debug_section_name>:
+{
+  107c07:	55                   	push   %ebp
+  107c08:	89 e5                	mov    %esp,%ebp
+  107c0a:	8b 55 08             	mov    0x8(%ebp),%edx
+	for (i = 0; i < sizeof(sects) / sizeof(sects[0]); i++)
+  107c0d:	b8 00 00 00 00       	mov    $0x0,%eax
+		if ((uintptr_t) sects[i].begin == begin)
+  107c12:	39 14 c5 24 a5 10 00 	cmp    %edx,0x10a524(,%eax,8)
+  107c19:	74 0f                	je     107c2a <debug_section_name+0x23>
+	for (i = 0; i < sizeof(sects) / sizeof(sects[0]); i++)
+  107c1b:	83 c0 01             	add    $0x1,%eax
+  107c1e:	83 f8 0d             	cmp    $0xd,%eax
+  107c21:	75 ef                	jne    107c12 <debug_section_name+0xb>
+	return "debug section";
+  107c23:	b8 22 a4 10 00       	mov    $0x10a422,%eax
+}
+  107c28:	5d                   	pop    %ebp
+  107c29:	c3                   	ret
+			return sects[i].name;
+  107c2a:	8b 04 c5 20 a5 10 00 	mov    0x10a520(,%eax,8),%eax
+  107c31:	eb f5                	jmp    107c28 <debug_section_name+0x21>
+
+00107c33 <debuginfo_eip_batch>:
+//	table walked once for all the addresses in it.  Returns the number
+//	of addresses information was found for.
+//
+int
+debuginfo_eip_batch(const uintptr_t *eips, int n, struct Eipdebuginfo *out)
+{
+  107c33:	55                   	push   %ebp
+  107c34:	89 e5                	mov    %esp,%ebp
+  107c36:	57                   	push   %edi
+  107c37:	56                   	push   %esi
+  107c38:	53                   	push   %ebx
+  107c39:	81 ec ac 03 00 00    	sub    $0x3ac,%esp
+  107c3f:	8b 7d 08             	mov    0x8(%ebp),%edi
+	struct Eipcache_entry *ec;
+	int order[EIPBATCH], codes[EIPBATCH];
+	int base, i, j, k, m, nfound = 0;
+  107c42:	c7 85 58 fc ff ff 00 	movl   $0x0,-0x3a8(%ebp)
+  107c49:	00 00 00 
+
+	for (base = 0; base < n; base += EIPBATCH) {
+  107c4c:	c7 85 4c fc ff ff 00 	movl   $0x0,-0x3b4(%ebp)
+  107c53:	00 00 00 
+  107c56:	e9 b4 03 00 00       	jmp    10800f <debuginfo_eip_batch+0x3dc>
+			if ((ec = eipcache_find(eips[i])) != NULL) {
+				out[i] = ec->ec_info;
+				nfound += ec->ec_code == 0;
+				continue;
+			}
+			debuginfo_eip_init(eips[i], &out[i]);
+  107c5b:	8b 04 b7             	mov    (%edi,%esi,4),%eax
+	info->eip_file = "<unknown>";
+  107c5e:	c7 03 d0 9b 10 00    	movl   $0x109bd0,(%ebx)
+	info->eip_line = 0;
+  107c64:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+	info->eip_fn_name = "<unknown>";
+  107c6b:	c7 43 08 d0 9b 10 00 	movl   $0x109bd0,0x8(%ebx)
+	info->eip_fn_namelen = 9;
+  107c72:	c7 43 0c 09 00 00 00 	movl   $0x9,0xc(%ebx)
+	info->eip_fn_addr = addr;
+  107c79:	89 43 10             	mov    %eax,0x10(%ebx)
+	info->eip_fn_narg = 0;
+  107c7c:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+	if (addr >= ULIM)
+  107c83:	3d ff ff 21 00       	cmp    $0x21ffff,%eax
+  107c88:	77 1a                	ja     107ca4 <debuginfo_eip_batch+0x71>
+  107c8a:	8b 95 64 fc ff ff    	mov    -0x39c(%ebp),%edx
+  107c90:	89 b5 54 fc ff ff    	mov    %esi,-0x3ac(%ebp)
+  107c96:	89 9d 50 fc ff ff    	mov    %ebx,-0x3b0(%ebp)
+  107c9c:	8b b5 5c fc ff ff    	mov    -0x3a4(%ebp),%esi
+  107ca2:	eb 20                	jmp    107cc4 <debuginfo_eip_batch+0x91>
+		panic("Can't search for user-level addresses yet!");
+  107ca4:	83 ec 04             	sub    $0x4,%esp
+  107ca7:	68 ec a4 10 00       	push   $0x10a4ec
+  107cac:	68 9f 00 00 00       	push   $0x9f
+  107cb1:	68 14 a4 10 00       	push   $0x10a414
+  107cb6:	e8 cc 83 ff ff       	call   100087 <_panic>
+			for (j = m; j > 0 && eips[order[j - 1]] > eips[i]; j--)
+				order[j] = order[j - 1];
+  107cbb:	89 8c 85 6c ff ff ff 	mov    %ecx,-0x94(%ebp,%eax,4)
+			for (j = m; j > 0 && eips[order[j - 1]] > eips[i]; j--)
+  107cc2:	89 c2                	mov    %eax,%edx
+  107cc4:	85 d2                	test   %edx,%edx
+  107cc6:	7e 12                	jle    107cda <debuginfo_eip_batch+0xa7>
+  107cc8:	8d 42 ff             	lea    -0x1(%edx),%eax
+  107ccb:	8b 8c 85 68 ff ff ff 	mov    -0x98(%ebp,%eax,4),%ecx
+  107cd2:	8b 1c 8f             	mov    (%edi,%ecx,4),%ebx
+  107cd5:	39 1c b7             	cmp    %ebx,(%edi,%esi,4)
+  107cd8:	72 e1                	jb     107cbb <debuginfo_eip_batch+0x88>
+			order[j] = i;
+  107cda:	8b b5 54 fc ff ff    	mov    -0x3ac(%ebp),%esi
+  107ce0:	8b 9d 50 fc ff ff    	mov    -0x3b0(%ebp),%ebx
+  107ce6:	89 b4 95 68 ff ff ff 	mov    %esi,-0x98(%ebp,%edx,4)
+			m++;
+  107ced:	83 85 64 fc ff ff 01 	addl   $0x1,-0x39c(%ebp)
+		for (i = base, m = 0; i < n && i < base + EIPBATCH; i++) {
+  107cf4:	83 c6 01             	add    $0x1,%esi
+  107cf7:	83 c3 18             	add    $0x18,%ebx
+  107cfa:	39 75 0c             	cmp    %esi,0xc(%ebp)
+  107cfd:	74 50                	je     107d4f <debuginfo_eip_batch+0x11c>
+  107cff:	8b 85 60 fc ff ff    	mov    -0x3a0(%ebp),%eax
+  107d05:	39 c6                	cmp    %eax,%esi
+  107d07:	7f 46                	jg     107d4f <debuginfo_eip_batch+0x11c>
+			if ((ec = eipcache_find(eips[i])) != NULL) {
+  107d09:	89 b5 5c fc ff ff    	mov    %esi,-0x3a4(%ebp)
+  107d0f:	8b 04 b7             	mov    (%edi,%esi,4),%eax
+  107d12:	e8 31 fb ff ff       	call   107848 <eipcache_find>
+  107d17:	85 c0                	test   %eax,%eax
+  107d19:	0f 84 3c ff ff ff    	je     107c5b <debuginfo_eip_batch+0x28>
+				out[i] = ec->ec_info;
+  107d1f:	8b 50 0c             	mov    0xc(%eax),%edx
+  107d22:	89 13                	mov    %edx,(%ebx)
+  107d24:	8b 50 10             	mov    0x10(%eax),%edx
+  107d27:	89 53 04             	mov    %edx,0x4(%ebx)
+  107d2a:	8b 50 14             	mov    0x14(%eax),%edx
+  107d2d:	89 53 08             	mov    %edx,0x8(%ebx)
+  107d30:	8b 50 18             	mov    0x18(%eax),%edx
+  107d33:	89 53 0c             	mov    %edx,0xc(%ebx)
+  107d36:	8b 50 1c             	mov    0x1c(%eax),%edx
+  107d39:	89 53 10             	mov    %edx,0x10(%ebx)
+  107d3c:	8b 50 20             	mov    0x20(%eax),%edx
+  107d3f:	89 53 14             	mov    %edx,0x14(%ebx)
+				nfound += ec->ec_code == 0;
+  107d42:	83 78 08 01          	cmpl   $0x1,0x8(%eax)
+  107d46:	83 95 58 fc ff ff 00 	adcl   $0x0,-0x3a8(%ebp)
+				continue;
+  107d4d:	eb a5                	jmp    107cf4 <debuginfo_eip_batch+0xc1>
+		}
+
+		if (dbgtab_present())
+  107d4f:	e8 75 08 00 00       	call   1085c9 <dbgtab_present>
+  107d54:	84 c0                	test   %al,%al
+  107d56:	74 28                	je     107d80 <debuginfo_eip_batch+0x14d>
+			dbgtab_debuginfo_batch(eips, order, m, out, codes);
+  107d58:	83 ec 0c             	sub    $0xc,%esp
+  107d5b:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+  107d61:	50                   	push   %eax
+  107d62:	ff 75 10             	push   0x10(%ebp)
+  107d65:	ff b5 64 fc ff ff    	push   -0x39c(%ebp)
+  107d6b:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  107d71:	50                   	push   %eax
+  107d72:	57                   	push   %edi
+  107d73:	e8 54 09 00 00       	call   1086cc <dbgtab_debuginfo_batch>
+  107d78:	83 c4 20             	add    $0x20,%esp
+  107d7b:	e9 19 02 00 00       	jmp    107f99 <debuginfo_eip_batch+0x366>
+	Dwarf_Off offsets[EIPBATCH], line_offset = 0;
+  107d80:	c7 85 78 fc ff ff 00 	movl   $0x0,-0x388(%ebp)
+  107d87:	00 00 00 
+  107d8a:	c7 85 7c fc ff ff 00 	movl   $0x0,-0x384(%ebp)
+  107d91:	00 00 00 
+	load_kernel_dwarf_info(&addrs);
+  107d94:	83 ec 0c             	sub    $0xc,%esp
+  107d97:	8d 85 80 fc ff ff    	lea    -0x380(%ebp),%eax
+  107d9d:	50                   	push   %eax
+  107d9e:	e8 29 fc ff ff       	call   1079cc <load_kernel_dwarf_info>
+	for (k = 0; k < n; k++) {
+  107da3:	8d b5 e8 fd ff ff    	lea    -0x218(%ebp),%esi
+  107da9:	83 c4 10             	add    $0x10,%esp
+  107dac:	bb 00 00 00 00       	mov    $0x0,%ebx
+  107db1:	eb 37                	jmp    107dea <debuginfo_eip_batch+0x1b7>
+		offsets[k] = 0;
+  107db3:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+  107db9:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+		codes[k] = info_by_address(&addrs, eips[order[k]], &offsets[k]);
+  107dc0:	83 ec 04             	sub    $0x4,%esp
+  107dc3:	56                   	push   %esi
+  107dc4:	8b 84 9d 68 ff ff ff 	mov    -0x98(%ebp,%ebx,4),%eax
+  107dcb:	ff 34 87             	push   (%edi,%eax,4)
+  107dce:	8d 85 80 fc ff ff    	lea    -0x380(%ebp),%eax
+  107dd4:	50                   	push   %eax
+  107dd5:	e8 0e a6 ff ff       	call   1023e8 <info_by_address>
+  107dda:	89 84 9d e8 fe ff ff 	mov    %eax,-0x118(%ebp,%ebx,4)
+	for (k = 0; k < n; k++) {
+  107de1:	83 c3 01             	add    $0x1,%ebx
+  107de4:	83 c6 08             	add    $0x8,%esi
+  107de7:	83 c4 10             	add    $0x10,%esp
+  107dea:	39 9d 64 fc ff ff    	cmp    %ebx,-0x39c(%ebp)
+  107df0:	7f c1                	jg     107db3 <debuginfo_eip_batch+0x180>
+	for (k = 0; k < n; k = j) {
+  107df2:	be 00 00 00 00       	mov    $0x0,%esi
+  107df7:	89 7d 08             	mov    %edi,0x8(%ebp)
+  107dfa:	e9 88 00 00 00       	jmp    107e87 <debuginfo_eip_batch+0x254>
+		     && (codes[k] < 0 || offsets[j] == offsets[k]); j++)
+  107dff:	83 c3 01             	add    $0x1,%ebx
+  107e02:	39 d9                	cmp    %ebx,%ecx
+  107e04:	74 75                	je     107e7b <debuginfo_eip_batch+0x248>
+		for (j = k + 1; j < n && codes[j] == codes[k]
+  107e06:	8b 07                	mov    (%edi),%eax
+  107e08:	39 84 9d e8 fe ff ff 	cmp    %eax,-0x118(%ebp,%ebx,4)
+  107e0f:	75 6a                	jne    107e7b <debuginfo_eip_batch+0x248>
+		     && (codes[k] < 0 || offsets[j] == offsets[k]); j++)
+  107e11:	85 c0                	test   %eax,%eax
+  107e13:	78 ea                	js     107dff <debuginfo_eip_batch+0x1cc>
+  107e15:	8b 84 dd e8 fd ff ff 	mov    -0x218(%ebp,%ebx,8),%eax
+  107e1c:	8b 94 dd ec fd ff ff 	mov    -0x214(%ebp,%ebx,8),%edx
+  107e23:	33 84 f5 e8 fd ff ff 	xor    -0x218(%ebp,%esi,8),%eax
+  107e2a:	33 94 f5 ec fd ff ff 	xor    -0x214(%ebp,%esi,8),%edx
+  107e31:	09 d0                	or     %edx,%eax
+  107e33:	74 ca                	je     107dff <debuginfo_eip_batch+0x1cc>
+		if (codes[k] == 0) {
+  107e35:	83 3f 00             	cmpl   $0x0,(%edi)
+  107e38:	74 7b                	je     107eb5 <debuginfo_eip_batch+0x282>
+		lines_for_addresses(&addrs, line_offset, ps + k, j - k,
+  107e3a:	83 ec 08             	sub    $0x8,%esp
+  107e3d:	8b bd 60 fc ff ff    	mov    -0x3a0(%ebp),%edi
+  107e43:	8d 84 3d 68 fd ff ff 	lea    -0x298(%ebp,%edi,1),%eax
+  107e4a:	50                   	push   %eax
+  107e4b:	89 d8                	mov    %ebx,%eax
+  107e4d:	29 f0                	sub    %esi,%eax
+  107e4f:	50                   	push   %eax
+  107e50:	8d 84 3d e8 fc ff ff 	lea    -0x318(%ebp,%edi,1),%eax
+  107e57:	50                   	push   %eax
+  107e58:	ff b5 7c fc ff ff    	push   -0x384(%ebp)
+  107e5e:	ff b5 78 fc ff ff    	push   -0x388(%ebp)
+  107e64:	8d 85 80 fc ff ff    	lea    -0x380(%ebp),%eax
+  107e6a:	50                   	push   %eax
+  107e6b:	e8 a5 be ff ff       	call   103d15 <lines_for_addresses>
+		for (i = k; i < j; i++) {
+  107e70:	83 c4 20             	add    $0x20,%esp
+  107e73:	8b 7d 10             	mov    0x10(%ebp),%edi
+  107e76:	e9 12 01 00 00       	jmp    107f8d <debuginfo_eip_batch+0x35a>
+		if (codes[k] == 0) {
+  107e7b:	83 3f 00             	cmpl   $0x0,(%edi)
+  107e7e:	74 35                	je     107eb5 <debuginfo_eip_batch+0x282>
+		if (codes[k] < 0)
+  107e80:	83 3f 00             	cmpl   $0x0,(%edi)
+  107e83:	79 b5                	jns    107e3a <debuginfo_eip_batch+0x207>
+			for (i = k; i < j; i++) {
+  107e85:	89 de                	mov    %ebx,%esi
+	for (k = 0; k < n; k = j) {
+  107e87:	39 b5 64 fc ff ff    	cmp    %esi,-0x39c(%ebp)
+  107e8d:	0f 8e 03 01 00 00    	jle    107f96 <debuginfo_eip_batch+0x363>
+		for (j = k + 1; j < n && codes[j] == codes[k]
+  107e93:	8d 5e 01             	lea    0x1(%esi),%ebx
+  107e96:	8d 04 b5 00 00 00 00 	lea    0x0(,%esi,4),%eax
+  107e9d:	89 85 60 fc ff ff    	mov    %eax,-0x3a0(%ebp)
+  107ea3:	8d bc 05 e8 fe ff ff 	lea    -0x118(%ebp,%eax,1),%edi
+  107eaa:	8b 8d 64 fc ff ff    	mov    -0x39c(%ebp),%ecx
+  107eb0:	e9 4d ff ff ff       	jmp    107e02 <debuginfo_eip_batch+0x1cf>
+			codes[k] = file_name_by_info(&addrs, offsets[k],
+  107eb5:	83 ec 08             	sub    $0x8,%esp
+  107eb8:	8d 85 78 fc ff ff    	lea    -0x388(%ebp),%eax
+  107ebe:	50                   	push   %eax
+  107ebf:	6a 04                	push   $0x4
+  107ec1:	8d 85 74 fc ff ff    	lea    -0x38c(%ebp),%eax
+  107ec7:	50                   	push   %eax
+  107ec8:	ff b4 f5 ec fd ff ff 	push   -0x214(%ebp,%esi,8)
+  107ecf:	ff b4 f5 e8 fd ff ff 	push   -0x218(%ebp,%esi,8)
+  107ed6:	8d 85 80 fc ff ff    	lea    -0x380(%ebp),%eax
+  107edc:	50                   	push   %eax
+  107edd:	e8 22 a6 ff ff       	call   102504 <file_name_by_info>
+  107ee2:	89 07                	mov    %eax,(%edi)
+					out[order[i]].eip_file = file;
+  107ee4:	8b 85 74 fc ff ff    	mov    -0x38c(%ebp),%eax
+  107eea:	89 85 5c fc ff ff    	mov    %eax,-0x3a4(%ebp)
+			for (i = k; i < j; i++) {
+  107ef0:	83 c4 20             	add    $0x20,%esp
+  107ef3:	89 f0                	mov    %esi,%eax
+  107ef5:	89 b5 54 fc ff ff    	mov    %esi,-0x3ac(%ebp)
+  107efb:	eb 03                	jmp    107f00 <debuginfo_eip_batch+0x2cd>
+  107efd:	83 c0 01             	add    $0x1,%eax
+  107f00:	39 c3                	cmp    %eax,%ebx
+  107f02:	7e 35                	jle    107f39 <debuginfo_eip_batch+0x306>
+				ps[i] = eips[order[i]] - 5;
+  107f04:	8b 8c 85 68 ff ff ff 	mov    -0x98(%ebp,%eax,4),%ecx
+  107f0b:	8b 75 08             	mov    0x8(%ebp),%esi
+  107f0e:	8b 14 8e             	mov    (%esi,%ecx,4),%edx
+  107f11:	83 ea 05             	sub    $0x5,%edx
+  107f14:	89 94 85 e8 fc ff ff 	mov    %edx,-0x318(%ebp,%eax,4)
+				codes[i] = codes[k];
+  107f1b:	8b 17                	mov    (%edi),%edx
+  107f1d:	89 94 85 e8 fe ff ff 	mov    %edx,-0x118(%ebp,%eax,4)
+				if (codes[k] == 0)
+  107f24:	85 d2                	test   %edx,%edx
+  107f26:	75 d5                	jne    107efd <debuginfo_eip_batch+0x2ca>
+					out[order[i]].eip_file = file;
+  107f28:	8d 14 49             	lea    (%ecx,%ecx,2),%edx
+  107f2b:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  107f2e:	8b b5 5c fc ff ff    	mov    -0x3a4(%ebp),%esi
+  107f34:	89 34 d1             	mov    %esi,(%ecx,%edx,8)
+  107f37:	eb c4                	jmp    107efd <debuginfo_eip_batch+0x2ca>
+  107f39:	8b b5 54 fc ff ff    	mov    -0x3ac(%ebp),%esi
+  107f3f:	e9 3c ff ff ff       	jmp    107e80 <debuginfo_eip_batch+0x24d>
+			out[order[i]].eip_line = lines[i];
+  107f44:	8b 84 b5 68 ff ff ff 	mov    -0x98(%ebp,%esi,4),%eax
+  107f4b:	8d 14 40             	lea    (%eax,%eax,2),%edx
+  107f4e:	8d 14 d7             	lea    (%edi,%edx,8),%edx
+  107f51:	8b 8c b5 68 fd ff ff 	mov    -0x298(%ebp,%esi,4),%ecx
+  107f58:	89 4a 04             	mov    %ecx,0x4(%edx)
+			codes[i] = debuginfo_eip_function(&addrs, eips[order[i]],
+  107f5b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  107f5e:	8b 04 81             	mov    (%ecx,%eax,4),%eax
+  107f61:	83 ec 04             	sub    $0x4,%esp
+  107f64:	52                   	push   %edx
+  107f65:	ff b4 f5 ec fd ff ff 	push   -0x214(%ebp,%esi,8)
+  107f6c:	ff b4 f5 e8 fd ff ff 	push   -0x218(%ebp,%esi,8)
+  107f73:	89 c2                	mov    %eax,%edx
+  107f75:	8d 85 80 fc ff ff    	lea    -0x380(%ebp),%eax
+  107f7b:	e8 1f f9 ff ff       	call   10789f <debuginfo_eip_function>
+  107f80:	89 84 b5 e8 fe ff ff 	mov    %eax,-0x118(%ebp,%esi,4)
+		for (i = k; i < j; i++) {
+  107f87:	83 c6 01             	add    $0x1,%esi
+  107f8a:	83 c4 10             	add    $0x10,%esp
+  107f8d:	39 f3                	cmp    %esi,%ebx
+  107f8f:	7f b3                	jg     107f44 <debuginfo_eip_batch+0x311>
+  107f91:	e9 ef fe ff ff       	jmp    107e85 <debuginfo_eip_batch+0x252>
+  107f96:	8b 7d 08             	mov    0x8(%ebp),%edi
+	for (k = 0; k < n; k = j) {
+  107f99:	bb 00 00 00 00       	mov    $0x0,%ebx
+  107f9e:	8b b5 58 fc ff ff    	mov    -0x3a8(%ebp),%esi
+  107fa4:	eb 2d                	jmp    107fd3 <debuginfo_eip_batch+0x3a0>
+			if (k > 0 && eips[order[k]] == eips[order[k - 1]]) {
+				nfound += codes[k] == 0;
+				continue;
+			}
+			eipcache_insert(eips[order[k]], codes[k],
+					&out[order[k]]);
+  107fa6:	8b 84 9d 68 ff ff ff 	mov    -0x98(%ebp,%ebx,4),%eax
+  107fad:	8d 14 40             	lea    (%eax,%eax,2),%edx
+  107fb0:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  107fb3:	8d 0c d1             	lea    (%ecx,%edx,8),%ecx
+			eipcache_insert(eips[order[k]], codes[k],
+  107fb6:	8b 94 9d e8 fe ff ff 	mov    -0x118(%ebp,%ebx,4),%edx
+  107fbd:	8b 04 87             	mov    (%edi,%eax,4),%eax
+  107fc0:	e8 5b f9 ff ff       	call   107920 <eipcache_insert>
+			nfound += codes[k] == 0;
+  107fc5:	83 bc 9d e8 fe ff ff 	cmpl   $0x1,-0x118(%ebp,%ebx,4)
+  107fcc:	01 
+  107fcd:	83 d6 00             	adc    $0x0,%esi
+		for (k = 0; k < m; k++) {
+  107fd0:	83 c3 01             	add    $0x1,%ebx
+  107fd3:	39 9d 64 fc ff ff    	cmp    %ebx,-0x39c(%ebp)
+  107fd9:	7e 27                	jle    108002 <debuginfo_eip_batch+0x3cf>
+			if (k > 0 && eips[order[k]] == eips[order[k - 1]]) {
+  107fdb:	85 db                	test   %ebx,%ebx
+  107fdd:	7e c7                	jle    107fa6 <debuginfo_eip_batch+0x373>
+  107fdf:	8b 94 9d 68 ff ff ff 	mov    -0x98(%ebp,%ebx,4),%edx
+  107fe6:	8b 84 9d 64 ff ff ff 	mov    -0x9c(%ebp,%ebx,4),%eax
+  107fed:	8b 04 87             	mov    (%edi,%eax,4),%eax
+  107ff0:	39 04 97             	cmp    %eax,(%edi,%edx,4)
+  107ff3:	75 b1                	jne    107fa6 <debuginfo_eip_batch+0x373>
+				nfound += codes[k] == 0;
+  107ff5:	83 bc 9d e8 fe ff ff 	cmpl   $0x1,-0x118(%ebp,%ebx,4)
+  107ffc:	01 
+  107ffd:	83 d6 00             	adc    $0x0,%esi
+				continue;
+  108000:	eb ce                	jmp    107fd0 <debuginfo_eip_batch+0x39d>
+	for (base = 0; base < n; base += EIPBATCH) {
+  108002:	89 b5 58 fc ff ff    	mov    %esi,-0x3a8(%ebp)
+  108008:	83 85 4c fc ff ff 20 	addl   $0x20,-0x3b4(%ebp)
+  10800f:	8b 8d 4c fc ff ff    	mov    -0x3b4(%ebp),%ecx
+  108015:	3b 4d 0c             	cmp    0xc(%ebp),%ecx
+  108018:	7d 23                	jge    10803d <debuginfo_eip_batch+0x40a>
+  10801a:	8d 04 49             	lea    (%ecx,%ecx,2),%eax
+  10801d:	8b 75 10             	mov    0x10(%ebp),%esi
+  108020:	8d 1c c6             	lea    (%esi,%eax,8),%ebx
+		for (i = base, m = 0; i < n && i < base + EIPBATCH; i++) {
+  108023:	89 ce                	mov    %ecx,%esi
+  108025:	c7 85 64 fc ff ff 00 	movl   $0x0,-0x39c(%ebp)
+  10802c:	00 00 00 
+  10802f:	8d 41 1f             	lea    0x1f(%ecx),%eax
+  108032:	89 85 60 fc ff ff    	mov    %eax,-0x3a0(%ebp)
+  108038:	e9 c2 fc ff ff       	jmp    107cff <debuginfo_eip_batch+0xcc>
+		}
+	}
+	return nfound;
+}
+  10803d:	8b 85 58 fc ff ff    	mov    -0x3a8(%ebp),%eax
+  108043:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  108046:	5b                   	pop    %ebx
+  108047:	5e                   	pop    %esi
+  108048:	5f                   	pop    %edi
+  108049:	5d                   	pop    %ebp
+  10804a:	c3                   	ret
+
+0010804b <debuginfo_eip_inline>:
+//	is.  The file names are good until the next call.
+//
+int
+debuginfo_eip_inline(uintptr_t addr, const struct Eipdebuginfo *info,
+		     struct Eipinline *frames, int nframes)
+{
+  10804b:	55                   	push   %ebp
+  10804c:	89 e5                	mov    %esp,%ebp
+  10804e:	57                   	push   %edi
+  10804f:	56                   	push   %esi
+  108050:	53                   	push   %ebx
+  108051:	81 ec 4c 02 00 00    	sub    $0x24c,%esp
+  108057:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	struct Dwarf_Inline chain[DWARF_MAXINLINE];
+	struct Dwarf_Addrs addrs;
+	Dwarf_Off offset = 0;
+  10805a:	c7 85 b8 fd ff ff 00 	movl   $0x0,-0x248(%ebp)
+  108061:	00 00 00 
+  108064:	c7 85 bc fd ff ff 00 	movl   $0x0,-0x244(%ebp)
+  10806b:	00 00 00 
+	int i, n = 0;
+
+	if (nframes <= 0)
+		return 0;
+  10806e:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (nframes <= 0)
+  108073:	85 db                	test   %ebx,%ebx
+  108075:	0f 8e f0 01 00 00    	jle    10826b <debuginfo_eip_inline+0x220>
+	// The debug table has the inlined functions, too.
+	if (dbgtab_present())
+  10807b:	e8 49 05 00 00       	call   1085c9 <dbgtab_present>
+  108080:	84 c0                	test   %al,%al
+  108082:	75 4a                	jne    1080ce <debuginfo_eip_inline+0x83>
+		return dbgtab_debuginfo_inline(addr, info, frames, nframes);
+	load_kernel_dwarf_info(&addrs);
+  108084:	83 ec 0c             	sub    $0xc,%esp
+  108087:	8d bd c0 fd ff ff    	lea    -0x240(%ebp),%edi
+  10808d:	57                   	push   %edi
+  10808e:	e8 39 f9 ff ff       	call   1079cc <load_kernel_dwarf_info>
+	// The call instruction, as for the line, which a noreturn call at
+	// the end of a unit has in a different unit from 'addr'
+	if (info_by_address(&addrs, addr - 5, &offset) == 0)
+  108093:	8b 45 08             	mov    0x8(%ebp),%eax
+  108096:	8d 70 fb             	lea    -0x5(%eax),%esi
+  108099:	83 c4 0c             	add    $0xc,%esp
+  10809c:	8d 85 b8 fd ff ff    	lea    -0x248(%ebp),%eax
+  1080a2:	50                   	push   %eax
+  1080a3:	56                   	push   %esi
+  1080a4:	57                   	push   %edi
+  1080a5:	e8 3e a3 ff ff       	call   1023e8 <info_by_address>
+  1080aa:	83 c4 10             	add    $0x10,%esp
+	int i, n = 0;
+  1080ad:	c7 85 ac fd ff ff 00 	movl   $0x0,-0x254(%ebp)
+  1080b4:	00 00 00 
+	if (info_by_address(&addrs, addr - 5, &offset) == 0)
+  1080b7:	85 c0                	test   %eax,%eax
+  1080b9:	74 2a                	je     1080e5 <debuginfo_eip_inline+0x9a>
+		n = dwarf_inline_lookup(&addrs, offset, addr - 5, chain,
+					MIN(nframes - 1, DWARF_MAXINLINE));
+	if (n < 0)
+		n = 0;
+
+	for (i = 0; i < n; i++) {
+  1080bb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  1080be:	8d b5 30 fe ff ff    	lea    -0x1d0(%ebp),%esi
+  1080c4:	bf 00 00 00 00       	mov    $0x0,%edi
+  1080c9:	e9 c6 00 00 00       	jmp    108194 <debuginfo_eip_inline+0x149>
+		return dbgtab_debuginfo_inline(addr, info, frames, nframes);
+  1080ce:	53                   	push   %ebx
+  1080cf:	ff 75 10             	push   0x10(%ebp)
+  1080d2:	ff 75 0c             	push   0xc(%ebp)
+  1080d5:	ff 75 08             	push   0x8(%ebp)
+  1080d8:	e8 50 06 00 00       	call   10872d <dbgtab_debuginfo_inline>
+  1080dd:	83 c4 10             	add    $0x10,%esp
+  1080e0:	e9 86 01 00 00       	jmp    10826b <debuginfo_eip_inline+0x220>
+		n = dwarf_inline_lookup(&addrs, offset, addr - 5, chain,
+  1080e5:	83 ec 08             	sub    $0x8,%esp
+					MIN(nframes - 1, DWARF_MAXINLINE));
+  1080e8:	83 eb 01             	sub    $0x1,%ebx
+  1080eb:	b8 10 00 00 00       	mov    $0x10,%eax
+  1080f0:	39 c3                	cmp    %eax,%ebx
+  1080f2:	0f 4f d8             	cmovg  %eax,%ebx
+		n = dwarf_inline_lookup(&addrs, offset, addr - 5, chain,
+  1080f5:	53                   	push   %ebx
+  1080f6:	8d 85 28 fe ff ff    	lea    -0x1d8(%ebp),%eax
+  1080fc:	50                   	push   %eax
+  1080fd:	56                   	push   %esi
+  1080fe:	ff b5 bc fd ff ff    	push   -0x244(%ebp)
+  108104:	ff b5 b8 fd ff ff    	push   -0x248(%ebp)
+  10810a:	57                   	push   %edi
+  10810b:	e8 ec df ff ff       	call   1060fc <dwarf_inline_lookup>
+	if (n < 0)
+  108110:	85 c0                	test   %eax,%eax
+  108112:	ba 00 00 00 00       	mov    $0x0,%edx
+  108117:	0f 49 d0             	cmovns %eax,%edx
+  10811a:	89 95 ac fd ff ff    	mov    %edx,-0x254(%ebp)
+  108120:	83 c4 20             	add    $0x20,%esp
+  108123:	eb 96                	jmp    1080bb <debuginfo_eip_inline+0x70>
+		frames[i].ei_fn_name = chain[i].in_name;
+		frames[i].ei_fn_namelen = chain[i].in_namelen;
+		if (!chain[i].in_name) {
+			frames[i].ei_fn_name = "<unknown>";
+  108125:	c7 43 08 d0 9b 10 00 	movl   $0x109bd0,0x8(%ebx)
+			frames[i].ei_fn_namelen = 9;
+  10812c:	c7 43 0c 09 00 00 00 	movl   $0x9,0xc(%ebx)
+  108133:	e9 8a 00 00 00       	jmp    1081c2 <debuginfo_eip_inline+0x177>
+	if (dwarf_inline_file(addrs, offset, index, inline_files[i],
+  108138:	83 ec 08             	sub    $0x8,%esp
+  10813b:	6a 40                	push   $0x40
+  10813d:	68 20 e5 11 00       	push   $0x11e520
+		}
+		if (i == 0) {
+			frames[i].ei_file = inline_file(&addrs, offset,
+  108142:	0f b7 85 36 fe ff ff 	movzwl -0x1ca(%ebp),%eax
+	if (dwarf_inline_file(addrs, offset, index, inline_files[i],
+  108149:	50                   	push   %eax
+  10814a:	ff b5 bc fd ff ff    	push   -0x244(%ebp)
+  108150:	ff b5 b8 fd ff ff    	push   -0x248(%ebp)
+  108156:	8d 85 c0 fd ff ff    	lea    -0x240(%ebp),%eax
+  10815c:	50                   	push   %eax
+  10815d:	e8 ae e0 ff ff       	call   106210 <dwarf_inline_file>
+  108162:	83 c4 20             	add    $0x20,%esp
+	return inline_files[i];
+  108165:	85 c0                	test   %eax,%eax
+  108167:	b8 20 e5 11 00       	mov    $0x11e520,%eax
+  10816c:	b9 d0 9b 10 00       	mov    $0x109bd0,%ecx
+  108171:	0f 48 c1             	cmovs  %ecx,%eax
+			frames[i].ei_file = inline_file(&addrs, offset,
+  108174:	8b 95 b4 fd ff ff    	mov    -0x24c(%ebp),%edx
+  10817a:	89 02                	mov    %eax,(%edx)
+							chain[i].in_decl_file, i);
+			frames[i].ei_line = info->eip_line;
+  10817c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  10817f:	8b 40 04             	mov    0x4(%eax),%eax
+  108182:	8b 8d b4 fd ff ff    	mov    -0x24c(%ebp),%ecx
+  108188:	89 41 04             	mov    %eax,0x4(%ecx)
+	for (i = 0; i < n; i++) {
+  10818b:	83 c7 01             	add    $0x1,%edi
+  10818e:	83 c3 10             	add    $0x10,%ebx
+  108191:	83 c6 1c             	add    $0x1c,%esi
+  108194:	8b 85 ac fd ff ff    	mov    -0x254(%ebp),%eax
+  10819a:	39 c7                	cmp    %eax,%edi
+  10819c:	0f 84 90 00 00 00    	je     108232 <debuginfo_eip_inline+0x1e7>
+		frames[i].ei_fn_name = chain[i].in_name;
+  1081a2:	89 b5 b0 fd ff ff    	mov    %esi,-0x250(%ebp)
+  1081a8:	8b 06                	mov    (%esi),%eax
+  1081aa:	89 9d b4 fd ff ff    	mov    %ebx,-0x24c(%ebp)
+  1081b0:	89 43 08             	mov    %eax,0x8(%ebx)
+		frames[i].ei_fn_namelen = chain[i].in_namelen;
+  1081b3:	0f b7 56 0a          	movzwl 0xa(%esi),%edx
+  1081b7:	89 53 0c             	mov    %edx,0xc(%ebx)
+		if (!chain[i].in_name) {
+  1081ba:	85 c0                	test   %eax,%eax
+  1081bc:	0f 84 63 ff ff ff    	je     108125 <debuginfo_eip_inline+0xda>
+		if (i == 0) {
+  1081c2:	85 ff                	test   %edi,%edi
+  1081c4:	0f 84 6e ff ff ff    	je     108138 <debuginfo_eip_inline+0xed>
+	if (dwarf_inline_file(addrs, offset, index, inline_files[i],
+  1081ca:	89 f8                	mov    %edi,%eax
+  1081cc:	c1 e0 06             	shl    $0x6,%eax
+  1081cf:	89 85 a8 fd ff ff    	mov    %eax,-0x258(%ebp)
+  1081d5:	05 20 e5 11 00       	add    $0x11e520,%eax
+  1081da:	83 ec 08             	sub    $0x8,%esp
+  1081dd:	6a 40                	push   $0x40
+  1081df:	50                   	push   %eax
+		} else {
+			frames[i].ei_file = inline_file(&addrs, offset,
+  1081e0:	8b 95 b0 fd ff ff    	mov    -0x250(%ebp),%edx
+  1081e6:	0f b7 42 ec          	movzwl -0x14(%edx),%eax
+	if (dwarf_inline_file(addrs, offset, index, inline_files[i],
+  1081ea:	50                   	push   %eax
+  1081eb:	ff b5 bc fd ff ff    	push   -0x244(%ebp)
+  1081f1:	ff b5 b8 fd ff ff    	push   -0x248(%ebp)
+  1081f7:	8d 8d c0 fd ff ff    	lea    -0x240(%ebp),%ecx
+  1081fd:	51                   	push   %ecx
+  1081fe:	e8 0d e0 ff ff       	call   106210 <dwarf_inline_file>
+  108203:	83 c4 20             	add    $0x20,%esp
+		return "<unknown>";
+  108206:	8b 8d a8 fd ff ff    	mov    -0x258(%ebp),%ecx
+  10820c:	8d 91 20 e5 11 00    	lea    0x11e520(%ecx),%edx
+  108212:	85 c0                	test   %eax,%eax
+  108214:	b8 d0 9b 10 00       	mov    $0x109bd0,%eax
+  108219:	0f 49 c2             	cmovns %edx,%eax
+			frames[i].ei_file = inline_file(&addrs, offset,
+  10821c:	8b 8d b4 fd ff ff    	mov    -0x24c(%ebp),%ecx
+  108222:	89 01                	mov    %eax,(%ecx)
+							chain[i - 1].in_call_file,
+							i);
+			frames[i].ei_line = chain[i - 1].in_call_line;
+  108224:	8b 95 b0 fd ff ff    	mov    -0x250(%ebp),%edx
+  10822a:	8b 42 f0             	mov    -0x10(%edx),%eax
+  10822d:	e9 50 ff ff ff       	jmp    108182 <debuginfo_eip_inline+0x137>
+		}
+	}
+	frames[n].ei_fn_name = info->eip_fn_name;
+  108232:	89 c7                	mov    %eax,%edi
+  108234:	c1 e0 04             	shl    $0x4,%eax
+  108237:	03 45 10             	add    0x10(%ebp),%eax
+  10823a:	89 c3                	mov    %eax,%ebx
+  10823c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  10823f:	8b 40 08             	mov    0x8(%eax),%eax
+  108242:	89 43 08             	mov    %eax,0x8(%ebx)
+	frames[n].ei_fn_namelen = info->eip_fn_namelen;
+  108245:	8b 45 0c             	mov    0xc(%ebp),%eax
+  108248:	8b 40 0c             	mov    0xc(%eax),%eax
+  10824b:	89 43 0c             	mov    %eax,0xc(%ebx)
+	if (n > 0) {
+  10824e:	85 ff                	test   %edi,%edi
+  108250:	7f 21                	jg     108273 <debuginfo_eip_inline+0x228>
+		frames[n].ei_file = inline_file(&addrs, offset,
+						chain[n - 1].in_call_file, n);
+		frames[n].ei_line = chain[n - 1].in_call_line;
+	} else {
+		frames[n].ei_file = info->eip_file;
+  108252:	8b 45 0c             	mov    0xc(%ebp),%eax
+  108255:	8b 00                	mov    (%eax),%eax
+  108257:	89 03                	mov    %eax,(%ebx)
+		frames[n].ei_line = info->eip_line;
+  108259:	8b 45 0c             	mov    0xc(%ebp),%eax
+  10825c:	8b 40 04             	mov    0x4(%eax),%eax
+		frames[n].ei_line = chain[n - 1].in_call_line;
+  10825f:	89 43 04             	mov    %eax,0x4(%ebx)
+	}
+	return n + 1;
+  108262:	8b 85 ac fd ff ff    	mov    -0x254(%ebp),%eax
+  108268:	83 c0 01             	add    $0x1,%eax
+}
+  10826b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  10826e:	5b                   	pop    %ebx
+  10826f:	5e                   	pop    %esi
+  108270:	5f                   	pop    %edi
+  108271:	5d                   	pop    %ebp
+  108272:	c3                   	ret
+						chain[n - 1].in_call_file, n);
+  108273:	8d 77 ff             	lea    -0x1(%edi),%esi
+	if (dwarf_inline_file(addrs, offset, index, inline_files[i],
+  108276:	c1 e7 06             	shl    $0x6,%edi
+  108279:	8d 87 20 e5 11 00    	lea    0x11e520(%edi),%eax
+  10827f:	83 ec 08             	sub    $0x8,%esp
+  108282:	6a 40                	push   $0x40
+  108284:	50                   	push   %eax
+						chain[n - 1].in_call_file, n);
+  108285:	6b c6 1c             	imul   $0x1c,%esi,%eax
+		frames[n].ei_file = inline_file(&addrs, offset,
+  108288:	0f b7 84 05 38 fe ff 	movzwl -0x1c8(%ebp,%eax,1),%eax
+  10828f:	ff 
+	if (dwarf_inline_file(addrs, offset, index, inline_files[i],
+  108290:	50                   	push   %eax
+  108291:	ff b5 bc fd ff ff    	push   -0x244(%ebp)
+  108297:	ff b5 b8 fd ff ff    	push   -0x248(%ebp)
+  10829d:	8d 85 c0 fd ff ff    	lea    -0x240(%ebp),%eax
+  1082a3:	50                   	push   %eax
+  1082a4:	e8 67 df ff ff       	call   106210 <dwarf_inline_file>
+  1082a9:	83 c4 20             	add    $0x20,%esp
+		return "<unknown>";
+  1082ac:	81 c7 20 e5 11 00    	add    $0x11e520,%edi
+  1082b2:	85 c0                	test   %eax,%eax
+  1082b4:	b8 d0 9b 10 00       	mov    $0x109bd0,%eax
+  1082b9:	0f 49 c7             	cmovns %edi,%eax
+		frames[n].ei_file = inline_file(&addrs, offset,
+  1082bc:	89 03                	mov    %eax,(%ebx)
+		frames[n].ei_line = chain[n - 1].in_call_line;
+  1082be:	6b f6 1c             	imul   $0x1c,%esi,%esi
+  1082c1:	8b 84 35 3c fe ff ff 	mov    -0x1c4(%ebp,%esi,1),%eax
+  1082c8:	eb 95                	jmp    10825f <debuginfo_eip_inline+0x214>
+
+001082ca <range_index>:
+
+// The index of the last of the ranges r[lo..n) that starts at or below
+// 'p', or lo - 1 if none does.
+static int
+range_index(const struct Dbgtab_range *r, int lo, int n, uintptr_t p)
+{
+  1082ca:	55                   	push   %ebp
+  1082cb:	89 e5                	mov    %esp,%ebp
+  1082cd:	57                   	push   %edi
+  1082ce:	56                   	push   %esi
+  1082cf:	53                   	push   %ebx
+  1082d0:	89 c3                	mov    %eax,%ebx
+  1082d2:	89 d6                	mov    %edx,%esi
+  1082d4:	8b 7d 08             	mov    0x8(%ebp),%edi
+	int hi = n, mid;
+
+	while (lo < hi) {
+  1082d7:	39 f1                	cmp    %esi,%ecx
+  1082d9:	7e 21                	jle    1082fc <range_index+0x32>
+		mid = (lo + hi) / 2;
+  1082db:	8d 04 31             	lea    (%ecx,%esi,1),%eax
+  1082de:	89 c2                	mov    %eax,%edx
+  1082e0:	c1 ea 1f             	shr    $0x1f,%edx
+  1082e3:	01 c2                	add    %eax,%edx
+  1082e5:	89 d0                	mov    %edx,%eax
+  1082e7:	d1 f8                	sar    %eax
+		if (r[mid].dr_start <= p)
+  1082e9:	83 e2 fe             	and    $0xfffffffe,%edx
+  1082ec:	01 c2                	add    %eax,%edx
+  1082ee:	3b 3c 93             	cmp    (%ebx,%edx,4),%edi
+  1082f1:	73 04                	jae    1082f7 <range_index+0x2d>
+		mid = (lo + hi) / 2;
+  1082f3:	89 c1                	mov    %eax,%ecx
+  1082f5:	eb e0                	jmp    1082d7 <range_index+0xd>
+			lo = mid + 1;
+  1082f7:	8d 70 01             	lea    0x1(%eax),%esi
+  1082fa:	eb db                	jmp    1082d7 <range_index+0xd>
+		else
+			hi = mid;
+	}
+	return lo - 1;
+  1082fc:	8d 46 ff             	lea    -0x1(%esi),%eax
+}
+  1082ff:	5b                   	pop    %ebx
+  108300:	5e                   	pop    %esi
+  108301:	5f                   	pop    %edi
+  108302:	5d                   	pop    %ebp
+  108303:	c3                   	ret
+
+00108304 <debuginfo_from>:
+};
+
+static int
+debuginfo_from(uintptr_t addr, struct Eipdebuginfo *info,
+	       struct Dbgtab_pos *pos)
+{
+  108304:	55                   	push   %ebp
+  108305:	89 e5                	mov    %esp,%ebp
+  108307:	57                   	push   %edi
+  108308:	56                   	push   %esi
+  108309:	53                   	push   %ebx
+  10830a:	83 ec 58             	sub    $0x58,%esp
+  10830d:	89 c3                	mov    %eax,%ebx
+  10830f:	89 45 b4             	mov    %eax,-0x4c(%ebp)
+  108312:	89 55 bc             	mov    %edx,-0x44(%ebp)
+  108315:	89 ce                	mov    %ecx,%esi
+	uintptr_t row_addr;
+	int i;
+
+	i = range_index(units, pos->dp_unit, dbgtab->dt_nunits, addr);
+  108317:	8b 3d bc 0d 12 00    	mov    0x120dbc,%edi
+  10831d:	8b 0d b8 0d 12 00    	mov    0x120db8,%ecx
+  108323:	89 c8                	mov    %ecx,%eax
+  108325:	8b 4f 04             	mov    0x4(%edi),%ecx
+  108328:	8b 16                	mov    (%esi),%edx
+  10832a:	53                   	push   %ebx
+  10832b:	89 45 b8             	mov    %eax,-0x48(%ebp)
+  10832e:	e8 97 ff ff ff       	call   1082ca <range_index>
+  108333:	83 c4 10             	add    $0x10,%esp
+	pos->dp_unit = MAX(i, 0);
+  108336:	85 c0                	test   %eax,%eax
+  108338:	ba 00 00 00 00       	mov    $0x0,%edx
+  10833d:	0f 49 d0             	cmovns %eax,%edx
+  108340:	89 16                	mov    %edx,(%esi)
+	if (i < 0 || addr > units[i].dr_end)
+  108342:	0f 88 6d 02 00 00    	js     1085b5 <debuginfo_from+0x2b1>
+  108348:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  10834b:	8b 4d b8             	mov    -0x48(%ebp),%ecx
+  10834e:	8d 04 81             	lea    (%ecx,%eax,4),%eax
+  108351:	39 58 04             	cmp    %ebx,0x4(%eax)
+  108354:	0f 82 65 02 00 00    	jb     1085bf <debuginfo_from+0x2bb>
+		return -E_BAD_DWARF;
+	info->eip_file = strings + units[i].dr_name;
+  10835a:	8b 0d a4 0d 12 00    	mov    0x120da4,%ecx
+  108360:	89 4d b0             	mov    %ecx,-0x50(%ebp)
+  108363:	03 48 08             	add    0x8(%eax),%ecx
+  108366:	89 c8                	mov    %ecx,%eax
+  108368:	8b 4d bc             	mov    -0x44(%ebp),%ecx
+  10836b:	89 01                	mov    %eax,(%ecx)
+
+	// The line of the `call` instruction, which is 5 bytes long.  The
+	// DWARF lookup only has the rows of the unit of 'addr'.
+	i = anchor_index(pos->dp_anchor, addr - 5);
+  10836d:	8d 43 fb             	lea    -0x5(%ebx),%eax
+  108370:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  108373:	8b 4e 08             	mov    0x8(%esi),%ecx
+	hi = ROUNDUP(dbgtab->dt_nrows, DBGTAB_STRIDE) / DBGTAB_STRIDE;
+  108376:	8b 47 10             	mov    0x10(%edi),%eax
+  108379:	8d 50 0f             	lea    0xf(%eax),%edx
+  10837c:	c1 ea 04             	shr    $0x4,%edx
+		if (anchors[mid].da_addr <= p)
+  10837f:	8b 1d ac 0d 12 00    	mov    0x120dac,%ebx
+  108385:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+  108388:	89 75 cc             	mov    %esi,-0x34(%ebp)
+	while (lo < hi) {
+  10838b:	39 ca                	cmp    %ecx,%edx
+  10838d:	7e 24                	jle    1083b3 <debuginfo_from+0xaf>
+		mid = (lo + hi) / 2;
+  10838f:	8d 04 0a             	lea    (%edx,%ecx,1),%eax
+  108392:	89 c7                	mov    %eax,%edi
+  108394:	c1 ef 1f             	shr    $0x1f,%edi
+  108397:	01 f8                	add    %edi,%eax
+  108399:	89 c7                	mov    %eax,%edi
+  10839b:	d1 ff                	sar    %edi
+		if (anchors[mid].da_addr <= p)
+  10839d:	83 e0 fe             	and    $0xfffffffe,%eax
+  1083a0:	01 f8                	add    %edi,%eax
+  1083a2:	8b 75 d0             	mov    -0x30(%ebp),%esi
+  1083a5:	3b 34 83             	cmp    (%ebx,%eax,4),%esi
+  1083a8:	73 04                	jae    1083ae <debuginfo_from+0xaa>
+		mid = (lo + hi) / 2;
+  1083aa:	89 fa                	mov    %edi,%edx
+  1083ac:	eb dd                	jmp    10838b <debuginfo_from+0x87>
+			lo = mid + 1;
+  1083ae:	8d 4f 01             	lea    0x1(%edi),%ecx
+  1083b1:	eb d8                	jmp    10838b <debuginfo_from+0x87>
+	return lo - 1;
+  1083b3:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  1083b6:	8b 75 cc             	mov    -0x34(%ebp),%esi
+  1083b9:	8d 41 ff             	lea    -0x1(%ecx),%eax
+	pos->dp_anchor = MAX(i, 0);
+  1083bc:	85 c0                	test   %eax,%eax
+  1083be:	ba 00 00 00 00       	mov    $0x0,%edx
+  1083c3:	0f 49 d0             	cmovns %eax,%edx
+  1083c6:	89 56 08             	mov    %edx,0x8(%esi)
+	if (i >= 0) {
+  1083c9:	79 4c                	jns    108417 <debuginfo_from+0x113>
+		    || units[i].dr_name != units[pos->dp_unit].dr_name)
+			info->eip_line = 0;
+	}
+
+	// Like function_by_info, finding no function is no error.
+	i = range_index(funcs, pos->dp_func, dbgtab->dt_nfuncs, addr);
+  1083cb:	8b 1d b4 0d 12 00    	mov    0x120db4,%ebx
+  1083d1:	8b 4f 08             	mov    0x8(%edi),%ecx
+  1083d4:	8b 56 04             	mov    0x4(%esi),%edx
+  1083d7:	83 ec 0c             	sub    $0xc,%esp
+  1083da:	8b 7d b4             	mov    -0x4c(%ebp),%edi
+  1083dd:	57                   	push   %edi
+  1083de:	89 d8                	mov    %ebx,%eax
+  1083e0:	e8 e5 fe ff ff       	call   1082ca <range_index>
+  1083e5:	83 c4 10             	add    $0x10,%esp
+	pos->dp_func = MAX(i, 0);
+  1083e8:	85 c0                	test   %eax,%eax
+  1083ea:	ba 00 00 00 00       	mov    $0x0,%edx
+  1083ef:	0f 49 d0             	cmovns %eax,%edx
+  1083f2:	89 56 04             	mov    %edx,0x4(%esi)
+	if (i < 0 || addr > funcs[i].dr_end)
+		return 0;
+  1083f5:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (i < 0 || addr > funcs[i].dr_end)
+  1083fa:	78 11                	js     10840d <debuginfo_from+0x109>
+  1083fc:	8d 34 40             	lea    (%eax,%eax,2),%esi
+  1083ff:	c1 e6 02             	shl    $0x2,%esi
+  108402:	01 f3                	add    %esi,%ebx
+  108404:	39 7b 04             	cmp    %edi,0x4(%ebx)
+  108407:	0f 83 64 01 00 00    	jae    108571 <debuginfo_from+0x26d>
+	info->eip_fn_name = table_string(funcs[i].dr_name,
+					 &info->eip_fn_namelen);
+	info->eip_fn_addr = funcs[i].dr_start;
+	return 0;
+}
+  10840d:	89 d0                	mov    %edx,%eax
+  10840f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  108412:	5b                   	pop    %ebx
+  108413:	5e                   	pop    %esi
+  108414:	5f                   	pop    %edi
+  108415:	5d                   	pop    %ebp
+  108416:	c3                   	ret
+	const struct Dbgtab_anchor *da = &anchors[a];
+  108417:	8d 14 40             	lea    (%eax,%eax,2),%edx
+  10841a:	8d 14 93             	lea    (%ebx,%edx,4),%edx
+	const char *deltas = rows + da->da_rows;
+  10841d:	8b 4a 08             	mov    0x8(%edx),%ecx
+  108420:	03 0d a8 0d 12 00    	add    0x120da8,%ecx
+  108426:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+	int line_incr, line = da->da_line, row, end;
+  108429:	8b 4a 04             	mov    0x4(%edx),%ecx
+  10842c:	89 4d c0             	mov    %ecx,-0x40(%ebp)
+	uintptr_t address = da->da_addr;
+  10842f:	8b 0a                	mov    (%edx),%ecx
+  108431:	89 4d cc             	mov    %ecx,-0x34(%ebp)
+	row = a * DBGTAB_STRIDE + 1;
+  108434:	c1 e0 04             	shl    $0x4,%eax
+  108437:	8d 58 01             	lea    0x1(%eax),%ebx
+  10843a:	89 5d c8             	mov    %ebx,-0x38(%ebp)
+	end = MIN(row - 1 + DBGTAB_STRIDE, (int) dbgtab->dt_nrows);
+  10843d:	83 c0 10             	add    $0x10,%eax
+  108440:	8b 57 10             	mov    0x10(%edi),%edx
+  108443:	39 d0                	cmp    %edx,%eax
+  108445:	0f 4e d0             	cmovle %eax,%edx
+  108448:	89 55 c4             	mov    %edx,-0x3c(%ebp)
+	for (; row < end; row++) {
+  10844b:	89 7d ac             	mov    %edi,-0x54(%ebp)
+  10844e:	89 75 a8             	mov    %esi,-0x58(%ebp)
+  108451:	eb 1d                	jmp    108470 <debuginfo_from+0x16c>
+		deltas += dwarf_read_leb128(deltas, &line_incr);
+  108453:	01 d8                	add    %ebx,%eax
+  108455:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+		if (address + address_incr > p)
+  108458:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  10845b:	01 c2                	add    %eax,%edx
+  10845d:	39 55 d0             	cmp    %edx,-0x30(%ebp)
+  108460:	0f 82 a3 00 00 00    	jb     108509 <debuginfo_from+0x205>
+		line += line_incr;
+  108466:	01 7d c0             	add    %edi,-0x40(%ebp)
+	for (; row < end; row++) {
+  108469:	83 45 c8 01          	addl   $0x1,-0x38(%ebp)
+		address += address_incr;
+  10846d:	89 55 cc             	mov    %edx,-0x34(%ebp)
+	for (; row < end; row++) {
+  108470:	8b 75 c8             	mov    -0x38(%ebp),%esi
+  108473:	39 75 c4             	cmp    %esi,-0x3c(%ebp)
+  108476:	0f 8e 8d 00 00 00    	jle    108509 <debuginfo_from+0x205>
+	count = 0;
+  10847c:	b8 00 00 00 00       	mov    $0x0,%eax
+	result = 0;
+  108481:	ba 00 00 00 00       	mov    $0x0,%edx
+  108486:	89 d6                	mov    %edx,%esi
+  108488:	89 c7                	mov    %eax,%edi
+		byte = *addr;
+  10848a:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+  10848d:	0f b6 14 01          	movzbl (%ecx,%eax,1),%edx
+		count++;
+  108491:	83 c0 01             	add    $0x1,%eax
+		result |= (byte & 0x7f) << shift;
+  108494:	89 d3                	mov    %edx,%ebx
+  108496:	83 e3 7f             	and    $0x7f,%ebx
+  108499:	8d 0c fd 00 00 00 00 	lea    0x0(,%edi,8),%ecx
+  1084a0:	29 f9                	sub    %edi,%ecx
+  1084a2:	d3 e3                	shl    %cl,%ebx
+  1084a4:	09 de                	or     %ebx,%esi
+		if (!(byte & 0x80))
+  1084a6:	84 d2                	test   %dl,%dl
+  1084a8:	78 de                	js     108488 <debuginfo_from+0x184>
+		deltas += dwarf_read_uleb128(deltas, &address_incr);
+  1084aa:	89 f2                	mov    %esi,%edx
+  1084ac:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+  1084af:	01 c6                	add    %eax,%esi
+	count = 0;
+  1084b1:	bb 00 00 00 00       	mov    $0x0,%ebx
+	shift = 0;
+  1084b6:	b9 00 00 00 00       	mov    $0x0,%ecx
+	result = 0;
+  1084bb:	bf 00 00 00 00       	mov    $0x0,%edi
+  1084c0:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+		byte = *addr;
+  1084c3:	0f b6 04 1e          	movzbl (%esi,%ebx,1),%eax
+		result |= (byte & 0x7f) << shift;
+  1084c7:	89 c2                	mov    %eax,%edx
+  1084c9:	83 e2 7f             	and    $0x7f,%edx
+  1084cc:	d3 e2                	shl    %cl,%edx
+  1084ce:	09 d7                	or     %edx,%edi
+		shift += 7;
+  1084d0:	83 c1 07             	add    $0x7,%ecx
+		count++;
+  1084d3:	83 c3 01             	add    $0x1,%ebx
+		if (!(byte & 0x80))
+  1084d6:	84 c0                	test   %al,%al
+  1084d8:	78 e9                	js     1084c3 <debuginfo_from+0x1bf>
+	if ((shift < num_bits) && (byte & 0x40))
+  1084da:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+  1084dd:	88 45 d4             	mov    %al,-0x2c(%ebp)
+  1084e0:	89 f0                	mov    %esi,%eax
+  1084e2:	0f b6 75 d4          	movzbl -0x2c(%ebp),%esi
+  1084e6:	83 f9 1f             	cmp    $0x1f,%ecx
+  1084e9:	0f 8f 64 ff ff ff    	jg     108453 <debuginfo_from+0x14f>
+  1084ef:	f7 c6 40 00 00 00    	test   $0x40,%esi
+  1084f5:	0f 84 58 ff ff ff    	je     108453 <debuginfo_from+0x14f>
+		result |= (-1U << shift);
+  1084fb:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  108500:	d3 e6                	shl    %cl,%esi
+  108502:	09 f7                	or     %esi,%edi
+  108504:	e9 4a ff ff ff       	jmp    108453 <debuginfo_from+0x14f>
+		info->eip_line = line_decode(i, addr - 5, &row_addr);
+  108509:	8b 7d ac             	mov    -0x54(%ebp),%edi
+  10850c:	8b 75 a8             	mov    -0x58(%ebp),%esi
+  10850f:	8b 45 bc             	mov    -0x44(%ebp),%eax
+  108512:	8b 4d c0             	mov    -0x40(%ebp),%ecx
+  108515:	89 48 04             	mov    %ecx,0x4(%eax)
+		i = range_index(units, pos->dp_row_unit, dbgtab->dt_nunits,
+  108518:	8b 4f 04             	mov    0x4(%edi),%ecx
+  10851b:	8b 56 0c             	mov    0xc(%esi),%edx
+  10851e:	83 ec 0c             	sub    $0xc,%esp
+  108521:	ff 75 cc             	push   -0x34(%ebp)
+  108524:	8b 5d b8             	mov    -0x48(%ebp),%ebx
+  108527:	89 d8                	mov    %ebx,%eax
+  108529:	e8 9c fd ff ff       	call   1082ca <range_index>
+  10852e:	83 c4 10             	add    $0x10,%esp
+		pos->dp_row_unit = MAX(i, 0);
+  108531:	85 c0                	test   %eax,%eax
+  108533:	ba 00 00 00 00       	mov    $0x0,%edx
+  108538:	0f 49 d0             	cmovns %eax,%edx
+  10853b:	89 56 0c             	mov    %edx,0xc(%esi)
+		if (i < 0 || row_addr > units[i].dr_end
+  10853e:	78 22                	js     108562 <debuginfo_from+0x25e>
+  108540:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  108543:	89 d9                	mov    %ebx,%ecx
+  108545:	8d 04 83             	lea    (%ebx,%eax,4),%eax
+  108548:	8b 5d cc             	mov    -0x34(%ebp),%ebx
+  10854b:	39 58 04             	cmp    %ebx,0x4(%eax)
+  10854e:	72 12                	jb     108562 <debuginfo_from+0x25e>
+		    || units[i].dr_name != units[pos->dp_unit].dr_name)
+  108550:	8b 16                	mov    (%esi),%edx
+  108552:	8d 14 52             	lea    (%edx,%edx,2),%edx
+  108555:	8b 5c 91 08          	mov    0x8(%ecx,%edx,4),%ebx
+  108559:	39 58 08             	cmp    %ebx,0x8(%eax)
+  10855c:	0f 84 69 fe ff ff    	je     1083cb <debuginfo_from+0xc7>
+			info->eip_line = 0;
+  108562:	8b 45 bc             	mov    -0x44(%ebp),%eax
+  108565:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+  10856c:	e9 5a fe ff ff       	jmp    1083cb <debuginfo_from+0xc7>
+	info->eip_fn_name = table_string(funcs[i].dr_name,
+  108571:	8b 5b 08             	mov    0x8(%ebx),%ebx
+	*len = get_unaligned(strings + offset - 2, uint16_t);
+  108574:	83 ec 04             	sub    $0x4,%esp
+  108577:	6a 02                	push   $0x2
+  108579:	8b 45 b0             	mov    -0x50(%ebp),%eax
+  10857c:	8d 44 18 fe          	lea    -0x2(%eax,%ebx,1),%eax
+  108580:	50                   	push   %eax
+  108581:	8d 45 e6             	lea    -0x1a(%ebp),%eax
+  108584:	50                   	push   %eax
+  108585:	e8 6e 0c 00 00       	call   1091f8 <memcpy>
+  10858a:	0f b7 45 e6          	movzwl -0x1a(%ebp),%eax
+  10858e:	8b 7d bc             	mov    -0x44(%ebp),%edi
+  108591:	89 47 0c             	mov    %eax,0xc(%edi)
+	return strings + offset;
+  108594:	03 1d a4 0d 12 00    	add    0x120da4,%ebx
+	info->eip_fn_name = table_string(funcs[i].dr_name,
+  10859a:	89 5f 08             	mov    %ebx,0x8(%edi)
+	info->eip_fn_addr = funcs[i].dr_start;
+  10859d:	a1 b4 0d 12 00       	mov    0x120db4,%eax
+  1085a2:	8b 04 30             	mov    (%eax,%esi,1),%eax
+  1085a5:	89 47 10             	mov    %eax,0x10(%edi)
+	return 0;
+  1085a8:	83 c4 10             	add    $0x10,%esp
+  1085ab:	ba 00 00 00 00       	mov    $0x0,%edx
+  1085b0:	e9 58 fe ff ff       	jmp    10840d <debuginfo_from+0x109>
+		return -E_BAD_DWARF;
+  1085b5:	ba fa ff ff ff       	mov    $0xfffffffa,%edx
+  1085ba:	e9 4e fe ff ff       	jmp    10840d <debuginfo_from+0x109>
+  1085bf:	ba fa ff ff ff       	mov    $0xfffffffa,%edx
+  1085c4:	e9 44 fe ff ff       	jmp    10840d <debuginfo_from+0x109>
+
+001085c9 <dbgtab_present>:
+	if (dbgtab_checked)
+  1085c9:	0f b6 05 a0 0d 12 00 	movzbl 0x120da0,%eax
+  1085d0:	84 c0                	test   %al,%al
+  1085d2:	0f 85 b6 00 00 00    	jne    10868e <dbgtab_present+0xc5>
+	dbgtab_checked = 1;
+  1085d8:	c6 05 a0 0d 12 00 01 	movb   $0x1,0x120da0
+	if (__DBGTAB_END__ - __DBGTAB_BEGIN__ < sizeof(*dt)
+  1085df:	ba f0 42 11 00       	mov    $0x1142f0,%edx
+  1085e4:	81 ea d4 a7 10 00    	sub    $0x10a7d4,%edx
+  1085ea:	83 fa 1b             	cmp    $0x1b,%edx
+  1085ed:	0f 86 a6 00 00 00    	jbe    108699 <dbgtab_present+0xd0>
+	    || dt->dt_magic != DBGTAB_MAGIC)
+  1085f3:	81 3d d4 a7 10 00 44 	cmpl   $0x54474244,0x10a7d4
+  1085fa:	42 47 54 
+  1085fd:	0f 85 96 00 00 00    	jne    108699 <dbgtab_present+0xd0>
+{
+  108603:	55                   	push   %ebp
+  108604:	89 e5                	mov    %esp,%ebp
+  108606:	53                   	push   %ebx
+	nanchors = ROUNDUP(dt->dt_nrows, DBGTAB_STRIDE) / DBGTAB_STRIDE;
+  108607:	8b 1d e4 a7 10 00    	mov    0x10a7e4,%ebx
+  10860d:	8d 53 0f             	lea    0xf(%ebx),%edx
+  108610:	c1 ea 04             	shr    $0x4,%edx
+	units = (const struct Dbgtab_range *) (dt + 1);
+  108613:	c7 05 b8 0d 12 00 f0 	movl   $0x10a7f0,0x120db8
+  10861a:	a7 10 00 
+	funcs = units + dt->dt_nunits;
+  10861d:	8b 0d d8 a7 10 00    	mov    0x10a7d8,%ecx
+  108623:	8d 0c 49             	lea    (%ecx,%ecx,2),%ecx
+  108626:	8d 0c 8d f0 a7 10 00 	lea    0x10a7f0(,%ecx,4),%ecx
+  10862d:	89 0d b4 0d 12 00    	mov    %ecx,0x120db4
+	inlines = (const struct Dbgtab_inline *) (funcs + dt->dt_nfuncs);
+  108633:	8b 1d dc a7 10 00    	mov    0x10a7dc,%ebx
+  108639:	8d 1c 5b             	lea    (%ebx,%ebx,2),%ebx
+  10863c:	8d 0c 99             	lea    (%ecx,%ebx,4),%ecx
+  10863f:	89 0d b0 0d 12 00    	mov    %ecx,0x120db0
+	anchors = (const struct Dbgtab_anchor *) (inlines + dt->dt_ninlines);
+  108645:	6b 1d e0 a7 10 00 1c 	imul   $0x1c,0x10a7e0,%ebx
+  10864c:	01 d9                	add    %ebx,%ecx
+  10864e:	89 0d ac 0d 12 00    	mov    %ecx,0x120dac
+	rows = (const char *) (anchors + nanchors);
+  108654:	8d 14 52             	lea    (%edx,%edx,2),%edx
+  108657:	8d 14 91             	lea    (%ecx,%edx,4),%edx
+  10865a:	89 15 a8 0d 12 00    	mov    %edx,0x120da8
+	strings = rows + dt->dt_rows_size;
+  108660:	03 15 e8 a7 10 00    	add    0x10a7e8,%edx
+  108666:	89 15 a4 0d 12 00    	mov    %edx,0x120da4
+	if (strings + dt->dt_strings_size > __DBGTAB_END__)
+  10866c:	03 15 ec a7 10 00    	add    0x10a7ec,%edx
+  108672:	81 fa f0 42 11 00    	cmp    $0x1142f0,%edx
+  108678:	77 0f                	ja     108689 <dbgtab_present+0xc0>
+	dbgtab = dt;
+  10867a:	c7 05 bc 0d 12 00 d4 	movl   $0x10a7d4,0x120dbc
+  108681:	a7 10 00 
+	return 1;
+  108684:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  108689:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  10868c:	c9                   	leave
+  10868d:	c3                   	ret
+		return dbgtab != NULL;
+  10868e:	83 3d bc 0d 12 00 00 	cmpl   $0x0,0x120dbc
+  108695:	0f 95 c0             	setne  %al
+  108698:	c3                   	ret
+}
+  108699:	c3                   	ret
+
+0010869a <dbgtab_debuginfo>:
+// would from the DWARF sections; 'info' must have been initialized.
+// Returns -E_BAD_DWARF if the table has no unit at 'addr'.  Only call
+// this if dbgtab_present().
+int
+dbgtab_debuginfo(uintptr_t addr, struct Eipdebuginfo *info)
+{
+  10869a:	55                   	push   %ebp
+  10869b:	89 e5                	mov    %esp,%ebp
+  10869d:	83 ec 18             	sub    $0x18,%esp
+	struct Dbgtab_pos pos = { 0, 0, 0, 0 };
+  1086a0:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+  1086a7:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  1086ae:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  1086b5:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	return debuginfo_from(addr, info, &pos);
+  1086bc:	8d 4d e8             	lea    -0x18(%ebp),%ecx
+  1086bf:	8b 55 0c             	mov    0xc(%ebp),%edx
+  1086c2:	8b 45 08             	mov    0x8(%ebp),%eax
+  1086c5:	e8 3a fc ff ff       	call   108304 <debuginfo_from>
+}
+  1086ca:	c9                   	leave
+  1086cb:	c3                   	ret
+
+001086cc <dbgtab_debuginfo_batch>:
+// starts where the one before left off, so the batch is one pass forward
+// over the table.
+void
+dbgtab_debuginfo_batch(const uintptr_t *eips, const int *order, int n,
+		       struct Eipdebuginfo *out, int *codes)
+{
+  1086cc:	55                   	push   %ebp
+  1086cd:	89 e5                	mov    %esp,%ebp
+  1086cf:	57                   	push   %edi
+  1086d0:	56                   	push   %esi
+  1086d1:	53                   	push   %ebx
+  1086d2:	83 ec 1c             	sub    $0x1c,%esp
+  1086d5:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  1086d8:	8b 75 10             	mov    0x10(%ebp),%esi
+	struct Dbgtab_pos pos = { 0, 0, 0, 0 };
+  1086db:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+  1086e2:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%ebp)
+  1086e9:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%ebp)
+  1086f0:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	int i;
+
+	for (i = 0; i < n; i++)
+  1086f7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  1086fc:	eb 23                	jmp    108721 <dbgtab_debuginfo_batch+0x55>
+		codes[i] = debuginfo_from(eips[order[i]],
+						 &out[order[i]], &pos);
+  1086fe:	8b 04 9f             	mov    (%edi,%ebx,4),%eax
+  108701:	8d 14 40             	lea    (%eax,%eax,2),%edx
+		codes[i] = debuginfo_from(eips[order[i]],
+  108704:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  108707:	8d 14 d1             	lea    (%ecx,%edx,8),%edx
+  10870a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  10870d:	8b 04 81             	mov    (%ecx,%eax,4),%eax
+  108710:	8d 4d d8             	lea    -0x28(%ebp),%ecx
+  108713:	e8 ec fb ff ff       	call   108304 <debuginfo_from>
+  108718:	8b 55 18             	mov    0x18(%ebp),%edx
+  10871b:	89 04 9a             	mov    %eax,(%edx,%ebx,4)
+	for (i = 0; i < n; i++)
+  10871e:	83 c3 01             	add    $0x1,%ebx
+  108721:	39 f3                	cmp    %esi,%ebx
+  108723:	7c d9                	jl     1086fe <dbgtab_debuginfo_batch+0x32>
+}
+  108725:	83 c4 1c             	add    $0x1c,%esp
+  108728:	5b                   	pop    %ebx
+  108729:	5e                   	pop    %esi
+  10872a:	5f                   	pop    %edi
+  10872b:	5d                   	pop    %ebp
+  10872c:	c3                   	ret
+
+0010872d <dbgtab_debuginfo_inline>:
+// at 'addr' from the debug table, as debuginfo_eip_inline() does from the
+// DWARF sections.  Only call this if dbgtab_present().
+int
+dbgtab_debuginfo_inline(uintptr_t addr, const struct Eipdebuginfo *info,
+			struct Eipinline *frames, int nframes)
+{
+  10872d:	55                   	push   %ebp
+  10872e:	89 e5                	mov    %esp,%ebp
+  108730:	57                   	push   %edi
+  108731:	56                   	push   %esi
+  108732:	53                   	push   %ebx
+  108733:	83 ec 2c             	sub    $0x2c,%esp
+	const struct Dbgtab_inline *in, *prev = NULL;
+	uintptr_t p = addr - 5;
+	int lo = 0, hi = dbgtab->dt_ninlines, mid, i, n = 0;
+
+	if (nframes <= 0)
+		return 0;
+  108736:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (nframes <= 0)
+  10873b:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+  10873f:	0f 8e 1e 01 00 00    	jle    108863 <dbgtab_debuginfo_inline+0x136>
+	uintptr_t p = addr - 5;
+  108745:	8b 45 08             	mov    0x8(%ebp),%eax
+  108748:	8d 50 fb             	lea    -0x5(%eax),%edx
+	int lo = 0, hi = dbgtab->dt_ninlines, mid, i, n = 0;
+  10874b:	a1 bc 0d 12 00       	mov    0x120dbc,%eax
+  108750:	8b 70 0c             	mov    0xc(%eax),%esi
+	// Find the last piece that starts at or below p; the innermost piece
+	// containing p is on its chain.
+	while (lo < hi) {
+		mid = (lo + hi) / 2;
+		if (inlines[mid].di_start <= p)
+  108753:	8b 0d b0 0d 12 00    	mov    0x120db0,%ecx
+	int lo = 0, hi = dbgtab->dt_ninlines, mid, i, n = 0;
+  108759:	bb 00 00 00 00       	mov    $0x0,%ebx
+	while (lo < hi) {
+  10875e:	39 de                	cmp    %ebx,%esi
+  108760:	7e 1d                	jle    10877f <dbgtab_debuginfo_inline+0x52>
+		mid = (lo + hi) / 2;
+  108762:	8d 3c 1e             	lea    (%esi,%ebx,1),%edi
+  108765:	89 f8                	mov    %edi,%eax
+  108767:	c1 e8 1f             	shr    $0x1f,%eax
+  10876a:	01 f8                	add    %edi,%eax
+  10876c:	d1 f8                	sar    %eax
+		if (inlines[mid].di_start <= p)
+  10876e:	6b f8 1c             	imul   $0x1c,%eax,%edi
+  108771:	3b 14 39             	cmp    (%ecx,%edi,1),%edx
+  108774:	73 04                	jae    10877a <dbgtab_debuginfo_inline+0x4d>
+		mid = (lo + hi) / 2;
+  108776:	89 c6                	mov    %eax,%esi
+  108778:	eb e4                	jmp    10875e <dbgtab_debuginfo_inline+0x31>
+			lo = mid + 1;
+  10877a:	8d 58 01             	lea    0x1(%eax),%ebx
+  10877d:	eb df                	jmp    10875e <dbgtab_debuginfo_inline+0x31>
+		else
+			hi = mid;
+	}
+	for (i = lo - 1; i >= 0 && p >= inlines[i].di_end;
+  10877f:	8d 43 ff             	lea    -0x1(%ebx),%eax
+  108782:	eb 03                	jmp    108787 <dbgtab_debuginfo_inline+0x5a>
+	     i = inlines[i].di_parent)
+  108784:	8b 43 18             	mov    0x18(%ebx),%eax
+	for (i = lo - 1; i >= 0 && p >= inlines[i].di_end;
+  108787:	85 c0                	test   %eax,%eax
+  108789:	78 0a                	js     108795 <dbgtab_debuginfo_inline+0x68>
+  10878b:	6b d8 1c             	imul   $0x1c,%eax,%ebx
+  10878e:	01 cb                	add    %ecx,%ebx
+  108790:	3b 53 04             	cmp    0x4(%ebx),%edx
+  108793:	73 ef                	jae    108784 <dbgtab_debuginfo_inline+0x57>
+  108795:	8b 75 10             	mov    0x10(%ebp),%esi
+  108798:	8b 55 14             	mov    0x14(%ebp),%edx
+  10879b:	83 ea 01             	sub    $0x1,%edx
+  10879e:	89 55 cc             	mov    %edx,-0x34(%ebp)
+		mid = (lo + hi) / 2;
+  1087a1:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%ebp)
+  1087a8:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+  1087af:	eb 1b                	jmp    1087cc <dbgtab_debuginfo_inline+0x9f>
+						    &frames[n].ei_fn_namelen);
+		if (!prev) {
+			frames[n].ei_file = strings + in->di_decl_file;
+			frames[n].ei_line = info->eip_line;
+		} else {
+			frames[n].ei_file = strings + prev->di_call_file;
+  1087b1:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+  1087b4:	03 41 10             	add    0x10(%ecx),%eax
+  1087b7:	89 06                	mov    %eax,(%esi)
+			frames[n].ei_line = prev->di_call_line;
+  1087b9:	8b 41 14             	mov    0x14(%ecx),%eax
+			frames[n].ei_line = info->eip_line;
+  1087bc:	89 42 04             	mov    %eax,0x4(%edx)
+	for (; i >= 0 && n < nframes - 1; i = in->di_parent, n++) {
+  1087bf:	8b 47 18             	mov    0x18(%edi),%eax
+  1087c2:	83 45 d0 01          	addl   $0x1,-0x30(%ebp)
+  1087c6:	83 c6 10             	add    $0x10,%esi
+		}
+		prev = in;
+  1087c9:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+	for (; i >= 0 && n < nframes - 1; i = in->di_parent, n++) {
+  1087cc:	85 c0                	test   %eax,%eax
+  1087ce:	78 5a                	js     10882a <dbgtab_debuginfo_inline+0xfd>
+  1087d0:	8b 55 cc             	mov    -0x34(%ebp),%edx
+  1087d3:	39 55 d0             	cmp    %edx,-0x30(%ebp)
+  1087d6:	74 4f                	je     108827 <dbgtab_debuginfo_inline+0xfa>
+		in = &inlines[i];
+  1087d8:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  1087db:	03 05 b0 0d 12 00    	add    0x120db0,%eax
+  1087e1:	89 c7                	mov    %eax,%edi
+		frames[n].ei_fn_name = table_string(in->di_name,
+  1087e3:	8b 58 08             	mov    0x8(%eax),%ebx
+	*len = get_unaligned(strings + offset - 2, uint16_t);
+  1087e6:	83 ec 04             	sub    $0x4,%esp
+  1087e9:	6a 02                	push   $0x2
+  1087eb:	a1 a4 0d 12 00       	mov    0x120da4,%eax
+  1087f0:	8d 44 18 fe          	lea    -0x2(%eax,%ebx,1),%eax
+  1087f4:	50                   	push   %eax
+  1087f5:	8d 45 e6             	lea    -0x1a(%ebp),%eax
+  1087f8:	50                   	push   %eax
+  1087f9:	e8 fa 09 00 00       	call   1091f8 <memcpy>
+  1087fe:	89 f2                	mov    %esi,%edx
+  108800:	0f b7 45 e6          	movzwl -0x1a(%ebp),%eax
+  108804:	89 46 0c             	mov    %eax,0xc(%esi)
+	return strings + offset;
+  108807:	a1 a4 0d 12 00       	mov    0x120da4,%eax
+  10880c:	01 c3                	add    %eax,%ebx
+  10880e:	89 5e 08             	mov    %ebx,0x8(%esi)
+		if (!prev) {
+  108811:	83 c4 10             	add    $0x10,%esp
+  108814:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  108818:	75 97                	jne    1087b1 <dbgtab_debuginfo_inline+0x84>
+			frames[n].ei_file = strings + in->di_decl_file;
+  10881a:	03 47 0c             	add    0xc(%edi),%eax
+  10881d:	89 06                	mov    %eax,(%esi)
+			frames[n].ei_line = info->eip_line;
+  10881f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  108822:	8b 40 04             	mov    0x4(%eax),%eax
+  108825:	eb 95                	jmp    1087bc <dbgtab_debuginfo_inline+0x8f>
+  108827:	89 55 d0             	mov    %edx,-0x30(%ebp)
+	}
+	frames[n].ei_fn_name = info->eip_fn_name;
+  10882a:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  10882d:	c1 e0 04             	shl    $0x4,%eax
+  108830:	03 45 10             	add    0x10(%ebp),%eax
+  108833:	8b 55 0c             	mov    0xc(%ebp),%edx
+  108836:	8b 52 08             	mov    0x8(%edx),%edx
+  108839:	89 50 08             	mov    %edx,0x8(%eax)
+	frames[n].ei_fn_namelen = info->eip_fn_namelen;
+  10883c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  10883f:	8b 52 0c             	mov    0xc(%edx),%edx
+  108842:	89 50 0c             	mov    %edx,0xc(%eax)
+	if (prev) {
+  108845:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+  108848:	85 f6                	test   %esi,%esi
+  10884a:	74 1f                	je     10886b <dbgtab_debuginfo_inline+0x13e>
+		frames[n].ei_file = strings + prev->di_call_file;
+  10884c:	8b 56 10             	mov    0x10(%esi),%edx
+  10884f:	03 15 a4 0d 12 00    	add    0x120da4,%edx
+  108855:	89 10                	mov    %edx,(%eax)
+		frames[n].ei_line = prev->di_call_line;
+  108857:	8b 56 14             	mov    0x14(%esi),%edx
+  10885a:	89 50 04             	mov    %edx,0x4(%eax)
+	} else {
+		frames[n].ei_file = info->eip_file;
+		frames[n].ei_line = info->eip_line;
+	}
+	return n + 1;
+  10885d:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  108860:	83 c0 01             	add    $0x1,%eax
+}
+  108863:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  108866:	5b                   	pop    %ebx
+  108867:	5e                   	pop    %esi
+  108868:	5f                   	pop    %edi
+  108869:	5d                   	pop    %ebp
+  10886a:	c3                   	ret
+		frames[n].ei_file = info->eip_file;
+  10886b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  10886e:	8b 12                	mov    (%edx),%edx
+  108870:	89 10                	mov    %edx,(%eax)
+		frames[n].ei_line = info->eip_line;
+  108872:	8b 55 0c             	mov    0xc(%ebp),%edx
+  108875:	8b 52 04             	mov    0x4(%edx),%edx
+  108878:	eb e0                	jmp    10885a <dbgtab_debuginfo_inline+0x12d>
+
+0010887a <ksym_lookup>:
+//	'namebuf'.  Returns NULL if 'addr' isn't in the kernel's code, or
+//	the kernel has no symbol table.
+//
+const char *
+ksym_lookup(uintptr_t addr, char *namebuf, uintptr_t *offset)
+{
+  10887a:	55                   	push   %ebp
+  10887b:	89 e5                	mov    %esp,%ebp
+  10887d:	57                   	push   %edi
+  10887e:	56                   	push   %esi
+  10887f:	53                   	push   %ebx
+  108880:	83 ec 1c             	sub    $0x1c,%esp
+  108883:	8b 55 08             	mov    0x8(%ebp),%edx
+	const struct Ksyms *ks = (const struct Ksyms *) __KSYMS_BEGIN__;
+	const uint32_t *addrs, *markers;
+	const uint8_t *p;
+	int lo = 0, hi, mid, i;
+
+	if (__KSYMS_END__ - __KSYMS_BEGIN__ < sizeof(*ks)
+  108886:	b8 d2 4b 11 00       	mov    $0x114bd2,%eax
+  10888b:	2d f0 42 11 00       	sub    $0x1142f0,%eax
+  108890:	83 f8 0f             	cmp    $0xf,%eax
+  108893:	0f 86 db 00 00 00    	jbe    108974 <ksym_lookup+0xfa>
+	    || ks->ks_magic != KSYMS_MAGIC || addr >= (uintptr_t) etext)
+		return NULL;
+  108899:	b8 00 00 00 00       	mov    $0x0,%eax
+	    || ks->ks_magic != KSYMS_MAGIC || addr >= (uintptr_t) etext)
+  10889e:	81 3d f0 42 11 00 4b 	cmpl   $0x4d59534b,0x1142f0
+  1088a5:	53 59 4d 
+  1088a8:	0f 85 be 00 00 00    	jne    10896c <ksym_lookup+0xf2>
+  1088ae:	81 fa 72 94 10 00    	cmp    $0x109472,%edx
+  1088b4:	0f 83 c1 00 00 00    	jae    10897b <ksym_lookup+0x101>
+	addrs = (const uint32_t *) (ks + 1);
+	markers = addrs + ks->ks_nsyms;
+  1088ba:	8b 0d f4 42 11 00    	mov    0x1142f4,%ecx
+  1088c0:	8d 3c 8d 00 43 11 00 	lea    0x114300(,%ecx,4),%edi
+	int lo = 0, hi, mid, i;
+  1088c7:	be 00 00 00 00       	mov    $0x0,%esi
+
+	// Find the last symbol at or below addr.
+	hi = ks->ks_nsyms;
+	while (lo < hi) {
+  1088cc:	39 ce                	cmp    %ecx,%esi
+  1088ce:	7d 1e                	jge    1088ee <ksym_lookup+0x74>
+		mid = (lo + hi) / 2;
+  1088d0:	8d 1c 0e             	lea    (%esi,%ecx,1),%ebx
+  1088d3:	89 d8                	mov    %ebx,%eax
+  1088d5:	c1 e8 1f             	shr    $0x1f,%eax
+  1088d8:	01 d8                	add    %ebx,%eax
+  1088da:	d1 f8                	sar    %eax
+		if (addrs[mid] <= addr)
+  1088dc:	3b 14 85 00 43 11 00 	cmp    0x114300(,%eax,4),%edx
+  1088e3:	73 04                	jae    1088e9 <ksym_lookup+0x6f>
+		mid = (lo + hi) / 2;
+  1088e5:	89 c1                	mov    %eax,%ecx
+  1088e7:	eb e3                	jmp    1088cc <ksym_lookup+0x52>
+			lo = mid + 1;
+  1088e9:	8d 70 01             	lea    0x1(%eax),%esi
+  1088ec:	eb de                	jmp    1088cc <ksym_lookup+0x52>
+		else
+			hi = mid;
+	}
+	if (lo == 0)
+  1088ee:	85 f6                	test   %esi,%esi
+  1088f0:	0f 84 8c 00 00 00    	je     108982 <ksym_lookup+0x108>
+		return NULL;
+
+	// Decode the names from its marker up to it.
+	p = (const uint8_t *) (markers + ks->ks_nmarkers)
+		+ markers[(lo - 1) / KSYMS_STRIDE];
+  1088f6:	8d 46 0e             	lea    0xe(%esi),%eax
+  1088f9:	89 f1                	mov    %esi,%ecx
+  1088fb:	83 e9 01             	sub    $0x1,%ecx
+  1088fe:	0f 49 c1             	cmovns %ecx,%eax
+  108901:	c1 f8 04             	sar    $0x4,%eax
+  108904:	8b 0d f8 42 11 00    	mov    0x1142f8,%ecx
+  10890a:	8d 1c 8f             	lea    (%edi,%ecx,4),%ebx
+	p = (const uint8_t *) (markers + ks->ks_nmarkers)
+  10890d:	03 1c 87             	add    (%edi,%eax,4),%ebx
+	for (i = (lo - 1) / KSYMS_STRIDE * KSYMS_STRIDE; i < lo; i++) {
+  108910:	c1 e0 04             	shl    $0x4,%eax
+  108913:	89 c7                	mov    %eax,%edi
+  108915:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  108918:	89 55 08             	mov    %edx,0x8(%ebp)
+  10891b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  10891e:	eb 32                	jmp    108952 <ksym_lookup+0xd8>
+		memcpy(namebuf + p[0], p + 2, p[1]);
+  108920:	83 ec 04             	sub    $0x4,%esp
+  108923:	0f b6 43 01          	movzbl 0x1(%ebx),%eax
+  108927:	50                   	push   %eax
+  108928:	8d 43 02             	lea    0x2(%ebx),%eax
+  10892b:	50                   	push   %eax
+  10892c:	0f b6 03             	movzbl (%ebx),%eax
+  10892f:	01 f0                	add    %esi,%eax
+  108931:	50                   	push   %eax
+  108932:	e8 c1 08 00 00       	call   1091f8 <memcpy>
+		namebuf[p[0] + p[1]] = '\0';
+  108937:	0f b6 03             	movzbl (%ebx),%eax
+  10893a:	0f b6 53 01          	movzbl 0x1(%ebx),%edx
+  10893e:	01 f0                	add    %esi,%eax
+  108940:	c6 04 10 00          	movb   $0x0,(%eax,%edx,1)
+		p += 2 + p[1];
+  108944:	0f b6 43 01          	movzbl 0x1(%ebx),%eax
+  108948:	8d 5c 03 02          	lea    0x2(%ebx,%eax,1),%ebx
+	for (i = (lo - 1) / KSYMS_STRIDE * KSYMS_STRIDE; i < lo; i++) {
+  10894c:	83 c7 01             	add    $0x1,%edi
+  10894f:	83 c4 10             	add    $0x10,%esp
+  108952:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+  108955:	7f c9                	jg     108920 <ksym_lookup+0xa6>
+	}
+	*offset = addr - addrs[lo - 1];
+  108957:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  10895a:	8b 55 08             	mov    0x8(%ebp),%edx
+  10895d:	2b 14 b5 fc 42 11 00 	sub    0x1142fc(,%esi,4),%edx
+  108964:	8b 45 10             	mov    0x10(%ebp),%eax
+  108967:	89 10                	mov    %edx,(%eax)
+	return namebuf;
+  108969:	8b 45 0c             	mov    0xc(%ebp),%eax
+}
+  10896c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  10896f:	5b                   	pop    %ebx
+  108970:	5e                   	pop    %esi
+  108971:	5f                   	pop    %edi
+  108972:	5d                   	pop    %ebp
+  108973:	c3                   	ret
+		return NULL;
+  108974:	b8 00 00 00 00       	mov    $0x0,%eax
+  108979:	eb f1                	jmp    10896c <ksym_lookup+0xf2>
+  10897b:	b8 00 00 00 00       	mov    $0x0,%eax
+  108980:	eb ea                	jmp    10896c <ksym_lookup+0xf2>
+		return NULL;
+  108982:	b8 00 00 00 00       	mov    $0x0,%eax
+  108987:	eb e3                	jmp    10896c <ksym_lookup+0xf2>
+
+00108989 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  108989:	55                   	push   %ebp
+  10898a:	89 e5                	mov    %esp,%ebp
+  10898c:	57                   	push   %edi
+  10898d:	56                   	push   %esi
+  10898e:	53                   	push   %ebx
+  10898f:	83 ec 1c             	sub    $0x1c,%esp
+  108992:	89 c7                	mov    %eax,%edi
+  108994:	89 d6                	mov    %edx,%esi
+  108996:	8b 45 08             	mov    0x8(%ebp),%eax
+  108999:	8b 55 0c             	mov    0xc(%ebp),%edx
+  10899c:	89 d1                	mov    %edx,%ecx
+  10899e:	89 c2                	mov    %eax,%edx
+  1089a0:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  1089a3:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  1089a6:	8b 45 10             	mov    0x10(%ebp),%eax
+  1089a9:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  1089ac:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  1089af:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  1089b6:	39 c2                	cmp    %eax,%edx
+  1089b8:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  1089bb:	72 3e                	jb     1089fb <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  1089bd:	83 ec 0c             	sub    $0xc,%esp
+  1089c0:	ff 75 18             	push   0x18(%ebp)
+  1089c3:	83 eb 01             	sub    $0x1,%ebx
+  1089c6:	53                   	push   %ebx
+  1089c7:	50                   	push   %eax
+  1089c8:	83 ec 08             	sub    $0x8,%esp
+  1089cb:	ff 75 e4             	push   -0x1c(%ebp)
+  1089ce:	ff 75 e0             	push   -0x20(%ebp)
+  1089d1:	ff 75 dc             	push   -0x24(%ebp)
+  1089d4:	ff 75 d8             	push   -0x28(%ebp)
+  1089d7:	e8 4f 0a 00 00       	call   10942b <__udivdi3>
+  1089dc:	83 c4 18             	add    $0x18,%esp
+  1089df:	52                   	push   %edx
+  1089e0:	50                   	push   %eax
+  1089e1:	89 f2                	mov    %esi,%edx
+  1089e3:	89 f8                	mov    %edi,%eax
+  1089e5:	e8 9f ff ff ff       	call   108989 <printnum>
+  1089ea:	83 c4 20             	add    $0x20,%esp
+  1089ed:	eb 13                	jmp    108a02 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  1089ef:	83 ec 08             	sub    $0x8,%esp
+  1089f2:	56                   	push   %esi
+  1089f3:	ff 75 18             	push   0x18(%ebp)
+  1089f6:	ff d7                	call   *%edi
+  1089f8:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  1089fb:	83 eb 01             	sub    $0x1,%ebx
+  1089fe:	85 db                	test   %ebx,%ebx
+  108a00:	7f ed                	jg     1089ef <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  108a02:	83 ec 08             	sub    $0x8,%esp
+  108a05:	56                   	push   %esi
+  108a06:	83 ec 04             	sub    $0x4,%esp
+  108a09:	ff 75 e4             	push   -0x1c(%ebp)
+  108a0c:	ff 75 e0             	push   -0x20(%ebp)
+  108a0f:	ff 75 dc             	push   -0x24(%ebp)
+  108a12:	ff 75 d8             	push   -0x28(%ebp)
+  108a15:	e8 2f 0a 00 00       	call   109449 <__umoddi3>
+  108a1a:	83 c4 14             	add    $0x14,%esp
+  108a1d:	0f be 80 88 a5 10 00 	movsbl 0x10a588(%eax),%eax
+  108a24:	50                   	push   %eax
+  108a25:	ff d7                	call   *%edi
+}
+  108a27:	83 c4 10             	add    $0x10,%esp
+  108a2a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  108a2d:	5b                   	pop    %ebx
+  108a2e:	5e                   	pop    %esi
+  108a2f:	5f                   	pop    %edi
+  108a30:	5d                   	pop    %ebp
+  108a31:	c3                   	ret
+
+00108a32 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  108a32:	55                   	push   %ebp
+  108a33:	89 e5                	mov    %esp,%ebp
+  108a35:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  108a38:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  108a3c:	8b 10                	mov    (%eax),%edx
+  108a3e:	3b 50 04             	cmp    0x4(%eax),%edx
+  108a41:	73 0a                	jae    108a4d <sprintputch+0x1b>
+		*b->buf++ = ch;
+  108a43:	8d 4a 01             	lea    0x1(%edx),%ecx
+  108a46:	89 08                	mov    %ecx,(%eax)
+  108a48:	8b 45 08             	mov    0x8(%ebp),%eax
+  108a4b:	88 02                	mov    %al,(%edx)
+}
+  108a4d:	5d                   	pop    %ebp
+  108a4e:	c3                   	ret
+
+00108a4f <printfmt>:
+{
+  108a4f:	55                   	push   %ebp
+  108a50:	89 e5                	mov    %esp,%ebp
+  108a52:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  108a55:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  108a58:	50                   	push   %eax
+  108a59:	ff 75 10             	push   0x10(%ebp)
+  108a5c:	ff 75 0c             	push   0xc(%ebp)
+  108a5f:	ff 75 08             	push   0x8(%ebp)
+  108a62:	e8 05 00 00 00       	call   108a6c <vprintfmt>
+}
+  108a67:	83 c4 10             	add    $0x10,%esp
+  108a6a:	c9                   	leave
+  108a6b:	c3                   	ret
+
+00108a6c <vprintfmt>:
+{
+  108a6c:	55                   	push   %ebp
+  108a6d:	89 e5                	mov    %esp,%ebp
+  108a6f:	57                   	push   %edi
+  108a70:	56                   	push   %esi
+  108a71:	53                   	push   %ebx
+  108a72:	83 ec 2c             	sub    $0x2c,%esp
+  108a75:	8b 75 08             	mov    0x8(%ebp),%esi
+  108a78:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  108a7b:	8b 7d 10             	mov    0x10(%ebp),%edi
+  108a7e:	eb 0a                	jmp    108a8a <vprintfmt+0x1e>
+			putch(ch, putdat);
+  108a80:	83 ec 08             	sub    $0x8,%esp
+  108a83:	53                   	push   %ebx
+  108a84:	50                   	push   %eax
+  108a85:	ff d6                	call   *%esi
+  108a87:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  108a8a:	83 c7 01             	add    $0x1,%edi
+  108a8d:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  108a91:	83 f8 25             	cmp    $0x25,%eax
+  108a94:	74 0c                	je     108aa2 <vprintfmt+0x36>
+			if (ch == '\0')
+  108a96:	85 c0                	test   %eax,%eax
+  108a98:	75 e6                	jne    108a80 <vprintfmt+0x14>
+}
+  108a9a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  108a9d:	5b                   	pop    %ebx
+  108a9e:	5e                   	pop    %esi
+  108a9f:	5f                   	pop    %edi
+  108aa0:	5d                   	pop    %ebp
+  108aa1:	c3                   	ret
+		padc = ' ';
+  108aa2:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  108aa6:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  108aad:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  108ab4:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  108abb:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  108ac0:	8d 47 01             	lea    0x1(%edi),%eax
+  108ac3:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  108ac6:	0f b6 17             	movzbl (%edi),%edx
+  108ac9:	8d 42 dd             	lea    -0x23(%edx),%eax
+  108acc:	3c 55                	cmp    $0x55,%al
+  108ace:	0f 87 9a 03 00 00    	ja     108e6e <vprintfmt+0x402>
+  108ad4:	0f b6 c0             	movzbl %al,%eax
+  108ad7:	ff 24 85 40 a6 10 00 	jmp    *0x10a640(,%eax,4)
+  108ade:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  108ae1:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  108ae5:	eb d9                	jmp    108ac0 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  108ae7:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  108aea:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  108aee:	eb d0                	jmp    108ac0 <vprintfmt+0x54>
+  108af0:	0f b6 d2             	movzbl %dl,%edx
+  108af3:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  108af6:	b8 00 00 00 00       	mov    $0x0,%eax
+  108afb:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  108afe:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  108b01:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  108b05:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  108b08:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  108b0b:	83 f9 09             	cmp    $0x9,%ecx
+  108b0e:	77 55                	ja     108b65 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  108b10:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  108b13:	eb e9                	jmp    108afe <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  108b15:	8b 45 14             	mov    0x14(%ebp),%eax
+  108b18:	8b 00                	mov    (%eax),%eax
+  108b1a:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  108b1d:	8b 45 14             	mov    0x14(%ebp),%eax
+  108b20:	8d 40 04             	lea    0x4(%eax),%eax
+  108b23:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  108b26:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  108b29:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  108b2d:	79 91                	jns    108ac0 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  108b2f:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  108b32:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  108b35:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  108b3c:	eb 82                	jmp    108ac0 <vprintfmt+0x54>
+			if (width < 0)
+  108b3e:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  108b41:	85 d2                	test   %edx,%edx
+  108b43:	b8 00 00 00 00       	mov    $0x0,%eax
+  108b48:	0f 49 c2             	cmovns %edx,%eax
+  108b4b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  108b4e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  108b51:	e9 6a ff ff ff       	jmp    108ac0 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  108b56:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  108b59:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  108b60:	e9 5b ff ff ff       	jmp    108ac0 <vprintfmt+0x54>
+  108b65:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  108b68:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  108b6b:	eb bc                	jmp    108b29 <vprintfmt+0xbd>
+			lflag++;
+  108b6d:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  108b70:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  108b73:	e9 48 ff ff ff       	jmp    108ac0 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  108b78:	8b 45 14             	mov    0x14(%ebp),%eax
+  108b7b:	8d 78 04             	lea    0x4(%eax),%edi
+  108b7e:	83 ec 08             	sub    $0x8,%esp
+  108b81:	53                   	push   %ebx
+  108b82:	ff 30                	push   (%eax)
+  108b84:	ff d6                	call   *%esi
+			break;
+  108b86:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  108b89:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  108b8c:	e9 7c 02 00 00       	jmp    108e0d <vprintfmt+0x3a1>
+			err = va_arg(ap, int);
+  108b91:	8b 45 14             	mov    0x14(%ebp),%eax
+  108b94:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  108b97:	8b 10                	mov    (%eax),%edx
+  108b99:	89 d0                	mov    %edx,%eax
+  108b9b:	f7 d8                	neg    %eax
+  108b9d:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  108ba0:	83 f8 08             	cmp    $0x8,%eax
+  108ba3:	7f 23                	jg     108bc8 <vprintfmt+0x15c>
+  108ba5:	8b 14 85 a0 a7 10 00 	mov    0x10a7a0(,%eax,4),%edx
+  108bac:	85 d2                	test   %edx,%edx
+  108bae:	74 18                	je     108bc8 <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  108bb0:	52                   	push   %edx
+  108bb1:	68 12 95 10 00       	push   $0x109512
+  108bb6:	53                   	push   %ebx
+  108bb7:	56                   	push   %esi
+  108bb8:	e8 92 fe ff ff       	call   108a4f <printfmt>
+  108bbd:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  108bc0:	89 7d 14             	mov    %edi,0x14(%ebp)
+  108bc3:	e9 45 02 00 00       	jmp    108e0d <vprintfmt+0x3a1>
+				printfmt(putch, putdat, "error %d", err);
+  108bc8:	50                   	push   %eax
+  108bc9:	68 a0 a5 10 00       	push   $0x10a5a0
+  108bce:	53                   	push   %ebx
+  108bcf:	56                   	push   %esi
+  108bd0:	e8 7a fe ff ff       	call   108a4f <printfmt>
+  108bd5:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  108bd8:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  108bdb:	e9 2d 02 00 00       	jmp    108e0d <vprintfmt+0x3a1>
+			if ((p = va_arg(ap, char *)) == NULL)
+  108be0:	8b 45 14             	mov    0x14(%ebp),%eax
+  108be3:	83 c0 04             	add    $0x4,%eax
+  108be6:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  108be9:	8b 45 14             	mov    0x14(%ebp),%eax
+  108bec:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  108bee:	85 c9                	test   %ecx,%ecx
+  108bf0:	b8 99 a5 10 00       	mov    $0x10a599,%eax
+  108bf5:	0f 45 c1             	cmovne %ecx,%eax
+  108bf8:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  108bfb:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  108bff:	7e 06                	jle    108c07 <vprintfmt+0x19b>
+  108c01:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  108c05:	75 0b                	jne    108c12 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  108c07:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  108c0a:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  108c0d:	89 75 08             	mov    %esi,0x8(%ebp)
+  108c10:	eb 5c                	jmp    108c6e <vprintfmt+0x202>
+  108c12:	83 ec 08             	sub    $0x8,%esp
+  108c15:	ff 75 d0             	push   -0x30(%ebp)
+  108c18:	ff 75 cc             	push   -0x34(%ebp)
+  108c1b:	e8 cd 03 00 00       	call   108fed <strnlen>
+  108c20:	89 c2                	mov    %eax,%edx
+  108c22:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  108c25:	29 d0                	sub    %edx,%eax
+  108c27:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  108c2a:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  108c2e:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  108c31:	89 75 08             	mov    %esi,0x8(%ebp)
+  108c34:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  108c36:	eb 0e                	jmp    108c46 <vprintfmt+0x1da>
+					putch(padc, putdat);
+  108c38:	83 ec 08             	sub    $0x8,%esp
+  108c3b:	53                   	push   %ebx
+  108c3c:	57                   	push   %edi
+  108c3d:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  108c40:	83 ee 01             	sub    $0x1,%esi
+  108c43:	83 c4 10             	add    $0x10,%esp
+  108c46:	85 f6                	test   %esi,%esi
+  108c48:	7f ee                	jg     108c38 <vprintfmt+0x1cc>
+  108c4a:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  108c4d:	8b 75 08             	mov    0x8(%ebp),%esi
+  108c50:	85 c0                	test   %eax,%eax
+  108c52:	ba 00 00 00 00       	mov    $0x0,%edx
+  108c57:	0f 49 d0             	cmovns %eax,%edx
+  108c5a:	29 d0                	sub    %edx,%eax
+  108c5c:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  108c5f:	eb a6                	jmp    108c07 <vprintfmt+0x19b>
+					putch(ch, putdat);
+  108c61:	83 ec 08             	sub    $0x8,%esp
+  108c64:	53                   	push   %ebx
+  108c65:	52                   	push   %edx
+  108c66:	ff 55 08             	call   *0x8(%ebp)
+  108c69:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  108c6c:	89 f1                	mov    %esi,%ecx
+  108c6e:	8d 71 01             	lea    0x1(%ecx),%esi
+  108c71:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  108c75:	0f be d0             	movsbl %al,%edx
+  108c78:	85 d2                	test   %edx,%edx
+  108c7a:	74 28                	je     108ca4 <vprintfmt+0x238>
+  108c7c:	85 ff                	test   %edi,%edi
+  108c7e:	78 05                	js     108c85 <vprintfmt+0x219>
+  108c80:	83 ef 01             	sub    $0x1,%edi
+  108c83:	78 30                	js     108cb5 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  108c85:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  108c89:	74 d6                	je     108c61 <vprintfmt+0x1f5>
+  108c8b:	0f be c0             	movsbl %al,%eax
+  108c8e:	83 e8 20             	sub    $0x20,%eax
+  108c91:	83 f8 5e             	cmp    $0x5e,%eax
+  108c94:	76 cb                	jbe    108c61 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  108c96:	83 ec 08             	sub    $0x8,%esp
+  108c99:	53                   	push   %ebx
+  108c9a:	6a 3f                	push   $0x3f
+  108c9c:	ff 55 08             	call   *0x8(%ebp)
+  108c9f:	83 c4 10             	add    $0x10,%esp
+  108ca2:	eb c8                	jmp    108c6c <vprintfmt+0x200>
+  108ca4:	8b 75 08             	mov    0x8(%ebp),%esi
+  108ca7:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  108caa:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  108cad:	01 d0                	add    %edx,%eax
+  108caf:	29 c8                	sub    %ecx,%eax
+  108cb1:	89 c7                	mov    %eax,%edi
+  108cb3:	eb 13                	jmp    108cc8 <vprintfmt+0x25c>
+  108cb5:	8b 75 08             	mov    0x8(%ebp),%esi
+  108cb8:	eb ed                	jmp    108ca7 <vprintfmt+0x23b>
+				putch(' ', putdat);
+  108cba:	83 ec 08             	sub    $0x8,%esp
+  108cbd:	53                   	push   %ebx
+  108cbe:	6a 20                	push   $0x20
+  108cc0:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  108cc2:	83 ef 01             	sub    $0x1,%edi
+  108cc5:	83 c4 10             	add    $0x10,%esp
+  108cc8:	85 ff                	test   %edi,%edi
+  108cca:	7f ee                	jg     108cba <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  108ccc:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  108ccf:	89 45 14             	mov    %eax,0x14(%ebp)
+  108cd2:	e9 36 01 00 00       	jmp    108e0d <vprintfmt+0x3a1>
+	if (lflag >= 2)
+  108cd7:	83 f9 01             	cmp    $0x1,%ecx
+  108cda:	7f 1f                	jg     108cfb <vprintfmt+0x28f>
+	else if (lflag)
+  108cdc:	85 c9                	test   %ecx,%ecx
+  108cde:	74 67                	je     108d47 <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  108ce0:	8b 45 14             	mov    0x14(%ebp),%eax
+  108ce3:	8b 00                	mov    (%eax),%eax
+  108ce5:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  108ce8:	89 c1                	mov    %eax,%ecx
+  108cea:	c1 f9 1f             	sar    $0x1f,%ecx
+  108ced:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  108cf0:	8b 45 14             	mov    0x14(%ebp),%eax
+  108cf3:	8d 40 04             	lea    0x4(%eax),%eax
+  108cf6:	89 45 14             	mov    %eax,0x14(%ebp)
+  108cf9:	eb 17                	jmp    108d12 <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  108cfb:	8b 45 14             	mov    0x14(%ebp),%eax
+  108cfe:	8b 50 04             	mov    0x4(%eax),%edx
+  108d01:	8b 00                	mov    (%eax),%eax
+  108d03:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  108d06:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  108d09:	8b 45 14             	mov    0x14(%ebp),%eax
+  108d0c:	8d 40 08             	lea    0x8(%eax),%eax
+  108d0f:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  108d12:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  108d15:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  108d18:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  108d1d:	85 c9                	test   %ecx,%ecx
+  108d1f:	0f 89 ce 00 00 00    	jns    108df3 <vprintfmt+0x387>
+				putch('-', putdat);
+  108d25:	83 ec 08             	sub    $0x8,%esp
+  108d28:	53                   	push   %ebx
+  108d29:	6a 2d                	push   $0x2d
+  108d2b:	ff d6                	call   *%esi
+				num = -(long long) num;
+  108d2d:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  108d30:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  108d33:	f7 da                	neg    %edx
+  108d35:	83 d1 00             	adc    $0x0,%ecx
+  108d38:	f7 d9                	neg    %ecx
+  108d3a:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  108d3d:	bf 0a 00 00 00       	mov    $0xa,%edi
+  108d42:	e9 ac 00 00 00       	jmp    108df3 <vprintfmt+0x387>
+		return va_arg(*ap, int);
+  108d47:	8b 45 14             	mov    0x14(%ebp),%eax
+  108d4a:	8b 00                	mov    (%eax),%eax
+  108d4c:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  108d4f:	89 c1                	mov    %eax,%ecx
+  108d51:	c1 f9 1f             	sar    $0x1f,%ecx
+  108d54:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  108d57:	8b 45 14             	mov    0x14(%ebp),%eax
+  108d5a:	8d 40 04             	lea    0x4(%eax),%eax
+  108d5d:	89 45 14             	mov    %eax,0x14(%ebp)
+  108d60:	eb b0                	jmp    108d12 <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  108d62:	83 f9 01             	cmp    $0x1,%ecx
+  108d65:	7f 1b                	jg     108d82 <vprintfmt+0x316>
+	else if (lflag)
+  108d67:	85 c9                	test   %ecx,%ecx
+  108d69:	74 2c                	je     108d97 <vprintfmt+0x32b>
+		return va_arg(*ap, unsigned long);
+  108d6b:	8b 45 14             	mov    0x14(%ebp),%eax
+  108d6e:	8b 10                	mov    (%eax),%edx
+  108d70:	b9 00 00 00 00       	mov    $0x0,%ecx
+  108d75:	8d 40 04             	lea    0x4(%eax),%eax
+  108d78:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  108d7b:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  108d80:	eb 71                	jmp    108df3 <vprintfmt+0x387>
+		return va_arg(*ap, unsigned long long);
+  108d82:	8b 45 14             	mov    0x14(%ebp),%eax
+  108d85:	8b 10                	mov    (%eax),%edx
+  108d87:	8b 48 04             	mov    0x4(%eax),%ecx
+  108d8a:	8d 40 08             	lea    0x8(%eax),%eax
+  108d8d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  108d90:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  108d95:	eb 5c                	jmp    108df3 <vprintfmt+0x387>
+		return va_arg(*ap, unsigned int);
+  108d97:	8b 45 14             	mov    0x14(%ebp),%eax
+  108d9a:	8b 10                	mov    (%eax),%edx
+  108d9c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  108da1:	8d 40 04             	lea    0x4(%eax),%eax
+  108da4:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  108da7:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  108dac:	eb 45                	jmp    108df3 <vprintfmt+0x387>
+			putch('X', putdat);
+  108dae:	83 ec 08             	sub    $0x8,%esp
+  108db1:	53                   	push   %ebx
+  108db2:	6a 58                	push   $0x58
+  108db4:	ff d6                	call   *%esi
+			putch('X', putdat);
+  108db6:	83 c4 08             	add    $0x8,%esp
+  108db9:	53                   	push   %ebx
+  108dba:	6a 58                	push   $0x58
+  108dbc:	ff d6                	call   *%esi
+			putch('X', putdat);
+  108dbe:	83 c4 08             	add    $0x8,%esp
+  108dc1:	53                   	push   %ebx
+  108dc2:	6a 58                	push   $0x58
+  108dc4:	ff d6                	call   *%esi
+			break;
+  108dc6:	83 c4 10             	add    $0x10,%esp
+  108dc9:	eb 42                	jmp    108e0d <vprintfmt+0x3a1>
+			putch('0', putdat);
+  108dcb:	83 ec 08             	sub    $0x8,%esp
+  108dce:	53                   	push   %ebx
+  108dcf:	6a 30                	push   $0x30
+  108dd1:	ff d6                	call   *%esi
+			putch('x', putdat);
+  108dd3:	83 c4 08             	add    $0x8,%esp
+  108dd6:	53                   	push   %ebx
+  108dd7:	6a 78                	push   $0x78
+  108dd9:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  108ddb:	8b 45 14             	mov    0x14(%ebp),%eax
+  108dde:	8b 10                	mov    (%eax),%edx
+  108de0:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  108de5:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  108de8:	8d 40 04             	lea    0x4(%eax),%eax
+  108deb:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  108dee:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  108df3:	83 ec 0c             	sub    $0xc,%esp
+  108df6:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  108dfa:	50                   	push   %eax
+  108dfb:	ff 75 e0             	push   -0x20(%ebp)
+  108dfe:	57                   	push   %edi
+  108dff:	51                   	push   %ecx
+  108e00:	52                   	push   %edx
+  108e01:	89 da                	mov    %ebx,%edx
+  108e03:	89 f0                	mov    %esi,%eax
+  108e05:	e8 7f fb ff ff       	call   108989 <printnum>
+			break;
+  108e0a:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  108e0d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  108e10:	e9 75 fc ff ff       	jmp    108a8a <vprintfmt+0x1e>
+	if (lflag >= 2)
+  108e15:	83 f9 01             	cmp    $0x1,%ecx
+  108e18:	7f 1b                	jg     108e35 <vprintfmt+0x3c9>
+	else if (lflag)
+  108e1a:	85 c9                	test   %ecx,%ecx
+  108e1c:	74 2c                	je     108e4a <vprintfmt+0x3de>
+		return va_arg(*ap, unsigned long);
+  108e1e:	8b 45 14             	mov    0x14(%ebp),%eax
+  108e21:	8b 10                	mov    (%eax),%edx
+  108e23:	b9 00 00 00 00       	mov    $0x0,%ecx
+  108e28:	8d 40 04             	lea    0x4(%eax),%eax
+  108e2b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  108e2e:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  108e33:	eb be                	jmp    108df3 <vprintfmt+0x387>
+		return va_arg(*ap, unsigned long long);
+  108e35:	8b 45 14             	mov    0x14(%ebp),%eax
+  108e38:	8b 10                	mov    (%eax),%edx
+  108e3a:	8b 48 04             	mov    0x4(%eax),%ecx
+  108e3d:	8d 40 08             	lea    0x8(%eax),%eax
+  108e40:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  108e43:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  108e48:	eb a9                	jmp    108df3 <vprintfmt+0x387>
+		return va_arg(*ap, unsigned int);
+  108e4a:	8b 45 14             	mov    0x14(%ebp),%eax
+  108e4d:	8b 10                	mov    (%eax),%edx
+  108e4f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  108e54:	8d 40 04             	lea    0x4(%eax),%eax
+  108e57:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  108e5a:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  108e5f:	eb 92                	jmp    108df3 <vprintfmt+0x387>
+			putch(ch, putdat);
+  108e61:	83 ec 08             	sub    $0x8,%esp
+  108e64:	53                   	push   %ebx
+  108e65:	6a 25                	push   $0x25
+  108e67:	ff d6                	call   *%esi
+			break;
+  108e69:	83 c4 10             	add    $0x10,%esp
+  108e6c:	eb 9f                	jmp    108e0d <vprintfmt+0x3a1>
+			putch('%', putdat);
+  108e6e:	83 ec 08             	sub    $0x8,%esp
+  108e71:	53                   	push   %ebx
+  108e72:	6a 25                	push   $0x25
+  108e74:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  108e76:	83 c4 10             	add    $0x10,%esp
+  108e79:	89 f8                	mov    %edi,%eax
+  108e7b:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  108e7f:	74 05                	je     108e86 <vprintfmt+0x41a>
+  108e81:	83 e8 01             	sub    $0x1,%eax
+  108e84:	eb f5                	jmp    108e7b <vprintfmt+0x40f>
+  108e86:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  108e89:	eb 82                	jmp    108e0d <vprintfmt+0x3a1>
+
+00108e8b <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  108e8b:	55                   	push   %ebp
+  108e8c:	89 e5                	mov    %esp,%ebp
+  108e8e:	83 ec 18             	sub    $0x18,%esp
+  108e91:	8b 45 08             	mov    0x8(%ebp),%eax
+  108e94:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  108e97:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  108e9a:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  108e9e:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  108ea1:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  108ea8:	85 c0                	test   %eax,%eax
+  108eaa:	74 26                	je     108ed2 <vsnprintf+0x47>
+  108eac:	85 d2                	test   %edx,%edx
+  108eae:	7e 22                	jle    108ed2 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  108eb0:	ff 75 14             	push   0x14(%ebp)
+  108eb3:	ff 75 10             	push   0x10(%ebp)
+  108eb6:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  108eb9:	50                   	push   %eax
+  108eba:	68 32 8a 10 00       	push   $0x108a32
+  108ebf:	e8 a8 fb ff ff       	call   108a6c <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  108ec4:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  108ec7:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  108eca:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  108ecd:	83 c4 10             	add    $0x10,%esp
+}
+  108ed0:	c9                   	leave
+  108ed1:	c3                   	ret
+		return -E_INVAL;
+  108ed2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  108ed7:	eb f7                	jmp    108ed0 <vsnprintf+0x45>
+
+00108ed9 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  108ed9:	55                   	push   %ebp
+  108eda:	89 e5                	mov    %esp,%ebp
+  108edc:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  108edf:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  108ee2:	50                   	push   %eax
+  108ee3:	ff 75 10             	push   0x10(%ebp)
+  108ee6:	ff 75 0c             	push   0xc(%ebp)
+  108ee9:	ff 75 08             	push   0x8(%ebp)
+  108eec:	e8 9a ff ff ff       	call   108e8b <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  108ef1:	c9                   	leave
+  108ef2:	c3                   	ret
+
+00108ef3 <readline>:
+#define BUFLEN 1024
+static char buf[BUFLEN];
+
+char *
+readline(const char *prompt)
+{
+  108ef3:	55                   	push   %ebp
+  108ef4:	89 e5                	mov    %esp,%ebp
+  108ef6:	57                   	push   %edi
+  108ef7:	56                   	push   %esi
+  108ef8:	53                   	push   %ebx
+  108ef9:	83 ec 0c             	sub    $0xc,%esp
+  108efc:	8b 45 08             	mov    0x8(%ebp),%eax
+	int i, c, echoing;
+
+	if (prompt != NULL)
+  108eff:	85 c0                	test   %eax,%eax
+  108f01:	74 11                	je     108f14 <readline+0x21>
+		cprintf("%s", prompt);
+  108f03:	83 ec 08             	sub    $0x8,%esp
+  108f06:	50                   	push   %eax
+  108f07:	68 12 95 10 00       	push   $0x109512
+  108f0c:	e8 23 e9 ff ff       	call   107834 <cprintf>
+  108f11:	83 c4 10             	add    $0x10,%esp
+
+	i = 0;
+	echoing = iscons(0);
+  108f14:	83 ec 0c             	sub    $0xc,%esp
+  108f17:	6a 00                	push   $0x0
+  108f19:	e8 54 79 ff ff       	call   100872 <iscons>
+  108f1e:	89 c7                	mov    %eax,%edi
+  108f20:	83 c4 10             	add    $0x10,%esp
+	i = 0;
+  108f23:	be 00 00 00 00       	mov    $0x0,%esi
+  108f28:	eb 3f                	jmp    108f69 <readline+0x76>
+	while (1) {
+		c = getchar();
+		if (c < 0) {
+			cprintf("read error: %i\n", c);
+  108f2a:	83 ec 08             	sub    $0x8,%esp
+  108f2d:	50                   	push   %eax
+  108f2e:	68 c4 a7 10 00       	push   $0x10a7c4
+  108f33:	e8 fc e8 ff ff       	call   107834 <cprintf>
+			return NULL;
+  108f38:	83 c4 10             	add    $0x10,%esp
+  108f3b:	b8 00 00 00 00       	mov    $0x0,%eax
+				cputchar('\n');
+			buf[i] = 0;
+			return buf;
+		}
+	}
+}
+  108f40:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  108f43:	5b                   	pop    %ebx
+  108f44:	5e                   	pop    %esi
+  108f45:	5f                   	pop    %edi
+  108f46:	5d                   	pop    %ebp
+  108f47:	c3                   	ret
+			if (echoing)
+  108f48:	85 ff                	test   %edi,%edi
+  108f4a:	75 05                	jne    108f51 <readline+0x5e>
+			i--;
+  108f4c:	83 ee 01             	sub    $0x1,%esi
+  108f4f:	eb 18                	jmp    108f69 <readline+0x76>
+				cputchar('\b');
+  108f51:	83 ec 0c             	sub    $0xc,%esp
+  108f54:	6a 08                	push   $0x8
+  108f56:	e8 f6 78 ff ff       	call   100851 <cputchar>
+  108f5b:	83 c4 10             	add    $0x10,%esp
+  108f5e:	eb ec                	jmp    108f4c <readline+0x59>
+			buf[i++] = c;
+  108f60:	88 9e c0 0d 12 00    	mov    %bl,0x120dc0(%esi)
+  108f66:	8d 76 01             	lea    0x1(%esi),%esi
+		c = getchar();
+  108f69:	e8 f3 78 ff ff       	call   100861 <getchar>
+  108f6e:	89 c3                	mov    %eax,%ebx
+		if (c < 0) {
+  108f70:	85 c0                	test   %eax,%eax
+  108f72:	78 b6                	js     108f2a <readline+0x37>
+		} else if ((c == '\b' || c == '\x7f') && i > 0) {
+  108f74:	83 f8 08             	cmp    $0x8,%eax
+  108f77:	0f 94 c0             	sete   %al
+  108f7a:	83 fb 7f             	cmp    $0x7f,%ebx
+  108f7d:	0f 94 c2             	sete   %dl
+  108f80:	08 d0                	or     %dl,%al
+  108f82:	74 04                	je     108f88 <readline+0x95>
+  108f84:	85 f6                	test   %esi,%esi
+  108f86:	7f c0                	jg     108f48 <readline+0x55>
+		} else if (c >= ' ' && i < BUFLEN-1) {
+  108f88:	83 fb 1f             	cmp    $0x1f,%ebx
+  108f8b:	7e 1a                	jle    108fa7 <readline+0xb4>
+  108f8d:	81 fe fe 03 00 00    	cmp    $0x3fe,%esi
+  108f93:	7f 12                	jg     108fa7 <readline+0xb4>
+			if (echoing)
+  108f95:	85 ff                	test   %edi,%edi
+  108f97:	74 c7                	je     108f60 <readline+0x6d>
+				cputchar(c);
+  108f99:	83 ec 0c             	sub    $0xc,%esp
+  108f9c:	53                   	push   %ebx
+  108f9d:	e8 af 78 ff ff       	call   100851 <cputchar>
+  108fa2:	83 c4 10             	add    $0x10,%esp
+  108fa5:	eb b9                	jmp    108f60 <readline+0x6d>
+		} else if (c == '\n' || c == '\r') {
+  108fa7:	83 fb 0a             	cmp    $0xa,%ebx
+  108faa:	74 05                	je     108fb1 <readline+0xbe>
+  108fac:	83 fb 0d             	cmp    $0xd,%ebx
+  108faf:	75 b8                	jne    108f69 <readline+0x76>
+			if (echoing)
+  108fb1:	85 ff                	test   %edi,%edi
+  108fb3:	75 11                	jne    108fc6 <readline+0xd3>
+			buf[i] = 0;
+  108fb5:	c6 86 c0 0d 12 00 00 	movb   $0x0,0x120dc0(%esi)
+			return buf;
+  108fbc:	b8 c0 0d 12 00       	mov    $0x120dc0,%eax
+  108fc1:	e9 7a ff ff ff       	jmp    108f40 <readline+0x4d>
+				cputchar('\n');
+  108fc6:	83 ec 0c             	sub    $0xc,%esp
+  108fc9:	6a 0a                	push   $0xa
+  108fcb:	e8 81 78 ff ff       	call   100851 <cputchar>
+  108fd0:	83 c4 10             	add    $0x10,%esp
+  108fd3:	eb e0                	jmp    108fb5 <readline+0xc2>
+
+00108fd5 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  108fd5:	55                   	push   %ebp
+  108fd6:	89 e5                	mov    %esp,%ebp
+  108fd8:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  108fdb:	b8 00 00 00 00       	mov    $0x0,%eax
+  108fe0:	eb 03                	jmp    108fe5 <strlen+0x10>
+		n++;
+  108fe2:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  108fe5:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  108fe9:	75 f7                	jne    108fe2 <strlen+0xd>
+	return n;
+}
+  108feb:	5d                   	pop    %ebp
+  108fec:	c3                   	ret
+
+00108fed <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  108fed:	55                   	push   %ebp
+  108fee:	89 e5                	mov    %esp,%ebp
+  108ff0:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  108ff3:	8b 55 0c             	mov    0xc(%ebp),%edx
+  108ff6:	b8 00 00 00 00       	mov    $0x0,%eax
+  108ffb:	eb 03                	jmp    109000 <strnlen+0x13>
+		n++;
+  108ffd:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  109000:	39 d0                	cmp    %edx,%eax
+  109002:	74 08                	je     10900c <strnlen+0x1f>
+  109004:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  109008:	75 f3                	jne    108ffd <strnlen+0x10>
+  10900a:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  10900c:	89 d0                	mov    %edx,%eax
+  10900e:	5d                   	pop    %ebp
+  10900f:	c3                   	ret
+
+00109010 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  109010:	55                   	push   %ebp
+  109011:	89 e5                	mov    %esp,%ebp
+  109013:	53                   	push   %ebx
+  109014:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  109017:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  10901a:	b8 00 00 00 00       	mov    $0x0,%eax
+  10901f:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  109023:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  109026:	83 c0 01             	add    $0x1,%eax
+  109029:	84 d2                	test   %dl,%dl
+  10902b:	75 f2                	jne    10901f <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  10902d:	89 c8                	mov    %ecx,%eax
+  10902f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  109032:	c9                   	leave
+  109033:	c3                   	ret
+
+00109034 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  109034:	55                   	push   %ebp
+  109035:	89 e5                	mov    %esp,%ebp
+  109037:	53                   	push   %ebx
+  109038:	83 ec 10             	sub    $0x10,%esp
+  10903b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  10903e:	53                   	push   %ebx
+  10903f:	e8 91 ff ff ff       	call   108fd5 <strlen>
+  109044:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  109047:	ff 75 0c             	push   0xc(%ebp)
+  10904a:	01 d8                	add    %ebx,%eax
+  10904c:	50                   	push   %eax
+  10904d:	e8 be ff ff ff       	call   109010 <strcpy>
+	return dst;
+}
+  109052:	89 d8                	mov    %ebx,%eax
+  109054:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  109057:	c9                   	leave
+  109058:	c3                   	ret
+
+00109059 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  109059:	55                   	push   %ebp
+  10905a:	89 e5                	mov    %esp,%ebp
+  10905c:	56                   	push   %esi
+  10905d:	53                   	push   %ebx
+  10905e:	8b 75 08             	mov    0x8(%ebp),%esi
+  109061:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  109064:	89 f3                	mov    %esi,%ebx
+  109066:	03 5d 10             	add    0x10(%ebp),%ebx
+  109069:	89 f0                	mov    %esi,%eax
+  10906b:	eb 0f                	jmp    10907c <strncpy+0x23>
+		*dst++ = *src;
+  10906d:	83 c0 01             	add    $0x1,%eax
+  109070:	0f b6 0a             	movzbl (%edx),%ecx
+  109073:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  109076:	80 f9 01             	cmp    $0x1,%cl
+  109079:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  10907c:	39 d8                	cmp    %ebx,%eax
+  10907e:	75 ed                	jne    10906d <strncpy+0x14>
+	}
+	return ret;
+}
+  109080:	89 f0                	mov    %esi,%eax
+  109082:	5b                   	pop    %ebx
+  109083:	5e                   	pop    %esi
+  109084:	5d                   	pop    %ebp
+  109085:	c3                   	ret
+
+00109086 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  109086:	55                   	push   %ebp
+  109087:	89 e5                	mov    %esp,%ebp
+  109089:	56                   	push   %esi
+  10908a:	53                   	push   %ebx
+  10908b:	8b 75 08             	mov    0x8(%ebp),%esi
+  10908e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  109091:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  109094:	89 f0                	mov    %esi,%eax
+  109096:	85 d2                	test   %edx,%edx
+  109098:	74 21                	je     1090bb <strlcpy+0x35>
+  10909a:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  10909e:	89 f2                	mov    %esi,%edx
+  1090a0:	eb 09                	jmp    1090ab <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  1090a2:	83 c1 01             	add    $0x1,%ecx
+  1090a5:	83 c2 01             	add    $0x1,%edx
+  1090a8:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  1090ab:	39 c2                	cmp    %eax,%edx
+  1090ad:	74 09                	je     1090b8 <strlcpy+0x32>
+  1090af:	0f b6 19             	movzbl (%ecx),%ebx
+  1090b2:	84 db                	test   %bl,%bl
+  1090b4:	75 ec                	jne    1090a2 <strlcpy+0x1c>
+  1090b6:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  1090b8:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  1090bb:	29 f0                	sub    %esi,%eax
+}
+  1090bd:	5b                   	pop    %ebx
+  1090be:	5e                   	pop    %esi
+  1090bf:	5d                   	pop    %ebp
+  1090c0:	c3                   	ret
+
+001090c1 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  1090c1:	55                   	push   %ebp
+  1090c2:	89 e5                	mov    %esp,%ebp
+  1090c4:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  1090c7:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  1090ca:	eb 06                	jmp    1090d2 <strcmp+0x11>
+		p++, q++;
+  1090cc:	83 c1 01             	add    $0x1,%ecx
+  1090cf:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  1090d2:	0f b6 01             	movzbl (%ecx),%eax
+  1090d5:	84 c0                	test   %al,%al
+  1090d7:	74 04                	je     1090dd <strcmp+0x1c>
+  1090d9:	3a 02                	cmp    (%edx),%al
+  1090db:	74 ef                	je     1090cc <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  1090dd:	0f b6 c0             	movzbl %al,%eax
+  1090e0:	0f b6 12             	movzbl (%edx),%edx
+  1090e3:	29 d0                	sub    %edx,%eax
+}
+  1090e5:	5d                   	pop    %ebp
+  1090e6:	c3                   	ret
+
+001090e7 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  1090e7:	55                   	push   %ebp
+  1090e8:	89 e5                	mov    %esp,%ebp
+  1090ea:	53                   	push   %ebx
+  1090eb:	8b 45 08             	mov    0x8(%ebp),%eax
+  1090ee:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  1090f1:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  1090f4:	eb 09                	jmp    1090ff <strncmp+0x18>
+		n--, p++, q++;
+  1090f6:	83 ea 01             	sub    $0x1,%edx
+  1090f9:	83 c0 01             	add    $0x1,%eax
+  1090fc:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  1090ff:	85 d2                	test   %edx,%edx
+  109101:	74 18                	je     10911b <strncmp+0x34>
+  109103:	0f b6 18             	movzbl (%eax),%ebx
+  109106:	84 db                	test   %bl,%bl
+  109108:	74 04                	je     10910e <strncmp+0x27>
+  10910a:	3a 19                	cmp    (%ecx),%bl
+  10910c:	74 e8                	je     1090f6 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  10910e:	0f b6 00             	movzbl (%eax),%eax
+  109111:	0f b6 11             	movzbl (%ecx),%edx
+  109114:	29 d0                	sub    %edx,%eax
+}
+  109116:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  109119:	c9                   	leave
+  10911a:	c3                   	ret
+		return 0;
+  10911b:	b8 00 00 00 00       	mov    $0x0,%eax
+  109120:	eb f4                	jmp    109116 <strncmp+0x2f>
+
+00109122 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  109122:	55                   	push   %ebp
+  109123:	89 e5                	mov    %esp,%ebp
+  109125:	8b 45 08             	mov    0x8(%ebp),%eax
+  109128:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  10912c:	eb 03                	jmp    109131 <strchr+0xf>
+  10912e:	83 c0 01             	add    $0x1,%eax
+  109131:	0f b6 10             	movzbl (%eax),%edx
+  109134:	84 d2                	test   %dl,%dl
+  109136:	74 06                	je     10913e <strchr+0x1c>
+		if (*s == c)
+  109138:	38 ca                	cmp    %cl,%dl
+  10913a:	75 f2                	jne    10912e <strchr+0xc>
+  10913c:	eb 05                	jmp    109143 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  10913e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  109143:	5d                   	pop    %ebp
+  109144:	c3                   	ret
+
+00109145 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  109145:	55                   	push   %ebp
+  109146:	89 e5                	mov    %esp,%ebp
+  109148:	8b 45 08             	mov    0x8(%ebp),%eax
+  10914b:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  10914f:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  109152:	38 ca                	cmp    %cl,%dl
+  109154:	74 09                	je     10915f <strfind+0x1a>
+  109156:	84 d2                	test   %dl,%dl
+  109158:	74 05                	je     10915f <strfind+0x1a>
+	for (; *s; s++)
+  10915a:	83 c0 01             	add    $0x1,%eax
+  10915d:	eb f0                	jmp    10914f <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  10915f:	5d                   	pop    %ebp
+  109160:	c3                   	ret
+
+00109161 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  109161:	55                   	push   %ebp
+  109162:	89 e5                	mov    %esp,%ebp
+  109164:	57                   	push   %edi
+  109165:	8b 7d 08             	mov    0x8(%ebp),%edi
+  109168:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	if (n == 0)
+  10916b:	85 c9                	test   %ecx,%ecx
+  10916d:	74 20                	je     10918f <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  10916f:	89 f8                	mov    %edi,%eax
+  109171:	09 c8                	or     %ecx,%eax
+  109173:	a8 03                	test   $0x3,%al
+  109175:	75 12                	jne    109189 <memset+0x28>
+		c &= 0xFF;
+  109177:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  10917b:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  109181:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  109184:	fc                   	cld
+  109185:	f3 ab                	rep stos %eax,%es:(%edi)
+  109187:	eb 06                	jmp    10918f <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  109189:	8b 45 0c             	mov    0xc(%ebp),%eax
+  10918c:	fc                   	cld
+  10918d:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  10918f:	89 f8                	mov    %edi,%eax
+  109191:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  109194:	c9                   	leave
+  109195:	c3                   	ret
+
+00109196 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  109196:	55                   	push   %ebp
+  109197:	89 e5                	mov    %esp,%ebp
+  109199:	57                   	push   %edi
+  10919a:	56                   	push   %esi
+  10919b:	8b 45 08             	mov    0x8(%ebp),%eax
+  10919e:	8b 75 0c             	mov    0xc(%ebp),%esi
+  1091a1:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  1091a4:	39 c6                	cmp    %eax,%esi
+  1091a6:	73 32                	jae    1091da <memmove+0x44>
+  1091a8:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  1091ab:	39 d0                	cmp    %edx,%eax
+  1091ad:	73 2b                	jae    1091da <memmove+0x44>
+		s += n;
+		d += n;
+  1091af:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  1091b2:	89 d6                	mov    %edx,%esi
+  1091b4:	09 fe                	or     %edi,%esi
+  1091b6:	09 ce                	or     %ecx,%esi
+  1091b8:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  1091be:	75 0e                	jne    1091ce <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  1091c0:	83 ef 04             	sub    $0x4,%edi
+  1091c3:	8d 72 fc             	lea    -0x4(%edx),%esi
+  1091c6:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  1091c9:	fd                   	std
+  1091ca:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  1091cc:	eb 09                	jmp    1091d7 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  1091ce:	83 ef 01             	sub    $0x1,%edi
+  1091d1:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  1091d4:	fd                   	std
+  1091d5:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  1091d7:	fc                   	cld
+  1091d8:	eb 1a                	jmp    1091f4 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  1091da:	89 f2                	mov    %esi,%edx
+  1091dc:	09 c2                	or     %eax,%edx
+  1091de:	09 ca                	or     %ecx,%edx
+  1091e0:	f6 c2 03             	test   $0x3,%dl
+  1091e3:	75 0a                	jne    1091ef <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  1091e5:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  1091e8:	89 c7                	mov    %eax,%edi
+  1091ea:	fc                   	cld
+  1091eb:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  1091ed:	eb 05                	jmp    1091f4 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  1091ef:	89 c7                	mov    %eax,%edi
+  1091f1:	fc                   	cld
+  1091f2:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  1091f4:	5e                   	pop    %esi
+  1091f5:	5f                   	pop    %edi
+  1091f6:	5d                   	pop    %ebp
+  1091f7:	c3                   	ret
+
+001091f8 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  1091f8:	55                   	push   %ebp
+  1091f9:	89 e5                	mov    %esp,%ebp
+  1091fb:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  1091fe:	ff 75 10             	push   0x10(%ebp)
+  109201:	ff 75 0c             	push   0xc(%ebp)
+  109204:	ff 75 08             	push   0x8(%ebp)
+  109207:	e8 8a ff ff ff       	call   109196 <memmove>
+}
+  10920c:	c9                   	leave
+  10920d:	c3                   	ret
+
+0010920e <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  10920e:	55                   	push   %ebp
+  10920f:	89 e5                	mov    %esp,%ebp
+  109211:	56                   	push   %esi
+  109212:	53                   	push   %ebx
+  109213:	8b 45 08             	mov    0x8(%ebp),%eax
+  109216:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  109219:	89 c6                	mov    %eax,%esi
+  10921b:	03 75 10             	add    0x10(%ebp),%esi
+  10921e:	eb 06                	jmp    109226 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  109220:	83 c0 01             	add    $0x1,%eax
+  109223:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  109226:	39 f0                	cmp    %esi,%eax
+  109228:	74 14                	je     10923e <memcmp+0x30>
+		if (*s1 != *s2)
+  10922a:	0f b6 08             	movzbl (%eax),%ecx
+  10922d:	0f b6 1a             	movzbl (%edx),%ebx
+  109230:	38 d9                	cmp    %bl,%cl
+  109232:	74 ec                	je     109220 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  109234:	0f b6 c1             	movzbl %cl,%eax
+  109237:	0f b6 db             	movzbl %bl,%ebx
+  10923a:	29 d8                	sub    %ebx,%eax
+  10923c:	eb 05                	jmp    109243 <memcmp+0x35>
+	}
+
+	return 0;
+  10923e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  109243:	5b                   	pop    %ebx
+  109244:	5e                   	pop    %esi
+  109245:	5d                   	pop    %ebp
+  109246:	c3                   	ret
+
+00109247 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  109247:	55                   	push   %ebp
+  109248:	89 e5                	mov    %esp,%ebp
+  10924a:	8b 45 08             	mov    0x8(%ebp),%eax
+  10924d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  109250:	89 c2                	mov    %eax,%edx
+  109252:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  109255:	eb 03                	jmp    10925a <memfind+0x13>
+  109257:	83 c0 01             	add    $0x1,%eax
+  10925a:	39 d0                	cmp    %edx,%eax
+  10925c:	73 04                	jae    109262 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  10925e:	38 08                	cmp    %cl,(%eax)
+  109260:	75 f5                	jne    109257 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  109262:	5d                   	pop    %ebp
+  109263:	c3                   	ret
+
+00109264 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  109264:	55                   	push   %ebp
+  109265:	89 e5                	mov    %esp,%ebp
+  109267:	57                   	push   %edi
+  109268:	56                   	push   %esi
+  109269:	53                   	push   %ebx
+  10926a:	8b 55 08             	mov    0x8(%ebp),%edx
+  10926d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  109270:	eb 03                	jmp    109275 <strtol+0x11>
+		s++;
+  109272:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  109275:	0f b6 02             	movzbl (%edx),%eax
+  109278:	3c 20                	cmp    $0x20,%al
+  10927a:	74 f6                	je     109272 <strtol+0xe>
+  10927c:	3c 09                	cmp    $0x9,%al
+  10927e:	74 f2                	je     109272 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  109280:	3c 2b                	cmp    $0x2b,%al
+  109282:	74 2a                	je     1092ae <strtol+0x4a>
+	int neg = 0;
+  109284:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  109289:	3c 2d                	cmp    $0x2d,%al
+  10928b:	74 2b                	je     1092b8 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  10928d:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  109293:	75 0f                	jne    1092a4 <strtol+0x40>
+  109295:	80 3a 30             	cmpb   $0x30,(%edx)
+  109298:	74 28                	je     1092c2 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  10929a:	85 db                	test   %ebx,%ebx
+  10929c:	b8 0a 00 00 00       	mov    $0xa,%eax
+  1092a1:	0f 44 d8             	cmove  %eax,%ebx
+  1092a4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  1092a9:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  1092ac:	eb 46                	jmp    1092f4 <strtol+0x90>
+		s++;
+  1092ae:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  1092b1:	bf 00 00 00 00       	mov    $0x0,%edi
+  1092b6:	eb d5                	jmp    10928d <strtol+0x29>
+		s++, neg = 1;
+  1092b8:	83 c2 01             	add    $0x1,%edx
+  1092bb:	bf 01 00 00 00       	mov    $0x1,%edi
+  1092c0:	eb cb                	jmp    10928d <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  1092c2:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  1092c6:	74 0e                	je     1092d6 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  1092c8:	85 db                	test   %ebx,%ebx
+  1092ca:	75 d8                	jne    1092a4 <strtol+0x40>
+		s++, base = 8;
+  1092cc:	83 c2 01             	add    $0x1,%edx
+  1092cf:	bb 08 00 00 00       	mov    $0x8,%ebx
+  1092d4:	eb ce                	jmp    1092a4 <strtol+0x40>
+		s += 2, base = 16;
+  1092d6:	83 c2 02             	add    $0x2,%edx
+  1092d9:	bb 10 00 00 00       	mov    $0x10,%ebx
+  1092de:	eb c4                	jmp    1092a4 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  1092e0:	0f be c0             	movsbl %al,%eax
+  1092e3:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  1092e6:	3b 45 10             	cmp    0x10(%ebp),%eax
+  1092e9:	7d 3a                	jge    109325 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  1092eb:	83 c2 01             	add    $0x1,%edx
+  1092ee:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  1092f2:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  1092f4:	0f b6 02             	movzbl (%edx),%eax
+  1092f7:	8d 70 d0             	lea    -0x30(%eax),%esi
+  1092fa:	89 f3                	mov    %esi,%ebx
+  1092fc:	80 fb 09             	cmp    $0x9,%bl
+  1092ff:	76 df                	jbe    1092e0 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  109301:	8d 70 9f             	lea    -0x61(%eax),%esi
+  109304:	89 f3                	mov    %esi,%ebx
+  109306:	80 fb 19             	cmp    $0x19,%bl
+  109309:	77 08                	ja     109313 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  10930b:	0f be c0             	movsbl %al,%eax
+  10930e:	83 e8 57             	sub    $0x57,%eax
+  109311:	eb d3                	jmp    1092e6 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  109313:	8d 70 bf             	lea    -0x41(%eax),%esi
+  109316:	89 f3                	mov    %esi,%ebx
+  109318:	80 fb 19             	cmp    $0x19,%bl
+  10931b:	77 08                	ja     109325 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  10931d:	0f be c0             	movsbl %al,%eax
+  109320:	83 e8 37             	sub    $0x37,%eax
+  109323:	eb c1                	jmp    1092e6 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  109325:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  109329:	74 05                	je     109330 <strtol+0xcc>
+		*endptr = (char *) s;
+  10932b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  10932e:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  109330:	89 c8                	mov    %ecx,%eax
+  109332:	f7 d8                	neg    %eax
+  109334:	85 ff                	test   %edi,%edi
+  109336:	0f 45 c8             	cmovne %eax,%ecx
+}
+  109339:	89 c8                	mov    %ecx,%eax
+  10933b:	5b                   	pop    %ebx
+  10933c:	5e                   	pop    %esi
+  10933d:	5f                   	pop    %edi
+  10933e:	5d                   	pop    %ebp
+  10933f:	c3                   	ret
+
+00109340 <__udivmoddi4>:
+  109340:	55                   	push   %ebp
+  109341:	57                   	push   %edi
+  109342:	56                   	push   %esi
+  109343:	53                   	push   %ebx
+  109344:	83 ec 14             	sub    $0x14,%esp
+  109347:	8b 44 24 28          	mov    0x28(%esp),%eax
+  10934b:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  10934f:	8b 7c 24 30          	mov    0x30(%esp),%edi
+  109353:	8b 6c 24 34          	mov    0x34(%esp),%ebp
+  109357:	89 fb                	mov    %edi,%ebx
+  109359:	89 ee                	mov    %ebp,%esi
+  10935b:	8b 7c 24 38          	mov    0x38(%esp),%edi
+  10935f:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  109366:	00 
+  109367:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  10936e:	00 
+  10936f:	09 dd                	or     %ebx,%ebp
+  109371:	74 14                	je     109387 <__udivmoddi4+0x47>
+  109373:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  109378:	89 cd                	mov    %ecx,%ebp
+  10937a:	89 7c 24 38          	mov    %edi,0x38(%esp)
+  10937e:	89 1c 24             	mov    %ebx,(%esp)
+  109381:	89 74 24 04          	mov    %esi,0x4(%esp)
+  109385:	eb 27                	jmp    1093ae <__udivmoddi4+0x6e>
+  109387:	89 5c 24 08          	mov    %ebx,0x8(%esp)
+  10938b:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  10938f:	85 ff                	test   %edi,%edi
+  109391:	0f 84 84 00 00 00    	je     10941b <__udivmoddi4+0xdb>
+  109397:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+  10939d:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%edi)
+  1093a4:	eb 75                	jmp    10941b <__udivmoddi4+0xdb>
+  1093a6:	83 ed 01             	sub    $0x1,%ebp
+  1093a9:	83 fd ff             	cmp    $0xffffffff,%ebp
+  1093ac:	74 60                	je     10940e <__udivmoddi4+0xce>
+  1093ae:	89 c3                	mov    %eax,%ebx
+  1093b0:	89 d6                	mov    %edx,%esi
+  1093b2:	89 e9                	mov    %ebp,%ecx
+  1093b4:	0f ad f3             	shrd   %cl,%esi,%ebx
+  1093b7:	d3 ee                	shr    %cl,%esi
+  1093b9:	f6 c1 20             	test   $0x20,%cl
+  1093bc:	74 04                	je     1093c2 <__udivmoddi4+0x82>
+  1093be:	89 f3                	mov    %esi,%ebx
+  1093c0:	31 f6                	xor    %esi,%esi
+  1093c2:	8b 3c 24             	mov    (%esp),%edi
+  1093c5:	39 fb                	cmp    %edi,%ebx
+  1093c7:	89 f7                	mov    %esi,%edi
+  1093c9:	8b 1c 24             	mov    (%esp),%ebx
+  1093cc:	8b 74 24 04          	mov    0x4(%esp),%esi
+  1093d0:	19 f7                	sbb    %esi,%edi
+  1093d2:	72 d2                	jb     1093a6 <__udivmoddi4+0x66>
+  1093d4:	89 f7                	mov    %esi,%edi
+  1093d6:	89 de                	mov    %ebx,%esi
+  1093d8:	89 e9                	mov    %ebp,%ecx
+  1093da:	0f a5 f7             	shld   %cl,%esi,%edi
+  1093dd:	d3 e6                	shl    %cl,%esi
+  1093df:	f6 c1 20             	test   $0x20,%cl
+  1093e2:	74 04                	je     1093e8 <__udivmoddi4+0xa8>
+  1093e4:	89 f7                	mov    %esi,%edi
+  1093e6:	31 f6                	xor    %esi,%esi
+  1093e8:	29 f0                	sub    %esi,%eax
+  1093ea:	19 fa                	sbb    %edi,%edx
+  1093ec:	be 01 00 00 00       	mov    $0x1,%esi
+  1093f1:	bf 00 00 00 00       	mov    $0x0,%edi
+  1093f6:	0f a5 f7             	shld   %cl,%esi,%edi
+  1093f9:	d3 e6                	shl    %cl,%esi
+  1093fb:	f6 c1 20             	test   $0x20,%cl
+  1093fe:	74 04                	je     109404 <__udivmoddi4+0xc4>
+  109400:	89 f7                	mov    %esi,%edi
+  109402:	31 f6                	xor    %esi,%esi
+  109404:	09 74 24 08          	or     %esi,0x8(%esp)
+  109408:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  10940c:	eb 98                	jmp    1093a6 <__udivmoddi4+0x66>
+  10940e:	8b 7c 24 38          	mov    0x38(%esp),%edi
+  109412:	85 ff                	test   %edi,%edi
+  109414:	74 05                	je     10941b <__udivmoddi4+0xdb>
+  109416:	89 07                	mov    %eax,(%edi)
+  109418:	89 57 04             	mov    %edx,0x4(%edi)
+  10941b:	8b 44 24 08          	mov    0x8(%esp),%eax
+  10941f:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  109423:	83 c4 14             	add    $0x14,%esp
+  109426:	5b                   	pop    %ebx
+  109427:	5e                   	pop    %esi
+  109428:	5f                   	pop    %edi
+  109429:	5d                   	pop    %ebp
+  10942a:	c3                   	ret
+
+0010942b <__udivdi3>:
+  10942b:	83 ec 08             	sub    $0x8,%esp
+  10942e:	6a 00                	push   $0x0
+  109430:	ff 74 24 1c          	push   0x1c(%esp)
+  109434:	ff 74 24 1c          	push   0x1c(%esp)
+  109438:	ff 74 24 1c          	push   0x1c(%esp)
+  10943c:	ff 74 24 1c          	push   0x1c(%esp)
+  109440:	e8 fb fe ff ff       	call   109340 <__udivmoddi4>
+  109445:	83 c4 1c             	add    $0x1c,%esp
+  109448:	c3                   	ret
+
+00109449 <__umoddi3>:
+  109449:	83 ec 18             	sub    $0x18,%esp
+  10944c:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  109450:	50                   	push   %eax
+  109451:	ff 74 24 2c          	push   0x2c(%esp)
+  109455:	ff 74 24 2c          	push   0x2c(%esp)
+  109459:	ff 74 24 2c          	push   0x2c(%esp)
+  10945d:	ff 74 24 2c          	push   0x2c(%esp)
+  109461:	e8 da fe ff ff       	call   109340 <__udivmoddi4>
+  109466:	8b 44 24 20          	mov    0x20(%esp),%eax
+  10946a:	8b 54 24 24          	mov    0x24(%esp),%edx
+  10946e:	83 c4 2c             	add    $0x2c,%esp
+  109471:	c3                   	ret